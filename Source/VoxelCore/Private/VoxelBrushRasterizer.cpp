@@ -0,0 +1,183 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelBrushRasterizer.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	FORCEINLINE int32 FloorDiv(int32 A, int32 B)
+	{
+		return (A >= 0) ? (A / B) : ((A - B + 1) / B);
+	}
+}
+
+FVoxelBrushRasterizer::FVoxelBrushRasterizer(const FVoxelBrushParams& InBrush, float InVoxelSize)
+	: Brush(InBrush)
+{
+	const float VoxelSize = FMath::Max(InVoxelSize, UE_KINDA_SMALL_NUMBER);
+	RadiusVoxels = FMath::Max(Brush.Radius, UE_KINDA_SMALL_NUMBER) / VoxelSize;
+	InvRadiusVoxels = 1.0f / RadiusVoxels;
+	VoxelRadius = FMath::CeilToInt(Brush.Radius / VoxelSize);
+}
+
+void FVoxelBrushRasterizer::SplitByChunk(const FIntVector& CenterVoxel, int32 ChunkSize, TArray<FVoxelBrushChunkSpan>& OutSpans) const
+{
+	OutSpans.Reset();
+	if (ChunkSize <= 0)
+	{
+		return;
+	}
+
+	const FIntVector Min = CenterVoxel - FIntVector(VoxelRadius);
+	const FIntVector Max = CenterVoxel + FIntVector(VoxelRadius);
+	const FIntVector ChunkMin(FloorDiv(Min.X, ChunkSize), FloorDiv(Min.Y, ChunkSize), FloorDiv(Min.Z, ChunkSize));
+	const FIntVector ChunkMax(FloorDiv(Max.X, ChunkSize), FloorDiv(Max.Y, ChunkSize), FloorDiv(Max.Z, ChunkSize));
+
+	OutSpans.Reserve((ChunkMax.X - ChunkMin.X + 1) * (ChunkMax.Y - ChunkMin.Y + 1) * (ChunkMax.Z - ChunkMin.Z + 1));
+
+	for (int32 CZ = ChunkMin.Z; CZ <= ChunkMax.Z; ++CZ)
+	{
+		for (int32 CY = ChunkMin.Y; CY <= ChunkMax.Y; ++CY)
+		{
+			for (int32 CX = ChunkMin.X; CX <= ChunkMax.X; ++CX)
+			{
+				const FIntVector ChunkCoord(CX, CY, CZ);
+				const FIntVector ChunkBase = ChunkCoord * ChunkSize;
+
+				// Global voxel box of this chunk clipped to the brush box
+				const FIntVector GlobalMin(
+					FMath::Max(Min.X, ChunkBase.X), FMath::Max(Min.Y, ChunkBase.Y), FMath::Max(Min.Z, ChunkBase.Z));
+				const FIntVector GlobalMax(
+					FMath::Min(Max.X, ChunkBase.X + ChunkSize - 1),
+					FMath::Min(Max.Y, ChunkBase.Y + ChunkSize - 1),
+					FMath::Min(Max.Z, ChunkBase.Z + ChunkSize - 1));
+
+				FVoxelBrushChunkSpan& Span = OutSpans.AddDefaulted_GetRef();
+				Span.ChunkCoord = ChunkCoord;
+				Span.LocalMin = GlobalMin - ChunkBase;
+				Span.LocalMax = GlobalMax - ChunkBase;
+				Span.OffsetMin = GlobalMin - CenterVoxel;
+			}
+		}
+	}
+}
+
+bool FVoxelBrushRasterizer::ClipRow(int32 DY, int32 DZ, int32& InOutDXMin, int32& InOutDXMax) const
+{
+	float CrossSq = 0.0f;
+	switch (Brush.Shape)
+	{
+	case EVoxelBrushShape::Sphere:
+		CrossSq = static_cast<float>(DY * DY + DZ * DZ);
+		break;
+
+	case EVoxelBrushShape::Cylinder:
+		// Z is a hard cut; the falloff is radial in XY
+		if (FMath::Abs(DZ) > RadiusVoxels)
+		{
+			return false;
+		}
+		CrossSq = static_cast<float>(DY * DY);
+		break;
+
+	case EVoxelBrushShape::Cube:
+		if (FMath::Max(FMath::Abs(DY), FMath::Abs(DZ)) > RadiusVoxels)
+		{
+			return false;
+		}
+		return InOutDXMin <= InOutDXMax;
+	}
+
+	const float HalfSq = RadiusVoxels * RadiusVoxels - CrossSq;
+	if (HalfSq < 0.0f)
+	{
+		return false;
+	}
+
+	// +1 keeps the clip conservative against float rounding; RasterizeRow zeroes the extra voxel
+	const int32 Half = FMath::FloorToInt(FMath::Sqrt(HalfSq)) + 1;
+	InOutDXMin = FMath::Max(InOutDXMin, -Half);
+	InOutDXMax = FMath::Min(InOutDXMax, Half);
+	return InOutDXMin <= InOutDXMax;
+}
+
+void FVoxelBrushRasterizer::RasterizeRow(int32 DY, int32 DZ, int32 DXMin, int32 Count, float* OutStrength) const
+{
+	const bool bCube = Brush.Shape == EVoxelBrushShape::Cube;
+	const float Cross = bCube
+		? static_cast<float>(FMath::Max(FMath::Abs(DY), FMath::Abs(DZ)))
+		: static_cast<float>(Brush.Shape == EVoxelBrushShape::Cylinder ? DY * DY : DY * DY + DZ * DZ);
+
+	const VectorRegister4Float CrossV = VectorSetFloat1(Cross);
+	const VectorRegister4Float InvRadiusV = VectorSetFloat1(InvRadiusVoxels);
+	const VectorRegister4Float StrengthV = VectorSetFloat1(Brush.Strength);
+	const VectorRegister4Float One = VectorOneFloat();
+	const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+	const VectorRegister4Float Three = VectorSetFloat1(3.0f);
+	const VectorRegister4Float Step = VectorSetFloat1(4.0f);
+
+	VectorRegister4Float DX = MakeVectorRegisterFloat(
+		static_cast<float>(DXMin), static_cast<float>(DXMin + 1), static_cast<float>(DXMin + 2), static_cast<float>(DXMin + 3));
+
+	for (int32 Base = 0; Base < Count; Base += 4)
+	{
+		// Normalized distance, clamped to 1 (every falloff curve is 0 there)
+		VectorRegister4Float Normalized;
+		if (bCube)
+		{
+			Normalized = VectorMultiply(VectorMax(VectorAbs(DX), CrossV), InvRadiusV);
+		}
+		else
+		{
+			Normalized = VectorMultiply(VectorSqrt(VectorMultiplyAdd(DX, DX, CrossV)), InvRadiusV);
+		}
+		const VectorRegister4Float T = VectorMin(Normalized, One);
+		const VectorRegister4Float Inv = VectorSubtract(One, T);
+
+		VectorRegister4Float Falloff;
+		switch (Brush.FalloffType)
+		{
+		case EVoxelBrushFalloff::Smooth:
+			// 1 - (3t^2 - 2t^3) = 1 - t^2 (3 - 2t)
+			Falloff = VectorSubtract(One, VectorMultiply(VectorMultiply(T, T), VectorSubtract(Three, VectorMultiply(Two, T))));
+			break;
+
+		case EVoxelBrushFalloff::Sharp:
+			Falloff = VectorMultiply(Inv, Inv);
+			break;
+
+		case EVoxelBrushFalloff::Linear:
+		default:
+			Falloff = Inv;
+			break;
+		}
+
+		VectorStore(VectorMultiply(Falloff, StrengthV), OutStrength + Base);
+		DX = VectorAdd(DX, Step);
+	}
+}
+
+float FVoxelBrushRasterizer::GetStrength(const FIntVector& Offset) const
+{
+	float Distance = 0.0f;
+	switch (Brush.Shape)
+	{
+	case EVoxelBrushShape::Sphere:
+		Distance = FMath::Sqrt(static_cast<float>(Offset.X * Offset.X + Offset.Y * Offset.Y + Offset.Z * Offset.Z));
+		break;
+
+	case EVoxelBrushShape::Cube:
+		Distance = static_cast<float>(FMath::Max3(FMath::Abs(Offset.X), FMath::Abs(Offset.Y), FMath::Abs(Offset.Z)));
+		break;
+
+	case EVoxelBrushShape::Cylinder:
+		if (FMath::Abs(Offset.Z) > RadiusVoxels)
+		{
+			return 0.0f;
+		}
+		Distance = FMath::Sqrt(static_cast<float>(Offset.X * Offset.X + Offset.Y * Offset.Y));
+		break;
+	}
+
+	return Brush.Strength * Brush.GetFalloff(Distance * InvRadiusVoxels);
+}
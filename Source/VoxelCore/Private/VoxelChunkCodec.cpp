@@ -1,6 +1,7 @@
 // Copyright Daniel Raquel. All Rights Reserved.
 
 #include "VoxelChunkCodec.h"
+#include "VoxelStridedLattice.h"
 #include "Misc/Compression.h"
 
 FName FVoxelChunkCodec::CodecToFormat(EVoxelChunkCodec Codec)
@@ -111,7 +112,7 @@ bool FVoxelChunkCodec::Compress(const TArray<FVoxelData>& Data, EVoxelChunkCodec
 	Header.CodecId = static_cast<uint8>(UsedCodec);
 	Header.VoxelFormatVersion = VoxelFormatVersion;
 	Header.ChunkSize = static_cast<uint16>(ChunkSize);
-	Header.Pad = 0;
+	Header.CodecParam = 0;
 	Header.UncompressedBytes = static_cast<uint32>(RawBytes);
 
 	OutBuffer.SetNumUninitialized(sizeof(Header) + Payload.Num());
@@ -120,6 +121,60 @@ bool FVoxelChunkCodec::Compress(const TArray<FVoxelData>& Data, EVoxelChunkCodec
 	return true;
 }
 
+bool FVoxelChunkCodec::EncodeStrided(const TArray<FVoxelData>& Compact, int32 ChunkSize, int32 Stride, TArray<uint8>& OutBuffer)
+{
+	if (!FVoxelStridedLattice::IsValidStride(ChunkSize, Stride)
+		|| Compact.Num() != FVoxelStridedLattice::GetCompactVoxelCount(ChunkSize, Stride))
+	{
+		return false;
+	}
+
+	const int32 PayloadBytes = Compact.Num() * sizeof(FVoxelData);
+
+	FVoxelChunkBufferHeader Header;
+	Header.Magic = Magic;
+	Header.FormatVersion = FormatVersion;
+	Header.CodecId = static_cast<uint8>(EVoxelChunkCodec::Strided);
+	Header.VoxelFormatVersion = VoxelFormatVersion;
+	Header.ChunkSize = static_cast<uint16>(ChunkSize);
+	Header.CodecParam = static_cast<uint16>(Stride);
+	Header.UncompressedBytes = static_cast<uint32>(ChunkSize * ChunkSize * ChunkSize * sizeof(FVoxelData));
+
+	OutBuffer.SetNumUninitialized(sizeof(Header) + PayloadBytes);
+	FMemory::Memcpy(OutBuffer.GetData(), &Header, sizeof(Header));
+	FMemory::Memcpy(OutBuffer.GetData() + sizeof(Header), Compact.GetData(), PayloadBytes);
+	return true;
+}
+
+bool FVoxelChunkCodec::PeekHeader(const TArray<uint8>& Buffer, FVoxelChunkBufferHeader& OutHeader)
+{
+	if (Buffer.Num() < static_cast<int32>(sizeof(FVoxelChunkBufferHeader)))
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(&OutHeader, Buffer.GetData(), sizeof(OutHeader));
+	return OutHeader.Magic == Magic
+		&& OutHeader.FormatVersion == FormatVersion
+		&& OutHeader.VoxelFormatVersion == VoxelFormatVersion;
+}
+
+int32 FVoxelChunkCodec::GetBufferStride(const TArray<uint8>& Buffer)
+{
+	if (Buffer.Num() < static_cast<int32>(sizeof(FVoxelChunkBufferHeader)))
+	{
+		return 1;
+	}
+
+	FVoxelChunkBufferHeader Header;
+	FMemory::Memcpy(&Header, Buffer.GetData(), sizeof(Header));
+	if (Header.Magic != Magic || Header.CodecId != static_cast<uint8>(EVoxelChunkCodec::Strided))
+	{
+		return 1;
+	}
+	return FMath::Max<int32>(1, Header.CodecParam);
+}
+
 bool FVoxelChunkCodec::Decompress(const TArray<uint8>& Buffer, TArray<FVoxelData>& OutData)
 {
 	if (Buffer.Num() < static_cast<int32>(sizeof(FVoxelChunkBufferHeader)))
@@ -156,6 +211,20 @@ bool FVoxelChunkCodec::Decompress(const TArray<uint8>& Buffer, TArray<FVoxelData
 		return true;
 	}
 
+	if (Codec == EVoxelChunkCodec::Strided)
+	{
+		const int32 ChunkSize = Header.ChunkSize;
+		const int32 Stride = Header.CodecParam;
+		if (!FVoxelStridedLattice::IsValidStride(ChunkSize, Stride)
+			|| NumVoxels != ChunkSize * ChunkSize * ChunkSize
+			|| PayloadSize < FVoxelStridedLattice::GetCompactVoxelCount(ChunkSize, Stride) * static_cast<int32>(sizeof(FVoxelData)))
+		{
+			return false;
+		}
+		FVoxelStridedLattice::Expand(reinterpret_cast<const FVoxelData*>(Payload), ChunkSize, Stride, OutData);
+		return true;
+	}
+
 	const FName Fmt = CodecToFormat(Codec);
 	if (Fmt == NAME_None)
 	{
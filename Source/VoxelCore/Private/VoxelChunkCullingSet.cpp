@@ -0,0 +1,279 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelChunkCullingSet.h"
+#include "Math/VectorRegister.h"
+
+namespace VoxelChunkCullingSet
+{
+	/** Extent given to chunks without valid bounds: no plane can push them outside */
+	constexpr float UnboundedExtent = 1.0e30f;
+
+	/** One frustum plane splatted across four lanes, plus |normal| for the box push-out */
+	struct FPlaneLanes
+	{
+		VectorRegister4Float NormalX, NormalY, NormalZ, W;
+		VectorRegister4Float AbsX, AbsY, AbsZ;
+	};
+
+	/** Scalar FConvexVolume::IntersectBox equivalent for cell bounds */
+	static bool IntersectsBox(TConstArrayView<FPlane> Planes, const FBox& Box)
+	{
+		const FVector Center = Box.GetCenter();
+		const FVector Extent = Box.GetExtent();
+		for (const FPlane& Plane : Planes)
+		{
+			const double Distance = Plane.PlaneDot(Center);
+			const double PushOut = FMath::Abs(Plane.X * Extent.X) + FMath::Abs(Plane.Y * Extent.Y) + FMath::Abs(Plane.Z * Extent.Z);
+			if (Distance > PushOut)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+// ==================== FCell ====================
+
+void FVoxelChunkCullingSet::FCell::SetLane(int32 Index, const FVector3f& Center, const FVector3f& Extent)
+{
+	CenterX[Index] = Center.X;
+	CenterY[Index] = Center.Y;
+	CenterZ[Index] = Center.Z;
+	ExtentX[Index] = Extent.X;
+	ExtentY[Index] = Extent.Y;
+	ExtentZ[Index] = Extent.Z;
+}
+
+void FVoxelChunkCullingSet::FCell::RebuildBounds()
+{
+	Bounds.Init();
+	for (int32 i = 0; i < Coords.Num(); ++i)
+	{
+		const FVector Center(CenterX[i], CenterY[i], CenterZ[i]);
+		const FVector Extent(ExtentX[i], ExtentY[i], ExtentZ[i]);
+		Bounds += FBox(Center - Extent, Center + Extent);
+	}
+	bBoundsStale = false;
+}
+
+// ==================== FVoxelChunkCullingSet ====================
+
+FVoxelChunkCullingSet::FVoxelChunkCullingSet(int32 InCellSizeInChunks)
+{
+	Reset(InCellSizeInChunks);
+}
+
+void FVoxelChunkCullingSet::Reset(int32 InCellSizeInChunks)
+{
+	Cells.Reset();
+	CellIndices.Reset();
+	Slots.Reset();
+	CellSizeInChunks = FMath::Max(0, InCellSizeInChunks);
+}
+
+FIntVector2 FVoxelChunkCullingSet::GetCellKey(const FIntVector& ChunkCoord) const
+{
+	if (CellSizeInChunks <= 0)
+	{
+		return FIntVector2::ZeroValue;
+	}
+	return FIntVector2(
+		FMath::DivideAndRoundDown(ChunkCoord.X, CellSizeInChunks),
+		FMath::DivideAndRoundDown(ChunkCoord.Y, CellSizeInChunks));
+}
+
+void FVoxelChunkCullingSet::Update(const FIntVector& ChunkCoord, const FBox& Bounds)
+{
+	using namespace VoxelChunkCullingSet;
+
+	const FVector3f Center = Bounds.IsValid ? FVector3f(Bounds.GetCenter()) : FVector3f::ZeroVector;
+	const FVector3f Extent = Bounds.IsValid ? FVector3f(Bounds.GetExtent()) : FVector3f(UnboundedExtent);
+	const FBox LaneBox(FVector(Center - Extent), FVector(Center + Extent));
+	const FIntVector2 CellKey = GetCellKey(ChunkCoord);
+
+	if (FSlot* Existing = Slots.Find(ChunkCoord))
+	{
+		FCell& Cell = Cells[Existing->Cell];
+		if (Cell.Key == CellKey)
+		{
+			// In-place replace; the old bounds may have been larger, so tighten on the next Cull
+			Cell.SetLane(Existing->Index, Center, Extent);
+			Cell.Bounds += LaneBox;
+			Cell.bBoundsStale = true;
+			return;
+		}
+		const FSlot OldSlot = *Existing;
+		Slots.Remove(ChunkCoord);
+		RemoveFromCell(ChunkCoord, OldSlot);
+	}
+
+	int32 CellIndex;
+	if (const int32* Found = CellIndices.Find(CellKey))
+	{
+		CellIndex = *Found;
+	}
+	else
+	{
+		CellIndex = Cells.AddDefaulted();
+		Cells[CellIndex].Key = CellKey;
+		CellIndices.Add(CellKey, CellIndex);
+	}
+
+	FCell& Cell = Cells[CellIndex];
+	const int32 Index = Cell.Coords.Add(ChunkCoord);
+	if (Index % 4 == 0)
+	{
+		// Open a new group of four lanes
+		Cell.CenterX.AddZeroed(4);
+		Cell.CenterY.AddZeroed(4);
+		Cell.CenterZ.AddZeroed(4);
+		Cell.ExtentX.AddZeroed(4);
+		Cell.ExtentY.AddZeroed(4);
+		Cell.ExtentZ.AddZeroed(4);
+	}
+	Cell.SetLane(Index, Center, Extent);
+	Cell.Bounds += LaneBox;
+
+	Slots.Add(ChunkCoord, FSlot{ CellIndex, Index });
+}
+
+void FVoxelChunkCullingSet::Remove(const FIntVector& ChunkCoord)
+{
+	FSlot Slot;
+	if (Slots.RemoveAndCopyValue(ChunkCoord, Slot))
+	{
+		RemoveFromCell(ChunkCoord, Slot);
+	}
+}
+
+void FVoxelChunkCullingSet::RemoveFromCell(const FIntVector& ChunkCoord, const FSlot& Slot)
+{
+	FCell& Cell = Cells[Slot.Cell];
+	const int32 Last = Cell.Num() - 1;
+
+	// Swap the last lane into the hole
+	if (Slot.Index != Last)
+	{
+		const FIntVector Moved = Cell.Coords[Last];
+		Cell.Coords[Slot.Index] = Moved;
+		Cell.SetLane(Slot.Index,
+			FVector3f(Cell.CenterX[Last], Cell.CenterY[Last], Cell.CenterZ[Last]),
+			FVector3f(Cell.ExtentX[Last], Cell.ExtentY[Last], Cell.ExtentZ[Last]));
+		Slots[Moved].Index = Slot.Index;
+	}
+	Cell.Coords.Pop(EAllowShrinking::No);
+	Cell.SetLane(Last, FVector3f::ZeroVector, FVector3f::ZeroVector);
+	if (Cell.Num() % 4 == 0)
+	{
+		const int32 NumLanes = Cell.Num();
+		Cell.CenterX.SetNum(NumLanes, EAllowShrinking::No);
+		Cell.CenterY.SetNum(NumLanes, EAllowShrinking::No);
+		Cell.CenterZ.SetNum(NumLanes, EAllowShrinking::No);
+		Cell.ExtentX.SetNum(NumLanes, EAllowShrinking::No);
+		Cell.ExtentY.SetNum(NumLanes, EAllowShrinking::No);
+		Cell.ExtentZ.SetNum(NumLanes, EAllowShrinking::No);
+	}
+	Cell.bBoundsStale = true;
+
+	if (Cell.Num() > 0)
+	{
+		return;
+	}
+
+	// Swap-remove the emptied cell and re-point the moved cell's chunks
+	const int32 LastCell = Cells.Num() - 1;
+	CellIndices.Remove(Cell.Key);
+	if (Slot.Cell != LastCell)
+	{
+		Cells[Slot.Cell] = MoveTemp(Cells[LastCell]);
+		CellIndices[Cells[Slot.Cell].Key] = Slot.Cell;
+		for (const FIntVector& Coord : Cells[Slot.Cell].Coords)
+		{
+			Slots[Coord].Cell = Slot.Cell;
+		}
+	}
+	Cells.Pop(EAllowShrinking::No);
+}
+
+void FVoxelChunkCullingSet::Cull(TConstArrayView<FPlane> Planes, TArray<FIntVector>& OutVisible, FVoxelChunkCullingStats* OutStats) const
+{
+	using namespace VoxelChunkCullingSet;
+
+	FVoxelChunkCullingStats Stats;
+
+	TArray<FPlaneLanes, TInlineAllocator<8>> PlaneLanes;
+	PlaneLanes.Reserve(Planes.Num());
+	for (const FPlane& Plane : Planes)
+	{
+		FPlaneLanes& Lanes = PlaneLanes.AddDefaulted_GetRef();
+		Lanes.NormalX = VectorSetFloat1(static_cast<float>(Plane.X));
+		Lanes.NormalY = VectorSetFloat1(static_cast<float>(Plane.Y));
+		Lanes.NormalZ = VectorSetFloat1(static_cast<float>(Plane.Z));
+		Lanes.W = VectorSetFloat1(static_cast<float>(Plane.W));
+		Lanes.AbsX = VectorSetFloat1(static_cast<float>(FMath::Abs(Plane.X)));
+		Lanes.AbsY = VectorSetFloat1(static_cast<float>(FMath::Abs(Plane.Y)));
+		Lanes.AbsZ = VectorSetFloat1(static_cast<float>(FMath::Abs(Plane.Z)));
+	}
+
+	for (FCell& Cell : Cells)
+	{
+		const int32 NumChunks = Cell.Num();
+		if (NumChunks == 0)
+		{
+			continue;
+		}
+
+		// Coarse rejection of the whole column cell
+		if (CellSizeInChunks > 0)
+		{
+			++Stats.CellsTested;
+			if (Cell.bBoundsStale)
+			{
+				Cell.RebuildBounds();
+			}
+			if (!IntersectsBox(Planes, Cell.Bounds))
+			{
+				++Stats.CellsRejected;
+				continue;
+			}
+		}
+
+		Stats.ChunksTested += NumChunks;
+		for (int32 Base = 0; Base < NumChunks; Base += 4)
+		{
+			const VectorRegister4Float CenterX = VectorLoad(&Cell.CenterX[Base]);
+			const VectorRegister4Float CenterY = VectorLoad(&Cell.CenterY[Base]);
+			const VectorRegister4Float CenterZ = VectorLoad(&Cell.CenterZ[Base]);
+			const VectorRegister4Float ExtentX = VectorLoad(&Cell.ExtentX[Base]);
+			const VectorRegister4Float ExtentY = VectorLoad(&Cell.ExtentY[Base]);
+			const VectorRegister4Float ExtentZ = VectorLoad(&Cell.ExtentZ[Base]);
+
+			// Outside any plane: distance of the centre beyond the box's projected half-size
+			VectorRegister4Float Outside = VectorZeroFloat();
+			for (const FPlaneLanes& Lanes : PlaneLanes)
+			{
+				const VectorRegister4Float Distance = VectorSubtract(
+					VectorMultiplyAdd(Lanes.NormalZ, CenterZ, VectorMultiplyAdd(Lanes.NormalY, CenterY, VectorMultiply(Lanes.NormalX, CenterX))),
+					Lanes.W);
+				const VectorRegister4Float PushOut =
+					VectorMultiplyAdd(Lanes.AbsZ, ExtentZ, VectorMultiplyAdd(Lanes.AbsY, ExtentY, VectorMultiply(Lanes.AbsX, ExtentX)));
+				Outside = VectorBitwiseOr(Outside, VectorCompareGT(Distance, PushOut));
+			}
+
+			const uint32 LaneMask = (1u << FMath::Min(4, NumChunks - Base)) - 1u;
+			uint32 Visible = ~static_cast<uint32>(VectorMaskBits(Outside)) & LaneMask;
+			while (Visible != 0)
+			{
+				OutVisible.Add(Cell.Coords[Base + FMath::CountTrailingZeros(Visible)]);
+				++Stats.ChunksVisible;
+				Visible &= Visible - 1;
+			}
+		}
+	}
+
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+}
@@ -0,0 +1,233 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelCompactVertex.h"
+#include "ChunkRenderData.h"
+
+namespace VoxelCompactVertexCodec
+{
+	/** Projection planes in the meshers' tie-break order, starting from the normal's dominant axis */
+	static void GetPlaneOrder(const FVector3f& Normal, uint32 OutOrder[3])
+	{
+		const float AbsX = FMath::Abs(Normal.X);
+		const float AbsY = FMath::Abs(Normal.Y);
+		const float AbsZ = FMath::Abs(Normal.Z);
+		const uint32 First = (AbsZ >= AbsX && AbsZ >= AbsY) ? 0 : (AbsX >= AbsY ? 1 : 2);
+		OutOrder[0] = First;
+		OutOrder[1] = First == 0 ? 1 : 0;
+		OutOrder[2] = First == 2 ? 1 : 2;
+	}
+
+	static bool IsNearUV(const FVector2f& A, const FVector2f& B)
+	{
+		return FMath::Abs(A.X - B.X) <= FVoxelCompactVertexFrame::UVTolerance
+			&& FMath::Abs(A.Y - B.Y) <= FVoxelCompactVertexFrame::UVTolerance;
+	}
+}
+
+bool FVoxelCompactVertexCodec::Encode(
+	const FChunkMeshData& MeshData,
+	float ChunkWorldSize,
+	TArray<FVoxelCompactVertex>& OutVertices,
+	FVoxelCompactVertexFrame& OutFrame,
+	FBox& OutLocalBounds)
+{
+	using namespace VoxelCompactVertexCodec;
+
+	const int32 VertexCount = MeshData.Positions.Num();
+	OutLocalBounds.Init();
+	if (VertexCount == 0 || ChunkWorldSize <= 0.0f)
+	{
+		return false;
+	}
+
+	// Same full-or-absent attribute rule as ConvertToVertices
+	const bool bHasNormals = MeshData.Normals.Num() >= VertexCount;
+	const bool bHasUVs = MeshData.UVs.Num() >= VertexCount;
+	const bool bHasColors = MeshData.Colors.Num() >= VertexCount;
+
+	OutFrame.PositionStep = ChunkWorldSize / FVoxelCompactVertexFrame::StepsPerChunk;
+	OutFrame.UVPerUnit = 0.0f;
+	const float InvStep = 1.0f / OutFrame.PositionStep;
+
+	auto Quantize = [InvStep](const FVector3f& Position, FVoxelCompactVertex& Out) -> bool
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const int32 Q = FMath::RoundToInt(Position[Axis] * InvStep) + FVoxelCompactVertexFrame::Bias;
+			if (Q < 0 || Q > MAX_uint16)
+			{
+				return false;
+			}
+			Out.Position[Axis] = static_cast<uint16>(Q);
+		}
+		return true;
+	};
+
+	// Pass 1: UV density from the first vertex with a non-zero UV (all-zero UVs keep density 0).
+	// Cubic meshes usually bail out here or on their first vertices in pass 2.
+	if (bHasUVs)
+	{
+		for (int32 i = 0; i < VertexCount; ++i)
+		{
+			const FVector2f& UV = MeshData.UVs[i];
+			if (IsNearUV(UV, FVector2f::ZeroVector))
+			{
+				continue;
+			}
+
+			// Density from the unquantized position: quantization error would otherwise scale
+			// with distance from the origin. Pass 2 checks every vertex against its quantized position.
+			const FVector3f& Position = MeshData.Positions[i];
+
+			uint32 Planes[3];
+			GetPlaneOrder(bHasNormals ? MeshData.Normals[i] : FVector3f::UpVector, Planes);
+			bool bFound = false;
+			for (const uint32 Plane : Planes)
+			{
+				const FVector2f Projected = FVoxelCompactVertexFrame::ProjectUV(Position, Plane, 1.0f);
+				const int32 Component = FMath::Abs(Projected.X) >= FMath::Abs(Projected.Y) ? 0 : 1;
+				if (FMath::Abs(Projected[Component]) < OutFrame.PositionStep)
+				{
+					continue;
+				}
+				const float Density = UV[Component] / Projected[Component];
+				if (IsNearUV(Projected * Density, UV))
+				{
+					OutFrame.UVPerUnit = Density;
+					bFound = true;
+					break;
+				}
+			}
+			if (!bFound)
+			{
+				return false;
+			}
+			break;
+		}
+	}
+
+	// Pass 2: quantize, pick a projection plane that reproduces the UV, pack attributes
+	OutVertices.SetNumUninitialized(VertexCount);
+	FVector3f BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector3f BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	for (int32 i = 0; i < VertexCount; ++i)
+	{
+		FVoxelCompactVertex& Out = OutVertices[i];
+		const FVector3f& SourcePosition = MeshData.Positions[i];
+		BoundsMin = FVector3f::Min(BoundsMin, SourcePosition);
+		BoundsMax = FVector3f::Max(BoundsMax, SourcePosition);
+
+		if (!Quantize(SourcePosition, Out))
+		{
+			return false;
+		}
+
+		const FVector3f Normal = bHasNormals ? MeshData.Normals[i] : FVector3f::UpVector;
+		const FVector2f UV = bHasUVs ? MeshData.UVs[i] : FVector2f::ZeroVector;
+		const FVector3f Position = OutFrame.DecodePosition(Out);
+
+		uint32 Planes[3];
+		GetPlaneOrder(Normal, Planes);
+		int32 Chosen = INDEX_NONE;
+		for (const uint32 Plane : Planes)
+		{
+			if (IsNearUV(FVoxelCompactVertexFrame::ProjectUV(Position, Plane, OutFrame.UVPerUnit), UV))
+			{
+				Chosen = static_cast<int32>(Plane);
+				break;
+			}
+		}
+		if (Chosen == INDEX_NONE)
+		{
+			return false;
+		}
+		Out.UVAxisAndFlags = static_cast<uint16>(Chosen);
+
+		// Pack through FVoxelVertex so the words match the full path exactly
+		FVoxelVertex Packed;
+		Packed.SetNormal(Normal);
+		if (bHasColors)
+		{
+			const FColor& Color = MeshData.Colors[i];
+			Packed.SetMaterialID(Color.R);
+			Packed.SetBiomeID(Color.G);
+			Packed.SetAO(Color.B >> 6);
+		}
+		Out.PackedNormalAndAO = Packed.PackedNormalAndAO;
+		Out.PackedMaterialData = Packed.PackedMaterialData;
+	}
+
+	OutLocalBounds += FVector(BoundsMin);
+	OutLocalBounds += FVector(BoundsMax);
+	return true;
+}
+
+void FVoxelCompactVertexCodec::ConvertToVertices(
+	const FChunkMeshData& MeshData,
+	TArray<FVoxelVertex>& OutVertices,
+	FBox& OutLocalBounds)
+{
+	const int32 VertexCount = MeshData.Positions.Num();
+	OutVertices.SetNumUninitialized(VertexCount);
+	OutLocalBounds.Init();
+
+	// Attribute arrays are either full-size or absent — decide once, not per vertex.
+	// (Short arrays fall back to defaults wholesale; no mesher produces partially-filled ones.)
+	const bool bHasNormals = MeshData.Normals.Num() >= VertexCount;
+	const bool bHasUVs = MeshData.UVs.Num() >= VertexCount;
+	const bool bHasColors = MeshData.Colors.Num() >= VertexCount;
+
+	FVector3f BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector3f BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	for (int32 i = 0; i < VertexCount; ++i)
+	{
+		FVoxelVertex& Vertex = OutVertices[i];
+
+		// Position + bounds (fused)
+		const FVector3f& Pos = MeshData.Positions[i];
+		Vertex.Position = Pos;
+		BoundsMin = FVector3f::Min(BoundsMin, Pos);
+		BoundsMax = FVector3f::Max(BoundsMax, Pos);
+
+		Vertex.SetNormal(bHasNormals ? MeshData.Normals[i] : FVector3f::UpVector);
+		Vertex.UV = bHasUVs ? MeshData.UVs[i] : FVector2f::ZeroVector;
+
+		// Extract material data from vertex color
+		if (bHasColors)
+		{
+			const FColor& Color = MeshData.Colors[i];
+			Vertex.SetMaterialID(Color.R);
+			Vertex.SetBiomeID(Color.G);
+			Vertex.SetAO(Color.B >> 6); // Top 2 bits of blue channel
+		}
+		else
+		{
+			Vertex.SetMaterialID(0);
+			Vertex.SetBiomeID(0);
+			Vertex.SetAO(0);
+		}
+	}
+
+	if (VertexCount > 0)
+	{
+		OutLocalBounds += FVector(BoundsMin);
+		OutLocalBounds += FVector(BoundsMax);
+	}
+}
+
+void FVoxelCompactVertexCodec::Pack(
+	const FChunkMeshData& MeshData,
+	float ChunkWorldSize,
+	bool bTryCompact,
+	FVoxelPackedChunkVertices& OutPacked)
+{
+	OutPacked.Reset();
+	if (bTryCompact && Encode(MeshData, ChunkWorldSize, OutPacked.CompactVertices, OutPacked.CompactFrame, OutPacked.LocalBounds))
+	{
+		return;
+	}
+	OutPacked.CompactVertices.Empty();
+	ConvertToVertices(MeshData, OutPacked.Vertices, OutPacked.LocalBounds);
+}
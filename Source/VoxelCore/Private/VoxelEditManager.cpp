@@ -1,6 +1,8 @@
 // Copyright Daniel Raquel. All Rights Reserved.
 
 #include "VoxelEditManager.h"
+#include "VoxelBrushRasterizer.h"
+#include "VoxelWorldSave.h"
 #include "IVoxelEditValidator.h"
 #include "VoxelWorldConfiguration.h"
 #include "VoxelCoordinates.h"
@@ -41,10 +43,13 @@ void UVoxelEditManager::Initialize(UVoxelWorldConfiguration* Config)
 
 	// Clear any existing state
 	EditLayers.Empty();
+	PersistDirtyChunks.Empty();
+	PersistPendingChunks.Empty();
 	UndoStack.Empty();
 	RedoStack.Empty();
 	CurrentOperation.Reset();
 	NextOperationId = 1;
+	MergeStats = FVoxelEditMergeStats();
 
 	bIsInitialized = true;
 
@@ -67,6 +72,8 @@ void UVoxelEditManager::Shutdown()
 
 	// Clear all data
 	EditLayers.Empty();
+	PersistDirtyChunks.Empty();
+	PersistPendingChunks.Empty();
 	UndoStack.Empty();
 	RedoStack.Empty();
 
@@ -133,7 +140,7 @@ void UVoxelEditManager::EndEditOperation()
 	// Batched edit notification: one broadcast per affected chunk (operation-level source/center/radius).
 	for (const FIntVector& ChunkCoord : AffectedChunks)
 	{
-		OnChunkEdited.Broadcast(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
+		NotifyChunkEdited(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
 	}
 
 	// Notify listeners
@@ -164,14 +171,14 @@ void UVoxelEditManager::CancelEditOperation()
 				if (Edit.OriginalData == FVoxelData::Air())
 				{
 					// Was a new edit - just remove it
-					Layer->Edits.Remove(Index);
+					Layer->RemoveEditAt(Index);
 				}
 				else
 				{
 					// Restore original edit
 					FVoxelEdit RevertEdit = Edit;
 					RevertEdit.NewData = Edit.OriginalData;
-					Layer->Edits.Add(Index, RevertEdit);
+					Layer->SetEdit(Index, FVoxelEditDelta(RevertEdit));
 				}
 			}
 		}
@@ -180,7 +187,7 @@ void UVoxelEditManager::CancelEditOperation()
 	// Notify affected chunks (use current source - cancelling reverts player's work)
 	for (const FIntVector& ChunkCoord : CurrentOperation->AffectedChunks)
 	{
-		OnChunkEdited.Broadcast(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
+		NotifyChunkEdited(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
 	}
 
 	UE_LOG(LogVoxelEdit, Log, TEXT("Edit operation '%s' cancelled (%d edits reverted)"),
@@ -261,9 +268,6 @@ int32 UVoxelEditManager::ApplyBrushEdit(const FVector& WorldPos, const FVoxelBru
 	const float VoxelSize = Configuration->VoxelSize;
 	const int32 ChunkSize = Configuration->ChunkSize;
 
-	// Calculate voxel bounds of the brush
-	const int32 VoxelRadius = FMath::CeilToInt(Brush.Radius / VoxelSize);
-
 	// Auto-start operation if none in progress
 	const bool bAutoOperation = !CurrentOperation.IsValid();
 	if (bAutoOperation)
@@ -282,105 +286,89 @@ int32 UVoxelEditManager::ApplyBrushEdit(const FVector& WorldPos, const FVoxelBru
 
 	int32 ModifiedCount = 0;
 
-	// Iterate over all voxels in the bounding box
-	for (int32 DZ = -VoxelRadius; DZ <= VoxelRadius; ++DZ)
+	// Brush voxels sit at whole-voxel offsets from WorldPos, so the voxel at offset D is global
+	// voxel CenterVoxel + D and its distance depends only on D. Split the brush box per chunk once,
+	// rasterize strength a row at a time, and hand each chunk its edits in one batch.
+	const FVoxelBrushRasterizer Rasterizer(Brush, VoxelSize);
+	const FVector RelativeCenter = WorldPos - Configuration->WorldOrigin;
+	const FIntVector CenterVoxel(
+		FMath::FloorToInt(RelativeCenter.X / VoxelSize),
+		FMath::FloorToInt(RelativeCenter.Y / VoxelSize),
+		FMath::FloorToInt(RelativeCenter.Z / VoxelSize));
+
+	TArray<FVoxelBrushChunkSpan> Spans;
+	Rasterizer.SplitByChunk(CenterVoxel, ChunkSize, Spans);
+
+	// Template edit: constructing FVoxelEdit stamps the time, so do it once per stroke
+	FVoxelEdit EditTemplate(FIntVector::ZeroValue, Mode, 0, Brush.MaterialID);
+	if (Mode == EEditMode::Set)
 	{
-		for (int32 DY = -VoxelRadius; DY <= VoxelRadius; ++DY)
-		{
-			for (int32 DX = -VoxelRadius; DX <= VoxelRadius; ++DX)
-			{
-				// Calculate world position of this voxel
-				const FVector VoxelWorldPos = WorldPos + FVector(DX, DY, DZ) * VoxelSize;
-
-				// Calculate distance from brush center
-				float Distance = 0.0f;
-				switch (Brush.Shape)
-				{
-				case EVoxelBrushShape::Sphere:
-					Distance = FVector::Dist(VoxelWorldPos, WorldPos);
-					break;
-
-				case EVoxelBrushShape::Cube:
-					{
-						const FVector Delta = (VoxelWorldPos - WorldPos).GetAbs();
-						Distance = FMath::Max3(Delta.X, Delta.Y, Delta.Z);
-					}
-					break;
-
-				case EVoxelBrushShape::Cylinder:
-					{
-						const FVector Delta = VoxelWorldPos - WorldPos;
-						Distance = FMath::Sqrt(Delta.X * Delta.X + Delta.Y * Delta.Y);
-						// Z is handled separately - if outside Z range, skip
-						if (FMath::Abs(Delta.Z) > Brush.Radius)
-						{
-							continue;
-						}
-					}
-					break;
-				}
+		// Set mode is absolute: pre-compute NewData
+		EditTemplate.NewData.MaterialID = Brush.MaterialID;
+		EditTemplate.NewData.Density = 255;
+	}
 
-				// Check if within brush radius
-				if (Distance > Brush.Radius)
-				{
-					continue;
-				}
+	TArray<FVoxelEdit> ChunkEdits;
+	TArray<float, TInlineAllocator<128>> RowStrength;
 
-				// Calculate falloff
-				const float NormalizedDistance = Distance / Brush.Radius;
-				const float Falloff = Brush.GetFalloff(NormalizedDistance);
-				const float EffectiveStrength = Brush.Strength * Falloff;
+	for (const FVoxelBrushChunkSpan& Span : Spans)
+	{
+		ChunkEdits.Reset();
 
-				if (EffectiveStrength < 0.01f)
+		for (int32 LZ = Span.LocalMin.Z; LZ <= Span.LocalMax.Z; ++LZ)
+		{
+			for (int32 LY = Span.LocalMin.Y; LY <= Span.LocalMax.Y; ++LY)
+			{
+				const FIntVector RowOffset = Span.GetOffset(FIntVector(Span.LocalMin.X, LY, LZ));
+				int32 DXMin = RowOffset.X;
+				int32 DXMax = RowOffset.X + (Span.LocalMax.X - Span.LocalMin.X);
+				if (!Rasterizer.ClipRow(RowOffset.Y, RowOffset.Z, DXMin, DXMax))
 				{
 					continue;
 				}
 
-				// Convert to chunk/local coordinates
-				const FIntVector ChunkCoord = WorldToChunkCoord(VoxelWorldPos);
-				const FIntVector LocalPos = WorldToLocalPos(VoxelWorldPos, ChunkCoord);
+				const int32 Count = DXMax - DXMin + 1;
+				RowStrength.SetNumUninitialized(Align(Count, 4), EAllowShrinking::No);
+				Rasterizer.RasterizeRow(RowOffset.Y, RowOffset.Z, DXMin, Count, RowStrength.GetData());
 
-				// Validate
-				if (LocalPos.X < 0 || LocalPos.X >= ChunkSize ||
-					LocalPos.Y < 0 || LocalPos.Y >= ChunkSize ||
-					LocalPos.Z < 0 || LocalPos.Z >= ChunkSize)
+				for (int32 i = 0; i < Count; ++i)
 				{
-					continue;
-				}
+					const float EffectiveStrength = RowStrength[i];
+					if (EffectiveStrength < 0.01f)
+					{
+						continue;
+					}
 
-				// Edit-protection veto (per voxel): a brush overlapping a protected region edits
-				// only the unprotected part. Skipped voxels are counted, not errored — the UI can
-				// message "protected" from GetLastRejectedEditCount.
-				if (EditValidator && !EditValidator->CanApplyEdit(VoxelWorldPos, CurrentEditSource))
-				{
-					++LastRejectedEditCount;
-					continue;
-				}
+					const FIntVector Offset(DXMin + i, RowOffset.Y, RowOffset.Z);
 
-				// Calculate density delta for this voxel (affected by falloff)
-				const int32 DensityChange = FMath::RoundToInt(Brush.DensityDelta * EffectiveStrength);
+					// Edit-protection veto (per voxel): a brush overlapping a protected region edits
+					// only the unprotected part. Skipped voxels are counted, not errored — the UI can
+					// message "protected" from GetLastRejectedEditCount.
+					if (EditValidator && !EditValidator->CanApplyEdit(WorldPos + FVector(Offset) * VoxelSize, CurrentEditSource))
+					{
+						++LastRejectedEditCount;
+						continue;
+					}
 
-				// Skip if no meaningful change
-				if (DensityChange < 1 && Mode != EEditMode::Paint && Mode != EEditMode::Set)
-				{
-					continue;
-				}
+					// Calculate density delta for this voxel (affected by falloff)
+					const int32 DensityChange = FMath::RoundToInt(Brush.DensityDelta * EffectiveStrength);
 
-				// Create edit with delta values (will be applied to procedural data at merge time)
-				FVoxelEdit Edit(LocalPos, Mode, DensityChange, Brush.MaterialID);
+					// Skip if no meaningful change
+					if (DensityChange < 1 && Mode != EEditMode::Paint && Mode != EEditMode::Set)
+					{
+						continue;
+					}
 
-				// For Set mode, pre-compute the NewData since it's absolute
-				if (Mode == EEditMode::Set)
-				{
-					Edit.NewData.MaterialID = Brush.MaterialID;
-					Edit.NewData.Density = 255;
+					// Delta edit (applied to procedural data at merge time)
+					FVoxelEdit& Edit = ChunkEdits.Add_GetRef(EditTemplate);
+					Edit.LocalPosition = Span.LocalMin + (Offset - Span.OffsetMin);
+					Edit.DensityDelta = DensityChange;
 				}
-
-				// Apply the edit
-				ApplyEditInternal(ChunkCoord, LocalPos, Edit);
-				++ModifiedCount;
 			}
 		}
+
+		ApplyEditBatchInternal(Span.ChunkCoord, ChunkEdits);
+		ModifiedCount += ChunkEdits.Num();
 	}
 
 	// Auto-end operation
@@ -426,19 +414,16 @@ bool UVoxelEditManager::Undo()
 			if (FChunkEditLayer* Layer = EditLayers.Find(ChunkCoord))
 			{
 				const int32 Index = Edit.GetVoxelIndex(Layer->ChunkSize);
-				if (Layer->Edits.Contains(Index))
+				if (FVoxelEditDelta* ExistingEdit = Layer->FindEdit(Index))
 				{
-					// Swap to original data
-					FVoxelEdit* ExistingEdit = Layer->Edits.Find(Index);
-					if (ExistingEdit)
+					// If reverting to air, remove the edit entirely; otherwise swap to original data
+					if (Edit.OriginalData == FVoxelData::Air())
+					{
+						Layer->RemoveEditAt(Index);
+					}
+					else
 					{
 						ExistingEdit->NewData = Edit.OriginalData;
-
-						// If reverting to air, remove the edit entirely
-						if (Edit.OriginalData == FVoxelData::Air())
-						{
-							Layer->Edits.Remove(Index);
-						}
 					}
 					AffectedChunks.Add(ChunkCoord);
 					break;
@@ -454,7 +439,7 @@ bool UVoxelEditManager::Undo()
 	// Use zero radius since we want full regeneration, not targeted removal
 	for (const FIntVector& ChunkCoord : AffectedChunks)
 	{
-		OnChunkEdited.Broadcast(ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
+		NotifyChunkEdited(ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
 	}
 
 	OnUndoRedoStateChanged.Broadcast();
@@ -490,8 +475,7 @@ bool UVoxelEditManager::Redo()
 				const int32 Index = Edit.GetVoxelIndex(Layer->ChunkSize);
 
 				// Re-apply the edit
-				FVoxelEdit RedoEdit = Edit;
-				Layer->Edits.Add(Index, RedoEdit);
+				Layer->SetEdit(Index, FVoxelEditDelta(Edit));
 				AffectedChunks.Add(ChunkCoord);
 				break;
 			}
@@ -505,7 +489,7 @@ bool UVoxelEditManager::Redo()
 	// Use zero radius since this is a full operation redo
 	for (const FIntVector& ChunkCoord : AffectedChunks)
 	{
-		OnChunkEdited.Broadcast(ChunkCoord, CurrentEditSource, FVector::ZeroVector, 0.0f);
+		NotifyChunkEdited(ChunkCoord, CurrentEditSource, FVector::ZeroVector, 0.0f);
 	}
 
 	OnUndoRedoStateChanged.Broadcast();
@@ -572,16 +556,16 @@ void UVoxelEditManager::ApplyEditsToVoxelData(const FIntVector& ChunkCoord, TArr
 		return;
 	}
 
-	// Mirror the merge meshing performs (see VoxelChunkManager mesh request build):
-	// apply each sparse edit on top of the procedural voxel at its linear index.
-	for (const auto& EditPair : EditLayer->Edits)
-	{
-		const int32 Index = EditPair.Key;
-		if (VoxelData.IsValidIndex(Index))
-		{
-			VoxelData[Index] = EditPair.Value.ApplyToProceduralData(VoxelData[Index]);
-		}
-	}
+	// Same per-voxel merge rule meshing uses (FVoxelEditDelta::ApplyToProceduralData); dense
+	// layers walk their occupied brick rows instead of visiting edits one by one.
+	const double StartTime = FPlatformTime::Seconds();
+	EditLayer->ApplyToVoxelData(VoxelData);
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	MergeStats.NumMerges++;
+	MergeStats.NumEditsMerged += EditLayer->GetEditCount();
+	MergeStats.TotalMs += ElapsedMs;
+	MergeStats.LastMs = static_cast<float>(ElapsedMs);
 }
 
 int32 UVoxelEditManager::GetTotalEditCount() const
@@ -602,7 +586,7 @@ bool UVoxelEditManager::ClearChunkEdits(const FIntVector& ChunkCoord)
 		{
 			Layer->Clear();
 			// Clearing edits is a system action - scatter should regenerate
-			OnChunkEdited.Broadcast(ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
+			NotifyChunkEdited(ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
 			return true;
 		}
 	}
@@ -626,12 +610,157 @@ void UVoxelEditManager::ClearAllEdits()
 	// Notify all affected chunks (clearing is system action - regenerate scatter)
 	for (const FIntVector& ChunkCoord : AffectedChunks)
 	{
-		OnChunkEdited.Broadcast(ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
+		NotifyChunkEdited(ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
 	}
 
 	UE_LOG(LogVoxelEdit, Log, TEXT("All edits cleared (%d chunks affected)"), AffectedChunks.Num());
 }
 
+// ==================== Chunk Persistence ====================
+
+void UVoxelEditManager::TakePersistDirtyChunks(TArray<FIntVector>& OutChunkCoords)
+{
+	OutChunkCoords = PersistDirtyChunks.Array();
+	PersistDirtyChunks.Reset();
+}
+
+void UVoxelEditManager::BuildChunkRecord(const FIntVector& ChunkCoord, FVoxelChunkRecord& OutRecord) const
+{
+	OutRecord = FVoxelChunkRecord();
+	OutRecord.ChunkCoord = ChunkCoord;
+	OutRecord.ChunkSize = Configuration ? Configuration->ChunkSize : VOXEL_DEFAULT_CHUNK_SIZE;
+
+	if (const FChunkEditLayer* Layer = EditLayers.Find(ChunkCoord))
+	{
+		OutRecord.SetEdits(*Layer);
+	}
+}
+
+bool UVoxelEditManager::ApplyChunkRecord(const FVoxelChunkRecord& Record, bool bNotify)
+{
+	// Unsaved or unconfirmed in-memory changes (including a cleared chunk) are newer than anything on disk
+	if (PersistDirtyChunks.Contains(Record.ChunkCoord) || PersistPendingChunks.Contains(Record.ChunkCoord))
+	{
+		return false;
+	}
+
+	FChunkEditLayer* Layer = GetOrCreateEditLayer(Record.ChunkCoord);
+	if (!Layer)
+	{
+		return false;
+	}
+
+	Layer->Clear();
+	Record.ApplyEditsTo(*Layer);
+
+	// Loaded state matches disk: notify without marking the chunk dirty
+	if (bNotify)
+	{
+		OnChunkEdited.Broadcast(Record.ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
+	}
+	return true;
+}
+
+int32 UVoxelEditManager::SaveDirtyChunks(FVoxelWorldSave& Save)
+{
+	TArray<FIntVector> Dirty;
+	TakePersistDirtyChunks(Dirty);
+
+	int32 Saved = 0;
+	FVoxelChunkRecord Record;
+	for (const FIntVector& ChunkCoord : Dirty)
+	{
+		BuildChunkRecord(ChunkCoord, Record);
+		if (Save.SaveChunk(Record))
+		{
+			++Saved;
+		}
+		else
+		{
+			// Keep it dirty so the next save retries
+			PersistDirtyChunks.Add(ChunkCoord);
+			UE_LOG(LogVoxelEdit, Warning, TEXT("SaveDirtyChunks: failed to save chunk (%d,%d,%d)"),
+				ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z);
+		}
+	}
+	return Saved;
+}
+
+bool UVoxelEditManager::LoadChunkEdits(FVoxelWorldSave& Save, const FIntVector& ChunkCoord)
+{
+	FVoxelChunkRecord Record;
+	if (!Save.LoadChunk(ChunkCoord, Record) || !Record.HasEdits())
+	{
+		return false;
+	}
+	return ApplyChunkRecord(Record);
+}
+
+bool UVoxelEditManager::EvictChunkEdits(FVoxelWorldSave& Save, const FIntVector& ChunkCoord)
+{
+	if (IsChunkInHistory(ChunkCoord))
+	{
+		return false;
+	}
+
+	if (PersistDirtyChunks.Contains(ChunkCoord))
+	{
+		FVoxelChunkRecord Record;
+		BuildChunkRecord(ChunkCoord, Record);
+		if (!Save.SaveChunk(Record))
+		{
+			return false;
+		}
+		PersistDirtyChunks.Remove(ChunkCoord);
+	}
+
+	return ReleaseChunkEdits(ChunkCoord);
+}
+
+void UVoxelEditManager::MarkChunkPersistPending(const FIntVector& ChunkCoord)
+{
+	PersistDirtyChunks.Remove(ChunkCoord);
+	PersistPendingChunks.Add(ChunkCoord);
+}
+
+void UVoxelEditManager::ConfirmChunkPersisted(const FIntVector& ChunkCoord, bool bSucceeded)
+{
+	if (PersistPendingChunks.Remove(ChunkCoord) > 0 && !bSucceeded)
+	{
+		// Disk still holds the previous record: write it again on the next hand-off
+		PersistDirtyChunks.Add(ChunkCoord);
+	}
+}
+
+bool UVoxelEditManager::ReleaseChunkEdits(const FIntVector& ChunkCoord)
+{
+	if (IsChunkInHistory(ChunkCoord) || PersistPendingChunks.Contains(ChunkCoord))
+	{
+		return false;
+	}
+
+	PersistDirtyChunks.Remove(ChunkCoord);
+	return EditLayers.Remove(ChunkCoord) > 0;
+}
+
+bool UVoxelEditManager::IsChunkInHistory(const FIntVector& ChunkCoord) const
+{
+	auto References = [&ChunkCoord](const FVoxelEditOperation& Op)
+	{
+		return Op.AffectedChunks.Contains(ChunkCoord);
+	};
+
+	return (CurrentOperation.IsValid() && References(*CurrentOperation))
+		|| UndoStack.ContainsByPredicate(References)
+		|| RedoStack.ContainsByPredicate(References);
+}
+
+void UVoxelEditManager::NotifyChunkEdited(const FIntVector& ChunkCoord, EEditSource Source, const FVector& EditCenter, float EditRadius)
+{
+	PersistDirtyChunks.Add(ChunkCoord);
+	OnChunkEdited.Broadcast(ChunkCoord, Source, EditCenter, EditRadius);
+}
+
 // ==================== Serialization ====================
 
 bool UVoxelEditManager::SaveEditsToFile(const FString& FilePath)
@@ -666,30 +795,31 @@ bool UVoxelEditManager::SaveEditsToFile(const FString& FilePath)
 		int32 EditCount = Layer.GetEditCount();
 		Writer << EditCount;
 
-		// Write each edit
-		for (const auto& EditPair : Layer.Edits)
+		// Write each edit (the layer keeps no OriginalData, so that legacy field is written as air)
+		Layer.ForEachEdit([&Writer, &Layer](int32 Index, const FVoxelEditDelta& Delta)
 		{
-			const FVoxelEdit& Edit = EditPair.Value;
+			FVoxelEdit Edit = Delta.ToEdit(Layer.GetLocalPosition(Index));
+			Edit.OriginalData = FVoxelData::Air();
 
 			// Core position
-			Writer << const_cast<FIntVector&>(Edit.LocalPosition);
+			Writer << Edit.LocalPosition;
 
 			// Edit mode and relative edit data (Version 2+)
 			uint8 EditModeValue = static_cast<uint8>(Edit.EditMode);
 			Writer << EditModeValue;
-			Writer << const_cast<int32&>(Edit.DensityDelta);
-			Writer << const_cast<uint8&>(Edit.BrushMaterialID);
+			Writer << Edit.DensityDelta;
+			Writer << Edit.BrushMaterialID;
 
 			// Legacy NewData/OriginalData (kept for potential backwards compatibility)
-			Writer << const_cast<uint8&>(Edit.NewData.MaterialID);
-			Writer << const_cast<uint8&>(Edit.NewData.Density);
-			Writer << const_cast<uint8&>(Edit.NewData.BiomeID);
-			Writer << const_cast<uint8&>(Edit.NewData.Metadata);
-			Writer << const_cast<uint8&>(Edit.OriginalData.MaterialID);
-			Writer << const_cast<uint8&>(Edit.OriginalData.Density);
-			Writer << const_cast<uint8&>(Edit.OriginalData.BiomeID);
-			Writer << const_cast<uint8&>(Edit.OriginalData.Metadata);
-		}
+			Writer << Edit.NewData.MaterialID;
+			Writer << Edit.NewData.Density;
+			Writer << Edit.NewData.BiomeID;
+			Writer << Edit.NewData.Metadata;
+			Writer << Edit.OriginalData.MaterialID;
+			Writer << Edit.OriginalData.Density;
+			Writer << Edit.OriginalData.BiomeID;
+			Writer << Edit.OriginalData.Metadata;
+		});
 	}
 
 	// Save to file
@@ -813,7 +943,7 @@ bool UVoxelEditManager::LoadEditsFromFile(const FString& FilePath)
 	// Notify all loaded chunks (loading from file is system action - regenerate scatter)
 	for (const FIntVector& ChunkCoord : LoadedChunks)
 	{
-		OnChunkEdited.Broadcast(ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
+		NotifyChunkEdited(ChunkCoord, EEditSource::System, FVector::ZeroVector, 0.0f);
 	}
 
 	UE_LOG(LogVoxelEdit, Log, TEXT("Loaded %d edits across %d chunks from '%s'"),
@@ -834,7 +964,11 @@ FString UVoxelEditManager::GetDebugStats() const
 	Stats += FString::Printf(TEXT("Redo Stack: %d\n"), RedoStack.Num());
 	Stats += FString::Printf(TEXT("Operation In Progress: %s\n"),
 		CurrentOperation.IsValid() ? TEXT("Yes") : TEXT("No"));
-	Stats += FString::Printf(TEXT("Memory Usage: %.2f KB\n"), GetMemoryUsage() / 1024.0f);
+	Stats += FString::Printf(TEXT("Dense Chunks: %d\n"), GetDenseLayerCount());
+	Stats += FString::Printf(TEXT("Memory Usage: %.2f KB (history %.2f KB)\n"),
+		GetMemoryUsage() / 1024.0f, GetHistoryMemoryUsage() / 1024.0f);
+	Stats += FString::Printf(TEXT("Merges: %d (%lld edits, last %.3f ms, total %.2f ms)\n"),
+		MergeStats.NumMerges, MergeStats.NumEditsMerged, MergeStats.LastMs, MergeStats.TotalMs);
 
 	return Stats;
 }
@@ -850,8 +984,15 @@ SIZE_T UVoxelEditManager::GetMemoryUsage() const
 		Total += Pair.Value.GetMemoryUsage();
 	}
 
-	// Undo/redo stacks
-	Total += UndoStack.GetAllocatedSize();
+	// Undo/redo history (kept out of line from the layers)
+	Total += GetHistoryMemoryUsage();
+
+	return Total;
+}
+
+SIZE_T UVoxelEditManager::GetHistoryMemoryUsage() const
+{
+	SIZE_T Total = UndoStack.GetAllocatedSize();
 	for (const FVoxelEditOperation& Op : UndoStack)
 	{
 		Total += Op.GetMemoryUsage();
@@ -872,6 +1013,16 @@ SIZE_T UVoxelEditManager::GetMemoryUsage() const
 	return Total;
 }
 
+int32 UVoxelEditManager::GetDenseLayerCount() const
+{
+	int32 Count = 0;
+	for (const auto& Pair : EditLayers)
+	{
+		Count += Pair.Value.IsDense() ? 1 : 0;
+	}
+	return Count;
+}
+
 // ==================== Internal Methods ====================
 
 FIntVector UVoxelEditManager::WorldToChunkCoord(const FVector& WorldPos) const
@@ -965,28 +1116,18 @@ void UVoxelEditManager::ApplyEditInternal(
 	// per edited voxel — a large brush (hundreds of thousands of voxels) froze the game thread.
 	if (!CurrentOperation.IsValid())
 	{
-		OnChunkEdited.Broadcast(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
+		NotifyChunkEdited(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
 	}
 }
 
-void UVoxelEditManager::ApplyEditInternal(
-	const FIntVector& ChunkCoord,
-	const FIntVector& LocalPos,
-	const FVoxelEdit& Edit)
+FVoxelEdit UVoxelEditManager::AccumulateEdit(FChunkEditLayer& Layer, const FIntVector& LocalPos, const FVoxelEdit& Edit)
 {
-	// Create or get edit layer
-	FChunkEditLayer* Layer = GetOrCreateEditLayer(ChunkCoord);
-	if (!Layer)
-	{
-		return;
-	}
-
 	// Make a copy with correct local position
 	FVoxelEdit EditCopy = Edit;
 	EditCopy.LocalPosition = LocalPos;
 
 	// Check for existing edit at this location and accumulate if compatible
-	if (const FVoxelEdit* ExistingEdit = Layer->GetEdit(LocalPos))
+	if (const FVoxelEditDelta* ExistingEdit = Layer.GetEdit(LocalPos))
 	{
 		// For Add/Subtract modes, accumulate the density delta
 		if ((EditCopy.EditMode == EEditMode::Add || EditCopy.EditMode == EEditMode::Subtract) &&
@@ -1025,24 +1166,14 @@ void UVoxelEditManager::ApplyEditInternal(
 				else
 				{
 					// No material change, remove the edit entirely
-					// This reverts the voxel to pure procedural state
-					Layer->RemoveEdit(LocalPos);
-
-					// Track removal in current operation if active
-					if (CurrentOperation.IsValid())
-					{
-						// Store a "removal" edit for undo purposes
-						FVoxelEdit RemovalEdit = *ExistingEdit;
-						RemovalEdit.DensityDelta = 0;
-						CurrentOperation->AddEdit(RemovalEdit, ChunkCoord);
-					}
-
-					// Notify listeners that chunk changed (standalone edit only; batch defers to EndEditOperation)
-					if (!CurrentOperation.IsValid())
-					{
-						OnChunkEdited.Broadcast(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
-					}
-					return;
+					// This reverts the voxel to pure procedural state.
+					// Copy the record first: RemoveEdit invalidates ExistingEdit.
+					FVoxelEdit RemovalEdit = ExistingEdit->ToEdit(LocalPos);
+					Layer.RemoveEdit(LocalPos);
+
+					// Recorded as a "removal" edit for undo purposes
+					RemovalEdit.DensityDelta = 0;
+					return RemovalEdit;
 				}
 			}
 			else
@@ -1074,12 +1205,28 @@ void UVoxelEditManager::ApplyEditInternal(
 	}
 
 	// Apply to layer
-	Layer->ApplyEdit(EditCopy);
+	Layer.ApplyEdit(EditCopy);
+	return EditCopy;
+}
+
+void UVoxelEditManager::ApplyEditInternal(
+	const FIntVector& ChunkCoord,
+	const FIntVector& LocalPos,
+	const FVoxelEdit& Edit)
+{
+	// Create or get edit layer
+	FChunkEditLayer* Layer = GetOrCreateEditLayer(ChunkCoord);
+	if (!Layer)
+	{
+		return;
+	}
+
+	const FVoxelEdit Recorded = AccumulateEdit(*Layer, LocalPos, Edit);
 
 	// Track in current operation if active
 	if (CurrentOperation.IsValid())
 	{
-		CurrentOperation->AddEdit(EditCopy, ChunkCoord);
+		CurrentOperation->AddEdit(Recorded, ChunkCoord);
 	}
 
 	// Notify listeners — but only for standalone edits. During a Begin/End batch operation (brush),
@@ -1088,7 +1235,40 @@ void UVoxelEditManager::ApplyEditInternal(
 	// per edited voxel — a large brush (hundreds of thousands of voxels) froze the game thread.
 	if (!CurrentOperation.IsValid())
 	{
-		OnChunkEdited.Broadcast(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
+		NotifyChunkEdited(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
+	}
+}
+
+void UVoxelEditManager::ApplyEditBatchInternal(const FIntVector& ChunkCoord, TConstArrayView<FVoxelEdit> Edits)
+{
+	if (Edits.Num() == 0)
+	{
+		return;
+	}
+
+	// One layer lookup and one affected-chunk entry for the whole batch
+	FChunkEditLayer* Layer = GetOrCreateEditLayer(ChunkCoord);
+	if (!Layer)
+	{
+		return;
+	}
+
+	if (CurrentOperation.IsValid())
+	{
+		CurrentOperation->Edits.Reserve(CurrentOperation->Edits.Num() + Edits.Num());
+		for (const FVoxelEdit& Edit : Edits)
+		{
+			CurrentOperation->Edits.Add(AccumulateEdit(*Layer, Edit.LocalPosition, Edit));
+		}
+		CurrentOperation->AffectedChunks.AddUnique(ChunkCoord);
+	}
+	else
+	{
+		for (const FVoxelEdit& Edit : Edits)
+		{
+			AccumulateEdit(*Layer, Edit.LocalPosition, Edit);
+		}
+		NotifyChunkEdited(ChunkCoord, CurrentEditSource, CurrentEditCenter, CurrentEditRadius);
 	}
 }
 
@@ -1097,7 +1277,7 @@ FVoxelData UVoxelEditManager::GetOriginalVoxelData(const FIntVector& ChunkCoord,
 	// First check if there's an existing edit
 	if (const FChunkEditLayer* Layer = GetEditLayer(ChunkCoord))
 	{
-		if (const FVoxelEdit* Edit = Layer->GetEdit(LocalPos))
+		if (const FVoxelEditDelta* Edit = Layer->GetEdit(LocalPos))
 		{
 			// Return the current edited data (which becomes "original" for the new edit)
 			return Edit->NewData;
@@ -0,0 +1,312 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelEditTypes.h"
+
+namespace
+{
+	/** Merge one brick row (8 contiguous voxels) given its occupancy byte */
+	FORCEINLINE void MergeBrickRow(FVoxelData* RESTRICT Dst, const FVoxelEditDelta* RESTRICT Src, uint32 RowMask)
+	{
+		if (RowMask == 0xFF)
+		{
+			// Full row: fixed trip count, no per-voxel mask test
+			for (int32 X = 0; X < FVoxelEditBrick::Size; ++X)
+			{
+				Dst[X] = Src[X].ApplyToProceduralData(Dst[X]);
+			}
+			return;
+		}
+
+		while (RowMask != 0)
+		{
+			const int32 X = static_cast<int32>(FMath::CountTrailingZeros(RowMask));
+			Dst[X] = Src[X].ApplyToProceduralData(Dst[X]);
+			RowMask &= RowMask - 1;
+		}
+	}
+}
+
+void FChunkEditLayer::GetBrickCell(int32 Index, int32& OutBrickIndex, int32& OutCell) const
+{
+	const FIntVector Pos = GetLocalPosition(Index);
+	const int32 BricksPerAxis = GetBricksPerAxis();
+
+	OutBrickIndex = (Pos.X >> 3) + ((Pos.Y >> 3) + (Pos.Z >> 3) * BricksPerAxis) * BricksPerAxis;
+	OutCell = (Pos.X & 7) | ((Pos.Y & 7) << 3) | ((Pos.Z & 7) << 6);
+}
+
+void FChunkEditLayer::SetEdit(int32 Index, const FVoxelEditDelta& Delta)
+{
+	if (!IsDense())
+	{
+		const int32 NumBefore = SparseEdits.Num();
+		SparseEdits.Add(Index, Delta);
+		if (SparseEdits.Num() == NumBefore || SparseEdits.Num() <= DenseThreshold)
+		{
+			return;
+		}
+
+		// Past the threshold: count edits per brick (one pass on crossing, incremental after)
+		if (SparseBrickEdits.Num() == 0)
+		{
+			const int32 BricksPerAxis = GetBricksPerAxis();
+			SparseBrickEdits.SetNumZeroed(BricksPerAxis * BricksPerAxis * BricksPerAxis);
+			NumSparseBricks = 0;
+			for (const TPair<int32, FVoxelEditDelta>& Pair : SparseEdits)
+			{
+				TrackSparseBrick(Pair.Key, 1);
+			}
+		}
+		else
+		{
+			TrackSparseBrick(Index, 1);
+		}
+
+		if (ShouldConvertToDense())
+		{
+			ConvertToDense();
+		}
+		return;
+	}
+
+	int32 BrickIndex, Cell;
+	GetBrickCell(Index, BrickIndex, Cell);
+	if (!BrickTable.IsValidIndex(BrickIndex))
+	{
+		return;
+	}
+
+	int32& Slot = BrickTable[BrickIndex];
+	if (Slot == INDEX_NONE)
+	{
+		Slot = Bricks.AddDefaulted();
+		Bricks[Slot].BrickIndex = BrickIndex;
+	}
+
+	FVoxelEditBrick& Brick = Bricks[Slot];
+	if (!Brick.IsSet(Cell))
+	{
+		Brick.Occupancy[Cell >> 6] |= uint64(1) << (Cell & 63);
+		++Brick.NumEdits;
+		++NumDenseEdits;
+	}
+	Brick.Cells[Cell] = Delta;
+}
+
+bool FChunkEditLayer::RemoveEditAt(int32 Index)
+{
+	if (!IsDense())
+	{
+		if (SparseEdits.Remove(Index) == 0)
+		{
+			return false;
+		}
+		if (SparseBrickEdits.Num() > 0)
+		{
+			TrackSparseBrick(Index, -1);
+		}
+		return true;
+	}
+
+	int32 BrickIndex, Cell;
+	GetBrickCell(Index, BrickIndex, Cell);
+	if (!BrickTable.IsValidIndex(BrickIndex) || BrickTable[BrickIndex] == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const int32 Slot = BrickTable[BrickIndex];
+	FVoxelEditBrick& Brick = Bricks[Slot];
+	if (!Brick.IsSet(Cell))
+	{
+		return false;
+	}
+
+	Brick.Occupancy[Cell >> 6] &= ~(uint64(1) << (Cell & 63));
+	Brick.Cells[Cell] = FVoxelEditDelta();
+	--Brick.NumEdits;
+	--NumDenseEdits;
+
+	if (Brick.NumEdits == 0)
+	{
+		if (NumDenseEdits == 0)
+		{
+			Clear();
+			return true;
+		}
+
+		// Release the brick: swap-remove and repoint the moved brick's table slot
+		BrickTable[BrickIndex] = INDEX_NONE;
+		const int32 LastSlot = Bricks.Num() - 1;
+		if (Slot != LastSlot)
+		{
+			BrickTable[Bricks[LastSlot].BrickIndex] = Slot;
+		}
+		Bricks.RemoveAtSwap(Slot, EAllowShrinking::No);
+	}
+
+	return true;
+}
+
+const FVoxelEditDelta* FChunkEditLayer::FindEdit(int32 Index) const
+{
+	if (!IsDense())
+	{
+		return SparseEdits.Find(Index);
+	}
+
+	int32 BrickIndex, Cell;
+	GetBrickCell(Index, BrickIndex, Cell);
+	if (!BrickTable.IsValidIndex(BrickIndex) || BrickTable[BrickIndex] == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	const FVoxelEditBrick& Brick = Bricks[BrickTable[BrickIndex]];
+	return Brick.IsSet(Cell) ? &Brick.Cells[Cell] : nullptr;
+}
+
+FVoxelEditDelta* FChunkEditLayer::FindEdit(int32 Index)
+{
+	return const_cast<FVoxelEditDelta*>(static_cast<const FChunkEditLayer*>(this)->FindEdit(Index));
+}
+
+void FChunkEditLayer::ApplyToVoxelData(TArrayView<FVoxelData> VoxelData) const
+{
+	const int32 VolumeSize = ChunkSize * ChunkSize * ChunkSize;
+
+	// Sparse layers (and short arrays, which the row walk cannot address) merge per edit
+	if (!IsDense() || VoxelData.Num() < VolumeSize)
+	{
+		ForEachEdit([&VoxelData](int32 Index, const FVoxelEditDelta& Delta)
+		{
+			if (VoxelData.IsValidIndex(Index))
+			{
+				VoxelData[Index] = Delta.ApplyToProceduralData(VoxelData[Index]);
+			}
+		});
+		return;
+	}
+
+	const int32 BricksPerAxis = GetBricksPerAxis();
+	const int32 SliceSize = ChunkSize * ChunkSize;
+	FVoxelData* RESTRICT Voxels = VoxelData.GetData();
+
+	for (const FVoxelEditBrick& Brick : Bricks)
+	{
+		const int32 BX = Brick.BrickIndex % BricksPerAxis;
+		const int32 BY = (Brick.BrickIndex / BricksPerAxis) % BricksPerAxis;
+		const int32 BZ = Brick.BrickIndex / (BricksPerAxis * BricksPerAxis);
+		const int32 BrickBase = BX * FVoxelEditBrick::Size
+			+ BY * FVoxelEditBrick::Size * ChunkSize
+			+ BZ * FVoxelEditBrick::Size * SliceSize;
+
+		for (int32 LZ = 0; LZ < FVoxelEditBrick::Size; ++LZ)
+		{
+			const uint64 SliceMask = Brick.Occupancy[LZ];
+			if (SliceMask == 0)
+			{
+				continue;
+			}
+
+			for (int32 LY = 0; LY < FVoxelEditBrick::Size; ++LY)
+			{
+				const uint32 RowMask = static_cast<uint32>(SliceMask >> (LY * 8)) & 0xFF;
+				if (RowMask != 0)
+				{
+					// Occupancy bits are only ever set for in-chunk voxels, so the row base is in range
+					MergeBrickRow(
+						Voxels + BrickBase + LY * ChunkSize + LZ * SliceSize,
+						Brick.Cells + LY * FVoxelEditBrick::Size + LZ * FVoxelEditBrick::Size * FVoxelEditBrick::Size,
+						RowMask);
+				}
+			}
+		}
+	}
+}
+
+void FChunkEditLayer::ForEachEdit(TFunctionRef<void(int32 Index, const FVoxelEditDelta& Delta)> Visitor) const
+{
+	if (!IsDense())
+	{
+		for (const TPair<int32, FVoxelEditDelta>& Pair : SparseEdits)
+		{
+			Visitor(Pair.Key, Pair.Value);
+		}
+		return;
+	}
+
+	const int32 BricksPerAxis = GetBricksPerAxis();
+	for (const FVoxelEditBrick& Brick : Bricks)
+	{
+		const int32 OriginX = (Brick.BrickIndex % BricksPerAxis) * FVoxelEditBrick::Size;
+		const int32 OriginY = ((Brick.BrickIndex / BricksPerAxis) % BricksPerAxis) * FVoxelEditBrick::Size;
+		const int32 OriginZ = (Brick.BrickIndex / (BricksPerAxis * BricksPerAxis)) * FVoxelEditBrick::Size;
+
+		for (int32 LZ = 0; LZ < FVoxelEditBrick::Size; ++LZ)
+		{
+			uint64 SliceMask = Brick.Occupancy[LZ];
+			while (SliceMask != 0)
+			{
+				const int32 Bit = static_cast<int32>(FMath::CountTrailingZeros64(SliceMask));
+				SliceMask &= SliceMask - 1;
+
+				const int32 X = OriginX + (Bit & 7);
+				const int32 Y = OriginY + (Bit >> 3);
+				const int32 Z = OriginZ + LZ;
+				Visitor(X + (Y + Z * ChunkSize) * ChunkSize, Brick.Cells[Bit + LZ * 64]);
+			}
+		}
+	}
+}
+
+void FChunkEditLayer::Clear()
+{
+	SparseEdits.Empty();
+	SparseBrickEdits.Empty();
+	NumSparseBricks = 0;
+	BrickTable.Empty();
+	Bricks.Empty();
+	NumDenseEdits = 0;
+}
+
+bool FChunkEditLayer::ShouldConvertToDense() const
+{
+	// Dense pays a whole brick per occupied 8^3 block plus the table; sparse pays per edit.
+	// A brush filling its bricks wins easily, while scattered single edits never convert.
+	const SIZE_T DenseBytes = static_cast<SIZE_T>(NumSparseBricks) * sizeof(FVoxelEditBrick)
+		+ static_cast<SIZE_T>(SparseBrickEdits.Num()) * sizeof(int32);
+	return static_cast<SIZE_T>(SparseEdits.Num()) * SparseBytesPerEdit >= DenseBytes;
+}
+
+void FChunkEditLayer::TrackSparseBrick(int32 Index, int32 Delta)
+{
+	int32 BrickIndex, Cell;
+	GetBrickCell(Index, BrickIndex, Cell);
+	if (!SparseBrickEdits.IsValidIndex(BrickIndex))
+	{
+		return;
+	}
+
+	uint16& Count = SparseBrickEdits[BrickIndex];
+	NumSparseBricks += (Count == 0 && Delta > 0) ? 1 : 0;
+	Count = static_cast<uint16>(static_cast<int32>(Count) + Delta);
+	NumSparseBricks -= (Count == 0 && Delta < 0) ? 1 : 0;
+}
+
+void FChunkEditLayer::ConvertToDense()
+{
+	const int32 BricksPerAxis = GetBricksPerAxis();
+	BrickTable.Init(INDEX_NONE, BricksPerAxis * BricksPerAxis * BricksPerAxis);
+	NumDenseEdits = 0;
+
+	TMap<int32, FVoxelEditDelta> Pending = MoveTemp(SparseEdits);
+	SparseEdits.Empty();
+	SparseBrickEdits.Empty();
+	NumSparseBricks = 0;
+
+	for (const TPair<int32, FVoxelEditDelta>& Pair : Pending)
+	{
+		SetEdit(Pair.Key, Pair.Value);
+	}
+}
@@ -0,0 +1,313 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelRangeAllocator.h"
+
+FVoxelRangeAllocator::FVoxelRangeAllocator()
+{
+	Reset(0);
+}
+
+FVoxelRangeAllocator::FVoxelRangeAllocator(uint32 InCapacity, uint32 InGranularity)
+{
+	Reset(InCapacity, InGranularity);
+}
+
+void FVoxelRangeAllocator::Reset(uint32 InCapacity, uint32 InGranularity)
+{
+	Blocks.Reset();
+	UnusedBlocks.Reset();
+	AllocatedBlocks.Reset();
+	for (int32& Head : FreeHeads)
+	{
+		Head = INDEX_NONE;
+	}
+	NonEmptyClasses = 0;
+	NumFreeBlocks = 0;
+
+	Granularity = FMath::Max(1u, InGranularity);
+	// Capacity is a whole number of granules so every block size stays a multiple
+	Capacity = InCapacity - InCapacity % Granularity;
+	FreeSize = Capacity;
+
+	if (Capacity > 0)
+	{
+		const int32 Root = NewBlock();
+		Blocks[Root].Offset = 0;
+		Blocks[Root].Size = Capacity;
+		LinkFree(Root);
+	}
+}
+
+int32 FVoxelRangeAllocator::NewBlock()
+{
+	if (UnusedBlocks.Num() > 0)
+	{
+		const int32 BlockIndex = UnusedBlocks.Pop(EAllowShrinking::No);
+		Blocks[BlockIndex] = FBlock();
+		return BlockIndex;
+	}
+	return Blocks.AddDefaulted();
+}
+
+void FVoxelRangeAllocator::ReleaseBlock(int32 BlockIndex)
+{
+	Blocks[BlockIndex].Size = 0;
+	UnusedBlocks.Add(BlockIndex);
+}
+
+void FVoxelRangeAllocator::LinkFree(int32 BlockIndex)
+{
+	FBlock& Block = Blocks[BlockIndex];
+	const int32 Class = GetClass(Block.Size);
+	Block.bFree = true;
+	Block.PrevFree = INDEX_NONE;
+	Block.NextFree = FreeHeads[Class];
+	if (FreeHeads[Class] != INDEX_NONE)
+	{
+		Blocks[FreeHeads[Class]].PrevFree = BlockIndex;
+	}
+	FreeHeads[Class] = BlockIndex;
+	NonEmptyClasses |= 1u << Class;
+	++NumFreeBlocks;
+}
+
+void FVoxelRangeAllocator::UnlinkFree(int32 BlockIndex)
+{
+	FBlock& Block = Blocks[BlockIndex];
+	const int32 Class = GetClass(Block.Size);
+	if (Block.PrevFree != INDEX_NONE)
+	{
+		Blocks[Block.PrevFree].NextFree = Block.NextFree;
+	}
+	else
+	{
+		FreeHeads[Class] = Block.NextFree;
+		if (FreeHeads[Class] == INDEX_NONE)
+		{
+			NonEmptyClasses &= ~(1u << Class);
+		}
+	}
+	if (Block.NextFree != INDEX_NONE)
+	{
+		Blocks[Block.NextFree].PrevFree = Block.PrevFree;
+	}
+	Block.bFree = false;
+	Block.PrevFree = INDEX_NONE;
+	Block.NextFree = INDEX_NONE;
+	--NumFreeBlocks;
+}
+
+uint32 FVoxelRangeAllocator::Allocate(uint32 Size)
+{
+	if (Size == 0 || Size > FreeSize)
+	{
+		return InvalidOffset;
+	}
+	Size = static_cast<uint32>(Align(static_cast<uint64>(Size), Granularity));
+	if (Size > FreeSize)
+	{
+		return InvalidOffset;
+	}
+
+	// First fit within the request's own class (blocks there may be smaller than Size)...
+	const int32 Class = GetClass(Size);
+	int32 Found = INDEX_NONE;
+	for (int32 It = FreeHeads[Class]; It != INDEX_NONE; It = Blocks[It].NextFree)
+	{
+		if (Blocks[It].Size >= Size)
+		{
+			Found = It;
+			break;
+		}
+	}
+
+	// ...otherwise any block of a higher class is large enough: take the smallest class's head
+	if (Found == INDEX_NONE)
+	{
+		const uint32 Higher = Class + 1 < NumClasses ? NonEmptyClasses & ~((2u << Class) - 1u) : 0u;
+		if (Higher == 0)
+		{
+			return InvalidOffset;
+		}
+		Found = FreeHeads[FMath::CountTrailingZeros(Higher)];
+	}
+
+	UnlinkFree(Found);
+
+	// Split the tail back into the free lists
+	if (Blocks[Found].Size > Size)
+	{
+		const int32 Tail = NewBlock();
+		FBlock& Block = Blocks[Found];
+		FBlock& TailBlock = Blocks[Tail];
+		TailBlock.Offset = Block.Offset + Size;
+		TailBlock.Size = Block.Size - Size;
+		TailBlock.PrevPhysical = Found;
+		TailBlock.NextPhysical = Block.NextPhysical;
+		if (Block.NextPhysical != INDEX_NONE)
+		{
+			Blocks[Block.NextPhysical].PrevPhysical = Tail;
+		}
+		Block.NextPhysical = Tail;
+		Block.Size = Size;
+		LinkFree(Tail);
+	}
+
+	FreeSize -= Size;
+	AllocatedBlocks.Add(Blocks[Found].Offset, Found);
+	return Blocks[Found].Offset;
+}
+
+void FVoxelRangeAllocator::Free(uint32 Offset)
+{
+	int32 BlockIndex = INDEX_NONE;
+	if (!AllocatedBlocks.RemoveAndCopyValue(Offset, BlockIndex))
+	{
+		checkf(false, TEXT("FVoxelRangeAllocator::Free: no allocation at offset %u"), Offset);
+		return;
+	}
+
+	FreeSize += Blocks[BlockIndex].Size;
+
+	// Absorb a free successor
+	const int32 Next = Blocks[BlockIndex].NextPhysical;
+	if (Next != INDEX_NONE && Blocks[Next].bFree)
+	{
+		UnlinkFree(Next);
+		Blocks[BlockIndex].Size += Blocks[Next].Size;
+		Blocks[BlockIndex].NextPhysical = Blocks[Next].NextPhysical;
+		if (Blocks[Next].NextPhysical != INDEX_NONE)
+		{
+			Blocks[Blocks[Next].NextPhysical].PrevPhysical = BlockIndex;
+		}
+		ReleaseBlock(Next);
+	}
+
+	// Merge into a free predecessor
+	const int32 Prev = Blocks[BlockIndex].PrevPhysical;
+	if (Prev != INDEX_NONE && Blocks[Prev].bFree)
+	{
+		UnlinkFree(Prev);
+		Blocks[Prev].Size += Blocks[BlockIndex].Size;
+		Blocks[Prev].NextPhysical = Blocks[BlockIndex].NextPhysical;
+		if (Blocks[BlockIndex].NextPhysical != INDEX_NONE)
+		{
+			Blocks[Blocks[BlockIndex].NextPhysical].PrevPhysical = Prev;
+		}
+		ReleaseBlock(BlockIndex);
+		BlockIndex = Prev;
+	}
+
+	LinkFree(BlockIndex);
+}
+
+uint32 FVoxelRangeAllocator::GetAllocationSize(uint32 Offset) const
+{
+	const int32* BlockIndex = AllocatedBlocks.Find(Offset);
+	return BlockIndex ? Blocks[*BlockIndex].Size : 0;
+}
+
+FVoxelRangeAllocatorStats FVoxelRangeAllocator::GetStats() const
+{
+	FVoxelRangeAllocatorStats Stats;
+	Stats.Capacity = Capacity;
+	Stats.UsedSize = Capacity - FreeSize;
+	Stats.FreeSize = FreeSize;
+	Stats.NumAllocations = AllocatedBlocks.Num();
+	Stats.NumFreeBlocks = NumFreeBlocks;
+
+	// Every block in a higher class is larger, so only the top non-empty class needs scanning
+	if (NonEmptyClasses != 0)
+	{
+		for (int32 It = FreeHeads[FMath::FloorLog2(NonEmptyClasses)]; It != INDEX_NONE; It = Blocks[It].NextFree)
+		{
+			Stats.LargestFreeBlock = FMath::Max(Stats.LargestFreeBlock, Blocks[It].Size);
+		}
+	}
+	return Stats;
+}
+
+bool FVoxelRangeAllocator::Validate() const
+{
+	if (Capacity == 0)
+	{
+		return AllocatedBlocks.Num() == 0 && NonEmptyClasses == 0;
+	}
+
+	// Walk the physical chain from offset 0
+	int32 First = INDEX_NONE;
+	for (int32 i = 0; i < Blocks.Num(); ++i)
+	{
+		if (Blocks[i].Size > 0 && Blocks[i].PrevPhysical == INDEX_NONE)
+		{
+			if (First != INDEX_NONE)
+			{
+				return false;
+			}
+			First = i;
+		}
+	}
+	if (First == INDEX_NONE || Blocks[First].Offset != 0)
+	{
+		return false;
+	}
+
+	uint32 Expected = 0;
+	uint32 Free = 0;
+	int32 NumFreeInChain = 0;
+	int32 NumAllocatedInChain = 0;
+	bool bPrevFree = false;
+	for (int32 It = First; It != INDEX_NONE; It = Blocks[It].NextPhysical)
+	{
+		const FBlock& Block = Blocks[It];
+		if (Block.Offset != Expected || Block.Size == 0 || Block.Size % Granularity != 0)
+		{
+			return false;
+		}
+		if (Block.NextPhysical != INDEX_NONE && Blocks[Block.NextPhysical].PrevPhysical != It)
+		{
+			return false;
+		}
+		if (Block.bFree)
+		{
+			if (bPrevFree)
+			{
+				return false;
+			}
+			Free += Block.Size;
+			++NumFreeInChain;
+		}
+		else
+		{
+			const int32* Live = AllocatedBlocks.Find(Block.Offset);
+			if (!Live || *Live != It)
+			{
+				return false;
+			}
+			++NumAllocatedInChain;
+		}
+		bPrevFree = Block.bFree;
+		Expected += Block.Size;
+	}
+
+	// Free lists hold exactly the chain's free blocks, each in its own class
+	int32 NumFreeInLists = 0;
+	for (int32 Class = 0; Class < NumClasses; ++Class)
+	{
+		if (((NonEmptyClasses >> Class) & 1u) != (FreeHeads[Class] != INDEX_NONE ? 1u : 0u))
+		{
+			return false;
+		}
+		for (int32 It = FreeHeads[Class]; It != INDEX_NONE; It = Blocks[It].NextFree)
+		{
+			if (!Blocks[It].bFree || GetClass(Blocks[It].Size) != Class)
+			{
+				return false;
+			}
+			++NumFreeInLists;
+		}
+	}
+
+	return Expected == Capacity && Free == FreeSize
+		&& NumFreeInLists == NumFreeInChain && NumFreeInLists == NumFreeBlocks && NumAllocatedInChain == AllocatedBlocks.Num();
+}
@@ -0,0 +1,554 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelRegionFile.h"
+#include "VoxelChunkCodec.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	struct FVoxelRegionFileHeader
+	{
+		uint32 Magic;
+		uint16 FormatVersion;
+		uint16 RegionSize;
+		uint16 ChunkSize;
+		uint16 Reserved0;
+		int32  RegionX;
+		int32  RegionY;
+		int32  RegionZ;
+		uint32 Reserved1;
+		uint32 Reserved2;
+	};
+	static_assert(sizeof(FVoxelRegionFileHeader) == 32, "Region file header is 32 bytes on disk");
+
+	struct FVoxelChunkRecordHeader
+	{
+		uint32 Magic;           // 'VXCR'
+		uint16 Version;
+		uint16 Flags;           // reserved
+		int32  ChunkX;
+		int32  ChunkY;
+		int32  ChunkZ;
+		uint16 ChunkSize;
+		uint8  EditCodec;       // EVoxelChunkCodec::Raw or ::LZ4
+		uint8  Reserved;
+		uint32 EditCount;
+		uint32 EditRawBytes;    // index deltas (int32) + FVoxelEditDelta planes
+		uint32 EditStoredBytes; // bytes of edit payload actually stored
+		uint32 VoxelBytes;      // FVoxelChunkCodec buffer that follows the edit payload
+	};
+	static_assert(sizeof(FVoxelChunkRecordHeader) == 40, "Chunk record header is 40 bytes on disk");
+
+	constexpr uint32 RecordMagic = uint32('V') | (uint32('X') << 8) | (uint32('C') << 16) | (uint32('R') << 24);
+	constexpr uint16 RecordVersion = 1;
+
+	FORCEINLINE int32 FloorDiv(int32 A, int32 B)
+	{
+		return (A >= 0) ? (A / B) : ((A - B + 1) / B);
+	}
+}
+
+// ==================== FVoxelChunkRecord ====================
+
+void FVoxelChunkRecord::SetEdits(const FChunkEditLayer& Layer)
+{
+	ChunkCoord = Layer.ChunkCoord;
+	ChunkSize = Layer.ChunkSize;
+
+	TArray<TPair<int32, FVoxelEditDelta>> Pairs;
+	Pairs.Reserve(Layer.GetEditCount());
+	Layer.ForEachEdit([&Pairs](int32 Index, const FVoxelEditDelta& Delta)
+	{
+		Pairs.Emplace(Index, Delta);
+	});
+	Pairs.Sort([](const TPair<int32, FVoxelEditDelta>& A, const TPair<int32, FVoxelEditDelta>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	EditIndices.SetNumUninitialized(Pairs.Num());
+	Edits.SetNumUninitialized(Pairs.Num());
+	for (int32 i = 0; i < Pairs.Num(); ++i)
+	{
+		EditIndices[i] = Pairs[i].Key;
+		Edits[i] = Pairs[i].Value;
+	}
+}
+
+void FVoxelChunkRecord::ApplyEditsTo(FChunkEditLayer& Layer) const
+{
+	for (int32 i = 0; i < Edits.Num(); ++i)
+	{
+		Layer.SetEdit(EditIndices[i], Edits[i]);
+	}
+}
+
+bool FVoxelChunkRecord::Encode(TArray<uint8>& OutBlob) const
+{
+	if (EditIndices.Num() != Edits.Num())
+	{
+		return false;
+	}
+
+	const int32 EditCount = Edits.Num();
+	const int32 RawBytes = EditCount * (sizeof(int32) + sizeof(FVoxelEditDelta));
+
+	// Planes: index deltas (mostly 1 for brush strokes, sorted), then the 8-byte records
+	TArray<uint8> Raw;
+	Raw.SetNumUninitialized(RawBytes);
+	int32* Deltas = reinterpret_cast<int32*>(Raw.GetData());
+	int32 Prev = 0;
+	for (int32 i = 0; i < EditCount; ++i)
+	{
+		Deltas[i] = EditIndices[i] - Prev;
+		Prev = EditIndices[i];
+	}
+	if (EditCount > 0)
+	{
+		FMemory::Memcpy(Raw.GetData() + EditCount * sizeof(int32), Edits.GetData(), EditCount * sizeof(FVoxelEditDelta));
+	}
+
+	TArray<uint8> Stored;
+	EVoxelChunkCodec EditCodec = EVoxelChunkCodec::Raw;
+	if (RawBytes > 0)
+	{
+		const FName Fmt = FVoxelChunkCodec::CodecToFormat(EVoxelChunkCodec::LZ4);
+		const int32 Bound = FCompression::CompressMemoryBound(Fmt, RawBytes);
+		Stored.SetNumUninitialized(Bound);
+		int32 CompressedSize = Bound;
+		if (FCompression::CompressMemory(Fmt, Stored.GetData(), CompressedSize, Raw.GetData(), RawBytes)
+			&& CompressedSize < RawBytes)
+		{
+			Stored.SetNum(CompressedSize);
+			EditCodec = EVoxelChunkCodec::LZ4;
+		}
+		else
+		{
+			Stored = MoveTemp(Raw);
+		}
+	}
+
+	FVoxelChunkRecordHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = RecordMagic;
+	Header.Version = RecordVersion;
+	Header.ChunkX = ChunkCoord.X;
+	Header.ChunkY = ChunkCoord.Y;
+	Header.ChunkZ = ChunkCoord.Z;
+	Header.ChunkSize = static_cast<uint16>(ChunkSize);
+	Header.EditCodec = static_cast<uint8>(EditCodec);
+	Header.EditCount = static_cast<uint32>(EditCount);
+	Header.EditRawBytes = static_cast<uint32>(RawBytes);
+	Header.EditStoredBytes = static_cast<uint32>(Stored.Num());
+	Header.VoxelBytes = static_cast<uint32>(VoxelBuffer.Num());
+
+	OutBlob.SetNumUninitialized(sizeof(Header) + Stored.Num() + VoxelBuffer.Num());
+	uint8* Dst = OutBlob.GetData();
+	FMemory::Memcpy(Dst, &Header, sizeof(Header));
+	Dst += sizeof(Header);
+	if (Stored.Num() > 0)
+	{
+		FMemory::Memcpy(Dst, Stored.GetData(), Stored.Num());
+		Dst += Stored.Num();
+	}
+	if (VoxelBuffer.Num() > 0)
+	{
+		FMemory::Memcpy(Dst, VoxelBuffer.GetData(), VoxelBuffer.Num());
+	}
+	return true;
+}
+
+bool FVoxelChunkRecord::Decode(const uint8* Blob, int32 BlobBytes)
+{
+	if (!Blob || BlobBytes < static_cast<int32>(sizeof(FVoxelChunkRecordHeader)))
+	{
+		return false;
+	}
+
+	FVoxelChunkRecordHeader Header;
+	FMemory::Memcpy(&Header, Blob, sizeof(Header));
+	if (Header.Magic != RecordMagic || Header.Version != RecordVersion)
+	{
+		return false;
+	}
+
+	const int64 Expected = static_cast<int64>(sizeof(Header)) + Header.EditStoredBytes + Header.VoxelBytes;
+	const int64 RawBytes = static_cast<int64>(Header.EditCount) * (sizeof(int32) + sizeof(FVoxelEditDelta));
+	if (Expected != BlobBytes || RawBytes != Header.EditRawBytes)
+	{
+		return false;
+	}
+
+	const uint8* EditPayload = Blob + sizeof(Header);
+	const int32 EditCount = static_cast<int32>(Header.EditCount);
+
+	TArray<uint8> Raw;
+	if (Header.EditCodec == static_cast<uint8>(EVoxelChunkCodec::LZ4))
+	{
+		Raw.SetNumUninitialized(static_cast<int32>(RawBytes));
+		if (!FCompression::UncompressMemory(FVoxelChunkCodec::CodecToFormat(EVoxelChunkCodec::LZ4),
+			Raw.GetData(), static_cast<int32>(RawBytes), EditPayload, static_cast<int32>(Header.EditStoredBytes)))
+		{
+			return false;
+		}
+		EditPayload = Raw.GetData();
+	}
+	else if (Header.EditCodec != static_cast<uint8>(EVoxelChunkCodec::Raw) || Header.EditStoredBytes != RawBytes)
+	{
+		return false;
+	}
+
+	ChunkCoord = FIntVector(Header.ChunkX, Header.ChunkY, Header.ChunkZ);
+	ChunkSize = Header.ChunkSize;
+
+	EditIndices.SetNumUninitialized(EditCount);
+	Edits.SetNumUninitialized(EditCount);
+	const int32* Deltas = reinterpret_cast<const int32*>(EditPayload);
+	int32 Index = 0;
+	for (int32 i = 0; i < EditCount; ++i)
+	{
+		Index += Deltas[i];
+		EditIndices[i] = Index;
+	}
+	if (EditCount > 0)
+	{
+		FMemory::Memcpy(Edits.GetData(), EditPayload + EditCount * sizeof(int32), EditCount * sizeof(FVoxelEditDelta));
+	}
+
+	VoxelBuffer.SetNumUninitialized(static_cast<int32>(Header.VoxelBytes));
+	if (Header.VoxelBytes > 0)
+	{
+		FMemory::Memcpy(VoxelBuffer.GetData(), Blob + sizeof(Header) + Header.EditStoredBytes, Header.VoxelBytes);
+	}
+	return true;
+}
+
+// ==================== FVoxelRegionFile ====================
+
+FIntVector FVoxelRegionFile::ChunkToRegion(const FIntVector& ChunkCoord)
+{
+	return FIntVector(
+		FloorDiv(ChunkCoord.X, RegionSize),
+		FloorDiv(ChunkCoord.Y, RegionSize),
+		FloorDiv(ChunkCoord.Z, RegionSize));
+}
+
+int32 FVoxelRegionFile::GetSlotIndex(const FIntVector& ChunkCoord)
+{
+	const FIntVector Local = ChunkCoord - ChunkToRegion(ChunkCoord) * RegionSize;
+	return Local.X + (Local.Y + Local.Z * RegionSize) * RegionSize;
+}
+
+FString FVoxelRegionFile::GetRegionFileName(const FIntVector& RegionCoord)
+{
+	return FString::Printf(TEXT("r.%d.%d.%d.vxr"), RegionCoord.X, RegionCoord.Y, RegionCoord.Z);
+}
+
+FVoxelRegionFile::FVoxelRegionFile(const FString& InPath, const FIntVector& InRegionCoord, int32 InChunkSize)
+	: Path(InPath)
+	, RegionCoord(InRegionCoord)
+	, ChunkSize(InChunkSize)
+{
+}
+
+FVoxelRegionFile::~FVoxelRegionFile()
+{
+	Close();
+}
+
+bool FVoxelRegionFile::WriteHeaderAndTable(IFileHandle& File) const
+{
+	FVoxelRegionFileHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = Magic;
+	Header.FormatVersion = FormatVersion;
+	Header.RegionSize = static_cast<uint16>(RegionSize);
+	Header.ChunkSize = static_cast<uint16>(ChunkSize);
+	Header.RegionX = RegionCoord.X;
+	Header.RegionY = RegionCoord.Y;
+	Header.RegionZ = RegionCoord.Z;
+
+	return File.Seek(0)
+		&& File.Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header))
+		&& File.Write(reinterpret_cast<const uint8*>(Slots.GetData()), Slots.Num() * sizeof(FSlot));
+}
+
+bool FVoxelRegionFile::Open(bool bCreate)
+{
+	Close();
+
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+	Slots.Reset();
+	Slots.SetNum(NumSlots);
+	NumChunks = 0;
+	LiveBytes = 0;
+
+	// Settle an interrupted Compact. The temp file is flushed and closed before the old file is
+	// deleted, so with the old file gone it is complete; beside the old file it may be partial.
+	const FString TempPath = Path + GetCompactSuffix();
+	if (PF.FileExists(*TempPath))
+	{
+		if (PF.FileExists(*Path))
+		{
+			PF.DeleteFile(*TempPath);
+		}
+		else if (!PF.MoveFile(*Path, *TempPath))
+		{
+			return false;
+		}
+	}
+
+	if (!PF.FileExists(*Path))
+	{
+		if (!bCreate)
+		{
+			return false;
+		}
+
+		PF.CreateDirectoryTree(*FPaths::GetPath(Path));
+		TUniquePtr<IFileHandle> NewFile(PF.OpenWrite(*Path));
+		if (!NewFile.IsValid() || !WriteHeaderAndTable(*NewFile))
+		{
+			return false;
+		}
+	}
+
+	// bAppend only positions the handle at the end; Seek still addresses the whole file, which the
+	// in-place table updates rely on.
+	Handle.Reset(PF.OpenWrite(*Path, /*bAppend=*/true, /*bAllowRead=*/true));
+	if (!Handle.IsValid())
+	{
+		return false;
+	}
+
+	FileBytes = Handle->Size();
+	FVoxelRegionFileHeader Header;
+	if (FileBytes < DataStart
+		|| !Handle->Seek(0)
+		|| !Handle->Read(reinterpret_cast<uint8*>(&Header), sizeof(Header))
+		|| Header.Magic != Magic
+		|| Header.FormatVersion != FormatVersion
+		|| Header.RegionSize != RegionSize
+		|| Header.ChunkSize != ChunkSize
+		|| FIntVector(Header.RegionX, Header.RegionY, Header.RegionZ) != RegionCoord
+		|| !Handle->Read(reinterpret_cast<uint8*>(Slots.GetData()), NumSlots * sizeof(FSlot)))
+	{
+		Close();
+		return false;
+	}
+
+	for (FSlot& Slot : Slots)
+	{
+		if (Slot.Offset == 0)
+		{
+			continue;
+		}
+		// An entry pointing outside the file (torn append) is treated as absent
+		if (static_cast<int64>(Slot.Offset) < DataStart || static_cast<int64>(Slot.Offset + Slot.Size) > FileBytes)
+		{
+			Slot = FSlot();
+			continue;
+		}
+		++NumChunks;
+		LiveBytes += Slot.Size;
+	}
+	return true;
+}
+
+void FVoxelRegionFile::Close()
+{
+	if (Handle.IsValid())
+	{
+		Handle->Flush();
+		Handle.Reset();
+	}
+}
+
+void FVoxelRegionFile::Flush()
+{
+	if (Handle.IsValid())
+	{
+		Handle->Flush();
+	}
+}
+
+bool FVoxelRegionFile::HasChunk(const FIntVector& ChunkCoord) const
+{
+	return ChunkToRegion(ChunkCoord) == RegionCoord && Slots.Num() == NumSlots && Slots[GetSlotIndex(ChunkCoord)].Offset != 0;
+}
+
+void FVoxelRegionFile::GetChunkCoords(TArray<FIntVector>& OutChunkCoords) const
+{
+	const FIntVector Base = RegionCoord * RegionSize;
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		if (Slots[SlotIndex].Offset != 0)
+		{
+			OutChunkCoords.Add(Base + FIntVector(
+				SlotIndex % RegionSize,
+				(SlotIndex / RegionSize) % RegionSize,
+				SlotIndex / (RegionSize * RegionSize)));
+		}
+	}
+}
+
+int32 FVoxelRegionFile::GetChunkBytes(const FIntVector& ChunkCoord) const
+{
+	return HasChunk(ChunkCoord) ? static_cast<int32>(Slots[GetSlotIndex(ChunkCoord)].Size) : 0;
+}
+
+bool FVoxelRegionFile::ReadBlob(const FSlot& Slot, TArray<uint8>& OutBlob)
+{
+	OutBlob.SetNumUninitialized(Slot.Size);
+	if (!Handle->Seek(static_cast<int64>(Slot.Offset)) || !Handle->Read(OutBlob.GetData(), Slot.Size))
+	{
+		return false;
+	}
+	if (FCrc::MemCrc32(OutBlob.GetData(), OutBlob.Num()) != Slot.Crc)
+	{
+		++CrcFailures;
+		return false;
+	}
+	return true;
+}
+
+bool FVoxelRegionFile::ReadChunk(const FIntVector& ChunkCoord, FVoxelChunkRecord& OutRecord)
+{
+	if (!IsOpen() || !HasChunk(ChunkCoord))
+	{
+		return false;
+	}
+
+	TArray<uint8> Blob;
+	return ReadBlob(Slots[GetSlotIndex(ChunkCoord)], Blob)
+		&& OutRecord.Decode(Blob.GetData(), Blob.Num())
+		&& OutRecord.ChunkCoord == ChunkCoord;
+}
+
+bool FVoxelRegionFile::WriteSlot(int32 SlotIndex)
+{
+	return Handle->Seek(32 + static_cast<int64>(SlotIndex) * sizeof(FSlot))
+		&& Handle->Write(reinterpret_cast<const uint8*>(&Slots[SlotIndex]), sizeof(FSlot));
+}
+
+bool FVoxelRegionFile::WriteChunk(const FVoxelChunkRecord& Record)
+{
+	if (!IsOpen() || ChunkToRegion(Record.ChunkCoord) != RegionCoord)
+	{
+		return false;
+	}
+	if (Record.IsEmpty())
+	{
+		RemoveChunk(Record.ChunkCoord);
+		return true;
+	}
+
+	TArray<uint8> Blob;
+	if (!Record.Encode(Blob))
+	{
+		return false;
+	}
+
+	// Append and flush first, then repoint the table: a crash between the two leaves the old
+	// record live, and the entry can never reach the disk ahead of the bytes it points at
+	const int64 Offset = FileBytes;
+	if (!Handle->Seek(Offset) || !Handle->Write(Blob.GetData(), Blob.Num()) || !Handle->Flush(/*bFullFlush=*/true))
+	{
+		return false;
+	}
+	FileBytes += Blob.Num();
+
+	const int32 SlotIndex = GetSlotIndex(Record.ChunkCoord);
+	FSlot& Slot = Slots[SlotIndex];
+	if (Slot.Offset != 0)
+	{
+		LiveBytes -= Slot.Size;
+	}
+	else
+	{
+		++NumChunks;
+	}
+
+	Slot.Offset = static_cast<uint64>(Offset);
+	Slot.Size = static_cast<uint32>(Blob.Num());
+	Slot.Crc = FCrc::MemCrc32(Blob.GetData(), Blob.Num());
+	LiveBytes += Slot.Size;
+	return WriteSlot(SlotIndex);
+}
+
+bool FVoxelRegionFile::RemoveChunk(const FIntVector& ChunkCoord)
+{
+	if (!IsOpen() || !HasChunk(ChunkCoord))
+	{
+		return false;
+	}
+
+	const int32 SlotIndex = GetSlotIndex(ChunkCoord);
+	LiveBytes -= Slots[SlotIndex].Size;
+	--NumChunks;
+	Slots[SlotIndex] = FSlot();
+	return WriteSlot(SlotIndex);
+}
+
+bool FVoxelRegionFile::Compact()
+{
+	if (!IsOpen())
+	{
+		return false;
+	}
+
+	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+	const FString TempPath = Path + GetCompactSuffix();
+
+	{
+		TUniquePtr<IFileHandle> Out(PF.OpenWrite(*TempPath));
+		if (!Out.IsValid())
+		{
+			return false;
+		}
+
+		// Copy live blobs verbatim (CRC-checked); the table is written last with the new offsets
+		TArray<FSlot> NewSlots;
+		NewSlots.SetNum(NumSlots);
+		int64 Cursor = DataStart;
+		TArray<uint8> Blob;
+		for (int32 i = 0; i < NumSlots; ++i)
+		{
+			if (Slots[i].Offset == 0 || !ReadBlob(Slots[i], Blob))
+			{
+				continue;
+			}
+			if (!Out->Seek(Cursor) || !Out->Write(Blob.GetData(), Blob.Num()))
+			{
+				Out.Reset();
+				PF.DeleteFile(*TempPath);
+				return false;
+			}
+			NewSlots[i] = Slots[i];
+			NewSlots[i].Offset = static_cast<uint64>(Cursor);
+			Cursor += Blob.Num();
+		}
+
+		Swap(Slots, NewSlots);
+		const bool bTableWritten = WriteHeaderAndTable(*Out) && Out->Flush(/*bFullFlush=*/true);
+		Swap(Slots, NewSlots);
+		if (!bTableWritten)
+		{
+			Out.Reset();
+			PF.DeleteFile(*TempPath);
+			return false;
+		}
+	}
+
+	// IPlatformFile has no rename-over, so the swap is delete + move. A crash in between leaves
+	// only the complete temp file, which the next Open promotes.
+	Close();
+	if (!PF.DeleteFile(*Path) || !PF.MoveFile(*Path, *TempPath))
+	{
+		return false;
+	}
+	return Open(false);
+}
@@ -0,0 +1,108 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelStridedLattice.h"
+
+int32 FVoxelStridedLattice::GetApronDepth(int32 ChunkSize, int32 Stride)
+{
+	return FMath::Clamp(Stride + 1, 1, ChunkSize);
+}
+
+bool FVoxelStridedLattice::IsValidStride(int32 ChunkSize, int32 Stride)
+{
+	return Stride >= 1
+		&& FMath::IsPowerOfTwo(Stride)
+		&& ChunkSize % Stride == 0
+		&& ChunkSize / Stride >= 2;
+}
+
+void FVoxelStridedLattice::BuildAxisCoords(int32 ChunkSize, int32 Stride, TArray<int32>& OutCoords)
+{
+	OutCoords.Reset(ChunkSize);
+
+	if (Stride <= 1)
+	{
+		for (int32 C = 0; C < ChunkSize; ++C)
+		{
+			OutCoords.Add(C);
+		}
+		return;
+	}
+
+	const int32 Apron = GetApronDepth(ChunkSize, Stride);
+	for (int32 C = 0; C < ChunkSize; ++C)
+	{
+		const bool bLattice = (C % Stride) == 0;
+		const bool bApron = C < Apron || C >= ChunkSize - Apron;
+		if (bLattice || bApron)
+		{
+			OutCoords.Add(C);
+		}
+	}
+}
+
+int32 FVoxelStridedLattice::GetAxisCount(int32 ChunkSize, int32 Stride)
+{
+	TArray<int32> Coords;
+	BuildAxisCoords(ChunkSize, Stride, Coords);
+	return Coords.Num();
+}
+
+int32 FVoxelStridedLattice::GetCompactVoxelCount(int32 ChunkSize, int32 Stride)
+{
+	const int32 M = GetAxisCount(ChunkSize, Stride);
+	return M * M * M;
+}
+
+void FVoxelStridedLattice::Expand(const FVoxelData* Compact, int32 ChunkSize, int32 Stride, TArray<FVoxelData>& OutFull)
+{
+	TArray<int32> Coords;
+	BuildAxisCoords(ChunkSize, Stride, Coords);
+	const int32 M = Coords.Num();
+
+	// Full coordinate -> compact index of the nearest sampled coordinate at or below it
+	TArray<int32> Remap;
+	Remap.SetNumUninitialized(ChunkSize);
+	for (int32 C = 0, S = 0; C < ChunkSize; ++C)
+	{
+		while (S + 1 < M && Coords[S + 1] <= C)
+		{
+			++S;
+		}
+		Remap[C] = S;
+	}
+
+	OutFull.SetNumUninitialized(ChunkSize * ChunkSize * ChunkSize);
+	for (int32 Z = 0; Z < ChunkSize; ++Z)
+	{
+		const int32 CZ = Remap[Z] * M * M;
+		for (int32 Y = 0; Y < ChunkSize; ++Y)
+		{
+			const int32 CYZ = CZ + Remap[Y] * M;
+			FVoxelData* Row = OutFull.GetData() + Y * ChunkSize + Z * ChunkSize * ChunkSize;
+			for (int32 X = 0; X < ChunkSize; ++X)
+			{
+				Row[X] = Compact[CYZ + Remap[X]];
+			}
+		}
+	}
+}
+
+void FVoxelStridedLattice::Gather(const TArray<FVoxelData>& Full, int32 ChunkSize, int32 Stride, TArray<FVoxelData>& OutCompact)
+{
+	TArray<int32> Coords;
+	BuildAxisCoords(ChunkSize, Stride, Coords);
+	const int32 M = Coords.Num();
+
+	OutCompact.SetNumUninitialized(M * M * M);
+	for (int32 K = 0; K < M; ++K)
+	{
+		for (int32 J = 0; J < M; ++J)
+		{
+			for (int32 I = 0; I < M; ++I)
+			{
+				OutCompact[I + J * M + K * M * M] =
+					Full[Coords[I] + Coords[J] * ChunkSize + Coords[K] * ChunkSize * ChunkSize];
+			}
+		}
+	}
+}
@@ -113,6 +113,19 @@ const FLODBand* UVoxelWorldConfiguration::GetLODBandForDistance(float Distance)
 	return nullptr;
 }
 
+const FLODBand* UVoxelWorldConfiguration::GetLODBandForLevel(int32 LODLevel) const
+{
+	for (const FLODBand& Band : LODBands)
+	{
+		if (Band.LODLevel == LODLevel)
+		{
+			return &Band;
+		}
+	}
+
+	return nullptr;
+}
+
 int32 UVoxelWorldConfiguration::GetLODLevelForDistance(float Distance) const
 {
 	const FLODBand* Band = GetLODBandForDistance(Distance);
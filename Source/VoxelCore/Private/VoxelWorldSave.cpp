@@ -0,0 +1,182 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelWorldSave.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+
+FVoxelWorldSave::FVoxelWorldSave(const FString& InDirectory, int32 InChunkSize, int32 InMaxOpenRegions)
+	: Directory(InDirectory)
+	, ChunkSize(InChunkSize)
+	, MaxOpenRegions(FMath::Max(1, InMaxOpenRegions))
+{
+}
+
+FVoxelWorldSave::~FVoxelWorldSave()
+{
+	CloseAll();
+}
+
+FVoxelRegionFile* FVoxelWorldSave::GetRegion(const FIntVector& ChunkCoord, bool bCreate)
+{
+	const FIntVector RegionCoord = FVoxelRegionFile::ChunkToRegion(ChunkCoord);
+
+	if (TUniquePtr<FVoxelRegionFile>* Found = Regions.Find(RegionCoord))
+	{
+		RegionLRU.Remove(RegionCoord);
+		RegionLRU.Add(RegionCoord);
+		return Found->Get();
+	}
+
+	const FString Path = Directory / FVoxelRegionFile::GetRegionFileName(RegionCoord);
+	TUniquePtr<FVoxelRegionFile> Region = MakeUnique<FVoxelRegionFile>(Path, RegionCoord, ChunkSize);
+	if (!Region->Open(bCreate))
+	{
+		return nullptr;
+	}
+
+	if (RegionLRU.Num() >= MaxOpenRegions)
+	{
+		const FIntVector Oldest = RegionLRU[0];
+		RegionLRU.RemoveAt(0);
+		if (TUniquePtr<FVoxelRegionFile>* Evicted = Regions.Find(Oldest))
+		{
+			Stats.CrcFailures += (*Evicted)->GetCrcFailures();
+		}
+		Regions.Remove(Oldest);
+	}
+
+	RegionLRU.Add(RegionCoord);
+	return Regions.Add(RegionCoord, MoveTemp(Region)).Get();
+}
+
+bool FVoxelWorldSave::SaveChunk(const FVoxelChunkRecord& Record)
+{
+	// Removing a chunk that was never saved must not create its region file
+	FVoxelRegionFile* Region = GetRegion(Record.ChunkCoord, !Record.IsEmpty());
+	if (!Region)
+	{
+		return Record.IsEmpty();
+	}
+
+	const int64 BytesBefore = Region->GetFileBytes();
+	if (!Region->WriteChunk(Record))
+	{
+		return false;
+	}
+
+	Stats.ChunksWritten++;
+	Stats.BytesWritten += Region->GetFileBytes() - BytesBefore;
+	return true;
+}
+
+bool FVoxelWorldSave::LoadChunk(const FIntVector& ChunkCoord, FVoxelChunkRecord& OutRecord)
+{
+	FVoxelRegionFile* Region = GetRegion(ChunkCoord, false);
+	if (!Region || !Region->ReadChunk(ChunkCoord, OutRecord))
+	{
+		return false;
+	}
+
+	Stats.ChunksRead++;
+	Stats.BytesRead += Region->GetChunkBytes(ChunkCoord);
+	return true;
+}
+
+void FVoxelWorldSave::GetSavedChunkCoords(TArray<FIntVector>& OutChunkCoords)
+{
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(Directory / TEXT("r.*.vxr")), true, false);
+
+	// A region whose compaction was interrupted mid-swap exists only as its temp file (Open restores it)
+	TArray<FString> TempNames;
+	IFileManager::Get().FindFiles(TempNames, *(Directory / (FString(TEXT("r.*.vxr")) + FVoxelRegionFile::GetCompactSuffix())), true, false);
+	for (const FString& TempName : TempNames)
+	{
+		FileNames.AddUnique(TempName.LeftChop(FCString::Strlen(FVoxelRegionFile::GetCompactSuffix())));
+	}
+
+	for (const FString& FileName : FileNames)
+	{
+		// "r.X.Y.Z.vxr"
+		TArray<FString> Parts;
+		FileName.ParseIntoArray(Parts, TEXT("."));
+		if (Parts.Num() != 5)
+		{
+			continue;
+		}
+
+		const FIntVector RegionCoord(FCString::Atoi(*Parts[1]), FCString::Atoi(*Parts[2]), FCString::Atoi(*Parts[3]));
+		if (FileName != FVoxelRegionFile::GetRegionFileName(RegionCoord))
+		{
+			continue;
+		}
+
+		if (const FVoxelRegionFile* Region = GetRegion(RegionCoord * FVoxelRegionFile::RegionSize, false))
+		{
+			Region->GetChunkCoords(OutChunkCoords);
+		}
+	}
+}
+
+bool FVoxelWorldSave::HasChunk(const FIntVector& ChunkCoord)
+{
+	const FVoxelRegionFile* Region = GetRegion(ChunkCoord, false);
+	return Region && Region->HasChunk(ChunkCoord);
+}
+
+bool FVoxelWorldSave::RemoveChunk(const FIntVector& ChunkCoord)
+{
+	FVoxelRegionFile* Region = GetRegion(ChunkCoord, false);
+	return Region && Region->RemoveChunk(ChunkCoord);
+}
+
+void FVoxelWorldSave::Flush()
+{
+	for (const auto& Pair : Regions)
+	{
+		Pair.Value->Flush();
+	}
+}
+
+void FVoxelWorldSave::CloseAll()
+{
+	for (const auto& Pair : Regions)
+	{
+		Stats.CrcFailures += Pair.Value->GetCrcFailures();
+	}
+	Regions.Empty();
+	RegionLRU.Empty();
+}
+
+int32 FVoxelWorldSave::CompactRegions(float MinDeadRatio)
+{
+	int32 Compacted = 0;
+	for (const auto& Pair : Regions)
+	{
+		FVoxelRegionFile& Region = *Pair.Value;
+		const int64 FileBytes = Region.GetFileBytes();
+		if (FileBytes > 0 && Region.GetDeadBytes() > static_cast<int64>(FileBytes * MinDeadRatio))
+		{
+			if (Region.Compact())
+			{
+				++Compacted;
+			}
+		}
+	}
+	Stats.Compactions += Compacted;
+	return Compacted;
+}
+
+FVoxelWorldSaveStats FVoxelWorldSave::GetStats() const
+{
+	FVoxelWorldSaveStats Result = Stats;
+	Result.OpenRegions = Regions.Num();
+	for (const auto& Pair : Regions)
+	{
+		Result.LiveBytes += Pair.Value->GetLiveBytes();
+		Result.DeadBytes += Pair.Value->GetDeadBytes();
+		Result.CrcFailures += Pair.Value->GetCrcFailures();
+	}
+	return Result;
+}
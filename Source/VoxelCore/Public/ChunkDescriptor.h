@@ -8,6 +8,38 @@
 #include "VoxelChunkCodec.h"
 #include "ChunkDescriptor.generated.h"
 
+/**
+ * Off-thread compaction of a resident chunk (FChunkDescriptor::BeginAsyncCompaction -> worker
+ * EncodeAsyncCompaction -> game-thread ApplyAsyncCompaction). The worker only reads Source, an
+ * immutable published snapshot, so the descriptor is never touched off the game thread.
+ */
+struct FVoxelAsyncCompaction
+{
+	/** Snapshot that is encoded; the install applies only while it is still the chunk's published array */
+	TSharedPtr<const TArray<FVoxelData>> Source;
+	uint32 SourceVersion = 0;
+	int32 ChunkSize = VOXEL_DEFAULT_CHUNK_SIZE;
+
+	/** Worker output: a uniform value, else a codec buffer (empty = the codec did not beat raw) */
+	bool bUniform = false;
+	FVoxelData UniformValue;
+	TArray<uint8> Buffer;
+};
+
+/**
+ * Off-thread expansion of a compressed chunk ahead of a read (FChunkDescriptor::BeginAsyncExpansion
+ * -> worker DecodeAsyncExpansion -> game-thread ApplyAsyncExpansion).
+ */
+struct FVoxelAsyncExpansion
+{
+	/** Copy of the compressed buffer; the install applies only while the chunk still holds these bytes */
+	TArray<uint8> Source;
+	uint32 SourceVersion = 0;
+
+	/** Worker output (empty if the buffer failed to decode) */
+	TArray<FVoxelData> Decoded;
+};
+
 /**
  * Chunk metadata and voxel storage.
  *
@@ -117,6 +149,32 @@ struct VOXELCORE_API FChunkDescriptor
 	 */
 	TArray<uint8> CompressedVoxelData;
 
+	/**
+	 * Frame (caller's clock) ApplyAsyncExpansion installed a pre-expanded array for a predicted LOD
+	 * refine; INDEX_NONE otherwise. While held (IsPreExpansionHeld) the far-compression sweep must not
+	 * re-apply the cached compressed buffer, or the refine remesh decompresses it again on the game
+	 * thread. Transient, not serialized.
+	 */
+	int64 PreExpandedFrame = INDEX_NONE;
+
+	/**
+	 * Voxel lattice stride the procedural payload was generated at (1 = full resolution). A chunk
+	 * generated for a far LOD holds only the lattice + deep-plane apron at this stride
+	 * (FVoxelStridedLattice), installed as a Strided side buffer; the voxels in between are
+	 * replicated from the nearest lattice sample on expansion. It must be regenerated before it is
+	 * meshed below twice this stride (see NeedsRegenerationForStride). Transient, not serialized.
+	 */
+	int32 GenerationStride = 1;
+
+	/**
+	 * Immutable published form of the resident array (copy-on-write). GetSharedVoxelData() moves the
+	 * raw array in here so meshing / collision / scatter jobs can hold a reference instead of copying
+	 * ~128 KB per job; while published, VoxelData is empty and reads go through GetResidentArray().
+	 * The next write detaches: it takes the buffer back if no job still holds it, else copies it.
+	 * Non-UPROPERTY: runtime state, not reflected/serialized.
+	 */
+	TSharedPtr<const TArray<FVoxelData>> SharedVoxelData;
+
 	/** Default constructor */
 	FChunkDescriptor() = default;
 
@@ -132,36 +190,109 @@ struct VOXELCORE_API FChunkDescriptor
 	void AllocateVoxelData()
 	{
 		const int32 TotalVoxels = ChunkSize * ChunkSize * ChunkSize;
+		SharedVoxelData.Reset();
 		VoxelData.SetNumZeroed(TotalVoxels);
 		Residency = EVoxelDataResidency::Resident;
 		bDataMutated = false;
 		bUniformValueValid = false;
 		bCompressionEvaluated = false;
 		CompressedVoxelData.Empty();
+		GenerationStride = 1;
 		++ContentVersion;
 	}
 
 	/** Install a freshly generated resident voxel array (the sole population point). */
 	void SetResidentVoxelData(TArray<FVoxelData>&& InData)
 	{
+		SharedVoxelData.Reset();
 		VoxelData = MoveTemp(InData);
 		Residency = EVoxelDataResidency::Resident;
 		bDataMutated = false;
 		bUniformValueValid = false;
 		bCompressionEvaluated = false;
 		CompressedVoxelData.Empty();
+		GenerationStride = 1;
+		++ContentVersion;
+	}
+
+	/**
+	 * Install a freshly generated LOD-strided payload (FVoxelStridedLattice compact layout for
+	 * InStride). It goes straight into the Compressed tier as a Strided buffer — the raw array is only
+	 * materialized by EnsureResident() and can be dropped again for free by TryCompress(). Falls back
+	 * to SetResidentVoxelData for stride 1. Returns false (payload untouched) if the compact array does
+	 * not match InStride's layout.
+	 */
+	bool SetStridedVoxelData(TArray<FVoxelData>&& InCompact, int32 InStride)
+	{
+		if (InStride <= 1)
+		{
+			SetResidentVoxelData(MoveTemp(InCompact));
+			return true;
+		}
+
+		TArray<uint8> Buffer;
+		if (!FVoxelChunkCodec::EncodeStrided(InCompact, ChunkSize, InStride, Buffer))
+		{
+			return false;
+		}
+
+		DropResidentArray();
+		CompressedVoxelData = MoveTemp(Buffer);
+		Residency = EVoxelDataResidency::Compressed;
+		bDataMutated = false;
+		bUniformValueValid = false;
+		bCompressionEvaluated = false;
+		GenerationStride = InStride;
 		++ContentVersion;
+		return true;
+	}
+
+	/**
+	 * Install a persisted [header][payload] buffer (a chunk-record voxel payload) in place of
+	 * generation. It goes straight into the Compressed tier, like a strided payload; EnsureResident()
+	 * expands it on first read. Returns false (payload untouched) if the header is not a current
+	 * FVoxelChunkCodec buffer for this chunk size.
+	 */
+	bool SetCompressedVoxelData(TArray<uint8>&& InBuffer)
+	{
+		FVoxelChunkBufferHeader Header;
+		if (!FVoxelChunkCodec::PeekHeader(InBuffer, Header) || Header.ChunkSize != ChunkSize
+			|| Header.CodecId == static_cast<uint8>(EVoxelChunkCodec::Uniform))
+		{
+			return false;
+		}
+
+		DropResidentArray();
+		CompressedVoxelData = MoveTemp(InBuffer);
+		Residency = EVoxelDataResidency::Compressed;
+		bDataMutated = false;
+		bUniformValueValid = false;
+		bCompressionEvaluated = false;
+		GenerationStride = FVoxelChunkCodec::GetBufferStride(CompressedVoxelData);
+		++ContentVersion;
+		return true;
+	}
+
+	/**
+	 * The payload is too coarse for a chunk meshed at MeshStride, so it must be regenerated first. A
+	 * strided payload serves mesh strides of at least twice its stride: the chunk's own lattice
+	 * reads and a 2:1 finer neighbour's reads of its face planes then both land on samples.
+	 */
+	FORCEINLINE bool NeedsRegenerationForStride(int32 MeshStride) const
+	{
+		return GenerationStride > 1 && GenerationStride * 2 > MeshStride;
 	}
 
 	/** Clear voxel data to free memory */
 	void ClearVoxelData()
 	{
-		VoxelData.Empty();
+		DropResidentArray();
 		Residency = EVoxelDataResidency::Empty;
 		bDataMutated = false;
 		bUniformValueValid = false;
 		bCompressionEvaluated = false;
 		CompressedVoxelData.Empty();
+		GenerationStride = 1;
 		// NOTE: no ContentVersion bump — clearing is a memory teardown, not a logical content change.
 		// Boundary revalidation ignores a neighbour that no longer has data (re-meshing against a
 		// gone neighbour would only clamp), so a version bump here would cause pointless remeshes.
@@ -197,13 +328,15 @@ struct VOXELCORE_API FChunkDescriptor
 	FORCEINLINE FVoxelData GetVoxel(const FIntVector& LocalPos) const
 	{
 		const int32 Index = GetVoxelIndex(LocalPos);
-		return VoxelData.IsValidIndex(Index) ? VoxelData[Index] : FVoxelData::Air();
+		const TArray<FVoxelData>& Data = GetResidentArray();
+		return Data.IsValidIndex(Index) ? Data[Index] : FVoxelData::Air();
 	}
 
 	/** Set voxel at local position */
 	FORCEINLINE void SetVoxel(const FIntVector& LocalPos, const FVoxelData& Data)
 	{
 		const int32 Index = GetVoxelIndex(LocalPos);
+		DetachSharedVoxelData();
 		if (VoxelData.IsValidIndex(Index))
 		{
 			VoxelData[Index] = Data;
@@ -232,12 +365,14 @@ struct VOXELCORE_API FChunkDescriptor
 	/** Get voxel by linear index */
 	FORCEINLINE FVoxelData GetVoxelByIndex(int32 Index) const
 	{
-		return VoxelData.IsValidIndex(Index) ? VoxelData[Index] : FVoxelData::Air();
+		const TArray<FVoxelData>& Data = GetResidentArray();
+		return Data.IsValidIndex(Index) ? Data[Index] : FVoxelData::Air();
 	}
 
 	/** Set voxel by linear index */
 	FORCEINLINE void SetVoxelByIndex(int32 Index, const FVoxelData& Data)
 	{
+		DetachSharedVoxelData();
 		if (VoxelData.IsValidIndex(Index))
 		{
 			VoxelData[Index] = Data;
@@ -264,7 +399,63 @@ struct VOXELCORE_API FChunkDescriptor
 	 */
 	FORCEINLINE bool IsVoxelDataResident() const
 	{
-		return VoxelData.Num() == GetTotalVoxels();
+		return GetResidentArray().Num() == GetTotalVoxels();
+	}
+
+	/** The resident array in whichever form holds it (published snapshot or raw array). No materialization. */
+	FORCEINLINE const TArray<FVoxelData>& GetResidentArray() const
+	{
+		return SharedVoxelData.IsValid() ? *SharedVoxelData : VoxelData;
+	}
+
+	/**
+	 * Publish the resident array as an immutable shared snapshot and return it — the zero-copy hand-off
+	 * for worker jobs. Materializes a compact form first; repeated calls return the same buffer until the
+	 * next write. Null if the chunk has no voxel data. Game-thread only.
+	 */
+	TSharedPtr<const TArray<FVoxelData>> GetSharedVoxelData()
+	{
+		if (!SharedVoxelData.IsValid())
+		{
+			EnsureResident();
+			if (VoxelData.Num() != GetTotalVoxels())
+			{
+				return nullptr;
+			}
+			// Allocated non-const, so DetachSharedVoxelData may move it back out when it is the sole owner.
+			SharedVoxelData = MakeShared<TArray<FVoxelData>>(MoveTemp(VoxelData));
+		}
+		return SharedVoxelData;
+	}
+
+	/**
+	 * Copy-on-write detach: bring a published snapshot back into the mutable raw array. Takes the
+	 * buffer back without copying when no job still references it, otherwise copies it (the jobs keep
+	 * their immutable version). No-op when nothing is published.
+	 */
+	void DetachSharedVoxelData()
+	{
+		if (!SharedVoxelData.IsValid())
+		{
+			return;
+		}
+		if (SharedVoxelData.GetSharedReferenceCount() == 1)
+		{
+			// Sole owner: only the game thread hands out references, so nobody can acquire one now.
+			VoxelData = MoveTemp(const_cast<TArray<FVoxelData>&>(*SharedVoxelData));
+		}
+		else
+		{
+			VoxelData = *SharedVoxelData;
+		}
+		SharedVoxelData.Reset();
+	}
+
+	/** Drop the resident array in both forms (in-flight jobs keep their snapshot alive). */
+	FORCEINLINE void DropResidentArray()
+	{
+		VoxelData.Empty();
+		SharedVoxelData.Reset();
 	}
 
 	/**
@@ -282,10 +473,13 @@ struct VOXELCORE_API FChunkDescriptor
 	/**
 	 * Materialize the raw voxel array in place if it is held in a compact form, and return it.
 	 * All resident-array access funnels through here so later tiers decompress transparently.
-	 * Game-thread only. PR A: only Empty|Resident occur, so this is a pass-through.
+	 * Returns the mutable raw array, so a published snapshot is detached first (see
+	 * DetachSharedVoxelData); read-only callers use GetVoxelDataForRead, which does not detach.
+	 * Game-thread only.
 	 */
 	TArray<FVoxelData>& EnsureResident()
 	{
+		DetachSharedVoxelData();
 		if (Residency == EVoxelDataResidency::Uniform)
 		{
 			// Expand the single value back into a full array. UniformValue stays valid — the array is
@@ -321,17 +515,17 @@ struct VOXELCORE_API FChunkDescriptor
 		}
 		if (bUniformValueValid)
 		{
-			VoxelData.Empty();
+			DropResidentArray();
 			Residency = EVoxelDataResidency::Uniform;
 			return true;
 		}
 		bCompressionEvaluated = true;
 		FVoxelData Value;
-		if (ComputeUniformValue(VoxelData, Value))
+		if (ComputeUniformValue(GetResidentArray(), Value))
 		{
 			UniformValue = Value;
 			bUniformValueValid = true;
-			VoxelData.Empty();
+			DropResidentArray();
 			Residency = EVoxelDataResidency::Uniform;
 			return true;
 		}
@@ -354,14 +548,14 @@ struct VOXELCORE_API FChunkDescriptor
 		// Free re-collapse to Uniform (cached single value, unmutated) — no scan.
 		if (bUniformValueValid)
 		{
-			VoxelData.Empty();
+			DropResidentArray();
 			Residency = EVoxelDataResidency::Uniform;
 			return true;
 		}
 		// Free re-compress (cached buffer, unmutated) — no re-encode.
 		if (CompressedVoxelData.Num() > 0)
 		{
-			VoxelData.Empty();
+			DropResidentArray();
 			Residency = EVoxelDataResidency::Compressed;
 			return true;
 		}
@@ -373,12 +567,13 @@ struct VOXELCORE_API FChunkDescriptor
 		// General codec for a non-uniform chunk (skipped in uniform-only mode).
 		if (Codec != EVoxelChunkCodec::Uniform && Codec != EVoxelChunkCodec::Raw)
 		{
-			const int32 RawBytes = VoxelData.Num() * sizeof(FVoxelData);
+			const TArray<FVoxelData>& Data = GetResidentArray();
+			const int32 RawBytes = Data.Num() * sizeof(FVoxelData);
 			TArray<uint8> Buffer;
-			if (FVoxelChunkCodec::Compress(VoxelData, Codec, ChunkSize, Buffer) && Buffer.Num() < RawBytes)
+			if (FVoxelChunkCodec::Compress(Data, Codec, ChunkSize, Buffer) && Buffer.Num() < RawBytes)
 			{
 				CompressedVoxelData = MoveTemp(Buffer);
-				VoxelData.Empty();
+				DropResidentArray();
 				Residency = EVoxelDataResidency::Compressed;
 				bDataMutated = false;
 				return true;
@@ -387,6 +582,136 @@ struct VOXELCORE_API FChunkDescriptor
 		return false;
 	}
 
+	// --- Off-thread compaction / expansion (the codec runs on a worker, the swap on the game thread) ---
+
+	/**
+	 * Start an off-thread TryCompress: publish the resident array and stamp the job with it and the
+	 * current ContentVersion. False if the chunk is not Resident, or a free compact form is cached
+	 * (TryCompress takes that without any codec work). Game-thread only.
+	 */
+	bool BeginAsyncCompaction(FVoxelAsyncCompaction& OutJob)
+	{
+		if (Residency != EVoxelDataResidency::Resident || bUniformValueValid || CompressedVoxelData.Num() > 0)
+		{
+			return false;
+		}
+		OutJob.Source = GetSharedVoxelData();
+		OutJob.SourceVersion = ContentVersion;
+		OutJob.ChunkSize = ChunkSize;
+		return OutJob.Source.IsValid();
+	}
+
+	/** Worker side of an async compaction: uniform scan, then the general codec (same tiers as TryCompress). Thread-safe. */
+	static void EncodeAsyncCompaction(FVoxelAsyncCompaction& Job, EVoxelChunkCodec Codec)
+	{
+		const TArray<FVoxelData>& Data = *Job.Source;
+		Job.bUniform = ComputeUniformValue(Data, Job.UniformValue);
+		if (Job.bUniform || Codec == EVoxelChunkCodec::Uniform || Codec == EVoxelChunkCodec::Raw)
+		{
+			return;
+		}
+		if (!FVoxelChunkCodec::Compress(Data, Codec, Job.ChunkSize, Job.Buffer)
+			|| Job.Buffer.Num() >= Data.Num() * static_cast<int32>(sizeof(FVoxelData)))
+		{
+			Job.Buffer.Empty();
+		}
+	}
+
+	/**
+	 * The chunk still publishes exactly the snapshot the job encoded: same ContentVersion, still
+	 * Resident, and not detached (any write detaches, so an unchanged pointer means unchanged bytes).
+	 */
+	bool IsAsyncCompactionCurrent(const FVoxelAsyncCompaction& Job) const
+	{
+		return Residency == EVoxelDataResidency::Resident && ContentVersion == Job.SourceVersion
+			&& SharedVoxelData.IsValid() && SharedVoxelData == Job.Source;
+	}
+
+	/**
+	 * Swap in a finished compaction. A stale job (see IsAsyncCompactionCurrent) changes nothing; a job
+	 * that found nothing better than raw marks the chunk evaluated, like TryCompress. Returns true if
+	 * the raw array was dropped. Game-thread only.
+	 */
+	bool ApplyAsyncCompaction(FVoxelAsyncCompaction&& Job)
+	{
+		if (!IsAsyncCompactionCurrent(Job))
+		{
+			return false;
+		}
+		if (Job.bUniform)
+		{
+			UniformValue = Job.UniformValue;
+			bUniformValueValid = true;
+			DropResidentArray();
+			Residency = EVoxelDataResidency::Uniform;
+			return true;
+		}
+		if (Job.Buffer.Num() > 0)
+		{
+			CompressedVoxelData = MoveTemp(Job.Buffer);
+			DropResidentArray();
+			Residency = EVoxelDataResidency::Compressed;
+			bDataMutated = false;
+			return true;
+		}
+		bCompressionEvaluated = true;
+		return false;
+	}
+
+	/** Start an off-thread EnsureResident of a Compressed chunk (copies the compressed bytes). Game-thread only. */
+	bool BeginAsyncExpansion(FVoxelAsyncExpansion& OutJob) const
+	{
+		if (Residency != EVoxelDataResidency::Compressed || CompressedVoxelData.Num() == 0)
+		{
+			return false;
+		}
+		OutJob.Source = CompressedVoxelData;
+		OutJob.SourceVersion = ContentVersion;
+		return true;
+	}
+
+	/** Worker side of an async expansion. Thread-safe. */
+	static void DecodeAsyncExpansion(FVoxelAsyncExpansion& Job)
+	{
+		if (!FVoxelChunkCodec::Decompress(Job.Source, Job.Decoded))
+		{
+			Job.Decoded.Empty();
+		}
+	}
+
+	/**
+	 * Swap in a finished expansion if the chunk is still Compressed with the same version and bytes
+	 * (a compressed chunk can be re-encoded at the same version after a non-versioned write). The
+	 * compressed buffer stays cached, as after EnsureResident. Frame stamps PreExpandedFrame so the
+	 * sweep holds the chunk resident for its remesh. Returns true if installed. Game-thread only.
+	 */
+	bool ApplyAsyncExpansion(FVoxelAsyncExpansion&& Job, int64 Frame = INDEX_NONE)
+	{
+		if (Residency != EVoxelDataResidency::Compressed || ContentVersion != Job.SourceVersion
+			|| Job.Decoded.Num() != GetTotalVoxels() || CompressedVoxelData != Job.Source)
+		{
+			return false;
+		}
+		VoxelData = MoveTemp(Job.Decoded);
+		Residency = EVoxelDataResidency::Resident;
+		bDataMutated = false;
+		PreExpandedFrame = Frame;
+		return true;
+	}
+
+	/**
+	 * True while a pre-expanded chunk should stay resident for the remesh it was expanded for: the chunk
+	 * has not changed state since the expansion (LastStateChangeFrame resets when the remesh starts) and
+	 * fewer than HoldFrames frames have passed (a predicted refine that never happens).
+	 */
+	bool IsPreExpansionHeld(int64 CurrentFrame, int64 LastStateChangeFrame, int64 HoldFrames) const
+	{
+		return PreExpandedFrame != INDEX_NONE
+			&& Residency == EVoxelDataResidency::Resident
+			&& LastStateChangeFrame <= PreExpandedFrame
+			&& (CurrentFrame - PreExpandedFrame) < HoldFrames;
+	}
+
 	/** True iff every voxel in Data is identical; writes that value to Out. False for an empty array. */
 	static bool ComputeUniformValue(const TArray<FVoxelData>& Data, FVoxelData& Out)
 	{
@@ -406,9 +731,16 @@ struct VOXELCORE_API FChunkDescriptor
 		return true;
 	}
 
-	/** Read access: guarantees residency, returns the array. Callers copy or read without mutating. */
+	/**
+	 * Read access: guarantees residency, returns the array. Callers read without mutating; a job that
+	 * outlives this call takes GetSharedVoxelData() instead of a copy. Never detaches a published snapshot.
+	 */
 	FORCEINLINE const TArray<FVoxelData>& GetVoxelDataForRead()
 	{
+		if (SharedVoxelData.IsValid())
+		{
+			return *SharedVoxelData;
+		}
 		return EnsureResident();
 	}
 
@@ -419,7 +751,7 @@ struct VOXELCORE_API FChunkDescriptor
 	 */
 	FORCEINLINE const TArray<FVoxelData>& GetVoxelDataForRead() const
 	{
-		return const_cast<FChunkDescriptor*>(this)->EnsureResident();
+		return const_cast<FChunkDescriptor*>(this)->GetVoxelDataForRead();
 	}
 
 	/**
@@ -445,14 +777,14 @@ struct VOXELCORE_API FChunkDescriptor
 	/** Point-query accessor: guarantees residency (lazy-decompresses), then returns one voxel. */
 	FORCEINLINE FVoxelData GetVoxelResident(const FIntVector& LocalPos) const
 	{
-		const_cast<FChunkDescriptor*>(this)->EnsureResident();
+		const_cast<FChunkDescriptor*>(this)->GetVoxelDataForRead();
 		return GetVoxel(LocalPos);
 	}
 
 	/** Get memory usage in bytes */
 	SIZE_T GetMemoryUsage() const
 	{
-		return sizeof(FChunkDescriptor) + VoxelData.GetAllocatedSize() + CompressedVoxelData.GetAllocatedSize();
+		return sizeof(FChunkDescriptor) + GetResidentArray().GetAllocatedSize() + CompressedVoxelData.GetAllocatedSize();
 	}
 
 	/** Unique identifier combining coords and LOD */
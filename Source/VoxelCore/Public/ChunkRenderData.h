@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "RenderGraphResources.h"
+#include "VoxelCompactVertex.h"
 #include "ChunkRenderData.generated.h"
 
 /**
@@ -144,6 +145,20 @@ struct VOXELCORE_API FChunkMeshData
 	 *  Used by renderers to decide whether to create a masked mesh section. */
 	bool bHasMaskedMaterial = false;
 
+	/**
+	 * First index of the skirt strips appended by the CPU meshers' GenerateSkirts (INDEX_NONE when
+	 * the mesh has none). Skirts only hide LOD cracks visually; collision cooks drop them.
+	 */
+	int32 SkirtIndexStart = INDEX_NONE;
+
+	/**
+	 * Render-ready copy of the vertex attributes, packed on the meshing worker when
+	 * FVoxelMeshingConfig::OutputFormat requests it. Renderers that understand it take it by move
+	 * instead of converting the arrays above on the game thread; everyone else ignores it.
+	 * Must be repacked (or Reset) by anything that edits the vertex arrays afterwards.
+	 */
+	FVoxelPackedChunkVertices PackedVertices;
+
 	/** Clear all mesh data */
 	void Reset()
 	{
@@ -153,7 +168,9 @@ struct VOXELCORE_API FChunkMeshData
 		UV1s.Reset();
 		Colors.Reset();
 		Indices.Reset();
+		PackedVertices.Reset();
 		bHasMaskedMaterial = false;
+		SkirtIndexStart = INDEX_NONE;
 	}
 
 	/** Check if mesh has valid data */
@@ -182,6 +199,7 @@ struct VOXELCORE_API FChunkMeshData
 			+ UVs.GetAllocatedSize()
 			+ UV1s.GetAllocatedSize()
 			+ Colors.GetAllocatedSize()
-			+ Indices.GetAllocatedSize();
+			+ Indices.GetAllocatedSize()
+			+ PackedVertices.GetAllocatedSize();
 	}
 };
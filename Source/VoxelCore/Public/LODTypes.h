@@ -69,6 +69,14 @@ struct VOXELCORE_API FLODQueryContext
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
 	float WorldRadius = 100000.0f;
 
+	/**
+	 * Generation of the loaded-chunk set handed to GetChunksToLoad / GetChunksToUnload. The caller
+	 * bumps it on every add, remove or reset of that set, so a strategy can skip work while the set
+	 * is unchanged (a count can't tell a swap of one chunk for another apart).
+	 */
+	UPROPERTY()
+	uint32 LoadedChunksGeneration = 0;
+
 	// ==================== Performance Budgets ====================
 
 	/** Maximum chunks to load per frame */
@@ -199,6 +207,26 @@ struct VOXELCORE_API FLODBand
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "0"))
 	float MorphRange = 0.0f;
 
+	/**
+	 * Decimate smooth (Dual Contouring / Marching Cubes) chunk meshes in this band on the meshing
+	 * worker: quadric-error edge collapse with chunk-boundary vertices pinned, so seams and skirts
+	 * stay watertight. Intended for far bands, where the stride grid over-tessellates flat terrain.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Simplification")
+	bool bSimplifyMesh = false;
+
+	/** Triangle budget as a fraction of the meshed count (the error bound may stop earlier) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Simplification", meta = (ClampMin = "0.01", ClampMax = "1.0", EditCondition = "bSimplifyMesh"))
+	float SimplifyTargetRatio = 0.15f;
+
+	/**
+	 * Collapse cost bound, in voxels at this band's stride: a collapse is allowed while the kept vertex's
+	 * summed squared distance to the merged vertex's triangle planes stays within its square. A quadric
+	 * sum, not a per-point surface deviation bound.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD|Simplification", meta = (ClampMin = "0.0", EditCondition = "bSimplifyMesh"))
+	float SimplifyMaxError = 0.25f;
+
 	/** Default constructor */
 	FLODBand() = default;
 
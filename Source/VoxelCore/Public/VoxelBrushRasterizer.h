@@ -0,0 +1,78 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelEditTypes.h"
+
+/** One chunk's share of a brush's voxel box. */
+struct FVoxelBrushChunkSpan
+{
+	FIntVector ChunkCoord = FIntVector::ZeroValue;
+
+	/** Inclusive local voxel box inside the chunk */
+	FIntVector LocalMin = FIntVector::ZeroValue;
+	FIntVector LocalMax = FIntVector::ZeroValue;
+
+	/** Brush-relative voxel offset of LocalMin */
+	FIntVector OffsetMin = FIntVector::ZeroValue;
+
+	/** Brush-relative voxel offset of a local position inside this span */
+	FORCEINLINE FIntVector GetOffset(const FIntVector& LocalPos) const
+	{
+		return OffsetMin + (LocalPos - LocalMin);
+	}
+};
+
+/**
+ * Brush shape + falloff evaluation for UVoxelEditManager::ApplyBrushEdit.
+ *
+ * Brush voxels sit at whole-voxel offsets from the brush centre, so a voxel's distance depends
+ * only on its integer offset D. The rasterizer exploits that: SplitByChunk cuts the brush's voxel
+ * box into per-chunk spans up front (no per-voxel world -> chunk conversion), ClipRow narrows each
+ * X row to the shape's analytic extent, and RasterizeRow evaluates distance and falloff for four
+ * voxels per step with VectorRegister4Float. GetStrength is the scalar reference (identical to
+ * FVoxelBrushParams::GetFalloff on the brush distance).
+ *
+ * Stateless after construction: safe to share across threads.
+ */
+class VOXELCORE_API FVoxelBrushRasterizer
+{
+public:
+	FVoxelBrushRasterizer(const FVoxelBrushParams& InBrush, float InVoxelSize);
+
+	/** Half-extent of the brush's voxel box */
+	int32 GetVoxelRadius() const { return VoxelRadius; }
+
+	/**
+	 * Split the voxel box [CenterVoxel - R, CenterVoxel + R] (global voxel coords) into per-chunk
+	 * spans, ordered Z, Y, X by chunk. OutSpans is reset first.
+	 */
+	void SplitByChunk(const FIntVector& CenterVoxel, int32 ChunkSize, TArray<FVoxelBrushChunkSpan>& OutSpans) const;
+
+	/**
+	 * Narrow [InOutDXMin, InOutDXMax] to the voxels of row (DY, DZ) the shape can reach.
+	 * Conservative: may keep voxels whose strength is 0. @return false if the row is empty.
+	 */
+	bool ClipRow(int32 DY, int32 DZ, int32& InOutDXMin, int32& InOutDXMax) const;
+
+	/**
+	 * Brush strength (Strength * falloff, 0 outside the shape) for offsets DXMin .. DXMin + Count - 1
+	 * of row (DY, DZ). OutStrength must hold Align(Count, 4) floats; the padding lanes are written too.
+	 */
+	void RasterizeRow(int32 DY, int32 DZ, int32 DXMin, int32 Count, float* OutStrength) const;
+
+	/** Scalar strength at one brush-relative voxel offset */
+	float GetStrength(const FIntVector& Offset) const;
+
+private:
+	FVoxelBrushParams Brush;
+
+	/** Brush radius in voxels */
+	float RadiusVoxels = 0.0f;
+
+	/** 1 / RadiusVoxels: scales voxel-unit distances to 0..1 */
+	float InvRadiusVoxels = 0.0f;
+
+	int32 VoxelRadius = 0;
+};
@@ -25,12 +25,13 @@ enum class EVoxelChunkCodec : uint8
 	Oodle       = 3, // whole-buffer Oodle
 	LZ4Planar   = 4, // de-interleaved planes + LZ4
 	OodlePlanar = 5, // de-interleaved planes + Oodle
+	Strided     = 6, // LOD-strided compact lattice (FVoxelStridedLattice), stride in the header
 };
 
 /**
  * Self-describing header prepended to a compressed voxel buffer. Fixed 16 bytes, versioned and
- * endian-explicit so the in-memory buffer can double as the on-disk chunk format for the future
- * world-save epic (the CRC / cross-endian machinery is deferred until persistence actually lands).
+ * endian-explicit so the in-memory buffer doubles as the on-disk voxel payload of an
+ * FVoxelChunkRecord (region files add the CRC per record; see VoxelRegionFile.h).
  */
 struct FVoxelChunkBufferHeader
 {
@@ -39,7 +40,7 @@ struct FVoxelChunkBufferHeader
 	uint8  CodecId;            // EVoxelChunkCodec
 	uint8  VoxelFormatVersion; // FVoxelData byte-layout version
 	uint16 ChunkSize;          // voxels per edge (decoder never hardcodes the volume)
-	uint16 Pad;                // reserved (0)
+	uint16 CodecParam;         // codec-specific: generation stride for Strided, else 0
 	uint32 UncompressedBytes;  // ChunkSize^3 * sizeof(FVoxelData)
 };
 static_assert(sizeof(FVoxelChunkBufferHeader) == 16, "FVoxelChunkBufferHeader must be exactly 16 bytes");
@@ -59,6 +60,19 @@ public:
 	 */
 	static bool Compress(const TArray<FVoxelData>& Data, EVoxelChunkCodec PreferredCodec, int32 ChunkSize, TArray<uint8>& OutBuffer);
 
+	/**
+	 * Wrap a compact LOD-strided lattice (FVoxelStridedLattice layout) as a Strided buffer. Decompress
+	 * expands it to the full ChunkSize^3 array (lattice samples replicated over the skipped voxels).
+	 * Returns false if Stride is not valid for ChunkSize or Compact has the wrong size.
+	 */
+	static bool EncodeStrided(const TArray<FVoxelData>& Compact, int32 ChunkSize, int32 Stride, TArray<uint8>& OutBuffer);
+
+	/** Generation stride recorded in a buffer's header (1 for every codec except Strided, or on a bad buffer). */
+	static int32 GetBufferStride(const TArray<uint8>& Buffer);
+
+	/** Copy out a buffer's header. False if the buffer is too short or not a current-format buffer. */
+	static bool PeekHeader(const TArray<uint8>& Buffer, FVoxelChunkBufferHeader& OutHeader);
+
 	/** Decompress a [header][payload] buffer back into OutData (sized from the header). Lossless. */
 	static bool Decompress(const TArray<uint8>& Buffer, TArray<FVoxelData>& OutData);
 
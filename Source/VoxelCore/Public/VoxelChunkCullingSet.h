@@ -0,0 +1,93 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Counters from one FVoxelChunkCullingSet::Cull call. */
+struct FVoxelChunkCullingStats
+{
+	int32 CellsTested = 0;
+	int32 CellsRejected = 0;
+	int32 ChunksTested = 0;
+	int32 ChunksVisible = 0;
+};
+
+/**
+ * Flat per-chunk bounds set for render-thread frustum culling, keyed by ChunkCoord.
+ *
+ * Bounds are stored structure-of-arrays (centre / extent float lanes, padded to groups of four)
+ * so Cull tests four chunks per plane with one vector multiply-add chain instead of walking a
+ * TMap and calling FConvexVolume::IntersectBox per chunk. Chunks are bucketed into coarse XY
+ * column cells (CellSizeInChunks chunks on a side): a cell whose union bounds fail the frustum
+ * is rejected whole before any of its chunks are touched. CellSizeInChunks = 0 keeps one flat set.
+ *
+ * Update / Remove are O(1) (swap-remove within the cell; emptied cells are swap-removed too).
+ * Removal only marks the cell's union bounds stale; they are recomputed on the next Cull.
+ *
+ * Planes follow the FConvexVolume convention (outward normals; a box is outside when it lies
+ * entirely on the positive side of any plane), so results match IntersectBox.
+ *
+ * Not thread-safe: Cull refreshes stale cell bounds in place. Owners serialize access (the scene
+ * proxy only touches it on the render thread).
+ */
+class VOXELCORE_API FVoxelChunkCullingSet
+{
+public:
+	explicit FVoxelChunkCullingSet(int32 InCellSizeInChunks = 0);
+
+	/** Drop every chunk and set the cell size (0 = single flat set) */
+	void Reset(int32 InCellSizeInChunks);
+
+	/** Add a chunk or replace its bounds. Invalid bounds are never culled. */
+	void Update(const FIntVector& ChunkCoord, const FBox& Bounds);
+
+	/** Remove a chunk (no-op if absent) */
+	void Remove(const FIntVector& ChunkCoord);
+
+	int32 Num() const { return Slots.Num(); }
+	int32 GetNumCells() const { return Cells.Num(); }
+	int32 GetCellSizeInChunks() const { return CellSizeInChunks; }
+	bool Contains(const FIntVector& ChunkCoord) const { return Slots.Contains(ChunkCoord); }
+
+	/**
+	 * Append the coord of every chunk whose bounds intersect the convex volume bounded by Planes.
+	 * Order is by cell then slot (stable between calls without edits).
+	 */
+	void Cull(TConstArrayView<FPlane> Planes, TArray<FIntVector>& OutVisible, FVoxelChunkCullingStats* OutStats = nullptr) const;
+
+private:
+	struct FCell
+	{
+		FIntVector2 Key = FIntVector2::ZeroValue;
+
+		/** SoA bounds; length is Coords.Num() rounded up to a multiple of 4 (padding lanes are masked) */
+		TArray<float> CenterX, CenterY, CenterZ;
+		TArray<float> ExtentX, ExtentY, ExtentZ;
+		TArray<FIntVector> Coords;
+
+		/** Union of the cell's chunk bounds; rebuilt lazily after removals */
+		FBox Bounds = FBox(ForceInit);
+		bool bBoundsStale = false;
+
+		int32 Num() const { return Coords.Num(); }
+		void SetLane(int32 Index, const FVector3f& Center, const FVector3f& Extent);
+		void RebuildBounds();
+	};
+
+	struct FSlot
+	{
+		int32 Cell = INDEX_NONE;
+		int32 Index = INDEX_NONE;
+	};
+
+	FIntVector2 GetCellKey(const FIntVector& ChunkCoord) const;
+	void RemoveFromCell(const FIntVector& ChunkCoord, const FSlot& Slot);
+
+	/** Not const-correct by design: Cull refreshes stale cell bounds (see class comment) */
+	mutable TArray<FCell> Cells;
+	TMap<FIntVector2, int32> CellIndices;
+	TMap<FIntVector, FSlot> Slots;
+
+	int32 CellSizeInChunks = 0;
+};
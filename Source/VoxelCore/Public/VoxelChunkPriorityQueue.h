@@ -0,0 +1,387 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Default priority policy: the element's float Priority member (higher = processed sooner). */
+struct FVoxelQueuePriorityMember
+{
+	template<typename ElementType>
+	static FORCEINLINE float Get(const ElementType& Element)
+	{
+		return Element.Priority;
+	}
+};
+
+/** Per-element verdict returned by a TVoxelChunkPriorityQueue::Reprioritize callback. */
+enum class EVoxelQueueReprioritize : uint8
+{
+	/** Keep the element (re-keyed if the callback changed its priority) */
+	Keep,
+	/** Drop the element from the queue */
+	Remove
+};
+
+/**
+ * Indexed max-priority queue of per-chunk work items, keyed by ChunkCoord.
+ *
+ * Replaces the sorted-TArray streaming queues (O(n) memmove per insert, full re-Sort on viewer
+ * movement): a binary heap with a coord -> slot index gives O(log n) push / pop / remove / re-key
+ * and O(1) membership. At most one element per chunk.
+ *
+ * The heap orders by a cached key (PriorityPolicy::Get at push / re-key time, higher first; equal
+ * keys pop in insertion order, like the LowerBound-sorted arrays it replaces). Elements may be
+ * mutated through Modify / Reprioritize; only elements whose key actually changed are re-sifted, so
+ * a caller that keeps a priority stable until it crosses a band (lazy reprioritization) pays
+ * O(changed * log n) instead of a full sort. A large batch of changes falls back to an O(n) rebuild.
+ *
+ * ElementType needs a FIntVector ChunkCoord member. Not thread-safe (game-thread queues).
+ */
+template<typename ElementType, typename PriorityPolicy = FVoxelQueuePriorityMember>
+class TVoxelChunkPriorityQueue
+{
+public:
+	/** Result of a Reprioritize pass. */
+	struct FReprioritizeStats
+	{
+		int32 Removed = 0;
+		int32 Rekeyed = 0;
+		bool bRebuilt = false;
+	};
+
+	int32 Num() const { return Heap.Num(); }
+	bool IsEmpty() const { return Heap.Num() == 0; }
+	bool Contains(const FIntVector& ChunkCoord) const { return SlotIndex.Contains(ChunkCoord); }
+
+	/** Element queued for ChunkCoord, or null. Use Modify to change it. */
+	const ElementType* Find(const FIntVector& ChunkCoord) const
+	{
+		const int32* Slot = SlotIndex.Find(ChunkCoord);
+		return Slot ? &Heap[*Slot].Element : nullptr;
+	}
+
+	/** Highest-priority element. Queue must not be empty. */
+	const ElementType& Top() const
+	{
+		check(Heap.Num() > 0);
+		return Heap[0].Element;
+	}
+
+	/** Insert an element. Returns false (queue untouched) if its chunk is already queued. */
+	bool Push(ElementType Element)
+	{
+		if (SlotIndex.Contains(Element.ChunkCoord))
+		{
+			return false;
+		}
+		const float Key = PriorityPolicy::Get(Element);
+		const int32 Slot = Heap.Num();
+		SlotIndex.Add(Element.ChunkCoord, Slot);
+		Heap.Add(FNode{ MoveTemp(Element), Key, NextSequence++ });
+		SiftUp(Slot);
+		return true;
+	}
+
+	/** Remove and return the highest-priority element. Queue must not be empty. */
+	ElementType Pop()
+	{
+		check(Heap.Num() > 0);
+		ElementType Result = MoveTemp(Heap[0].Element);
+		SlotIndex.Remove(Result.ChunkCoord);
+		RemoveSlot(0);
+		return Result;
+	}
+
+	/** Remove the element queued for ChunkCoord. Returns false if none. */
+	bool Remove(const FIntVector& ChunkCoord)
+	{
+		int32 Slot = INDEX_NONE;
+		if (!SlotIndex.RemoveAndCopyValue(ChunkCoord, Slot))
+		{
+			return false;
+		}
+		RemoveSlot(Slot);
+		return true;
+	}
+
+	/**
+	 * Mutate the element queued for ChunkCoord in place (Func(ElementType&)) and re-key it if its
+	 * priority changed (decrease- or increase-key). ChunkCoord must not be changed. Returns false if
+	 * the chunk is not queued.
+	 */
+	template<typename FuncType>
+	bool Modify(const FIntVector& ChunkCoord, FuncType&& Func)
+	{
+		const int32* Slot = SlotIndex.Find(ChunkCoord);
+		if (!Slot)
+		{
+			return false;
+		}
+		const int32 Index = *Slot;
+		Func(Heap[Index].Element);
+		Rekey(Index);
+		return true;
+	}
+
+	/**
+	 * Visit every element (heap order, unspecified) with Func(ElementType&) -> EVoxelQueueReprioritize.
+	 * The callback may change any field except ChunkCoord, but must not touch this queue. Removed
+	 * elements are dropped; elements whose priority changed are re-keyed. Incremental (per-element
+	 * sift) when few change, O(n) rebuild when many do.
+	 */
+	template<typename FuncType>
+	FReprioritizeStats Reprioritize(FuncType&& Func)
+	{
+		FReprioritizeStats Stats;
+		const int32 Count = Heap.Num();
+		if (Count == 0)
+		{
+			return Stats;
+		}
+
+		// Heap keys stay at their cached values during the visit, so the heap is still valid on them.
+		TArray<int32> Changed;
+		TBitArray<> RemovedSlots(false, Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (Func(Heap[i].Element) == EVoxelQueueReprioritize::Remove)
+			{
+				RemovedSlots[i] = true;
+				++Stats.Removed;
+			}
+			else if (PriorityPolicy::Get(Heap[i].Element) != Heap[i].Key)
+			{
+				Changed.Add(i);
+				++Stats.Rekeyed;
+			}
+		}
+
+		const int32 NumChanges = Stats.Removed + Stats.Rekeyed;
+		if (NumChanges == 0)
+		{
+			return Stats;
+		}
+
+		if (NumChanges * (FMath::FloorLog2(Count) + 1) > Count)
+		{
+			// Bulk: compact, refresh every key, heapify bottom-up.
+			int32 Write = 0;
+			for (int32 Read = 0; Read < Count; ++Read)
+			{
+				if (RemovedSlots[Read])
+				{
+					continue;
+				}
+				if (Write != Read)
+				{
+					Heap[Write] = MoveTemp(Heap[Read]);
+				}
+				Heap[Write].Key = PriorityPolicy::Get(Heap[Write].Element);
+				++Write;
+			}
+			Heap.SetNum(Write, EAllowShrinking::No);
+			Rebuild();
+			Stats.bRebuilt = true;
+			return Stats;
+		}
+
+		// Incremental: one heap operation per change, each on an otherwise-valid heap. Slots move as
+		// we go, so resolve each change by coordinate.
+		TArray<FIntVector, TInlineAllocator<16>> ChangedCoords;
+		for (const int32 Slot : Changed)
+		{
+			ChangedCoords.Add(Heap[Slot].Element.ChunkCoord);
+		}
+		TArray<FIntVector, TInlineAllocator<16>> RemovedCoords;
+		for (TConstSetBitIterator<> It(RemovedSlots); It; ++It)
+		{
+			RemovedCoords.Add(Heap[It.GetIndex()].Element.ChunkCoord);
+		}
+		for (const FIntVector& Coord : RemovedCoords)
+		{
+			Remove(Coord);
+		}
+		for (const FIntVector& Coord : ChangedCoords)
+		{
+			Rekey(SlotIndex.FindChecked(Coord));
+		}
+		return Stats;
+	}
+
+	/** Visit every element (heap order, unspecified). */
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (const FNode& Node : Heap)
+		{
+			Func(Node.Element);
+		}
+	}
+
+	/**
+	 * Visit up to MaxCount elements in pop order without modifying the queue (Func returns false to
+	 * stop early). A best-first walk of the heap tree: O(MaxCount * log MaxCount), independent of Num.
+	 */
+	template<typename FuncType>
+	void ForEachTop(int32 MaxCount, FuncType&& Func) const
+	{
+		if (Heap.Num() == 0 || MaxCount <= 0)
+		{
+			return;
+		}
+
+		const auto ServedFirst = [this](int32 A, int32 B) { return Before(Heap[A], Heap[B]); };
+		TArray<int32, TInlineAllocator<64>> Frontier;
+		Frontier.HeapPush(0, ServedFirst);
+		for (int32 Visited = 0; Visited < MaxCount && Frontier.Num() > 0; ++Visited)
+		{
+			int32 Slot;
+			Frontier.HeapPop(Slot, ServedFirst, EAllowShrinking::No);
+			if (!Func(Heap[Slot].Element))
+			{
+				return;
+			}
+			for (const int32 Child : { Slot * 2 + 1, Slot * 2 + 2 })
+			{
+				if (Child < Heap.Num())
+				{
+					Frontier.HeapPush(Child, ServedFirst);
+				}
+			}
+		}
+	}
+
+	void Reset()
+	{
+		Heap.Reset();
+		SlotIndex.Reset();
+	}
+
+	void Empty()
+	{
+		Heap.Empty();
+		SlotIndex.Empty();
+	}
+
+	/** Heap + index allocation (excludes memory owned by the elements themselves). */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Heap.GetAllocatedSize() + SlotIndex.GetAllocatedSize();
+	}
+
+private:
+	struct FNode
+	{
+		ElementType Element;
+		float Key;
+		uint64 Sequence;
+	};
+
+	/** A is served before B: higher key first, then older first. */
+	static FORCEINLINE bool Before(const FNode& A, const FNode& B)
+	{
+		return A.Key > B.Key || (A.Key == B.Key && A.Sequence < B.Sequence);
+	}
+
+	void Place(int32 Slot)
+	{
+		SlotIndex.FindChecked(Heap[Slot].Element.ChunkCoord) = Slot;
+	}
+
+	void SwapSlots(int32 A, int32 B)
+	{
+		Swap(Heap[A], Heap[B]);
+		Place(A);
+		Place(B);
+	}
+
+	int32 SiftUp(int32 Slot)
+	{
+		while (Slot > 0)
+		{
+			const int32 Parent = (Slot - 1) / 2;
+			if (!Before(Heap[Slot], Heap[Parent]))
+			{
+				break;
+			}
+			SwapSlots(Slot, Parent);
+			Slot = Parent;
+		}
+		return Slot;
+	}
+
+	void SiftDown(int32 Slot)
+	{
+		const int32 Count = Heap.Num();
+		for (;;)
+		{
+			const int32 Left = Slot * 2 + 1;
+			if (Left >= Count)
+			{
+				break;
+			}
+			const int32 Right = Left + 1;
+			const int32 Child = (Right < Count && Before(Heap[Right], Heap[Left])) ? Right : Left;
+			if (!Before(Heap[Child], Heap[Slot]))
+			{
+				break;
+			}
+			SwapSlots(Slot, Child);
+			Slot = Child;
+		}
+	}
+
+	/** Refresh the cached key at Slot and restore the heap property around it. */
+	void Rekey(int32 Slot)
+	{
+		const float NewKey = PriorityPolicy::Get(Heap[Slot].Element);
+		if (NewKey == Heap[Slot].Key)
+		{
+			return;
+		}
+		Heap[Slot].Key = NewKey;
+		if (SiftUp(Slot) == Slot)
+		{
+			SiftDown(Slot);
+		}
+	}
+
+	/** Remove the node at Slot (its index entry must already be gone). */
+	void RemoveSlot(int32 Slot)
+	{
+		const int32 Last = Heap.Num() - 1;
+		if (Slot != Last)
+		{
+			Heap[Slot] = MoveTemp(Heap[Last]);
+			Heap.RemoveAt(Last, 1, EAllowShrinking::No);
+			Place(Slot);
+			if (SiftUp(Slot) == Slot)
+			{
+				SiftDown(Slot);
+			}
+		}
+		else
+		{
+			Heap.RemoveAt(Last, 1, EAllowShrinking::No);
+		}
+	}
+
+	/** Re-establish the heap over Heap's current contents and rebuild the slot index. */
+	void Rebuild()
+	{
+		SlotIndex.Reset();
+		for (int32 i = 0; i < Heap.Num(); ++i)
+		{
+			SlotIndex.Add(Heap[i].Element.ChunkCoord, i);
+		}
+		for (int32 i = Heap.Num() / 2 - 1; i >= 0; --i)
+		{
+			SiftDown(i);
+		}
+	}
+
+	TArray<FNode> Heap;
+	TMap<FIntVector, int32> SlotIndex;
+	uint64 NextSequence = 0;
+};
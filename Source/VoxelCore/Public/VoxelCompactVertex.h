@@ -0,0 +1,187 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelVertex.h"
+
+struct FChunkMeshData;
+
+/**
+ * Compact chunk vertex for the CPU -> render thread handoff - 16 bytes per vertex (vs 28 for
+ * FVoxelVertex).
+ *
+ * Position is 16-bit fixed point on a lattice shared by every chunk (see
+ * FVoxelCompactVertexFrame), so a boundary vertex quantizes to the same world point from either
+ * side. UV is not stored: it is the position projected onto the plane picked by the UV axis bits,
+ * scaled by the chunk's UV density (the triplanar projection the smooth meshers emit). Normal/AO
+ * and material words keep the FVoxelVertex packing.
+ *
+ * This is a hand-off format only: the scene proxy decodes every vertex to FVoxelLocalVertex
+ * (40 bytes) on upload, because FLocalVertexFactory reads float3 positions. It shrinks the
+ * pending batch / render command payload, not GPU vertex memory.
+ *
+ * Thread Safety: POD type, safe to copy
+ */
+struct FVoxelCompactVertex
+{
+	/** Fixed-point chunk-local position (FVoxelCompactVertexFrame::DecodePosition) */
+	uint16 Position[3];
+
+	/**
+	 * UV projection and flags:
+	 * - Bits 0-1: UV plane (0 = XY, 1 = YZ, 2 = XZ)
+	 * - Bits 2-15: Reserved
+	 */
+	uint16 UVAxisAndFlags;
+
+	/** Same packing as FVoxelVertex::PackedNormalAndAO */
+	uint32 PackedNormalAndAO;
+
+	/** Same packing as FVoxelVertex::PackedMaterialData */
+	uint32 PackedMaterialData;
+};
+
+static_assert(sizeof(FVoxelCompactVertex) == 16, "FVoxelCompactVertex must be exactly 16 bytes");
+
+/**
+ * Per-chunk decode parameters for FVoxelCompactVertex.
+ *
+ * The lattice step is ChunkWorldSize / StepsPerChunk and position 0 sits at Bias, so the 16-bit
+ * range covers [-0.5, 1.5) chunk sizes — room for skirts and seam overhang. StepsPerChunk is a
+ * power of two, so chunk origins land exactly on the lattice and neighbours agree bit-for-bit.
+ */
+struct FVoxelCompactVertexFrame
+{
+	static constexpr int32 StepsPerChunk = 32768;
+	static constexpr int32 Bias = 16384;
+
+	/** Largest UV error accepted when deriving UVs from quantized positions (UV units) */
+	static constexpr float UVTolerance = 1.0f / 512.0f;
+
+	/** World units per lattice step */
+	float PositionStep = 0.0f;
+
+	/** UV units per world unit along the projection plane (UVScale / VoxelSize); 0 = no UVs */
+	float UVPerUnit = 0.0f;
+
+	FORCEINLINE FVector3f DecodePosition(const FVoxelCompactVertex& Vertex) const
+	{
+		return FVector3f(
+			static_cast<float>(static_cast<int32>(Vertex.Position[0]) - Bias) * PositionStep,
+			static_cast<float>(static_cast<int32>(Vertex.Position[1]) - Bias) * PositionStep,
+			static_cast<float>(static_cast<int32>(Vertex.Position[2]) - Bias) * PositionStep);
+	}
+
+	/** Triplanar projection: plane 0 = XY, 1 = YZ, 2 = XZ (the meshers' Z-, X-, Y-dominant cases) */
+	static FORCEINLINE FVector2f ProjectUV(const FVector3f& Position, uint32 Plane, float UVPerUnit)
+	{
+		switch (Plane)
+		{
+		case 0: return FVector2f(Position.X, Position.Y) * UVPerUnit;
+		case 1: return FVector2f(Position.Y, Position.Z) * UVPerUnit;
+		default: return FVector2f(Position.X, Position.Z) * UVPerUnit;
+		}
+	}
+
+	/** Expand to the full vertex (position, derived UV, packed normal/material copied through) */
+	FORCEINLINE FVoxelVertex Decode(const FVoxelCompactVertex& Vertex) const
+	{
+		FVoxelVertex Result;
+		Result.Position = DecodePosition(Vertex);
+		Result.UV = ProjectUV(Result.Position, Vertex.UVAxisAndFlags & 0x3, UVPerUnit);
+		Result.PackedNormalAndAO = Vertex.PackedNormalAndAO;
+		Result.PackedMaterialData = Vertex.PackedMaterialData;
+		return Result;
+	}
+};
+
+/**
+ * Render-ready vertices for a chunk mesh, packed by the meshing worker when
+ * FVoxelMeshingConfig::OutputFormat asks for it (FChunkMeshData::PackedVertices). At most one of
+ * Vertices / CompactVertices is filled; both empty means "not packed" and the renderer converts
+ * the SoA arrays itself.
+ */
+struct FVoxelPackedChunkVertices
+{
+	/** Full vertices (FVoxelCompactVertexCodec::ConvertToVertices) */
+	TArray<FVoxelVertex> Vertices;
+
+	/** Compact vertices (FVoxelCompactVertexCodec::Encode), decoded with CompactFrame */
+	TArray<FVoxelCompactVertex> CompactVertices;
+	FVoxelCompactVertexFrame CompactFrame;
+
+	/** Chunk-local bounds of the unquantized positions */
+	FBox LocalBounds = FBox(ForceInit);
+
+	FORCEINLINE bool IsPacked() const
+	{
+		return Vertices.Num() > 0 || CompactVertices.Num() > 0;
+	}
+
+	FORCEINLINE int32 GetVertexCount() const
+	{
+		return CompactVertices.Num() > 0 ? CompactVertices.Num() : Vertices.Num();
+	}
+
+	void Reset()
+	{
+		Vertices.Reset();
+		CompactVertices.Reset();
+		CompactFrame = FVoxelCompactVertexFrame();
+		LocalBounds.Init();
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return Vertices.GetAllocatedSize() + CompactVertices.GetAllocatedSize();
+	}
+};
+
+/**
+ * Encoder from CPU mesh data to compact vertices. Stateless, thread-safe.
+ */
+struct VOXELCORE_API FVoxelCompactVertexCodec
+{
+	/**
+	 * Convert to full FVoxelVertex data, computing local bounds in the same pass. Attribute arrays
+	 * are used when full-size and defaulted otherwise; MaterialID/BiomeID/AO come from Colors
+	 * (R, G, B >> 6).
+	 */
+	static void ConvertToVertices(
+		const FChunkMeshData& MeshData,
+		TArray<FVoxelVertex>& OutVertices,
+		FBox& OutLocalBounds);
+
+	/**
+	 * Fill OutPacked from MeshData: compact vertices when bTryCompact and Encode succeeds,
+	 * full vertices otherwise. An empty mesh leaves OutPacked unpacked.
+	 */
+	static void Pack(
+		const FChunkMeshData& MeshData,
+		float ChunkWorldSize,
+		bool bTryCompact,
+		FVoxelPackedChunkVertices& OutPacked);
+
+	/**
+	 * Encode a chunk mesh. Attributes follow ConvertToVertices: normal from Normals,
+	 * MaterialID/BiomeID/AO from Colors (R, G, B >> 6).
+	 *
+	 * Fails — the caller then submits FVoxelVertex data — when a position falls outside the
+	 * lattice, or a UV is not the triplanar projection of its quantized position within
+	 * FVoxelCompactVertexFrame::UVTolerance (e.g. the cubic mesher's per-quad UVs).
+	 *
+	 * @param MeshData Source mesh (chunk-local positions)
+	 * @param ChunkWorldSize Chunk edge length in world units (sets the lattice step)
+	 * @param OutVertices Compact vertices, one per source vertex (unspecified on failure)
+	 * @param OutFrame Decode parameters for OutVertices
+	 * @param OutLocalBounds Bounds of the unquantized positions
+	 * @return True if every vertex was encoded
+	 */
+	static bool Encode(
+		const FChunkMeshData& MeshData,
+		float ChunkWorldSize,
+		TArray<FVoxelCompactVertex>& OutVertices,
+		FVoxelCompactVertexFrame& OutFrame,
+		FBox& OutLocalBounds);
+};
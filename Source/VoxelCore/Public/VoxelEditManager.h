@@ -7,6 +7,8 @@
 #include "VoxelEditManager.generated.h"
 
 class UVoxelWorldConfiguration;
+class FVoxelWorldSave;
+struct FVoxelChunkRecord;
 
 /**
  * Delegate fired when a chunk's edits are modified.
@@ -22,12 +24,21 @@ DECLARE_MULTICAST_DELEGATE_FourParams(FOnChunkEdited, const FIntVector& /*ChunkC
  */
 DECLARE_MULTICAST_DELEGATE(FOnUndoRedoStateChanged);
 
+/** Cumulative ApplyEditsToVoxelData timing (see UVoxelEditManager::GetMergeStats). */
+struct FVoxelEditMergeStats
+{
+	int32 NumMerges = 0;
+	int64 NumEditsMerged = 0;
+	double TotalMs = 0.0;
+	float LastMs = 0.0f;
+};
+
 /**
  * Voxel Edit Manager.
  *
  * Manages terrain modifications using an overlay architecture:
  * - Edits are stored separately from procedural voxel data
- * - Sparse TMap storage for memory efficiency
+ * - Per-chunk sparse storage that switches to dense 8^3 bricks for heavily edited chunks
  * - Command pattern for undo/redo support
  * - Binary serialization for save/load
  *
@@ -143,7 +154,9 @@ public:
 	/**
 	 * Apply a brush edit at a world position.
 	 *
-	 * Affects multiple voxels within the brush radius.
+	 * Affects multiple voxels within the brush radius. The brush box is split per chunk up front
+	 * and rasterized row by row (FVoxelBrushRasterizer); each chunk receives its edits in one
+	 * batch and is broadcast once per stroke.
 	 *
 	 * @param WorldPos Center of the brush in world space
 	 * @param Brush Brush parameters (shape, size, strength, etc.)
@@ -299,6 +312,60 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel|Edit")
 	bool LoadEditsFromFile(const FString& FilePath);
 
+	// ==================== Chunk Persistence ====================
+
+	/**
+	 * Chunks whose edits changed since they were last persisted. Every mutation that broadcasts
+	 * OnChunkEdited marks its chunk; loading a record (ApplyChunkRecord) does not.
+	 */
+	const TSet<FIntVector>& GetPersistDirtyChunks() const { return PersistDirtyChunks; }
+
+	/** Move the dirty set out; the caller is responsible for persisting those chunks. */
+	void TakePersistDirtyChunks(TArray<FIntVector>& OutChunkCoords);
+
+	/** Snapshot a chunk's edits as a record (edit-less record if the chunk has none, which removes it on save). */
+	void BuildChunkRecord(const FIntVector& ChunkCoord, FVoxelChunkRecord& OutRecord) const;
+
+	/**
+	 * Replace a chunk's edit layer with a persisted record's edits. Refused (false) when the chunk
+	 * has unsaved in-memory edits or an unconfirmed write. Broadcasts OnChunkEdited (System) if bNotify
+	 * so the chunk remeshes.
+	 */
+	bool ApplyChunkRecord(const FVoxelChunkRecord& Record, bool bNotify = true);
+
+	/** Write every dirty chunk to Save (synchronously). Failed chunks stay dirty. @return Chunks written */
+	int32 SaveDirtyChunks(FVoxelWorldSave& Save);
+
+	/** Load a chunk's edits from Save (see ApplyChunkRecord). @return True if edits were installed */
+	bool LoadChunkEdits(FVoxelWorldSave& Save, const FIntVector& ChunkCoord);
+
+	/**
+	 * Save a chunk's edits if dirty, then drop its layer from memory (for chunks streaming out).
+	 * Refused while undo/redo history references the chunk, since undo needs the live layer.
+	 */
+	bool EvictChunkEdits(FVoxelWorldSave& Save, const FIntVector& ChunkCoord);
+
+	/**
+	 * A record built from the chunk's current edits was handed to an async writer: clear its dirty
+	 * flag and hold it as pending until ConfirmChunkPersisted reports the outcome.
+	 */
+	void MarkChunkPersistPending(const FIntVector& ChunkCoord);
+
+	/** Settle a pending write. A failed write marks the chunk dirty again so it is retried. */
+	void ConfirmChunkPersisted(const FIntVector& ChunkCoord, bool bSucceeded);
+
+	/** True while a handed-off write of the chunk's edits is unconfirmed */
+	bool IsChunkPersistPending(const FIntVector& ChunkCoord) const { return PersistPendingChunks.Contains(ChunkCoord); }
+
+	/**
+	 * Drop a chunk's layer without saving it, for callers whose async write of a BuildChunkRecord
+	 * was confirmed. Refused while undo/redo history references the chunk or a write is pending.
+	 */
+	bool ReleaseChunkEdits(const FIntVector& ChunkCoord);
+
+	/** True if the in-progress operation or the undo/redo stacks touch this chunk */
+	bool IsChunkInHistory(const FIntVector& ChunkCoord) const;
+
 	// ==================== Events ====================
 
 	/** Called when a chunk's edits are modified */
@@ -316,10 +383,19 @@ public:
 	FString GetDebugStats() const;
 
 	/**
-	 * Get approximate total memory usage in bytes.
+	 * Get approximate total memory usage in bytes (edit layers + undo/redo history).
 	 */
 	SIZE_T GetMemoryUsage() const;
 
+	/** Bytes held by the undo/redo stacks and the in-progress operation (part of GetMemoryUsage) */
+	SIZE_T GetHistoryMemoryUsage() const;
+
+	/** Number of edit layers that have switched to dense brick storage */
+	int32 GetDenseLayerCount() const;
+
+	/** ApplyEditsToVoxelData timing since initialization */
+	const FVoxelEditMergeStats& GetMergeStats() const { return MergeStats; }
+
 protected:
 	// ==================== Internal Methods ====================
 
@@ -366,6 +442,19 @@ protected:
 		const FIntVector& LocalPos,
 		const FVoxelEdit& Edit);
 
+	/**
+	 * Apply a batch of edits to one chunk (LocalPosition must be set on each): one layer lookup,
+	 * one affected-chunk entry, and at most one OnChunkEdited broadcast (only outside an operation).
+	 * Each edit accumulates exactly like ApplyEditInternal.
+	 */
+	void ApplyEditBatchInternal(const FIntVector& ChunkCoord, TConstArrayView<FVoxelEdit> Edits);
+
+	/**
+	 * Write an edit into a layer, accumulating Add/Subtract deltas with an existing edit.
+	 * @return The edit to record for undo (a zero-delta removal record if the edits cancelled out)
+	 */
+	FVoxelEdit AccumulateEdit(FChunkEditLayer& Layer, const FIntVector& LocalPos, const FVoxelEdit& Edit);
+
 	/**
 	 * Get the original voxel data at a position (from edit layer or procedural).
 	 * For now, returns air if no edit exists (procedural data not accessible here).
@@ -377,6 +466,9 @@ protected:
 	 */
 	void TrimUndoStack();
 
+	/** Mark a chunk dirty for persistence and broadcast OnChunkEdited */
+	void NotifyChunkEdited(const FIntVector& ChunkCoord, EEditSource Source, const FVector& EditCenter, float EditRadius);
+
 protected:
 	// ==================== Configuration ====================
 
@@ -408,6 +500,15 @@ protected:
 	UPROPERTY()
 	TMap<FIntVector, FChunkEditLayer> EditLayers;
 
+	/** Chunks edited since they were last persisted (see GetPersistDirtyChunks) */
+	TSet<FIntVector> PersistDirtyChunks;
+
+	/** Chunks handed to an async writer whose write is not confirmed yet (see MarkChunkPersistPending) */
+	TSet<FIntVector> PersistPendingChunks;
+
+	/** Updated by the const ApplyEditsToVoxelData (game thread only, like the rest of the manager) */
+	mutable FVoxelEditMergeStats MergeStats;
+
 	// ==================== Undo/Redo ====================
 
 	/** Current operation being built (between Begin/End) */
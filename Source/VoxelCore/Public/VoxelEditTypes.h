@@ -136,9 +136,10 @@ struct VOXELCORE_API FVoxelBrushParams
  * Single voxel edit record.
  *
  * Stores the before/after state of a single voxel modification.
- * Used for undo/redo and sparse edit storage.
+ * Used for undo/redo history and serialization; FChunkEditLayer keeps only the
+ * compact FVoxelEditDelta form.
  *
- * Memory: ~20 bytes per edit
+ * Memory: ~40 bytes per edit
  */
 USTRUCT(BlueprintType)
 struct VOXELCORE_API FVoxelEdit
@@ -199,24 +200,86 @@ struct VOXELCORE_API FVoxelEdit
 	 * @param ProceduralData The original procedural voxel data
 	 * @return The merged voxel data after applying this edit
 	 */
-	FVoxelData ApplyToProceduralData(const FVoxelData& ProceduralData) const
+	FVoxelData ApplyToProceduralData(const FVoxelData& ProceduralData) const;
+
+	/**
+	 * Convert local position to linear index within chunk.
+	 * @param ChunkSize Number of voxels per edge
+	 * @return Linear index for array access
+	 */
+	FORCEINLINE int32 GetVoxelIndex(int32 ChunkSize) const
+	{
+		return LocalPosition.X + LocalPosition.Y * ChunkSize + LocalPosition.Z * ChunkSize * ChunkSize;
+	}
+
+	/**
+	 * Check if local position is valid for given chunk size.
+	 */
+	FORCEINLINE bool IsValidPosition(int32 ChunkSize) const
+	{
+		return LocalPosition.X >= 0 && LocalPosition.X < ChunkSize
+			&& LocalPosition.Y >= 0 && LocalPosition.Y < ChunkSize
+			&& LocalPosition.Z >= 0 && LocalPosition.Z < ChunkSize;
+	}
+};
+
+/**
+ * Compact per-voxel edit record stored by FChunkEditLayer (8 bytes).
+ *
+ * Carries only what the merge needs: LocalPosition is implied by the layer index, and
+ * OriginalData / Timestamp live in the undo history (FVoxelEditOperation), not in the layer.
+ * DensityDelta saturates at the int16 range; the merge clamps density to 0-255 anyway.
+ */
+struct VOXELCORE_API FVoxelEditDelta
+{
+	/** Replacement data for Set/Smooth modes */
+	FVoxelData NewData;
+
+	/** Density delta for Add/Subtract modes */
+	int16 DensityDelta = 0;
+
+	EEditMode EditMode = EEditMode::Set;
+
+	/** Material ID for Add/Paint modes */
+	uint8 BrushMaterialID = 1;
+
+	FVoxelEditDelta() = default;
+
+	explicit FVoxelEditDelta(const FVoxelEdit& Edit)
+		: NewData(Edit.NewData)
+		, DensityDelta(static_cast<int16>(FMath::Clamp(Edit.DensityDelta, static_cast<int32>(MIN_int16), static_cast<int32>(MAX_int16))))
+		, EditMode(Edit.EditMode)
+		, BrushMaterialID(Edit.BrushMaterialID)
+	{
+	}
+
+	/** Expand back into a full edit record (OriginalData = Air, no timestamp) */
+	FVoxelEdit ToEdit(const FIntVector& LocalPosition) const
+	{
+		FVoxelEdit Edit(LocalPosition, EditMode, DensityDelta, BrushMaterialID);
+		Edit.NewData = NewData;
+		Edit.Timestamp = 0.0;
+		return Edit;
+	}
+
+	/** Apply this edit to procedural voxel data (the merge rule shared with FVoxelEdit) */
+	FORCEINLINE FVoxelData ApplyToProceduralData(const FVoxelData& ProceduralData) const
 	{
 		FVoxelData Result = ProceduralData;
 
 		switch (EditMode)
 		{
 		case EEditMode::Set:
-			// Set mode replaces entirely
+		case EEditMode::Smooth:
+			// Set replaces entirely; Smooth uses pre-computed NewData (calculated from neighbors)
 			Result = NewData;
 			break;
 
 		case EEditMode::Add:
-			// Add increases density (makes more solid)
 			Result.Density = static_cast<uint8>(FMath::Clamp(
 				static_cast<int32>(ProceduralData.Density) + DensityDelta, 0, 255));
-			// Always apply brush material when adding solid matter.
-			// This ensures placing a block in a previously dug area uses
-			// the player's selected material, not the original terrain material.
+			// Always apply brush material when adding solid matter, so placing a block in a
+			// previously dug area uses the selected material, not the original terrain material.
 			if (Result.Density >= VOXEL_SURFACE_THRESHOLD && BrushMaterialID != 0)
 			{
 				Result.MaterialID = BrushMaterialID;
@@ -224,7 +287,6 @@ struct VOXELCORE_API FVoxelEdit
 			break;
 
 		case EEditMode::Subtract:
-			// Subtract decreases density (makes more air)
 			Result.Density = static_cast<uint8>(FMath::Clamp(
 				static_cast<int32>(ProceduralData.Density) - DensityDelta, 0, 255));
 			break;
@@ -236,45 +298,58 @@ struct VOXELCORE_API FVoxelEdit
 				Result.MaterialID = BrushMaterialID;
 			}
 			break;
-
-		case EEditMode::Smooth:
-			// Smooth uses pre-computed NewData (calculated from neighbors)
-			Result = NewData;
-			break;
 		}
 
 		return Result;
 	}
+};
 
-	/**
-	 * Convert local position to linear index within chunk.
-	 * @param ChunkSize Number of voxels per edge
-	 * @return Linear index for array access
-	 */
-	FORCEINLINE int32 GetVoxelIndex(int32 ChunkSize) const
-	{
-		return LocalPosition.X + LocalPosition.Y * ChunkSize + LocalPosition.Z * ChunkSize * ChunkSize;
-	}
+static_assert(sizeof(FVoxelEditDelta) == 8, "FVoxelEditDelta should stay 8 bytes");
 
-	/**
-	 * Check if local position is valid for given chunk size.
-	 */
-	FORCEINLINE bool IsValidPosition(int32 ChunkSize) const
+FORCEINLINE FVoxelData FVoxelEdit::ApplyToProceduralData(const FVoxelData& ProceduralData) const
+{
+	return FVoxelEditDelta(*this).ApplyToProceduralData(ProceduralData);
+}
+
+/**
+ * Dense 8x8x8 block of edit records inside an FChunkEditLayer.
+ *
+ * Cells are X-fastest (X + Y * 8 + Z * 64), so each 8-voxel X row maps onto one contiguous run
+ * of the chunk's voxel array. Occupancy holds one 64-bit word per Z slice with bit (Y * 8 + X),
+ * i.e. one mask byte per row.
+ */
+struct FVoxelEditBrick
+{
+	static constexpr int32 Size = 8;
+	static constexpr int32 NumCells = Size * Size * Size;
+
+	uint64 Occupancy[Size] = {};
+	FVoxelEditDelta Cells[NumCells];
+
+	/** Slot in the owning layer's brick table */
+	int32 BrickIndex = INDEX_NONE;
+
+	int32 NumEdits = 0;
+
+	FORCEINLINE bool IsSet(int32 Cell) const
 	{
-		return LocalPosition.X >= 0 && LocalPosition.X < ChunkSize
-			&& LocalPosition.Y >= 0 && LocalPosition.Y < ChunkSize
-			&& LocalPosition.Z >= 0 && LocalPosition.Z < ChunkSize;
+		return (Occupancy[Cell >> 6] >> (Cell & 63)) & 1;
 	}
 };
 
 /**
- * Per-chunk sparse edit storage.
+ * Per-chunk edit storage.
  *
- * Stores edits for a single chunk using a sparse TMap.
- * Only modified voxels consume memory, making this efficient
- * for worlds with few edits.
+ * Starts sparse (TMap of linear index to an 8-byte FVoxelEditDelta), which is cheapest for the
+ * few voxels a single click touches. Once a chunk holds more than DenseThreshold edits and the
+ * bricks those edits occupy would cost no more than the sparse map, it switches to dense 8^3
+ * bricks: a brick table (one slot per 8^3 block of the chunk) pointing at only the bricks that
+ * contain edits, each with an occupancy mask. Edits scattered one or two per brick stay sparse.
+ * A large terraforming brush then costs ~8 bytes per voxel with no hash overhead, and
+ * ApplyToVoxelData walks occupied rows linearly instead of hashing every edit. Emptied bricks are
+ * released; an emptied layer returns to sparse.
  *
- * Memory: ~32 bytes base + ~32 bytes per edit
+ * Memory: sparse ~24 bytes per edit; dense ~4 KB per occupied brick + 4 bytes per brick slot
  * Thread Safety: Not thread-safe, use external synchronization
  */
 USTRUCT()
@@ -282,14 +357,16 @@ struct VOXELCORE_API FChunkEditLayer
 {
 	GENERATED_BODY()
 
+	/** Edit count a sparse layer must exceed before brick occupancy is tracked and compared */
+	static constexpr int32 DenseThreshold = 512;
+
+	/** Approximate sparse cost of one edit (map element + hash), compared against occupied bricks */
+	static constexpr SIZE_T SparseBytesPerEdit = 24;
+
 	/** Chunk coordinate this layer belongs to */
 	UPROPERTY()
 	FIntVector ChunkCoord = FIntVector::ZeroValue;
 
-	/** Sparse map of linear index to edit record */
-	UPROPERTY()
-	TMap<int32, FVoxelEdit> Edits;
-
 	/** Chunk size (voxels per edge) for index calculations */
 	UPROPERTY()
 	int32 ChunkSize = VOXEL_DEFAULT_CHUNK_SIZE;
@@ -308,51 +385,91 @@ struct VOXELCORE_API FChunkEditLayer
 	 */
 	void ApplyEdit(const FVoxelEdit& Edit)
 	{
-		const int32 Index = Edit.GetVoxelIndex(ChunkSize);
-		Edits.Add(Index, Edit);
+		SetEdit(Edit.GetVoxelIndex(ChunkSize), FVoxelEditDelta(Edit));
 	}
 
+	/** Store an edit record at a linear voxel index, overwriting any existing one */
+	void SetEdit(int32 Index, const FVoxelEditDelta& Delta);
+
 	/**
 	 * Remove an edit at a local position.
 	 * @return True if an edit was removed
 	 */
 	bool RemoveEdit(const FIntVector& LocalPos)
 	{
-		const int32 Index = LocalPos.X + LocalPos.Y * ChunkSize + LocalPos.Z * ChunkSize * ChunkSize;
-		return Edits.Remove(Index) > 0;
+		return RemoveEditAt(GetVoxelIndex(LocalPos));
 	}
 
+	/** Remove the edit at a linear voxel index. @return True if an edit was removed */
+	bool RemoveEditAt(int32 Index);
+
 	/**
 	 * Get edit at a local position.
-	 * @return Pointer to edit or nullptr if no edit exists
+	 * @return Pointer to the edit record or nullptr if no edit exists. Invalidated by any mutation.
 	 */
-	const FVoxelEdit* GetEdit(const FIntVector& LocalPos) const
+	const FVoxelEditDelta* GetEdit(const FIntVector& LocalPos) const
 	{
-		const int32 Index = LocalPos.X + LocalPos.Y * ChunkSize + LocalPos.Z * ChunkSize * ChunkSize;
-		return Edits.Find(Index);
+		return FindEdit(GetVoxelIndex(LocalPos));
 	}
 
+	/** Get the edit at a linear voxel index (nullptr if none). Invalidated by any mutation. */
+	const FVoxelEditDelta* FindEdit(int32 Index) const;
+	FVoxelEditDelta* FindEdit(int32 Index);
+
 	/**
-	 * Get merged voxel data, preferring edited data over procedural.
+	 * Get merged voxel data for one voxel.
 	 * @param LocalPos Position within chunk
 	 * @param ProceduralData Original procedural voxel data
-	 * @return Edited data if present, otherwise procedural data
+	 * @return Procedural data with the edit applied, or unchanged if there is no edit
 	 */
 	FVoxelData GetMergedVoxel(const FIntVector& LocalPos, const FVoxelData& ProceduralData) const
 	{
-		if (const FVoxelEdit* Edit = GetEdit(LocalPos))
+		if (const FVoxelEditDelta* Edit = GetEdit(LocalPos))
 		{
-			return Edit->NewData;
+			return Edit->ApplyToProceduralData(ProceduralData);
 		}
 		return ProceduralData;
 	}
 
+	/**
+	 * Merge every edit into a chunk voxel array (chunk-local index order) in place.
+	 * Dense layers walk occupied bricks row by row: full rows run a fixed 8-wide loop, partial
+	 * rows iterate the set bits of the row mask.
+	 */
+	void ApplyToVoxelData(TArrayView<FVoxelData> VoxelData) const;
+
+	/** Visit every edit as (linear index, record). Order is unspecified. */
+	void ForEachEdit(TFunctionRef<void(int32 Index, const FVoxelEditDelta& Delta)> Visitor) const;
+
+	/** Linear index -> local position (inverse of GetVoxelIndex) */
+	FORCEINLINE FIntVector GetLocalPosition(int32 Index) const
+	{
+		return FIntVector(Index % ChunkSize, (Index / ChunkSize) % ChunkSize, Index / (ChunkSize * ChunkSize));
+	}
+
+	FORCEINLINE int32 GetVoxelIndex(const FIntVector& LocalPos) const
+	{
+		return LocalPos.X + LocalPos.Y * ChunkSize + LocalPos.Z * ChunkSize * ChunkSize;
+	}
+
+	/** True once the layer has switched to brick storage */
+	FORCEINLINE bool IsDense() const
+	{
+		return BrickTable.Num() > 0;
+	}
+
+	/** Number of allocated bricks (0 while sparse) */
+	FORCEINLINE int32 GetBrickCount() const
+	{
+		return Bricks.Num();
+	}
+
 	/**
 	 * Check if this layer has any edits.
 	 */
 	FORCEINLINE bool IsEmpty() const
 	{
-		return Edits.Num() == 0;
+		return GetEditCount() == 0;
 	}
 
 	/**
@@ -360,24 +477,59 @@ struct VOXELCORE_API FChunkEditLayer
 	 */
 	FORCEINLINE int32 GetEditCount() const
 	{
-		return Edits.Num();
+		return IsDense() ? NumDenseEdits : SparseEdits.Num();
 	}
 
 	/**
-	 * Clear all edits from this layer.
+	 * Clear all edits from this layer (returns it to sparse storage).
 	 */
-	void Clear()
-	{
-		Edits.Empty();
-	}
+	void Clear();
 
 	/**
 	 * Get approximate memory usage in bytes.
 	 */
 	SIZE_T GetMemoryUsage() const
 	{
-		return sizeof(FChunkEditLayer) + Edits.GetAllocatedSize();
+		return sizeof(FChunkEditLayer)
+			+ SparseEdits.GetAllocatedSize()
+			+ SparseBrickEdits.GetAllocatedSize()
+			+ BrickTable.GetAllocatedSize()
+			+ Bricks.GetAllocatedSize();
+	}
+
+private:
+	/** Move the sparse edits into bricks */
+	void ConvertToDense();
+
+	/** Sparse layer past DenseThreshold: would its occupied bricks cost no more than the map? */
+	bool ShouldConvertToDense() const;
+
+	/** Adjust SparseBrickEdits / NumSparseBricks for a sparse edit added (+1) or removed (-1) */
+	void TrackSparseBrick(int32 Index, int32 Delta);
+
+	FORCEINLINE int32 GetBricksPerAxis() const
+	{
+		return (ChunkSize + FVoxelEditBrick::Size - 1) / FVoxelEditBrick::Size;
 	}
+
+	/** Split a linear voxel index into (brick table slot, cell within brick) */
+	void GetBrickCell(int32 Index, int32& OutBrickIndex, int32& OutCell) const;
+
+	/** Sparse storage: linear index to edit record (unused once dense) */
+	TMap<int32, FVoxelEditDelta> SparseEdits;
+
+	/** Sparse edits per brick table slot, built once SparseEdits passes DenseThreshold (empty before / when dense) */
+	TArray<uint16> SparseBrickEdits;
+
+	/** Non-zero entries of SparseBrickEdits */
+	int32 NumSparseBricks = 0;
+
+	/** Dense storage: brick table slot to index into Bricks (INDEX_NONE = no edits); empty while sparse */
+	TArray<int32> BrickTable;
+
+	TArray<FVoxelEditBrick> Bricks;
+
+	int32 NumDenseEdits = 0;
 };
 
 /**
@@ -0,0 +1,129 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Snapshot of a FVoxelRangeAllocator's occupancy. Sizes are in allocator units (e.g. vertices). */
+struct FVoxelRangeAllocatorStats
+{
+	uint32 Capacity = 0;
+	uint32 UsedSize = 0;
+	uint32 FreeSize = 0;
+	uint32 LargestFreeBlock = 0;
+	int32 NumAllocations = 0;
+	int32 NumFreeBlocks = 0;
+
+	/** Used / capacity (0 for an empty allocator) */
+	float GetUtilization() const
+	{
+		return Capacity > 0 ? static_cast<float>(UsedSize) / static_cast<float>(Capacity) : 0.0f;
+	}
+
+	/**
+	 * External fragmentation: 1 - largest free block / total free. 0 when all free space is one
+	 * contiguous block (or there is none); approaches 1 as free space splinters.
+	 */
+	float GetFragmentation() const
+	{
+		return FreeSize > 0 ? 1.0f - static_cast<float>(LargestFreeBlock) / static_cast<float>(FreeSize) : 0.0f;
+	}
+
+	FVoxelRangeAllocatorStats& operator+=(const FVoxelRangeAllocatorStats& Other)
+	{
+		Capacity += Other.Capacity;
+		UsedSize += Other.UsedSize;
+		FreeSize += Other.FreeSize;
+		LargestFreeBlock = FMath::Max(LargestFreeBlock, Other.LargestFreeBlock);
+		NumAllocations += Other.NumAllocations;
+		NumFreeBlocks += Other.NumFreeBlocks;
+		return *this;
+	}
+};
+
+/**
+ * Offset suballocator over a fixed linear range [0, Capacity) — the bookkeeping half of a pooled
+ * GPU buffer (see FVoxelChunkBufferPool). Owns no memory; callers map offsets into their buffers.
+ *
+ * Free blocks sit in power-of-two size classes (class = FloorLog2(size)) with a non-empty bitmask,
+ * so an allocation checks its own class first-fit and otherwise takes the head of the next
+ * non-empty class — O(1) apart from the scan of one class. Freed blocks coalesce with free
+ * physical neighbours immediately, so a fully freed allocator is always one block again.
+ *
+ * Sizes round up to Granularity. Not thread-safe (render-thread owners hold their own lock).
+ */
+class VOXELCORE_API FVoxelRangeAllocator
+{
+public:
+	static constexpr uint32 InvalidOffset = MAX_uint32;
+
+	FVoxelRangeAllocator();
+	explicit FVoxelRangeAllocator(uint32 InCapacity, uint32 InGranularity = 1);
+
+	/** Drop every allocation and restart as one free block of InCapacity */
+	void Reset(uint32 InCapacity, uint32 InGranularity = 1);
+
+	/**
+	 * Allocate Size units.
+	 * @return Offset of the range, or InvalidOffset if no free block is large enough
+	 */
+	uint32 Allocate(uint32 Size);
+
+	/** Free the allocation starting at Offset (must be a live Allocate result) */
+	void Free(uint32 Offset);
+
+	/** Size of the live allocation at Offset (after granularity rounding), 0 if none */
+	uint32 GetAllocationSize(uint32 Offset) const;
+
+	uint32 GetCapacity() const { return Capacity; }
+	uint32 GetUsedSize() const { return Capacity - FreeSize; }
+	int32 GetNumAllocations() const { return AllocatedBlocks.Num(); }
+	bool IsEmpty() const { return AllocatedBlocks.Num() == 0; }
+
+	/** O(1) apart from a scan of the largest non-empty size class (for LargestFreeBlock) */
+	FVoxelRangeAllocatorStats GetStats() const;
+
+	/** Debug consistency check (blocks tile the range, no adjacent free blocks, lists match). */
+	bool Validate() const;
+
+private:
+	static constexpr int32 NumClasses = 32;
+
+	struct FBlock
+	{
+		uint32 Offset = 0;
+		uint32 Size = 0;
+		int32 PrevPhysical = INDEX_NONE;
+		int32 NextPhysical = INDEX_NONE;
+		int32 PrevFree = INDEX_NONE;
+		int32 NextFree = INDEX_NONE;
+		bool bFree = false;
+	};
+
+	static FORCEINLINE int32 GetClass(uint32 Size) { return static_cast<int32>(FMath::FloorLog2(Size)); }
+
+	int32 NewBlock();
+	void ReleaseBlock(int32 BlockIndex);
+	void LinkFree(int32 BlockIndex);
+	void UnlinkFree(int32 BlockIndex);
+
+	/** Block storage; indices are stable, recycled through UnusedBlocks */
+	TArray<FBlock> Blocks;
+	TArray<int32> UnusedBlocks;
+
+	/** Head of each size class's free list */
+	int32 FreeHeads[NumClasses];
+
+	/** Bit c set = FreeHeads[c] non-empty */
+	uint32 NonEmptyClasses = 0;
+
+	/** Length of all free lists together, kept by LinkFree / UnlinkFree */
+	int32 NumFreeBlocks = 0;
+
+	/** Offset -> block index of live allocations */
+	TMap<uint32, int32> AllocatedBlocks;
+
+	uint32 Capacity = 0;
+	uint32 Granularity = 1;
+	uint32 FreeSize = 0;
+};
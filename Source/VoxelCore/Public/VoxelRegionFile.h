@@ -0,0 +1,156 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelEditTypes.h"
+
+class IFileHandle;
+
+/**
+ * One chunk's persisted state: its edit layer and, optionally, a full voxel payload (an
+ * FVoxelChunkCodec buffer) for chunks that should load instead of regenerating.
+ */
+struct VOXELCORE_API FVoxelChunkRecord
+{
+	FIntVector ChunkCoord = FIntVector::ZeroValue;
+	int32 ChunkSize = VOXEL_DEFAULT_CHUNK_SIZE;
+
+	/** Edit layer contents as parallel arrays, sorted by linear voxel index */
+	TArray<int32> EditIndices;
+	TArray<FVoxelEditDelta> Edits;
+
+	/** [FVoxelChunkBufferHeader][payload]; empty = regenerate procedurally */
+	TArray<uint8> VoxelBuffer;
+
+	bool HasEdits() const { return Edits.Num() > 0; }
+	bool HasVoxels() const { return VoxelBuffer.Num() > 0; }
+	bool IsEmpty() const { return !HasEdits() && !HasVoxels(); }
+
+	/** Replace the edit arrays with a layer's contents (ChunkCoord / ChunkSize taken from the layer) */
+	void SetEdits(const FChunkEditLayer& Layer);
+
+	/** Write the edits into a layer (existing edits at the same voxels are overwritten) */
+	void ApplyEditsTo(FChunkEditLayer& Layer) const;
+
+	/**
+	 * Serialize to the on-disk record blob: a 40-byte header, the edit payload (index deltas +
+	 * 8-byte deltas as planes, LZ4 when it helps) and the voxel buffer verbatim.
+	 */
+	bool Encode(TArray<uint8>& OutBlob) const;
+
+	/** Inverse of Encode. False on a malformed blob. */
+	bool Decode(const uint8* Blob, int32 BlobBytes);
+};
+
+/**
+ * Region file: persisted chunk records for a RegionSize^3 block of chunks.
+ *
+ * Layout (little-endian):
+ *   [32-byte header: 'VXRG', version, region size, chunk size, region coord]
+ *   [offset table: NumSlots x {uint64 Offset, uint32 Size, uint32 Crc}]
+ *   [record blobs, append-only]
+ *
+ * Writes append the new blob and then rewrite only that chunk's 16-byte table entry, so a save
+ * touches bytes proportional to the chunk, never the region. Superseded blobs become dead space;
+ * Compact rewrites the live records into a fresh file (temp file + rename). Every read verifies the
+ * entry's CRC32 before decoding.
+ *
+ * Crash safety: each blob is flushed before its table entry is repointed. The compacted file is
+ * complete and flushed before the old one is deleted; if a crash lands between that delete and the
+ * rename, Open promotes the leftover temp file. A temp file next to an intact region is an
+ * unfinished compaction and is discarded.
+ *
+ * Not thread-safe: one owner (the game thread, or the I/O worker that owns the FVoxelWorldSave).
+ */
+class VOXELCORE_API FVoxelRegionFile
+{
+public:
+	static constexpr int32 RegionSize = 16;
+	static constexpr int32 NumSlots = RegionSize * RegionSize * RegionSize;
+	static constexpr uint32 Magic = uint32('V') | (uint32('X') << 8) | (uint32('R') << 16) | (uint32('G') << 24);
+	static constexpr uint16 FormatVersion = 1;
+
+	/** Bytes before the first record (header + offset table) */
+	static constexpr int64 DataStart = 32 + NumSlots * 16;
+
+	static FIntVector ChunkToRegion(const FIntVector& ChunkCoord);
+
+	/** Slot of a chunk inside its region's offset table */
+	static int32 GetSlotIndex(const FIntVector& ChunkCoord);
+
+	/** "r.X.Y.Z.vxr" */
+	static FString GetRegionFileName(const FIntVector& RegionCoord);
+
+	/** Suffix of the file Compact writes before swapping it in ("r.X.Y.Z.vxr.tmp") */
+	static const TCHAR* GetCompactSuffix() { return TEXT(".tmp"); }
+
+	FVoxelRegionFile(const FString& InPath, const FIntVector& InRegionCoord, int32 InChunkSize);
+	~FVoxelRegionFile();
+
+	/**
+	 * Open the file, creating it (header + empty table) when missing and bCreate is set. First
+	 * settles an interrupted Compact: a missing file is restored from its temp file, a stale temp
+	 * file beside an intact one is deleted.
+	 * Fails on I/O errors and on a header that does not match this region / chunk size.
+	 */
+	bool Open(bool bCreate);
+	bool IsOpen() const { return Handle.IsValid(); }
+	void Close();
+
+	/** Flush buffered writes to the OS */
+	void Flush();
+
+	bool HasChunk(const FIntVector& ChunkCoord) const;
+
+	/** Append the coord of every chunk with a record in this region */
+	void GetChunkCoords(TArray<FIntVector>& OutChunkCoords) const;
+
+	/** On-disk size of a chunk's record blob (0 if absent) */
+	int32 GetChunkBytes(const FIntVector& ChunkCoord) const;
+
+	/** Read and decode a chunk's record. False if absent, on I/O error or on a CRC mismatch. */
+	bool ReadChunk(const FIntVector& ChunkCoord, FVoxelChunkRecord& OutRecord);
+
+	/** Append a record and repoint its table entry. An empty record removes the chunk. */
+	bool WriteChunk(const FVoxelChunkRecord& Record);
+
+	bool RemoveChunk(const FIntVector& ChunkCoord);
+
+	/** Rewrite the file with only the live records. */
+	bool Compact();
+
+	const FString& GetPath() const { return Path; }
+	int32 GetNumChunks() const { return NumChunks; }
+	int64 GetFileBytes() const { return FileBytes; }
+	int64 GetLiveBytes() const { return LiveBytes; }
+	int64 GetDeadBytes() const { return FileBytes - DataStart - LiveBytes; }
+
+	/** Reads rejected by the CRC check over this object's lifetime (survives Compact) */
+	int32 GetCrcFailures() const { return CrcFailures; }
+
+private:
+	struct FSlot
+	{
+		uint64 Offset = 0; // 0 = empty
+		uint32 Size = 0;
+		uint32 Crc = 0;
+	};
+	static_assert(sizeof(FSlot) == 16, "Region table entries are 16 bytes on disk");
+
+	bool WriteHeaderAndTable(IFileHandle& File) const;
+	bool WriteSlot(int32 SlotIndex);
+	bool ReadBlob(const FSlot& Slot, TArray<uint8>& OutBlob);
+
+	FString Path;
+	FIntVector RegionCoord;
+	int32 ChunkSize = VOXEL_DEFAULT_CHUNK_SIZE;
+
+	TArray<FSlot> Slots;
+	TUniquePtr<IFileHandle> Handle;
+
+	int64 FileBytes = 0;
+	int64 LiveBytes = 0;
+	int32 NumChunks = 0;
+	int32 CrcFailures = 0;
+};
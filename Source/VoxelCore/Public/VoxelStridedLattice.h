@@ -0,0 +1,48 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelData.h"
+
+/**
+ * Compact voxel layout for LOD-strided generation.
+ *
+ * The layout keeps, per axis, the multiples of a stride S plus the deep-plane apron
+ * VoxelNeighborSlices::Extract hands to a neighbour at that stride (the first/last S+1 planes) —
+ * lattice ∪ low apron ∪ high apron, sorted — and stores the separable product grid, so a far
+ * chunk holds ~(ChunkSize/S + 2S)^3 voxels instead of ChunkSize^3.
+ *
+ * Expanding back to the full ChunkSize^3 array replicates each stored sample over the voxels up
+ * to the next stored coordinate, so every sampled voxel round-trips exactly; any other voxel is a
+ * copy of a neighbouring sample, not the generated value. Only readers that stay on the lattice
+ * may consume it: the chunk manager generates at half the mesh stride (covering 2:1 finer
+ * neighbours) and only while the meshers run with FVoxelMeshingRequest::bLatticeReads. Gather is
+ * the inverse for a full array produced by Expand (or any full array — it just picks the sampled
+ * coordinates).
+ *
+ * Stateless, thread-safe helpers. Stride 1 is the identity layout (every coordinate sampled).
+ */
+struct VOXELCORE_API FVoxelStridedLattice
+{
+	/** Deep-plane apron kept on each face: stride + 1 planes (VoxelNeighborSlices default depth). */
+	static int32 GetApronDepth(int32 ChunkSize, int32 Stride);
+
+	/** Whether Stride is usable for ChunkSize (power of two, divides ChunkSize, leaves >= 2 cells). */
+	static bool IsValidStride(int32 ChunkSize, int32 Stride);
+
+	/** Sorted local coordinates (0..ChunkSize-1) sampled along one axis. */
+	static void BuildAxisCoords(int32 ChunkSize, int32 Stride, TArray<int32>& OutCoords);
+
+	/** Number of sampled coordinates per axis. */
+	static int32 GetAxisCount(int32 ChunkSize, int32 Stride);
+
+	/** Total voxels in the compact array (GetAxisCount^3). */
+	static int32 GetCompactVoxelCount(int32 ChunkSize, int32 Stride);
+
+	/** Expand a compact array (GetCompactVoxelCount entries) into a full ChunkSize^3 array. */
+	static void Expand(const FVoxelData* Compact, int32 ChunkSize, int32 Stride, TArray<FVoxelData>& OutFull);
+
+	/** Pick the sampled coordinates out of a full ChunkSize^3 array into a compact array. */
+	static void Gather(const TArray<FVoxelData>& Full, int32 ChunkSize, int32 Stride, TArray<FVoxelData>& OutCompact);
+};
@@ -339,6 +339,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "100", ClampMax = "50000"))
 	int32 MaxLoadedChunks = 5000;
 
+	// ==================== Persistence Settings ====================
+
+	/** Save edited chunks to region files as they stream out and load them back before generation.
+	 * Reads and writes run on a background worker (FVoxelChunkPersistence). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Persistence")
+	bool bEnableChunkPersistence = false;
+
+	/** Region-file directory. Relative paths resolve under Saved/VoxelWorlds/. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Persistence", meta = (EditCondition = "bEnableChunkPersistence"))
+	FString PersistenceDirectory = TEXT("Default");
+
 	// ==================== Meshing Settings ====================
 
 	/**
@@ -533,6 +544,9 @@ public:
 	/** Get LOD band for a given distance, returns nullptr if beyond all bands */
 	const FLODBand* GetLODBandForDistance(float Distance) const;
 
+	/** Get the first LOD band with the given LOD level, returns nullptr if none */
+	const FLODBand* GetLODBandForLevel(int32 LODLevel) const;
+
 	/** Get the LOD level for a given distance */
 	int32 GetLODLevelForDistance(float Distance) const;
 
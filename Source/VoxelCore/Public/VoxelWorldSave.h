@@ -0,0 +1,84 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelRegionFile.h"
+
+/** Counters for an FVoxelWorldSave (open regions only for the byte totals). */
+struct FVoxelWorldSaveStats
+{
+	int32 OpenRegions = 0;
+	int32 ChunksRead = 0;
+	int32 ChunksWritten = 0;
+	int64 BytesRead = 0;
+	int64 BytesWritten = 0;
+	int64 LiveBytes = 0;
+	int64 DeadBytes = 0;
+	int32 CrcFailures = 0;
+	int32 Compactions = 0;
+};
+
+/**
+ * Chunk-granular world save: a directory of FVoxelRegionFile region files.
+ *
+ * Chunks are saved and loaded one at a time as they stream, so neither save time nor memory
+ * scales with the size of the whole world. At most MaxOpenRegions region files are kept open
+ * (least recently used is closed first). Regions whose dead space passes a ratio are compacted
+ * on demand (CompactRegions); WriteChunk never compacts on its own.
+ *
+ * Not thread-safe: owned by one thread at a time.
+ */
+class VOXELCORE_API FVoxelWorldSave
+{
+public:
+	FVoxelWorldSave(const FString& InDirectory, int32 InChunkSize, int32 InMaxOpenRegions = 16);
+	~FVoxelWorldSave();
+
+	const FString& GetDirectory() const { return Directory; }
+	int32 GetChunkSize() const { return ChunkSize; }
+
+	/** Persist a chunk record (an empty record removes the chunk). */
+	bool SaveChunk(const FVoxelChunkRecord& Record);
+
+	/** Load a chunk record. False if the chunk was never saved or its record is unreadable. */
+	bool LoadChunk(const FIntVector& ChunkCoord, FVoxelChunkRecord& OutRecord);
+
+	bool HasChunk(const FIntVector& ChunkCoord);
+
+	/**
+	 * Append the coord of every saved chunk in the directory. Opens each region file in turn (only
+	 * its offset table is read), so call it once per session rather than per frame.
+	 */
+	void GetSavedChunkCoords(TArray<FIntVector>& OutChunkCoords);
+	bool RemoveChunk(const FIntVector& ChunkCoord);
+
+	/** Flush every open region */
+	void Flush();
+
+	/** Close every open region (flushing first) */
+	void CloseAll();
+
+	/**
+	 * Compact each open region whose dead bytes exceed MinDeadRatio of its file size.
+	 * @return Number of regions compacted
+	 */
+	int32 CompactRegions(float MinDeadRatio = 0.5f);
+
+	FVoxelWorldSaveStats GetStats() const;
+
+private:
+	/** Open (or create) the region holding ChunkCoord; nullptr if it does not exist and !bCreate */
+	FVoxelRegionFile* GetRegion(const FIntVector& ChunkCoord, bool bCreate);
+
+	FString Directory;
+	int32 ChunkSize = VOXEL_DEFAULT_CHUNK_SIZE;
+	int32 MaxOpenRegions = 16;
+
+	TMap<FIntVector, TUniquePtr<FVoxelRegionFile>> Regions;
+
+	/** Open region coords, least recently used first */
+	TArray<FIntVector> RegionLRU;
+
+	FVoxelWorldSaveStats Stats;
+};
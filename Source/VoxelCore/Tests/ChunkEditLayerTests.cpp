@@ -0,0 +1,249 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelEditTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// FChunkEditLayer storage: a layer switches from sparse to dense 8^3 bricks
+// once its edits fill their bricks (scattered edits stay sparse past
+// DenseThreshold) without changing what it stores, the brick-row merge
+// matches the per-voxel merge rule (including chunk sizes that are not a
+// multiple of 8), and removing every edit releases the bricks.
+// ---------------------------------------------------------------------------
+
+namespace ChunkEditLayerTestUtils
+{
+	/** Deterministic mixed-mode edit for a voxel */
+	FVoxelEdit MakeEdit(const FIntVector& Pos)
+	{
+		switch ((Pos.X + Pos.Y * 3 + Pos.Z * 7) % 4)
+		{
+		case 0:  return FVoxelEdit(Pos, EEditMode::Add, 40 + Pos.X, 5);
+		case 1:  return FVoxelEdit(Pos, EEditMode::Subtract, 90, 0);
+		case 2:  return FVoxelEdit(Pos, EEditMode::Paint, 0, 9);
+		default: return FVoxelEdit(Pos, FVoxelData(3, 200, 1), FVoxelData::Air(), EEditMode::Set);
+		}
+	}
+
+	TArray<FVoxelData> MakeProcedural(int32 ChunkSize)
+	{
+		TArray<FVoxelData> Voxels;
+		Voxels.SetNum(ChunkSize * ChunkSize * ChunkSize);
+		for (int32 i = 0; i < Voxels.Num(); ++i)
+		{
+			Voxels[i] = FVoxelData(1, static_cast<uint8>((i * 37) & 0xFF), 0);
+		}
+		return Voxels;
+	}
+
+	/** Merge through the per-voxel API: the reference the brick merge must reproduce */
+	TArray<FVoxelData> MergePerVoxel(const FChunkEditLayer& Layer, const TArray<FVoxelData>& Procedural)
+	{
+		TArray<FVoxelData> Result = Procedural;
+		for (int32 i = 0; i < Result.Num(); ++i)
+		{
+			Result[i] = Layer.GetMergedVoxel(Layer.GetLocalPosition(i), Procedural[i]);
+		}
+		return Result;
+	}
+
+	bool SameVoxels(const TArray<FVoxelData>& A, const TArray<FVoxelData>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			if (A[i] != B[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FChunkEditLayerDenseSwitchTest,
+	"VoxelWorlds.Edit.Layer.SparseToDenseMerge",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FChunkEditLayerDenseSwitchTest::RunTest(const FString& Parameters)
+{
+	using namespace ChunkEditLayerTestUtils;
+
+	for (const int32 ChunkSize : { 32, 20 })
+	{
+		FChunkEditLayer Layer(FIntVector::ZeroValue, ChunkSize);
+		const TArray<FVoxelData> Procedural = MakeProcedural(ChunkSize);
+
+		// A few scattered edits stay sparse
+		for (int32 i = 0; i < 16; ++i)
+		{
+			Layer.ApplyEdit(MakeEdit(FIntVector(i, (i * 5) % ChunkSize, (i * 11) % ChunkSize)));
+		}
+		TestFalse(TEXT("Few edits stay sparse"), Layer.IsDense());
+
+		TArray<FVoxelData> Merged = Procedural;
+		Layer.ApplyToVoxelData(Merged);
+		TestTrue(TEXT("Sparse merge matches per-voxel merge"), SameVoxels(Merged, MergePerVoxel(Layer, Procedural)));
+
+		// A solid brush-sized block from a brick boundary (including the last, partial brick on odd chunk sizes)
+		const int32 Lo = (ChunkSize / 4) & ~(FVoxelEditBrick::Size - 1);
+		for (int32 Z = Lo; Z < ChunkSize; ++Z)
+		{
+			for (int32 Y = Lo; Y < ChunkSize; ++Y)
+			{
+				for (int32 X = Lo; X < ChunkSize; ++X)
+				{
+					Layer.ApplyEdit(MakeEdit(FIntVector(X, Y, Z)));
+				}
+			}
+		}
+
+		const int32 Side = ChunkSize - Lo;
+		TestTrue(TEXT("Large brush switches to bricks"), Layer.IsDense());
+		TestTrue(TEXT("Edit count survives the switch"), Layer.GetEditCount() >= Side * Side * Side);
+
+		int32 Visited = 0;
+		Layer.ForEachEdit([&Visited](int32, const FVoxelEditDelta&) { ++Visited; });
+		TestEqual(TEXT("ForEachEdit visits every edit"), Visited, Layer.GetEditCount());
+
+		// Records round-trip unchanged
+		const FIntVector Probe(ChunkSize - 1, ChunkSize - 1, ChunkSize - 1);
+		const FVoxelEditDelta* Stored = Layer.GetEdit(Probe);
+		const FVoxelEditDelta Expected(MakeEdit(Probe));
+		TestTrue(TEXT("Corner edit present"), Stored != nullptr);
+		if (Stored)
+		{
+			TestTrue(TEXT("Corner mode"), Stored->EditMode == Expected.EditMode);
+			TestEqual(TEXT("Corner delta"), static_cast<int32>(Stored->DensityDelta), static_cast<int32>(Expected.DensityDelta));
+			TestEqual(TEXT("Corner material"), static_cast<int32>(Stored->BrushMaterialID), static_cast<int32>(Expected.BrushMaterialID));
+		}
+
+		Merged = Procedural;
+		Layer.ApplyToVoxelData(Merged);
+		TestTrue(TEXT("Brick merge matches per-voxel merge"), SameVoxels(Merged, MergePerVoxel(Layer, Procedural)));
+
+		// Brick-aligned block: dense storage is ~8 bytes per edit, well under the old
+		// ~40-byte FVoxelEdit + hash entry per voxel
+		if (ChunkSize % FVoxelEditBrick::Size == 0)
+		{
+			TestTrue(TEXT("Dense layer under 12 bytes per edit"),
+				Layer.GetMemoryUsage() < static_cast<SIZE_T>(Layer.GetEditCount()) * 12);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FChunkEditLayerScatteredTest,
+	"VoxelWorlds.Edit.Layer.ScatteredStaysSparse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FChunkEditLayerScatteredTest::RunTest(const FString& Parameters)
+{
+	using namespace ChunkEditLayerTestUtils;
+
+	constexpr int32 ChunkSize = 32;
+	FChunkEditLayer Layer(FIntVector::ZeroValue, ChunkSize);
+	const TArray<FVoxelData> Procedural = MakeProcedural(ChunkSize);
+
+	// Well past DenseThreshold, but spread over every brick a dozen edits each
+	FRandomStream Random(21);
+	const int32 NumEdits = FChunkEditLayer::DenseThreshold * 2;
+	while (Layer.GetEditCount() < NumEdits)
+	{
+		Layer.ApplyEdit(MakeEdit(FIntVector(Random.RandRange(0, ChunkSize - 1), Random.RandRange(0, ChunkSize - 1), Random.RandRange(0, ChunkSize - 1))));
+	}
+	TestFalse(TEXT("Scattered edits stay sparse"), Layer.IsDense());
+	TestTrue(TEXT("Sparse layer is smaller than one brick per occupied block"),
+		Layer.GetMemoryUsage() < 64 * sizeof(FVoxelEditBrick));
+
+	TArray<FVoxelData> Merged = Procedural;
+	Layer.ApplyToVoxelData(Merged);
+	TestTrue(TEXT("Sparse merge matches per-voxel merge"), SameVoxels(Merged, MergePerVoxel(Layer, Procedural)));
+
+	// Filling the bricks makes them cheaper than the map
+	for (int32 Z = 0; Z < ChunkSize; ++Z)
+	{
+		for (int32 Y = 0; Y < ChunkSize; ++Y)
+		{
+			for (int32 X = 0; X < ChunkSize; ++X)
+			{
+				Layer.ApplyEdit(MakeEdit(FIntVector(X, Y, Z)));
+			}
+		}
+	}
+	TestTrue(TEXT("Filled bricks switch to dense"), Layer.IsDense());
+	TestEqual(TEXT("Every voxel edited"), Layer.GetEditCount(), ChunkSize * ChunkSize * ChunkSize);
+
+	Merged = Procedural;
+	Layer.ApplyToVoxelData(Merged);
+	TestTrue(TEXT("Brick merge matches per-voxel merge"), SameVoxels(Merged, MergePerVoxel(Layer, Procedural)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FChunkEditLayerRemoveTest,
+	"VoxelWorlds.Edit.Layer.RemoveReleasesBricks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FChunkEditLayerRemoveTest::RunTest(const FString& Parameters)
+{
+	using namespace ChunkEditLayerTestUtils;
+
+	constexpr int32 ChunkSize = 32;
+	FChunkEditLayer Layer(FIntVector::ZeroValue, ChunkSize);
+
+	// Two separate 8^3 bricks' worth of edits
+	TArray<FIntVector> Positions;
+	for (int32 Z = 0; Z < 8; ++Z)
+	{
+		for (int32 Y = 0; Y < 8; ++Y)
+		{
+			for (int32 X = 0; X < 8; ++X)
+			{
+				Positions.Add(FIntVector(X, Y, Z));
+				Positions.Add(FIntVector(X + 16, Y + 8, Z + 24));
+			}
+		}
+	}
+	for (const FIntVector& Pos : Positions)
+	{
+		Layer.ApplyEdit(MakeEdit(Pos));
+	}
+	TestTrue(TEXT("Dense"), Layer.IsDense());
+	TestEqual(TEXT("Two bricks"), Layer.GetBrickCount(), 2);
+
+	// Empty the first brick: it is released and the other brick stays addressable
+	for (int32 i = 0; i < Positions.Num(); i += 2)
+	{
+		TestTrue(TEXT("Removed"), Layer.RemoveEdit(Positions[i]));
+	}
+	TestFalse(TEXT("Second remove is a no-op"), Layer.RemoveEdit(Positions[0]));
+	TestEqual(TEXT("One brick left"), Layer.GetBrickCount(), 1);
+	TestNotNull(TEXT("Moved brick still found"), Layer.GetEdit(FIntVector(23, 15, 31)));
+
+	// Mutable lookup edits in place
+	if (FVoxelEditDelta* Edit = Layer.FindEdit(Layer.GetVoxelIndex(FIntVector(16, 8, 24))))
+	{
+		Edit->NewData = FVoxelData(7, 255, 0);
+	}
+	TestEqual(TEXT("In-place edit visible"), static_cast<int32>(Layer.GetEdit(FIntVector(16, 8, 24))->NewData.MaterialID), 7);
+
+	for (int32 i = 1; i < Positions.Num(); i += 2)
+	{
+		Layer.RemoveEdit(Positions[i]);
+	}
+	TestTrue(TEXT("Empty"), Layer.IsEmpty());
+	TestFalse(TEXT("Emptied layer returns to sparse"), Layer.IsDense());
+	TestEqual(TEXT("No bricks"), Layer.GetBrickCount(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,99 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ChunkDescriptor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Shared voxel snapshots (copy-on-write).
+// Exercises FChunkDescriptor::GetSharedVoxelData: publishing without a copy,
+// reads through the published buffer, detach-on-write with and without an
+// outstanding reader, and compression dropping the chunk's reference only.
+// ---------------------------------------------------------------------------
+
+namespace ChunkVoxelSnapshotTestUtils
+{
+	/** A resident 8^3 descriptor with a solid floor (Z < 3) and air above. */
+	static FChunkDescriptor MakeFloor()
+	{
+		FChunkDescriptor D(FIntVector::ZeroValue, 8);
+		D.AllocateVoxelData();
+		for (int32 i = 0; i < D.VoxelData.Num(); ++i)
+		{
+			if (D.GetVoxelPosition(i).Z < 3)
+			{
+				D.VoxelData[i] = FVoxelData::Solid(1);
+			}
+		}
+		return D;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FChunkVoxelSnapshotZeroCopyTest,
+	"VoxelWorlds.Compression.Snapshot.ZeroCopy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FChunkVoxelSnapshotZeroCopyTest::RunTest(const FString& Parameters)
+{
+	using namespace ChunkVoxelSnapshotTestUtils;
+
+	FChunkDescriptor D = MakeFloor();
+	const FVoxelData* RawPtr = D.VoxelData.GetData();
+
+	const TSharedPtr<const TArray<FVoxelData>> A = D.GetSharedVoxelData();
+	TestTrue(TEXT("snapshot published"), A.IsValid());
+	TestTrue(TEXT("published buffer is the resident allocation (no copy)"), A->GetData() == RawPtr);
+	TestTrue(TEXT("repeat calls share one buffer"), D.GetSharedVoxelData() == A);
+	TestTrue(TEXT("still resident while published"), D.IsVoxelDataResident());
+	TestTrue(TEXT("reads go through the published buffer"), D.GetVoxelDataForRead().GetData() == RawPtr);
+	TestTrue(TEXT("point reads see the published data"), D.GetVoxel(FIntVector(1, 1, 1)) == FVoxelData::Solid(1));
+
+	// Write while a reader holds the snapshot: the chunk copies, the reader keeps its version.
+	const uint32 Version = D.ContentVersion;
+	D.SetVoxel(FIntVector(1, 1, 1), FVoxelData::Air());
+	TestTrue(TEXT("write detached the chunk"), !D.SharedVoxelData.IsValid());
+	TestTrue(TEXT("chunk sees the write"), D.GetVoxel(FIntVector(1, 1, 1)) == FVoxelData::Air());
+	TestTrue(TEXT("reader's snapshot is unchanged"), (*A)[D.GetVoxelIndex(FIntVector(1, 1, 1))] == FVoxelData::Solid(1));
+	TestTrue(TEXT("content version bumped"), D.ContentVersion == Version + 1);
+
+	const TSharedPtr<const TArray<FVoxelData>> B = D.GetSharedVoxelData();
+	TestTrue(TEXT("a new version is published after the write"), B.IsValid() && B != A);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FChunkVoxelSnapshotDetachTest,
+	"VoxelWorlds.Compression.Snapshot.SoleOwnerDetach",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FChunkVoxelSnapshotDetachTest::RunTest(const FString& Parameters)
+{
+	using namespace ChunkVoxelSnapshotTestUtils;
+
+	// No outstanding reader: mutable access takes the buffer back without copying.
+	{
+		FChunkDescriptor D = MakeFloor();
+		const FVoxelData* RawPtr = D.GetSharedVoxelData()->GetData();
+		TArray<FVoxelData>& Mut = D.GetVoxelDataMutable();
+		TestTrue(TEXT("sole-owner detach reuses the allocation"), Mut.GetData() == RawPtr);
+		TestTrue(TEXT("detached"), !D.SharedVoxelData.IsValid());
+	}
+
+	// Compression drops the chunk's reference; an in-flight reader keeps the data alive.
+	{
+		FChunkDescriptor D = MakeFloor();
+		const TSharedPtr<const TArray<FVoxelData>> Reader = D.GetSharedVoxelData();
+		TestTrue(TEXT("published chunk compresses"), D.TryCompress(EVoxelChunkCodec::LZ4Planar));
+		TestTrue(TEXT("chunk no longer holds the snapshot"), !D.SharedVoxelData.IsValid() && D.VoxelData.Num() == 0);
+		TestTrue(TEXT("reader keeps a full array"), Reader->Num() == D.GetTotalVoxels());
+
+		const TArray<FVoxelData>& Restored = D.GetVoxelDataForRead();
+		TestTrue(TEXT("decompressed content matches the snapshot"), Restored == *Reader);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,182 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelBrushRasterizer.h"
+#include "VoxelEditManager.h"
+#include "VoxelWorldConfiguration.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Brush rasterizer: the vectorized row evaluation matches the scalar falloff
+// for every shape/falloff, ClipRow never drops a voxel the brush reaches,
+// per-chunk spans tile the brush box exactly, and ApplyBrushEdit through the
+// batched path edits exactly the voxels the scalar reference selects.
+// ---------------------------------------------------------------------------
+
+namespace VoxelBrushRasterizerTestUtils
+{
+	FVoxelBrushParams MakeBrush(EVoxelBrushShape Shape, EVoxelBrushFalloff Falloff, float Radius)
+	{
+		FVoxelBrushParams Brush;
+		Brush.Shape = Shape;
+		Brush.FalloffType = Falloff;
+		Brush.Radius = Radius;
+		Brush.Strength = 0.8f;
+		Brush.DensityDelta = 200;
+		return Brush;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBrushRasterizerRowTest,
+	"VoxelWorlds.Edit.Brush.RowMatchesScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelBrushRasterizerRowTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelBrushRasterizerTestUtils;
+
+	const EVoxelBrushShape Shapes[] = { EVoxelBrushShape::Sphere, EVoxelBrushShape::Cube, EVoxelBrushShape::Cylinder };
+	const EVoxelBrushFalloff Falloffs[] = { EVoxelBrushFalloff::Linear, EVoxelBrushFalloff::Smooth, EVoxelBrushFalloff::Sharp };
+
+	for (const EVoxelBrushShape Shape : Shapes)
+	{
+		for (const EVoxelBrushFalloff Falloff : Falloffs)
+		{
+			// 5.5 voxels: exercises a fractional radius and a row length that is not a multiple of 4
+			const FVoxelBrushRasterizer Rasterizer(MakeBrush(Shape, Falloff, 550.0f), 100.0f);
+			const int32 R = Rasterizer.GetVoxelRadius();
+			TestEqual(TEXT("Voxel radius"), R, 6);
+
+			int32 Mismatches = 0;
+			int32 Dropped = 0;
+			TArray<float> Row;
+			for (int32 DZ = -R; DZ <= R; ++DZ)
+			{
+				for (int32 DY = -R; DY <= R; ++DY)
+				{
+					int32 DXMin = -R;
+					int32 DXMax = R;
+					const bool bRow = Rasterizer.ClipRow(DY, DZ, DXMin, DXMax);
+
+					for (int32 DX = -R; DX <= R; ++DX)
+					{
+						const bool bClipped = !bRow || DX < DXMin || DX > DXMax;
+						if (bClipped && Rasterizer.GetStrength(FIntVector(DX, DY, DZ)) > 0.0f)
+						{
+							++Dropped;
+						}
+					}
+
+					if (!bRow)
+					{
+						continue;
+					}
+
+					const int32 Count = DXMax - DXMin + 1;
+					Row.SetNumZeroed(Align(Count, 4));
+					Rasterizer.RasterizeRow(DY, DZ, DXMin, Count, Row.GetData());
+					for (int32 i = 0; i < Count; ++i)
+					{
+						const float Expected = Rasterizer.GetStrength(FIntVector(DXMin + i, DY, DZ));
+						if (!FMath::IsNearlyEqual(Row[i], Expected, 1.0e-4f))
+						{
+							++Mismatches;
+						}
+					}
+				}
+			}
+
+			TestEqual(FString::Printf(TEXT("Shape %d falloff %d: row strength matches scalar"), (int32)Shape, (int32)Falloff), Mismatches, 0);
+			TestEqual(FString::Printf(TEXT("Shape %d falloff %d: clip keeps every reached voxel"), (int32)Shape, (int32)Falloff), Dropped, 0);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBrushChunkSplitTest,
+	"VoxelWorlds.Edit.Brush.ChunkSplitAndBatchedApply",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelBrushChunkSplitTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelBrushRasterizerTestUtils;
+
+	constexpr int32 ChunkSize = 16;
+	constexpr float VoxelSize = 100.0f;
+	const FVoxelBrushParams Brush = MakeBrush(EVoxelBrushShape::Sphere, EVoxelBrushFalloff::Smooth, 900.0f);
+	const FVoxelBrushRasterizer Rasterizer(Brush, VoxelSize);
+	const int32 R = Rasterizer.GetVoxelRadius();
+
+	// Centre just below a chunk corner on every axis (negative coords included)
+	const FIntVector CenterVoxel(-1, 15, 0);
+	TArray<FVoxelBrushChunkSpan> Spans;
+	Rasterizer.SplitByChunk(CenterVoxel, ChunkSize, Spans);
+	TestEqual(TEXT("Brush box spans 2x2x2 chunks"), Spans.Num(), 8);
+
+	int64 Covered = 0;
+	bool bInRange = true;
+	for (const FVoxelBrushChunkSpan& Span : Spans)
+	{
+		const FIntVector Size = Span.LocalMax - Span.LocalMin + FIntVector(1);
+		Covered += static_cast<int64>(Size.X) * Size.Y * Size.Z;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			bInRange &= Span.LocalMin[Axis] >= 0 && Span.LocalMax[Axis] < ChunkSize;
+		}
+
+		// Offsets map back to the same global voxel
+		const FIntVector Global = Span.ChunkCoord * ChunkSize + Span.LocalMin;
+		bInRange &= (Global - CenterVoxel) == Span.OffsetMin;
+	}
+	const int64 Side = 2 * R + 1;
+	TestEqual(TEXT("Spans tile the brush box exactly"), Covered, Side * Side * Side);
+	TestTrue(TEXT("Span boxes are chunk-local"), bInRange);
+
+	// Scalar reference count for a Subtract stroke
+	int32 Expected = 0;
+	for (int32 DZ = -R; DZ <= R; ++DZ)
+	{
+		for (int32 DY = -R; DY <= R; ++DY)
+		{
+			for (int32 DX = -R; DX <= R; ++DX)
+			{
+				const float Strength = Rasterizer.GetStrength(FIntVector(DX, DY, DZ));
+				if (Strength >= 0.01f && FMath::RoundToInt(Brush.DensityDelta * Strength) >= 1)
+				{
+					++Expected;
+				}
+			}
+		}
+	}
+
+	UVoxelWorldConfiguration* Config = NewObject<UVoxelWorldConfiguration>();
+	Config->ChunkSize = ChunkSize;
+	Config->VoxelSize = VoxelSize;
+
+	UVoxelEditManager* EditManager = NewObject<UVoxelEditManager>();
+	EditManager->AddToRoot();
+	EditManager->Initialize(Config);
+
+	int32 Broadcasts = 0;
+	EditManager->OnChunkEdited.AddLambda([&Broadcasts](const FIntVector&, EEditSource, const FVector&, float) { ++Broadcasts; });
+
+	const FVector BrushCenter = Config->WorldOrigin + (FVector(CenterVoxel) + FVector(0.5f)) * VoxelSize;
+	const int32 Modified = EditManager->ApplyBrushEdit(BrushCenter, Brush, EEditMode::Subtract);
+	TestEqual(TEXT("Batched brush edits exactly the scalar selection"), Modified, Expected);
+	TestEqual(TEXT("Total edits stored"), EditManager->GetTotalEditCount(), Expected);
+	TestEqual(TEXT("One broadcast per affected chunk"), Broadcasts, EditManager->GetEditedChunkCount());
+
+	// A second identical stroke accumulates into the same voxels, and undo reverts it as one step
+	EditManager->ApplyBrushEdit(BrushCenter, Brush, EEditMode::Subtract);
+	TestEqual(TEXT("Second stroke accumulates in place"), EditManager->GetTotalEditCount(), Expected);
+	TestTrue(TEXT("Undo"), EditManager->Undo());
+
+	EditManager->Shutdown();
+	EditManager->RemoveFromRoot();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,7 @@
 #include "Misc/AutomationTest.h"
 #include "VoxelChunkCodec.h"
 #include "ChunkDescriptor.h"
+#include "VoxelStridedLattice.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -183,4 +184,233 @@ bool FVoxelChunkCodecDescriptorTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkCodecAsyncCompactionTest,
+	"VoxelWorlds.Compression.Codec.AsyncCompaction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkCodecAsyncCompactionTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkCodecTestUtils;
+	const int32 CS = 32;
+	const TArray<FVoxelData> Original = MakeTerrainChunk(CS);
+
+	// Unchanged chunk: the worker's buffer is swapped in and decodes losslessly.
+	{
+		FChunkDescriptor D(FIntVector::ZeroValue, CS);
+		D.SetResidentVoxelData(TArray<FVoxelData>(Original));
+
+		FVoxelAsyncCompaction Job;
+		TestTrue(TEXT("compaction starts on a resident chunk"), D.BeginAsyncCompaction(Job));
+		FChunkDescriptor::EncodeAsyncCompaction(Job, EVoxelChunkCodec::LZ4);
+		TestFalse(TEXT("terrain chunk is not uniform"), Job.bUniform);
+		TestTrue(TEXT("worker produced a buffer"), Job.Buffer.Num() > 0);
+
+		TestTrue(TEXT("unchanged chunk accepts the result"), D.ApplyAsyncCompaction(MoveTemp(Job)));
+		TestEqual(TEXT("residency is Compressed"), (int32)D.Residency, (int32)EVoxelDataResidency::Compressed);
+		TestTrue(TEXT("lossless after async compaction"), D.EnsureResident() == Original);
+	}
+
+	// A write after launch detaches the snapshot: the stale result is refused and the write survives.
+	{
+		FChunkDescriptor D(FIntVector::ZeroValue, CS);
+		D.SetResidentVoxelData(TArray<FVoxelData>(Original));
+
+		FVoxelAsyncCompaction Job;
+		D.BeginAsyncCompaction(Job);
+		D.GetVoxelDataMutable()[0] = FVoxelData::Solid(9, 4); // no ContentVersion bump, still detaches
+		FChunkDescriptor::EncodeAsyncCompaction(Job, EVoxelChunkCodec::LZ4);
+
+		TestFalse(TEXT("stale result is not current"), D.IsAsyncCompactionCurrent(Job));
+		TestFalse(TEXT("stale result refused"), D.ApplyAsyncCompaction(MoveTemp(Job)));
+		TestEqual(TEXT("stays Resident"), (int32)D.Residency, (int32)EVoxelDataResidency::Resident);
+		TestTrue(TEXT("write preserved"), D.GetVoxel(FIntVector(0, 0, 0)) == FVoxelData::Solid(9, 4));
+	}
+
+	// Uniform chunks collapse through the async path too.
+	{
+		FChunkDescriptor D(FIntVector::ZeroValue, CS);
+		D.AllocateVoxelData();
+
+		FVoxelAsyncCompaction Job;
+		D.BeginAsyncCompaction(Job);
+		FChunkDescriptor::EncodeAsyncCompaction(Job, EVoxelChunkCodec::LZ4);
+		TestTrue(TEXT("all-air detected on the worker"), Job.bUniform);
+		TestTrue(TEXT("uniform result applied"), D.ApplyAsyncCompaction(MoveTemp(Job)));
+		TestEqual(TEXT("residency is Uniform"), (int32)D.Residency, (int32)EVoxelDataResidency::Uniform);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkCodecAsyncExpansionTest,
+	"VoxelWorlds.Compression.Codec.AsyncExpansion",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkCodecAsyncExpansionTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkCodecTestUtils;
+	const int32 CS = 32;
+	const TArray<FVoxelData> Original = MakeTerrainChunk(CS);
+
+	FChunkDescriptor D(FIntVector::ZeroValue, CS);
+	D.SetResidentVoxelData(TArray<FVoxelData>(Original));
+	TestTrue(TEXT("compress"), D.TryCompress(EVoxelChunkCodec::LZ4));
+
+	// Unchanged compressed chunk: the decoded array is installed and the buffer stays cached.
+	FVoxelAsyncExpansion Job;
+	TestTrue(TEXT("expansion starts on a compressed chunk"), D.BeginAsyncExpansion(Job));
+	FChunkDescriptor::DecodeAsyncExpansion(Job);
+	TestTrue(TEXT("expansion applied"), D.ApplyAsyncExpansion(MoveTemp(Job)));
+	TestEqual(TEXT("residency is Resident"), (int32)D.Residency, (int32)EVoxelDataResidency::Resident);
+	TestTrue(TEXT("expanded content matches"), D.GetVoxelDataForRead() == Original);
+	TestTrue(TEXT("buffer cached for a free re-compress"), D.CompressedVoxelData.Num() > 0);
+
+	// Re-encoded at the same ContentVersion after a non-versioned write: the old bytes are refused.
+	TestTrue(TEXT("free re-compress"), D.TryCompress(EVoxelChunkCodec::LZ4));
+	FVoxelAsyncExpansion StaleJob;
+	D.BeginAsyncExpansion(StaleJob);
+	D.GetVoxelDataMutable()[0] = FVoxelData::Solid(9, 4);
+	TestTrue(TEXT("re-compress after the write"), D.TryCompress(EVoxelChunkCodec::LZ4));
+	FChunkDescriptor::DecodeAsyncExpansion(StaleJob);
+	TestFalse(TEXT("stale expansion refused"), D.ApplyAsyncExpansion(MoveTemp(StaleJob)));
+	TestTrue(TEXT("write preserved"), D.GetVoxelResident(FIntVector(0, 0, 0)) == FVoxelData::Solid(9, 4));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkCodecPreExpansionHoldTest,
+	"VoxelWorlds.Compression.Codec.PreExpansionHold",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkCodecPreExpansionHoldTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkCodecTestUtils;
+	const int32 CS = 32;
+	const int64 HoldFrames = 180;
+	const int64 LoadedFrame = 10;	// settled long before the predicted refine
+	int64 Frame = 1000;
+
+	FChunkDescriptor D(FIntVector::ZeroValue, CS);
+	D.SetResidentVoxelData(MakeTerrainChunk(CS));
+	TestTrue(TEXT("compress"), D.TryCompress(EVoxelChunkCodec::LZ4));
+
+	// One tick in the order the chunk manager runs it: apply the finished expansion, then the sweep,
+	// which re-applies a cached compact form only when the chunk isn't held.
+	auto SweepStep = [&D, HoldFrames](int64 Now, int64 LastStateChangeFrame)
+	{
+		if (!D.IsPreExpansionHeld(Now, LastStateChangeFrame, HoldFrames))
+		{
+			D.PreExpandedFrame = INDEX_NONE;
+			D.TryCompress(EVoxelChunkCodec::LZ4);
+		}
+	};
+
+	FVoxelAsyncExpansion Job;
+	D.BeginAsyncExpansion(Job);
+	FChunkDescriptor::DecodeAsyncExpansion(Job);
+	TestTrue(TEXT("expansion applied"), D.ApplyAsyncExpansion(MoveTemp(Job), Frame));
+	SweepStep(Frame, LoadedFrame);
+	TestEqual(TEXT("still Resident after the same tick's sweep"), (int32)D.Residency, (int32)EVoxelDataResidency::Resident);
+	SweepStep(Frame + HoldFrames - 1, LoadedFrame);
+	TestEqual(TEXT("still Resident within the hold"), (int32)D.Residency, (int32)EVoxelDataResidency::Resident);
+
+	// The refine remesh started (state change after the expansion): the hold ends.
+	TestFalse(TEXT("hold released by the remesh"), D.IsPreExpansionHeld(Frame + 1, Frame + 1, HoldFrames));
+
+	// A predicted refine that never happened: the hold lapses and the free re-apply resumes.
+	SweepStep(Frame + HoldFrames, LoadedFrame);
+	TestEqual(TEXT("re-compressed after the hold lapses"), (int32)D.Residency, (int32)EVoxelDataResidency::Compressed);
+	TestEqual(TEXT("hold cleared"), D.PreExpandedFrame, (int64)INDEX_NONE);
+
+	// An expansion by access (EnsureResident) is not held.
+	D.EnsureResident();
+	TestFalse(TEXT("access expansion not held"), D.IsPreExpansionHeld(Frame + HoldFrames, LoadedFrame, HoldFrames));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkCodecStridedTest,
+	"VoxelWorlds.Compression.Codec.StridedLattice",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkCodecStridedTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkCodecTestUtils;
+	const int32 CS = 32;
+	const TArray<FVoxelData> Full = MakeFlaggedChunk(CS);
+
+	// Stride 1 is the identity layout.
+	TestEqual(TEXT("stride 1 keeps every voxel"), FVoxelStridedLattice::GetCompactVoxelCount(CS, 1), CS * CS * CS);
+	TestFalse(TEXT("non power-of-two stride rejected"), FVoxelStridedLattice::IsValidStride(CS, 3));
+	TestFalse(TEXT("stride leaving < 2 cells rejected"), FVoxelStridedLattice::IsValidStride(CS, CS));
+
+	for (const int32 Stride : { 2, 4, 8 })
+	{
+		TArray<int32> Coords;
+		FVoxelStridedLattice::BuildAxisCoords(CS, Stride, Coords);
+		const int32 Apron = FVoxelStridedLattice::GetApronDepth(CS, Stride);
+
+		// Every lattice coordinate and every apron plane is sampled.
+		bool bCoversReads = true;
+		for (int32 C = 0; C < CS; ++C)
+		{
+			if ((C % Stride == 0 || C < Apron || C >= CS - Apron) && !Coords.Contains(C))
+			{
+				bCoversReads = false;
+			}
+		}
+		TestTrue(FString::Printf(TEXT("stride %d covers lattice + apron"), Stride), bCoversReads);
+
+		const int32 CompactCount = FVoxelStridedLattice::GetCompactVoxelCount(CS, Stride);
+		TestTrue(FString::Printf(TEXT("stride %d compact is smaller than full"), Stride), CompactCount < CS * CS * CS);
+
+		// Gather -> Strided buffer -> Decompress: sampled voxels round-trip exactly, the rest replicate.
+		TArray<FVoxelData> Compact;
+		FVoxelStridedLattice::Gather(Full, CS, Stride, Compact);
+		TestEqual(FString::Printf(TEXT("stride %d compact size"), Stride), Compact.Num(), CompactCount);
+
+		TArray<uint8> Buffer;
+		TestTrue(FString::Printf(TEXT("stride %d encodes"), Stride), FVoxelChunkCodec::EncodeStrided(Compact, CS, Stride, Buffer));
+		TestEqual(FString::Printf(TEXT("stride %d recorded in header"), Stride), FVoxelChunkCodec::GetBufferStride(Buffer), Stride);
+
+		TArray<FVoxelData> Expanded;
+		TestTrue(FString::Printf(TEXT("stride %d decodes"), Stride), FVoxelChunkCodec::Decompress(Buffer, Expanded));
+		TestEqual(FString::Printf(TEXT("stride %d expands to full size"), Stride), Expanded.Num(), CS * CS * CS);
+
+		bool bSamplesExact = true;
+		for (const int32 Z : Coords)
+		{
+			for (const int32 Y : Coords)
+			{
+				for (const int32 X : Coords)
+				{
+					const int32 Index = X + Y * CS + Z * CS * CS;
+					bSamplesExact &= Expanded[Index] == Full[Index];
+				}
+			}
+		}
+		TestTrue(FString::Printf(TEXT("stride %d sampled voxels exact"), Stride), bSamplesExact);
+
+		TArray<FVoxelData> Regathered;
+		FVoxelStridedLattice::Gather(Expanded, CS, Stride, Regathered);
+		TestTrue(FString::Printf(TEXT("stride %d gather(expand) is identity"), Stride), Regathered == Compact);
+
+		// Descriptor: strided payload lands in the Compressed tier and expands on access.
+		FChunkDescriptor D(FIntVector::ZeroValue, CS);
+		TestTrue(FString::Printf(TEXT("stride %d installs"), Stride), D.SetStridedVoxelData(CopyTemp(Compact), Stride));
+		TestEqual(TEXT("strided payload is Compressed"), (int32)D.Residency, (int32)EVoxelDataResidency::Compressed);
+		TestEqual(TEXT("descriptor records stride"), D.GenerationStride, Stride);
+		TestTrue(TEXT("same mesh stride needs regeneration"), D.NeedsRegenerationForStride(Stride));
+		TestFalse(TEXT("twice the stride does not"), D.NeedsRegenerationForStride(Stride * 2));
+		TestTrue(TEXT("descriptor expands to the decoded payload"), D.EnsureResident() == Expanded);
+		TestTrue(TEXT("free re-compress to the strided buffer"), D.TryCompress(EVoxelChunkCodec::OodlePlanar));
+
+		TArray<FVoxelData> Truncated = Compact;
+		Truncated.Pop();
+		TestFalse(TEXT("mismatched compact size rejected"), FVoxelChunkCodec::EncodeStrided(Truncated, CS, Stride, Buffer));
+	}
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,170 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelChunkCullingSet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Flat chunk culling set (FVoxelChunkCullingSet).
+// The SIMD lane test must report exactly the chunks a per-box
+// FConvexVolume::IntersectBox-style test keeps, with or without coarse cells,
+// through arbitrary add / replace / remove churn (swap-removes must keep every
+// coord reachable); off-screen cells must be rejected whole.
+// ---------------------------------------------------------------------------
+
+namespace VoxelChunkCullingSetTestUtils
+{
+	constexpr double ChunkWorldSize = 3200.0;
+
+	static FBox ChunkBox(const FIntVector& Coord)
+	{
+		const FVector Min = FVector(Coord) * ChunkWorldSize;
+		return FBox(Min, Min + FVector(ChunkWorldSize));
+	}
+
+	/** An axis-aligned view box plus one diagonal plane (outward normals, FConvexVolume convention) */
+	static TArray<FPlane> MakePlanes(double HalfSize)
+	{
+		TArray<FPlane> Planes;
+		Planes.Add(FPlane(FVector(1, 0, 0), HalfSize + 50.0));
+		Planes.Add(FPlane(FVector(-1, 0, 0), HalfSize + 50.0));
+		Planes.Add(FPlane(FVector(0, 1, 0), HalfSize + 50.0));
+		Planes.Add(FPlane(FVector(0, -1, 0), HalfSize + 50.0));
+		Planes.Add(FPlane(FVector(0, 0, 1), HalfSize + 50.0));
+		Planes.Add(FPlane(FVector(0, 0, -1), HalfSize + 50.0));
+		Planes.Add(FPlane(FVector(1, 1, 0).GetSafeNormal(), HalfSize * 0.5 + 123.4));
+		return Planes;
+	}
+
+	static bool ReferenceIntersects(TConstArrayView<FPlane> Planes, const FBox& Box)
+	{
+		for (const FPlane& Plane : Planes)
+		{
+			const FVector Extent = Box.GetExtent();
+			const double PushOut = FMath::Abs(Plane.X * Extent.X) + FMath::Abs(Plane.Y * Extent.Y) + FMath::Abs(Plane.Z * Extent.Z);
+			if (Plane.PlaneDot(Box.GetCenter()) > PushOut)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Compare Cull against the reference over the live chunk map; returns the number of disagreements */
+	static int32 CountMismatches(const FVoxelChunkCullingSet& Set, const TMap<FIntVector, FBox>& Live, TConstArrayView<FPlane> Planes)
+	{
+		TArray<FIntVector> Visible;
+		Set.Cull(Planes, Visible);
+		TSet<FIntVector> VisibleSet(Visible);
+
+		int32 Mismatches = VisibleSet.Num() != Visible.Num() ? 1 : 0; // duplicates
+		for (const auto& Pair : Live)
+		{
+			Mismatches += ReferenceIntersects(Planes, Pair.Value) != VisibleSet.Contains(Pair.Key);
+		}
+		for (const FIntVector& Coord : Visible)
+		{
+			Mismatches += !Live.Contains(Coord);
+		}
+		return Mismatches;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkCullingSetMatchesReferenceTest,
+	"VoxelWorlds.Core.ChunkCulling.MatchesReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkCullingSetMatchesReferenceTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkCullingSetTestUtils;
+
+	const TArray<FPlane> Planes = MakePlanes(8.0 * ChunkWorldSize);
+
+	for (const int32 CellSize : { 0, 1, 4, 8 })
+	{
+		FVoxelChunkCullingSet Set(CellSize);
+		TMap<FIntVector, FBox> Live;
+		FRandomStream Rng(CellSize + 17);
+
+		for (int32 Step = 0; Step < 6000; ++Step)
+		{
+			const FIntVector Coord(Rng.RandRange(-20, 20), Rng.RandRange(-20, 20), Rng.RandRange(-3, 3));
+			if (Rng.FRand() < 0.35f)
+			{
+				Set.Remove(Coord);
+				Live.Remove(Coord);
+			}
+			else
+			{
+				// Partial-height chunks so replacements change bounds in place
+				FBox Box = ChunkBox(Coord);
+				Box.Max.Z -= Rng.RandRange(0, 30) * 100.0;
+				Set.Update(Coord, Box);
+				Live.Add(Coord, Box);
+			}
+		}
+
+		TestEqual(FString::Printf(TEXT("cell %d: count tracks the live map"), CellSize), Set.Num(), Live.Num());
+		TestEqual(FString::Printf(TEXT("cell %d: culling matches the per-box test"), CellSize), CountMismatches(Set, Live, Planes), 0);
+
+		// Drain through Remove: every coord must still be reachable after the swap-removes
+		for (const auto& Pair : Live)
+		{
+			TestTrue(TEXT("live coord present"), Set.Contains(Pair.Key));
+			Set.Remove(Pair.Key);
+		}
+		TestEqual(FString::Printf(TEXT("cell %d: empty after draining"), CellSize), Set.Num(), 0);
+		TestEqual(FString::Printf(TEXT("cell %d: emptied cells are released"), CellSize), Set.GetNumCells(), 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkCullingSetCellRejectionTest,
+	"VoxelWorlds.Core.ChunkCulling.CellRejection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkCullingSetCellRejectionTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkCullingSetTestUtils;
+
+	// 32x32 columns of 4 chunks, 8x8-column cells; the view box covers the cells around the origin
+	FVoxelChunkCullingSet Set(8);
+	for (int32 X = -16; X < 16; ++X)
+	{
+		for (int32 Y = -16; Y < 16; ++Y)
+		{
+			for (int32 Z = 0; Z < 4; ++Z)
+			{
+				Set.Update(FIntVector(X, Y, Z), ChunkBox(FIntVector(X, Y, Z)));
+			}
+		}
+	}
+	TestEqual(TEXT("16 cells"), Set.GetNumCells(), 16);
+
+	TArray<FPlane> Planes = MakePlanes(4.0 * ChunkWorldSize);
+	Planes.Pop(); // drop the diagonal so the expected counts are simple
+
+	TArray<FIntVector> Visible;
+	FVoxelChunkCullingStats Stats;
+	Set.Cull(Planes, Visible, &Stats);
+	TestEqual(TEXT("all cells tested"), Stats.CellsTested, 16);
+	TestEqual(TEXT("only the four cells around the origin survive"), Stats.CellsRejected, 12);
+	TestEqual(TEXT("only surviving cells' chunks are tested"), Stats.ChunksTested, 4 * 8 * 8 * 4);
+	TestEqual(TEXT("visible chunks reported"), Stats.ChunksVisible, Visible.Num());
+
+	// Chunk at X in [-5, 4] overlaps [-4.0x - 50, 4.0x + 50]: 10 x 10 columns, all 4 levels
+	TestEqual(TEXT("visible chunk count"), Visible.Num(), 10 * 10 * 4);
+
+	// Invalid bounds are never culled, even far away
+	Set.Update(FIntVector(500, 500, 0), FBox(ForceInit));
+	Visible.Reset();
+	Set.Cull(Planes, Visible);
+	TestTrue(TEXT("unbounded chunk always visible"), Visible.Contains(FIntVector(500, 500, 0)));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,164 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelChunkPriorityQueue.h"
+#include "LODTypes.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Reverse.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VoxelChunkPriorityQueueTestUtils
+{
+	/** Drain the queue, returning the pop order. */
+	static TArray<FChunkLODRequest> Drain(TVoxelChunkPriorityQueue<FChunkLODRequest>& Queue)
+	{
+		TArray<FChunkLODRequest> Out;
+		while (!Queue.IsEmpty())
+		{
+			Out.Add(Queue.Pop());
+		}
+		return Out;
+	}
+
+	/** Pop order of the sorted-TArray queue this replaces: LowerBound insert, pop from the back. */
+	static TArray<FChunkLODRequest> ReferenceOrder(const TArray<FChunkLODRequest>& Pushed)
+	{
+		TArray<FChunkLODRequest> Sorted;
+		for (const FChunkLODRequest& Request : Pushed)
+		{
+			Sorted.Insert(Request, Algo::LowerBound(Sorted, Request));
+		}
+		Algo::Reverse(Sorted);
+		return Sorted;
+	}
+
+	static bool SameOrder(const TArray<FChunkLODRequest>& A, const TArray<FChunkLODRequest>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			if (A[i].ChunkCoord != B[i].ChunkCoord)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkPriorityQueueOrderTest,
+	"VoxelWorlds.Streaming.PriorityQueue.Order",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkPriorityQueueOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkPriorityQueueTestUtils;
+
+	// Pseudo-random priorities with plenty of ties, so insertion-order tie-breaking is exercised.
+	TArray<FChunkLODRequest> Pushed;
+	FRandomStream Rng(1234);
+	for (int32 i = 0; i < 500; ++i)
+	{
+		Pushed.Add(FChunkLODRequest(FIntVector(i, i % 7, -i), 0, static_cast<float>(Rng.RandRange(0, 40))));
+	}
+
+	TVoxelChunkPriorityQueue<FChunkLODRequest> Queue;
+	for (const FChunkLODRequest& Request : Pushed)
+	{
+		TestTrue(TEXT("Push new chunk"), Queue.Push(Request));
+	}
+	TestFalse(TEXT("Duplicate chunk rejected"), Queue.Push(Pushed[10]));
+	TestEqual(TEXT("Num"), Queue.Num(), Pushed.Num());
+	TestTrue(TEXT("Contains"), Queue.Contains(Pushed[42].ChunkCoord));
+
+	// Remove a handful, from the root, the middle, and the tail of the heap.
+	TArray<FChunkLODRequest> Remaining = Pushed;
+	for (const int32 Victim : { 0, 17, 250, 499 })
+	{
+		TestTrue(TEXT("Remove queued chunk"), Queue.Remove(Pushed[Victim].ChunkCoord));
+		Remaining.RemoveAll([&](const FChunkLODRequest& R) { return R.ChunkCoord == Pushed[Victim].ChunkCoord; });
+	}
+	TestFalse(TEXT("Remove missing chunk"), Queue.Remove(FIntVector(9999, 0, 0)));
+	TestFalse(TEXT("Removed chunk gone"), Queue.Contains(Pushed[17].ChunkCoord));
+
+	// ForEachTop walks the head in pop order without popping
+	const TArray<FChunkLODRequest> Expected = ReferenceOrder(Remaining);
+	TArray<FChunkLODRequest> Head;
+	Queue.ForEachTop(50, [&Head](const FChunkLODRequest& Request) { Head.Add(Request); return true; });
+	TestTrue(TEXT("ForEachTop visits the head in pop order"), SameOrder(Head, TArray<FChunkLODRequest>(Expected.GetData(), 50)));
+	TestEqual(TEXT("ForEachTop leaves the queue intact"), Queue.Num(), Remaining.Num());
+
+	TestTrue(TEXT("Pop order matches the sorted-array queue (incl. tie order)"),
+		SameOrder(Drain(Queue), Expected));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkPriorityQueueRekeyTest,
+	"VoxelWorlds.Streaming.PriorityQueue.Rekey",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkPriorityQueueRekeyTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkPriorityQueueTestUtils;
+
+	for (const bool bBulk : { false, true })
+	{
+		TVoxelChunkPriorityQueue<FChunkLODRequest> Queue;
+		TArray<FChunkLODRequest> Reference;
+		for (int32 i = 0; i < 256; ++i)
+		{
+			const FChunkLODRequest Request(FIntVector(i, 0, 0), 0, static_cast<float>((i * 37) % 101));
+			Queue.Push(Request);
+			Reference.Add(Request);
+		}
+
+		// Few changes take the incremental path, most-changed takes the rebuild path.
+		const int32 Modulus = bBulk ? 2 : 50;
+		const auto Stats = Queue.Reprioritize([Modulus](FChunkLODRequest& Request)
+		{
+			if (Request.ChunkCoord.X % 97 == 5)
+			{
+				return EVoxelQueueReprioritize::Remove;
+			}
+			if (Request.ChunkCoord.X % Modulus == 0)
+			{
+				Request.Priority = 200.0f - Request.Priority;
+			}
+			return EVoxelQueueReprioritize::Keep;
+		});
+		for (FChunkLODRequest& Request : Reference)
+		{
+			if (Request.ChunkCoord.X % Modulus == 0)
+			{
+				Request.Priority = 200.0f - Request.Priority;
+			}
+		}
+		Reference.RemoveAll([](const FChunkLODRequest& R) { return R.ChunkCoord.X % 97 == 5; });
+
+		TestEqual(TEXT("Removed count"), Stats.Removed, 3);
+		TestTrue(TEXT("Bulk path taken only for many changes"), Stats.bRebuilt == bBulk);
+
+		// Single increase-key via Modify.
+		Queue.Modify(FIntVector(7, 0, 0), [](FChunkLODRequest& Request) { Request.Priority = 1000.0f; });
+		Reference.FindByPredicate([](const FChunkLODRequest& R) { return R.ChunkCoord.X == 7; })->Priority = 1000.0f;
+		TestTrue(TEXT("Increase-key moves to top"), Queue.Top().ChunkCoord == FIntVector(7, 0, 0));
+
+		// Priorities must come out non-increasing and match the reference multiset.
+		const TArray<FChunkLODRequest> Order = Drain(Queue);
+		bool bSorted = true;
+		for (int32 i = 1; i < Order.Num(); ++i)
+		{
+			bSorted &= Order[i - 1].Priority >= Order[i].Priority;
+		}
+		TestTrue(bBulk ? TEXT("Rebuilt heap pops in priority order") : TEXT("Re-keyed heap pops in priority order"), bSorted);
+		TestEqual(TEXT("All kept elements popped"), Order.Num(), Reference.Num());
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,167 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelCompactVertex.h"
+#include "ChunkRenderData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Compact chunk vertices (FVoxelCompactVertex).
+// Smooth-mesher style meshes (triplanar UVs) must encode and decode to within
+// one lattice step / the UV tolerance with packed words identical to the
+// FVoxelVertex path; boundary vertices of neighbouring chunks must land on
+// the same world point; per-quad (cubic) UVs and out-of-range positions must
+// be rejected so the caller falls back.
+// ---------------------------------------------------------------------------
+
+namespace VoxelCompactVertexTestUtils
+{
+	constexpr float VoxelSize = 100.0f;
+	constexpr float ChunkWorldSize = 32.0f * VoxelSize;
+	constexpr float UVScale = 0.5f;
+
+	/** Triplanar UV as the DC / MC meshers emit it */
+	static FVector2f TriplanarUV(const FVector3f& P, const FVector3f& N)
+	{
+		const float AbsX = FMath::Abs(N.X);
+		const float AbsY = FMath::Abs(N.Y);
+		const float AbsZ = FMath::Abs(N.Z);
+		if (AbsZ >= AbsX && AbsZ >= AbsY)
+		{
+			return FVector2f(P.X * UVScale / VoxelSize, P.Y * UVScale / VoxelSize);
+		}
+		if (AbsX >= AbsY)
+		{
+			return FVector2f(P.Y * UVScale / VoxelSize, P.Z * UVScale / VoxelSize);
+		}
+		return FVector2f(P.X * UVScale / VoxelSize, P.Z * UVScale / VoxelSize);
+	}
+
+	/** Sphere surface points centred in the chunk, with a skirt ring poking below the chunk floor */
+	static FChunkMeshData MakeSmoothMesh()
+	{
+		FChunkMeshData Mesh;
+		const FVector3f Center(ChunkWorldSize * 0.5f);
+		for (int32 i = 0; i < 500; ++i)
+		{
+			const float Theta = i * 0.61f;
+			const float Phi = FMath::Acos(1.0f - 2.0f * (i + 0.5f) / 500.0f);
+			const FVector3f N(FMath::Sin(Phi) * FMath::Cos(Theta), FMath::Sin(Phi) * FMath::Sin(Theta), FMath::Cos(Phi));
+			const FVector3f P = (i % 50 == 0) ? FVector3f(i * 3.1f, 17.3f, -120.0f) : Center + N * 1234.5f;
+			Mesh.Positions.Add(P);
+			Mesh.Normals.Add(N);
+			Mesh.UVs.Add(TriplanarUV(P, N));
+			Mesh.Colors.Add(FColor(static_cast<uint8>(i % 7), static_cast<uint8>(i % 3), static_cast<uint8>((i % 4) << 6), 255));
+		}
+		for (int32 i = 0; i + 2 < Mesh.Positions.Num(); i += 3)
+		{
+			Mesh.Indices.Append({ static_cast<uint32>(i), static_cast<uint32>(i + 1), static_cast<uint32>(i + 2) });
+		}
+		return Mesh;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelCompactVertexRoundTripTest,
+	"VoxelWorlds.Core.CompactVertex.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelCompactVertexRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelCompactVertexTestUtils;
+
+	const FChunkMeshData Mesh = MakeSmoothMesh();
+	TArray<FVoxelCompactVertex> Compact;
+	FVoxelCompactVertexFrame Frame;
+	FBox Bounds;
+	if (!TestTrue(TEXT("smooth mesh encodes"), FVoxelCompactVertexCodec::Encode(Mesh, ChunkWorldSize, Compact, Frame, Bounds)))
+	{
+		return false;
+	}
+	TestEqual(TEXT("one compact vertex per source vertex"), Compact.Num(), Mesh.Positions.Num());
+	TestTrue(TEXT("UV density recovered"), FMath::IsNearlyEqual(Frame.UVPerUnit, UVScale / VoxelSize, 1.0e-4f));
+
+	int32 BadPositions = 0, BadUVs = 0, BadWords = 0;
+	FBox ExpectedBounds(ForceInit);
+	for (int32 i = 0; i < Mesh.Positions.Num(); ++i)
+	{
+		ExpectedBounds += FVector(Mesh.Positions[i]);
+		const FVoxelVertex Decoded = Frame.Decode(Compact[i]);
+
+		FVoxelVertex Expected;
+		Expected.SetNormal(Mesh.Normals[i]);
+		Expected.SetMaterialID(Mesh.Colors[i].R);
+		Expected.SetBiomeID(Mesh.Colors[i].G);
+		Expected.SetAO(Mesh.Colors[i].B >> 6);
+		BadPositions += (Decoded.Position - Mesh.Positions[i]).GetAbsMax() > Frame.PositionStep * 0.5f + KINDA_SMALL_NUMBER;
+		BadUVs += (Decoded.UV - Mesh.UVs[i]).GetAbsMax() > FVoxelCompactVertexFrame::UVTolerance;
+		BadWords += Decoded.PackedNormalAndAO != Expected.PackedNormalAndAO || Decoded.PackedMaterialData != Expected.PackedMaterialData;
+	}
+	TestEqual(TEXT("positions within half a lattice step"), BadPositions, 0);
+	TestEqual(TEXT("derived UVs within tolerance"), BadUVs, 0);
+	TestEqual(TEXT("packed normal/material words match FVoxelVertex"), BadWords, 0);
+	TestTrue(TEXT("bounds from unquantized positions"), Bounds.Equals(ExpectedBounds));
+
+	// A vertex on the shared face decodes to the same world point from both chunks
+	FChunkMeshData Left, Right;
+	const FVector3f Normal(1.0f, 0.0f, 0.0f);
+	const FVector3f OnFaceLeft(ChunkWorldSize, 1234.567f, 89.01f);
+	const FVector3f OnFaceRight(0.0f, 1234.567f, 89.01f);
+	Left.Positions.Add(OnFaceLeft);
+	Left.Normals.Add(Normal);
+	Left.UVs.Add(TriplanarUV(OnFaceLeft, Normal));
+	Right.Positions.Add(OnFaceRight);
+	Right.Normals.Add(Normal);
+	Right.UVs.Add(TriplanarUV(OnFaceRight, Normal));
+
+	TArray<FVoxelCompactVertex> LeftCompact, RightCompact;
+	FVoxelCompactVertexFrame LeftFrame, RightFrame;
+	TestTrue(TEXT("left face vertex encodes"), FVoxelCompactVertexCodec::Encode(Left, ChunkWorldSize, LeftCompact, LeftFrame, Bounds));
+	TestTrue(TEXT("right face vertex encodes"), FVoxelCompactVertexCodec::Encode(Right, ChunkWorldSize, RightCompact, RightFrame, Bounds));
+	const FVector3f LeftWorld = LeftFrame.DecodePosition(LeftCompact[0]);
+	const FVector3f RightWorld = RightFrame.DecodePosition(RightCompact[0]) + FVector3f(ChunkWorldSize, 0.0f, 0.0f);
+	TestTrue(TEXT("shared face vertex lands on the same world point"), LeftWorld == RightWorld);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelCompactVertexFallbackTest,
+	"VoxelWorlds.Core.CompactVertex.Fallback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelCompactVertexFallbackTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelCompactVertexTestUtils;
+
+	TArray<FVoxelCompactVertex> Compact;
+	FVoxelCompactVertexFrame Frame;
+	FBox Bounds;
+
+	// Cubic-style merged quad: UVs span the quad size, not the projected position
+	FChunkMeshData Quad;
+	const FVector3f Up(0.0f, 0.0f, 1.0f);
+	const FVector3f Corners[4] = { { 300.0f, 500.0f, 800.0f }, { 700.0f, 500.0f, 800.0f }, { 700.0f, 800.0f, 800.0f }, { 300.0f, 800.0f, 800.0f } };
+	const FVector2f QuadUVs[4] = { { 0.0f, 0.0f }, { 4.0f, 0.0f }, { 4.0f, 3.0f }, { 0.0f, 3.0f } };
+	for (int32 i = 0; i < 4; ++i)
+	{
+		Quad.Positions.Add(Corners[i]);
+		Quad.Normals.Add(Up);
+		Quad.UVs.Add(QuadUVs[i]);
+	}
+	Quad.Indices = { 0, 1, 2, 0, 2, 3 };
+	TestFalse(TEXT("per-quad UVs are rejected"), FVoxelCompactVertexCodec::Encode(Quad, ChunkWorldSize, Compact, Frame, Bounds));
+
+	// Same quad without UVs encodes (all derived UVs are zero)
+	Quad.UVs.Reset();
+	TestTrue(TEXT("UV-less mesh encodes"), FVoxelCompactVertexCodec::Encode(Quad, ChunkWorldSize, Compact, Frame, Bounds));
+	TestEqual(TEXT("UV-less mesh has zero UV density"), Frame.UVPerUnit, 0.0f);
+
+	// Past the lattice range ([-0.5, 1.5) chunk sizes)
+	Quad.Positions[2].X = ChunkWorldSize * 1.6f;
+	TestFalse(TEXT("out-of-range position is rejected"), FVoxelCompactVertexCodec::Encode(Quad, ChunkWorldSize, Compact, Frame, Bounds));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
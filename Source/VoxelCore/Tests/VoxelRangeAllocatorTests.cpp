@@ -0,0 +1,179 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelRangeAllocator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Range suballocator behind the pooled chunk buffers (FVoxelRangeAllocator).
+// Allocations must never overlap, freed neighbours must coalesce back into a
+// single block, exhaustion must return InvalidOffset rather than partial
+// ranges, and the stats must report utilization and fragmentation.
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelRangeAllocatorBasicTest,
+	"VoxelWorlds.Core.RangeAllocator.Basic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelRangeAllocatorBasicTest::RunTest(const FString& Parameters)
+{
+	FVoxelRangeAllocator Allocator(1024, 4);
+	TestTrue(TEXT("starts empty"), Allocator.IsEmpty());
+	TestTrue(TEXT("starts valid"), Allocator.Validate());
+
+	const uint32 A = Allocator.Allocate(100);
+	const uint32 B = Allocator.Allocate(30);
+	const uint32 C = Allocator.Allocate(200);
+	TestEqual(TEXT("first allocation at 0"), A, 0u);
+	TestEqual(TEXT("sizes round up to granularity"), Allocator.GetAllocationSize(B), 32u);
+	TestEqual(TEXT("packed front to back"), B, 100u);
+	TestEqual(TEXT("third follows the second"), C, 132u);
+	TestEqual(TEXT("used size"), Allocator.GetUsedSize(), 332u);
+	TestEqual(TEXT("zero-sized request fails"), Allocator.Allocate(0), FVoxelRangeAllocator::InvalidOffset);
+	TestTrue(TEXT("valid after allocations"), Allocator.Validate());
+
+	// Freeing the middle leaves a hole that an equal request reuses
+	Allocator.Free(B);
+	TestEqual(TEXT("freed range reports no size"), Allocator.GetAllocationSize(B), 0u);
+	TestEqual(TEXT("hole is reused"), Allocator.Allocate(32), B);
+
+	// Free everything in a scattered order: the range coalesces to one block again
+	Allocator.Free(C);
+	Allocator.Free(A);
+	Allocator.Free(B);
+	const FVoxelRangeAllocatorStats Stats = Allocator.GetStats();
+	TestTrue(TEXT("empty after freeing all"), Allocator.IsEmpty());
+	TestEqual(TEXT("coalesced into one free block"), Stats.NumFreeBlocks, 1);
+	TestEqual(TEXT("largest block is the whole range"), Stats.LargestFreeBlock, 1024u);
+	TestTrue(TEXT("valid after coalescing"), Allocator.Validate());
+
+	// Exhaustion fails cleanly and leaves the allocator untouched
+	const uint32 Big = Allocator.Allocate(1000);
+	TestEqual(TEXT("large allocation fits"), Big, 0u);
+	TestEqual(TEXT("request past the remainder fails"), Allocator.Allocate(64), FVoxelRangeAllocator::InvalidOffset);
+	TestEqual(TEXT("remainder still allocatable"), Allocator.Allocate(24), 1000u);
+	TestEqual(TEXT("full allocator rejects"), Allocator.Allocate(1), FVoxelRangeAllocator::InvalidOffset);
+	TestTrue(TEXT("valid when full"), Allocator.Validate());
+
+	Allocator.Reset(64);
+	TestTrue(TEXT("reset empties"), Allocator.IsEmpty());
+	TestEqual(TEXT("reset capacity"), Allocator.GetCapacity(), 64u);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelRangeAllocatorFragmentationTest,
+	"VoxelWorlds.Core.RangeAllocator.Fragmentation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelRangeAllocatorFragmentationTest::RunTest(const FString& Parameters)
+{
+	FVoxelRangeAllocator Allocator(1000);
+
+	TArray<uint32> Offsets;
+	for (int32 i = 0; i < 10; ++i)
+	{
+		Offsets.Add(Allocator.Allocate(100));
+	}
+	TestEqual(TEXT("exactly full"), Allocator.GetStats().GetUtilization(), 1.0f);
+	TestEqual(TEXT("no free space, no fragmentation"), Allocator.GetStats().GetFragmentation(), 0.0f);
+
+	// Free every other block: 500 free in five 100-unit holes
+	for (int32 i = 0; i < 10; i += 2)
+	{
+		Allocator.Free(Offsets[i]);
+	}
+	FVoxelRangeAllocatorStats Stats = Allocator.GetStats();
+	TestEqual(TEXT("half utilized"), Stats.GetUtilization(), 0.5f);
+	TestEqual(TEXT("five holes"), Stats.NumFreeBlocks, 5);
+	TestTrue(TEXT("fragmentation 1 - 100/500"), FMath::IsNearlyEqual(Stats.GetFragmentation(), 0.8f));
+	TestEqual(TEXT("200 doesn't fit despite 500 free"), Allocator.Allocate(200), FVoxelRangeAllocator::InvalidOffset);
+
+	// Freeing a separator merges three ranges
+	Allocator.Free(Offsets[1]);
+	Stats = Allocator.GetStats();
+	TestEqual(TEXT("separator merged with both neighbours"), Stats.LargestFreeBlock, 300u);
+	TestEqual(TEXT("merged 200 now fits"), Allocator.Allocate(200), 0u);
+	TestTrue(TEXT("valid"), Allocator.Validate());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelRangeAllocatorStressTest,
+	"VoxelWorlds.Core.RangeAllocator.Stress",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelRangeAllocatorStressTest::RunTest(const FString& Parameters)
+{
+	constexpr uint32 Capacity = 1 << 16;
+	FVoxelRangeAllocator Allocator(Capacity, 3);
+	FRandomStream Rng(1234);
+
+	// Shadow occupancy map to catch overlaps
+	TBitArray<> Occupied(false, Capacity);
+	TArray<uint32> Live;
+	int32 Overlaps = 0;
+	int32 Failures = 0;
+
+	for (int32 Step = 0; Step < 20000; ++Step)
+	{
+		const bool bAllocate = Live.Num() == 0 || Rng.FRand() < 0.55f;
+		if (bAllocate)
+		{
+			// Chunk-like sizes: mostly small, occasionally large
+			const uint32 Size = Rng.FRand() < 0.9f ? Rng.RandRange(1, 600) : Rng.RandRange(2000, 8000);
+			const uint32 Offset = Allocator.Allocate(Size);
+			if (Offset == FVoxelRangeAllocator::InvalidOffset)
+			{
+				continue;
+			}
+			const uint32 Allocated = Allocator.GetAllocationSize(Offset);
+			if (Allocated < Size || Offset + Allocated > Capacity)
+			{
+				++Failures;
+				continue;
+			}
+			for (uint32 i = Offset; i < Offset + Allocated; ++i)
+			{
+				Overlaps += Occupied[i];
+				Occupied[i] = true;
+			}
+			Live.Add(Offset);
+		}
+		else
+		{
+			const int32 Pick = Rng.RandRange(0, Live.Num() - 1);
+			const uint32 Offset = Live[Pick];
+			const uint32 Allocated = Allocator.GetAllocationSize(Offset);
+			for (uint32 i = Offset; i < Offset + Allocated; ++i)
+			{
+				Occupied[i] = false;
+			}
+			Allocator.Free(Offset);
+			Live.RemoveAtSwap(Pick, 1, EAllowShrinking::No);
+		}
+
+		if (Step % 1000 == 0 && !Allocator.Validate())
+		{
+			++Failures;
+		}
+	}
+
+	TestEqual(TEXT("no overlapping allocations"), Overlaps, 0);
+	TestEqual(TEXT("no invalid states or short allocations"), Failures, 0);
+	TestEqual(TEXT("live count matches"), Allocator.GetNumAllocations(), Live.Num());
+
+	for (const uint32 Offset : Live)
+	{
+		Allocator.Free(Offset);
+	}
+	TestTrue(TEXT("empty after draining"), Allocator.IsEmpty());
+	TestEqual(TEXT("drained allocator is one block"), Allocator.GetStats().NumFreeBlocks, 1);
+	TestTrue(TEXT("valid after draining"), Allocator.Validate());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
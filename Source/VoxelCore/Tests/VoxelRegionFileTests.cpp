@@ -0,0 +1,319 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "VoxelRegionFile.h"
+#include "VoxelWorldSave.h"
+#include "VoxelEditManager.h"
+#include "VoxelWorldConfiguration.h"
+#include "VoxelCoordinates.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Region-file persistence: records round-trip bit-exactly (sparse and dense
+// layers), overwrites and removals survive a reopen, a corrupted record is
+// rejected by its CRC, Compact reclaims dead space without losing chunks (and
+// an interrupted compaction recovers on Open), and the edit manager saves /
+// evicts / reloads chunk edits through FVoxelWorldSave.
+// ---------------------------------------------------------------------------
+
+namespace VoxelRegionFileTestUtils
+{
+	/** Unique scratch directory under the automation transient dir */
+	FString MakeTempDir()
+	{
+		return FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("VoxelRegionFile"), FGuid::NewGuid().ToString());
+	}
+
+	void DeleteTempDir(const FString& Dir)
+	{
+		IFileManager::Get().DeleteDirectory(*Dir, false, true);
+	}
+
+	/** Layer with NumEdits deterministic edits starting at voxel index First */
+	FChunkEditLayer MakeLayer(const FIntVector& ChunkCoord, int32 ChunkSize, int32 First, int32 NumEdits)
+	{
+		FChunkEditLayer Layer(ChunkCoord, ChunkSize);
+		for (int32 i = First; i < First + NumEdits; ++i)
+		{
+			const FIntVector Pos = Layer.GetLocalPosition(i);
+			if (i % 3 == 0)
+			{
+				Layer.ApplyEdit(FVoxelEdit(Pos, EEditMode::Add, 10 + (i % 50), static_cast<uint8>(i % 7)));
+			}
+			else
+			{
+				Layer.ApplyEdit(FVoxelEdit(Pos, FVoxelData(static_cast<uint8>(i % 5), static_cast<uint8>(i & 0xFF), 0), FVoxelData::Air(), EEditMode::Set));
+			}
+		}
+		return Layer;
+	}
+
+	bool SameEdits(const FChunkEditLayer& A, const FChunkEditLayer& B)
+	{
+		if (A.GetEditCount() != B.GetEditCount())
+		{
+			return false;
+		}
+		bool bSame = true;
+		A.ForEachEdit([&B, &bSame](int32 Index, const FVoxelEditDelta& Delta)
+		{
+			const FVoxelEditDelta* Other = B.FindEdit(Index);
+			bSame &= Other && FMemory::Memcmp(Other, &Delta, sizeof(Delta)) == 0;
+		});
+		return bSame;
+	}
+
+	FVoxelChunkRecord MakeRecord(const FChunkEditLayer& Layer)
+	{
+		FVoxelChunkRecord Record;
+		Record.SetEdits(Layer);
+		return Record;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkRecordRoundTripTest,
+	"VoxelWorlds.Persistence.ChunkRecord.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkRecordRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelRegionFileTestUtils;
+
+	const int32 ChunkSize = 32;
+	const FIntVector ChunkCoord(-3, 7, 1);
+
+	// Sparse, dense (past DenseThreshold) and voxel-buffer-only records
+	for (const int32 NumEdits : { 5, FChunkEditLayer::DenseThreshold * 4 })
+	{
+		const FChunkEditLayer Source = MakeLayer(ChunkCoord, ChunkSize, 100, NumEdits);
+
+		FVoxelChunkRecord Record = MakeRecord(Source);
+		TArray<uint8> Blob;
+		TestTrue(TEXT("Encode"), Record.Encode(Blob));
+
+		FVoxelChunkRecord Decoded;
+		TestTrue(TEXT("Decode"), Decoded.Decode(Blob.GetData(), Blob.Num()));
+		TestEqual(TEXT("ChunkCoord"), Decoded.ChunkCoord, ChunkCoord);
+		TestEqual(TEXT("ChunkSize"), Decoded.ChunkSize, ChunkSize);
+
+		FChunkEditLayer Restored(ChunkCoord, ChunkSize);
+		Decoded.ApplyEditsTo(Restored);
+		TestTrue(FString::Printf(TEXT("%d edits restored bit-exactly"), NumEdits), SameEdits(Source, Restored));
+
+		// Truncated blobs are rejected rather than decoded as garbage
+		TestFalse(TEXT("Truncated blob rejected"), Decoded.Decode(Blob.GetData(), Blob.Num() - 1));
+	}
+
+	FVoxelChunkRecord VoxelsOnly;
+	VoxelsOnly.ChunkCoord = ChunkCoord;
+	VoxelsOnly.ChunkSize = ChunkSize;
+	VoxelsOnly.VoxelBuffer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	TArray<uint8> Blob;
+	TestTrue(TEXT("Encode voxel-only record"), VoxelsOnly.Encode(Blob));
+	FVoxelChunkRecord Decoded;
+	TestTrue(TEXT("Decode voxel-only record"), Decoded.Decode(Blob.GetData(), Blob.Num()));
+	TestFalse(TEXT("No edits"), Decoded.HasEdits());
+	TestTrue(TEXT("Voxel buffer preserved"), Decoded.VoxelBuffer == VoxelsOnly.VoxelBuffer);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelRegionFileWriteReopenTest,
+	"VoxelWorlds.Persistence.RegionFile.WriteReopenCompact",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelRegionFileWriteReopenTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelRegionFileTestUtils;
+
+	const FString Dir = MakeTempDir();
+	const int32 ChunkSize = 16;
+	const FIntVector RegionCoord(0, -1, 0);
+	const FString Path = FPaths::Combine(Dir, FVoxelRegionFile::GetRegionFileName(RegionCoord));
+
+	const FIntVector ChunkA(0, -1, 0);
+	const FIntVector ChunkB(15, -16, 3);
+	const FIntVector ChunkC(4, -5, 6);
+	TestEqual(TEXT("Negative chunk coords map to the negative region"), FVoxelRegionFile::ChunkToRegion(ChunkB), RegionCoord);
+
+	const FChunkEditLayer LayerA = MakeLayer(ChunkA, ChunkSize, 0, 40);
+	const FChunkEditLayer LayerB1 = MakeLayer(ChunkB, ChunkSize, 10, 200);
+	const FChunkEditLayer LayerB2 = MakeLayer(ChunkB, ChunkSize, 500, 30);
+	const FChunkEditLayer LayerC = MakeLayer(ChunkC, ChunkSize, 7, 60);
+
+	{
+		FVoxelRegionFile Region(Path, RegionCoord, ChunkSize);
+		TestFalse(TEXT("Missing region does not open without bCreate"), Region.Open(false));
+		TestTrue(TEXT("Create region"), Region.Open(true));
+
+		TestTrue(TEXT("Write A"), Region.WriteChunk(MakeRecord(LayerA)));
+		TestTrue(TEXT("Write B"), Region.WriteChunk(MakeRecord(LayerB1)));
+		TestTrue(TEXT("Write C"), Region.WriteChunk(MakeRecord(LayerC)));
+		TestTrue(TEXT("Overwrite B"), Region.WriteChunk(MakeRecord(LayerB2)));
+		TestTrue(TEXT("Remove C"), Region.RemoveChunk(ChunkC));
+
+		TestEqual(TEXT("Two live chunks"), Region.GetNumChunks(), 2);
+		TestTrue(TEXT("Superseded / removed records are dead bytes"), Region.GetDeadBytes() > 0);
+	}
+
+	// Reopen: the table on disk reflects the overwrite and the removal
+	FVoxelRegionFile Region(Path, RegionCoord, ChunkSize);
+	TestTrue(TEXT("Reopen"), Region.Open(false));
+	TestEqual(TEXT("Two live chunks after reopen"), Region.GetNumChunks(), 2);
+	TestFalse(TEXT("C stays removed"), Region.HasChunk(ChunkC));
+
+	FVoxelChunkRecord Record;
+	FChunkEditLayer Restored(ChunkB, ChunkSize);
+	TestTrue(TEXT("Read B"), Region.ReadChunk(ChunkB, Record));
+	Record.ApplyEditsTo(Restored);
+	TestTrue(TEXT("B holds the overwrite"), SameEdits(LayerB2, Restored));
+
+	// Wrong chunk size is a header mismatch
+	FVoxelRegionFile Mismatched(Path, RegionCoord, ChunkSize * 2);
+	TestFalse(TEXT("Chunk size mismatch rejected"), Mismatched.Open(false));
+
+	// Compact drops the dead bytes and keeps every live record
+	const int64 LiveBytes = Region.GetLiveBytes();
+	TestTrue(TEXT("Compact"), Region.Compact());
+	TestEqual(TEXT("No dead bytes after compact"), Region.GetDeadBytes(), int64(0));
+	TestEqual(TEXT("Live bytes unchanged"), Region.GetLiveBytes(), LiveBytes);
+	TestEqual(TEXT("File is header + live records"), Region.GetFileBytes(), FVoxelRegionFile::DataStart + LiveBytes);
+
+	FChunkEditLayer RestoredA(ChunkA, ChunkSize);
+	TestTrue(TEXT("Read A after compact"), Region.ReadChunk(ChunkA, Record));
+	Record.ApplyEditsTo(RestoredA);
+	TestTrue(TEXT("A intact after compact"), SameEdits(LayerA, RestoredA));
+	Region.Close();
+
+	// Crash between Compact's delete and rename: only the finished temp file is left, and Open promotes it
+	const FString TempPath = Path + FVoxelRegionFile::GetCompactSuffix();
+	TestTrue(TEXT("Simulate interrupted swap"), IFileManager::Get().Move(*TempPath, *Path));
+	FVoxelRegionFile Recovered(Path, RegionCoord, ChunkSize);
+	TestTrue(TEXT("Open restores the temp file"), Recovered.Open(false));
+	TestEqual(TEXT("Recovered region keeps both chunks"), Recovered.GetNumChunks(), 2);
+	TestFalse(TEXT("Temp file consumed"), IFileManager::Get().FileExists(*TempPath));
+	Recovered.Close();
+
+	// Crash while writing the temp file: the intact region wins and the partial temp file is dropped
+	TestTrue(TEXT("Simulate partial temp file"), FFileHelper::SaveStringToFile(TEXT("partial"), *TempPath));
+	TestTrue(TEXT("Open ignores a stale temp file"), Recovered.Open(false));
+	TestEqual(TEXT("Region unchanged"), Recovered.GetNumChunks(), 2);
+	TestFalse(TEXT("Stale temp file deleted"), IFileManager::Get().FileExists(*TempPath));
+	Recovered.Close();
+
+	DeleteTempDir(Dir);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelRegionFileCrcTest,
+	"VoxelWorlds.Persistence.RegionFile.CorruptRecordRejected",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelRegionFileCrcTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelRegionFileTestUtils;
+
+	const FString Dir = MakeTempDir();
+	const int32 ChunkSize = 16;
+	const FIntVector ChunkCoord(2, 3, 4);
+	const FString Path = FPaths::Combine(Dir, FVoxelRegionFile::GetRegionFileName(FIntVector::ZeroValue));
+
+	{
+		FVoxelRegionFile Region(Path, FIntVector::ZeroValue, ChunkSize);
+		TestTrue(TEXT("Create region"), Region.Open(true));
+		TestTrue(TEXT("Write"), Region.WriteChunk(MakeRecord(MakeLayer(ChunkCoord, ChunkSize, 0, 100))));
+	}
+
+	// Flip one byte inside the (only) record
+	TArray<uint8> Bytes;
+	TestTrue(TEXT("Load region bytes"), FFileHelper::LoadFileToArray(Bytes, *Path));
+	Bytes.Last() ^= 0x5A;
+	TestTrue(TEXT("Save corrupted region"), FFileHelper::SaveArrayToFile(Bytes, *Path));
+
+	FVoxelRegionFile Region(Path, FIntVector::ZeroValue, ChunkSize);
+	TestTrue(TEXT("Reopen"), Region.Open(false));
+	TestTrue(TEXT("Table entry still present"), Region.HasChunk(ChunkCoord));
+
+	FVoxelChunkRecord Record;
+	TestFalse(TEXT("Corrupt record rejected"), Region.ReadChunk(ChunkCoord, Record));
+	TestEqual(TEXT("CRC failure counted"), Region.GetCrcFailures(), 1);
+
+	Region.Close();
+	DeleteTempDir(Dir);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelWorldSaveEditManagerTest,
+	"VoxelWorlds.Persistence.WorldSave.EvictAndReload",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelWorldSaveEditManagerTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelRegionFileTestUtils;
+
+	const FString Dir = MakeTempDir();
+
+	UVoxelWorldConfiguration* Config = NewObject<UVoxelWorldConfiguration>();
+	Config->ChunkSize = 16;
+	Config->VoxelSize = 100.0f;
+
+	UVoxelEditManager* EditManager = NewObject<UVoxelEditManager>();
+	EditManager->AddToRoot();
+	EditManager->Initialize(Config);
+
+	// Edits in two chunks that sit in different regions
+	const FVector PosA = Config->WorldOrigin + FVector(150.0f, 250.0f, 350.0f);
+	const FVector PosB = Config->WorldOrigin + FVector(-1.0f, -1.0f, -1.0f) * 100.0f * 16 * FVoxelRegionFile::RegionSize;
+	EditManager->ApplyEdit(PosA, FVoxelData(2, 255, 0), EEditMode::Set);
+	EditManager->ApplyEdit(PosB, FVoxelData(3, 255, 0), EEditMode::Set);
+	TestEqual(TEXT("Both chunks dirty"), EditManager->GetPersistDirtyChunks().Num(), 2);
+
+	const FIntVector Chunks[2] = {
+		FVoxelCoordinates::WorldToChunk(PosA - Config->WorldOrigin, Config->ChunkSize, Config->VoxelSize),
+		FVoxelCoordinates::WorldToChunk(PosB - Config->WorldOrigin, Config->ChunkSize, Config->VoxelSize)
+	};
+	TestNotEqual(TEXT("Chunks in different regions"), FVoxelRegionFile::ChunkToRegion(Chunks[0]), FVoxelRegionFile::ChunkToRegion(Chunks[1]));
+
+	FChunkEditLayer Before(Chunks[0], Config->ChunkSize);
+	EditManager->GetEditLayer(Chunks[0])->ForEachEdit([&Before](int32 Index, const FVoxelEditDelta& Delta) { Before.SetEdit(Index, Delta); });
+
+	{
+		FVoxelWorldSave Save(Dir, Config->ChunkSize);
+		TestEqual(TEXT("Both chunks saved"), EditManager->SaveDirtyChunks(Save), 2);
+		TestEqual(TEXT("Nothing dirty after save"), EditManager->GetPersistDirtyChunks().Num(), 0);
+		TestEqual(TEXT("Two regions open"), Save.GetStats().OpenRegions, 2);
+
+		// Undo history pins the live layer
+		TestFalse(TEXT("Evict refused while in history"), EditManager->EvictChunkEdits(Save, Chunks[0]));
+		EditManager->ClearHistory();
+		TestTrue(TEXT("Evict"), EditManager->EvictChunkEdits(Save, Chunks[0]));
+		TestFalse(TEXT("Layer dropped"), EditManager->ChunkHasEdits(Chunks[0]));
+	}
+
+	// A fresh save object reads the regions back from disk
+	FVoxelWorldSave Save(Dir, Config->ChunkSize);
+	int32 Broadcasts = 0;
+	EditManager->OnChunkEdited.AddLambda([&Broadcasts](const FIntVector&, EEditSource, const FVector&, float) { ++Broadcasts; });
+
+	TestTrue(TEXT("Reload"), EditManager->LoadChunkEdits(Save, Chunks[0]));
+	TestEqual(TEXT("Reload broadcasts"), Broadcasts, 1);
+	TestEqual(TEXT("Reload does not mark dirty"), EditManager->GetPersistDirtyChunks().Num(), 0);
+	TestTrue(TEXT("Reloaded edits match"), SameEdits(Before, *EditManager->GetEditLayer(Chunks[0])));
+
+	// Unsaved in-memory edits win over the disk copy
+	EditManager->ApplyEdit(PosB, FVoxelData(4, 255, 0), EEditMode::Set);
+	TestFalse(TEXT("Dirty chunk not overwritten by load"), EditManager->LoadChunkEdits(Save, Chunks[1]));
+
+	EditManager->Shutdown();
+	EditManager->RemoveFromRoot();
+	DeleteTempDir(Dir);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
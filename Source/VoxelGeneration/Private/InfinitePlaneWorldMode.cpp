@@ -60,6 +60,18 @@ float FInfinitePlaneWorldMode::GetTerrainHeightAt(
 	return NoiseToTerrainHeight(NoiseValue, EffectiveParams);
 }
 
+void FInfinitePlaneWorldMode::GetTerrainHeightsAt(
+	const float* X,
+	const float* Y,
+	int32 Count,
+	const FVoxelNoiseParams& NoiseParams,
+	float* OutHeights) const
+{
+	// Same gating as GetTerrainHeightAt
+	const FVoxelBiomeSnapshot* Ctx = (GVoxelAnalyticContinentalness != 0) ? &BiomeSnapshot : nullptr;
+	ComputeTerrainHeights_Batch(X, Y, Count, TerrainParams, NoiseParams, Ctx, OutHeights);
+}
+
 FIntVector FInfinitePlaneWorldMode::WorldToChunkCoord(
 	const FVector& WorldPos,
 	int32 ChunkSize,
@@ -155,6 +167,61 @@ float FInfinitePlaneWorldMode::NoiseToTerrainHeight(
 	return TerrainParams.SeaLevel + TerrainParams.BaseHeight + (NoiseValue * TerrainParams.HeightScale);
 }
 
+void FInfinitePlaneWorldMode::SampleTerrainNoise2D_Batch(
+	const float* X,
+	const float* Y,
+	int32 Count,
+	const FVoxelNoiseParams& NoiseParams,
+	float* OutNoise)
+{
+	// Widen to the double positions SampleTerrainNoise2D builds its FVector from, one block at a time
+	constexpr int32 BlockSize = 64;
+	double PX[BlockSize], PY[BlockSize], PZ[BlockSize];
+
+	for (int32 Block = 0; Block < Count; Block += BlockSize)
+	{
+		const int32 Num = FMath::Min(BlockSize, Count - Block);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			PX[i] = X[Block + i];
+			PY[i] = Y[Block + i];
+			PZ[i] = 0.0;
+		}
+		FVoxelCPUNoiseGenerator::FBM3D_Batch(PX, PY, PZ, Num, NoiseParams, OutNoise + Block);
+	}
+}
+
+// Same continentalness noise field as generation: 2-octave Simplex, seed offset from the config.
+static FVoxelNoiseParams MakeContinentalnessNoiseParams(
+	const FVoxelNoiseParams& BaseNoiseParams,
+	const FVoxelBiomeSnapshot& BiomeSnapshot)
+{
+	FVoxelNoiseParams ContinentalnessNoiseParams;
+	ContinentalnessNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
+	ContinentalnessNoiseParams.Octaves = 2;
+	ContinentalnessNoiseParams.Persistence = 0.5f;
+	ContinentalnessNoiseParams.Lacunarity = 2.0f;
+	ContinentalnessNoiseParams.Amplitude = 1.0f;
+	ContinentalnessNoiseParams.Seed = BaseNoiseParams.Seed + BiomeSnapshot.ContinentalnessSeedOffset;
+	ContinentalnessNoiseParams.Frequency = BiomeSnapshot.ContinentalnessNoiseFrequency;
+	return ContinentalnessNoiseParams;
+}
+
+// Offset BaseHeight / scale HeightScale by the snapshot's continentalness curves.
+static FWorldModeTerrainParams ApplyContinentalness(
+	const FWorldModeTerrainParams& BaseParams,
+	const FVoxelBiomeSnapshot& BiomeSnapshot,
+	float Continentalness)
+{
+	FWorldModeTerrainParams Effective = BaseParams;
+	float HeightOffset = 0.0f;
+	float HeightScaleMult = 1.0f;
+	BiomeSnapshot.GetContinentalnessTerrainParams(Continentalness, HeightOffset, HeightScaleMult);
+	Effective.BaseHeight += HeightOffset;
+	Effective.HeightScale *= HeightScaleMult;
+	return Effective;
+}
+
 FWorldModeTerrainParams FInfinitePlaneWorldMode::ComputeEffectiveTerrainParams(
 	float X,
 	float Y,
@@ -164,33 +231,64 @@ FWorldModeTerrainParams FInfinitePlaneWorldMode::ComputeEffectiveTerrainParams(
 	float& OutContinentalness)
 {
 	OutContinentalness = 0.0f;
-	FWorldModeTerrainParams Effective = BaseParams;
 
 	// Continentalness modulates height independently of biome material selection (matches
 	// FVoxelCPUNoiseGenerator::GenerateChunkInfinitePlane, which gates only on bEnableContinentalness).
 	if (BiomeSnapshot && BiomeSnapshot->bEnableContinentalness)
 	{
-		// Same continentalness noise field as generation: 2-octave Simplex, seed offset from the config.
-		FVoxelNoiseParams ContinentalnessNoiseParams;
-		ContinentalnessNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
-		ContinentalnessNoiseParams.Octaves = 2;
-		ContinentalnessNoiseParams.Persistence = 0.5f;
-		ContinentalnessNoiseParams.Lacunarity = 2.0f;
-		ContinentalnessNoiseParams.Amplitude = 1.0f;
-		ContinentalnessNoiseParams.Seed = BaseNoiseParams.Seed + BiomeSnapshot->ContinentalnessSeedOffset;
-		ContinentalnessNoiseParams.Frequency = BiomeSnapshot->ContinentalnessNoiseFrequency;
-
 		const FVector SamplePos(X, Y, 0.0f);
-		OutContinentalness = FVoxelCPUNoiseGenerator::FBM3D(SamplePos, ContinentalnessNoiseParams);
+		OutContinentalness = FVoxelCPUNoiseGenerator::FBM3D(
+			SamplePos, MakeContinentalnessNoiseParams(BaseNoiseParams, *BiomeSnapshot));
 
-		float HeightOffset = 0.0f;
-		float HeightScaleMult = 1.0f;
-		BiomeSnapshot->GetContinentalnessTerrainParams(OutContinentalness, HeightOffset, HeightScaleMult);
-		Effective.BaseHeight += HeightOffset;
-		Effective.HeightScale *= HeightScaleMult;
+		return ApplyContinentalness(BaseParams, *BiomeSnapshot, OutContinentalness);
 	}
 
-	return Effective;
+	return BaseParams;
+}
+
+void FInfinitePlaneWorldMode::ComputeTerrainHeights_Batch(
+	const float* X,
+	const float* Y,
+	int32 Count,
+	const FWorldModeTerrainParams& BaseParams,
+	const FVoxelNoiseParams& NoiseParams,
+	const FVoxelBiomeSnapshot* BiomeSnapshot,
+	float* OutHeights,
+	float* OutContinentalness)
+{
+	constexpr int32 BlockSize = 64;
+	const bool bContinentalness = BiomeSnapshot && BiomeSnapshot->bEnableContinentalness;
+	const FVoxelNoiseParams ContinentalnessNoiseParams = bContinentalness
+		? MakeContinentalnessNoiseParams(NoiseParams, *BiomeSnapshot)
+		: FVoxelNoiseParams();
+
+	for (int32 Block = 0; Block < Count; Block += BlockSize)
+	{
+		const int32 Num = FMath::Min(BlockSize, Count - Block);
+
+		float Noise[BlockSize];
+		SampleTerrainNoise2D_Batch(X + Block, Y + Block, Num, NoiseParams, Noise);
+
+		float Continentalness[BlockSize];
+		if (bContinentalness)
+		{
+			SampleTerrainNoise2D_Batch(X + Block, Y + Block, Num, ContinentalnessNoiseParams, Continentalness);
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const float C = bContinentalness ? Continentalness[i] : 0.0f;
+			const FWorldModeTerrainParams EffectiveParams = bContinentalness
+				? ApplyContinentalness(BaseParams, *BiomeSnapshot, C)
+				: BaseParams;
+
+			OutHeights[Block + i] = NoiseToTerrainHeight(Noise[i], EffectiveParams);
+			if (OutContinentalness)
+			{
+				OutContinentalness[Block + i] = C;
+			}
+		}
+	}
 }
 
 void FInfinitePlaneWorldMode::GetTerrainHeightBounds(
@@ -79,6 +79,31 @@ float FIslandBowlWorldMode::GetTerrainHeightAt(
 	return ApplyFalloffToHeight(BaseTerrainHeight, FalloffFactor, IslandParams.EdgeHeight);
 }
 
+void FIslandBowlWorldMode::GetTerrainHeightsAt(
+	const float* X,
+	const float* Y,
+	int32 Count,
+	const FVoxelNoiseParams& NoiseParams,
+	float* OutHeights) const
+{
+	// Batched base terrain + continentalness (shared with InfinitePlane), then the per-point island
+	// bounds / falloff exactly as GetTerrainHeightAt applies them
+	FInfinitePlaneWorldMode::ComputeTerrainHeights_Batch(
+		X, Y, Count, TerrainParams, NoiseParams, &BiomeSnapshot, OutHeights);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		if (!IsWithinIslandBounds(X[i], Y[i], IslandParams))
+		{
+			OutHeights[i] = IslandParams.EdgeHeight - 1000.0f;
+			continue;
+		}
+
+		const float FalloffFactor = CalculateFalloffFactorForPoint(X[i], Y[i], IslandParams);
+		OutHeights[i] = ApplyFalloffToHeight(OutHeights[i], FalloffFactor, IslandParams.EdgeHeight);
+	}
+}
+
 void FIslandBowlWorldMode::GetTerrainHeightBounds(float& OutMin, float& OutMax) const
 {
 	// Base continentalness extent (same as InfinitePlane), then floor the minimum to EdgeHeight — the
@@ -11,7 +11,9 @@
 #include "VoxelBiomeSnapshot.h"
 #include "VoxelCaveConfiguration.h"
 #include "VoxelMaterialRegistry.h"
+#include "VoxelStridedLattice.h"
 #include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
 
 // Permutation table for Perlin noise (Ken Perlin's original)
 static const int32 PermutationTable[256] = {
@@ -109,14 +111,30 @@ FVoxelGenerationHandle FVoxelCPUNoiseGenerator::GenerateChunkAsync(
 	return Handle;
 }
 
+int32 FVoxelCPUNoiseGenerator::GetEffectiveGenerationStride(const FVoxelNoiseGenerationRequest& Request)
+{
+	const bool bHeightmapMode = Request.WorldMode == EWorldMode::InfinitePlane
+		|| Request.WorldMode == EWorldMode::IslandBowl;
+	// Caves carve air under solid ceilings; the post-passes can't be run exactly on replicated columns
+	if (!bHeightmapMode || Request.bEnableCaves || Request.GenerationStride <= 1
+		|| !FVoxelStridedLattice::IsValidStride(Request.ChunkSize, Request.GenerationStride))
+	{
+		return 1;
+	}
+	return Request.GenerationStride;
+}
+
 bool FVoxelCPUNoiseGenerator::GenerateChunkCPU(
 	const FVoxelNoiseGenerationRequest& Request,
 	TArray<FVoxelData>& OutVoxelData)
 {
 	const int32 ChunkSize = Request.ChunkSize;
-	const int32 TotalVoxels = ChunkSize * ChunkSize * ChunkSize;
-	// Always generate at base VoxelSize regardless of LOD level
-	// LOD stride is applied during meshing, not generation
+	// Voxels are always positioned at base VoxelSize. A strided request (far LOD) samples only the
+	// lattice the mesher reads at that stride plus the neighbour apron, in the compact layout.
+	const int32 Stride = GetEffectiveGenerationStride(Request);
+	const int32 TotalVoxels = (Stride > 1)
+		? FVoxelStridedLattice::GetCompactVoxelCount(ChunkSize, Stride)
+		: ChunkSize * ChunkSize * ChunkSize;
 	const float VoxelSize = Request.VoxelSize;
 	const FVector ChunkWorldPos = Request.GetChunkWorldPosition();
 
@@ -172,6 +190,21 @@ bool FVoxelCPUNoiseGenerator::GenerateChunkCPU(
 		GenerateChunk3DNoise(Request, OutVoxelData);
 	}
 
+	if (Stride > 1)
+	{
+		// The post-passes scan full-resolution columns and neighbourhoods; run them on the expanded
+		// lattice and gather the sampled voxels back into the compact layout. This is exact only
+		// because strided generation is limited to cave-free heightmap columns (solid below the
+		// surface, air above): replication keeps each column monotone, so the water column scan
+		// flags the same samples and the underground pass finds no buried air.
+		TArray<FVoxelData> Expanded;
+		FVoxelStridedLattice::Expand(OutVoxelData.GetData(), ChunkSize, Stride, Expanded);
+		ApplyWaterFillPass(Request, Expanded);
+		ApplyUndergroundClassificationPass(Request, Expanded);
+		FVoxelStridedLattice::Gather(Expanded, ChunkSize, Stride, OutVoxelData);
+		return true;
+	}
+
 	// Post-generation: mark water voxels via column scan
 	ApplyWaterFillPass(Request, OutVoxelData);
 
@@ -187,18 +220,85 @@ void FVoxelCPUNoiseGenerator::GenerateChunkInfinitePlane(
 	TArray<FVoxelData>& OutVoxelData)
 {
 	const int32 ChunkSize = Request.ChunkSize;
-	// Always generate at base VoxelSize for voxel positioning
-	// LOD stride is applied during meshing, not generation
+	// Always generate at base VoxelSize for voxel positioning (a strided request skips voxels, it
+	// doesn't enlarge them)
+	const float VoxelSize = Request.VoxelSize;
+	const FVector ChunkWorldPos = Request.GetChunkWorldPosition();
+
+	// Sampled coordinates per axis: every voxel, or the lattice + apron of a strided request
+	TArray<int32> AxisCoords;
+	FVoxelStridedLattice::BuildAxisCoords(ChunkSize, GetEffectiveGenerationStride(Request), AxisCoords);
+	const int32 M = AxisCoords.Num();
+
+	// Hoisted continentalness snapshot for the per-column height modulation below (plain data; the
+	// per-column ComputeEffectiveTerrainParams call takes this instead of the UObject).
+	const FVoxelBiomeSnapshot BiomeSnapshot = FVoxelBiomeSnapshot::FromConfig(Request.BiomeConfiguration);
+
+	// Column stage: the heightmap only depends on (X,Y), so it runs ChunkSize^2 times instead of once
+	// per voxel. The 3D fill pass below reads the cached column instead of re-sampling 2D noise.
+	TArray<FTerrainColumn> Columns;
+	Columns.SetNum(M * M);
+
+	// One row of columns at a time goes through the batch heightmap (terrain + continentalness noise).
+	TArray<float> RowX, RowY, RowHeight, RowContinentalness;
+	RowX.SetNumUninitialized(M);
+	RowY.SetNumUninitialized(M);
+	RowHeight.SetNumUninitialized(M);
+	RowContinentalness.SetNumUninitialized(M);
+
+	for (int32 J = 0; J < M; ++J)
+	{
+		const int32 Y = AxisCoords[J];
+		for (int32 I = 0; I < M; ++I)
+		{
+			const int32 X = AxisCoords[I];
+			// Same expression as the fill pass's per-voxel WorldPos, so X/Y are bit-identical to it.
+			const FVector ColumnPos = ChunkWorldPos + FVector(X * VoxelSize, Y * VoxelSize, 0.0f);
+			RowX[I] = ColumnPos.X;
+			RowY[I] = ColumnPos.Y;
+		}
+
+		// Continentalness height modulation — shared with the analytic GetTerrainHeightAt query
+		// so spawn / nav / POI placement matches this generated surface. The sampled
+		// continentalness is reused for the biome blend.
+		FInfinitePlaneWorldMode::ComputeTerrainHeights_Batch(
+			RowX.GetData(), RowY.GetData(), M, WorldMode.GetTerrainParams(), Request.NoiseParams,
+			&BiomeSnapshot, RowHeight.GetData(), RowContinentalness.GetData());
+
+		for (int32 I = 0; I < M; ++I)
+		{
+			const int32 X = AxisCoords[I];
+			FTerrainColumn& Column = Columns[I + J * M];
+			Column.TerrainHeight = RowHeight[I];
+			Column.Continentalness = RowContinentalness[I];
+
+			// Phase 6c: blend the natural height toward any terrain conditioning zones
+			// (flatten under POIs / claims). Deterministic — the base terrain IS flat here.
+			if (Request.ConditioningZones.Num() > 0)
+			{
+				const FVector ColumnPos = ChunkWorldPos + FVector(X * VoxelSize, Y * VoxelSize, 0.0f);
+				Column.TerrainHeight = FVoxelTerrainConditioning::ApplyToHeight(
+					ColumnPos.X, ColumnPos.Y, Column.TerrainHeight, Request.ConditioningZones);
+			}
+		}
+	}
+
+	ResolveColumnBiomes(Request, AxisCoords, Columns);
+	FillChunkFromTerrainColumns(Request, WorldMode, AxisCoords, Columns, OutVoxelData);
+}
+
+void FVoxelCPUNoiseGenerator::ResolveColumnBiomes(
+	const FVoxelNoiseGenerationRequest& Request,
+	const TArray<int32>& AxisCoords,
+	TArray<FTerrainColumn>& Columns)
+{
 	const float VoxelSize = Request.VoxelSize;
 	const FVector ChunkWorldPos = Request.GetChunkWorldPosition();
+	const int32 M = AxisCoords.Num();
 
 	// Get biome configuration (may be null if biomes disabled)
 	const UVoxelBiomeConfiguration* BiomeConfig = Request.BiomeConfiguration;
 
-	// Hoisted continentalness snapshot for the per-voxel height modulation below (plain data; the
-	// per-voxel ComputeEffectiveTerrainParams call takes this instead of the UObject).
-	const FVoxelBiomeSnapshot BiomeSnapshot = FVoxelBiomeSnapshot::FromConfig(BiomeConfig);
-
 	// Set up biome noise parameters from configuration
 	FVoxelNoiseParams TempNoiseParams;
 	TempNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
@@ -233,12 +333,153 @@ void FVoxelCPUNoiseGenerator::GenerateChunkInfinitePlane(
 		MoistureNoiseParams.Frequency = 0.00007f;
 	}
 
-	for (int32 Z = 0; Z < ChunkSize; ++Z)
+	const bool bUseBiomeConfig = Request.bEnableBiomes && BiomeConfig && BiomeConfig->IsValid();
+
+	// Biome noise is 2D (Z=0) and constant for a column; sample a whole row per batch call
+	TArray<double> RowX, RowY, RowZ;
+	TArray<float> RowTemperature, RowMoisture;
+	if (Request.bEnableBiomes)
 	{
-		for (int32 Y = 0; Y < ChunkSize; ++Y)
+		RowX.SetNumUninitialized(M);
+		RowY.SetNumUninitialized(M);
+		RowZ.SetNumZeroed(M);
+		RowTemperature.SetNumUninitialized(M);
+		RowMoisture.SetNumUninitialized(M);
+	}
+
+	for (int32 J = 0; J < M; ++J)
+	{
+		const int32 Y = AxisCoords[J];
+		if (Request.bEnableBiomes)
 		{
-			for (int32 X = 0; X < ChunkSize; ++X)
+			for (int32 I = 0; I < M; ++I)
+			{
+				const int32 X = AxisCoords[I];
+				const FVector ColumnPos = ChunkWorldPos + FVector(X * VoxelSize, Y * VoxelSize, 0.0f);
+				RowX[I] = ColumnPos.X;
+				RowY[I] = ColumnPos.Y;
+			}
+			FBM3D_Batch(RowX.GetData(), RowY.GetData(), RowZ.GetData(), M, TempNoiseParams, RowTemperature.GetData());
+			FBM3D_Batch(RowX.GetData(), RowY.GetData(), RowZ.GetData(), M, MoistureNoiseParams, RowMoisture.GetData());
+		}
+
+		for (int32 I = 0; I < M; ++I)
+		{
+			const int32 X = AxisCoords[I];
+			FTerrainColumn& Column = Columns[I + J * M];
+			Column.bUnderwater = Request.bEnableWaterLevel && Column.TerrainHeight < Request.WaterLevel;
+
+			if (!Request.bEnableBiomes)
+			{
+				continue;
+			}
+
+			// Get blended biome selection for smooth transitions (static registry if no
+			// BiomeConfiguration was provided)
+			Column.Blend = bUseBiomeConfig
+				? BiomeConfig->GetBiomeBlend(RowTemperature[I], RowMoisture[I], Column.Continentalness)
+				: FVoxelBiomeRegistry::GetBiomeBlend(RowTemperature[I], RowMoisture[I], 0.15f);
+
+			// Store the dominant biome ID
+			Column.BiomeID = Column.Blend.GetDominantBiome();
+		}
+	}
+}
+
+void FVoxelCPUNoiseGenerator::FillChunkFromTerrainColumns(
+	const FVoxelNoiseGenerationRequest& Request,
+	const IVoxelWorldMode& WorldMode,
+	const TArray<int32>& AxisCoords,
+	const TArray<FTerrainColumn>& Columns,
+	TArray<FVoxelData>& OutVoxelData)
+{
+	const float VoxelSize = Request.VoxelSize;
+	const FVector ChunkWorldPos = Request.GetChunkWorldPosition();
+	const int32 M = AxisCoords.Num();
+
+	const UVoxelBiomeConfiguration* BiomeConfig = Request.BiomeConfiguration;
+	const bool bUseBiomeConfig = Request.bEnableBiomes && BiomeConfig && BiomeConfig->IsValid();
+
+	// Ore candidates only depend on the biome, so resolve them once per biome present in the chunk
+	// rather than once per deep solid voxel.
+	TMap<uint8, TArray<FOreVeinConfig>> OreVeinsByBiome;
+
+	// Cave pre-pass: every carve candidate in a column (solid and below the surface) shares the
+	// column's biome and underwater flag, so the whole column goes through CalculateCaveDensity_Batch
+	// in one call. The fill loop below reads the result instead of sampling caves per voxel.
+	TArray<float> CaveDensities;
+	if (Request.bEnableCaves)
+	{
+		CaveDensities.SetNumZeroed(M * M * M);
+
+		TArray<double> CandX, CandY, CandZ;
+		TArray<float> CandDepth, CandCarve;
+		TArray<int32> CandIndex;
+		CandX.SetNumUninitialized(M);
+		CandY.SetNumUninitialized(M);
+		CandZ.SetNumUninitialized(M);
+		CandDepth.SetNumUninitialized(M);
+		CandCarve.SetNumUninitialized(M);
+		CandIndex.SetNumUninitialized(M);
+
+		for (int32 J = 0; J < M; ++J)
+		{
+			const int32 Y = AxisCoords[J];
+			for (int32 I = 0; I < M; ++I)
+			{
+				const int32 X = AxisCoords[I];
+				const FTerrainColumn& Column = Columns[I + J * M];
+				int32 NumCandidates = 0;
+
+				for (int32 K = 0; K < M; ++K)
+				{
+					const int32 Z = AxisCoords[K];
+					const FVector WorldPos = ChunkWorldPos + FVector(X * VoxelSize, Y * VoxelSize, Z * VoxelSize);
+					const uint8 Density = FInfinitePlaneWorldMode::SignedDistanceToDensity(
+						FInfinitePlaneWorldMode::CalculateSignedDistance(WorldPos.Z, Column.TerrainHeight), VoxelSize);
+					const float DepthBelowSurface = (Column.TerrainHeight - WorldPos.Z) / VoxelSize;
+
+					if (Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
+					{
+						CandX[NumCandidates] = WorldPos.X;
+						CandY[NumCandidates] = WorldPos.Y;
+						CandZ[NumCandidates] = WorldPos.Z;
+						CandDepth[NumCandidates] = DepthBelowSurface;
+						CandIndex[NumCandidates] = I + J * M + K * M * M;
+						++NumCandidates;
+					}
+				}
+
+				if (NumCandidates == 0)
+				{
+					continue;
+				}
+
+				CalculateCaveDensity_Batch(
+					CandX.GetData(), CandY.GetData(), CandZ.GetData(), CandDepth.GetData(), NumCandidates,
+					Column.BiomeID, Request.CaveConfiguration, Request.NoiseParams.Seed, Column.bUnderwater,
+					CandCarve.GetData());
+
+				for (int32 c = 0; c < NumCandidates; ++c)
+				{
+					CaveDensities[CandIndex[c]] = CandCarve[c];
+				}
+			}
+		}
+	}
+
+	for (int32 K = 0; K < M; ++K)
+	{
+		const int32 Z = AxisCoords[K];
+		for (int32 J = 0; J < M; ++J)
+		{
+			const int32 Y = AxisCoords[J];
+			for (int32 I = 0; I < M; ++I)
 			{
+				const int32 X = AxisCoords[I];
+				const FTerrainColumn& Column = Columns[I + J * M];
+				const float TerrainHeight = Column.TerrainHeight;
+
 				// Calculate world position for this voxel (using base VoxelSize)
 				FVector WorldPos = ChunkWorldPos + FVector(
 					X * VoxelSize,
@@ -246,31 +487,6 @@ void FVoxelCPUNoiseGenerator::GenerateChunkInfinitePlane(
 					Z * VoxelSize
 				);
 
-				// Sample 2D noise at X,Y (Z=0 for heightmap)
-				float NoiseValue = FInfinitePlaneWorldMode::SampleTerrainNoise2D(
-					WorldPos.X, WorldPos.Y, Request.NoiseParams);
-
-				// Continentalness height modulation — shared with the analytic GetTerrainHeightAt query
-				// so spawn / nav / POI placement matches this generated surface. The sampled
-				// continentalness is reused for the biome blend below.
-				float Continentalness = 0.0f;
-				const FWorldModeTerrainParams EffectiveParams =
-					FInfinitePlaneWorldMode::ComputeEffectiveTerrainParams(
-						WorldPos.X, WorldPos.Y, WorldMode.GetTerrainParams(),
-						Request.NoiseParams, &BiomeSnapshot, Continentalness);
-
-				// Get terrain height from noise (using potentially modulated params)
-				float TerrainHeight = FInfinitePlaneWorldMode::NoiseToTerrainHeight(
-					NoiseValue, EffectiveParams);
-
-				// Phase 6c: blend the natural height toward any terrain conditioning zones
-				// (flatten under POIs / claims). Deterministic — the base terrain IS flat here.
-				if (Request.ConditioningZones.Num() > 0)
-				{
-					TerrainHeight = FVoxelTerrainConditioning::ApplyToHeight(
-						WorldPos.X, WorldPos.Y, TerrainHeight, Request.ConditioningZones);
-				}
-
 				// Calculate signed distance to surface
 				float SignedDistance = FInfinitePlaneWorldMode::CalculateSignedDistance(
 					WorldPos.Z, TerrainHeight);
@@ -285,46 +501,34 @@ void FVoxelCPUNoiseGenerator::GenerateChunkInfinitePlane(
 				// Save pre-cave density to detect cave carving (solid → air transition)
 				const uint8 PreCaveDensity = Density;
 
-				// Determine material and biome
-				uint8 MaterialID = 0;
-				uint8 BiomeID = 0;
-
-				if (Request.bEnableBiomes && BiomeConfig && BiomeConfig->IsValid())
+				// Cave carving: subtract density for underground cavities. Material selection below
+				// only reads depth, so carving first is equivalent for every biome path.
+				const int32 Index = I + J * M + K * M * M;
+				float CaveDensity = 0.0f;
+				if (Request.bEnableCaves && Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
 				{
-					// Sample biome noise at X,Y (2D, constant for a column)
-					// Use 3D function with Z=0 for 2D sampling
-					FVector BiomeSamplePos(WorldPos.X, WorldPos.Y, 0.0f);
-					float Temperature = FBM3D(BiomeSamplePos, TempNoiseParams);
-					float Moisture = FBM3D(BiomeSamplePos, MoistureNoiseParams);
-
-					// Get blended biome selection for smooth transitions
-					FBiomeBlend Blend = BiomeConfig->GetBiomeBlend(Temperature, Moisture, Continentalness);
-
-					// Store the dominant biome ID
-					BiomeID = Blend.GetDominantBiome();
-
-					// Cave carving: subtract density for underground cavities
-					float CaveDensity = 0.0f;
-					if (Request.bEnableCaves && Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
+					CaveDensity = CaveDensities[Index];
+					if (CaveDensity > 0.0f)
 					{
-						const bool bUnderwater = Request.bEnableWaterLevel && TerrainHeight < Request.WaterLevel;
-						CaveDensity = CalculateCaveDensity(WorldPos, DepthBelowSurface, BiomeID, Request.CaveConfiguration, Request.NoiseParams.Seed, bUnderwater);
-						if (CaveDensity > 0.0f)
-						{
-							float NewDensity = FMath::Max(0.0f, static_cast<float>(Density) - CaveDensity * 255.0f);
-							Density = static_cast<uint8>(FMath::Clamp(NewDensity, 0.0f, 255.0f));
-						}
+						float NewDensity = FMath::Max(0.0f, static_cast<float>(Density) - CaveDensity * 255.0f);
+						Density = static_cast<uint8>(FMath::Clamp(NewDensity, 0.0f, 255.0f));
 					}
+				}
 
+				// Determine material
+				uint8 MaterialID = 0;
+
+				if (bUseBiomeConfig)
+				{
 					// Get material considering blend weights and water level
 					if (Request.bEnableWaterLevel)
 					{
 						MaterialID = BiomeConfig->GetBlendedMaterialWithWater(
-							Blend, DepthBelowSurface, TerrainHeight, Request.WaterLevel);
+							Column.Blend, DepthBelowSurface, TerrainHeight, Request.WaterLevel);
 					}
 					else
 					{
-						MaterialID = BiomeConfig->GetBlendedMaterial(Blend, DepthBelowSurface);
+						MaterialID = BiomeConfig->GetBlendedMaterial(Column.Blend, DepthBelowSurface);
 					}
 
 					// Apply height-based material overrides (snow at peaks, rock at altitude, etc.)
@@ -346,11 +550,15 @@ void FVoxelCPUNoiseGenerator::GenerateChunkInfinitePlane(
 					// (smooth mesher scans up to 8 voxels for material selection)
 					if (Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 10.0f)
 					{
-						TArray<FOreVeinConfig> ApplicableOres;
-						BiomeConfig->GetOreVeinsForBiome(BiomeID, ApplicableOres);
+						TArray<FOreVeinConfig>* ApplicableOres = OreVeinsByBiome.Find(Column.BiomeID);
+						if (!ApplicableOres)
+						{
+							ApplicableOres = &OreVeinsByBiome.Add(Column.BiomeID);
+							BiomeConfig->GetOreVeinsForBiome(Column.BiomeID, *ApplicableOres);
+						}
 
 						uint8 OreMaterial = 0;
-						if (CheckOreVeinPlacement(WorldPos, DepthBelowSurface, ApplicableOres, Request.NoiseParams.Seed, OreMaterial))
+						if (CheckOreVeinPlacement(WorldPos, DepthBelowSurface, *ApplicableOres, Request.NoiseParams.Seed, OreMaterial))
 						{
 							MaterialID = OreMaterial;
 						}
@@ -359,46 +567,14 @@ void FVoxelCPUNoiseGenerator::GenerateChunkInfinitePlane(
 				else if (Request.bEnableBiomes)
 				{
 					// Fallback to static registry if no BiomeConfiguration provided
-					FVector BiomeSamplePos(WorldPos.X, WorldPos.Y, 0.0f);
-					float Temperature = FBM3D(BiomeSamplePos, TempNoiseParams);
-					float Moisture = FBM3D(BiomeSamplePos, MoistureNoiseParams);
-
-					FBiomeBlend Blend = FVoxelBiomeRegistry::GetBiomeBlend(Temperature, Moisture, 0.15f);
-					BiomeID = Blend.GetDominantBiome();
-					MaterialID = FVoxelBiomeRegistry::GetBlendedMaterial(Blend, DepthBelowSurface);
-
-					// Cave carving for fallback path
-					if (Request.bEnableCaves && Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
-					{
-						const bool bUnderwater = Request.bEnableWaterLevel && TerrainHeight < Request.WaterLevel;
-						float CaveDensity = CalculateCaveDensity(WorldPos, DepthBelowSurface, BiomeID, Request.CaveConfiguration, Request.NoiseParams.Seed, bUnderwater);
-						if (CaveDensity > 0.0f)
-						{
-							float NewDensity = FMath::Max(0.0f, static_cast<float>(Density) - CaveDensity * 255.0f);
-							Density = static_cast<uint8>(FMath::Clamp(NewDensity, 0.0f, 255.0f));
-						}
-					}
+					MaterialID = FVoxelBiomeRegistry::GetBlendedMaterial(Column.Blend, DepthBelowSurface);
 				}
 				else
 				{
 					// Legacy behavior: use world mode's material assignment
 					MaterialID = WorldMode.GetMaterialAtDepth(WorldPos, TerrainHeight, DepthBelowSurface * VoxelSize);
-
-					// Cave carving for non-biome path
-					if (Request.bEnableCaves && Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
-					{
-						const bool bUnderwater = Request.bEnableWaterLevel && TerrainHeight < Request.WaterLevel;
-						float CaveDensity = CalculateCaveDensity(WorldPos, DepthBelowSurface, 0, Request.CaveConfiguration, Request.NoiseParams.Seed, bUnderwater);
-						if (CaveDensity > 0.0f)
-						{
-							float NewDensity = FMath::Max(0.0f, static_cast<float>(Density) - CaveDensity * 255.0f);
-							Density = static_cast<uint8>(FMath::Clamp(NewDensity, 0.0f, 255.0f));
-						}
-					}
 				}
 
-				int32 Index = X + Y * ChunkSize + Z * ChunkSize * ChunkSize;
-
 				// Set cave flag and underground flag if cave carving converted solid to air.
 				// Cave flag: temporary barrier for water fill (cleared in Phase 3).
 				// Underground flag: persistent — used by scatter filtering and water plane.
@@ -406,7 +582,7 @@ void FVoxelCPUNoiseGenerator::GenerateChunkInfinitePlane(
 				const uint8 InitMetadata = bCaveCarved
 					? ((FVoxelData::VOXEL_FLAG_CAVE | FVoxelData::VOXEL_FLAG_UNDERGROUND) << 4)
 					: 0;
-				OutVoxelData[Index] = FVoxelData(MaterialID, Density, BiomeID, InitMetadata);
+				OutVoxelData[Index] = FVoxelData(MaterialID, Density, Column.BiomeID, InitMetadata);
 			}
 		}
 	}
@@ -836,255 +1012,630 @@ float FVoxelCPUNoiseGenerator::FBM3D(const FVector& Position, const FVoxelNoiseP
 	return Total / MaxValue;
 }
 
-void FVoxelCPUNoiseGenerator::GenerateChunkIslandBowl(
-	const FVoxelNoiseGenerationRequest& Request,
-	const FIslandBowlWorldMode& WorldMode,
-	TArray<FVoxelData>& OutVoxelData)
-{
-	const int32 ChunkSize = Request.ChunkSize;
-	// Always generate at base VoxelSize for voxel positioning
-	// LOD stride is applied during meshing, not generation
-	const float VoxelSize = Request.VoxelSize;
-	const FVector ChunkWorldPos = Request.GetChunkWorldPosition();
+// ==================== Batch Noise Algorithms ====================
 
-	// Get biome configuration (may be null if biomes disabled)
-	const UVoxelBiomeConfiguration* BiomeConfig = Request.BiomeConfiguration;
+// Runtime switch for the batch kernels' vector path (see the Batch Noise section of the header).
+static int32 GVoxelNoiseBatchSIMD = 1;
+static FAutoConsoleVariableRef CVarVoxelNoiseBatchSIMD(
+	TEXT("voxel.Noise.BatchSIMD"),
+	GVoxelNoiseBatchSIMD,
+	TEXT("1 (default): CPU batch noise kernels (Perlin/Simplex/Cellular/FBM _Batch) run 4 lanes wide ")
+	TEXT("via VectorRegister4Float (SSE/NEON). 0: scalar fallback. Both are bit-identical to the per-point functions."),
+	ECVF_Default);
 
-	// Hoisted continentalness snapshot for the per-voxel height modulation below (plain data; the
-	// per-voxel ComputeEffectiveTerrainParams call takes this instead of the UObject).
-	const FVoxelBiomeSnapshot BiomeSnapshot = FVoxelBiomeSnapshot::FromConfig(BiomeConfig);
+namespace VoxelNoiseBatch
+{
+	/** Points per FBM/cave block — bounds the stack scratch used for the per-octave scaled positions. */
+	constexpr int32 BlockSize = 64;
 
-	// Set up biome noise parameters from configuration
-	FVoxelNoiseParams TempNoiseParams;
-	TempNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
-	TempNoiseParams.Octaves = 2;
-	TempNoiseParams.Persistence = 0.5f;
-	TempNoiseParams.Lacunarity = 2.0f;
-	TempNoiseParams.Amplitude = 1.0f;
+	FORCEINLINE bool UseVectorPath()
+	{
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		return GVoxelNoiseBatchSIMD != 0;
+#else
+		return false;
+#endif
+	}
 
-	FVoxelNoiseParams MoistureNoiseParams;
-	MoistureNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
-	MoistureNoiseParams.Octaves = 2;
-	MoistureNoiseParams.Persistence = 0.5f;
-	MoistureNoiseParams.Lacunarity = 2.0f;
-	MoistureNoiseParams.Amplitude = 1.0f;
+	// File-local twins of the private FVoxelCPUNoiseGenerator::Hash / FastFloor (same expressions).
+	FORCEINLINE int32 Hash(int32 I, int32 Seed)
+	{
+		return PermutationTable[(I + Seed) & 255];
+	}
 
-	// Use configuration values if available, otherwise use defaults. (Continentalness noise params are built
-	// inside FInfinitePlaneWorldMode::ComputeEffectiveTerrainParams — the single source of truth shared with
-	// the analytic GetTerrainHeightAt query and applied per voxel below.)
-	if (BiomeConfig)
+	FORCEINLINE int32 FastFloor(float X)
 	{
-		TempNoiseParams.Seed = Request.NoiseParams.Seed + BiomeConfig->TemperatureSeedOffset;
-		TempNoiseParams.Frequency = BiomeConfig->TemperatureNoiseFrequency;
-		MoistureNoiseParams.Seed = Request.NoiseParams.Seed + BiomeConfig->MoistureSeedOffset;
-		MoistureNoiseParams.Frequency = BiomeConfig->MoistureNoiseFrequency;
+		const int32 Xi = static_cast<int32>(X);
+		return X < Xi ? Xi - 1 : Xi;
 	}
-	else
+
+	/** Perlin gradient (same as FVoxelCPUNoiseGenerator::Grad). */
+	FORCEINLINE float Grad(int32 InHash, float X, float Y, float Z)
 	{
-		TempNoiseParams.Seed = Request.NoiseParams.Seed + 1234;
-		TempNoiseParams.Frequency = 0.00005f;
-		MoistureNoiseParams.Seed = Request.NoiseParams.Seed + 5678;
-		MoistureNoiseParams.Frequency = 0.00007f;
+		const int32 H = InHash & 15;
+		const float U = H < 8 ? X : Y;
+		const float V = H < 4 ? Y : (H == 12 || H == 14 ? X : Z);
+		return ((H & 1) == 0 ? U : -U) + ((H & 2) == 0 ? V : -V);
 	}
 
-	for (int32 Z = 0; Z < ChunkSize; ++Z)
+	/** Simplex corner ordering for the cell-relative offset (X0,Y0,Z0) — same branches as Simplex3D. */
+	FORCEINLINE void SimplexCornerOrder(float X0, float Y0, float Z0,
+		int32& I1, int32& J1, int32& K1, int32& I2, int32& J2, int32& K2)
 	{
-		for (int32 Y = 0; Y < ChunkSize; ++Y)
+		if (X0 >= Y0)
 		{
-			for (int32 X = 0; X < ChunkSize; ++X)
-			{
-				// Calculate world position for this voxel (using base VoxelSize)
-				FVector WorldPos = ChunkWorldPos + FVector(
-					X * VoxelSize,
-					Y * VoxelSize,
-					Z * VoxelSize
-				);
-
-				// Continentalness height modulation (internal oceans/mountains) — the SAME shared source of
-				// truth as InfinitePlane, reused for biome selection below; then the island edge falloff.
-				// The two compose (continentalness shapes terrain inside the island, falloff fades it toward
-				// EdgeHeight at the world edge). Matches the analytic FIslandBowlWorldMode::GetTerrainHeightAt.
-				float Continentalness = 0.0f;
-				const FWorldModeTerrainParams EffectiveParams = FInfinitePlaneWorldMode::ComputeEffectiveTerrainParams(
-					WorldPos.X, WorldPos.Y, WorldMode.GetTerrainParams(), Request.NoiseParams, &BiomeSnapshot, Continentalness);
+			if (Y0 >= Z0) { I1 = 1; J1 = 0; K1 = 0; I2 = 1; J2 = 1; K2 = 0; }
+			else if (X0 >= Z0) { I1 = 1; J1 = 0; K1 = 0; I2 = 1; J2 = 0; K2 = 1; }
+			else { I1 = 0; J1 = 0; K1 = 1; I2 = 1; J2 = 0; K2 = 1; }
+		}
+		else
+		{
+			if (Y0 < Z0) { I1 = 0; J1 = 0; K1 = 1; I2 = 0; J2 = 1; K2 = 1; }
+			else if (X0 < Z0) { I1 = 0; J1 = 1; K1 = 0; I2 = 0; J2 = 1; K2 = 1; }
+			else { I1 = 0; J1 = 1; K1 = 0; I2 = 1; J2 = 1; K2 = 0; }
+		}
+	}
 
-				const float NoiseValue = FInfinitePlaneWorldMode::SampleTerrainNoise2D(
-					WorldPos.X, WorldPos.Y, Request.NoiseParams);
-				const float BaseTerrainHeight = FInfinitePlaneWorldMode::NoiseToTerrainHeight(NoiseValue, EffectiveParams);
+	/** Hash-based feature point offsets of cell (NX,NY,NZ) — same hashes as Cellular3D. */
+	FORCEINLINE void CellFeatureOffset(int32 NX, int32 NY, int32 NZ, int32 Seed, float& OutX, float& OutY, float& OutZ)
+	{
+		OutX = static_cast<float>(Hash(NX + Hash(NY + Hash(NZ, Seed), Seed), Seed)) / 255.0f;
+		OutY = static_cast<float>(Hash(NX + 127 + Hash(NY + 63 + Hash(NZ + 31, Seed), Seed), Seed)) / 255.0f;
+		OutZ = static_cast<float>(Hash(NX + 59 + Hash(NY + 113 + Hash(NZ + 97, Seed), Seed), Seed)) / 255.0f;
+	}
 
-				const FIslandBowlParams& IslandParams = WorldMode.GetIslandParams();
-				float TerrainHeight;
-				if (!FIslandBowlWorldMode::IsWithinIslandBounds(WorldPos.X, WorldPos.Y, IslandParams))
-				{
-					TerrainHeight = IslandParams.EdgeHeight - 1000.0f; // outside the island -> below any terrain (air)
-				}
-				else
-				{
-					const float FalloffFactor = FIslandBowlWorldMode::CalculateFalloffFactorForPoint(
-						WorldPos.X, WorldPos.Y, IslandParams);
-					TerrainHeight = FIslandBowlWorldMode::ApplyFalloffToHeight(
-						BaseTerrainHeight, FalloffFactor, IslandParams.EdgeHeight);
-				}
+	/**
+	 * Cellular F1/F2 core over pre-split cell coordinates and fractional offsets. The callers derive
+	 * the split from float (Cellular3D_Batch) or double (FBM3D_Batch) positions, matching what the
+	 * per-point Cellular3D computes from its FVector in each case.
+	 */
+	void CellularCore(const int32* CellX, const int32* CellY, const int32* CellZ,
+		const float* FracX, const float* FracY, const float* FracZ,
+		int32 Count, int32 Seed, float* OutF1, float* OutF2)
+	{
+		int32 Index = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		if (UseVectorPath())
+		{
+			const VectorRegister4Float VInit = VectorSetFloat1(100.0f);
+			for (; Index + 4 <= Count; Index += 4)
+			{
+				const VectorRegister4Float VFracX = VectorLoad(FracX + Index);
+				const VectorRegister4Float VFracY = VectorLoad(FracY + Index);
+				const VectorRegister4Float VFracZ = VectorLoad(FracZ + Index);
+				VectorRegister4Float VF1 = VInit;
+				VectorRegister4Float VF2 = VInit;
 
-				// Terrain conditioning (POI / claim flatten) — blend toward zones, then derive density.
-				if (Request.ConditioningZones.Num() > 0)
+				for (int32 dz = -1; dz <= 1; ++dz)
 				{
-					TerrainHeight = FVoxelTerrainConditioning::ApplyToHeight(
-						WorldPos.X, WorldPos.Y, TerrainHeight, Request.ConditioningZones);
-				}
+					for (int32 dy = -1; dy <= 1; ++dy)
+					{
+						for (int32 dx = -1; dx <= 1; ++dx)
+						{
+							alignas(16) float OffX[4], OffY[4], OffZ[4];
+							for (int32 Lane = 0; Lane < 4; ++Lane)
+							{
+								CellFeatureOffset(CellX[Index + Lane] + dx, CellY[Index + Lane] + dy, CellZ[Index + Lane] + dz,
+									Seed, OffX[Lane], OffY[Lane], OffZ[Lane]);
+							}
 
-				const float SignedDistance = FInfinitePlaneWorldMode::CalculateSignedDistance(WorldPos.Z, TerrainHeight);
-				uint8 Density = FInfinitePlaneWorldMode::SignedDistanceToDensity(SignedDistance, VoxelSize);
+							const VectorRegister4Float VDeltaX = VectorSubtract(
+								VectorAdd(VectorSetFloat1(static_cast<float>(dx)), VectorLoadAligned(OffX)), VFracX);
+							const VectorRegister4Float VDeltaY = VectorSubtract(
+								VectorAdd(VectorSetFloat1(static_cast<float>(dy)), VectorLoadAligned(OffY)), VFracY);
+							const VectorRegister4Float VDeltaZ = VectorSubtract(
+								VectorAdd(VectorSetFloat1(static_cast<float>(dz)), VectorLoadAligned(OffZ)), VFracZ);
 
-				// Calculate depth below surface for material assignment
-				float DepthBelowSurface = (TerrainHeight - WorldPos.Z) / VoxelSize;
+							const VectorRegister4Float VDistSq = VectorAdd(VectorAdd(
+								VectorMultiply(VDeltaX, VDeltaX), VectorMultiply(VDeltaY, VDeltaY)), VectorMultiply(VDeltaZ, VDeltaZ));
 
-				// Save pre-cave density to detect cave carving (solid → air transition)
-				const uint8 PreCaveDensity = Density;
+							// Branch-free form of the F1/F2 insertion: selects the same values as the
+							// per-point if/else-if (min/max only ever pick one of their inputs).
+							VF2 = VectorMin(VF2, VectorMax(VF1, VDistSq));
+							VF1 = VectorMin(VF1, VDistSq);
+						}
+					}
+				}
 
-				// Determine material and biome
-				uint8 MaterialID = 0;
-				uint8 BiomeID = 0;
+				VectorStore(VectorSqrt(VF1), OutF1 + Index);
+				VectorStore(VectorSqrt(VF2), OutF2 + Index);
+			}
+		}
+#endif
 
-				if (Request.bEnableBiomes && BiomeConfig && BiomeConfig->IsValid())
+		for (; Index < Count; ++Index)
+		{
+			float F1 = 100.0f;
+			float F2 = 100.0f;
+			for (int32 dz = -1; dz <= 1; ++dz)
+			{
+				for (int32 dy = -1; dy <= 1; ++dy)
 				{
-					// Sample biome noise at X,Y
-					FVector BiomeSamplePos(WorldPos.X, WorldPos.Y, 0.0f);
-					float Temperature = FBM3D(BiomeSamplePos, TempNoiseParams);
-					float Moisture = FBM3D(BiomeSamplePos, MoistureNoiseParams);
+					for (int32 dx = -1; dx <= 1; ++dx)
+					{
+						float OffX, OffY, OffZ;
+						CellFeatureOffset(CellX[Index] + dx, CellY[Index] + dy, CellZ[Index] + dz, Seed, OffX, OffY, OffZ);
 
-					// Get blended biome selection
-					FBiomeBlend Blend = BiomeConfig->GetBiomeBlend(Temperature, Moisture, Continentalness);
-					BiomeID = Blend.GetDominantBiome();
+						const float DeltaX = static_cast<float>(dx) + OffX - FracX[Index];
+						const float DeltaY = static_cast<float>(dy) + OffY - FracY[Index];
+						const float DeltaZ = static_cast<float>(dz) + OffZ - FracZ[Index];
+						const float DistSq = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
 
-					// Cave carving: subtract density for underground cavities
-					float CaveDensity = 0.0f;
-					if (Request.bEnableCaves && Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
-					{
-						const bool bUnderwater = Request.bEnableWaterLevel && TerrainHeight < Request.WaterLevel;
-						CaveDensity = CalculateCaveDensity(WorldPos, DepthBelowSurface, BiomeID, Request.CaveConfiguration, Request.NoiseParams.Seed, bUnderwater);
-						if (CaveDensity > 0.0f)
+						if (DistSq < F1)
 						{
-							float NewDensity = FMath::Max(0.0f, static_cast<float>(Density) - CaveDensity * 255.0f);
-							Density = static_cast<uint8>(FMath::Clamp(NewDensity, 0.0f, 255.0f));
+							F2 = F1;
+							F1 = DistSq;
+						}
+						else if (DistSq < F2)
+						{
+							F2 = DistSq;
 						}
 					}
+				}
+			}
+			OutF1[Index] = FMath::Sqrt(F1);
+			OutF2[Index] = FMath::Sqrt(F2);
+		}
+	}
+}
 
-					// Get material considering blend weights and water level
-					if (Request.bEnableWaterLevel)
-					{
-						MaterialID = BiomeConfig->GetBlendedMaterialWithWater(
-							Blend, DepthBelowSurface, TerrainHeight, Request.WaterLevel);
-					}
-					else
-					{
-						MaterialID = BiomeConfig->GetBlendedMaterial(Blend, DepthBelowSurface);
-					}
-
-					// Apply height-based material overrides
-					// Height rules still apply after water (snow on peaks even if base is underwater)
-					MaterialID = BiomeConfig->ApplyHeightMaterialRules(MaterialID, WorldPos.Z, DepthBelowSurface);
+const TCHAR* FVoxelCPUNoiseGenerator::GetBatchNoisePath()
+{
+	if (!VoxelNoiseBatch::UseVectorPath())
+	{
+		return TEXT("Scalar");
+	}
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	return TEXT("NEON");
+#else
+	return TEXT("SSE");
+#endif
+}
 
-					// Cave wall material override (solid voxels near cave boundaries)
-					if (Request.bEnableCaves && Request.CaveConfiguration
-						&& Request.CaveConfiguration->bOverrideCaveWallMaterial
-						&& CaveDensity > 0.0f && CaveDensity < 1.0f
-						&& Density >= VOXEL_SURFACE_THRESHOLD
-						&& DepthBelowSurface >= Request.CaveConfiguration->CaveWallMaterialMinDepth)
-					{
-						MaterialID = Request.CaveConfiguration->CaveWallMaterialID;
-					}
+void FVoxelCPUNoiseGenerator::Perlin3D_Batch(const float* X, const float* Y, const float* Z, int32 Count, int32 Seed, float* OutNoise)
+{
+	int32 Index = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	if (VoxelNoiseBatch::UseVectorPath())
+	{
+		const VectorRegister4Float VSix = VectorSetFloat1(6.0f);
+		const VectorRegister4Float VFifteen = VectorSetFloat1(15.0f);
+		const VectorRegister4Float VTen = VectorSetFloat1(10.0f);
 
-					// Apply ore vein overrides (only for solid voxels well below surface)
-					// Use depth > 10 to ensure ores aren't visible on smooth terrain surfaces
-					// (smooth mesher scans up to 8 voxels for material selection)
-					if (Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 10.0f)
-					{
-						TArray<FOreVeinConfig> ApplicableOres;
-						BiomeConfig->GetOreVeinsForBiome(BiomeID, ApplicableOres);
+		auto VFade = [&](const VectorRegister4Float& T)
+		{
+			// 6t^5 - 15t^4 + 10t^3, same operation order as Fade
+			return VectorMultiply(
+				VectorMultiply(VectorMultiply(T, T), T),
+				VectorAdd(VectorMultiply(T, VectorSubtract(VectorMultiply(T, VSix), VFifteen)), VTen));
+		};
+		auto VLerp = [](const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& T)
+		{
+			return VectorAdd(A, VectorMultiply(T, VectorSubtract(B, A)));
+		};
 
-						uint8 OreMaterial = 0;
-						if (CheckOreVeinPlacement(WorldPos, DepthBelowSurface, ApplicableOres, Request.NoiseParams.Seed, OreMaterial))
-						{
-							MaterialID = OreMaterial;
-						}
-					}
-				}
-				else if (Request.bEnableBiomes)
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			// Per lane: unit cube, cube-relative position and the 8 corner gradients (table lookups)
+			alignas(16) float RelX[4], RelY[4], RelZ[4];
+			alignas(16) float G[8][4];
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const float PX = X[Index + Lane];
+				const float PY = Y[Index + Lane];
+				const float PZ = Z[Index + Lane];
+
+				const int32 Xi = VoxelNoiseBatch::FastFloor(PX) & 255;
+				const int32 Yi = VoxelNoiseBatch::FastFloor(PY) & 255;
+				const int32 Zi = VoxelNoiseBatch::FastFloor(PZ) & 255;
+
+				const float RX = PX - VoxelNoiseBatch::FastFloor(PX);
+				const float RY = PY - VoxelNoiseBatch::FastFloor(PY);
+				const float RZ = PZ - VoxelNoiseBatch::FastFloor(PZ);
+				RelX[Lane] = RX;
+				RelY[Lane] = RY;
+				RelZ[Lane] = RZ;
+
+				const int32 A = VoxelNoiseBatch::Hash(Xi, Seed) + Yi;
+				const int32 AA = VoxelNoiseBatch::Hash(A, Seed) + Zi;
+				const int32 AB = VoxelNoiseBatch::Hash(A + 1, Seed) + Zi;
+				const int32 B = VoxelNoiseBatch::Hash(Xi + 1, Seed) + Yi;
+				const int32 BA = VoxelNoiseBatch::Hash(B, Seed) + Zi;
+				const int32 BB = VoxelNoiseBatch::Hash(B + 1, Seed) + Zi;
+
+				G[0][Lane] = VoxelNoiseBatch::Grad(VoxelNoiseBatch::Hash(AA, Seed), RX, RY, RZ);
+				G[1][Lane] = VoxelNoiseBatch::Grad(VoxelNoiseBatch::Hash(BA, Seed), RX - 1, RY, RZ);
+				G[2][Lane] = VoxelNoiseBatch::Grad(VoxelNoiseBatch::Hash(AB, Seed), RX, RY - 1, RZ);
+				G[3][Lane] = VoxelNoiseBatch::Grad(VoxelNoiseBatch::Hash(BB, Seed), RX - 1, RY - 1, RZ);
+				G[4][Lane] = VoxelNoiseBatch::Grad(VoxelNoiseBatch::Hash(AA + 1, Seed), RX, RY, RZ - 1);
+				G[5][Lane] = VoxelNoiseBatch::Grad(VoxelNoiseBatch::Hash(BA + 1, Seed), RX - 1, RY, RZ - 1);
+				G[6][Lane] = VoxelNoiseBatch::Grad(VoxelNoiseBatch::Hash(AB + 1, Seed), RX, RY - 1, RZ - 1);
+				G[7][Lane] = VoxelNoiseBatch::Grad(VoxelNoiseBatch::Hash(BB + 1, Seed), RX - 1, RY - 1, RZ - 1);
+			}
+
+			const VectorRegister4Float U = VFade(VectorLoadAligned(RelX));
+			const VectorRegister4Float V = VFade(VectorLoadAligned(RelY));
+			const VectorRegister4Float W = VFade(VectorLoadAligned(RelZ));
+
+			const VectorRegister4Float Res = VLerp(
+				VLerp(
+					VLerp(VectorLoadAligned(G[0]), VectorLoadAligned(G[1]), U),
+					VLerp(VectorLoadAligned(G[2]), VectorLoadAligned(G[3]), U), V),
+				VLerp(
+					VLerp(VectorLoadAligned(G[4]), VectorLoadAligned(G[5]), U),
+					VLerp(VectorLoadAligned(G[6]), VectorLoadAligned(G[7]), U), V), W);
+
+			VectorStore(Res, OutNoise + Index);
+		}
+	}
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		OutNoise[Index] = Perlin3D(FVector(X[Index], Y[Index], Z[Index]), Seed);
+	}
+}
+
+void FVoxelCPUNoiseGenerator::Simplex3D_Batch(const float* X, const float* Y, const float* Z, int32 Count, int32 Seed, float* OutNoise)
+{
+	int32 Index = 0;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	if (VoxelNoiseBatch::UseVectorPath())
+	{
+		const VectorRegister4Float VF3 = VectorSetFloat1(F3);
+		const VectorRegister4Float VG3 = VectorSetFloat1(G3);
+		const VectorRegister4Float VG3x2 = VectorSetFloat1(2.0f * G3);
+		const VectorRegister4Float VG3x3 = VectorSetFloat1(3.0f * G3);
+		const VectorRegister4Float VOne = VectorSetFloat1(1.0f);
+		const VectorRegister4Float VRadius = VectorSetFloat1(0.6f);
+		const VectorRegister4Float VScale = VectorSetFloat1(32.0f);
+		const VectorRegister4Float VZero = VectorZeroFloat();
+
+		// Contribution of one simplex corner, same operation order as Simplex3D.
+		auto VCorner = [&](const VectorRegister4Float& CX, const VectorRegister4Float& CY, const VectorRegister4Float& CZ,
+			const float* GX, const float* GY, const float* GZ)
+		{
+			const VectorRegister4Float T = VectorSubtract(VectorSubtract(VectorSubtract(
+				VRadius, VectorMultiply(CX, CX)), VectorMultiply(CY, CY)), VectorMultiply(CZ, CZ));
+			const VectorRegister4Float Dot = VectorAdd(VectorAdd(
+				VectorMultiply(VectorLoadAligned(GX), CX), VectorMultiply(VectorLoadAligned(GY), CY)),
+				VectorMultiply(VectorLoadAligned(GZ), CZ));
+			const VectorRegister4Float T2 = VectorMultiply(T, T);
+			const VectorRegister4Float N = VectorMultiply(VectorMultiply(T2, T2), Dot);
+			return VectorSelect(VectorCompareLT(T, VZero), VZero, N);
+		};
+
+		for (; Index + 4 <= Count; Index += 4)
+		{
+			const VectorRegister4Float VX = VectorLoad(X + Index);
+			const VectorRegister4Float VY = VectorLoad(Y + Index);
+			const VectorRegister4Float VZ = VectorLoad(Z + Index);
+
+			// Skew the input space to determine which simplex cell each lane is in
+			const VectorRegister4Float VS = VectorMultiply(VectorAdd(VectorAdd(VX, VY), VZ), VF3);
+			alignas(16) float SkewX[4], SkewY[4], SkewZ[4];
+			VectorStoreAligned(VectorAdd(VX, VS), SkewX);
+			VectorStoreAligned(VectorAdd(VY, VS), SkewY);
+			VectorStoreAligned(VectorAdd(VZ, VS), SkewZ);
+
+			int32 I[4], J[4], K[4];
+			alignas(16) float CellI[4], CellJ[4], CellK[4], Unskew[4];
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				I[Lane] = VoxelNoiseBatch::FastFloor(SkewX[Lane]);
+				J[Lane] = VoxelNoiseBatch::FastFloor(SkewY[Lane]);
+				K[Lane] = VoxelNoiseBatch::FastFloor(SkewZ[Lane]);
+				CellI[Lane] = static_cast<float>(I[Lane]);
+				CellJ[Lane] = static_cast<float>(J[Lane]);
+				CellK[Lane] = static_cast<float>(K[Lane]);
+				Unskew[Lane] = (I[Lane] + J[Lane] + K[Lane]) * G3;
+			}
+
+			const VectorRegister4Float VT = VectorLoadAligned(Unskew);
+			const VectorRegister4Float VX0 = VectorSubtract(VX, VectorSubtract(VectorLoadAligned(CellI), VT));
+			const VectorRegister4Float VY0 = VectorSubtract(VY, VectorSubtract(VectorLoadAligned(CellJ), VT));
+			const VectorRegister4Float VZ0 = VectorSubtract(VZ, VectorSubtract(VectorLoadAligned(CellK), VT));
+			alignas(16) float X0[4], Y0[4], Z0[4];
+			VectorStoreAligned(VX0, X0);
+			VectorStoreAligned(VY0, Y0);
+			VectorStoreAligned(VZ0, Z0);
+
+			// Per lane: corner ordering and gradient hashes (permutation lookups are gathers)
+			alignas(16) float Off1X[4], Off1Y[4], Off1Z[4], Off2X[4], Off2Y[4], Off2Z[4];
+			alignas(16) float GX[4][4], GY[4][4], GZ[4][4];
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				int32 I1, J1, K1, I2, J2, K2;
+				VoxelNoiseBatch::SimplexCornerOrder(X0[Lane], Y0[Lane], Z0[Lane], I1, J1, K1, I2, J2, K2);
+				Off1X[Lane] = static_cast<float>(I1);
+				Off1Y[Lane] = static_cast<float>(J1);
+				Off1Z[Lane] = static_cast<float>(K1);
+				Off2X[Lane] = static_cast<float>(I2);
+				Off2Y[Lane] = static_cast<float>(J2);
+				Off2Z[Lane] = static_cast<float>(K2);
+
+				const int32 II = I[Lane] & 255;
+				const int32 JJ = J[Lane] & 255;
+				const int32 KK = K[Lane] & 255;
+				const int32 Gi[4] = {
+					VoxelNoiseBatch::Hash(II + VoxelNoiseBatch::Hash(JJ + VoxelNoiseBatch::Hash(KK, Seed), Seed), Seed) % 12,
+					VoxelNoiseBatch::Hash(II + I1 + VoxelNoiseBatch::Hash(JJ + J1 + VoxelNoiseBatch::Hash(KK + K1, Seed), Seed), Seed) % 12,
+					VoxelNoiseBatch::Hash(II + I2 + VoxelNoiseBatch::Hash(JJ + J2 + VoxelNoiseBatch::Hash(KK + K2, Seed), Seed), Seed) % 12,
+					VoxelNoiseBatch::Hash(II + 1 + VoxelNoiseBatch::Hash(JJ + 1 + VoxelNoiseBatch::Hash(KK + 1, Seed), Seed), Seed) % 12
+				};
+				for (int32 Corner = 0; Corner < 4; ++Corner)
 				{
-					// Fallback to static registry
-					FVector BiomeSamplePos(WorldPos.X, WorldPos.Y, 0.0f);
-					float Temperature = FBM3D(BiomeSamplePos, TempNoiseParams);
-					float Moisture = FBM3D(BiomeSamplePos, MoistureNoiseParams);
+					GX[Corner][Lane] = static_cast<float>(Grad3[Gi[Corner]][0]);
+					GY[Corner][Lane] = static_cast<float>(Grad3[Gi[Corner]][1]);
+					GZ[Corner][Lane] = static_cast<float>(Grad3[Gi[Corner]][2]);
+				}
+			}
 
-					FBiomeBlend Blend = FVoxelBiomeRegistry::GetBiomeBlend(Temperature, Moisture, 0.15f);
-					BiomeID = Blend.GetDominantBiome();
-					MaterialID = FVoxelBiomeRegistry::GetBlendedMaterial(Blend, DepthBelowSurface);
+			// Offsets for corners
+			const VectorRegister4Float VX1 = VectorAdd(VectorSubtract(VX0, VectorLoadAligned(Off1X)), VG3);
+			const VectorRegister4Float VY1 = VectorAdd(VectorSubtract(VY0, VectorLoadAligned(Off1Y)), VG3);
+			const VectorRegister4Float VZ1 = VectorAdd(VectorSubtract(VZ0, VectorLoadAligned(Off1Z)), VG3);
+			const VectorRegister4Float VX2 = VectorAdd(VectorSubtract(VX0, VectorLoadAligned(Off2X)), VG3x2);
+			const VectorRegister4Float VY2 = VectorAdd(VectorSubtract(VY0, VectorLoadAligned(Off2Y)), VG3x2);
+			const VectorRegister4Float VZ2 = VectorAdd(VectorSubtract(VZ0, VectorLoadAligned(Off2Z)), VG3x2);
+			const VectorRegister4Float VX3 = VectorAdd(VectorSubtract(VX0, VOne), VG3x3);
+			const VectorRegister4Float VY3 = VectorAdd(VectorSubtract(VY0, VOne), VG3x3);
+			const VectorRegister4Float VZ3 = VectorAdd(VectorSubtract(VZ0, VOne), VG3x3);
+
+			const VectorRegister4Float N0 = VCorner(VX0, VY0, VZ0, GX[0], GY[0], GZ[0]);
+			const VectorRegister4Float N1 = VCorner(VX1, VY1, VZ1, GX[1], GY[1], GZ[1]);
+			const VectorRegister4Float N2 = VCorner(VX2, VY2, VZ2, GX[2], GY[2], GZ[2]);
+			const VectorRegister4Float N3 = VCorner(VX3, VY3, VZ3, GX[3], GY[3], GZ[3]);
+
+			// Sum and scale to [-1, 1]
+			VectorStore(VectorMultiply(VScale, VectorAdd(VectorAdd(VectorAdd(N0, N1), N2), N3)), OutNoise + Index);
+		}
+	}
+#endif
 
-					// Cave carving for fallback path
-					if (Request.bEnableCaves && Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
+	for (; Index < Count; ++Index)
+	{
+		OutNoise[Index] = Simplex3D(FVector(X[Index], Y[Index], Z[Index]), Seed);
+	}
+}
+
+void FVoxelCPUNoiseGenerator::Cellular3D_Batch(const float* X, const float* Y, const float* Z, int32 Count, int32 Seed, float* OutF1, float* OutF2)
+{
+	for (int32 Block = 0; Block < Count; Block += VoxelNoiseBatch::BlockSize)
+	{
+		const int32 Num = FMath::Min(VoxelNoiseBatch::BlockSize, Count - Block);
+		int32 CellX[VoxelNoiseBatch::BlockSize], CellY[VoxelNoiseBatch::BlockSize], CellZ[VoxelNoiseBatch::BlockSize];
+		float FracX[VoxelNoiseBatch::BlockSize], FracY[VoxelNoiseBatch::BlockSize], FracZ[VoxelNoiseBatch::BlockSize];
+		for (int32 i = 0; i < Num; ++i)
+		{
+			CellX[i] = FastFloor(X[Block + i]);
+			CellY[i] = FastFloor(Y[Block + i]);
+			CellZ[i] = FastFloor(Z[Block + i]);
+			// Cellular3D takes the fraction from its (double) FVector components
+			FracX[i] = static_cast<double>(X[Block + i]) - CellX[i];
+			FracY[i] = static_cast<double>(Y[Block + i]) - CellY[i];
+			FracZ[i] = static_cast<double>(Z[Block + i]) - CellZ[i];
+		}
+		VoxelNoiseBatch::CellularCore(CellX, CellY, CellZ, FracX, FracY, FracZ, Num, Seed, OutF1 + Block, OutF2 + Block);
+	}
+}
+
+void FVoxelCPUNoiseGenerator::FBM3D_Batch(const double* X, const double* Y, const double* Z, int32 Count, const FVoxelNoiseParams& Params, float* OutNoise)
+{
+	constexpr int32 BlockSize = VoxelNoiseBatch::BlockSize;
+
+	for (int32 Block = 0; Block < Count; Block += BlockSize)
+	{
+		const int32 Num = FMath::Min(BlockSize, Count - Block);
+
+		float Total[BlockSize];
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Total[i] = 0.0f;
+		}
+
+		float Frequency = Params.Frequency;
+		float Amplitude = Params.Amplitude;
+		float MaxValue = 0.0f; // Used for normalizing result
+
+		for (int32 Octave = 0; Octave < Params.Octaves; ++Octave)
+		{
+			// Same rounding as FBM3D: scale in double (FVector * float), then the kernels take floats
+			float NoiseValue[BlockSize];
+			if (Params.NoiseType == EVoxelNoiseType::Cellular || Params.NoiseType == EVoxelNoiseType::Voronoi)
+			{
+				if (Params.NoiseType == EVoxelNoiseType::Cellular)
+				{
+					// Cellular3D floors the float-converted position but takes the fraction in double
+					int32 CellX[BlockSize], CellY[BlockSize], CellZ[BlockSize];
+					float FracX[BlockSize], FracY[BlockSize], FracZ[BlockSize];
+					for (int32 i = 0; i < Num; ++i)
 					{
-						const bool bUnderwater = Request.bEnableWaterLevel && TerrainHeight < Request.WaterLevel;
-						float CaveDensity = CalculateCaveDensity(WorldPos, DepthBelowSurface, BiomeID, Request.CaveConfiguration, Request.NoiseParams.Seed, bUnderwater);
-						if (CaveDensity > 0.0f)
-						{
-							float NewDensity = FMath::Max(0.0f, static_cast<float>(Density) - CaveDensity * 255.0f);
-							Density = static_cast<uint8>(FMath::Clamp(NewDensity, 0.0f, 255.0f));
-						}
+						const double SX = X[Block + i] * Frequency;
+						const double SY = Y[Block + i] * Frequency;
+						const double SZ = Z[Block + i] * Frequency;
+						CellX[i] = FastFloor(SX);
+						CellY[i] = FastFloor(SY);
+						CellZ[i] = FastFloor(SZ);
+						FracX[i] = SX - CellX[i];
+						FracY[i] = SY - CellY[i];
+						FracZ[i] = SZ - CellZ[i];
+					}
+
+					float F1[BlockSize], F2[BlockSize];
+					VoxelNoiseBatch::CellularCore(CellX, CellY, CellZ, FracX, FracY, FracZ, Num, Params.Seed, F1, F2);
+					for (int32 i = 0; i < Num; ++i)
+					{
+						// Cellular: use F1 distance, map from [0, ~1.5] to [-1, 1]
+						NoiseValue[i] = F1[i] * 2.0f - 1.0f;
 					}
 				}
 				else
 				{
-					// Use world mode's material assignment
-					MaterialID = WorldMode.GetMaterialAtDepth(WorldPos, TerrainHeight, DepthBelowSurface * VoxelSize);
-
-					// Cave carving for non-biome path
-					if (Request.bEnableCaves && Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
+					// Voronoi has no batch kernel (cell ID bookkeeping); evaluate per point
+					for (int32 i = 0; i < Num; ++i)
 					{
-						const bool bUnderwater = Request.bEnableWaterLevel && TerrainHeight < Request.WaterLevel;
-						float CaveDensity = CalculateCaveDensity(WorldPos, DepthBelowSurface, 0, Request.CaveConfiguration, Request.NoiseParams.Seed, bUnderwater);
-						if (CaveDensity > 0.0f)
-						{
-							float NewDensity = FMath::Max(0.0f, static_cast<float>(Density) - CaveDensity * 255.0f);
-							Density = static_cast<uint8>(FMath::Clamp(NewDensity, 0.0f, 255.0f));
-						}
+						float F1, F2, CellID;
+						Voronoi3D(FVector(X[Block + i], Y[Block + i], Z[Block + i]) * Frequency, Params.Seed, F1, F2, CellID);
+						NoiseValue[i] = (F2 - F1) * 2.0f - 1.0f;
 					}
 				}
+			}
+			else
+			{
+				float SX[BlockSize], SY[BlockSize], SZ[BlockSize];
+				for (int32 i = 0; i < Num; ++i)
+				{
+					SX[i] = static_cast<float>(X[Block + i] * Frequency);
+					SY[i] = static_cast<float>(Y[Block + i] * Frequency);
+					SZ[i] = static_cast<float>(Z[Block + i] * Frequency);
+				}
 
-				int32 Index = X + Y * ChunkSize + Z * ChunkSize * ChunkSize;
+				if (Params.NoiseType == EVoxelNoiseType::Perlin)
+				{
+					Perlin3D_Batch(SX, SY, SZ, Num, Params.Seed, NoiseValue);
+				}
+				else
+				{
+					Simplex3D_Batch(SX, SY, SZ, Num, Params.Seed, NoiseValue);
+				}
+			}
 
-				const bool bCaveCarved = (PreCaveDensity >= VOXEL_SURFACE_THRESHOLD && Density < VOXEL_SURFACE_THRESHOLD);
-				const uint8 InitMetadata = bCaveCarved
-					? ((FVoxelData::VOXEL_FLAG_CAVE | FVoxelData::VOXEL_FLAG_UNDERGROUND) << 4)
-					: 0;
-				OutVoxelData[Index] = FVoxelData(MaterialID, Density, BiomeID, InitMetadata);
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Total[i] += NoiseValue[i] * Amplitude;
 			}
+			MaxValue += Amplitude;
+
+			Amplitude *= Params.Persistence;
+			Frequency *= Params.Lacunarity;
+		}
+
+		// Normalize to [-1, 1] range
+		for (int32 i = 0; i < Num; ++i)
+		{
+			OutNoise[Block + i] = Total[i] / MaxValue;
 		}
 	}
 }
 
+void FVoxelCPUNoiseGenerator::GenerateChunkIslandBowl(
+	const FVoxelNoiseGenerationRequest& Request,
+	const FIslandBowlWorldMode& WorldMode,
+	TArray<FVoxelData>& OutVoxelData)
+{
+	const int32 ChunkSize = Request.ChunkSize;
+	// Always generate at base VoxelSize for voxel positioning (a strided request skips voxels, it
+	// doesn't enlarge them)
+	const float VoxelSize = Request.VoxelSize;
+	const FVector ChunkWorldPos = Request.GetChunkWorldPosition();
+
+	// Sampled coordinates per axis: every voxel, or the lattice + apron of a strided request
+	TArray<int32> AxisCoords;
+	FVoxelStridedLattice::BuildAxisCoords(ChunkSize, GetEffectiveGenerationStride(Request), AxisCoords);
+	const int32 M = AxisCoords.Num();
+
+	// Hoisted continentalness snapshot for the per-column height modulation below (plain data; the
+	// per-column ComputeEffectiveTerrainParams call takes this instead of the UObject).
+	const FVoxelBiomeSnapshot BiomeSnapshot = FVoxelBiomeSnapshot::FromConfig(Request.BiomeConfiguration);
+
+	const FIslandBowlParams& IslandParams = WorldMode.GetIslandParams();
+
+	// Column stage (see GenerateChunkInfinitePlane): island height is a 2D field, computed once per column.
+	TArray<FTerrainColumn> Columns;
+	Columns.SetNum(M * M);
+
+	TArray<float> RowX, RowY, RowHeight, RowContinentalness;
+	RowX.SetNumUninitialized(M);
+	RowY.SetNumUninitialized(M);
+	RowHeight.SetNumUninitialized(M);
+	RowContinentalness.SetNumUninitialized(M);
+
+	for (int32 J = 0; J < M; ++J)
+	{
+		const int32 Y = AxisCoords[J];
+		for (int32 I = 0; I < M; ++I)
+		{
+			const int32 X = AxisCoords[I];
+			const FVector ColumnPos = ChunkWorldPos + FVector(X * VoxelSize, Y * VoxelSize, 0.0f);
+			RowX[I] = ColumnPos.X;
+			RowY[I] = ColumnPos.Y;
+		}
+
+		// Continentalness height modulation (internal oceans/mountains) — the SAME shared source of
+		// truth as InfinitePlane, reused for biome selection; then the island edge falloff.
+		// The two compose (continentalness shapes terrain inside the island, falloff fades it toward
+		// EdgeHeight at the world edge). Matches the analytic FIslandBowlWorldMode::GetTerrainHeightAt.
+		FInfinitePlaneWorldMode::ComputeTerrainHeights_Batch(
+			RowX.GetData(), RowY.GetData(), M, WorldMode.GetTerrainParams(), Request.NoiseParams,
+			&BiomeSnapshot, RowHeight.GetData(), RowContinentalness.GetData());
+
+		for (int32 I = 0; I < M; ++I)
+		{
+			const int32 X = AxisCoords[I];
+			FTerrainColumn& Column = Columns[I + J * M];
+			Column.Continentalness = RowContinentalness[I];
+
+			float TerrainHeight;
+			if (!FIslandBowlWorldMode::IsWithinIslandBounds(RowX[I], RowY[I], IslandParams))
+			{
+				TerrainHeight = IslandParams.EdgeHeight - 1000.0f; // outside the island -> below any terrain (air)
+			}
+			else
+			{
+				const float FalloffFactor = FIslandBowlWorldMode::CalculateFalloffFactorForPoint(
+					RowX[I], RowY[I], IslandParams);
+				TerrainHeight = FIslandBowlWorldMode::ApplyFalloffToHeight(
+					RowHeight[I], FalloffFactor, IslandParams.EdgeHeight);
+			}
+
+			// Terrain conditioning (POI / claim flatten) — blend toward zones, then derive density.
+			if (Request.ConditioningZones.Num() > 0)
+			{
+				const FVector ColumnPos = ChunkWorldPos + FVector(X * VoxelSize, Y * VoxelSize, 0.0f);
+				TerrainHeight = FVoxelTerrainConditioning::ApplyToHeight(
+					ColumnPos.X, ColumnPos.Y, TerrainHeight, Request.ConditioningZones);
+			}
+
+			Column.TerrainHeight = TerrainHeight;
+		}
+	}
+
+	ResolveColumnBiomes(Request, AxisCoords, Columns);
+	FillChunkFromTerrainColumns(Request, WorldMode, AxisCoords, Columns, OutVoxelData);
+}
+
 // ==================== Cave Generation Helpers ====================
 
-float FVoxelCPUNoiseGenerator::SampleCaveLayer(const FVector& WorldPos, const FCaveLayerConfig& LayerConfig, int32 WorldSeed)
+// Shared by the per-point and batch cave paths so both carve identically.
+namespace VoxelCaveCarve
 {
-	// Apply vertical scale to flatten caves horizontally
-	FVector ScaledPos(WorldPos.X, WorldPos.Y, WorldPos.Z * LayerConfig.VerticalScale);
-
-	// Build noise params for first noise field
-	FVoxelNoiseParams CaveNoiseParams;
-	CaveNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
-	CaveNoiseParams.Seed = WorldSeed + LayerConfig.SeedOffset;
-	CaveNoiseParams.Frequency = LayerConfig.Frequency;
-	CaveNoiseParams.Octaves = LayerConfig.Octaves;
-	CaveNoiseParams.Persistence = LayerConfig.Persistence;
-	CaveNoiseParams.Lacunarity = LayerConfig.Lacunarity;
-	CaveNoiseParams.Amplitude = 1.0f;
+	/** Noise params for a layer's primary field. */
+	FVoxelNoiseParams MakeLayerNoiseParams(const FCaveLayerConfig& LayerConfig, int32 WorldSeed)
+	{
+		FVoxelNoiseParams CaveNoiseParams;
+		CaveNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
+		CaveNoiseParams.Seed = WorldSeed + LayerConfig.SeedOffset;
+		CaveNoiseParams.Frequency = LayerConfig.Frequency;
+		CaveNoiseParams.Octaves = LayerConfig.Octaves;
+		CaveNoiseParams.Persistence = LayerConfig.Persistence;
+		CaveNoiseParams.Lacunarity = LayerConfig.Lacunarity;
+		CaveNoiseParams.Amplitude = 1.0f;
+		return CaveNoiseParams;
+	}
 
-	if (LayerConfig.CaveType == ECaveType::Cheese)
+	/** Second noise field of a Spaghetti/Noodle layer: offset seed and scaled frequency. */
+	FVoxelNoiseParams MakeSecondNoiseParams(const FCaveLayerConfig& LayerConfig, int32 WorldSeed)
 	{
-		// Cheese caves: single noise field, carve where noise > threshold
-		float Noise = FBM3D(ScaledPos, CaveNoiseParams);
+		FVoxelNoiseParams SecondNoiseParams = MakeLayerNoiseParams(LayerConfig, WorldSeed);
+		SecondNoiseParams.Seed = WorldSeed + LayerConfig.SecondNoiseSeedOffset;
+		SecondNoiseParams.Frequency = LayerConfig.Frequency * LayerConfig.SecondNoiseFrequencyScale;
+		return SecondNoiseParams;
+	}
 
+	/** Cheese caves: single noise field, carve where noise > threshold. */
+	float CheeseCarve(const FCaveLayerConfig& LayerConfig, float Noise)
+	{
 		// Noise is in [-1, 1], map threshold to that range
 		if (Noise <= LayerConfig.Threshold)
 		{
@@ -1098,19 +1649,10 @@ float FVoxelCPUNoiseGenerator::SampleCaveLayer(const FVector& WorldPos, const FC
 
 		return CarveDensity * LayerConfig.CarveStrength;
 	}
-	else
-	{
-		// Spaghetti and Noodle: dual-noise intersection
-		// Tunnel forms where BOTH noise fields are near zero simultaneously
-		float Noise1 = FBM3D(ScaledPos, CaveNoiseParams);
-
-		// Second noise field with offset seed and scaled frequency
-		FVoxelNoiseParams SecondNoiseParams = CaveNoiseParams;
-		SecondNoiseParams.Seed = WorldSeed + LayerConfig.SecondNoiseSeedOffset;
-		SecondNoiseParams.Frequency = LayerConfig.Frequency * LayerConfig.SecondNoiseFrequencyScale;
-
-		float Noise2 = FBM3D(ScaledPos, SecondNoiseParams);
 
+	/** Spaghetti and Noodle: tunnel forms where BOTH noise fields are near zero simultaneously. */
+	float TunnelCarve(const FCaveLayerConfig& LayerConfig, float Noise1, float Noise2)
+	{
 		// Both noise fields must be within [-Threshold, Threshold] for a tunnel
 		float AbsNoise1 = FMath::Abs(Noise1);
 		float AbsNoise2 = FMath::Abs(Noise2);
@@ -1133,42 +1675,119 @@ float FVoxelCPUNoiseGenerator::SampleCaveLayer(const FVector& WorldPos, const FC
 
 		return CarveDensity * LayerConfig.CarveStrength;
 	}
-}
 
-float FVoxelCPUNoiseGenerator::CalculateCaveDensity(
-	const FVector& WorldPos,
-	float DepthBelowSurface,
-	uint8 BiomeID,
-	const UVoxelCaveConfiguration* CaveConfig,
-	int32 WorldSeed,
-	bool bIsUnderwater)
-{
-	if (!CaveConfig || !CaveConfig->bEnableCaves)
+	/**
+	 * Per-column cave context: biome scale and the effective min-depth override (biome override,
+	 * raised to the underwater min depth for submerged columns). Returns false when nothing can carve.
+	 */
+	bool ResolveColumnContext(
+		const UVoxelCaveConfiguration* CaveConfig,
+		uint8 BiomeID,
+		bool bIsUnderwater,
+		float& OutBiomeCaveScale,
+		float& OutBiomeMinDepthOverride)
 	{
-		return 0.0f;
+		if (!CaveConfig || !CaveConfig->bEnableCaves)
+		{
+			return false;
+		}
+
+		// Get biome scaling
+		OutBiomeCaveScale = CaveConfig->GetBiomeCaveScale(BiomeID);
+		if (OutBiomeCaveScale <= 0.0f)
+		{
+			return false;
+		}
+
+		OutBiomeMinDepthOverride = CaveConfig->GetBiomeMinDepthOverride(BiomeID);
+
+		// Apply underwater min depth — catches biome transition zones where the
+		// ocean biome isn't assigned but terrain is still below water level
+		if (bIsUnderwater && CaveConfig->UnderwaterMinDepth > 0.0f)
+		{
+			if (OutBiomeMinDepthOverride < 0.0f)
+			{
+				OutBiomeMinDepthOverride = CaveConfig->UnderwaterMinDepth;
+			}
+			else
+			{
+				OutBiomeMinDepthOverride = FMath::Max(OutBiomeMinDepthOverride, CaveConfig->UnderwaterMinDepth);
+			}
+		}
+
+		return true;
 	}
 
-	// Get biome scaling
-	float BiomeCaveScale = CaveConfig->GetBiomeCaveScale(BiomeID);
-	if (BiomeCaveScale <= 0.0f)
+	/** Whether a depth lies inside a layer's depth window (including its fade bands). */
+	bool IsWithinLayerDepth(const FCaveLayerConfig& Layer, float DepthBelowSurface, float EffectiveMinDepth)
 	{
-		return 0.0f;
-	}
+		if (DepthBelowSurface < EffectiveMinDepth - Layer.DepthFadeWidth)
+		{
+			return false;
+		}
+
+		if (Layer.MaxDepth > 0.0f && DepthBelowSurface > Layer.MaxDepth + Layer.DepthFadeWidth)
+		{
+			return false;
+		}
 
-	float BiomeMinDepthOverride = CaveConfig->GetBiomeMinDepthOverride(BiomeID);
+		return true;
+	}
 
-	// Apply underwater min depth — catches biome transition zones where the
-	// ocean biome isn't assigned but terrain is still below water level
-	if (bIsUnderwater && CaveConfig->UnderwaterMinDepth > 0.0f)
+	/** Fade a layer's carve across its MinDepth / MaxDepth boundary bands. */
+	float ApplyLayerDepthFade(const FCaveLayerConfig& Layer, float DepthBelowSurface, float EffectiveMinDepth, float LayerCarve)
 	{
-		if (BiomeMinDepthOverride < 0.0f)
+		// Apply depth fade at MinDepth boundary
+		if (DepthBelowSurface < EffectiveMinDepth)
 		{
-			BiomeMinDepthOverride = CaveConfig->UnderwaterMinDepth;
+			float FadeT = (DepthBelowSurface - (EffectiveMinDepth - Layer.DepthFadeWidth)) / Layer.DepthFadeWidth;
+			LayerCarve *= FMath::SmoothStep(0.0f, 1.0f, FadeT);
 		}
-		else
+
+		// Apply depth fade at MaxDepth boundary
+		if (Layer.MaxDepth > 0.0f && DepthBelowSurface > Layer.MaxDepth)
 		{
-			BiomeMinDepthOverride = FMath::Max(BiomeMinDepthOverride, CaveConfig->UnderwaterMinDepth);
+			float FadeT = 1.0f - (DepthBelowSurface - Layer.MaxDepth) / Layer.DepthFadeWidth;
+			LayerCarve *= FMath::SmoothStep(0.0f, 1.0f, FadeT);
 		}
+
+		return LayerCarve;
+	}
+}
+
+float FVoxelCPUNoiseGenerator::SampleCaveLayer(const FVector& WorldPos, const FCaveLayerConfig& LayerConfig, int32 WorldSeed)
+{
+	// Apply vertical scale to flatten caves horizontally
+	FVector ScaledPos(WorldPos.X, WorldPos.Y, WorldPos.Z * LayerConfig.VerticalScale);
+
+	const FVoxelNoiseParams CaveNoiseParams = VoxelCaveCarve::MakeLayerNoiseParams(LayerConfig, WorldSeed);
+
+	if (LayerConfig.CaveType == ECaveType::Cheese)
+	{
+		return VoxelCaveCarve::CheeseCarve(LayerConfig, FBM3D(ScaledPos, CaveNoiseParams));
+	}
+	else
+	{
+		// Spaghetti and Noodle: dual-noise intersection
+		const float Noise1 = FBM3D(ScaledPos, CaveNoiseParams);
+		const float Noise2 = FBM3D(ScaledPos, VoxelCaveCarve::MakeSecondNoiseParams(LayerConfig, WorldSeed));
+		return VoxelCaveCarve::TunnelCarve(LayerConfig, Noise1, Noise2);
+	}
+}
+
+float FVoxelCPUNoiseGenerator::CalculateCaveDensity(
+	const FVector& WorldPos,
+	float DepthBelowSurface,
+	uint8 BiomeID,
+	const UVoxelCaveConfiguration* CaveConfig,
+	int32 WorldSeed,
+	bool bIsUnderwater)
+{
+	float BiomeCaveScale = 0.0f;
+	float BiomeMinDepthOverride = -1.0f;
+	if (!VoxelCaveCarve::ResolveColumnContext(CaveConfig, BiomeID, bIsUnderwater, BiomeCaveScale, BiomeMinDepthOverride))
+	{
+		return 0.0f;
 	}
 
 	float MaxCarveDensity = 0.0f;
@@ -1184,12 +1803,7 @@ float FVoxelCPUNoiseGenerator::CalculateCaveDensity(
 		float EffectiveMinDepth = (BiomeMinDepthOverride >= 0.0f) ? BiomeMinDepthOverride : Layer.MinDepth;
 
 		// Check depth constraints
-		if (DepthBelowSurface < EffectiveMinDepth - Layer.DepthFadeWidth)
-		{
-			continue;
-		}
-
-		if (Layer.MaxDepth > 0.0f && DepthBelowSurface > Layer.MaxDepth + Layer.DepthFadeWidth)
+		if (!VoxelCaveCarve::IsWithinLayerDepth(Layer, DepthBelowSurface, EffectiveMinDepth))
 		{
 			continue;
 		}
@@ -1202,19 +1816,7 @@ float FVoxelCPUNoiseGenerator::CalculateCaveDensity(
 			continue;
 		}
 
-		// Apply depth fade at MinDepth boundary
-		if (DepthBelowSurface < EffectiveMinDepth)
-		{
-			float FadeT = (DepthBelowSurface - (EffectiveMinDepth - Layer.DepthFadeWidth)) / Layer.DepthFadeWidth;
-			LayerCarve *= FMath::SmoothStep(0.0f, 1.0f, FadeT);
-		}
-
-		// Apply depth fade at MaxDepth boundary
-		if (Layer.MaxDepth > 0.0f && DepthBelowSurface > Layer.MaxDepth)
-		{
-			float FadeT = 1.0f - (DepthBelowSurface - Layer.MaxDepth) / Layer.DepthFadeWidth;
-			LayerCarve *= FMath::SmoothStep(0.0f, 1.0f, FadeT);
-		}
+		LayerCarve = VoxelCaveCarve::ApplyLayerDepthFade(Layer, DepthBelowSurface, EffectiveMinDepth, LayerCarve);
 
 		// Union composition: take the maximum carve from any layer
 		MaxCarveDensity = FMath::Max(MaxCarveDensity, LayerCarve);
@@ -1224,6 +1826,106 @@ float FVoxelCPUNoiseGenerator::CalculateCaveDensity(
 	return FMath::Clamp(MaxCarveDensity * BiomeCaveScale, 0.0f, 1.0f);
 }
 
+void FVoxelCPUNoiseGenerator::CalculateCaveDensity_Batch(
+	const double* X, const double* Y, const double* Z,
+	const float* DepthBelowSurface,
+	int32 Count,
+	uint8 BiomeID,
+	const UVoxelCaveConfiguration* CaveConfig,
+	int32 WorldSeed,
+	bool bIsUnderwater,
+	float* OutCarveDensity)
+{
+	constexpr int32 BlockSize = VoxelNoiseBatch::BlockSize;
+
+	float BiomeCaveScale = 0.0f;
+	float BiomeMinDepthOverride = -1.0f;
+	if (!VoxelCaveCarve::ResolveColumnContext(CaveConfig, BiomeID, bIsUnderwater, BiomeCaveScale, BiomeMinDepthOverride))
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			OutCarveDensity[i] = 0.0f;
+		}
+		return;
+	}
+
+	for (int32 Block = 0; Block < Count; Block += BlockSize)
+	{
+		const int32 Num = FMath::Min(BlockSize, Count - Block);
+
+		float MaxCarveDensity[BlockSize];
+		for (int32 i = 0; i < Num; ++i)
+		{
+			MaxCarveDensity[i] = 0.0f;
+		}
+
+		for (const FCaveLayerConfig& Layer : CaveConfig->CaveLayers)
+		{
+			if (!Layer.bEnabled)
+			{
+				continue;
+			}
+
+			const float EffectiveMinDepth = (BiomeMinDepthOverride >= 0.0f) ? BiomeMinDepthOverride : Layer.MinDepth;
+
+			// Compact the points inside this layer's depth window, with the layer's vertical scale applied
+			int32 Active[BlockSize];
+			double SX[BlockSize], SY[BlockSize], SZ[BlockSize];
+			int32 NumActive = 0;
+			for (int32 i = 0; i < Num; ++i)
+			{
+				if (VoxelCaveCarve::IsWithinLayerDepth(Layer, DepthBelowSurface[Block + i], EffectiveMinDepth))
+				{
+					Active[NumActive] = i;
+					SX[NumActive] = X[Block + i];
+					SY[NumActive] = Y[Block + i];
+					SZ[NumActive] = Z[Block + i] * Layer.VerticalScale;
+					++NumActive;
+				}
+			}
+
+			if (NumActive == 0)
+			{
+				continue;
+			}
+
+			float Noise1[BlockSize];
+			FBM3D_Batch(SX, SY, SZ, NumActive, VoxelCaveCarve::MakeLayerNoiseParams(Layer, WorldSeed), Noise1);
+
+			float Noise2[BlockSize];
+			const bool bTunnel = (Layer.CaveType != ECaveType::Cheese);
+			if (bTunnel)
+			{
+				FBM3D_Batch(SX, SY, SZ, NumActive, VoxelCaveCarve::MakeSecondNoiseParams(Layer, WorldSeed), Noise2);
+			}
+
+			for (int32 a = 0; a < NumActive; ++a)
+			{
+				float LayerCarve = bTunnel
+					? VoxelCaveCarve::TunnelCarve(Layer, Noise1[a], Noise2[a])
+					: VoxelCaveCarve::CheeseCarve(Layer, Noise1[a]);
+
+				if (LayerCarve <= 0.0f)
+				{
+					continue;
+				}
+
+				const int32 i = Active[a];
+				LayerCarve = VoxelCaveCarve::ApplyLayerDepthFade(Layer, DepthBelowSurface[Block + i], EffectiveMinDepth, LayerCarve);
+
+				// Union composition: take the maximum carve from any layer
+				MaxCarveDensity[i] = FMath::Max(MaxCarveDensity[i], LayerCarve);
+			}
+		}
+
+		// Apply biome scaling
+		for (int32 i = 0; i < Num; ++i)
+		{
+			OutCarveDensity[Block + i] = FMath::Clamp(MaxCarveDensity[i] * BiomeCaveScale, 0.0f, 1.0f);
+		}
+	}
+}
+
 // ==================== Ore Vein Helpers ====================
 
 float FVoxelCPUNoiseGenerator::SampleOreVeinNoise(const FVector& WorldPos, const FOreVeinConfig& OreConfig, int32 WorldSeed)
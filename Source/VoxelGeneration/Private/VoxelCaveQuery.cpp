@@ -26,6 +26,64 @@ float FVoxelCaveQuery::SampleCaveDensityAt(
 		return 0.0f;
 	}
 
-	return FVoxelCPUNoiseGenerator::CalculateCaveDensity(
-		WorldPos, DepthBelowSurface, BiomeID, CaveConfig, WorldSeed, bIsUnderwater);
+	const double Z = WorldPos.Z;
+	float CarveDensity = 0.0f;
+	SampleCaveDensityColumn(WorldPos.X, WorldPos.Y, &Z, 1, SurfaceHeight, VoxelSize, BiomeID, CaveConfig, WorldSeed,
+		bIsUnderwater, &CarveDensity);
+	return CarveDensity;
+}
+
+void FVoxelCaveQuery::SampleCaveDensityColumn(
+	double X,
+	double Y,
+	const double* Z,
+	int32 Count,
+	float SurfaceHeight,
+	float VoxelSize,
+	uint8 BiomeID,
+	const UVoxelCaveConfiguration* CaveConfig,
+	int32 WorldSeed,
+	bool bIsUnderwater,
+	float* OutCarveDensity)
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutCarveDensity[i] = 0.0f;
+	}
+	if (!CaveConfig || VoxelSize <= 0.0f || Count <= 0)
+	{
+		return;
+	}
+
+	// Same candidate compaction as the generator's cave pre-pass: only points strictly below the
+	// surface go through the batch kernel; the rest stay 0.
+	TArray<double, TInlineAllocator<64>> CandX, CandY, CandZ;
+	TArray<float, TInlineAllocator<64>> CandDepth, CandCarve;
+	TArray<int32, TInlineAllocator<64>> CandIndex;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const float DepthBelowSurface = (SurfaceHeight - static_cast<float>(Z[i])) / VoxelSize;
+		if (DepthBelowSurface > 0.0f)
+		{
+			CandX.Add(X);
+			CandY.Add(Y);
+			CandZ.Add(Z[i]);
+			CandDepth.Add(DepthBelowSurface);
+			CandIndex.Add(i);
+		}
+	}
+	if (CandIndex.Num() == 0)
+	{
+		return;
+	}
+
+	CandCarve.SetNumUninitialized(CandIndex.Num());
+	FVoxelCPUNoiseGenerator::CalculateCaveDensity_Batch(
+		CandX.GetData(), CandY.GetData(), CandZ.GetData(), CandDepth.GetData(), CandIndex.Num(),
+		BiomeID, CaveConfig, WorldSeed, bIsUnderwater, CandCarve.GetData());
+
+	for (int32 c = 0; c < CandIndex.Num(); ++c)
+	{
+		OutCarveDensity[CandIndex[c]] = CandCarve[c];
+	}
 }
@@ -62,11 +62,26 @@ void FVoxelSurfaceQuery::QuerySurfaceConditions(
 	bool bEnableWaterLevel, float WaterLevel,
 	uint8& OutSurfaceMaterial, uint8& OutBiomeID)
 {
-	OutSurfaceMaterial = 0;
-	OutBiomeID = 0;
+	QuerySurfaceConditionsBatch(
+		&WorldX, &WorldY, &TerrainHeight, 1, VoxelSize,
+		BiomeSnapshot, WorldSeed, bEnableWaterLevel, WaterLevel,
+		&OutSurfaceMaterial, &OutBiomeID);
+}
 
+void FVoxelSurfaceQuery::QuerySurfaceConditionsBatch(
+	const float* WorldX, const float* WorldY, const float* TerrainHeight, int32 Count, float VoxelSize,
+	const FVoxelBiomeSnapshot& BiomeSnapshot,
+	int32 WorldSeed,
+	bool bEnableWaterLevel, float WaterLevel,
+	uint8* OutSurfaceMaterial, uint8* OutBiomeID)
+{
 	if (!BiomeSnapshot.bIsValid)
 	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			OutSurfaceMaterial[i] = 0;
+			OutBiomeID[i] = 0;
+		}
 		return;
 	}
 
@@ -89,43 +104,64 @@ void FVoxelSurfaceQuery::QuerySurfaceConditions(
 	MoistureNoiseParams.Seed = WorldSeed + BiomeSnapshot.MoistureSeedOffset;
 	MoistureNoiseParams.Frequency = BiomeSnapshot.MoistureNoiseFrequency;
 
-	// Sample at this world position (Z=0 for 2D biome sampling)
-	const FVector BiomeSamplePos(WorldX, WorldY, 0.0f);
-	const float Temperature = FVoxelCPUNoiseGenerator::FBM3D(BiomeSamplePos, TempNoiseParams);
-	const float Moisture = FVoxelCPUNoiseGenerator::FBM3D(BiomeSamplePos, MoistureNoiseParams);
-
-	// Sample continentalness noise if enabled
-	float Continentalness = 0.0f;
-	if (BiomeSnapshot.bEnableContinentalness)
+	FVoxelNoiseParams ContNoiseParams;
+	ContNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
+	ContNoiseParams.Octaves = 2;
+	ContNoiseParams.Persistence = 0.5f;
+	ContNoiseParams.Lacunarity = 2.0f;
+	ContNoiseParams.Amplitude = 1.0f;
+	ContNoiseParams.Seed = WorldSeed + BiomeSnapshot.ContinentalnessSeedOffset;
+	ContNoiseParams.Frequency = BiomeSnapshot.ContinentalnessNoiseFrequency;
+
+	constexpr int32 BlockSize = 64;
+	for (int32 Block = 0; Block < Count; Block += BlockSize)
 	{
-		FVoxelNoiseParams ContNoiseParams;
-		ContNoiseParams.NoiseType = EVoxelNoiseType::Simplex;
-		ContNoiseParams.Octaves = 2;
-		ContNoiseParams.Persistence = 0.5f;
-		ContNoiseParams.Lacunarity = 2.0f;
-		ContNoiseParams.Amplitude = 1.0f;
-		ContNoiseParams.Seed = WorldSeed + BiomeSnapshot.ContinentalnessSeedOffset;
-		ContNoiseParams.Frequency = BiomeSnapshot.ContinentalnessNoiseFrequency;
-		Continentalness = FVoxelCPUNoiseGenerator::FBM3D(BiomeSamplePos, ContNoiseParams);
-	}
+		const int32 Num = FMath::Min(BlockSize, Count - Block);
 
-	// Select biome (now with continentalness for proper tiered gating)
-	FBiomeBlend Blend = BiomeSnapshot.GetBiomeBlend(Temperature, Moisture, Continentalness);
-	OutBiomeID = Blend.GetDominantBiome();
+		// Sample at these world positions (Z=0 for 2D biome sampling)
+		double SX[BlockSize], SY[BlockSize], SZ[BlockSize];
+		for (int32 i = 0; i < Num; ++i)
+		{
+			SX[i] = WorldX[Block + i];
+			SY[i] = WorldY[Block + i];
+			SZ[i] = 0.0;
+		}
 
-	// Get surface material (depth = 0 for surface)
-	const bool bIsUnderwater = bEnableWaterLevel && TerrainHeight < WaterLevel;
-	if (bIsUnderwater)
-	{
-		OutSurfaceMaterial = BiomeSnapshot.GetBlendedMaterialWithWater(Blend, 0.0f, TerrainHeight, WaterLevel);
-	}
-	else
-	{
-		OutSurfaceMaterial = BiomeSnapshot.GetBlendedMaterial(Blend, 0.0f);
-	}
+		float Temperature[BlockSize], Moisture[BlockSize], Continentalness[BlockSize];
+		FVoxelCPUNoiseGenerator::FBM3D_Batch(SX, SY, SZ, Num, TempNoiseParams, Temperature);
+		FVoxelCPUNoiseGenerator::FBM3D_Batch(SX, SY, SZ, Num, MoistureNoiseParams, Moisture);
+
+		// Sample continentalness noise if enabled
+		if (BiomeSnapshot.bEnableContinentalness)
+		{
+			FVoxelCPUNoiseGenerator::FBM3D_Batch(SX, SY, SZ, Num, ContNoiseParams, Continentalness);
+		}
+		else
+		{
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Continentalness[i] = 0.0f;
+			}
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const float Height = TerrainHeight[Block + i];
+
+			// Select biome (now with continentalness for proper tiered gating)
+			const FBiomeBlend Blend = BiomeSnapshot.GetBiomeBlend(Temperature[i], Moisture[i], Continentalness[i]);
+			OutBiomeID[Block + i] = Blend.GetDominantBiome();
 
-	// Apply height material rules (snow on peaks, etc.)
-	OutSurfaceMaterial = BiomeSnapshot.ApplyHeightMaterialRules(OutSurfaceMaterial, TerrainHeight, 0.0f);
+			// Get surface material (depth = 0 for surface)
+			const bool bIsUnderwater = bEnableWaterLevel && Height < WaterLevel;
+			uint8 SurfaceMaterial = bIsUnderwater
+				? BiomeSnapshot.GetBlendedMaterialWithWater(Blend, 0.0f, Height, WaterLevel)
+				: BiomeSnapshot.GetBlendedMaterial(Blend, 0.0f);
+
+			// Apply height material rules (snow on peaks, etc.)
+			OutSurfaceMaterial[Block + i] = BiomeSnapshot.ApplyHeightMaterialRules(SurfaceMaterial, Height, 0.0f);
+		}
+	}
 }
 
 FVoxelSurfaceSample FVoxelSurfaceQuery::SampleSurface(
@@ -67,6 +67,26 @@ public:
 		float Y,
 		const FVoxelNoiseParams& NoiseParams) const = 0;
 
+	/**
+	 * Batch form of GetTerrainHeightAt: OutHeights[i] = GetTerrainHeightAt(X[i], Y[i], NoiseParams).
+	 *
+	 * Heightmap modes override this to evaluate whole rows through the batch noise kernels
+	 * (FVoxelCPUNoiseGenerator::FBM3D_Batch); results are bit-identical to the scalar query.
+	 * Default: scalar loop.
+	 */
+	virtual void GetTerrainHeightsAt(
+		const float* X,
+		const float* Y,
+		int32 Count,
+		const FVoxelNoiseParams& NoiseParams,
+		float* OutHeights) const
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			OutHeights[i] = GetTerrainHeightAt(X[i], Y[i], NoiseParams);
+		}
+	}
+
 	// ==================== Coordinate Transforms ====================
 
 	/**
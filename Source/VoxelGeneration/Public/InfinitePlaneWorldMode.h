@@ -61,6 +61,13 @@ public:
 		float Y,
 		const FVoxelNoiseParams& NoiseParams) const override;
 
+	virtual void GetTerrainHeightsAt(
+		const float* X,
+		const float* Y,
+		int32 Count,
+		const FVoxelNoiseParams& NoiseParams,
+		float* OutHeights) const override;
+
 	virtual FIntVector WorldToChunkCoord(
 		const FVector& WorldPos,
 		int32 ChunkSize,
@@ -151,6 +158,39 @@ public:
 		float Y,
 		const FVoxelNoiseParams& NoiseParams);
 
+	/**
+	 * Batch SampleTerrainNoise2D: OutNoise[i] = SampleTerrainNoise2D(X[i], Y[i], NoiseParams),
+	 * evaluated through FVoxelCPUNoiseGenerator::FBM3D_Batch (bit-identical).
+	 */
+	static void SampleTerrainNoise2D_Batch(
+		const float* X,
+		const float* Y,
+		int32 Count,
+		const FVoxelNoiseParams& NoiseParams,
+		float* OutNoise);
+
+	/**
+	 * Batch heightmap: base terrain noise + continentalness modulation + NoiseToTerrainHeight for
+	 * Count points — the batched form of SampleTerrainNoise2D -> ComputeEffectiveTerrainParams ->
+	 * NoiseToTerrainHeight, bit-identical to calling those per point.
+	 *
+	 * @param X,Y                World XY sample positions, Count entries each
+	 * @param BaseParams         Un-modulated terrain params
+	 * @param NoiseParams        Terrain noise params
+	 * @param BiomeSnapshot      Continentalness source, or null (no modulation)
+	 * @param OutHeights         Count terrain heights
+	 * @param OutContinentalness Optional (may be null): Count sampled continentalness values (0 when disabled)
+	 */
+	static void ComputeTerrainHeights_Batch(
+		const float* X,
+		const float* Y,
+		int32 Count,
+		const FWorldModeTerrainParams& BaseParams,
+		const FVoxelNoiseParams& NoiseParams,
+		const FVoxelBiomeSnapshot* BiomeSnapshot,
+		float* OutHeights,
+		float* OutContinentalness = nullptr);
+
 	/**
 	 * Convert terrain noise to height.
 	 *
@@ -152,6 +152,13 @@ public:
 		float Y,
 		const FVoxelNoiseParams& NoiseParams) const override;
 
+	virtual void GetTerrainHeightsAt(
+		const float* X,
+		const float* Y,
+		int32 Count,
+		const FVoxelNoiseParams& NoiseParams,
+		float* OutHeights) const override;
+
 	virtual FIntVector WorldToChunkCoord(
 		const FVector& WorldPos,
 		int32 ChunkSize,
@@ -9,6 +9,7 @@
 class FInfinitePlaneWorldMode;
 class FIslandBowlWorldMode;
 class FSphericalPlanetWorldMode;
+class IVoxelWorldMode;
 class UVoxelCaveConfiguration;
 struct FCaveLayerConfig;
 
@@ -109,6 +110,63 @@ public:
 	 */
 	static void Voronoi3D(const FVector& Position, int32 Seed, float& OutF1, float& OutF2, float& OutCellID);
 
+	// ==================== Batch Noise Algorithms ====================
+	//
+	// Structure-of-arrays entry points that evaluate Count points per call. Each output is
+	// bit-identical to the matching per-point function above (pinned by the batch parity tests in
+	// VoxelNoiseGeneratorTests.cpp). The arithmetic runs 4 lanes wide through VectorRegister4Float
+	// (SSE or NEON, whichever the platform compiles) when voxel.Noise.BatchSIMD is 1; permutation
+	// table lookups stay per lane. voxel.Noise.BatchSIMD 0, or a platform without vector intrinsics,
+	// takes the scalar fallback.
+	//
+	// Thread Safety: thread-safe (no shared state).
+
+	/**
+	 * Batch Perlin3D. Equivalent to OutNoise[i] = Perlin3D(FVector(X[i], Y[i], Z[i]), Seed).
+	 *
+	 * @param X,Y,Z Sample positions (already scaled by frequency), Count entries each
+	 * @param Count Number of points
+	 * @param Seed Random seed for permutation table
+	 * @param OutNoise Count noise values in range [-1, 1]
+	 */
+	static void Perlin3D_Batch(const float* X, const float* Y, const float* Z, int32 Count, int32 Seed, float* OutNoise);
+
+	/**
+	 * Batch Simplex3D. Equivalent to OutNoise[i] = Simplex3D(FVector(X[i], Y[i], Z[i]), Seed).
+	 *
+	 * @param X,Y,Z Sample positions (already scaled by frequency), Count entries each
+	 * @param Count Number of points
+	 * @param Seed Random seed for permutation table
+	 * @param OutNoise Count noise values in range [-1, 1]
+	 */
+	static void Simplex3D_Batch(const float* X, const float* Y, const float* Z, int32 Count, int32 Seed, float* OutNoise);
+
+	/**
+	 * Batch Cellular3D. Equivalent to Cellular3D(FVector(X[i], Y[i], Z[i]), Seed, OutF1[i], OutF2[i]).
+	 *
+	 * @param X,Y,Z Sample positions (already scaled by frequency), Count entries each
+	 * @param Count Number of points
+	 * @param Seed Random seed
+	 * @param OutF1 Count distances to the nearest feature point
+	 * @param OutF2 Count distances to the second nearest feature point
+	 */
+	static void Cellular3D_Batch(const float* X, const float* Y, const float* Z, int32 Count, int32 Seed, float* OutF1, float* OutF2);
+
+	/**
+	 * Batch FBM3D. Equivalent to OutNoise[i] = FBM3D(FVector(X[i], Y[i], Z[i]), Params).
+	 * Positions are world-space doubles (as FBM3D's FVector) so the per-octave frequency scaling
+	 * rounds exactly like the per-point path.
+	 *
+	 * @param X,Y,Z World positions, Count entries each
+	 * @param Count Number of points
+	 * @param Params Noise parameters (octaves, frequency, etc.)
+	 * @param OutNoise Count noise values in range approximately [-1, 1]
+	 */
+	static void FBM3D_Batch(const double* X, const double* Y, const double* Z, int32 Count, const FVoxelNoiseParams& Params, float* OutNoise);
+
+	/** Name of the code path the batch kernels currently take ("SSE", "NEON" or "Scalar"). */
+	static const TCHAR* GetBatchNoisePath();
+
 	/**
 	 * Run the post-generation passes (water fill + underground classification) on already-generated
 	 * voxel data. GenerateChunkCPU runs these inline; the GPU path runs shader ports of the same
@@ -118,6 +176,14 @@ public:
 	 */
 	static void ApplyPostReadbackPasses(const FVoxelNoiseGenerationRequest& Request, TArray<FVoxelData>& OutVoxelData);
 
+	/**
+	 * Stride GenerateChunkCPU will actually generate Request at: Request.GenerationStride for the
+	 * cave-free heightmap modes (InfinitePlane, IslandBowl) when it is a valid FVoxelStridedLattice
+	 * stride for the chunk size, else 1. When > 1, GenerateChunkCPU outputs the compact lattice layout
+	 * (FVoxelStridedLattice::GetCompactVoxelCount entries) instead of ChunkSize^3 voxels.
+	 */
+	static int32 GetEffectiveGenerationStride(const FVoxelNoiseGenerationRequest& Request);
+
 private:
 	bool bIsInitialized = false;
 
@@ -161,6 +227,53 @@ private:
 		const FSphericalPlanetWorldMode& WorldMode,
 		TArray<FVoxelData>& OutVoxelData);
 
+	// ==================== Heightmap Column Cache ====================
+
+	/**
+	 * Per-(X,Y) terrain inputs shared by every voxel in a column of a heightmap world mode.
+	 * Built once per chunk (one entry per sampled (X,Y), indexed I + J * AxisCoords.Num()) so the 2D noise,
+	 * continentalness, conditioning and climate sampling run per column instead of per voxel.
+	 */
+	struct FTerrainColumn
+	{
+		/** Final surface height (continentalness, island falloff and conditioning applied) */
+		float TerrainHeight = 0.0f;
+
+		/** Continentalness sampled while computing the height, reused for the biome blend */
+		float Continentalness = 0.0f;
+
+		/** Biome blend for the column (default single-biome blend when biomes are disabled) */
+		FBiomeBlend Blend;
+
+		/** Dominant biome of Blend (0 when biomes are disabled) */
+		uint8 BiomeID = 0;
+
+		/** Column surface lies below the water level (cave carving keeps a roof under water) */
+		bool bUnderwater = false;
+	};
+
+	/**
+	 * Fill the biome blend, dominant biome and water flag of each column from its TerrainHeight
+	 * and Continentalness. Shared by every heightmap world mode.
+	 */
+	static void ResolveColumnBiomes(
+		const FVoxelNoiseGenerationRequest& Request,
+		const TArray<int32>& AxisCoords,
+		TArray<FTerrainColumn>& Columns);
+
+	/**
+	 * 3D fill pass for heightmap world modes: density, cave carving, materials and ores per voxel,
+	 * reading all column-invariant inputs from the column cache. Bit-identical to sampling the
+	 * column inputs per voxel (pinned by HeightIsosurfaceParityTests). Writes one voxel per sampled
+	 * coordinate triple (AxisCoords on every axis), so a strided request fills the compact layout.
+	 */
+	static void FillChunkFromTerrainColumns(
+		const FVoxelNoiseGenerationRequest& Request,
+		const IVoxelWorldMode& WorldMode,
+		const TArray<int32>& AxisCoords,
+		const TArray<FTerrainColumn>& Columns,
+		TArray<FVoxelData>& OutVoxelData);
+
 	// ==================== Noise Helper Functions ====================
 
 	/** Fade function for smooth interpolation */
@@ -222,6 +335,31 @@ public:
 		int32 WorldSeed,
 		bool bIsUnderwater = false);
 
+	/**
+	 * Batch CalculateCaveDensity for points that share one surface column context (biome and
+	 * underwater flag), e.g. the voxels of one generated column. Equivalent to
+	 * OutCarveDensity[i] = CalculateCaveDensity(FVector(X[i], Y[i], Z[i]), DepthBelowSurface[i], ...).
+	 * Each cave layer only samples the points inside its depth window, through FBM3D_Batch.
+	 *
+	 * @param X,Y,Z World positions, Count entries each
+	 * @param DepthBelowSurface Count depths below the terrain surface in voxels
+	 * @param Count Number of points
+	 * @param BiomeID Biome ID for per-biome overrides (shared by all points)
+	 * @param CaveConfig Cave configuration data asset
+	 * @param WorldSeed Base world seed
+	 * @param bIsUnderwater Whether the surface column is submerged (shared by all points)
+	 * @param OutCarveDensity Count carve densities in range [0, 1]
+	 */
+	static void CalculateCaveDensity_Batch(
+		const double* X, const double* Y, const double* Z,
+		const float* DepthBelowSurface,
+		int32 Count,
+		uint8 BiomeID,
+		const UVoxelCaveConfiguration* CaveConfig,
+		int32 WorldSeed,
+		bool bIsUnderwater,
+		float* OutCarveDensity);
+
 private:
 	// ==================== Ore Vein Helpers ====================
 
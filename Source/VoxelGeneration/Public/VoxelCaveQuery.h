@@ -10,7 +10,7 @@ class UVoxelCaveConfiguration;
  * Stateless, thread-safe cave queries against the procedural generator.
  *
  * The cave-layer sibling of FVoxelSurfaceQuery: answers "how carved is world position P" by
- * re-running the CPU generator's cave-carving math (FVoxelCPUNoiseGenerator::CalculateCaveDensity),
+ * re-running the CPU generator's cave-carving math (FVoxelCPUNoiseGenerator::CalculateCaveDensity_Batch),
  * decoupled from chunk streaming so it works for any region whether or not a chunk is loaded.
  *
  * Deterministic for a given (cave config, seed). Safe to call off the game thread. Used by the
@@ -18,7 +18,7 @@ class UVoxelCaveConfiguration;
  * needs "is there a cave here" without a resident chunk.
  *
  * @see FVoxelSurfaceQuery
- * @see FVoxelCPUNoiseGenerator::CalculateCaveDensity
+ * @see FVoxelCPUNoiseGenerator::CalculateCaveDensity_Batch
  */
 class VOXELGENERATION_API FVoxelCaveQuery
 {
@@ -48,4 +48,26 @@ public:
 		const UVoxelCaveConfiguration* CaveConfig,
 		int32 WorldSeed,
 		bool bIsUnderwater = false);
+
+	/**
+	 * Carve densities for Count positions in one surface column (shared X/Y, surface height, biome
+	 * and underwater flag) in a single FVoxelCPUNoiseGenerator::CalculateCaveDensity_Batch call.
+	 * OutCarveDensity[i] equals SampleCaveDensityAt(FVector(X, Y, Z[i]), ...); SampleCaveDensityAt
+	 * is this with Count == 1.
+	 *
+	 * @param Z               Count world Z positions.
+	 * @param OutCarveDensity Count carve densities in [0,1].
+	 */
+	static void SampleCaveDensityColumn(
+		double X,
+		double Y,
+		const double* Z,
+		int32 Count,
+		float SurfaceHeight,
+		float VoxelSize,
+		uint8 BiomeID,
+		const UVoxelCaveConfiguration* CaveConfig,
+		int32 WorldSeed,
+		bool bIsUnderwater,
+		float* OutCarveDensity);
 };
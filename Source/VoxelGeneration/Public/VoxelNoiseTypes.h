@@ -134,6 +134,15 @@ struct VOXELGENERATION_API FVoxelNoiseGenerationRequest
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Request")
 	int32 ChunkSize = 32;
 
+	/**
+	 * Voxel lattice stride to generate at (1 = every voxel). When > 1, the CPU heightmap generator
+	 * only samples the lattice the mesher reads at this stride plus the deep-plane apron neighbours
+	 * need, and returns the compact FVoxelStridedLattice layout instead of ChunkSize^3 voxels (see
+	 * FVoxelCPUNoiseGenerator::GetEffectiveGenerationStride). Other generators/modes ignore it.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Request")
+	int32 GenerationStride = 1;
+
 	/** Size of each voxel in world units */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Request")
 	float VoxelSize = 100.0f;
@@ -93,6 +93,20 @@ public:
 		bool bEnableWaterLevel, float WaterLevel,
 		uint8& OutSurfaceMaterial, uint8& OutBiomeID);
 
+	/**
+	 * Batch form of QuerySurfaceConditions for Count points (e.g. one map-tile row). Biome noise goes
+	 * through FVoxelCPUNoiseGenerator::FBM3D_Batch; results are bit-identical to the per-point query.
+	 *
+	 * @param WorldX,WorldY,TerrainHeight Count entries each
+	 * @param OutSurfaceMaterial,OutBiomeID Count entries each (0 when the snapshot is invalid)
+	 */
+	static void QuerySurfaceConditionsBatch(
+		const float* WorldX, const float* WorldY, const float* TerrainHeight, int32 Count, float VoxelSize,
+		const FVoxelBiomeSnapshot& BiomeSnapshot,
+		int32 WorldSeed,
+		bool bEnableWaterLevel, float WaterLevel,
+		uint8* OutSurfaceMaterial, uint8* OutBiomeID);
+
 	/**
 	 * Convenience: sample everything (height, normal, slope, material, biome) at a world X,Y.
 	 * Computes the height gradient once and derives both slope and normal from it.
@@ -19,10 +19,12 @@
 #include "IVoxelWorldMode.h"
 #include "VoxelCPUNoiseGenerator.h"
 #include "VoxelBiomeConfiguration.h"
+#include "VoxelCaveConfiguration.h"
 #include "VoxelNoiseTypes.h"
 #include "VoxelTerrainConditioning.h"
 #include "VoxelSurfaceQuery.h"
 #include "VoxelData.h"
+#include "VoxelStridedLattice.h"
 
 namespace
 {
@@ -442,3 +444,388 @@ bool FVoxelHeightBoundsContainmentTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ---------------------------------------------------------------------------
+// HT6: the per-chunk column cache in GenerateChunkInfinitePlane is bit-identical to evaluating the
+// column inputs (2D noise, continentalness, conditioning) independently for every voxel, which is what
+// generation did before the column stage. Compares density + material of every voxel in a surface
+// chunk against that per-voxel oracle.
+// ---------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelHeightColumnCacheParityTest,
+	"VoxelWorlds.Generation.HeightParity.ColumnCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelHeightColumnCacheParityTest::RunTest(const FString& Parameters)
+{
+	UVoxelBiomeConfiguration* Config = MakeContinentalnessConfig();
+	const FVoxelNoiseParams Noise = MakeTerrainNoise();
+	const FWorldModeTerrainParams Base = MakeBaseParams();
+	const FVoxelBiomeSnapshot Snapshot = FVoxelBiomeSnapshot::FromConfig(Config);
+
+	FInfinitePlaneWorldMode WorldMode(Base);
+	WorldMode.SetBiomeContext(Config);
+
+	FVoxelCPUNoiseGenerator Generator;
+	Generator.Initialize();
+
+	// Straddle a conditioning zone edge so the conditioned and natural heights both appear in the chunk.
+	const FVector2D Center(100000.0f, -30000.0f);
+	const float NaturalAtCenter = WorldMode.GetTerrainHeightAt(Center.X, Center.Y, Noise);
+	TArray<FVoxelConditioningZone> Zones;
+	Zones.Add(FVoxelConditioningZone(Center, 1000.0f, 1000.0f, NaturalAtCenter + 500.0f, 1.0f));
+
+	const float ChunkWorldSize = kChunkSize * kVoxelSize;
+
+	FVoxelNoiseGenerationRequest Request;
+	Request.ChunkCoord = FIntVector(
+		FMath::FloorToInt(Center.X / ChunkWorldSize),
+		FMath::FloorToInt(Center.Y / ChunkWorldSize),
+		FMath::FloorToInt(NaturalAtCenter / ChunkWorldSize));
+	Request.ChunkSize = kChunkSize;
+	Request.VoxelSize = kVoxelSize;
+	Request.LODLevel = 0;
+	Request.WorldMode = EWorldMode::InfinitePlane;
+	Request.SeaLevel = kSeaLevel;
+	Request.HeightScale = kHeightScale;
+	Request.BaseHeight = kBaseHeight;
+	Request.bEnableBiomes = false;
+	Request.bEnableCaves = false;
+	Request.BiomeConfiguration = Config;
+	Request.NoiseParams = Noise;
+	Request.ConditioningZones = Zones;
+
+	TArray<FVoxelData> ChunkData;
+	if (!TestTrue(TEXT("Chunk generated"), Generator.GenerateChunkCPU(Request, ChunkData)))
+	{
+		Config->RemoveFromRoot();
+		return false;
+	}
+
+	const FVector ChunkWorldPos = Request.GetChunkWorldPosition();
+	int32 Mismatches = 0;
+	int32 SolidCount = 0;
+
+	for (int32 Z = 0; Z < kChunkSize; ++Z)
+	{
+		for (int32 Y = 0; Y < kChunkSize; ++Y)
+		{
+			for (int32 X = 0; X < kChunkSize; ++X)
+			{
+				const FVector WorldPos = ChunkWorldPos + FVector(X * kVoxelSize, Y * kVoxelSize, Z * kVoxelSize);
+
+				const float NoiseValue = FInfinitePlaneWorldMode::SampleTerrainNoise2D(WorldPos.X, WorldPos.Y, Noise);
+				float Continentalness = 0.0f;
+				const FWorldModeTerrainParams Eff = FInfinitePlaneWorldMode::ComputeEffectiveTerrainParams(
+					WorldPos.X, WorldPos.Y, Base, Noise, &Snapshot, Continentalness);
+				float TerrainHeight = FInfinitePlaneWorldMode::NoiseToTerrainHeight(NoiseValue, Eff);
+				TerrainHeight = FVoxelTerrainConditioning::ApplyToHeight(WorldPos.X, WorldPos.Y, TerrainHeight, Zones);
+
+				const uint8 Density = FInfinitePlaneWorldMode::SignedDistanceToDensity(
+					FInfinitePlaneWorldMode::CalculateSignedDistance(WorldPos.Z, TerrainHeight), kVoxelSize);
+				const float DepthBelowSurface = (TerrainHeight - WorldPos.Z) / kVoxelSize;
+				const uint8 MaterialID = WorldMode.GetMaterialAtDepth(WorldPos, TerrainHeight, DepthBelowSurface * kVoxelSize);
+
+				const FVoxelData& Voxel = ChunkData[X + Y * kChunkSize + Z * kChunkSize * kChunkSize];
+				if (Voxel.Density != Density || Voxel.MaterialID != MaterialID)
+				{
+					++Mismatches;
+				}
+				if (Voxel.IsSolid())
+				{
+					++SolidCount;
+				}
+			}
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Column cache chunk %s: %d solid voxels, %d mismatches vs per-voxel oracle"),
+		*Request.ChunkCoord.ToString(), SolidCount, Mismatches));
+	TestTrue(TEXT("Chunk straddles the surface (mixed solid and air)"),
+		SolidCount > 0 && SolidCount < kChunkSize * kChunkSize * kChunkSize);
+	TestEqual(TEXT("Column-cached generation is bit-identical to per-voxel evaluation"), Mismatches, 0);
+
+	Config->RemoveFromRoot();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// HT6b: column-cache parity with biomes, caves and a water level enabled. The per-voxel oracle
+// re-samples climate noise, the biome blend, the underwater flag and cave carving for every voxel
+// (scalar FBM3D / CalculateCaveDensity), so the cached blend, dominant biome and batched cave pre-pass
+// are all pinned. Ore placement is private to the generator: a deep solid voxel whose material differs
+// from the oracle must carry one of its biome's ore materials.
+// ---------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelHeightColumnCacheBiomeCaveParityTest,
+	"VoxelWorlds.Generation.HeightParity.ColumnCacheBiomesCaves",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelHeightColumnCacheBiomeCaveParityTest::RunTest(const FString& Parameters)
+{
+	UVoxelBiomeConfiguration* Config = MakeContinentalnessConfig();
+	UVoxelCaveConfiguration* CaveConfig = NewObject<UVoxelCaveConfiguration>();
+	CaveConfig->AddToRoot();
+	CaveConfig->bEnableCaves = true;
+	CaveConfig->bOverrideCaveWallMaterial = true;
+
+	const FVoxelNoiseParams Noise = MakeTerrainNoise();
+	const FWorldModeTerrainParams Base = MakeBaseParams();
+	const FVoxelBiomeSnapshot Snapshot = FVoxelBiomeSnapshot::FromConfig(Config);
+
+	FInfinitePlaneWorldMode WorldMode(Base);
+	WorldMode.SetBiomeContext(Config);
+
+	FVoxelCPUNoiseGenerator Generator;
+	Generator.Initialize();
+
+	// Climate noise exactly as the column stage builds it
+	FVoxelNoiseParams TempParams;
+	TempParams.NoiseType = EVoxelNoiseType::Simplex;
+	TempParams.Octaves = 2;
+	TempParams.Persistence = 0.5f;
+	TempParams.Lacunarity = 2.0f;
+	TempParams.Amplitude = 1.0f;
+	FVoxelNoiseParams MoistureParams = TempParams;
+	TempParams.Seed = Noise.Seed + Config->TemperatureSeedOffset;
+	TempParams.Frequency = Config->TemperatureNoiseFrequency;
+	MoistureParams.Seed = Noise.Seed + Config->MoistureSeedOffset;
+	MoistureParams.Frequency = Config->MoistureNoiseFrequency;
+
+	const FVector2D Center(100000.0f, -30000.0f);
+	const float NaturalAtCenter = WorldMode.GetTerrainHeightAt(Center.X, Center.Y, Noise);
+	const float ChunkWorldSize = kChunkSize * kVoxelSize;
+	// Water level inside the surface chunk so both dry and underwater columns occur
+	const float WaterLevel = NaturalAtCenter;
+
+	int32 Mismatches = 0;
+	int32 OreVoxels = 0;
+	int32 CarvedVoxels = 0;
+	TSet<uint8> BiomesSeen;
+
+	// The surface chunk and the one below it (where the cave layers' depth windows open up)
+	const int32 SurfaceChunkZ = FMath::FloorToInt(NaturalAtCenter / ChunkWorldSize);
+	for (int32 ChunkZ = SurfaceChunkZ - 1; ChunkZ <= SurfaceChunkZ; ++ChunkZ)
+	{
+		FVoxelNoiseGenerationRequest Request;
+		Request.ChunkCoord = FIntVector(
+			FMath::FloorToInt(Center.X / ChunkWorldSize),
+			FMath::FloorToInt(Center.Y / ChunkWorldSize),
+			ChunkZ);
+		Request.ChunkSize = kChunkSize;
+		Request.VoxelSize = kVoxelSize;
+		Request.LODLevel = 0;
+		Request.WorldMode = EWorldMode::InfinitePlane;
+		Request.SeaLevel = kSeaLevel;
+		Request.HeightScale = kHeightScale;
+		Request.BaseHeight = kBaseHeight;
+		Request.bEnableBiomes = true;
+		Request.bEnableCaves = true;
+		Request.bEnableWaterLevel = true;
+		Request.WaterLevel = WaterLevel;
+		Request.BiomeConfiguration = Config;
+		Request.CaveConfiguration = CaveConfig;
+		Request.NoiseParams = Noise;
+
+		TArray<FVoxelData> ChunkData;
+		if (!TestTrue(TEXT("Chunk generated"), Generator.GenerateChunkCPU(Request, ChunkData)))
+		{
+			break;
+		}
+
+		const FVector ChunkWorldPos = Request.GetChunkWorldPosition();
+		TMap<uint8, TArray<FOreVeinConfig>> OresByBiome;
+
+		for (int32 Z = 0; Z < kChunkSize; ++Z)
+		{
+			for (int32 Y = 0; Y < kChunkSize; ++Y)
+			{
+				for (int32 X = 0; X < kChunkSize; ++X)
+				{
+					const FVector WorldPos = ChunkWorldPos + FVector(X * kVoxelSize, Y * kVoxelSize, Z * kVoxelSize);
+
+					const float NoiseValue = FInfinitePlaneWorldMode::SampleTerrainNoise2D(WorldPos.X, WorldPos.Y, Noise);
+					float Continentalness = 0.0f;
+					const FWorldModeTerrainParams Eff = FInfinitePlaneWorldMode::ComputeEffectiveTerrainParams(
+						WorldPos.X, WorldPos.Y, Base, Noise, &Snapshot, Continentalness);
+					const float TerrainHeight = FInfinitePlaneWorldMode::NoiseToTerrainHeight(NoiseValue, Eff);
+
+					const FVector ClimatePos(WorldPos.X, WorldPos.Y, 0.0f);
+					const float Temperature = FVoxelCPUNoiseGenerator::FBM3D(ClimatePos, TempParams);
+					const float Moisture = FVoxelCPUNoiseGenerator::FBM3D(ClimatePos, MoistureParams);
+					const FBiomeBlend Blend = Config->GetBiomeBlend(Temperature, Moisture, Continentalness);
+					const uint8 BiomeID = Blend.GetDominantBiome();
+					const bool bUnderwater = TerrainHeight < WaterLevel;
+
+					uint8 Density = FInfinitePlaneWorldMode::SignedDistanceToDensity(
+						FInfinitePlaneWorldMode::CalculateSignedDistance(WorldPos.Z, TerrainHeight), kVoxelSize);
+					const float DepthBelowSurface = (TerrainHeight - WorldPos.Z) / kVoxelSize;
+
+					float CaveDensity = 0.0f;
+					if (Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 0.0f)
+					{
+						CaveDensity = FVoxelCPUNoiseGenerator::CalculateCaveDensity(
+							WorldPos, DepthBelowSurface, BiomeID, CaveConfig, Noise.Seed, bUnderwater);
+						if (CaveDensity > 0.0f)
+						{
+							Density = static_cast<uint8>(FMath::Clamp(
+								FMath::Max(0.0f, static_cast<float>(Density) - CaveDensity * 255.0f), 0.0f, 255.0f));
+						}
+					}
+
+					uint8 MaterialID = Config->GetBlendedMaterialWithWater(Blend, DepthBelowSurface, TerrainHeight, WaterLevel);
+					MaterialID = Config->ApplyHeightMaterialRules(MaterialID, WorldPos.Z, DepthBelowSurface);
+					if (CaveConfig->bOverrideCaveWallMaterial && CaveDensity > 0.0f && CaveDensity < 1.0f
+						&& Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface >= CaveConfig->CaveWallMaterialMinDepth)
+					{
+						MaterialID = CaveConfig->CaveWallMaterialID;
+					}
+
+					const FVoxelData& Voxel = ChunkData[X + Y * kChunkSize + Z * kChunkSize * kChunkSize];
+					bool bMaterialMatches = Voxel.MaterialID == MaterialID;
+					if (!bMaterialMatches && Density >= VOXEL_SURFACE_THRESHOLD && DepthBelowSurface > 10.0f)
+					{
+						TArray<FOreVeinConfig>* Ores = OresByBiome.Find(BiomeID);
+						if (!Ores)
+						{
+							Ores = &OresByBiome.Add(BiomeID);
+							Config->GetOreVeinsForBiome(BiomeID, *Ores);
+						}
+						for (const FOreVeinConfig& Ore : *Ores)
+						{
+							if (Ore.MaterialID == Voxel.MaterialID)
+							{
+								bMaterialMatches = true;
+								++OreVoxels;
+								break;
+							}
+						}
+					}
+
+					if (Voxel.Density != Density || !bMaterialMatches || Voxel.BiomeID != BiomeID)
+					{
+						++Mismatches;
+					}
+					if (Voxel.IsAir() && DepthBelowSurface > 0.0f)
+					{
+						++CarvedVoxels;
+					}
+					BiomesSeen.Add(BiomeID);
+				}
+			}
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Biome/cave column cache: %d mismatches, %d carved voxels, %d ore voxels, %d biomes"),
+		Mismatches, CarvedVoxels, OreVoxels, BiomesSeen.Num()));
+	TestTrue(TEXT("Caves carved something (non-vacuous)"), CarvedVoxels > 0);
+	TestEqual(TEXT("Column-cached biome + cave generation is bit-identical to per-voxel evaluation"), Mismatches, 0);
+
+	CaveConfig->RemoveFromRoot();
+	Config->RemoveFromRoot();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// HT7: LOD-strided generation samples exactly the voxels full-resolution generation produces at the
+// lattice + apron coordinates (density, material, biome), in the compact FVoxelStridedLattice layout.
+// Modes/strides that can't be strided fall back to a full-resolution array.
+// ---------------------------------------------------------------------------
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelHeightStridedLatticeParityTest,
+	"VoxelWorlds.Generation.HeightParity.StridedLattice",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelHeightStridedLatticeParityTest::RunTest(const FString& Parameters)
+{
+	UVoxelBiomeConfiguration* Config = MakeContinentalnessConfig();
+	const FVoxelNoiseParams Noise = MakeTerrainNoise();
+
+	FInfinitePlaneWorldMode WorldMode(MakeBaseParams());
+	WorldMode.SetBiomeContext(Config);
+
+	FVoxelCPUNoiseGenerator Generator;
+	Generator.Initialize();
+
+	const FVector2D Sample(-42000.0f, 77000.0f);
+	const float SurfaceZ = WorldMode.GetTerrainHeightAt(Sample.X, Sample.Y, Noise);
+	const float ChunkWorldSize = kChunkSize * kVoxelSize;
+
+	FVoxelNoiseGenerationRequest Request;
+	Request.ChunkCoord = FIntVector(
+		FMath::FloorToInt(Sample.X / ChunkWorldSize),
+		FMath::FloorToInt(Sample.Y / ChunkWorldSize),
+		FMath::FloorToInt(SurfaceZ / ChunkWorldSize));
+	Request.ChunkSize = kChunkSize;
+	Request.VoxelSize = kVoxelSize;
+	Request.WorldMode = EWorldMode::InfinitePlane;
+	Request.SeaLevel = kSeaLevel;
+	Request.HeightScale = kHeightScale;
+	Request.BaseHeight = kBaseHeight;
+	Request.bEnableBiomes = true;
+	Request.bEnableCaves = false;
+	Request.BiomeConfiguration = Config;
+	Request.NoiseParams = Noise;
+
+	TArray<FVoxelData> FullData;
+	if (!TestTrue(TEXT("Full-resolution chunk generated"), Generator.GenerateChunkCPU(Request, FullData)))
+	{
+		Config->RemoveFromRoot();
+		return false;
+	}
+
+	for (const int32 Stride : { 2, 4, 8 })
+	{
+		FVoxelNoiseGenerationRequest StridedRequest = Request;
+		StridedRequest.LODLevel = FMath::FloorLog2(Stride);
+		StridedRequest.GenerationStride = Stride;
+		TestEqual(FString::Printf(TEXT("Stride %d is honoured for InfinitePlane"), Stride),
+			FVoxelCPUNoiseGenerator::GetEffectiveGenerationStride(StridedRequest), Stride);
+
+		TArray<FVoxelData> Compact;
+		TestTrue(FString::Printf(TEXT("Stride %d chunk generated"), Stride), Generator.GenerateChunkCPU(StridedRequest, Compact));
+		if (!TestEqual(FString::Printf(TEXT("Stride %d compact size"), Stride),
+			Compact.Num(), FVoxelStridedLattice::GetCompactVoxelCount(kChunkSize, Stride)))
+		{
+			continue;
+		}
+
+		TArray<int32> Coords;
+		FVoxelStridedLattice::BuildAxisCoords(kChunkSize, Stride, Coords);
+		const int32 M = Coords.Num();
+
+		int32 Mismatches = 0;
+		for (int32 K = 0; K < M; ++K)
+		{
+			for (int32 J = 0; J < M; ++J)
+			{
+				for (int32 I = 0; I < M; ++I)
+				{
+					const FVoxelData& Full = FullData[Coords[I] + Coords[J] * kChunkSize + Coords[K] * kChunkSize * kChunkSize];
+					const FVoxelData& Strided = Compact[I + J * M + K * M * M];
+					if (Full.Density != Strided.Density || Full.MaterialID != Strided.MaterialID || Full.BiomeID != Strided.BiomeID)
+					{
+						++Mismatches;
+					}
+				}
+			}
+		}
+
+		AddInfo(FString::Printf(TEXT("Stride %d: %d of %d voxels sampled, %d mismatches vs full resolution"),
+			Stride, Compact.Num(), FullData.Num(), Mismatches));
+		TestEqual(FString::Printf(TEXT("Stride %d lattice matches full-resolution generation"), Stride), Mismatches, 0);
+	}
+
+	// Unsupported stride / mode -> full resolution.
+	FVoxelNoiseGenerationRequest BadStride = Request;
+	BadStride.GenerationStride = 3;
+	TestEqual(TEXT("Invalid stride falls back to 1"), FVoxelCPUNoiseGenerator::GetEffectiveGenerationStride(BadStride), 1);
+	FVoxelNoiseGenerationRequest Spherical = Request;
+	Spherical.WorldMode = EWorldMode::SphericalPlanet;
+	Spherical.GenerationStride = 4;
+	TestEqual(TEXT("Volumetric mode falls back to 1"), FVoxelCPUNoiseGenerator::GetEffectiveGenerationStride(Spherical), 1);
+	FVoxelNoiseGenerationRequest Caves = Request;
+	Caves.bEnableCaves = true;
+	Caves.GenerationStride = 4;
+	TestEqual(TEXT("Caves fall back to 1"), FVoxelCPUNoiseGenerator::GetEffectiveGenerationStride(Caves), 1);
+
+	Config->RemoveFromRoot();
+	return true;
+}
@@ -8,7 +8,9 @@
 #include "VoxelData.h"
 #include "VoxelBiomeConfiguration.h"
 #include "VoxelCaveConfiguration.h"
+#include "VoxelCaveQuery.h"
 #include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelCPUNoiseGeneratorTest, "VoxelWorlds.Generation.CPUNoiseGenerator",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
@@ -759,6 +761,176 @@ bool FVoxelGPUvsCPUOreVariantParityTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBatchNoiseParityTest, "VoxelWorlds.Generation.BatchNoiseParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelBatchNoiseParityTest::RunTest(const FString& Parameters)
+{
+	// Batch kernels must be bit-identical to the per-point functions on BOTH the vector path and the
+	// scalar fallback. 203 points: several full blocks plus a ragged tail that exercises the scalar remainder.
+	constexpr int32 Count = 203;
+	TArray<float> X, Y, Z;
+	TArray<double> DX, DY, DZ;
+	FRandomStream Rng(4242);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		DX.Add(Rng.FRandRange(-50000.0f, 50000.0f));
+		DY.Add(Rng.FRandRange(-50000.0f, 50000.0f));
+		DZ.Add(Rng.FRandRange(-8000.0f, 8000.0f));
+		X.Add(static_cast<float>(DX[i] * 0.013));
+		Y.Add(static_cast<float>(DY[i] * 0.013));
+		Z.Add(static_cast<float>(DZ[i] * 0.013));
+	}
+
+	IConsoleVariable* BatchSIMDVar = IConsoleManager::Get().FindConsoleVariable(TEXT("voxel.Noise.BatchSIMD"));
+	TestNotNull(TEXT("voxel.Noise.BatchSIMD cvar is registered"), BatchSIMDVar);
+	if (!BatchSIMDVar)
+	{
+		return false;
+	}
+	const int32 SavedSIMD = BatchSIMDVar->GetInt();
+
+	for (int32 SIMD = 0; SIMD <= 1; ++SIMD)
+	{
+		BatchSIMDVar->Set(SIMD, ECVF_SetByCode);
+		const FString Path = FVoxelCPUNoiseGenerator::GetBatchNoisePath();
+
+		TArray<float> Out, Out2;
+		Out.SetNumUninitialized(Count);
+		Out2.SetNumUninitialized(Count);
+
+		int32 Mismatches = 0;
+
+		FVoxelCPUNoiseGenerator::Perlin3D_Batch(X.GetData(), Y.GetData(), Z.GetData(), Count, 777, Out.GetData());
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Mismatches += (Out[i] != FVoxelCPUNoiseGenerator::Perlin3D(FVector(X[i], Y[i], Z[i]), 777)) ? 1 : 0;
+		}
+		TestEqual(*FString::Printf(TEXT("[%s] Perlin3D_Batch matches Perlin3D"), *Path), Mismatches, 0);
+
+		Mismatches = 0;
+		FVoxelCPUNoiseGenerator::Simplex3D_Batch(X.GetData(), Y.GetData(), Z.GetData(), Count, 777, Out.GetData());
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Mismatches += (Out[i] != FVoxelCPUNoiseGenerator::Simplex3D(FVector(X[i], Y[i], Z[i]), 777)) ? 1 : 0;
+		}
+		TestEqual(*FString::Printf(TEXT("[%s] Simplex3D_Batch matches Simplex3D"), *Path), Mismatches, 0);
+
+		Mismatches = 0;
+		FVoxelCPUNoiseGenerator::Cellular3D_Batch(X.GetData(), Y.GetData(), Z.GetData(), Count, 777, Out.GetData(), Out2.GetData());
+		for (int32 i = 0; i < Count; ++i)
+		{
+			float F1, F2;
+			FVoxelCPUNoiseGenerator::Cellular3D(FVector(X[i], Y[i], Z[i]), 777, F1, F2);
+			Mismatches += (Out[i] != F1 || Out2[i] != F2) ? 1 : 0;
+		}
+		TestEqual(*FString::Printf(TEXT("[%s] Cellular3D_Batch matches Cellular3D"), *Path), Mismatches, 0);
+
+		// FBM over every noise type (positions stay double, as the generator passes them)
+		const EVoxelNoiseType Types[] = { EVoxelNoiseType::Perlin, EVoxelNoiseType::Simplex, EVoxelNoiseType::Cellular, EVoxelNoiseType::Voronoi };
+		for (const EVoxelNoiseType Type : Types)
+		{
+			FVoxelNoiseParams Params;
+			Params.NoiseType = Type;
+			Params.Seed = 12345;
+			Params.Frequency = 0.0013f;
+			Params.Octaves = 5;
+			Params.Lacunarity = 2.0f;
+			Params.Persistence = 0.5f;
+			Params.Amplitude = 1.0f;
+
+			Mismatches = 0;
+			FVoxelCPUNoiseGenerator::FBM3D_Batch(DX.GetData(), DY.GetData(), DZ.GetData(), Count, Params, Out.GetData());
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Mismatches += (Out[i] != FVoxelCPUNoiseGenerator::FBM3D(FVector(DX[i], DY[i], DZ[i]), Params)) ? 1 : 0;
+			}
+			TestEqual(*FString::Printf(TEXT("[%s] FBM3D_Batch matches FBM3D (noise type %d)"), *Path, static_cast<int32>(Type)), Mismatches, 0);
+		}
+	}
+
+	BatchSIMDVar->Set(SavedSIMD, ECVF_SetByCode);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBatchCaveDensityParityTest, "VoxelWorlds.Generation.BatchCaveDensityParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelBatchCaveDensityParityTest::RunTest(const FString& Parameters)
+{
+	// One cheese + one tunnel layer with a depth window, so the batch path's per-layer compaction matters
+	UVoxelCaveConfiguration* CaveConfig = NewObject<UVoxelCaveConfiguration>();
+	CaveConfig->AddToRoot();
+	CaveConfig->bEnableCaves = true;
+	CaveConfig->CaveLayers.Empty();
+	{
+		FCaveLayerConfig Cheese;
+		Cheese.bEnabled = true;
+		Cheese.CaveType = ECaveType::Cheese;
+		Cheese.SeedOffset = 1234;
+		Cheese.Frequency = 0.010f; Cheese.Octaves = 3; Cheese.Persistence = 0.5f; Cheese.Lacunarity = 2.0f;
+		Cheese.Threshold = 0.30f; Cheese.CarveStrength = 1.0f; Cheese.CarveFalloff = 0.25f;
+		Cheese.MinDepth = 4.0f; Cheese.MaxDepth = 40.0f; Cheese.DepthFadeWidth = 4.0f; Cheese.VerticalScale = 0.6f;
+		CaveConfig->CaveLayers.Add(Cheese);
+
+		FCaveLayerConfig Tunnel;
+		Tunnel.bEnabled = true;
+		Tunnel.CaveType = ECaveType::Spaghetti;
+		Tunnel.SeedOffset = 5678;
+		Tunnel.Frequency = 0.012f; Tunnel.Octaves = 3; Tunnel.Persistence = 0.5f; Tunnel.Lacunarity = 2.0f;
+		Tunnel.Threshold = 0.30f; Tunnel.CarveStrength = 1.0f; Tunnel.CarveFalloff = 0.20f;
+		Tunnel.MinDepth = 10.0f; Tunnel.MaxDepth = 0.0f; Tunnel.DepthFadeWidth = 4.0f; Tunnel.VerticalScale = 0.7f;
+		Tunnel.SecondNoiseSeedOffset = 7777; Tunnel.SecondNoiseFrequencyScale = 1.2f;
+		CaveConfig->CaveLayers.Add(Tunnel);
+	}
+
+	// A single column, 150 voxels deep (several blocks + tail)
+	constexpr int32 Count = 150;
+	constexpr float VoxelSize = 100.0f;
+	TArray<double> X, Y, Z;
+	TArray<float> Depth, Out;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		X.Add(1234.5);
+		Y.Add(-6789.25);
+		Z.Add(-i * VoxelSize);
+		Depth.Add(static_cast<float>(i));
+	}
+	Out.SetNumUninitialized(Count);
+
+	FVoxelCPUNoiseGenerator::CalculateCaveDensity_Batch(
+		X.GetData(), Y.GetData(), Z.GetData(), Depth.GetData(), Count, 0, CaveConfig, 12345, false, Out.GetData());
+
+	int32 Mismatches = 0;
+	int32 Carved = 0;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const float Expected = FVoxelCPUNoiseGenerator::CalculateCaveDensity(
+			FVector(X[i], Y[i], Z[i]), Depth[i], 0, CaveConfig, 12345, false);
+		Mismatches += (Out[i] != Expected) ? 1 : 0;
+		Carved += (Expected > 0.0f) ? 1 : 0;
+	}
+
+	TestEqual(TEXT("CalculateCaveDensity_Batch matches CalculateCaveDensity"), Mismatches, 0);
+	AddInfo(FString::Printf(TEXT("%d / %d column voxels carved"), Carved, Count));
+
+	// FVoxelCaveQuery's column query goes through the batch kernel too (surface at Z=0, so depth == i)
+	TArray<float> QueryOut;
+	QueryOut.SetNumUninitialized(Count);
+	FVoxelCaveQuery::SampleCaveDensityColumn(X[0], Y[0], Z.GetData(), Count, 0.0f, VoxelSize, 0, CaveConfig, 12345, false, QueryOut.GetData());
+	int32 QueryMismatches = 0;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const float Expected = (i > 0) ? Out[i] : 0.0f;
+		QueryMismatches += (QueryOut[i] != Expected) ? 1 : 0;
+		QueryMismatches += (FVoxelCaveQuery::SampleCaveDensityAt(FVector(X[i], Y[i], Z[i]), 0.0f, VoxelSize, 0, CaveConfig, 12345) != Expected) ? 1 : 0;
+	}
+	TestEqual(TEXT("FVoxelCaveQuery matches the generator's carve density"), QueryMismatches, 0);
+
+	CaveConfig->RemoveFromRoot();
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelNoiseGeneratorPerformanceTest, "VoxelWorlds.Generation.Performance",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter | EAutomationTestFlags::MediumPriority)
 
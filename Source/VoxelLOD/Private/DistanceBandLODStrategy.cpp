@@ -30,6 +30,53 @@ static TAutoConsoleVariable<int32> CVarLODBalanceDiagonal(
 	TEXT("2:1 LOD balance across all 26 neighbours (edges+corners), not just 6 faces. Prevents 3-LOD corner junctions. 1=on (default), 0=face-only."),
 	ECVF_Default);
 
+// Incremental view volume: measure the LOD field from the viewer CHUNK's centre, so it only changes
+// when the viewer crosses a chunk boundary, and then only on the shell of chunks whose zone (view
+// membership / band / hysteresis edge) differs across the step. Update, GetChunksToLoad and
+// GetChunksToUnload then cost O(shell) per crossing and ~nothing in between, instead of rescanning
+// the (2R+1)^2 x Z cube every frame. 1=on, 0=full rescans against the exact viewer position (default).
+static TAutoConsoleVariable<int32> CVarLODIncremental(
+	TEXT("voxel.LODIncremental"),
+	0,
+	TEXT("Incremental LOD view volume: only chunks entering/leaving a band or the view volume are re-evaluated per viewer chunk step. 1=on, 0=full rescan (default)."),
+	ECVF_Default);
+
+namespace
+{
+	/** Neighbour offsets for the 2:1 balance: the 6 faces, or all 26 (faces + edges + corners). */
+	const FIntVector* GetLODBalanceOffsets(bool bDiagonal, int32& OutNum)
+	{
+		static const FIntVector FaceOffsets[6] = {
+			FIntVector(-1, 0, 0), FIntVector(1, 0, 0),
+			FIntVector(0, -1, 0), FIntVector(0, 1, 0),
+			FIntVector(0, 0, -1), FIntVector(0, 0, 1),
+		};
+		// All 26 neighbours (every dx,dy,dz in {-1,0,1} except the origin), built once.
+		static const TArray<FIntVector> AllOffsets = []()
+		{
+			TArray<FIntVector> Offs;
+			Offs.Reserve(26);
+			for (int32 dz = -1; dz <= 1; ++dz)
+			{
+				for (int32 dy = -1; dy <= 1; ++dy)
+				{
+					for (int32 dx = -1; dx <= 1; ++dx)
+					{
+						if (dx != 0 || dy != 0 || dz != 0)
+						{
+							Offs.Add(FIntVector(dx, dy, dz));
+						}
+					}
+				}
+			}
+			return Offs;
+		}();
+
+		OutNum = bDiagonal ? AllOffsets.Num() : 6;
+		return bDiagonal ? AllOffsets.GetData() : FaceOffsets;
+	}
+}
+
 FDistanceBandLODStrategy::FDistanceBandLODStrategy()
 {
 	// Default LOD bands will be set during Initialize()
@@ -207,6 +254,10 @@ void FDistanceBandLODStrategy::Initialize(const UVoxelWorldConfiguration* WorldC
 		}
 	}
 
+	// Incremental volume is rebuilt against the new configuration on the next Update.
+	bVolumeTableDirty = true;
+	ResetIncrementalVolume();
+
 	bIsInitialized = true;
 
 	// Calculate expected chunk radius for reference (ChunkWorldSize already defined above)
@@ -240,7 +291,20 @@ void FDistanceBandLODStrategy::Update(const FLODQueryContext& Context, float Del
 	// Recompute the balanced LOD assignment for this frame. Must run before any
 	// GetLODForChunk / GetVisibleChunks query (the interface guarantees Update is
 	// called first each frame), so all consumers read a consistent, balanced map.
-	RebuildBalancedLODCache(Context);
+	if (IsIncrementalVolumeActive())
+	{
+		UpdateIncrementalVolume(Context);
+	}
+	else
+	{
+		if (bIncrementalValid)
+		{
+			ResetIncrementalVolume();
+		}
+		RebuildBalancedLODCache(Context);
+	}
+
+	PruneColumnSurfaceCache();
 }
 
 int32 FDistanceBandLODStrategy::GetRawLODForDistance(float Distance) const
@@ -314,6 +378,23 @@ TArray<FChunkLODRequest> FDistanceBandLODStrategy::GetVisibleChunks(
 		return Requests;
 	}
 
+	// Incremental mode: the candidate volume is already materialized (quantized to the viewer
+	// chunk); cull and prioritize its members instead of re-walking the cube.
+	if (IsIncrementalVolumeActive() && bIncrementalValid)
+	{
+		Requests.Reserve(TargetLODCache.Num());
+		for (const TPair<FIntVector, int32>& Pair : TargetLODCache)
+		{
+			FChunkLODRequest Request;
+			if (MakeVolumeRequest(Pair.Key, Context, Request))
+			{
+				Requests.Add(Request);
+			}
+		}
+		Requests.Sort();
+		return Requests;
+	}
+
 	const FIntVector ViewerChunk = WorldPosToChunkCoord(Context.ViewerPosition);
 
 	// Calculate the maximum chunk radius needed
@@ -410,6 +491,53 @@ void FDistanceBandLODStrategy::GetChunksToLoad(
 {
 	OutLoad.Reset();
 
+	if (IsIncrementalVolumeActive() && bIncrementalValid)
+	{
+		// Chunks we saw loaded that the manager has since dropped (external unload, session
+		// reset) go back to the candidates. Only possible when the loaded set shrank below them.
+		if (LoadedChunks.Num() < ResidentCandidates.Num())
+		{
+			for (auto It = ResidentCandidates.CreateIterator(); It; ++It)
+			{
+				if (!LoadedChunks.Contains(*It))
+				{
+					LoadCandidates.Add(*It);
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		// Walk only the volume chunks not yet seen loaded: the entering shells of past steps
+		// plus whatever is still streaming or frustum-culled.
+		for (auto It = LoadCandidates.CreateIterator(); It; ++It)
+		{
+			const FIntVector ChunkCoord = *It;
+			if (LoadedChunks.Contains(ChunkCoord))
+			{
+				ResidentCandidates.Add(ChunkCoord);
+				It.RemoveCurrent();
+				continue;
+			}
+
+			// Viewer-independent culls never change for this chunk while it stays in the volume;
+			// drop it (it is re-armed if it leaves and re-enters).
+			if (IsOutsideTerrainHeightRange(ChunkCoord, Context) || ShouldCullIslandBoundary(ChunkCoord, Context))
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+
+			FChunkLODRequest Request;
+			if (MakeVolumeRequest(ChunkCoord, Context, Request))
+			{
+				OutLoad.Add(Request);
+			}
+		}
+
+		OutLoad.Sort();
+		return;
+	}
+
 	// Get all visible chunks
 	TArray<FChunkLODRequest> VisibleChunks = GetVisibleChunks(Context);
 
@@ -434,6 +562,23 @@ void FDistanceBandLODStrategy::GetChunksToUnload(
 
 	const float UnloadDistance = MaxViewDistance * UnloadDistanceMultiplier;
 
+	// Incremental mode: every decision below is a function of the viewer chunk (distances are
+	// quantized to it, like the volume) and of the loaded set, so skip the scan while neither
+	// changed and the last one wasn't truncated by the per-frame limit.
+	const bool bIncremental = IsIncrementalVolumeActive() && bIncrementalValid;
+	if (bIncremental)
+	{
+		if (bLastUnloadScanValid && !bLastUnloadScanCapped
+			&& LastUnloadScanChunk == IncrementalViewerChunk
+			&& LastUnloadScanLoadedGeneration == Context.LoadedChunksGeneration)
+		{
+			return;
+		}
+		LastUnloadScanChunk = IncrementalViewerChunk;
+		LastUnloadScanLoadedGeneration = Context.LoadedChunksGeneration;
+		bLastUnloadScanValid = true;
+	}
+
 	// Check each loaded chunk
 	for (const FIntVector& ChunkCoord : LoadedChunks)
 	{
@@ -448,9 +593,11 @@ void FDistanceBandLODStrategy::GetChunksToUnload(
 		}
 		else
 		{
-			// Standard distance-based unloading
-			const FVector ChunkCenter = ChunkCoordToWorldCenter(ChunkCoord);
-			const float Distance = GetDistanceToViewer(ChunkCenter, Context);
+			// Standard distance-based unloading (incremental: from the viewer chunk's centre, so a
+			// volume chunk is never past the unload radius)
+			const float Distance = bIncremental
+				? GetVolumeOffsetDistance(ChunkCoord - IncrementalViewerChunk)
+				: GetDistanceToViewer(ChunkCoordToWorldCenter(ChunkCoord), Context);
 
 			if (Distance > UnloadDistance)
 			{
@@ -470,6 +617,21 @@ void FDistanceBandLODStrategy::GetChunksToUnload(
 		}
 	}
 
+	if (bIncremental)
+	{
+		bLastUnloadScanCapped = OutUnload.Num() >= Context.MaxChunksToUnloadPerFrame;
+
+		// Culled volume chunks are about to be unloaded: make them load candidates again so a
+		// later cull change (slab gate, horizon) can bring them back.
+		for (const FIntVector& ChunkCoord : OutUnload)
+		{
+			if (ResidentCandidates.Remove(ChunkCoord) > 0)
+			{
+				LoadCandidates.Add(ChunkCoord);
+			}
+		}
+	}
+
 	// Sort by distance (farthest first for unloading)
 	OutUnload.Sort([this, &Context](const FIntVector& A, const FIntVector& B)
 	{
@@ -486,6 +648,11 @@ float FDistanceBandLODStrategy::GetChunkPriority(
 	return CalculatePriority(ChunkCoord, Context);
 }
 
+bool FDistanceBandLODStrategy::HasFullNeighborBalance() const
+{
+	return CVarLODBalance.GetValueOnGameThread() != 0 && CVarLODBalanceDiagonal.GetValueOnGameThread() != 0;
+}
+
 FString FDistanceBandLODStrategy::GetDebugInfo() const
 {
 	FString Info = FString::Printf(TEXT("DistanceBandLODStrategy\n"));
@@ -497,6 +664,14 @@ FString FDistanceBandLODStrategy::GetDebugInfo() const
 	Info += FString::Printf(TEXT("  Viewer Chunk: (%d, %d, %d)\n"),
 		CachedViewerChunk.X, CachedViewerChunk.Y, CachedViewerChunk.Z);
 
+	if (bIncrementalValid)
+	{
+		Info += FString::Printf(TEXT("  Incremental Volume: %d chunks, last shell %d, last rebalance %d, full rebuilds %d\n"),
+			TargetLODCache.Num(), LastShellCount, LastRegionCount, IncrementalRebuildCount);
+		Info += FString::Printf(TEXT("  Load Candidates: %d (resident %d), Column Cache: %d\n"),
+			LoadCandidates.Num(), ResidentCandidates.Num(), ColumnSurfaceCache.Num());
+	}
+
 	// World-mode-specific culling info
 	if (WorldMode == EWorldMode::InfinitePlane || WorldMode == EWorldMode::IslandBowl)
 	{
@@ -600,6 +775,8 @@ void FDistanceBandLODStrategy::SetLODBands(const TArray<FLODBand>& InBands)
 
 	// Note: MaxViewDistance is set from Configuration->ViewDistance during Initialize()
 	// and should not be overridden here. Call SetViewDistance() if needed.
+
+	bVolumeTableDirty = true;
 }
 
 // ==================== Internal Helpers ====================
@@ -760,75 +937,521 @@ void FDistanceBandLODStrategy::RebuildBalancedLODCache(const FLODQueryContext& C
 		}
 	}
 
-	// Pass 2: 2:1 adjacency balance. Refine any chunk that is more than
-	// MaxNeighborLODDelta coarser than its finest neighbor, iterating to a fixpoint.
-	// Refine-only (LOD numbers only decrease), so it always converges.
+	// Pass 2: 2:1 adjacency balance (see BalanceLODCache).
+	if (bBalance)
+	{
+		BalanceLODCache(BalancedLODCache, CVarLODBalanceDiagonal.GetValueOnGameThread() != 0);
+	}
+
+	// Commit for next frame's hysteresis.
+	CommittedLODCache = BalancedLODCache;
+}
+
+void FDistanceBandLODStrategy::BalanceLODCache(TMap<FIntVector, int32>& Cache, bool bDiagonal) const
+{
+	// Refine any chunk that is more than MaxNeighborLODDelta coarser than its finest
+	// neighbor, iterating to a fixpoint. Refine-only (LOD numbers only decrease), so it
+	// always converges.
 	//
 	// Neighbour set: face-only (6) leaves diagonal (edge/corner) neighbours able to differ by
 	// 2 LOD levels, so three LODs can meet at a chunk corner (LOD0/1/2 junction) that the
 	// per-face transvoxel/morph can't stitch. The full 26-neighbour set (6 faces + 12 edges +
 	// 8 corners) makes every vertex-sharing pair differ by <=1, so at most two LOD levels meet
 	// at any corner — no 3-LOD junction, regardless of band widths. Toggle: voxel.LODBalanceDiagonal.
-	if (bBalance)
+	int32 NumOffsets = 0;
+	const FIntVector* Offsets = GetLODBalanceOffsets(bDiagonal, NumOffsets);
+
+	bool bChanged = true;
+	int32 Guard = 0;
+	while (bChanged && Guard++ < 16)
 	{
-		static const FIntVector FaceOffsets[6] = {
-			FIntVector(-1, 0, 0), FIntVector(1, 0, 0),
-			FIntVector(0, -1, 0), FIntVector(0, 1, 0),
-			FIntVector(0, 0, -1), FIntVector(0, 0, 1),
-		};
-		// All 26 neighbours (every dx,dy,dz in {-1,0,1} except the origin), built once.
-		static const TArray<FIntVector> AllOffsets = []()
+		bChanged = false;
+		for (TPair<FIntVector, int32>& Pair : Cache)
 		{
-			TArray<FIntVector> Offs;
-			Offs.Reserve(26);
-			for (int32 dz = -1; dz <= 1; ++dz)
+			int32 MinNeighbor = Pair.Value;
+			for (int32 i = 0; i < NumOffsets; ++i)
 			{
-				for (int32 dy = -1; dy <= 1; ++dy)
+				if (const int32* NLOD = Cache.Find(Pair.Key + Offsets[i]))
 				{
-					for (int32 dx = -1; dx <= 1; ++dx)
+					MinNeighbor = FMath::Min(MinNeighbor, *NLOD);
+				}
+			}
+
+			const int32 MaxAllowed = MinNeighbor + MaxNeighborLODDelta;
+			if (Pair.Value > MaxAllowed)
+			{
+				Pair.Value = MaxAllowed;
+				bChanged = true;
+			}
+		}
+	}
+}
+
+// ==================== Incremental View Volume ====================
+
+bool FDistanceBandLODStrategy::IsIncrementalVolumeActive() const
+{
+	// LOD disabled / no bands has nothing to balance; the legacy path handles it.
+	return CVarLODIncremental.GetValueOnGameThread() != 0 && bEnableLOD && LODBands.Num() > 0;
+}
+
+void FDistanceBandLODStrategy::BuildVolumeOffsetTable()
+{
+	const float ChunkW = BaseChunkSize * VoxelSize;
+	VolumeRadius = FMath::CeilToInt(MaxViewDistance / FMath::Max(ChunkW, 1.0f)) + 1;
+	VolumeMinZ = MinVerticalChunks;
+	VolumeMaxZ = MaxVerticalChunks;
+
+	// Every distance a decision compares against: view distance (membership), band edges (raw
+	// LOD), and each band's hysteresis edges (same float expressions as ApplyLODHysteresis).
+	VolumeZoneEdges.Reset();
+	VolumeZoneEdges.Add(MaxViewDistance);
+	int32 MinLOD = MAX_int32;
+	VolumeMaxLOD = 0;
+	for (const FLODBand& Band : LODBands)
+	{
+		VolumeZoneEdges.Add(Band.MinDistance);
+		VolumeZoneEdges.Add(Band.MaxDistance);
+		VolumeZoneEdges.Add(Band.MinDistance - RefineHysteresisFraction * ChunkW);
+		VolumeZoneEdges.Add(Band.MaxDistance + CoarsenHysteresisFraction * ChunkW);
+		MinLOD = FMath::Min(MinLOD, Band.LODLevel);
+		VolumeMaxLOD = FMath::Max(VolumeMaxLOD, Band.LODLevel);
+	}
+	VolumeZoneEdges.Sort();
+
+	// A target change can only pull a balanced LOD down along a neighbour path of at most
+	// (coarsest - finest) / delta chunks.
+	VolumeBalanceRadius = FMath::DivideAndRoundUp(VolumeMaxLOD - FMath::Min(MinLOD, VolumeMaxLOD), FMath::Max(1, MaxNeighborLODDelta));
+
+	const int32 Side = 2 * VolumeRadius + 1;
+	VolumeOffsets.Reset();
+	VolumeOffsets.SetNum(Side * Side * (VolumeMaxZ - VolumeMinZ + 1));
+	for (int32 Z = VolumeMinZ; Z <= VolumeMaxZ; ++Z)
+	{
+		for (int32 Y = -VolumeRadius; Y <= VolumeRadius; ++Y)
+		{
+			for (int32 X = -VolumeRadius; X <= VolumeRadius; ++X)
+			{
+				FVolumeOffset& Entry = VolumeOffsets[(X + VolumeRadius) + (Y + VolumeRadius) * Side + (Z - VolumeMinZ) * Side * Side];
+				Entry.Distance = GetVolumeOffsetDistance(FIntVector(X, Y, Z));
+				Entry.RawLOD = GetRawLODForDistance(Entry.Distance);
+				Entry.Zone = INDEX_NONE;
+				if (Entry.Distance <= MaxViewDistance)
+				{
+					// Count edges strictly below and at-or-below: equal counts mean every >, >=,
+					// < and <= comparison against every edge comes out the same.
+					int32 Below = 0;
+					int32 AtOrBelow = 0;
+					for (const float Edge : VolumeZoneEdges)
 					{
-						if (dx != 0 || dy != 0 || dz != 0)
-						{
-							Offs.Add(FIntVector(dx, dy, dz));
-						}
+						Below += Entry.Distance > Edge ? 1 : 0;
+						AtOrBelow += Entry.Distance >= Edge ? 1 : 0;
 					}
+					Entry.Zone = Below | (AtOrBelow << 16);
 				}
 			}
-			return Offs;
-		}();
+		}
+	}
+
+	ShellOffsetCache.Reset();
+	VolumeViewDistance = MaxViewDistance;
+	bVolumeTableDirty = false;
+}
+
+const FDistanceBandLODStrategy::FVolumeOffset* FDistanceBandLODStrategy::FindVolumeOffset(const FIntVector& Offset) const
+{
+	if (FMath::Abs(Offset.X) > VolumeRadius || FMath::Abs(Offset.Y) > VolumeRadius
+		|| Offset.Z < VolumeMinZ || Offset.Z > VolumeMaxZ)
+	{
+		return nullptr;
+	}
+	const int32 Side = 2 * VolumeRadius + 1;
+	return &VolumeOffsets[(Offset.X + VolumeRadius) + (Offset.Y + VolumeRadius) * Side + (Offset.Z - VolumeMinZ) * Side * Side];
+}
 
-		const bool bDiagonal = CVarLODBalanceDiagonal.GetValueOnGameThread() != 0;
-		const FIntVector* Offsets = bDiagonal ? AllOffsets.GetData() : FaceOffsets;
-		const int32 NumOffsets = bDiagonal ? AllOffsets.Num() : 6;
+float FDistanceBandLODStrategy::GetVolumeOffsetDistance(const FIntVector& Offset) const
+{
+	// Centre-to-centre, so it depends on the offset only (mirrors GetDistanceToViewer's per-mode metric).
+	const FVector Delta = FVector(Offset) * (BaseChunkSize * VoxelSize);
+	return WorldMode == EWorldMode::IslandBowl ? Delta.Size2D() : Delta.Size();
+}
+
+const TArray<FIntVector>& FDistanceBandLODStrategy::GetShellOffsets(const FIntVector& Step)
+{
+	if (const TArray<FIntVector>* Cached = ShellOffsetCache.Find(Step))
+	{
+		return *Cached;
+	}
 
-		bool bChanged = true;
-		int32 Guard = 0;
-		while (bChanged && Guard++ < 16)
+	// A chunk at new offset O sat at old offset O + Step. Its decisions can only differ if its
+	// zone did (out-of-cube = out-of-view).
+	TArray<FIntVector> Shell;
+	for (int32 Z = VolumeMinZ; Z <= VolumeMaxZ; ++Z)
+	{
+		for (int32 Y = -VolumeRadius; Y <= VolumeRadius; ++Y)
 		{
-			bChanged = false;
-			for (TPair<FIntVector, int32>& Pair : BalancedLODCache)
+			for (int32 X = -VolumeRadius; X <= VolumeRadius; ++X)
 			{
-				int32 MinNeighbor = Pair.Value;
-				for (int32 i = 0; i < NumOffsets; ++i)
+				const FIntVector Offset(X, Y, Z);
+				const int32 NewZone = FindVolumeOffset(Offset)->Zone;
+
+				// Entering / re-zoned: in the new cube
+				const FVolumeOffset* Old = FindVolumeOffset(Offset + Step);
+				if (NewZone != (Old ? Old->Zone : INDEX_NONE))
+				{
+					Shell.Add(Offset);
+				}
+
+				// Leaving: in view in the old cube (Offset read as an old offset), outside the new one
+				if (NewZone != INDEX_NONE && !FindVolumeOffset(Offset - Step))
 				{
-					if (const int32* NLOD = BalancedLODCache.Find(Pair.Key + Offsets[i]))
+					Shell.Add(Offset - Step);
+				}
+			}
+		}
+	}
+
+	return ShellOffsetCache.Add(Step, MoveTemp(Shell));
+}
+
+void FDistanceBandLODStrategy::UpdateIncrementalVolume(const FLODQueryContext& Context)
+{
+	const bool bBalance = CVarLODBalance.GetValueOnGameThread() != 0;
+	const bool bDiagonal = CVarLODBalanceDiagonal.GetValueOnGameThread() != 0;
+	const FIntVector ViewerChunk = WorldPosToChunkCoord(Context.ViewerPosition);
+
+	const bool bTableStale = bVolumeTableDirty || VolumeViewDistance != MaxViewDistance;
+	if (bTableStale)
+	{
+		BuildVolumeOffsetTable();
+	}
+
+	const FIntVector Step = ViewerChunk - IncrementalViewerChunk;
+	const int32 StepSize = FMath::Max3(FMath::Abs(Step.X), FMath::Abs(Step.Y), FMath::Abs(Step.Z));
+	if (!bIncrementalValid || bTableStale || StepSize > 1
+		|| bBalance != bIncrementalBalance || bDiagonal != bIncrementalDiagonal)
+	{
+		RebuildIncrementalVolume(ViewerChunk, bBalance, bDiagonal);
+		return;
+	}
+
+	// Dirty = chunks whose hysteresis input changed last update + the step's shell. Everything
+	// else has the same zone and the same committed LOD, hence the same target.
+	TSet<FIntVector> Dirty = MoveTemp(PendingRetargetCoords);
+	PendingRetargetCoords.Reset();
+	LastShellCount = 0;
+	LastRegionCount = 0;
+	if (StepSize == 1)
+	{
+		const TArray<FIntVector>& Shell = GetShellOffsets(Step);
+		LastShellCount = Shell.Num();
+		Dirty.Reserve(Dirty.Num() + Shell.Num());
+		for (const FIntVector& Offset : Shell)
+		{
+			Dirty.Add(ViewerChunk + Offset);
+		}
+		IncrementalViewerChunk = ViewerChunk;
+	}
+	if (Dirty.Num() == 0)
+	{
+		return;
+	}
+
+	// Pass 1: re-target dirty chunks (raw band LOD + hysteresis vs the committed LOD), tracking
+	// volume entries and exits.
+	TArray<FIntVector> Changed;
+	TMap<FIntVector, int32> RemovedBalanced;
+	for (const FIntVector& ChunkCoord : Dirty)
+	{
+		const FVolumeOffset* Entry = FindVolumeOffset(ChunkCoord - ViewerChunk);
+		if (!Entry || Entry->Zone == INDEX_NONE)
+		{
+			if (TargetLODCache.Remove(ChunkCoord) > 0)
+			{
+				int32 OldBalanced = 0;
+				BalancedLODCache.RemoveAndCopyValue(ChunkCoord, OldBalanced);
+				RemovedBalanced.Add(ChunkCoord, OldBalanced);
+				LoadCandidates.Remove(ChunkCoord);
+				ResidentCandidates.Remove(ChunkCoord);
+				Changed.Add(ChunkCoord);
+			}
+			continue;
+		}
+
+		int32 Target = Entry->RawLOD;
+		if (bBalance)
+		{
+			if (const int32* Prev = BalancedLODCache.Find(ChunkCoord))
+			{
+				Target = ApplyLODHysteresis(*Prev, Entry->RawLOD, Entry->Distance);
+			}
+		}
+
+		if (int32* Existing = TargetLODCache.Find(ChunkCoord))
+		{
+			if (*Existing == Target)
+			{
+				continue;
+			}
+			*Existing = Target;
+		}
+		else
+		{
+			TargetLODCache.Add(ChunkCoord, Target);
+			LoadCandidates.Add(ChunkCoord);
+		}
+		Changed.Add(ChunkCoord);
+	}
+
+	if (Changed.Num() == 0)
+	{
+		return;
+	}
+
+	if (!bBalance)
+	{
+		for (const FIntVector& ChunkCoord : Changed)
+		{
+			if (const int32* Target = TargetLODCache.Find(ChunkCoord))
+			{
+				BalancedLODCache.Add(ChunkCoord, *Target);
+			}
+		}
+		LastRegionCount = Changed.Num();
+		return;
+	}
+
+	// Pass 2: local 2:1 balance. A change at C can only alter balanced LODs within
+	// (coarsest - lowest LOD involved at C) / delta chunks of it; reset that region to its
+	// targets and relax it to the fixpoint against its (unchanged) surroundings.
+	int32 NumOffsets = 0;
+	const FIntVector* Offsets = GetLODBalanceOffsets(bDiagonal, NumOffsets);
+	const int32 Delta = FMath::Max(1, MaxNeighborLODDelta);
+
+	TSet<FIntVector> Region;
+	for (const FIntVector& ChunkCoord : Changed)
+	{
+		int32 Lowest = VolumeMaxLOD;
+		if (const int32* Target = TargetLODCache.Find(ChunkCoord))
+		{
+			Lowest = FMath::Min(Lowest, *Target);
+		}
+		if (const int32* Balanced = BalancedLODCache.Find(ChunkCoord))
+		{
+			Lowest = FMath::Min(Lowest, *Balanced);
+		}
+		else if (const int32* Removed = RemovedBalanced.Find(ChunkCoord))
+		{
+			Lowest = FMath::Min(Lowest, *Removed);
+		}
+		for (int32 i = 0; i < NumOffsets; ++i)
+		{
+			if (const int32* NLOD = BalancedLODCache.Find(ChunkCoord + Offsets[i]))
+			{
+				Lowest = FMath::Min(Lowest, *NLOD + Delta);
+			}
+		}
+
+		const int32 Radius = FMath::Clamp(FMath::DivideAndRoundUp(VolumeMaxLOD - Lowest, Delta), 0, VolumeBalanceRadius);
+		for (int32 dz = -Radius; dz <= Radius; ++dz)
+		{
+			for (int32 dy = -Radius; dy <= Radius; ++dy)
+			{
+				for (int32 dx = -Radius; dx <= Radius; ++dx)
+				{
+					const FIntVector Coord = ChunkCoord + FIntVector(dx, dy, dz);
+					if (TargetLODCache.Contains(Coord))
 					{
-						MinNeighbor = FMath::Min(MinNeighbor, *NLOD);
+						Region.Add(Coord);
 					}
 				}
+			}
+		}
+	}
 
-				const int32 MaxAllowed = MinNeighbor + MaxNeighborLODDelta;
-				if (Pair.Value > MaxAllowed)
+	TMap<FIntVector, int32> Previous;
+	Previous.Reserve(Region.Num());
+	for (const FIntVector& Coord : Region)
+	{
+		int32& Balanced = BalancedLODCache.FindOrAdd(Coord, INDEX_NONE);
+		Previous.Add(Coord, Balanced);
+		Balanced = TargetLODCache.FindChecked(Coord);
+	}
+
+	bool bChanged = true;
+	int32 Guard = 0;
+	while (bChanged && Guard++ < 16)
+	{
+		bChanged = false;
+		for (const FIntVector& Coord : Region)
+		{
+			int32& Value = BalancedLODCache.FindChecked(Coord);
+			int32 MinNeighbor = Value;
+			for (int32 i = 0; i < NumOffsets; ++i)
+			{
+				if (const int32* NLOD = BalancedLODCache.Find(Coord + Offsets[i]))
 				{
-					Pair.Value = MaxAllowed;
-					bChanged = true;
+					MinNeighbor = FMath::Min(MinNeighbor, *NLOD);
 				}
 			}
+
+			const int32 MaxAllowed = MinNeighbor + MaxNeighborLODDelta;
+			if (Value > MaxAllowed)
+			{
+				Value = MaxAllowed;
+				bChanged = true;
+			}
 		}
 	}
 
-	// Commit for next frame's hysteresis.
-	CommittedLODCache = BalancedLODCache;
+	// Changed committed LOD = changed hysteresis input next update.
+	for (const TPair<FIntVector, int32>& Pair : Previous)
+	{
+		if (Pair.Value != BalancedLODCache.FindChecked(Pair.Key))
+		{
+			PendingRetargetCoords.Add(Pair.Key);
+		}
+	}
+	LastRegionCount = Region.Num();
+}
+
+void FDistanceBandLODStrategy::RebuildIncrementalVolume(const FIntVector& ViewerChunk, bool bBalance, bool bDiagonal)
+{
+	// Same passes as RebuildBalancedLODCache, over the offset table. The previous balanced map
+	// is the committed input to hysteresis.
+	TMap<FIntVector, int32> Previous = MoveTemp(BalancedLODCache);
+	BalancedLODCache.Reset();
+	TargetLODCache.Reset();
+	PendingRetargetCoords.Reset();
+	LoadCandidates.Reset();
+	ResidentCandidates.Reset();
+
+	for (int32 Z = VolumeMinZ; Z <= VolumeMaxZ; ++Z)
+	{
+		for (int32 Y = -VolumeRadius; Y <= VolumeRadius; ++Y)
+		{
+			for (int32 X = -VolumeRadius; X <= VolumeRadius; ++X)
+			{
+				const FVolumeOffset& Entry = *FindVolumeOffset(FIntVector(X, Y, Z));
+				if (Entry.Zone == INDEX_NONE)
+				{
+					continue;
+				}
+
+				const FIntVector ChunkCoord = ViewerChunk + FIntVector(X, Y, Z);
+				int32 Target = Entry.RawLOD;
+				if (bBalance)
+				{
+					if (const int32* Prev = Previous.Find(ChunkCoord))
+					{
+						Target = ApplyLODHysteresis(*Prev, Entry.RawLOD, Entry.Distance);
+					}
+				}
+				TargetLODCache.Add(ChunkCoord, Target);
+			}
+		}
+	}
+
+	BalancedLODCache = TargetLODCache;
+	if (bBalance)
+	{
+		BalanceLODCache(BalancedLODCache, bDiagonal);
+	}
+
+	LoadCandidates.Reserve(BalancedLODCache.Num());
+	for (const TPair<FIntVector, int32>& Pair : BalancedLODCache)
+	{
+		LoadCandidates.Add(Pair.Key);
+		if (bBalance)
+		{
+			const int32* Prev = Previous.Find(Pair.Key);
+			if (!Prev || *Prev != Pair.Value)
+			{
+				PendingRetargetCoords.Add(Pair.Key);
+			}
+		}
+	}
+
+	IncrementalViewerChunk = ViewerChunk;
+	bIncrementalValid = true;
+	bIncrementalBalance = bBalance;
+	bIncrementalDiagonal = bDiagonal;
+	bLastUnloadScanValid = false;
+	LastShellCount = 0;
+	LastRegionCount = BalancedLODCache.Num();
+	++IncrementalRebuildCount;
+}
+
+void FDistanceBandLODStrategy::ResetIncrementalVolume()
+{
+	// The legacy path's hysteresis reads CommittedLODCache; hand it the current assignment.
+	if (bIncrementalValid)
+	{
+		CommittedLODCache = BalancedLODCache;
+	}
+	TargetLODCache.Reset();
+	PendingRetargetCoords.Reset();
+	LoadCandidates.Reset();
+	ResidentCandidates.Reset();
+	bIncrementalValid = false;
+	bLastUnloadScanValid = false;
+}
+
+bool FDistanceBandLODStrategy::MakeVolumeRequest(
+	const FIntVector& ChunkCoord,
+	const FLODQueryContext& Context,
+	FChunkLODRequest& OutRequest) const
+{
+	// Same culls and request fields as GetVisibleChunks; membership (the distance check) is the volume's.
+	if (ShouldCullOutsideTerrainBounds(ChunkCoord, Context)
+		|| ShouldCullIslandBoundary(ChunkCoord, Context)
+		|| ShouldCullBeyondHorizon(ChunkCoord, Context))
+	{
+		return false;
+	}
+
+	if (bEnableFrustumCulling && !IsChunkInFrustum(ChunkCoord, Context))
+	{
+		return false;
+	}
+
+	float MorphFactor = 0.0f;
+	if (bEnableMorphing)
+	{
+		const float Distance = GetDistanceToViewer(ChunkCoordToWorldCenter(ChunkCoord), Context);
+		if (const FLODBand* Band = FindBandForDistance(Distance))
+		{
+			MorphFactor = Band->GetMorphFactor(Distance);
+		}
+	}
+
+	OutRequest.ChunkCoord = ChunkCoord;
+	OutRequest.LODLevel = GetLODForChunk(ChunkCoord, Context);
+	OutRequest.Priority = CalculatePriority(ChunkCoord, Context);
+	OutRequest.MorphFactor = MorphFactor;
+	return true;
+}
+
+void FDistanceBandLODStrategy::PruneColumnSurfaceCache()
+{
+	// Keep every column the unload scan can still touch (unload radius is a small multiple of the
+	// view radius); only prune once the cache is well past the working set, so it's amortized.
+	const float ChunkW = FMath::Max(BaseChunkSize * VoxelSize, 1.0f);
+	const int32 KeepRadius = FMath::CeilToInt(2.0f * MaxViewDistance / ChunkW) + 2;
+	const int32 Side = 2 * KeepRadius + 1;
+	if (ColumnSurfaceCache.Num() <= 2 * Side * Side)
+	{
+		return;
+	}
+
+	for (auto It = ColumnSurfaceCache.CreateIterator(); It; ++It)
+	{
+		const FIntPoint& Column = It.Key();
+		if (FMath::Abs(Column.X - CachedViewerChunk.X) > KeepRadius || FMath::Abs(Column.Y - CachedViewerChunk.Y) > KeepRadius)
+		{
+			It.RemoveCurrent();
+		}
+	}
 }
 
 bool FDistanceBandLODStrategy::IsChunkInFrustum(
@@ -928,22 +1551,15 @@ bool FDistanceBandLODStrategy::ShouldCullOutsideTerrainBounds(
 		return false;
 	}
 
-	// Get chunk's Z bounds in world space
-	const float ChunkWorldSize = BaseChunkSize * VoxelSize;
-	const float ChunkMinZ = Context.WorldOrigin.Z + (ChunkCoord.Z * ChunkWorldSize);
-	const float ChunkMaxZ = ChunkMinZ + ChunkWorldSize;
-
-	// Cull if chunk is entirely below terrain minimum
-	if (ChunkMaxZ < TerrainMinHeight)
+	if (IsOutsideTerrainHeightRange(ChunkCoord, Context))
 	{
 		return true;
 	}
 
-	// Cull if chunk is entirely above terrain maximum
-	if (ChunkMinZ > TerrainMaxHeight)
-	{
-		return true;
-	}
+	// Get chunk's Z bounds in world space
+	const float ChunkWorldSize = BaseChunkSize * VoxelSize;
+	const float ChunkMinZ = Context.WorldOrigin.Z + (ChunkCoord.Z * ChunkWorldSize);
+	const float ChunkMaxZ = ChunkMinZ + ChunkWorldSize;
 
 	// Far-band surface slab: beyond the first (full-detail) band, a column only keeps chunks
 	// around its OWN surface — the global range above spans the whole world's min–max and loads
@@ -976,6 +1592,23 @@ bool FDistanceBandLODStrategy::ShouldCullOutsideTerrainBounds(
 	return false;
 }
 
+bool FDistanceBandLODStrategy::IsOutsideTerrainHeightRange(
+	const FIntVector& ChunkCoord,
+	const FLODQueryContext& Context) const
+{
+	if (WorldMode != EWorldMode::InfinitePlane && WorldMode != EWorldMode::IslandBowl)
+	{
+		return false;
+	}
+
+	const float ChunkWorldSize = BaseChunkSize * VoxelSize;
+	const float ChunkMinZ = Context.WorldOrigin.Z + (ChunkCoord.Z * ChunkWorldSize);
+	const float ChunkMaxZ = ChunkMinZ + ChunkWorldSize;
+
+	// Entirely below the terrain minimum, or entirely above the terrain maximum
+	return ChunkMaxZ < TerrainMinHeight || ChunkMinZ > TerrainMaxHeight;
+}
+
 void FDistanceBandLODStrategy::GetColumnSurfaceRange(int32 ChunkX, int32 ChunkY,
 	const FVector& WorldOrigin, float& OutMin, float& OutMax) const
 {
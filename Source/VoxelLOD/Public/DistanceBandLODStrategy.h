@@ -20,8 +20,11 @@
  * - Optional view frustum culling
  * - Priority boost for chunks in view direction
  *
- * Performance: O(n) for visible chunk enumeration where n = chunks in range
- * Memory: Minimal state (just configuration)
+ * Performance: O(n) for visible chunk enumeration where n = chunks in range.
+ * With voxel.LODIncremental, viewer chunk steps cost O(shell) instead (see
+ * UpdateIncrementalVolume).
+ * Memory: Minimal state (just configuration); the incremental mode keeps the
+ * candidate volume and per-step shell tables.
  *
  * @see IVoxelLODStrategy
  * @see Documentation/LOD_SYSTEM.md
@@ -103,6 +106,9 @@ public:
 	/** Unload horizon: chunks beyond MaxViewDistance * UnloadDistanceMultiplier are out of range. */
 	virtual float GetUnloadDistance() const override { return MaxViewDistance * UnloadDistanceMultiplier; }
 
+	/** voxel.LODBalance and voxel.LODBalanceDiagonal both on. */
+	virtual bool HasFullNeighborBalance() const override;
+
 protected:
 	// ==================== Internal Helpers ====================
 
@@ -165,6 +171,45 @@ protected:
 	 */
 	void RebuildBalancedLODCache(const FLODQueryContext& Context);
 
+	/**
+	 * Refine-only 2:1 balance of a chunk -> LOD map to its fixpoint (no neighbour,
+	 * face-only or all 26 per bDiagonal, more than MaxNeighborLODDelta finer).
+	 */
+	void BalanceLODCache(TMap<FIntVector, int32>& Cache, bool bDiagonal) const;
+
+	// ==================== Incremental View Volume ====================
+
+	/** Whether Update / GetChunksToLoad / GetChunksToUnload run the incremental path (voxel.LODIncremental). */
+	bool IsIncrementalVolumeActive() const;
+
+	/** Rebuild the viewer-relative offset table (radius, vertical range, zones) and drop cached shells. */
+	void BuildVolumeOffsetTable();
+
+	/** Chunk-centre distance for a viewer-chunk-relative offset (the incremental mode's quantized distance). */
+	float GetVolumeOffsetDistance(const FIntVector& Offset) const;
+
+	/**
+	 * Offsets (relative to the NEW viewer chunk) whose zone differs across a one-chunk
+	 * viewer step: chunks entering/leaving the view volume or crossing any band or
+	 * hysteresis edge. Built once per step direction and cached.
+	 */
+	const TArray<FIntVector>& GetShellOffsets(const FIntVector& Step);
+
+	/** Incremental counterpart of RebuildBalancedLODCache: re-target only the dirty shell, rebalance locally. */
+	void UpdateIncrementalVolume(const FLODQueryContext& Context);
+
+	/** Full rebuild of the incremental volume (first use, config change, or a multi-chunk jump). */
+	void RebuildIncrementalVolume(const FIntVector& ViewerChunk, bool bBalance, bool bDiagonal);
+
+	/** Drop incremental state; the legacy path resumes from the current balanced LODs. */
+	void ResetIncrementalVolume();
+
+	/** Build a load request for a candidate chunk, applying the per-world-mode and frustum culls. */
+	bool MakeVolumeRequest(const FIntVector& ChunkCoord, const FLODQueryContext& Context, FChunkLODRequest& OutRequest) const;
+
+	/** Bound ColumnSurfaceCache to the columns around the viewer. */
+	void PruneColumnSurfaceCache();
+
 	/**
 	 * Check if a chunk is within the view frustum.
 	 */
@@ -205,6 +250,15 @@ protected:
 		const FLODQueryContext& Context
 	) const;
 
+	/**
+	 * The viewer-independent part of ShouldCullOutsideTerrainBounds: chunk entirely
+	 * outside the global terrain height range.
+	 */
+	bool IsOutsideTerrainHeightRange(
+		const FIntVector& ChunkCoord,
+		const FLODQueryContext& Context
+	) const;
+
 	/**
 	 * Check if chunk should be culled for Island mode (beyond island boundary).
 	 * Returns true if chunk should be CULLED (not rendered).
@@ -272,6 +326,81 @@ protected:
 	/** LOD committed last frame per chunk; input to this frame's hysteresis. */
 	TMap<FIntVector, int32> CommittedLODCache;
 
+	// ==================== Incremental View Volume ====================
+
+	/**
+	 * Viewer-relative data for one offset of the candidate cube. Everything is measured
+	 * from the viewer chunk's centre, so the table is viewer-independent and the whole
+	 * LOD field is a function of the viewer chunk alone.
+	 */
+	struct FVolumeOffset
+	{
+		/** Chunk-centre distance from the viewer chunk's centre */
+		float Distance = 0.0f;
+
+		/** Raw distance-band LOD at Distance */
+		int32 RawLOD = 0;
+
+		/**
+		 * Position of Distance among every band, hysteresis and view-distance edge
+		 * (INDEX_NONE = beyond view distance). Equal zones take identical band,
+		 * hysteresis and membership decisions.
+		 */
+		int32 Zone = INDEX_NONE;
+	};
+
+	/** Offset table entry for a viewer-chunk-relative offset, or nullptr outside the candidate cube. */
+	const FVolumeOffset* FindVolumeOffset(const FIntVector& Offset) const;
+
+	/** Offset table over [-VolumeRadius, VolumeRadius]^2 x [VolumeMinZ, VolumeMaxZ] */
+	TArray<FVolumeOffset> VolumeOffsets;
+	int32 VolumeRadius = 0;
+	int32 VolumeMinZ = 0;
+	int32 VolumeMaxZ = 0;
+
+	/** Sorted distance edges the zones are measured against */
+	TArray<float> VolumeZoneEdges;
+
+	/** Coarsest band LOD, and how far (chunks) a target change can move a balanced LOD */
+	int32 VolumeMaxLOD = 0;
+	int32 VolumeBalanceRadius = 0;
+
+	/** View distance the table was built for (SetViewDistance is inline) */
+	float VolumeViewDistance = -1.0f;
+	bool bVolumeTableDirty = true;
+
+	/** Step (new viewer chunk - old, Chebyshev 1) -> shell offsets */
+	TMap<FIntVector, TArray<FIntVector>> ShellOffsetCache;
+
+	/** Pre-balance LOD (band + hysteresis) per volume chunk; its keys are the candidate volume */
+	TMap<FIntVector, int32> TargetLODCache;
+
+	/** Chunks whose balanced LOD changed last update: their hysteresis input moved, re-target next update */
+	TSet<FIntVector> PendingRetargetCoords;
+
+	/** Volume chunks not yet seen loaded (GetChunksToLoad walks only these) */
+	mutable TSet<FIntVector> LoadCandidates;
+
+	/** Volume chunks seen loaded; returned to LoadCandidates if they leave LoadedChunks */
+	mutable TSet<FIntVector> ResidentCandidates;
+
+	/** Viewer chunk / cvar state the incremental volume was built for */
+	FIntVector IncrementalViewerChunk = FIntVector::ZeroValue;
+	bool bIncrementalValid = false;
+	bool bIncrementalBalance = true;
+	bool bIncrementalDiagonal = true;
+
+	/** GetChunksToUnload skips its scan while neither the viewer chunk nor the loaded set changed */
+	mutable FIntVector LastUnloadScanChunk = FIntVector::ZeroValue;
+	mutable uint32 LastUnloadScanLoadedGeneration = 0;
+	mutable bool bLastUnloadScanValid = false;
+	mutable bool bLastUnloadScanCapped = false;
+
+	/** Incremental stats (debug info) */
+	int32 LastShellCount = 0;
+	int32 LastRegionCount = 0;
+	int32 IncrementalRebuildCount = 0;
+
 	/** Cached voxel size from configuration */
 	float VoxelSize = 100.0f;
 
@@ -320,8 +449,9 @@ protected:
 
 	/**
 	 * Column (chunk XY) -> [min, max] analytic surface height over the chunk footprint
-	 * (5-point sample: corners + centre). Memoized for the strategy's lifetime — generation
-	 * params are immutable per world. Game-thread only.
+	 * (5-point sample: corners + centre). Memoized across updates — generation params are
+	 * immutable per world — and pruned to the columns around the viewer (PruneColumnSurfaceCache)
+	 * so a long traverse doesn't grow it without bound. Game-thread only.
 	 */
 	mutable TMap<FIntPoint, FFloatInterval> ColumnSurfaceCache;
 
@@ -192,6 +192,18 @@ public:
 		return -1.0f;
 	}
 
+	/**
+	 * True if every pair of loaded chunks sharing a face, edge or corner is guaranteed to differ
+	 * by at most one LOD level (full 26-neighbour 2:1 balance). Consumers that rely on a
+	 * neighbour never reading a chunk below half its stride gate on this.
+	 *
+	 * Default: false (no balance guarantee).
+	 */
+	virtual bool HasFullNeighborBalance() const
+	{
+		return false;
+	}
+
 	// ==================== Debugging ====================
 
 	/**
@@ -0,0 +1,177 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "DistanceBandLODStrategy.h"
+#include "VoxelWorldConfiguration.h"
+#include "HAL/IConsoleManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DistanceBandLODTestUtils
+{
+	/** Exposes the balanced LOD map and lets a test force the full-rebuild path. */
+	class FTestStrategy : public FDistanceBandLODStrategy
+	{
+	public:
+		const TMap<FIntVector, int32>& GetBalancedLODs() const { return BalancedLODCache; }
+		int32 GetLastShellCount() const { return LastShellCount; }
+		void InvalidateIncrementalVolume() { bIncrementalValid = false; }
+	};
+
+	static bool SameLODs(const TMap<FIntVector, int32>& A, const TMap<FIntVector, int32>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+		for (const TPair<FIntVector, int32>& Pair : A)
+		{
+			const int32* Other = B.Find(Pair.Key);
+			if (!Other || *Other != Pair.Value)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDistanceBandLODIncrementalParityTest,
+	"VoxelWorlds.LOD.IncrementalVolume.Parity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDistanceBandLODIncrementalParityTest::RunTest(const FString& Parameters)
+{
+	using namespace DistanceBandLODTestUtils;
+
+	IConsoleVariable* IncrementalVar = IConsoleManager::Get().FindConsoleVariable(TEXT("voxel.LODIncremental"));
+	if (!TestNotNull(TEXT("voxel.LODIncremental registered"), IncrementalVar))
+	{
+		return false;
+	}
+	const int32 SavedValue = IncrementalVar->GetInt();
+	IncrementalVar->Set(1, ECVF_SetByCode);
+
+	UVoxelWorldConfiguration* Config = NewObject<UVoxelWorldConfiguration>();
+	Config->ChunkSize = 32;
+	Config->VoxelSize = 100.0f;
+	Config->WorldMode = EWorldMode::InfinitePlane;
+	Config->bFarBandSurfaceSlabCulling = false;
+	Config->ViewDistance = 30000.0f;
+	Config->LODBands.Reset();
+	Config->LODBands.Add(FLODBand(0.0f, 5000.0f, 0));
+	Config->LODBands.Add(FLODBand(5000.0f, 10000.0f, 1));
+	Config->LODBands.Add(FLODBand(10000.0f, 18000.0f, 2));
+	Config->LODBands.Add(FLODBand(18000.0f, 30000.0f, 3));
+
+	// Incremental instance vs. one forced through the full rebuild every update. Both see the
+	// same history, so their balanced maps must agree after every update.
+	FTestStrategy Incremental;
+	FTestStrategy Reference;
+	Incremental.Initialize(Config);
+	Reference.Initialize(Config);
+
+	FLODQueryContext Context;
+	Context.WorldMode = EWorldMode::InfinitePlane;
+	Context.ViewDistance = Config->ViewDistance;
+
+	// A walk of single-chunk steps (axis and diagonal, including reversals that exercise the
+	// hysteresis deadbands), sub-chunk moves, and one multi-chunk jump.
+	const float ChunkW = 3200.0f;
+	TArray<FVector> Path;
+	FVector Pos(100.0f, 100.0f, 1000.0f);
+	FRandomStream Rng(77);
+	for (int32 i = 0; i < 40; ++i)
+	{
+		Path.Add(Pos);
+		if (i == 25)
+		{
+			Pos += FVector(3.0f * ChunkW, -2.0f * ChunkW, 0.0f);
+		}
+		else if (i % 5 == 4)
+		{
+			Pos += FVector(0.1f * ChunkW, 0.0f, 0.0f);
+		}
+		else
+		{
+			Pos += FVector(Rng.RandRange(-1, 1) * ChunkW, Rng.RandRange(-1, 1) * ChunkW, (i % 7 == 0 ? ChunkW : 0.0f));
+		}
+	}
+
+	bool bAllMatch = true;
+	bool bShellSmaller = true;
+	for (const FVector& ViewerPos : Path)
+	{
+		Context.ViewerPosition = ViewerPos;
+		Incremental.Update(Context, 0.016f);
+		Reference.InvalidateIncrementalVolume();
+		Reference.Update(Context, 0.016f);
+
+		bAllMatch &= SameLODs(Incremental.GetBalancedLODs(), Reference.GetBalancedLODs());
+		bShellSmaller &= Incremental.GetLastShellCount() < Incremental.GetBalancedLODs().Num() / 2;
+	}
+
+	TestTrue(TEXT("Incremental balanced LODs match the full rebuild at every step"), bAllMatch);
+	TestTrue(TEXT("Per-step shell is a small fraction of the volume"), bShellSmaller);
+	TestTrue(TEXT("Volume is populated"), Incremental.GetBalancedLODs().Num() > 0);
+
+	IncrementalVar->Set(SavedValue, ECVF_SetByCode);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDistanceBandLODUnloadScanGenerationTest,
+	"VoxelWorlds.LOD.IncrementalVolume.UnloadScanGeneration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDistanceBandLODUnloadScanGenerationTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* IncrementalVar = IConsoleManager::Get().FindConsoleVariable(TEXT("voxel.LODIncremental"));
+	if (!TestNotNull(TEXT("voxel.LODIncremental registered"), IncrementalVar))
+	{
+		return false;
+	}
+	const int32 SavedValue = IncrementalVar->GetInt();
+	IncrementalVar->Set(1, ECVF_SetByCode);
+
+	UVoxelWorldConfiguration* Config = NewObject<UVoxelWorldConfiguration>();
+	Config->ChunkSize = 32;
+	Config->VoxelSize = 100.0f;
+	Config->WorldMode = EWorldMode::InfinitePlane;
+	Config->bFarBandSurfaceSlabCulling = false;
+	Config->ViewDistance = 10000.0f;
+	Config->LODBands.Reset();
+	Config->LODBands.Add(FLODBand(0.0f, 5000.0f, 0));
+	Config->LODBands.Add(FLODBand(5000.0f, 10000.0f, 1));
+
+	FDistanceBandLODStrategy Strategy;
+	Strategy.Initialize(Config);
+
+	FLODQueryContext Context;
+	Context.WorldMode = EWorldMode::InfinitePlane;
+	Context.ViewDistance = Config->ViewDistance;
+	Context.ViewerPosition = FVector(100.0f, 100.0f, 100.0f);
+	Strategy.Update(Context, 0.016f);
+
+	const FIntVector NearChunk(0, 0, 0);
+	const FIntVector FarChunk(100, 0, 0);
+	TArray<FIntVector> Unload;
+
+	Context.LoadedChunksGeneration = 1;
+	Strategy.GetChunksToUnload(Unload, TSet<FIntVector>({ NearChunk }), Context);
+	TestEqual(TEXT("Near chunk stays loaded"), Unload.Num(), 0);
+
+	// Same viewer chunk and same set size, but a different set: the scan must still run.
+	Context.LoadedChunksGeneration = 2;
+	Strategy.GetChunksToUnload(Unload, TSet<FIntVector>({ FarChunk }), Context);
+	TestTrue(TEXT("Swapped-in far chunk is unloaded"), Unload.Num() == 1 && Unload[0] == FarChunk);
+
+	// Unchanged generation and viewer chunk: the scan is skipped.
+	Strategy.GetChunksToUnload(Unload, TSet<FIntVector>({ FarChunk }), Context);
+	TestEqual(TEXT("Unchanged loaded set skips the scan"), Unload.Num(), 0);
+
+	IncrementalVar->Set(SavedValue, ECVF_SetByCode);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
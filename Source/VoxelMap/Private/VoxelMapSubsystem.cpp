@@ -495,19 +495,25 @@ void UVoxelMapSubsystem::GenerateTileAsync(FIntPoint TileCoord)
 		TArray<float> Heights;
 		Heights.SetNumUninitialized(GridSize * GridSize);
 
+		// One grid row per batch query (heightmap modes evaluate it through the batch noise kernels).
+		TArray<float> RowX, RowY;
+		RowX.SetNumUninitialized(GridSize);
+		RowY.SetNumUninitialized(GridSize);
+
 		for (int32 GY = 0; GY < GridSize; ++GY)
 		{
 			for (int32 GX = 0; GX < GridSize; ++GX)
 			{
 				// Grid index (GX,GY) maps to pixel (GX-1, GY-1)
-				const float WorldX = (TileCoord.X * ChunkSize + GX - 1) * VoxelSize + WorldOrigin.X;
-				const float WorldY = (TileCoord.Y * ChunkSize + GY - 1) * VoxelSize + WorldOrigin.Y;
-
-				// TRUE generated surface height: the standalone mode carries a value-captured biome
-				// snapshot, so this applies the same continentalness modulation (offset + height-scale)
-				// and per-mode composition (e.g. IslandBowl falloff) as chunk generation.
-				Heights[GY * GridSize + GX] = WorldMode->GetTerrainHeightAt(WorldX, WorldY, NoiseParams);
+				RowX[GX] = (TileCoord.X * ChunkSize + GX - 1) * VoxelSize + WorldOrigin.X;
+				RowY[GX] = (TileCoord.Y * ChunkSize + GY - 1) * VoxelSize + WorldOrigin.Y;
 			}
+
+			// TRUE generated surface height: the standalone mode carries a value-captured biome
+			// snapshot, so this applies the same continentalness modulation (offset + height-scale)
+			// and per-mode composition (e.g. IslandBowl falloff) as chunk generation.
+			WorldMode->GetTerrainHeightsAt(
+				RowX.GetData(), RowY.GetData(), GridSize, NoiseParams, &Heights[GY * GridSize]);
 		}
 
 		// Shading ranges derived from the world mode's real height bounds (see ResolveChunkManager).
@@ -521,8 +527,33 @@ void UVoxelMapSubsystem::GenerateTileAsync(FIntPoint TileCoord)
 		const FVector LightDir = FVector(-0.707f, -0.707f, 1.0f).GetSafeNormal();
 
 		// --- Pass 2: color ---
+		const bool bBatchSurfaceQuery = bUseBiomes && BiomeSnapshot.bIsValid;
+		TArray<float> RowHeights;
+		TArray<uint8> RowMaterials, RowBiomes;
+		if (bBatchSurfaceQuery)
+		{
+			RowHeights.SetNumUninitialized(Resolution);
+			RowMaterials.SetNumUninitialized(Resolution);
+			RowBiomes.SetNumUninitialized(Resolution);
+		}
+
 		for (int32 PY = 0; PY < Resolution; ++PY)
 		{
+			if (bBatchSurfaceQuery)
+			{
+				for (int32 PX = 0; PX < Resolution; ++PX)
+				{
+					RowX[PX] = (TileCoord.X * ChunkSize + PX) * VoxelSize + WorldOrigin.X;
+					RowY[PX] = (TileCoord.Y * ChunkSize + PY) * VoxelSize + WorldOrigin.Y;
+					RowHeights[PX] = Heights[(PY + 1) * GridSize + (PX + 1)];
+				}
+
+				FVoxelSurfaceQuery::QuerySurfaceConditionsBatch(
+					RowX.GetData(), RowY.GetData(), RowHeights.GetData(), Resolution, VoxelSize,
+					BiomeSnapshot, NoiseParams.Seed, bUseWater, WaterLevel,
+					RowMaterials.GetData(), RowBiomes.GetData());
+			}
+
 			for (int32 PX = 0; PX < Resolution; ++PX)
 			{
 				const float WorldX = (TileCoord.X * ChunkSize + PX) * VoxelSize + WorldOrigin.X;
@@ -537,13 +568,10 @@ void UVoxelMapSubsystem::GenerateTileAsync(FIntPoint TileCoord)
 				// material -> priority-sorted height rules), via FVoxelSurfaceQuery + the snapshot.
 				uint8 MaterialID = 0;
 
-				if (bUseBiomes && BiomeSnapshot.bIsValid)
+				if (bBatchSurfaceQuery)
 				{
-					uint8 BiomeID = 0;
-					FVoxelSurfaceQuery::QuerySurfaceConditions(
-						WorldX, WorldY, Height, VoxelSize,
-						BiomeSnapshot, NoiseParams.Seed, bUseWater, WaterLevel,
-						MaterialID, BiomeID);
+					// Resolved for the whole row above
+					MaterialID = RowMaterials[PX];
 				}
 				else if (bUseBiomes)
 				{
@@ -247,3 +247,289 @@ private:
 		OutEigenvalues[2] = A[2][2];
 	}
 };
+
+/**
+ * Structure-of-arrays batch front end for FQEFSolver::Solve.
+ *
+ * Cells are queued with Add (the accumulated FQEFSolver, the cell bounds, and where the solved
+ * position goes) and Flush solves them four per VectorRegister4Float lane group: the Jacobi
+ * sweep runs lane-wise with per-lane pivot choice and convergence, followed by the thresholded
+ * pseudoinverse and the mass-point blend. Every lane replays the scalar Solve op-for-op (same
+ * pivot ties, same stale lower-triangle reads, no fused multiply-adds), so results are
+ * bit-identical to it — seam ring recomputes may use either path against an interior pass.
+ *
+ * Count <= 1 cells take the scalar early-outs inside Add. With bVectorized false (or without
+ * vector intrinsics) Add solves every cell immediately with the scalar Solve.
+ *
+ * OutPosition pointers must stay valid until Flush.
+ */
+struct FQEFBatchSolver
+{
+	static constexpr int32 LaneCount = 4;
+
+	/** Start a batch. Keeps the stream allocations of previous batches. */
+	void Begin(float InSVDThreshold, float InBiasStrength, bool bInVectorized)
+	{
+		SVDThreshold = InSVDThreshold;
+		BiasStrength = InBiasStrength;
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		bVectorized = bInVectorized;
+#else
+		bVectorized = false;
+#endif
+		for (TArray<float>& Stream : Streams)
+		{
+			Stream.Reset();
+		}
+		Targets.Reset();
+	}
+
+	/** Queue one cell (or solve it right away when it cannot benefit from the batch). */
+	void Add(const FQEFSolver& QEF, const FBox3f& CellBounds, FVector3f* OutPosition)
+	{
+		if (!bVectorized || QEF.Count <= 1)
+		{
+			*OutPosition = QEF.Solve(SVDThreshold, CellBounds, BiasStrength);
+			return;
+		}
+
+		const FVector3f MP = QEF.MassPoint / static_cast<float>(QEF.Count);
+		const float CellSize = CellBounds.GetExtent().X * 2.0f;
+		const float Values[NumStreams] = {
+			QEF.ATA[0][0], QEF.ATA[0][1], QEF.ATA[0][2], QEF.ATA[1][1], QEF.ATA[1][2], QEF.ATA[2][2],
+			QEF.ATb[0], QEF.ATb[1], QEF.ATb[2],
+			MP.X, MP.Y, MP.Z,
+			CellBounds.Min.X, CellBounds.Min.Y, CellBounds.Min.Z,
+			CellBounds.Max.X, CellBounds.Max.Y, CellBounds.Max.Z,
+			FMath::Max(CellSize, 0.001f),
+		};
+		for (int32 i = 0; i < NumStreams; i++)
+		{
+			Streams[i].Add(Values[i]);
+		}
+		Targets.Add(OutPosition);
+	}
+
+	/** Cells queued since Begin / the last Flush. */
+	int32 Num() const
+	{
+		return Targets.Num();
+	}
+
+	/** Solve every queued cell, write each result through its OutPosition, and empty the queue. */
+	void Flush()
+	{
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		const int32 Count = Targets.Num();
+		if (Count == 0)
+		{
+			return;
+		}
+
+		// Pad to whole lane groups with zero systems (converge immediately, results discarded).
+		const int32 Padded = Align(Count, LaneCount);
+		for (TArray<float>& Stream : Streams)
+		{
+			Stream.SetNumZeroed(Padded);
+		}
+
+		for (int32 Base = 0; Base < Padded; Base += LaneCount)
+		{
+			float OutX[LaneCount], OutY[LaneCount], OutZ[LaneCount];
+			SolveLanes(Base, OutX, OutY, OutZ);
+
+			const int32 NumLanes = FMath::Min(LaneCount, Count - Base);
+			for (int32 Lane = 0; Lane < NumLanes; Lane++)
+			{
+				*Targets[Base + Lane] = FVector3f(OutX[Lane], OutY[Lane], OutZ[Lane]);
+			}
+		}
+
+		for (TArray<float>& Stream : Streams)
+		{
+			Stream.Reset();
+		}
+		Targets.Reset();
+#endif
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = Targets.GetAllocatedSize();
+		for (const TArray<float>& Stream : Streams)
+		{
+			Size += Stream.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+private:
+	enum EStream
+	{
+		S_A00, S_A01, S_A02, S_A11, S_A12, S_A22,
+		S_B0, S_B1, S_B2,
+		S_MPX, S_MPY, S_MPZ,
+		S_MinX, S_MinY, S_MinZ,
+		S_MaxX, S_MaxY, S_MaxZ,
+		S_CellSize,
+		NumStreams
+	};
+
+	TArray<float> Streams[NumStreams];
+	TArray<FVector3f*> Targets;
+	float SVDThreshold = 0.0f;
+	float BiasStrength = 0.0f;
+	bool bVectorized = false;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	/** FQEFSolver::Solve (Count >= 2 branch) + JacobiEigen3x3 for lanes [Base, Base + 4). */
+	void SolveLanes(int32 Base, float* OutX, float* OutY, float* OutZ) const
+	{
+		auto Load = [this, Base](EStream Stream) { return VectorLoad(Streams[Stream].GetData() + Base); };
+
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		const VectorRegister4Float One = VectorOneFloat();
+		const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+		const VectorRegister4Float ConvergeEps = VectorSetFloat1(1e-8f);
+		const VectorRegister4Float DiffEps = VectorSetFloat1(1e-10f);
+
+		// Jacobi state. The scalar sweep zeroes only A[p][q] (upper) of the pivot pair while the
+		// off-pivot row update writes both triangles, and later pivots read A[r][p] from either
+		// side — so the lower triangle is tracked separately to reproduce those reads exactly.
+		VectorRegister4Float A00 = Load(S_A00), A11 = Load(S_A11), A22 = Load(S_A22);
+		VectorRegister4Float U01 = Load(S_A01), U02 = Load(S_A02), U12 = Load(S_A12);
+		VectorRegister4Float L10 = U01, L20 = U02, L21 = U12;
+		VectorRegister4Float V[3][3] = {
+			{ One, Zero, Zero },
+			{ Zero, One, Zero },
+			{ Zero, Zero, One },
+		};
+		VectorRegister4Float Done = Zero;
+
+		constexpr int32 MaxIterations = 20;
+		for (int32 Iter = 0; Iter < MaxIterations; Iter++)
+		{
+			// Largest off-diagonal element; ties keep the earlier pair, as the scalar '>' does.
+			const VectorRegister4Float Abs01 = VectorAbs(U01);
+			const VectorRegister4Float Abs02 = VectorAbs(U02);
+			const VectorRegister4Float Abs12 = VectorAbs(U12);
+			const VectorRegister4Float Sel02 = VectorCompareGT(Abs02, Abs01);
+			const VectorRegister4Float Max01_02 = VectorSelect(Sel02, Abs02, Abs01);
+			const VectorRegister4Float P12 = VectorCompareGT(Abs12, Max01_02);
+			const VectorRegister4Float MaxVal = VectorSelect(P12, Abs12, Max01_02);
+			const VectorRegister4Float P02 = VectorSelect(P12, Zero, Sel02);
+
+			Done = VectorBitwiseOr(Done, VectorCompareLT(MaxVal, ConvergeEps));
+			if (VectorMaskBits(Done) == 0xF)
+			{
+				break;
+			}
+
+			// Per-lane pair (p, q) and the remaining row r: (0,1) r=2, (0,2) r=1, (1,2) r=0.
+			auto Pick = [&P02, &P12](const VectorRegister4Float& If01, const VectorRegister4Float& If02, const VectorRegister4Float& If12)
+			{
+				return VectorSelect(P12, If12, VectorSelect(P02, If02, If01));
+			};
+			const VectorRegister4Float App = Pick(A00, A00, A11);
+			const VectorRegister4Float Aqq = Pick(A11, A22, A22);
+			const VectorRegister4Float Apq = Pick(U01, U02, U12);
+			const VectorRegister4Float Arp = Pick(L20, L10, U01);
+			const VectorRegister4Float Arq = Pick(L21, U12, U02);
+
+			// Givens rotation
+			const VectorRegister4Float Diff = VectorSubtract(Aqq, App);
+			const VectorRegister4Float Phi = VectorDivide(Diff, VectorMultiply(Two, Apq));
+			VectorRegister4Float T = VectorDivide(One, VectorAdd(VectorAbs(Phi), VectorSqrt(VectorAdd(VectorMultiply(Phi, Phi), One))));
+			T = VectorSelect(VectorCompareLT(Phi, Zero), VectorNegate(T), T);
+			T = VectorSelect(VectorCompareLT(VectorAbs(Diff), DiffEps), One, T);
+
+			const VectorRegister4Float C = VectorDivide(One, VectorSqrt(VectorAdd(VectorMultiply(T, T), One)));
+			const VectorRegister4Float S = VectorMultiply(T, C);
+			const VectorRegister4Float Tau = VectorDivide(S, VectorAdd(One, C));
+
+			const VectorRegister4Float NewApp = VectorSubtract(App, VectorMultiply(T, Apq));
+			const VectorRegister4Float NewAqq = VectorAdd(Aqq, VectorMultiply(T, Apq));
+			const VectorRegister4Float NewArp = VectorSubtract(Arp, VectorMultiply(S, VectorAdd(Arq, VectorMultiply(Tau, Arp))));
+			const VectorRegister4Float NewArq = VectorAdd(Arq, VectorMultiply(S, VectorSubtract(Arp, VectorMultiply(Tau, Arq))));
+
+			// Converged lanes keep their state (the scalar loop has already broken out).
+			auto Commit = [&Done](VectorRegister4Float& Dest, const VectorRegister4Float& Value)
+			{
+				Dest = VectorSelect(Done, Dest, Value);
+			};
+			Commit(A00, Pick(NewApp, NewApp, A00));
+			Commit(A11, Pick(NewAqq, A11, NewApp));
+			Commit(A22, Pick(A22, NewAqq, NewAqq));
+			Commit(U01, Pick(Zero, NewArp, NewArp));
+			Commit(L10, Pick(L10, NewArp, NewArp));
+			Commit(U02, Pick(NewArp, Zero, NewArq));
+			Commit(L20, Pick(NewArp, L20, NewArq));
+			Commit(U12, Pick(NewArq, NewArq, Zero));
+			Commit(L21, Pick(NewArq, NewArq, L21));
+
+			for (int32 r = 0; r < 3; r++)
+			{
+				const VectorRegister4Float Vp = Pick(V[r][0], V[r][0], V[r][1]);
+				const VectorRegister4Float Vq = Pick(V[r][1], V[r][2], V[r][2]);
+				const VectorRegister4Float NewVp = VectorSubtract(Vp, VectorMultiply(S, VectorAdd(Vq, VectorMultiply(Tau, Vp))));
+				const VectorRegister4Float NewVq = VectorAdd(Vq, VectorMultiply(S, VectorSubtract(Vp, VectorMultiply(Tau, Vq))));
+				const VectorRegister4Float Col0 = Pick(NewVp, NewVp, V[r][0]);
+				const VectorRegister4Float Col1 = Pick(NewVq, V[r][1], NewVp);
+				const VectorRegister4Float Col2 = Pick(V[r][2], NewVq, NewVq);
+				Commit(V[r][0], Col0);
+				Commit(V[r][1], Col1);
+				Commit(V[r][2], Col2);
+			}
+		}
+
+		// Pseudoinverse: v = V * S^-1 * V^T * ATb over eigenvalues above the threshold.
+		const VectorRegister4Float ATb[3] = { Load(S_B0), Load(S_B1), Load(S_B2) };
+		const VectorRegister4Float Eigenvalues[3] = { A00, A11, A22 };
+		const VectorRegister4Float Threshold = VectorSetFloat1(SVDThreshold);
+		VectorRegister4Float Result[3] = { Zero, Zero, Zero };
+		for (int32 i = 0; i < 3; i++)
+		{
+			const VectorRegister4Float Keep = VectorCompareGT(Eigenvalues[i], Threshold);
+			VectorRegister4Float Proj = Zero;
+			for (int32 j = 0; j < 3; j++)
+			{
+				Proj = VectorAdd(Proj, VectorMultiply(V[j][i], ATb[j]));
+			}
+			Proj = VectorDivide(Proj, Eigenvalues[i]);
+			for (int32 j = 0; j < 3; j++)
+			{
+				Result[j] = VectorSelect(Keep, VectorAdd(Result[j], VectorMultiply(V[j][i], Proj)), Result[j]);
+			}
+		}
+
+		// Blend toward the mass point when outside the cell (FBox3f::IsInside is strict;
+		// GetClosestPointTo clamps per axis; Distance sums squares X, Y, Z in order).
+		const VectorRegister4Float Min[3] = { Load(S_MinX), Load(S_MinY), Load(S_MinZ) };
+		const VectorRegister4Float Max[3] = { Load(S_MaxX), Load(S_MaxY), Load(S_MaxZ) };
+		const VectorRegister4Float MP[3] = { Load(S_MPX), Load(S_MPY), Load(S_MPZ) };
+
+		VectorRegister4Float Inside = VectorCompareEQ(Zero, Zero);
+		VectorRegister4Float DistSq = Zero;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const VectorRegister4Float P = Result[Axis];
+			Inside = VectorBitwiseAnd(Inside, VectorBitwiseAnd(VectorCompareGT(P, Min[Axis]), VectorCompareLT(P, Max[Axis])));
+			const VectorRegister4Float Closest = VectorSelect(VectorCompareLT(P, Min[Axis]), Min[Axis],
+				VectorSelect(VectorCompareGT(P, Max[Axis]), Max[Axis], P));
+			const VectorRegister4Float Delta = VectorSubtract(Closest, P);
+			DistSq = (Axis == 0) ? VectorMultiply(Delta, Delta) : VectorAdd(DistSq, VectorMultiply(Delta, Delta));
+		}
+
+		VectorRegister4Float Blend = VectorDivide(VectorSqrt(DistSq), Load(S_CellSize));
+		Blend = VectorMultiply(VectorMultiply(Blend, VectorSetFloat1(BiasStrength)), Two);
+		Blend = VectorSelect(VectorCompareLT(Blend, Zero), Zero, VectorSelect(VectorCompareLT(Blend, One), Blend, One));
+
+		float* Out[3] = { OutX, OutY, OutZ };
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const VectorRegister4Float Lerped = VectorAdd(Result[Axis], VectorMultiply(Blend, VectorSubtract(MP[Axis], Result[Axis])));
+			VectorStore(VectorSelect(Inside, Result[Axis], Lerped), Out[Axis]);
+		}
+	}
+#endif
+};
@@ -3,6 +3,40 @@
 #include "VoxelCPUCubicMesher.h"
 #include "VoxelMeshing.h"
 #include "VoxelMaterialRegistry.h"
+#include "VoxelMeshingScratch.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GVoxelMeshingCubicBinaryGreedy = 1;
+static FAutoConsoleVariableRef CVarVoxelMeshingCubicBinaryGreedy(
+	TEXT("voxel.Meshing.CubicBinaryGreedy"),
+	GVoxelMeshingCubicBinaryGreedy,
+	TEXT("1 (default): greedy cubic meshing of chunks up to 64 voxels derives face visibility from per-column ")
+	TEXT("64-bit masks and merges with trailing-zero scans. 0: per-slice face masks built voxel by voxel. Both bit-identical."),
+	ECVF_Default);
+
+namespace VoxelCubicMeshing
+{
+	/**
+	 * Per-thread greedy-meshing scratch (TVoxelScratchScope): one slice's face mask and processed
+	 * flags, plus the binary path's column masks (3 axes x ChunkSize^2, bit i = voxel i along the
+	 * axis) and one face direction's visibility rows (slice x row, bit U = cell U).
+	 */
+	struct FGreedyScratch
+	{
+		TArray<uint16> FaceMask;
+		TArray<bool> Processed;
+
+		TArray<uint64> SolidColumns;
+		TArray<uint64> OpaqueColumns;
+		TArray<uint64> FaceRows;
+
+		SIZE_T GetAllocatedSize() const
+		{
+			return FaceMask.GetAllocatedSize() + Processed.GetAllocatedSize()
+				+ SolidColumns.GetAllocatedSize() + OpaqueColumns.GetAllocatedSize() + FaceRows.GetAllocatedSize();
+		}
+	};
+}
 
 // Face direction offsets: +X, -X, +Y, -Y, +Z, -Z
 const FIntVector FVoxelCPUCubicMesher::FaceOffsets[6] = {
@@ -273,6 +307,7 @@ bool FVoxelCPUCubicMesher::GenerateMeshCPU(
 		GenerateMeshSimple(Request, OutMeshData, OutStats);
 	}
 
+	Config.PackOutputVertices(Request, OutMeshData);
 	return true;
 }
 
@@ -297,25 +332,33 @@ void FVoxelCPUCubicMesher::GenerateMeshGreedy(
 	OutMeshData.Indices.Reserve(EstimatedFaces * 6);
 
 	uint32 GeneratedFaces = 0;
+	uint32 SolidVoxels = 0;
 
-	// Process each face direction
-	for (int32 Face = 0; Face < 6; Face++)
+	if (GVoxelMeshingCubicBinaryGreedy != 0 && Request.ChunkSize <= 64)
 	{
-		ProcessFaceDirectionGreedy(Face, Request, OutMeshData, GeneratedFaces);
+		// Binary path: all six directions from one pass over the voxels (also counts solids)
+		SolidVoxels = GenerateFacesBinaryGreedy(Request, OutMeshData, GeneratedFaces);
 	}
-
-	// Count solid voxels for stats
-	const int32 ChunkSize = Request.ChunkSize;
-	uint32 SolidVoxels = 0;
-	for (int32 Z = 0; Z < ChunkSize; Z++)
+	else
 	{
-		for (int32 Y = 0; Y < ChunkSize; Y++)
+		// Process each face direction
+		for (int32 Face = 0; Face < 6; Face++)
 		{
-			for (int32 X = 0; X < ChunkSize; X++)
+			ProcessFaceDirectionGreedy(Face, Request, OutMeshData, GeneratedFaces);
+		}
+
+		// Count solid voxels for stats
+		const int32 ChunkSize = Request.ChunkSize;
+		for (int32 Z = 0; Z < ChunkSize; Z++)
+		{
+			for (int32 Y = 0; Y < ChunkSize; Y++)
 			{
-				if (!Request.GetVoxel(X, Y, Z).IsAir())
+				for (int32 X = 0; X < ChunkSize; X++)
 				{
-					SolidVoxels++;
+					if (!Request.GetVoxel(X, Y, Z).IsAir())
+					{
+						SolidVoxels++;
+					}
 				}
 			}
 		}
@@ -454,11 +497,12 @@ void FVoxelCPUCubicMesher::ProcessFaceDirectionGreedy(
 	bool bPositive;
 	GetFaceAxes(Face, PrimaryAxis, UAxis, VAxis, bPositive);
 
-	// Allocate mask and processed arrays
-	TArray<uint16> FaceMask;
-	TArray<bool> Processed;
-	FaceMask.SetNumZeroed(SliceSize);
-	Processed.SetNumZeroed(SliceSize);
+	// Mask and processed arrays from this thread's scratch arena (both are cleared per slice below)
+	TVoxelScratchScope<VoxelCubicMeshing::FGreedyScratch> Scratch(EVoxelScratchUser::Cubic);
+	TArray<uint16>& FaceMask = Scratch->FaceMask;
+	TArray<bool>& Processed = Scratch->Processed;
+	FaceMask.SetNumUninitialized(SliceSize, EAllowShrinking::No);
+	Processed.SetNumUninitialized(SliceSize, EAllowShrinking::No);
 
 	// Process each slice along the primary axis
 	for (int32 SliceIndex = 0; SliceIndex < ChunkSize; SliceIndex++)
@@ -570,6 +614,220 @@ void FVoxelCPUCubicMesher::ProcessFaceDirectionGreedy(
 	}
 }
 
+uint32 FVoxelCPUCubicMesher::GenerateFacesBinaryGreedy(
+	const FVoxelMeshingRequest& Request,
+	FChunkMeshData& OutMeshData,
+	uint32& OutGeneratedFaces)
+{
+	const int32 ChunkSize = Request.ChunkSize;
+	const int32 SliceSize = ChunkSize * ChunkSize;
+	const uint64 FullRow = (ChunkSize == 64) ? ~0ull : ((1ull << ChunkSize) - 1);
+	const FVoxelData* Voxels = Request.GetVoxelArray().GetData();
+	const int32 AxisStride[3] = { 1, ChunkSize, SliceSize };
+
+	// Registry lookups hoisted out of the voxel loops
+	bool NonOccluding[256];
+	bool bAnyNonOccluding = false;
+	for (int32 MaterialID = 0; MaterialID < 256; MaterialID++)
+	{
+		NonOccluding[MaterialID] = FVoxelMaterialRegistry::IsNonOccluding(static_cast<uint8>(MaterialID));
+		bAnyNonOccluding |= NonOccluding[MaterialID];
+	}
+
+	TVoxelScratchScope<VoxelCubicMeshing::FGreedyScratch> Scratch(EVoxelScratchUser::Cubic);
+	TArray<uint64>& SolidColumns = Scratch->SolidColumns;
+	TArray<uint64>& OpaqueColumns = Scratch->OpaqueColumns;
+	TArray<uint64>& FaceRows = Scratch->FaceRows;
+	SolidColumns.SetNumUninitialized(3 * SliceSize, EAllowShrinking::No);
+	OpaqueColumns.SetNumUninitialized(3 * SliceSize, EAllowShrinking::No);
+	FaceRows.SetNumUninitialized(SliceSize, EAllowShrinking::No);
+	FMemory::Memzero(SolidColumns.GetData(), 3 * SliceSize * sizeof(uint64));
+	FMemory::Memzero(OpaqueColumns.GetData(), 3 * SliceSize * sizeof(uint64));
+
+	// Pass 1: per-column solid / opaque masks along each axis. A column along an axis is indexed by
+	// the other two coordinates in ascending axis order, which is (U + V * ChunkSize) for every face
+	// direction in GetFaceAxes. Opaque = solid and occluding (face culling needs both sides opaque).
+	uint64* SolidX = SolidColumns.GetData();
+	uint64* SolidY = SolidX + SliceSize;
+	uint64* SolidZ = SolidY + SliceSize;
+	uint64* OpaqueX = OpaqueColumns.GetData();
+	uint64* OpaqueY = OpaqueX + SliceSize;
+	uint64* OpaqueZ = OpaqueY + SliceSize;
+	uint32 SolidVoxels = 0;
+	for (int32 Z = 0; Z < ChunkSize; Z++)
+	{
+		for (int32 Y = 0; Y < ChunkSize; Y++)
+		{
+			const FVoxelData* Row = Voxels + Y * ChunkSize + Z * SliceSize;
+			uint64 RowSolid = 0;
+			uint64 RowOpaque = 0;
+			for (int32 X = 0; X < ChunkSize; X++)
+			{
+				const FVoxelData& Voxel = Row[X];
+				if (Voxel.IsAir())
+				{
+					continue;
+				}
+				const uint64 Bit = 1ull << X;
+				RowSolid |= Bit;
+				SolidY[X + Z * ChunkSize] |= 1ull << Y;
+				SolidZ[X + Y * ChunkSize] |= 1ull << Z;
+				if (!NonOccluding[Voxel.MaterialID])
+				{
+					RowOpaque |= Bit;
+					OpaqueY[X + Z * ChunkSize] |= 1ull << Y;
+					OpaqueZ[X + Y * ChunkSize] |= 1ull << Z;
+				}
+			}
+			SolidX[Y + Z * ChunkSize] = RowSolid;
+			OpaqueX[Y + Z * ChunkSize] = RowOpaque;
+			SolidVoxels += FMath::CountBits(RowSolid);
+		}
+	}
+
+	for (int32 Face = 0; Face < 6; Face++)
+	{
+		int32 PrimaryAxis, UAxis, VAxis;
+		bool bPositive;
+		GetFaceAxes(Face, PrimaryAxis, UAxis, VAxis, bPositive);
+
+		const uint64* SolidCols = SolidColumns.GetData() + PrimaryAxis * SliceSize;
+		const uint64* OpaqueCols = OpaqueColumns.GetData() + PrimaryAxis * SliceSize;
+		const int32 BoundaryBit = bPositive ? (ChunkSize - 1) : 0;
+
+		// Pass 2: visible = solid & ~(opaque & opaque neighbour), the neighbour column being the opaque
+		// mask shifted one voxel, with the neighbour chunk's voxel shifted in at the boundary (only
+		// looked up when the boundary voxel is opaque). Scatter visible bits into per-slice rows.
+		FMemory::Memzero(FaceRows.GetData(), SliceSize * sizeof(uint64));
+		for (int32 V = 0; V < ChunkSize; V++)
+		{
+			for (int32 U = 0; U < ChunkSize; U++)
+			{
+				const int32 Column = U + V * ChunkSize;
+				const uint64 Solid = SolidCols[Column];
+				if (Solid == 0)
+				{
+					continue;
+				}
+				const uint64 Opaque = OpaqueCols[Column];
+
+				uint64 OutsideOpaque = 0;
+				if ((Opaque >> BoundaryBit) & 1)
+				{
+					int32 Coords[3];
+					Coords[PrimaryAxis] = bPositive ? ChunkSize : -1;
+					Coords[UAxis] = U;
+					Coords[VAxis] = V;
+					const FVoxelData Outside = GetVoxelAt(Request, Coords[0], Coords[1], Coords[2]);
+					OutsideOpaque = (!Outside.IsAir() && !NonOccluding[Outside.MaterialID]) ? 1 : 0;
+				}
+				const uint64 NeighborOpaque = bPositive
+					? ((Opaque >> 1) | (OutsideOpaque << BoundaryBit))
+					: (((Opaque << 1) | OutsideOpaque) & FullRow);
+
+				uint64 Visible = Solid & ~(Opaque & NeighborOpaque);
+				while (Visible)
+				{
+					const int32 Slice = static_cast<int32>(FMath::CountTrailingZeros64(Visible));
+					Visible &= Visible - 1;
+					FaceRows[Slice * ChunkSize + V] |= 1ull << U;
+				}
+			}
+		}
+
+		// Pass 3: per slice, the same pre-pass and greedy merge as ProcessFaceDirectionGreedy (same
+		// quads, same order), walking set bits instead of testing every cell.
+		for (int32 SliceIndex = 0; SliceIndex < ChunkSize; SliceIndex++)
+		{
+			uint64* Rows = FaceRows.GetData() + SliceIndex * ChunkSize;
+			const FVoxelData* SliceVoxels = Voxels + SliceIndex * AxisStride[PrimaryAxis];
+			const int32 UStride = AxisStride[UAxis];
+			const int32 VStride = AxisStride[VAxis];
+			auto VoxelAt = [SliceVoxels, UStride, VStride](int32 U, int32 V) -> const FVoxelData&
+			{
+				return SliceVoxels[U * UStride + V * VStride];
+			};
+			auto KeyAt = [&VoxelAt](int32 U, int32 V) -> uint16
+			{
+				const FVoxelData& Voxel = VoxelAt(U, V);
+				return static_cast<uint16>((Voxel.MaterialID + 1) | (Voxel.BiomeID << 8));
+			};
+
+			// Non-occluding faces as individual 1x1 quads (per-voxel UV offsets, never merged)
+			if (bAnyNonOccluding)
+			{
+				for (int32 V = 0; V < ChunkSize; V++)
+				{
+					uint64 Bits = Rows[V];
+					while (Bits)
+					{
+						const int32 U = static_cast<int32>(FMath::CountTrailingZeros64(Bits));
+						Bits &= Bits - 1;
+						const FVoxelData& Voxel = VoxelAt(U, V);
+						if (NonOccluding[Voxel.MaterialID])
+						{
+							int32 Coords[3];
+							Coords[PrimaryAxis] = SliceIndex;
+							Coords[UAxis] = U;
+							Coords[VAxis] = V;
+							EmitQuad(OutMeshData, Request, Coords[0], Coords[1], Coords[2], Face, Voxel);
+							OutGeneratedFaces++;
+							Rows[V] &= ~(1ull << U);
+						}
+					}
+				}
+			}
+
+			// Greedy merge: lowest set bit starts a quad; width = the run of set bits with the same
+			// key; height = following rows whose bits cover the width with the same key.
+			for (int32 V = 0; V < ChunkSize; V++)
+			{
+				while (Rows[V])
+				{
+					const int32 U = static_cast<int32>(FMath::CountTrailingZeros64(Rows[V]));
+					const uint16 CurrentMaterial = KeyAt(U, V);
+
+					const int32 RunLength = static_cast<int32>(FMath::CountTrailingZeros64(~(Rows[V] >> U)));
+					int32 Width = 1;
+					while (Width < RunLength && KeyAt(U + Width, V) == CurrentMaterial)
+					{
+						Width++;
+					}
+					const uint64 WidthMask = ((Width == 64) ? ~0ull : ((1ull << Width) - 1)) << U;
+
+					int32 Height = 1;
+					while (V + Height < ChunkSize && (Rows[V + Height] & WidthMask) == WidthMask)
+					{
+						bool bSameMaterial = true;
+						for (int32 DU = 0; DU < Width && bSameMaterial; DU++)
+						{
+							bSameMaterial = KeyAt(U + DU, V + Height) == CurrentMaterial;
+						}
+						if (!bSameMaterial)
+						{
+							break;
+						}
+						Height++;
+					}
+
+					for (int32 DV = 0; DV < Height; DV++)
+					{
+						Rows[V + DV] &= ~WidthMask;
+					}
+
+					// Lower 8 bits: MaterialID + 1, Upper 8 bits: BiomeID
+					const uint8 MaterialID = static_cast<uint8>((CurrentMaterial & 0xFF) - 1);
+					const uint8 BiomeID = static_cast<uint8>((CurrentMaterial >> 8) & 0xFF);
+					EmitMergedQuad(OutMeshData, Request, Face, SliceIndex, U, V, Width, Height, MaterialID, BiomeID);
+					OutGeneratedFaces++;
+				}
+			}
+		}
+	}
+
+	return SolidVoxels;
+}
+
 void FVoxelCPUCubicMesher::BuildFaceMask(
 	int32 Face,
 	int32 SliceIndex,
@@ -3,8 +3,76 @@
 #include "VoxelCPUDualContourMesher.h"
 #include "VoxelMeshing.h"
 #include "QEFSolver.h"
+#include "VoxelMeshingScratch.h"
+#include "VoxelMeshSimplifier.h"
 #include "HAL/IConsoleManager.h"
 
+struct FVoxelCPUDualContourMesher::FDCScratch
+{
+	TVoxelSparseScratch<FDCEdgeCrossing> EdgeCrossings;
+	TVoxelSparseScratch<FDCCellVertex> CellVertices;
+	TMap<uint64, int32> DuplicateVertexCache;
+
+	// Sparse path: sampled density lattice, its packed sign mask, and the active-cell list.
+	TArray<float> Densities;
+	TArray<uint64> SignBits;
+	TArray<int32> ActiveCells;
+
+	// QEF solves queued per pass and flushed four cells per lane group.
+	FQEFBatchSolver QEFBatch;
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return EdgeCrossings.GetAllocatedSize() + CellVertices.GetAllocatedSize() + DuplicateVertexCache.GetAllocatedSize()
+			+ Densities.GetAllocatedSize() + SignBits.GetAllocatedSize() + ActiveCells.GetAllocatedSize()
+			+ QEFBatch.GetAllocatedSize();
+	}
+};
+
+static int32 GVoxelDCSparseCells = 1;
+static FAutoConsoleVariableRef CVarVoxelDCSparseCells(
+	TEXT("voxel.Meshing.DCSparseCells"),
+	GVoxelDCSparseCells,
+	TEXT("1 (default): CPU DC samples the density lattice once, packs iso-level signs into a bitmask, and ")
+	TEXT("runs edge detection / QEF solve only on the active (mixed-sign) cells; uniform chunks exit early. ")
+	TEXT("0: dense per-cell passes. Both produce bit-identical meshes."),
+	ECVF_Default);
+
+static int32 GVoxelDCBatchQEF = 1;
+static FAutoConsoleVariableRef CVarVoxelDCBatchQEF(
+	TEXT("voxel.Meshing.DCBatchQEF"),
+	GVoxelDCBatchQEF,
+	TEXT("1 (default): CPU DC queues cell QEF solves (chunk pass and same-LOD face/edge/corner seams) and ")
+	TEXT("solves them 4 lanes wide via VectorRegister4Float. 0: per-cell scalar FQEFSolver::Solve. Bit-identical."),
+	ECVF_Default);
+
+namespace VoxelDCSignMask
+{
+	FORCEINLINE int32 WordsPerRow(int32 GridDim)
+	{
+		return (GridDim + 63) >> 6;
+	}
+
+	/** Bits [Lo, HiEx) of the 64-point span starting at WordBase (clipped to the word). */
+	FORCEINLINE uint64 RangeBits(int32 WordBase, int32 Lo, int32 HiEx)
+	{
+		const int32 From = FMath::Clamp(Lo - WordBase, 0, 64);
+		const int32 To = FMath::Clamp(HiEx - WordBase, 0, 64);
+		if (From >= To)
+		{
+			return 0;
+		}
+		const uint64 Upper = (To == 64) ? ~0ull : ((1ull << To) - 1);
+		return Upper & ~((1ull << From) - 1);
+	}
+
+	/** Row word W shifted down one point (bit i = point i+1), pulling the carry from the next word. */
+	FORCEINLINE uint64 NextPointBits(const uint64* Row, int32 W, int32 NumWords)
+	{
+		return (Row[W] >> 1) | ((W + 1 < NumWords) ? (Row[W + 1] << 63) : 0);
+	}
+}
+
 FVoxelCPUDualContourMesher::FVoxelCPUDualContourMesher()
 {
 }
@@ -88,49 +156,91 @@ bool FVoxelCPUDualContourMesher::GenerateMeshCPU(
 		Request.ChunkCoord.X, Request.ChunkCoord.Y, Request.ChunkCoord.Z,
 		LODLevel, Stride, LODChunkSize);
 
-	// Pre-allocate
-	const int32 EstimatedTriangles = LODChunkSize * LODChunkSize * 2;
-	OutMeshData.Positions.Reserve(EstimatedTriangles * 3);
-	OutMeshData.Normals.Reserve(EstimatedTriangles * 3);
-	OutMeshData.UVs.Reserve(EstimatedTriangles * 3);
-	OutMeshData.UV1s.Reserve(EstimatedTriangles * 3);
-	OutMeshData.Colors.Reserve(EstimatedTriangles * 3);
-	OutMeshData.Indices.Reserve(EstimatedTriangles * 3);
-
 	uint32 TriangleCount = 0;
 	uint32 SolidVoxels = 0;
 
-	// Count solid voxels
-	for (int32 Z = 0; Z < ChunkSize; Z += Stride)
+	// Grid dimension: cells range from -1 to GridSize+1 → GridSize+3 entries per axis
+	const int32 GridSize = LODChunkSize;
+	const int32 GridDim = GridSize + 3;
+	const int32 TotalCells = GridDim * GridDim * GridDim;
+
+	const bool bSparseCells = GVoxelDCSparseCells != 0;
+
+	// A chunk whose lattice samples all share a sign has no crossings anywhere: settle that before
+	// acquiring or filling any grid.
+	if (bSparseCells && ProbeUniformSign(Request, Stride, GridDim, SolidVoxels))
+	{
+		OutStats.SolidVoxelCount = SolidVoxels;
+		OutStats.GenerationTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+		return true;
+	}
+
+	// Grids come from this thread's scratch arena: zeroed like SetNumZeroed, but only the entries
+	// the previous call wrote are cleared (the surface shell, not the ~GridDim^3 volume).
+	TVoxelScratchScope<FDCScratch> Scratch(EVoxelScratchUser::DualContour);
+
+	if (bSparseCells)
 	{
-		for (int32 Y = 0; Y < ChunkSize; Y += Stride)
+		// Pass 0: one density sample per lattice point, signs packed 64 per word.
+		const bool bHasSurface = BuildSignMask(Request, Stride, GridDim, Scratch->Densities, Scratch->SignBits);
+		SolidVoxels = CountSolidSamples(GridDim, Scratch->Densities);
+		if (!bHasSurface)
 		{
-			for (int32 X = 0; X < ChunkSize; X += Stride)
+			OutStats.SolidVoxelCount = SolidVoxels;
+			OutStats.GenerationTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+			return true;
+		}
+	}
+	else
+	{
+		// Count solid voxels
+		for (int32 Z = 0; Z < ChunkSize; Z += Stride)
+		{
+			for (int32 Y = 0; Y < ChunkSize; Y += Stride)
 			{
-				if (!Request.GetVoxel(X, Y, Z).IsAir())
+				for (int32 X = 0; X < ChunkSize; X += Stride)
 				{
-					SolidVoxels++;
+					if (!Request.GetVoxel(X, Y, Z).IsAir())
+					{
+						SolidVoxels++;
+					}
 				}
 			}
 		}
 	}
 
-	// Grid dimension: cells range from -1 to GridSize+1 → GridSize+3 entries per axis
-	const int32 GridSize = LODChunkSize;
-	const int32 GridDim = GridSize + 3;
-	const int32 TotalCells = GridDim * GridDim * GridDim;
+	// Pre-allocate
+	const int32 EstimatedTriangles = LODChunkSize * LODChunkSize * 2;
+	OutMeshData.Positions.Reserve(EstimatedTriangles * 3);
+	OutMeshData.Normals.Reserve(EstimatedTriangles * 3);
+	OutMeshData.UVs.Reserve(EstimatedTriangles * 3);
+	OutMeshData.UV1s.Reserve(EstimatedTriangles * 3);
+	OutMeshData.Colors.Reserve(EstimatedTriangles * 3);
+	OutMeshData.Indices.Reserve(EstimatedTriangles * 3);
 
-	// Pass 1: Detect edge crossings (flat array: 3 edges per cell position)
-	TArray<FDCEdgeCrossing> EdgeCrossings;
-	EdgeCrossings.SetNumZeroed(TotalCells * 3);
-	TArray<int32> ValidEdgeIndices;
+	// Pass 1: Detect edge crossings (flat array: 3 edges per cell position). The valid-edge list
+	// doubles as the grid's written-index list.
+	TArray<FDCEdgeCrossing>& EdgeCrossings = Scratch->EdgeCrossings.Acquire(TotalCells * 3);
+	TArray<int32>& ValidEdgeIndices = Scratch->EdgeCrossings.GetWrittenIndices();
 	ValidEdgeIndices.Reserve(GridSize * GridSize * 4);
-	DetectEdgeCrossings(Request, Stride, GridDim, EdgeCrossings, ValidEdgeIndices);
+	if (bSparseCells)
+	{
+		DetectEdgeCrossingsFromMask(Request, Stride, GridDim, Scratch->Densities, Scratch->SignBits, EdgeCrossings, ValidEdgeIndices);
+	}
+	else
+	{
+		DetectEdgeCrossings(Request, Stride, GridDim, EdgeCrossings, ValidEdgeIndices);
+	}
 
-	// Pass 2: Solve QEF for cell vertices
-	TArray<FDCCellVertex> CellVertices;
-	CellVertices.SetNumZeroed(TotalCells);
-	SolveCellVertices(Request, Stride, GridDim, EdgeCrossings, CellVertices);
+	// Pass 2: Solve QEF for cell vertices (sparse path: only the mixed-sign cells)
+	TArray<FDCCellVertex>& CellVertices = Scratch->CellVertices.Acquire(TotalCells);
+	const TArray<int32>* ActiveCells = nullptr;
+	if (bSparseCells)
+	{
+		CollectActiveCells(Request, Stride, GridDim, Scratch->SignBits, Scratch->ActiveCells);
+		ActiveCells = &Scratch->ActiveCells;
+	}
+	SolveCellVertices(Request, Stride, GridDim, EdgeCrossings, ActiveCells, Scratch->QEFBatch, CellVertices, Scratch->CellVertices.GetWrittenIndices());
 
 	// Seam-ownership (SEAM_OWNERSHIP_ARCHITECTURE.md §2.1): the Interior domain meshes only
 	// cells with zero neighbor dependence — boundary geometry is produced by single-owner seam
@@ -140,12 +250,22 @@ bool FVoxelCPUDualContourMesher::GenerateMeshCPU(
 	const bool bInteriorDomain = (Request.MeshCellDomain == EVoxelMeshCellDomain::Interior);
 
 	// Pass 3: Generate quads
-	GenerateQuads(Request, Stride, GridDim, EdgeCrossings, ValidEdgeIndices, CellVertices, OutMeshData, TriangleCount);
+	Scratch->DuplicateVertexCache.Reset();
+	GenerateQuads(Request, Stride, GridDim, EdgeCrossings, ValidEdgeIndices, CellVertices,
+		Scratch->DuplicateVertexCache, OutMeshData, TriangleCount);
 
 	// Generate skirts at LOD transition boundaries (when Transvoxel is disabled)
 	if (!bInteriorDomain && Config.bGenerateSkirts && Request.TransitionFaces != 0)
 	{
+		const int32 SkirtIndexStart = OutMeshData.Indices.Num();
 		GenerateSkirts(Request, Stride, OutMeshData, TriangleCount);
+		OutMeshData.SkirtIndexStart = OutMeshData.Indices.Num() > SkirtIndexStart ? SkirtIndexStart : INDEX_NONE;
+	}
+
+	// Far-LOD decimation (per LOD band), after skirts so their open strips stay pinned
+	if (FVoxelMeshSimplifier::SimplifyForRequest(Request, OutMeshData))
+	{
+		TriangleCount = OutMeshData.GetTriangleCount();
 	}
 
 	// Calculate stats
@@ -162,6 +282,7 @@ bool FVoxelCPUDualContourMesher::GenerateMeshCPU(
 		OutStats.VertexCount, TriangleCount, ValidEdgeIndices.Num(),
 		OutStats.GenerationTimeMs);
 
+	Config.PackOutputVertices(Request, OutMeshData);
 	return true;
 }
 
@@ -237,6 +358,304 @@ void FVoxelCPUDualContourMesher::DetectEdgeCrossings(
 	}
 }
 
+// ============================================================================
+// Sparse Path: Sign Mask, Mask-Driven Edge Crossings, Active Cells
+// ============================================================================
+
+bool FVoxelCPUDualContourMesher::ProbeUniformSign(
+	const FVoxelMeshingRequest& Request,
+	int32 Stride,
+	int32 GridDim,
+	uint32& OutSolidSamples) const
+{
+	const float IsoLevel = Config.IsoLevel;
+	const int32 GridSize = GridDim - 3;
+	auto SampleAt = [this, &Request, Stride](int32 PX, int32 PY, int32 PZ)
+	{
+		return GetDensityAt(Request, (PX - 1) * Stride, (PY - 1) * Stride, (PZ - 1) * Stride);
+	};
+	auto IsInChunk = [GridSize](int32 P) { return P >= 1 && P <= GridSize; };
+
+	const bool bSolid = SampleAt(0, 0, 0) >= IsoLevel;
+
+	// Apron shell: every lattice point with a coordinate outside the chunk (P = 0, GridSize+1..+2)
+	for (int32 PZ = 0; PZ < GridDim; PZ++)
+	{
+		for (int32 PY = 0; PY < GridDim; PY++)
+		{
+			const bool bInChunkRow = IsInChunk(PY) && IsInChunk(PZ);
+			for (int32 PX = 0; PX < GridDim; PX++)
+			{
+				if (bInChunkRow && PX == 1)
+				{
+					PX = GridSize + 1;
+				}
+				if ((SampleAt(PX, PY, PZ) >= IsoLevel) != bSolid)
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	// Same test as CountSolidSamples (FVoxelData::IsAir semantics)
+	const float SolidDensity = static_cast<float>(VOXEL_SURFACE_THRESHOLD) / 255.0f;
+	if (Request.bUniformVoxelData)
+	{
+		const float Density = SampleAt(1, 1, 1);
+		if ((Density >= IsoLevel) != bSolid)
+		{
+			return false;
+		}
+		OutSolidSamples = (Density >= SolidDensity) ? static_cast<uint32>(GridSize * GridSize * GridSize) : 0;
+		return true;
+	}
+
+	uint32 Solid = 0;
+	for (int32 PZ = 1; PZ <= GridSize; PZ++)
+	{
+		for (int32 PY = 1; PY <= GridSize; PY++)
+		{
+			for (int32 PX = 1; PX <= GridSize; PX++)
+			{
+				const float Density = SampleAt(PX, PY, PZ);
+				if ((Density >= IsoLevel) != bSolid)
+				{
+					return false;
+				}
+				Solid += (Density >= SolidDensity) ? 1 : 0;
+			}
+		}
+	}
+	OutSolidSamples = Solid;
+	return true;
+}
+
+bool FVoxelCPUDualContourMesher::BuildSignMask(
+	const FVoxelMeshingRequest& Request,
+	int32 Stride,
+	int32 GridDim,
+	TArray<float>& OutDensities,
+	TArray<uint64>& OutSignBits) const
+{
+	const int32 NumWords = VoxelDCSignMask::WordsPerRow(GridDim);
+	OutDensities.SetNumUninitialized(GridDim * GridDim * GridDim, EAllowShrinking::No);
+	OutSignBits.SetNumUninitialized(GridDim * GridDim * NumWords, EAllowShrinking::No);
+
+	// Lattice point P samples voxel (P - 1) * Stride, covering cells -1..GridSize+1 exactly as
+	// DetectEdgeCrossings' D0 / D1 reads do.
+	float* Density = OutDensities.GetData();
+	for (int32 PZ = 0; PZ < GridDim; PZ++)
+	{
+		for (int32 PY = 0; PY < GridDim; PY++)
+		{
+			for (int32 PX = 0; PX < GridDim; PX++)
+			{
+				*Density++ = GetDensityAt(Request, (PX - 1) * Stride, (PY - 1) * Stride, (PZ - 1) * Stride);
+			}
+		}
+	}
+
+	// Signs (1 = D >= IsoLevel), four lanes per compare. Lane groups start at multiples of 4 and
+	// so never straddle a 64-bit word.
+	const VectorRegister4Float VIso = VectorSetFloat1(Config.IsoLevel);
+	const float IsoLevel = Config.IsoLevel;
+	int64 SolidCount = 0;
+	for (int32 Row = 0; Row < GridDim * GridDim; Row++)
+	{
+		const float* RowDensity = OutDensities.GetData() + Row * GridDim;
+		uint64* RowBits = OutSignBits.GetData() + Row * NumWords;
+		FMemory::Memzero(RowBits, NumWords * sizeof(uint64));
+
+		int32 PX = 0;
+		for (; PX + 4 <= GridDim; PX += 4)
+		{
+			const uint32 Lanes = static_cast<uint32>(VectorMaskBits(VectorCompareGE(VectorLoad(RowDensity + PX), VIso)));
+			RowBits[PX >> 6] |= static_cast<uint64>(Lanes) << (PX & 63);
+		}
+		for (; PX < GridDim; PX++)
+		{
+			if (RowDensity[PX] >= IsoLevel)
+			{
+				RowBits[PX >> 6] |= 1ull << (PX & 63);
+			}
+		}
+		for (int32 W = 0; W < NumWords; W++)
+		{
+			SolidCount += FMath::CountBits(RowBits[W]);
+		}
+	}
+
+	return SolidCount != 0 && SolidCount != static_cast<int64>(GridDim) * GridDim * GridDim;
+}
+
+uint32 FVoxelCPUDualContourMesher::CountSolidSamples(int32 GridDim, const TArray<float>& Densities)
+{
+	// Same test as FVoxelData::IsAir on the in-chunk lattice points (P = 1..GridSize). Byte
+	// densities map to distinct floats, so comparing D/255 against threshold/255 is exact.
+	const float SolidDensity = static_cast<float>(VOXEL_SURFACE_THRESHOLD) / 255.0f;
+	const int32 GridSize = GridDim - 3;
+	uint32 Count = 0;
+	for (int32 PZ = 1; PZ <= GridSize; PZ++)
+	{
+		for (int32 PY = 1; PY <= GridSize; PY++)
+		{
+			const float* Row = Densities.GetData() + (PY + PZ * GridDim) * GridDim;
+			for (int32 PX = 1; PX <= GridSize; PX++)
+			{
+				Count += (Row[PX] >= SolidDensity) ? 1 : 0;
+			}
+		}
+	}
+	return Count;
+}
+
+void FVoxelCPUDualContourMesher::DetectEdgeCrossingsFromMask(
+	const FVoxelMeshingRequest& Request,
+	int32 Stride,
+	int32 GridDim,
+	const TArray<float>& Densities,
+	const TArray<uint64>& SignBits,
+	TArray<FDCEdgeCrossing>& OutEdgeCrossings,
+	TArray<int32>& OutValidEdgeIndices)
+{
+	const float VoxelSize = Request.VoxelSize;
+	const float IsoLevel = Config.IsoLevel;
+	const int32 NumWords = VoxelDCSignMask::WordsPerRow(GridDim);
+	const int32 PointStep[3] = { 1, GridDim, GridDim * GridDim };
+
+	// Edges start at lattice points 0..GridDim-2 on every axis (cells -1..GridSize).
+	for (int32 PZ = 0; PZ < GridDim - 1; PZ++)
+	{
+		for (int32 PY = 0; PY < GridDim - 1; PY++)
+		{
+			const uint64* Row = SignBits.GetData() + (PY + PZ * GridDim) * NumWords;
+			const uint64* RowY = Row + GridDim * NumWords;
+			const uint64* RowZ = Row + GridDim * GridDim * NumWords;
+
+			for (int32 W = 0; W < NumWords; W++)
+			{
+				const uint64 InRange = VoxelDCSignMask::RangeBits(W << 6, 0, GridDim - 1);
+				const uint64 AxisBits[3] = {
+					(Row[W] ^ VoxelDCSignMask::NextPointBits(Row, W, NumWords)) & InRange,
+					(Row[W] ^ RowY[W]) & InRange,
+					(Row[W] ^ RowZ[W]) & InRange,
+				};
+
+				// Ascending point, then axis — the dense pass's (CZ, CY, CX, Axis) order, so the
+				// valid-edge list and everything emitted from it are unchanged.
+				uint64 AnyBits = AxisBits[0] | AxisBits[1] | AxisBits[2];
+				while (AnyBits != 0)
+				{
+					const int32 Bit = static_cast<int32>(FMath::CountTrailingZeros64(AnyBits));
+					AnyBits &= AnyBits - 1;
+
+					const int32 PX = (W << 6) + Bit;
+					const int32 Point = PX + PY * GridDim + PZ * GridDim * GridDim;
+					const int32 VX = (PX - 1) * Stride;
+					const int32 VY = (PY - 1) * Stride;
+					const int32 VZ = (PZ - 1) * Stride;
+					const float D0 = Densities[Point];
+
+					for (int32 Axis = 0; Axis < 3; Axis++)
+					{
+						if ((AxisBits[Axis] & (1ull << Bit)) == 0)
+						{
+							continue;
+						}
+
+						int32 NX = VX, NY = VY, NZ = VZ;
+						if (Axis == 0) NX += Stride;
+						else if (Axis == 1) NY += Stride;
+						else NZ += Stride;
+
+						const float D1 = Densities[Point + PointStep[Axis]];
+
+						float t = (IsoLevel - D0) / (D1 - D0);
+						t = FMath::Clamp(t, 0.0f, 1.0f);
+
+						const FVector3f P0(static_cast<float>(VX) * VoxelSize,
+							static_cast<float>(VY) * VoxelSize,
+							static_cast<float>(VZ) * VoxelSize);
+						const FVector3f P1(static_cast<float>(NX) * VoxelSize,
+							static_cast<float>(NY) * VoxelSize,
+							static_cast<float>(NZ) * VoxelSize);
+
+						const int32 EIdx = Point * 3 + Axis;
+						FDCEdgeCrossing& Crossing = OutEdgeCrossings[EIdx];
+						Crossing.Position = P0 + (P1 - P0) * t;
+						Crossing.bValid = true;
+
+						const float CrossVoxelX = Crossing.Position.X / VoxelSize;
+						const float CrossVoxelY = Crossing.Position.Y / VoxelSize;
+						const float CrossVoxelZ = Crossing.Position.Z / VoxelSize;
+						Crossing.Normal = (Stride > 1)
+							? CalculateGradientNormalLOD(Request, CrossVoxelX, CrossVoxelY, CrossVoxelZ, Stride)
+							: CalculateGradientNormal(Request, CrossVoxelX, CrossVoxelY, CrossVoxelZ);
+
+						OutValidEdgeIndices.Add(EIdx);
+					}
+				}
+			}
+		}
+	}
+}
+
+void FVoxelCPUDualContourMesher::CollectActiveCells(
+	const FVoxelMeshingRequest& Request,
+	int32 Stride,
+	int32 GridDim,
+	const TArray<uint64>& SignBits,
+	TArray<int32>& OutActiveCells) const
+{
+	OutActiveCells.Reset();
+
+	// Same cell domain as SolveCellVertices' dense loop.
+	const int32 GridSize = Request.ChunkSize / Stride;
+	const bool bInteriorDomain = (Request.MeshCellDomain == EVoxelMeshCellDomain::Interior);
+	const int32 CellMin = bInteriorDomain ? 0 : -1;
+	const int32 CellMaxEx = bInteriorDomain ? (GridSize - 1) : GridSize;
+	const int32 NumWords = VoxelDCSignMask::WordsPerRow(GridDim);
+	const int32 SliceWords = GridDim * NumWords;
+
+	// A cell has a crossing on one of its 12 edges iff its 8 corners are not all one sign.
+	for (int32 CZ = CellMin; CZ < CellMaxEx; CZ++)
+	{
+		for (int32 CY = CellMin; CY < CellMaxEx; CY++)
+		{
+			const uint64* R00 = SignBits.GetData() + ((CY + 1) + (CZ + 1) * GridDim) * NumWords;
+			const uint64* R10 = R00 + NumWords;
+			const uint64* R01 = R00 + SliceWords;
+			const uint64* R11 = R01 + NumWords;
+
+			for (int32 W = 0; W < NumWords; W++)
+			{
+				const uint64 InRange = VoxelDCSignMask::RangeBits(W << 6, CellMin + 1, CellMaxEx + 1);
+				if (InRange == 0)
+				{
+					continue;
+				}
+
+				auto AllSolid = [&](int32 I) { return R00[I] & R10[I] & R01[I] & R11[I]; };
+				auto AnySolid = [&](int32 I) { return R00[I] | R10[I] | R01[I] | R11[I]; };
+				const bool bHasNext = W + 1 < NumWords;
+				const uint64 All = AllSolid(W);
+				const uint64 Any = AnySolid(W);
+				const uint64 AllNext = (All >> 1) | (bHasNext ? (AllSolid(W + 1) << 63) : 0);
+				const uint64 AnyNext = (Any >> 1) | (bHasNext ? (AnySolid(W + 1) << 63) : 0);
+
+				uint64 Active = (Any | AnyNext) & ~(All & AllNext) & InRange;
+				while (Active != 0)
+				{
+					const int32 PX = (W << 6) + static_cast<int32>(FMath::CountTrailingZeros64(Active));
+					Active &= Active - 1;
+					OutActiveCells.Add(CellIndex(PX - 1, CY, CZ, GridDim));
+				}
+			}
+		}
+	}
+}
+
 // ============================================================================
 // Pass 2: QEF Vertex Solve
 // ============================================================================
@@ -246,7 +665,10 @@ void FVoxelCPUDualContourMesher::SolveCellVertices(
 	int32 Stride,
 	int32 GridDim,
 	const TArray<FDCEdgeCrossing>& EdgeCrossings,
-	TArray<FDCCellVertex>& OutCellVertices)
+	const TArray<int32>* ActiveCells,
+	FQEFBatchSolver& QEFBatch,
+	TArray<FDCCellVertex>& OutCellVertices,
+	TArray<int32>& OutSolvedCells)
 {
 	const int32 ChunkSize = Request.ChunkSize;
 	const int32 GridSize = ChunkSize / Stride;
@@ -281,55 +703,80 @@ void FVoxelCPUDualContourMesher::SolveCellVertices(
 	const bool bInteriorDomain = (Request.MeshCellDomain == EVoxelMeshCellDomain::Interior);
 	const int32 CellMin = bInteriorDomain ? 0 : -1;
 	const int32 CellMaxEx = bInteriorDomain ? (GridSize - 1) : GridSize;
-	for (int32 CZ = CellMin; CZ < CellMaxEx; CZ++)
+
+	// Positions land when the batch is flushed at the end of the pass (OutCellVertices is sized
+	// up front, so the queued pointers stay valid).
+	QEFBatch.Begin(SVDThreshold, BiasStrength, GVoxelDCBatchQEF != 0);
+
+	auto SolveCell = [&](int32 CX, int32 CY, int32 CZ)
 	{
-		for (int32 CY = CellMin; CY < CellMaxEx; CY++)
+		FQEFSolver QEF;
+		FVector3f AvgNormal = FVector3f::ZeroVector;
+
+		for (const auto& Edge : CellEdges)
 		{
-			for (int32 CX = CellMin; CX < CellMaxEx; CX++)
+			const int32 EIdx = EdgeIndex(CX + Edge.DX, CY + Edge.DY, CZ + Edge.DZ, Edge.Axis, GridDim);
+			const FDCEdgeCrossing& Crossing = EdgeCrossings[EIdx];
+			if (Crossing.bValid)
 			{
-				FQEFSolver QEF;
-				FVector3f AvgNormal = FVector3f::ZeroVector;
+				QEF.Add(Crossing.Position, Crossing.Normal);
+				AvgNormal += Crossing.Normal;
+			}
+		}
 
-				for (const auto& Edge : CellEdges)
-				{
-					const int32 EIdx = EdgeIndex(CX + Edge.DX, CY + Edge.DY, CZ + Edge.DZ, Edge.Axis, GridDim);
-					const FDCEdgeCrossing& Crossing = EdgeCrossings[EIdx];
-					if (Crossing.bValid)
-					{
-						QEF.Add(Crossing.Position, Crossing.Normal);
-						AvgNormal += Crossing.Normal;
-					}
-				}
+		if (QEF.Count == 0)
+		{
+			return;
+		}
 
-				if (QEF.Count == 0)
-				{
-					continue;
-				}
+		const float MinX = static_cast<float>(CX * Stride) * VoxelSize;
+		const float MinY = static_cast<float>(CY * Stride) * VoxelSize;
+		const float MinZ = static_cast<float>(CZ * Stride) * VoxelSize;
+		const FBox3f CellBounds(
+			FVector3f(MinX, MinY, MinZ),
+			FVector3f(MinX + CellWorldSize, MinY + CellWorldSize, MinZ + CellWorldSize)
+		);
 
-				const float MinX = static_cast<float>(CX * Stride) * VoxelSize;
-				const float MinY = static_cast<float>(CY * Stride) * VoxelSize;
-				const float MinZ = static_cast<float>(CZ * Stride) * VoxelSize;
-				const FBox3f CellBounds(
-					FVector3f(MinX, MinY, MinZ),
-					FVector3f(MinX + CellWorldSize, MinY + CellWorldSize, MinZ + CellWorldSize)
-				);
-
-				const int32 CIdx = CellIndex(CX, CY, CZ, GridDim);
-				FDCCellVertex& Vertex = OutCellVertices[CIdx];
-				Vertex.bValid = true;
-				Vertex.MeshVertexIndex = -1;  // SetNumZeroed zeroes this to 0; EmitVertex needs -1 to know it's unemitted
-				Vertex.Position = QEF.Solve(SVDThreshold, CellBounds, BiasStrength);
-
-				if (!AvgNormal.Normalize())
+		const int32 CIdx = CellIndex(CX, CY, CZ, GridDim);
+		FDCCellVertex& Vertex = OutCellVertices[CIdx];
+		OutSolvedCells.Add(CIdx);
+		Vertex.bValid = true;
+		Vertex.MeshVertexIndex = -1;  // SetNumZeroed zeroes this to 0; EmitVertex needs -1 to know it's unemitted
+		QEFBatch.Add(QEF, CellBounds, &Vertex.Position);
+
+		if (!AvgNormal.Normalize())
+		{
+			AvgNormal = FVector3f(0.0f, 0.0f, 1.0f);
+		}
+		Vertex.Normal = AvgNormal;
+		// Material/biome are assigned per-quad in GenerateQuads (from the owned
+		// edge's solid endpoint) so triangles stay material-uniform.
+	};
+
+	// Sparse path: the caller already narrowed the domain to the mixed-sign cells, in grid order.
+	if (ActiveCells)
+	{
+		const int32 SliceCells = GridDim * GridDim;
+		for (const int32 CIdx : *ActiveCells)
+		{
+			SolveCell(CIdx % GridDim - 1, (CIdx / GridDim) % GridDim - 1, CIdx / SliceCells - 1);
+		}
+	}
+	else
+	{
+		for (int32 CZ = CellMin; CZ < CellMaxEx; CZ++)
+		{
+			for (int32 CY = CellMin; CY < CellMaxEx; CY++)
+			{
+				for (int32 CX = CellMin; CX < CellMaxEx; CX++)
 				{
-					AvgNormal = FVector3f(0.0f, 0.0f, 1.0f);
+					SolveCell(CX, CY, CZ);
 				}
-				Vertex.Normal = AvgNormal;
-				// Material/biome are assigned per-quad in GenerateQuads (from the owned
-				// edge's solid endpoint) so triangles stay material-uniform.
 			}
 		}
 	}
+
+	QEFBatch.Flush();
 }
 
 // ============================================================================
@@ -343,6 +790,7 @@ void FVoxelCPUDualContourMesher::GenerateQuads(
 	const TArray<FDCEdgeCrossing>& EdgeCrossings,
 	const TArray<int32>& ValidEdgeIndices,
 	TArray<FDCCellVertex>& CellVertices,
+	TMap<uint64, int32>& DuplicateVertexCache,
 	FChunkMeshData& OutMeshData,
 	uint32& OutTriangleCount)
 {
@@ -361,10 +809,9 @@ void FVoxelCPUDualContourMesher::GenerateQuads(
 		{{0, 0, 0}, {-1, 0, 0}, {-1, -1, 0}, {0, -1, 0}},
 	};
 
-	// Duplicate-emission cache for cell vertices shared by quads of different
+	// Duplicate-emission cache (caller-reset) for cell vertices shared by quads of different
 	// materials: key = (cell index << 16) | (material << 8) | biome.
 	// Only material-border cells ever land here, so the map stays small.
-	TMap<uint64, int32> DuplicateVertexCache;
 
 	// Interior domain (seam-ownership P1): quads may only reference interior cells
 	// ([0, GridSize-1) per axis). Any quad touching a -1/GridSize-1 boundary-layer cell
@@ -600,6 +1047,12 @@ FVoxelData FVoxelCPUDualContourMesher::GetVoxelAt(
 	const FVoxelMeshingRequest& Request,
 	int32 X, int32 Y, int32 Z) const
 {
+	// Padded apron layout: one dense volume with the absent-neighbor fallback baked in.
+	if (Request.HasPaddedVolume())
+	{
+		return Request.GetPaddedVoxel(X, Y, Z);
+	}
+
 	const int32 ChunkSize = Request.ChunkSize;
 
 	// Check if within chunk bounds
@@ -1153,13 +1606,17 @@ namespace VoxelDCFaceSeam
 	 * results bit-identical to the corresponding Interior-domain pass (or, via FQuadSampler's
 	 * restricted masks, to the corresponding face-seam job). Templated so every sampler type
 	 * shares the single op sequence — the bit-exactness contract lives in ONE place.
+	 *
+	 * With a Batch the solve is queued instead (Out.Position is written by Batch->Flush, which
+	 * is bit-identical to the inline Solve); everything else is filled in immediately.
 	 */
 	template <typename TSampler>
 	static bool ComputeCellVertex(
 		const TSampler& S,
 		int32 CX, int32 CY, int32 CZ,
 		int32 Stride, float VoxelSize, float IsoLevel, float SVDThreshold, float BiasStrength,
-		FSeamCellVertex& Out)
+		FSeamCellVertex& Out,
+		FQEFBatchSolver* Batch = nullptr)
 	{
 		FQEFSolver QEF;
 		FVector3f AvgNormal = FVector3f::ZeroVector;
@@ -1221,7 +1678,14 @@ namespace VoxelDCFaceSeam
 
 		Out.bValid = true;
 		Out.MeshVertexIndex = -1;
-		Out.Position = QEF.Solve(SVDThreshold, CellBounds, BiasStrength);
+		if (Batch)
+		{
+			Batch->Add(QEF, CellBounds, &Out.Position);
+		}
+		else
+		{
+			Out.Position = QEF.Solve(SVDThreshold, CellBounds, BiasStrength);
+		}
 
 		if (!AvgNormal.Normalize())
 		{
@@ -2354,6 +2818,10 @@ bool FVoxelCPUDualContourMesher::GenerateFaceSeamMeshCPU(
 		Layers[L].SetNum(TCount * TCount);
 	}
 
+	TVoxelScratchScope<FDCScratch> Scratch(EVoxelScratchUser::DualContour);
+	FQEFBatchSolver& QEFBatch = Scratch->QEFBatch;
+	QEFBatch.Begin(SVDThreshold, BiasStrength, GVoxelDCBatchQEF != 0);
+
 	for (int32 w = 0; w < TCount; ++w)
 	{
 		for (int32 v = 0; v < TCount; ++v)
@@ -2366,19 +2834,25 @@ bool FVoxelCPUDualContourMesher::GenerateFaceSeamMeshCPU(
 
 			// Ring A: recompute exactly as A's Interior pass did (A data, Air clamp, A frame).
 			C[U] = SL - 1;
-			ComputeCellVertex(SamplerA, C[0], C[1], C[2], Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength, Layers[0][Idx]);
+			ComputeCellVertex(SamplerA, C[0], C[1], C[2], Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength, Layers[0][Idx], &QEFBatch);
 
 			// Slab: both sides' data, full hermite reach across the face (the seam's whole point).
 			C[U] = SL;
-			ComputeCellVertex(SamplerC, C[0], C[1], C[2], Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength, Layers[1][Idx]);
+			ComputeCellVertex(SamplerC, C[0], C[1], C[2], Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength, Layers[1][Idx], &QEFBatch);
 
 			// Ring B: recompute exactly as B's Interior pass did — in B's OWN frame (bit-identical
-			// solve), then translate the result into the owner frame by one chunk along the axis.
+			// solve); translated into the owner frame below, once the batch has been solved.
 			C[U] = 0;
-			if (ComputeCellVertex(SamplerB, C[0], C[1], C[2], Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength, Layers[2][Idx]))
-			{
-				Layers[2][Idx].Position[U] += FrameOffsetU;
-			}
+			ComputeCellVertex(SamplerB, C[0], C[1], C[2], Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength, Layers[2][Idx], &QEFBatch);
+		}
+	}
+
+	QEFBatch.Flush();
+	for (FSeamCellVertex& Cell : Layers[2])
+	{
+		if (Cell.bValid)
+		{
+			Cell.Position[U] += FrameOffsetU;
 		}
 	}
 
@@ -2418,7 +2892,8 @@ bool FVoxelCPUDualContourMesher::GenerateFaceSeamMeshCPU(
 		return (CU == SL - 1) ? 0 : (CU == SL) ? 1 : (CU == SL + 1) ? 2 : -1;
 	};
 
-	TMap<uint64, int32> DuplicateVertexCache;
+	TMap<uint64, int32>& DuplicateVertexCache = Scratch->DuplicateVertexCache;
+	DuplicateVertexCache.Reset();
 	uint32 TriangleCount = 0;
 
 	// Emit the quad dual to one owned crossing edge. Mirrors GenerateQuads' flow: winding from
@@ -2679,6 +3154,10 @@ bool FVoxelCPUDualContourMesher::GenerateEdgeSeamMeshCPU(
 
 	auto ColumnIndex = [](int32 Dcv, int32 Dcw) { return (Dcv + 1) + (Dcw + 1) * 3; };
 
+	TVoxelScratchScope<FDCScratch> Scratch(EVoxelScratchUser::DualContour);
+	FQEFBatchSolver& QEFBatch = Scratch->QEFBatch;
+	QEFBatch.Begin(SVDThreshold, BiasStrength, GVoxelDCBatchQEF != 0);
+
 	for (int32 Dcw = -1; Dcw <= 1; ++Dcw)
 	{
 		for (int32 Dcv = -1; Dcv <= 1; ++Dcv)
@@ -2718,12 +3197,22 @@ bool FVoxelCPUDualContourMesher::GenerateEdgeSeamMeshCPU(
 				C[U] = u;
 				C[PerpA] = Col.FrameCellA;
 				C[PerpB] = Col.FrameCellB;
-				FSeamCellVertex& Cell = Layers[ColumnIndex(Dcv, Dcw)][u];
-				if (ComputeCellVertex(Sampler, C[0], C[1], C[2], Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength, Cell))
-				{
-					Cell.Position[PerpA] += Col.TranslateA;
-					Cell.Position[PerpB] += Col.TranslateB;
-				}
+				ComputeCellVertex(Sampler, C[0], C[1], C[2], Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength,
+					Layers[ColumnIndex(Dcv, Dcw)][u], &QEFBatch);
+			}
+		}
+	}
+
+	// Solve, then move each column's cells from its computation frame into the owner frame.
+	QEFBatch.Flush();
+	for (int32 ColumnIdx = 0; ColumnIdx < 9; ++ColumnIdx)
+	{
+		for (FSeamCellVertex& Cell : Layers[ColumnIdx])
+		{
+			if (Cell.bValid)
+			{
+				Cell.Position[PerpA] += Columns[ColumnIdx].TranslateA;
+				Cell.Position[PerpB] += Columns[ColumnIdx].TranslateB;
 			}
 		}
 	}
@@ -2761,7 +3250,8 @@ bool FVoxelCPUDualContourMesher::GenerateEdgeSeamMeshCPU(
 	// Full-quad owner-frame sampler: crossing existence, winding, and material for owned edges.
 	const FQuadSampler FullSampler{ SeamRequest, U, PerpA, PerpB, 0b1111, FIntVector::ZeroValue };
 
-	TMap<uint64, int32> DuplicateVertexCache;
+	TMap<uint64, int32>& DuplicateVertexCache = Scratch->DuplicateVertexCache;
+	DuplicateVertexCache.Reset();
 	uint32 TriangleCount = 0;
 
 	auto EmitQuadForEdge = [&](const int32 EdgeCell[3], int32 EdgeAxis) -> void
@@ -2990,6 +3480,10 @@ bool FVoxelCPUDualContourMesher::GenerateCornerSeamMeshCPU(
 	FSeamCellVertex Cells[27];
 	auto CellIndexOf = [](int32 SX, int32 SY, int32 SZ) { return (SX + 1) + (SY + 1) * 3 + (SZ + 1) * 9; };
 
+	TVoxelScratchScope<FDCScratch> Scratch(EVoxelScratchUser::DualContour);
+	FQEFBatchSolver& QEFBatch = Scratch->QEFBatch;
+	QEFBatch.Begin(SVDThreshold, BiasStrength, GVoxelDCBatchQEF != 0);
+
 	for (int32 SZ = -1; SZ <= 1; ++SZ)
 	{
 		for (int32 SY = -1; SY <= 1; ++SY)
@@ -3025,8 +3519,22 @@ bool FVoxelCPUDualContourMesher::GenerateCornerSeamMeshCPU(
 				const int32 CellZ = (SZ == 1) ? 0 : (SL + SZ);
 
 				const FOctSampler Sampler{ SeamRequest, Mask, FrameOffset };
+				ComputeCellVertex(Sampler, CellX, CellY, CellZ, Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength,
+					Cells[CellIndexOf(SX, SY, SZ)], &QEFBatch);
+			}
+		}
+	}
+
+	// Solve, then move far-frame cells into the owner frame.
+	QEFBatch.Flush();
+	for (int32 SZ = -1; SZ <= 1; ++SZ)
+	{
+		for (int32 SY = -1; SY <= 1; ++SY)
+		{
+			for (int32 SX = -1; SX <= 1; ++SX)
+			{
 				FSeamCellVertex& Cell = Cells[CellIndexOf(SX, SY, SZ)];
-				if (ComputeCellVertex(Sampler, CellX, CellY, CellZ, Stride, VoxelSize, IsoLevel, SVDThreshold, BiasStrength, Cell))
+				if (Cell.bValid)
 				{
 					Cell.Position.X += (SX == 1) ? ChunkWorldSpan : 0.0f;
 					Cell.Position.Y += (SY == 1) ? ChunkWorldSpan : 0.0f;
@@ -3068,7 +3576,8 @@ bool FVoxelCPUDualContourMesher::GenerateCornerSeamMeshCPU(
 
 	const FOctSampler FullSampler{ SeamRequest, 0xFF, FIntVector::ZeroValue };
 
-	TMap<uint64, int32> DuplicateVertexCache;
+	TMap<uint64, int32>& DuplicateVertexCache = Scratch->DuplicateVertexCache;
+	DuplicateVertexCache.Reset();
 	uint32 TriangleCount = 0;
 
 	auto EmitQuadForEdge = [&](const int32 EdgeCell[3], int32 EdgeAxis) -> void
@@ -4,6 +4,8 @@
 #include "VoxelMeshing.h"
 #include "MarchingCubesTables.h"
 #include "TransvoxelTables.h"
+#include "VoxelMeshingScratch.h"
+#include "VoxelMeshSimplifier.h"
 #include "HAL/IConsoleManager.h"
 
 // Note: MarchingCubes meshing uses triplanar blending, so FaceType is not needed.
@@ -27,6 +29,74 @@ TAutoConsoleVariable<float> CVarMCBoundaryMorphWidth(
 	TEXT("MC LOD-seam geomorph ramp width, in coarse cells. Larger = gentler ramp, more fine detail traded."),
 	ECVF_Default);
 
+static int32 GVoxelMeshingMCVertexCache = 1;
+static FAutoConsoleVariableRef CVarVoxelMeshingMCVertexCache(
+	TEXT("voxel.Meshing.MCVertexCache"),
+	GVoxelMeshingMCVertexCache,
+	TEXT("1 (default): CPU MC emits each edge-crossing vertex once and indexes it from every cell sharing the edge. ")
+	TEXT("0: three fresh vertices per triangle (legacy layout). Same triangles either way."),
+	ECVF_Default);
+
+/**
+ * Shared-edge vertex cache for one MeshCellBox sweep (Transvoxel-style). A crossing vertex is
+ * keyed by the lattice corner at the low end of its edge and the edge axis; only two Z slices of
+ * lattice corners are ever live (the cell layer's bottom and top), so the storage is two
+ * (DimX x DimY x 3) planes reused as the sweep climbs. Also holds the ribbon-vertex map for
+ * MeshTransitionRibbon, keyed by the edge's two sample coordinates.
+ */
+struct FVoxelCPUMarchingCubesMesher::FMCScratch
+{
+	TArray<int32> EdgeSlices;
+	TMap<uint64, int32> RibbonVertices;
+
+	FIntVector Origin = FIntVector::ZeroValue;
+	int32 Stride = 1;
+	int32 DimX = 0;
+	int32 DimY = 0;
+
+	/** Size the slices for cells [CellMin, CellMaxEx) at Stride. */
+	void BeginSweep(const FIntVector& CellMin, const FIntVector& CellMaxEx, int32 InStride)
+	{
+		Origin = CellMin;
+		Stride = InStride;
+		DimX = (CellMaxEx.X - CellMin.X + InStride - 1) / InStride + 1;
+		DimY = (CellMaxEx.Y - CellMin.Y + InStride - 1) / InStride + 1;
+		EdgeSlices.SetNumUninitialized(2 * DimX * DimY * 3, EAllowShrinking::No);
+	}
+
+	/** Enter the cell layer at voxel Z: its top corner slice takes over the slice two layers below. */
+	void BeginLayer(int32 Z)
+	{
+		const int32 LZ = (Z - Origin.Z) / Stride;
+		const int32 SliceSize = DimX * DimY * 3;
+		if (LZ == 0)
+		{
+			FMemory::Memset(EdgeSlices.GetData(), 0xFF, 2 * SliceSize * sizeof(int32));
+		}
+		else
+		{
+			FMemory::Memset(EdgeSlices.GetData() + ((LZ + 1) & 1) * SliceSize, 0xFF, SliceSize * sizeof(int32));
+		}
+	}
+
+	/**
+	 * Vertex slot (INDEX_NONE until filled) of the edge leaving Lengyel corner Corner of the cell
+	 * at voxel (X, Y, Z) along AxisBit (1 = X, 2 = Y, 4 = Z).
+	 */
+	FORCEINLINE int32& EdgeSlot(int32 X, int32 Y, int32 Z, int32 Corner, int32 AxisBit)
+	{
+		const int32 LX = (X - Origin.X) / Stride + (Corner & 1);
+		const int32 LY = (Y - Origin.Y) / Stride + ((Corner >> 1) & 1);
+		const int32 LZ = (Z - Origin.Z) / Stride + ((Corner >> 2) & 1);
+		return EdgeSlices[((LZ & 1) * DimX * DimY + LX + LY * DimX) * 3 + (AxisBit >> 1)];
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return EdgeSlices.GetAllocatedSize() + RibbonVertices.GetAllocatedSize();
+	}
+};
+
 FVoxelCPUMarchingCubesMesher::FVoxelCPUMarchingCubesMesher()
 {
 }
@@ -216,29 +286,13 @@ bool FVoxelCPUMarchingCubesMesher::GenerateMeshCPU(
 			if (!(TransitionMask & (1 << Face)))
 				continue;
 
-			const int32 DepthAxis = Face / 2;
 			const int32 BoundaryPos = (Face % 2 == 0) ? 0 : (ChunkSize - Stride);
 
 			const int32 NeighborLOD = Request.NeighborLODLevels[Face];
 			const int32 CoarserStride = (NeighborLOD > Request.LODLevel)
 				? (1 << NeighborLOD) : Stride;
 
-			for (int32 FP2 = 0; FP2 < ChunkSize; FP2 += CoarserStride)
-			{
-				for (int32 FP1 = 0; FP1 < ChunkSize; FP1 += CoarserStride)
-				{
-					int32 CellX, CellY, CellZ;
-					switch (DepthAxis)
-					{
-					case 0: CellX = BoundaryPos; CellY = FP1; CellZ = FP2; break;
-					case 1: CellX = FP1; CellY = BoundaryPos; CellZ = FP2; break;
-					default: CellX = FP1; CellY = FP2; CellZ = BoundaryPos; break;
-					}
-
-					ProcessTransitionCell(
-						Request, CellX, CellY, CellZ, CoarserStride, Face, OutMeshData, TriangleCount);
-				}
-			}
+			MeshTransitionRibbon(Request, Face, BoundaryPos, CoarserStride, OutMeshData, TriangleCount);
 		}
 	}
 
@@ -253,23 +307,15 @@ bool FVoxelCPUMarchingCubesMesher::GenerateMeshCPU(
 	// cell layer — the seam-job band). Full domain: all cells [0, ChunkSize).
 	const int32 CellLo = bInteriorDomain ? Stride : 0;
 	const int32 CellHiEx = bInteriorDomain ? (ChunkSize - Stride) : ChunkSize;
-	for (int32 Z = CellLo; Z < CellHiEx; Z += Stride)
-	{
-		for (int32 Y = CellLo; Y < CellHiEx; Y += Stride)
-		{
-			for (int32 X = CellLo; X < CellHiEx; X += Stride)
-			{
-				ProcessCubeLOD(Request, X, Y, Z, Stride, OutMeshData, TriangleCount,
-					FColor(0, 0, 0, 0), TransitionMask);
-			}
-		}
-	}
+	MeshCellBox(Request, FIntVector(CellLo), FIntVector(CellHiEx), TransitionMask, OutMeshData, TriangleCount);
 
 	// Generate skirts as fallback when Transvoxel is disabled (a boundary-reconciliation
 	// mechanism — inapplicable to the interior-only pass)
 	if (!bInteriorDomain && !Config.bUseTransvoxel && Config.bGenerateSkirts)
 	{
+		const int32 SkirtIndexStart = OutMeshData.Indices.Num();
 		GenerateSkirts(Request, Stride, OutMeshData, TriangleCount);
+		OutMeshData.SkirtIndexStart = OutMeshData.Indices.Num() > SkirtIndexStart ? SkirtIndexStart : INDEX_NONE;
 	}
 
 	// Log debug summary for transition cells
@@ -329,6 +375,12 @@ bool FVoxelCPUMarchingCubesMesher::GenerateMeshCPU(
 		}
 	}
 
+	// Far-LOD decimation (per LOD band), after skirts so their open strips stay pinned
+	if (FVoxelMeshSimplifier::SimplifyForRequest(Request, OutMeshData))
+	{
+		TriangleCount = OutMeshData.GetTriangleCount();
+	}
+
 	// Calculate stats
 	const double EndTime = FPlatformTime::Seconds();
 	OutStats.VertexCount = OutMeshData.Positions.Num();
@@ -342,9 +394,85 @@ bool FVoxelCPUMarchingCubesMesher::GenerateMeshCPU(
 		TEXT("MarchingCubes meshing complete: %d verts, %d tris, %.2fms"),
 		OutStats.VertexCount, TriangleCount, OutStats.GenerationTimeMs);
 
+	Config.PackOutputVertices(Request, OutMeshData);
 	return true;
 }
 
+void FVoxelCPUMarchingCubesMesher::MeshCellBox(
+	const FVoxelMeshingRequest& Request,
+	const FIntVector& CellMin,
+	const FIntVector& CellMaxEx,
+	uint8 TransitionMask,
+	FChunkMeshData& OutMeshData,
+	uint32& OutTriangleCount)
+{
+	const int32 Stride = 1 << FMath::Clamp(Request.LODLevel, 0, 7);
+	if (CellMin.X >= CellMaxEx.X || CellMin.Y >= CellMaxEx.Y || CellMin.Z >= CellMaxEx.Z)
+	{
+		return;
+	}
+
+	TVoxelScratchScope<FMCScratch> Scratch(EVoxelScratchUser::MarchingCubes);
+	FMCScratch* VertexCache = nullptr;
+	if (GVoxelMeshingMCVertexCache != 0)
+	{
+		VertexCache = &*Scratch;
+		VertexCache->BeginSweep(CellMin, CellMaxEx, Stride);
+	}
+
+	for (int32 Z = CellMin.Z; Z < CellMaxEx.Z; Z += Stride)
+	{
+		if (VertexCache)
+		{
+			VertexCache->BeginLayer(Z);
+		}
+		for (int32 Y = CellMin.Y; Y < CellMaxEx.Y; Y += Stride)
+		{
+			for (int32 X = CellMin.X; X < CellMaxEx.X; X += Stride)
+			{
+				ProcessCubeLOD(Request, X, Y, Z, Stride, OutMeshData, OutTriangleCount,
+					FColor(0, 0, 0, 0), TransitionMask, VertexCache);
+			}
+		}
+	}
+}
+
+void FVoxelCPUMarchingCubesMesher::MeshTransitionRibbon(
+	const FVoxelMeshingRequest& Request,
+	int32 FaceIndex,
+	int32 BoundaryPos,
+	int32 CoarserStride,
+	FChunkMeshData& OutMeshData,
+	uint32& OutTriangleCount)
+{
+	TVoxelScratchScope<FMCScratch> Scratch(EVoxelScratchUser::MarchingCubes);
+	FMCScratch* VertexCache = nullptr;
+	if (GVoxelMeshingMCVertexCache != 0)
+	{
+		VertexCache = &*Scratch;
+		VertexCache->RibbonVertices.Reset();
+	}
+
+	const int32 DepthAxis = FaceIndex / 2;
+	const int32 ChunkSize = Request.ChunkSize;
+	for (int32 FP2 = 0; FP2 < ChunkSize; FP2 += CoarserStride)
+	{
+		for (int32 FP1 = 0; FP1 < ChunkSize; FP1 += CoarserStride)
+		{
+			int32 CellX, CellY, CellZ;
+			switch (DepthAxis)
+			{
+			case 0: CellX = BoundaryPos; CellY = FP1; CellZ = FP2; break;
+			case 1: CellX = FP1; CellY = BoundaryPos; CellZ = FP2; break;
+			default: CellX = FP1; CellY = FP2; CellZ = BoundaryPos; break;
+			}
+
+			ProcessTransitionCell(
+				Request, CellX, CellY, CellZ, CoarserStride, FaceIndex, OutMeshData, OutTriangleCount, VertexCache);
+		}
+	}
+}
+
 void FVoxelCPUMarchingCubesMesher::ProcessCube(
 	const FVoxelMeshingRequest& Request,
 	int32 X, int32 Y, int32 Z,
@@ -533,7 +661,8 @@ void FVoxelCPUMarchingCubesMesher::ProcessCubeLOD(
 	FChunkMeshData& OutMeshData,
 	uint32& OutTriangleCount,
 	FColor DebugColorOverride,
-	uint8 TransitionMask)
+	uint8 TransitionMask,
+	FMCScratch* VertexCache)
 {
 	const float VoxelSize = Request.VoxelSize;
 	const float IsoLevel = Config.IsoLevel;
@@ -605,10 +734,106 @@ void FVoxelCPUMarchingCubesMesher::ProcessCubeLOD(
 	const uint8 MaterialID = GetDominantMaterialLOD(Request, X, Y, Z, Stride, ClassicCubeIndex);
 	const uint8 BiomeID = GetDominantBiomeLOD(Request, X, Y, Z, Stride, ClassicCubeIndex);
 
+	const float UVScale = Config.bGenerateUVs ? Config.UVScale : 0.0f;
+	FColor VertexColor(MaterialID, BiomeID, 0, 255);
+	if (bDebugColorTransitionCells)
+	{
+		if (DebugColorOverride.A != 0)
+		{
+			VertexColor = DebugColorOverride; // Caller-specified (blue for fallback MC)
+		}
+		else
+		{
+			VertexColor = FColor(0, 200, 0, 255); // Green for regular MC
+		}
+	}
+	const FVector2f MaterialUV(static_cast<float>(MaterialID), 0.0f);
+
 	// Decode edge vertices from RegularVertexData.
 	// Each uint16: low nibble = corner A, next nibble = corner B, high byte = reuse info.
 	const int32 VertexCount = CellData.GetVertexCount();
 	const uint16* VertexDataRow = TransvoxelTables::RegularVertexData[CaseIndex];
+
+	// Indexed path (voxel.Meshing.MCVertexCache): each crossed lattice edge is interpolated,
+	// morphed and shaded once, then indexed by every cell around it. The table always lists an
+	// edge from its higher to its lower corner, so the position is the one the legacy path
+	// computes. Normals are the gradient at the vertex and UVs project along the vertex normal's
+	// dominant axis (as the ribbon does), so a shared vertex serves every cell; a neighbour with a
+	// different material/biome colour gets its own copy.
+	if (VertexCache)
+	{
+		const bool bMorph = TransitionMask != 0 && CVarMCBoundaryMorph.GetValueOnAnyThread() != 0;
+		int32 CellVertexIndices[12];
+
+		for (int32 i = 0; i < VertexCount; i++)
+		{
+			const uint16 VertexCode = VertexDataRow[i];
+			const int32 CornerA = VertexCode & 0x0F;
+			const int32 CornerB = (VertexCode >> 4) & 0x0F;
+
+			int32* Slot = (CornerA != CornerB)
+				? &VertexCache->EdgeSlot(X, Y, Z, FMath::Min(CornerA, CornerB), CornerA ^ CornerB)
+				: nullptr;
+			if (Slot && *Slot != INDEX_NONE
+				&& OutMeshData.Colors[*Slot] == VertexColor && OutMeshData.UV1s[*Slot] == MaterialUV)
+			{
+				CellVertexIndices[i] = *Slot;
+				continue;
+			}
+
+			FVector3f P = (CornerA == CornerB)
+				? CornerPositions[CornerA]
+				: InterpolateEdge(
+					CornerDensities[CornerA], CornerDensities[CornerB],
+					CornerPositions[CornerA], CornerPositions[CornerB],
+					IsoLevel);
+			if (bMorph)
+			{
+				MorphVertexToCoarse(Request, Stride, TransitionMask, P);
+			}
+
+			const FVector3f N = CalculateGradientNormalLOD(Request,
+				P.X / VoxelSize, P.Y / VoxelSize, P.Z / VoxelSize, Stride);
+			const float AbsX = FMath::Abs(N.X);
+			const float AbsY = FMath::Abs(N.Y);
+			const float AbsZ = FMath::Abs(N.Z);
+			FVector2f UV;
+			if (AbsZ >= AbsX && AbsZ >= AbsY)
+			{
+				UV = FVector2f(P.X * UVScale / VoxelSize, P.Y * UVScale / VoxelSize);
+			}
+			else if (AbsX >= AbsY)
+			{
+				UV = FVector2f(P.Y * UVScale / VoxelSize, P.Z * UVScale / VoxelSize);
+			}
+			else
+			{
+				UV = FVector2f(P.X * UVScale / VoxelSize, P.Z * UVScale / VoxelSize);
+			}
+
+			const int32 NewIndex = OutMeshData.Positions.Add(P);
+			OutMeshData.Normals.Add(N);
+			OutMeshData.UVs.Add(UV);
+			OutMeshData.UV1s.Add(MaterialUV);
+			OutMeshData.Colors.Add(VertexColor);
+
+			if (Slot && *Slot == INDEX_NONE)
+			{
+				*Slot = NewIndex;
+			}
+			CellVertexIndices[i] = NewIndex;
+		}
+
+		for (int32 t = 0; t < TriangleCount; t++)
+		{
+			OutMeshData.Indices.Add(CellVertexIndices[CellData.VertexIndex[t * 3 + 0]]);
+			OutMeshData.Indices.Add(CellVertexIndices[CellData.VertexIndex[t * 3 + 1]]);
+			OutMeshData.Indices.Add(CellVertexIndices[CellData.VertexIndex[t * 3 + 2]]);
+		}
+		OutTriangleCount += TriangleCount;
+		return;
+	}
+
 	FVector3f CellVertices[12];
 
 	for (int32 i = 0; i < VertexCount; i++)
@@ -641,21 +866,6 @@ void FVoxelCPUMarchingCubesMesher::ProcessCubeLOD(
 	}
 
 	// Emit triangles using CellData triangle indices
-	const float UVScale = Config.bGenerateUVs ? Config.UVScale : 0.0f;
-	FColor VertexColor(MaterialID, BiomeID, 0, 255);
-	if (bDebugColorTransitionCells)
-	{
-		if (DebugColorOverride.A != 0)
-		{
-			VertexColor = DebugColorOverride; // Caller-specified (blue for fallback MC)
-		}
-		else
-		{
-			VertexColor = FColor(0, 200, 0, 255); // Green for regular MC
-		}
-	}
-	const FVector2f MaterialUV(static_cast<float>(MaterialID), 0.0f);
-
 	for (int32 t = 0; t < TriangleCount; t++)
 	{
 		const int32 Idx0 = CellData.VertexIndex[t * 3 + 0];
@@ -790,6 +1000,12 @@ FVoxelData FVoxelCPUMarchingCubesMesher::GetVoxelAt(
 	const FVoxelMeshingRequest& Request,
 	int32 X, int32 Y, int32 Z) const
 {
+	// Padded apron layout: one dense volume with the absent-neighbor fallback baked in.
+	if (Request.HasPaddedVolume())
+	{
+		return Request.GetPaddedVoxel(X, Y, Z);
+	}
+
 	const int32 ChunkSize = Request.ChunkSize;
 
 	// Check if within chunk bounds
@@ -1272,9 +1488,20 @@ FVector3f FVoxelCPUMarchingCubesMesher::CalculateGradientNormalLOD(
 	// This gives smoother normals at higher LOD levels
 	const float Delta = static_cast<float>(Stride);
 
-	const int32 IX = FMath::FloorToInt(X);
-	const int32 IY = FMath::FloorToInt(Y);
-	const int32 IZ = FMath::FloorToInt(Z);
+	int32 IX, IY, IZ;
+	if (Request.bLatticeReads && Stride > 1)
+	{
+		// Nearest lattice point, so the +-Stride taps are lattice samples too
+		IX = FMath::RoundToInt(X / Delta) * Stride;
+		IY = FMath::RoundToInt(Y / Delta) * Stride;
+		IZ = FMath::RoundToInt(Z / Delta) * Stride;
+	}
+	else
+	{
+		IX = FMath::FloorToInt(X);
+		IY = FMath::FloorToInt(Y);
+		IZ = FMath::FloorToInt(Z);
+	}
 
 	// Central difference gradient with LOD-scaled sampling
 	float gx = GetDensityAt(Request, IX + Stride, IY, IZ) - GetDensityAt(Request, IX - Stride, IY, IZ);
@@ -1306,7 +1533,9 @@ uint8 FVoxelCPUMarchingCubesMesher::GetDominantMaterialLOD(
 	// Strategy: For each solid strided corner, scan upward to find where density
 	// drops below threshold (the surface), then use the last solid voxel's material.
 
-	constexpr int32 MaxScanDistance = 8; // Don't scan too far up
+	// Lattice reads step up the column by Stride (every strided corner is a lattice point)
+	const int32 ScanStep = (Request.bLatticeReads && Stride > 1) ? Stride : 1;
+	const int32 MaxScanDistance = FMath::Max(8, ScanStep); // Don't scan too far up
 	uint8 SurfaceMaterial = 0;
 	int32 HighestSurfaceZ = INT32_MIN;
 
@@ -1323,7 +1552,7 @@ uint8 FVoxelCPUMarchingCubesMesher::GetDominantMaterialLOD(
 			uint8 LastSolidMaterial = 0;
 			int32 SurfaceZ = CornerZ;
 
-			for (int32 dz = 0; dz <= MaxScanDistance; dz++)
+			for (int32 dz = 0; dz <= MaxScanDistance; dz += ScanStep)
 			{
 				const FVoxelData Voxel = GetVoxelAt(Request, CornerX, CornerY, CornerZ + dz);
 
@@ -1360,7 +1589,8 @@ uint8 FVoxelCPUMarchingCubesMesher::GetDominantBiomeLOD(
 	// For LOD > 0, find the surface biome by scanning upward from solid corners.
 	// Consistent with GetDominantMaterialLOD approach.
 
-	constexpr int32 MaxScanDistance = 8;
+	const int32 ScanStep = (Request.bLatticeReads && Stride > 1) ? Stride : 1;
+	const int32 MaxScanDistance = FMath::Max(8, ScanStep);
 	uint8 SurfaceBiome = 0;
 	int32 HighestSurfaceZ = INT32_MIN;
 
@@ -1377,7 +1607,7 @@ uint8 FVoxelCPUMarchingCubesMesher::GetDominantBiomeLOD(
 			uint8 LastSolidBiome = 0;
 			int32 SurfaceZ = CornerZ;
 
-			for (int32 dz = 0; dz <= MaxScanDistance; dz++)
+			for (int32 dz = 0; dz <= MaxScanDistance; dz += ScanStep)
 			{
 				const FVoxelData Voxel = GetVoxelAt(Request, CornerX, CornerY, CornerZ + dz);
 
@@ -1953,7 +2183,6 @@ bool FVoxelCPUMarchingCubesMesher::HasRequiredNeighborData(
 	// not just face neighbor data.
 
 	const int32 ChunkSize = Request.ChunkSize;
-	const int32 SliceSize = ChunkSize * ChunkSize;
 
 	// Check all 13 sample positions
 	for (int32 i = 0; i < 13; i++)
@@ -2005,12 +2234,12 @@ bool FVoxelCPUMarchingCubesMesher::HasRequiredNeighborData(
 					// Check face neighbors
 					if (OutCount == 1)
 					{
-						if (bXPos && Request.NeighborXPos.Num() != SliceSize) return false;
-						if (bXNeg && Request.NeighborXNeg.Num() != SliceSize) return false;
-						if (bYPos && Request.NeighborYPos.Num() != SliceSize) return false;
-						if (bYNeg && Request.NeighborYNeg.Num() != SliceSize) return false;
-						if (bZPos && Request.NeighborZPos.Num() != SliceSize) return false;
-						if (bZNeg && Request.NeighborZNeg.Num() != SliceSize) return false;
+						if (bXPos && !Request.HasNeighbor(0)) return false;
+						if (bXNeg && !Request.HasNeighbor(1)) return false;
+						if (bYPos && !Request.HasNeighbor(2)) return false;
+						if (bYNeg && !Request.HasNeighbor(3)) return false;
+						if (bZPos && !Request.HasNeighbor(4)) return false;
+						if (bZNeg && !Request.HasNeighbor(5)) return false;
 					}
 					// Check edge neighbors
 					else if (OutCount == 2)
@@ -2112,7 +2341,8 @@ bool FVoxelCPUMarchingCubesMesher::ProcessTransitionCell(
 	int32 Stride,
 	int32 FaceIndex,
 	FChunkMeshData& OutMeshData,
-	uint32& OutTriangleCount)
+	uint32& OutTriangleCount,
+	FMCScratch* VertexCache)
 {
 	static const TCHAR* FaceNames[6] = { TEXT("-X"), TEXT("+X"), TEXT("-Y"), TEXT("+Y"), TEXT("-Z"), TEXT("+Z") };
 
@@ -2321,6 +2551,22 @@ bool FVoxelCPUMarchingCubesMesher::ProcessTransitionCell(
 	VertexOnOuterFace.Reserve(VertexCount);
 	bool bHasClampedVertices = false;
 
+	// Ribbon vertex keys (VertexCache only): the edge's two sample coordinates in voxels, 10 bits
+	// per axis, plus the outer-face flag (coarse corners 9-12 coincide with face samples 0,2,6,8
+	// but shade at the coarser stride). Neighbouring ribbon cells name a shared edge identically.
+	uint64 VertexKeys[12] = {};
+	auto SampleKey = [&](int32 Sample) -> uint64
+	{
+		const FVector3f& Offset = TransvoxelTables::TransitionCellSampleOffsets[FaceIndex][Sample];
+		FIntVector Coord(
+			X + FMath::RoundToInt(Offset.X * static_cast<float>(Stride)),
+			Y + FMath::RoundToInt(Offset.Y * static_cast<float>(Stride)),
+			Z + FMath::RoundToInt(Offset.Z * static_cast<float>(Stride)));
+		Coord[DepthAxis] = BoundaryDepthCoord;
+		return static_cast<uint64>(Coord.X & 0x3FF) | (static_cast<uint64>(Coord.Y & 0x3FF) << 10)
+			| (static_cast<uint64>(Coord.Z & 0x3FF) << 20);
+	};
+
 	// IMPORTANT: Index by CASE, not by class! The vertex data is pre-transformed per case.
 	const uint16* VertexData = TransvoxelTables::TransitionVertexData[CaseIndex];
 	for (int32 i = 0; i < VertexCount; i++)
@@ -2428,6 +2674,13 @@ bool FVoxelCPUMarchingCubesMesher::ProcessTransitionCell(
 		// corners (samples 9-12). Those use the coarser stride for normals so they match
 		// the coarser neighbour; everything touching the fine inner face uses the fine stride.
 		VertexOnOuterFace.Add(SampleA >= 9 && SampleB >= 9);
+		if (VertexCache)
+		{
+			const uint64 KeyA = SampleKey(SampleA);
+			const uint64 KeyB = SampleKey(SampleB);
+			VertexKeys[i] = FMath::Min(KeyA, KeyB) | (FMath::Max(KeyA, KeyB) << 30)
+				| (static_cast<uint64>(VertexOnOuterFace[i]) << 60);
+		}
 
 		if (bDebugLogTransitionCells)
 		{
@@ -2476,13 +2729,27 @@ bool FVoxelCPUMarchingCubesMesher::ProcessTransitionCell(
 		? FColor(255, 128, 0, 255)  // Orange for transition cells
 		: FColor(MaterialID, BiomeID, 0, 255);
 
-	// Add vertices to mesh
-	const uint32 BaseIndex = OutMeshData.Positions.Num();
+	// Add vertices to mesh. With the vertex cache, a vertex a neighbouring ribbon cell already
+	// emitted for the same edge (and colour) is reused; position, morph and normal stride are all
+	// functions of the edge alone.
+	const FVector2f MaterialUV(static_cast<float>(MaterialID), 0.0f);
+	int32 CellVertexIndices[12];
 
 	for (int32 i = 0; i < CellVertices.Num(); i++)
 	{
+		const int32* CachedIndex = VertexCache ? VertexCache->RibbonVertices.Find(VertexKeys[i]) : nullptr;
+		if (CachedIndex && OutMeshData.Colors[*CachedIndex] == VertexColor && OutMeshData.UV1s[*CachedIndex] == MaterialUV)
+		{
+			CellVertexIndices[i] = *CachedIndex;
+			continue;
+		}
+
 		const FVector3f& Pos = CellVertices[i];
-		OutMeshData.Positions.Add(Pos);
+		CellVertexIndices[i] = OutMeshData.Positions.Add(Pos);
+		if (VertexCache && !CachedIndex)
+		{
+			VertexCache->RibbonVertices.Add(VertexKeys[i], CellVertexIndices[i]);
+		}
 
 		// Calculate normal using gradient — match the stride of the adjacent mesh:
 		// Outer face vertices use CoarserStride (matches coarser neighbor MC normals),
@@ -2510,7 +2777,7 @@ bool FVoxelCPUMarchingCubesMesher::ProcessTransitionCell(
 		OutMeshData.UVs.Add(UV);
 
 		// UV1: MaterialID only (smooth meshing uses triplanar, no FaceType needed)
-		OutMeshData.UV1s.Add(FVector2f(static_cast<float>(MaterialID), 0.0f));
+		OutMeshData.UV1s.Add(MaterialUV);
 
 		OutMeshData.Colors.Add(VertexColor);
 	}
@@ -2610,15 +2877,15 @@ bool FVoxelCPUMarchingCubesMesher::ProcessTransitionCell(
 
 		if (bUseOriginalWinding)
 		{
-			OutMeshData.Indices.Add(BaseIndex + Idx0);
-			OutMeshData.Indices.Add(BaseIndex + Idx1);
-			OutMeshData.Indices.Add(BaseIndex + Idx2);
+			OutMeshData.Indices.Add(CellVertexIndices[Idx0]);
+			OutMeshData.Indices.Add(CellVertexIndices[Idx1]);
+			OutMeshData.Indices.Add(CellVertexIndices[Idx2]);
 		}
 		else
 		{
-			OutMeshData.Indices.Add(BaseIndex + Idx2);
-			OutMeshData.Indices.Add(BaseIndex + Idx1);
-			OutMeshData.Indices.Add(BaseIndex + Idx0);
+			OutMeshData.Indices.Add(CellVertexIndices[Idx2]);
+			OutMeshData.Indices.Add(CellVertexIndices[Idx1]);
+			OutMeshData.Indices.Add(CellVertexIndices[Idx0]);
 		}
 	}
 
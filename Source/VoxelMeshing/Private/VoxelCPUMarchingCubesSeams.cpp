@@ -210,14 +210,14 @@ static void SelectCornerArrays(FVoxelMeshingRequest& R, bool bPosX, bool bPosY,
 
 /** Base synthetic request for one participant frame. */
 static void InitFrameRequest(FVoxelMeshingRequest& R, const FIntVector& Coord, int32 LOD,
-	int32 CS, float VoxelSize, const FVector& WorldOrigin, const TArray<FVoxelData>& Volume)
+	int32 CS, float VoxelSize, const FVector& WorldOrigin, const TSharedPtr<const TArray<FVoxelData>>& Volume)
 {
 	R.ChunkCoord = Coord;
 	R.LODLevel = LOD;
 	R.ChunkSize = CS;
 	R.VoxelSize = VoxelSize;
 	R.WorldOrigin = WorldOrigin;
-	R.VoxelData = Volume; // per-frame copy (worker-side; seam jobs are few and throttled)
+	R.SharedVoxelData = Volume; // shares the participant snapshot — no per-frame copy
 	for (int32 i = 0; i < 6; ++i)
 	{
 		R.NeighborLODLevels[i] = LOD;
@@ -252,18 +252,7 @@ void FVoxelCPUMarchingCubesMesher::MeshSeamBandCells(
 	FChunkMeshData& OutMeshData,
 	uint32& TriangleCount)
 {
-	const int32 Stride = 1 << FMath::Clamp(SyntheticRequest.LODLevel, 0, 7);
-	for (int32 Z = BandMin.Z; Z < BandMaxEx.Z; Z += Stride)
-	{
-		for (int32 Y = BandMin.Y; Y < BandMaxEx.Y; Y += Stride)
-		{
-			for (int32 X = BandMin.X; X < BandMaxEx.X; X += Stride)
-			{
-				ProcessCubeLOD(SyntheticRequest, X, Y, Z, Stride, OutMeshData, TriangleCount,
-					FColor(0, 0, 0, 0), TransitionMask);
-			}
-		}
-	}
+	MeshCellBox(SyntheticRequest, BandMin, BandMaxEx, TransitionMask, OutMeshData, TriangleCount);
 }
 
 bool FVoxelCPUMarchingCubesMesher::GenerateFaceSeamMeshCPU(
@@ -282,12 +271,12 @@ bool FVoxelCPUMarchingCubesMesher::GenerateFaceSeamMeshCPU(
 	const int32 LODA = SeamRequest.LODLevel;
 	const int32 LODB = SeamRequest.GetLODLevelB();
 
-	struct FSide { FIntVector Coord; int32 LOD; const TArray<FVoxelData>* Vol; bool bFacingPos; };
+	struct FSide { FIntVector Coord; int32 LOD; const TSharedPtr<const TArray<FVoxelData>>* Vol; bool bFacingPos; };
 	FIntVector BCoord = SeamRequest.OwnerChunkCoord;
 	BCoord[Axis] += 1;
 	const FSide Sides[2] = {
-		{ SeamRequest.OwnerChunkCoord, LODA, SeamRequest.VoxelDataA.Get(), true  },
-		{ BCoord,                      LODB, SeamRequest.VoxelDataB.Get(), false },
+		{ SeamRequest.OwnerChunkCoord, LODA, &SeamRequest.VoxelDataA, true  },
+		{ BCoord,                      LODB, &SeamRequest.VoxelDataB, false },
 	};
 
 	for (int32 SideIdx = 0; SideIdx < 2; ++SideIdx)
@@ -303,7 +292,7 @@ bool FVoxelCPUMarchingCubesMesher::GenerateFaceSeamMeshCPU(
 		R.NeighborPlaneDepth = Depth;
 		TArray<FVoxelData>* Plane; TArray<FVoxelData>* Deep;
 		SelectFaceArrays(R, Axis, P.bFacingPos, Plane, Deep);
-		FillFacePlanes(*Other.Vol, CS, Axis, P.bFacingPos, Depth, *Plane, *Deep);
+		FillFacePlanes(**Other.Vol, CS, Axis, P.bFacingPos, Depth, *Plane, *Deep);
 		const int32 FacingFaceIdx = Axis * 2 + (P.bFacingPos ? 1 : 0);
 		R.NeighborLODLevels[FacingFaceIdx] = Other.LOD;
 		uint8 Mask = 0;
@@ -327,23 +316,8 @@ bool FVoxelCPUMarchingCubesMesher::GenerateFaceSeamMeshCPU(
 		// beyond the two participants self-skip via HasRequiredNeighborData).
 		if (Other.LOD > P.LOD)
 		{
-			const int32 CoarserStride = EOther;
 			const int32 BoundaryPos = P.bFacingPos ? (CS - S) : 0;
-			for (int32 FP2 = 0; FP2 < CS; FP2 += CoarserStride)
-			{
-				for (int32 FP1 = 0; FP1 < CS; FP1 += CoarserStride)
-				{
-					int32 CellX, CellY, CellZ;
-					switch (Axis)
-					{
-					case 0:  CellX = BoundaryPos; CellY = FP1; CellZ = FP2; break;
-					case 1:  CellX = FP1; CellY = BoundaryPos; CellZ = FP2; break;
-					default: CellX = FP1; CellY = FP2; CellZ = BoundaryPos; break;
-					}
-					ProcessTransitionCell(R, CellX, CellY, CellZ, CoarserStride, FacingFaceIdx,
-						OutMeshData, TriangleCount);
-				}
-			}
+			MeshTransitionRibbon(R, FacingFaceIdx, BoundaryPos, EOther, OutMeshData, TriangleCount);
 		}
 
 		const FIntVector DeltaP = P.Coord - SeamRequest.OwnerChunkCoord;
@@ -386,7 +360,7 @@ bool FVoxelCPUMarchingCubesMesher::GenerateEdgeSeamMeshCPU(
 		const bool bPosP2 = (qb == 0);
 
 		FVoxelMeshingRequest R;
-		InitFrameRequest(R, Coord, LOD, CS, VoxelSize, SeamRequest.WorldOrigin, *SeamRequest.VoxelData[q]);
+		InitFrameRequest(R, Coord, LOD, CS, VoxelSize, SeamRequest.WorldOrigin, SeamRequest.VoxelData[q]);
 		R.NeighborPlaneDepth = Depth;
 
 		TArray<FVoxelData>* Plane; TArray<FVoxelData>* Deep;
@@ -466,7 +440,7 @@ bool FVoxelCPUMarchingCubesMesher::GenerateCornerSeamMeshCPU(
 		const int32 Depth = FMath::Clamp(MaxCoarser + 1, 1, CS);
 
 		FVoxelMeshingRequest R;
-		InitFrameRequest(R, Coord, LOD, CS, VoxelSize, SeamRequest.WorldOrigin, *SeamRequest.VoxelData[o]);
+		InitFrameRequest(R, Coord, LOD, CS, VoxelSize, SeamRequest.WorldOrigin, SeamRequest.VoxelData[o]);
 		R.NeighborPlaneDepth = Depth;
 
 		TArray<FVoxelData>* Plane; TArray<FVoxelData>* Deep; uint32 Flag;
@@ -202,7 +202,7 @@ void FVoxelGPUCubicMesher::DispatchComputeShader(
 	FOnVoxelMeshingComplete OnComplete)
 {
 	// Pack voxel data for GPU
-	TArray<uint32> PackedVoxels = PackVoxelDataForGPU(Request.VoxelData);
+	TArray<uint32> PackedVoxels = PackVoxelDataForGPU(Request.GetVoxelArray());
 
 	// Pack neighbor data
 	TArray<uint32> PackedNeighborXPos, PackedNeighborXNeg;
@@ -402,7 +402,7 @@ void FVoxelGPUDualContourMesher::DispatchComputeShader(
 	FOnVoxelMeshingComplete OnComplete)
 {
 	// Pack voxel data
-	TArray<uint32> PackedVoxels = PackVoxelDataForGPU(Request.VoxelData);
+	TArray<uint32> PackedVoxels = PackVoxelDataForGPU(Request.GetVoxelArray());
 
 	// Pack neighbor data
 	TArray<uint32> PackedNeighborXPos, PackedNeighborXNeg;
@@ -384,7 +384,7 @@ void FVoxelGPUMarchingCubesMesher::DispatchComputeShader(
 	FOnVoxelMeshingComplete OnComplete)
 {
 	// Pack voxel data for GPU
-	TArray<uint32> PackedVoxels = PackVoxelDataForGPU(Request.VoxelData);
+	TArray<uint32> PackedVoxels = PackVoxelDataForGPU(Request.GetVoxelArray());
 
 	// Build Lengyel regular + transvoxel transition lookup tables (single source of
 	// truth from TransvoxelTables; uploaded as structured buffers for both passes).
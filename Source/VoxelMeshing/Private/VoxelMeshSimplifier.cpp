@@ -0,0 +1,456 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelMeshSimplifier.h"
+#include "VoxelMeshing.h"
+#include "ChunkRenderData.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GVoxelMeshingSimplify = 1;
+static FAutoConsoleVariableRef CVarVoxelMeshingSimplify(
+	TEXT("voxel.Meshing.Simplify"),
+	GVoxelMeshingSimplify,
+	TEXT("1 (default): CPU smooth meshers decimate chunk meshes whose LOD band enables simplification (FLODBand::bSimplifyMesh). ")
+	TEXT("0: skip the stage (meshes keep the uniform stride grid). Takes effect on the next remesh."),
+	ECVF_Default);
+
+namespace VoxelMeshSimplifier
+{
+	/** Symmetric 4x4 plane quadric (Garland-Heckbert), upper triangle */
+	struct FQuadric
+	{
+		double A2 = 0, AB = 0, AC = 0, AD = 0;
+		double B2 = 0, BC = 0, BD = 0;
+		double C2 = 0, CD = 0;
+		double D2 = 0;
+
+		void AddPlane(const FVector3d& N, double D)
+		{
+			A2 += N.X * N.X; AB += N.X * N.Y; AC += N.X * N.Z; AD += N.X * D;
+			B2 += N.Y * N.Y; BC += N.Y * N.Z; BD += N.Y * D;
+			C2 += N.Z * N.Z; CD += N.Z * D;
+			D2 += D * D;
+		}
+
+		void Add(const FQuadric& Other)
+		{
+			A2 += Other.A2; AB += Other.AB; AC += Other.AC; AD += Other.AD;
+			B2 += Other.B2; BC += Other.BC; BD += Other.BD;
+			C2 += Other.C2; CD += Other.CD;
+			D2 += Other.D2;
+		}
+
+		/** Sum of squared distances from P to the accumulated planes */
+		double Evaluate(const FVector3d& P) const
+		{
+			const double E = A2 * P.X * P.X + 2 * AB * P.X * P.Y + 2 * AC * P.X * P.Z + 2 * AD * P.X
+				+ B2 * P.Y * P.Y + 2 * BC * P.Y * P.Z + 2 * BD * P.Y
+				+ C2 * P.Z * P.Z + 2 * CD * P.Z
+				+ D2;
+			return FMath::Max(E, 0.0);
+		}
+	};
+
+	struct FCandidate
+	{
+		double Cost;
+		int32 From;
+		int32 To;
+		int32 Version;
+	};
+
+	struct FCandidateLess
+	{
+		FORCEINLINE bool operator()(const FCandidate& A, const FCandidate& B) const
+		{
+			return A.Cost < B.Cost;
+		}
+	};
+
+	using FTriList = TArray<int32, TInlineAllocator<8>>;
+
+	static uint64 EdgeKey(uint32 A, uint32 B)
+	{
+		return A < B ? (static_cast<uint64>(A) << 32) | B : (static_cast<uint64>(B) << 32) | A;
+	}
+
+	/**
+	 * Vertices whose attributes must not be merged across: material / biome (Colors R / G) and UV1
+	 * material id. Colors B carries per-vertex AO, which varies smoothly and must not lock vertices.
+	 */
+	static uint64 AttributeKey(const FChunkMeshData& Mesh, int32 Vertex)
+	{
+		const FColor Color = Mesh.Colors.IsValidIndex(Vertex) ? Mesh.Colors[Vertex] : FColor(0, 0, 0, 0);
+		const float Material = Mesh.UV1s.IsValidIndex(Vertex) ? Mesh.UV1s[Vertex].X : 0.0f;
+		return (static_cast<uint64>(Color.R) << 40) | (static_cast<uint64>(Color.G) << 32) | static_cast<uint32>(FMath::RoundToInt(Material));
+	}
+}
+
+FVoxelMeshSimplifyStats FVoxelMeshSimplifier::Simplify(FChunkMeshData& MeshData, const FVoxelMeshSimplifySettings& Settings)
+{
+	using namespace VoxelMeshSimplifier;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FVoxelMeshSimplifyStats Stats;
+	const int32 NumVertices = MeshData.Positions.Num();
+	const int32 NumTriangles = MeshData.Indices.Num() / 3;
+	Stats.InputVertices = Stats.OutputVertices = NumVertices;
+	Stats.InputTriangles = Stats.OutputTriangles = NumTriangles;
+
+	if (!Settings.IsEnabled() || NumTriangles == 0)
+	{
+		return Stats;
+	}
+
+	TArray<uint32>& Indices = MeshData.Indices;
+	const TArray<FVector3f>& Positions = MeshData.Positions;
+
+	// ---- Adjacency, quadrics and locks ----
+
+	TArray<bool> TriAlive;
+	TriAlive.SetNumUninitialized(NumTriangles);
+	TArray<FTriList> VertTris;
+	VertTris.SetNum(NumVertices);
+	TArray<FQuadric> Quadrics;
+	Quadrics.SetNum(NumVertices);
+	TArray<bool> Locked;
+	Locked.SetNumZeroed(NumVertices);
+	TArray<uint64> EdgeKeys;
+	EdgeKeys.Reserve(NumTriangles * 3);
+
+	int32 AliveTriangles = 0;
+	for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+	{
+		const uint32 I0 = Indices[Tri * 3 + 0];
+		const uint32 I1 = Indices[Tri * 3 + 1];
+		const uint32 I2 = Indices[Tri * 3 + 2];
+		if (I0 == I1 || I1 == I2 || I2 == I0 || FMath::Max3(I0, I1, I2) >= static_cast<uint32>(NumVertices))
+		{
+			// Degenerate index triangles render nothing; drop them up front
+			TriAlive[Tri] = false;
+			continue;
+		}
+		TriAlive[Tri] = true;
+		++AliveTriangles;
+
+		const FVector3d P0(Positions[I0]);
+		const FVector3d P1(Positions[I1]);
+		const FVector3d P2(Positions[I2]);
+		const FVector3d Normal = ((P1 - P0) ^ (P2 - P0)).GetSafeNormal();
+		const double D = -(Normal | P0);
+
+		for (const uint32 Vertex : { I0, I1, I2 })
+		{
+			VertTris[Vertex].Add(Tri);
+			Quadrics[Vertex].AddPlane(Normal, D);
+		}
+
+		EdgeKeys.Add(EdgeKey(I0, I1));
+		EdgeKeys.Add(EdgeKey(I1, I2));
+		EdgeKeys.Add(EdgeKey(I2, I0));
+
+		const uint64 Key0 = AttributeKey(MeshData, I0);
+		if (AttributeKey(MeshData, I1) != Key0 || AttributeKey(MeshData, I2) != Key0)
+		{
+			Locked[I0] = Locked[I1] = Locked[I2] = true;
+		}
+	}
+
+	// Open (1 triangle) and non-manifold (3+) edges pin both endpoints: chunk rims, interior-domain
+	// seam rims, skirt strips and unindexed fallback triangles all land here.
+	EdgeKeys.Sort();
+	for (int32 Begin = 0; Begin < EdgeKeys.Num();)
+	{
+		int32 End = Begin + 1;
+		while (End < EdgeKeys.Num() && EdgeKeys[End] == EdgeKeys[Begin])
+		{
+			++End;
+		}
+		if (End - Begin != 2)
+		{
+			Locked[static_cast<uint32>(EdgeKeys[Begin] >> 32)] = true;
+			Locked[static_cast<uint32>(EdgeKeys[Begin])] = true;
+		}
+		Begin = End;
+	}
+
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		Stats.LockedVertices += Locked[Vertex] ? 1 : 0;
+	}
+
+	// ---- Collapse evaluation ----
+
+	TArray<bool> VertAlive;
+	VertAlive.Init(true, NumVertices);
+	TArray<int32> Versions;
+	Versions.SetNumZeroed(NumVertices);
+
+	auto CollectNeighbors = [&](int32 Vertex, TArray<int32, TInlineAllocator<16>>& OutNeighbors)
+	{
+		OutNeighbors.Reset();
+		for (const int32 Tri : VertTris[Vertex])
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 Other = Indices[Tri * 3 + Corner];
+				if (Other != Vertex)
+				{
+					OutNeighbors.AddUnique(Other);
+				}
+			}
+		}
+	};
+
+	// Half-edge collapse From -> To keeps the mesh manifold and unflipped
+	TArray<int32, TInlineAllocator<16>> ToNeighbors;
+	auto IsCollapseValid = [&](int32 From, int32 To, const TArray<int32, TInlineAllocator<16>>& FromNeighbors) -> bool
+	{
+		int32 SharedTris = 0;
+		for (const int32 Tri : VertTris[From])
+		{
+			const uint32* Corners = &Indices[Tri * 3];
+			if (Corners[0] == static_cast<uint32>(To) || Corners[1] == static_cast<uint32>(To) || Corners[2] == static_cast<uint32>(To))
+			{
+				++SharedTris;
+				continue;
+			}
+
+			// Surviving triangle: replace From by To and check it neither degenerates nor flips
+			FVector3d Old[3];
+			FVector3d New[3];
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				Old[Corner] = FVector3d(Positions[Corners[Corner]]);
+				New[Corner] = Corners[Corner] == static_cast<uint32>(From) ? FVector3d(Positions[To]) : Old[Corner];
+			}
+			const FVector3d OldNormal = ((Old[1] - Old[0]) ^ (Old[2] - Old[0])).GetSafeNormal();
+			const FVector3d NewNormal = ((New[1] - New[0]) ^ (New[2] - New[0])).GetSafeNormal();
+			if (NewNormal.IsNearlyZero() || (OldNormal | NewNormal) < Settings.MinNormalDot)
+			{
+				return false;
+			}
+		}
+		if (SharedTris == 0)
+		{
+			return false;
+		}
+
+		// Link condition: the vertices adjacent to both ends are exactly the apexes of the shared triangles
+		CollectNeighbors(To, ToNeighbors);
+		int32 CommonNeighbors = 0;
+		for (const int32 Other : ToNeighbors)
+		{
+			CommonNeighbors += (Other != From && FromNeighbors.Contains(Other)) ? 1 : 0;
+		}
+		return CommonNeighbors == SharedTris;
+	};
+
+	const double MaxCost = static_cast<double>(Settings.MaxError) * Settings.MaxError;
+
+	TArray<FCandidate> Heap;
+	Heap.Reserve(NumVertices);
+
+	TArray<int32, TInlineAllocator<16>> Neighbors;
+	auto PushBestCandidate = [&](int32 From)
+	{
+		if (Locked[From] || !VertAlive[From] || VertTris[From].Num() == 0)
+		{
+			return;
+		}
+		CollectNeighbors(From, Neighbors);
+
+		FCandidate Best{ TNumericLimits<double>::Max(), From, INDEX_NONE, Versions[From] };
+		for (const int32 To : Neighbors)
+		{
+			FQuadric Combined = Quadrics[From];
+			Combined.Add(Quadrics[To]);
+			const double Cost = Combined.Evaluate(FVector3d(Positions[To]));
+			if (Cost < Best.Cost && Cost <= MaxCost && IsCollapseValid(From, To, Neighbors))
+			{
+				Best.Cost = Cost;
+				Best.To = To;
+			}
+		}
+		if (Best.To != INDEX_NONE)
+		{
+			Heap.HeapPush(Best, FCandidateLess());
+		}
+	};
+
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		PushBestCandidate(Vertex);
+	}
+
+	// ---- Greedy collapse ----
+
+	const int32 TargetTriangles = FMath::Max(1, FMath::CeilToInt(AliveTriangles * FMath::Clamp(Settings.TargetRatio, 0.0f, 1.0f)));
+	TArray<int32, TInlineAllocator<16>> Touched;
+
+	while (AliveTriangles > TargetTriangles && Heap.Num() > 0)
+	{
+		FCandidate Candidate;
+		Heap.HeapPop(Candidate, FCandidateLess(), EAllowShrinking::No);
+
+		const int32 From = Candidate.From;
+		const int32 To = Candidate.To;
+		if (!VertAlive[From] || Candidate.Version != Versions[From])
+		{
+			continue;
+		}
+		if (!VertAlive[To])
+		{
+			++Versions[From];
+			PushBestCandidate(From);
+			continue;
+		}
+
+		// Neighbourhood may have changed since this entry was pushed: revalidate
+		CollectNeighbors(From, Neighbors);
+		if (!Neighbors.Contains(To) || !IsCollapseValid(From, To, Neighbors))
+		{
+			++Versions[From];
+			PushBestCandidate(From);
+			continue;
+		}
+
+		// Apply: triangles on the collapsed edge die, the rest are re-pointed at To
+		for (const int32 Tri : VertTris[From])
+		{
+			uint32* Corners = &Indices[Tri * 3];
+			if (Corners[0] == static_cast<uint32>(To) || Corners[1] == static_cast<uint32>(To) || Corners[2] == static_cast<uint32>(To))
+			{
+				TriAlive[Tri] = false;
+				--AliveTriangles;
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					if (Corners[Corner] != static_cast<uint32>(From))
+					{
+						VertTris[Corners[Corner]].RemoveSingleSwap(Tri, EAllowShrinking::No);
+					}
+				}
+			}
+			else
+			{
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					if (Corners[Corner] == static_cast<uint32>(From))
+					{
+						Corners[Corner] = To;
+					}
+				}
+				VertTris[To].Add(Tri);
+			}
+		}
+		VertTris[From].Reset();
+		VertAlive[From] = false;
+		Quadrics[To].Add(Quadrics[From]);
+		++Stats.Collapses;
+
+		// To's quadric grew and its fan changed: re-evaluate it and every vertex around it
+		CollectNeighbors(To, Touched);
+		Touched.Add(To);
+		for (const int32 Vertex : Touched)
+		{
+			++Versions[Vertex];
+			PushBestCandidate(Vertex);
+		}
+	}
+
+	// ---- Compact ----
+
+	if (Stats.Collapses > 0 || AliveTriangles != NumTriangles)
+	{
+		TArray<int32> NewIndex;
+		NewIndex.Init(INDEX_NONE, NumVertices);
+		int32 NumKept = 0;
+		int32 WriteIndex = 0;
+		const int32 SkirtTri = MeshData.SkirtIndexStart != INDEX_NONE ? MeshData.SkirtIndexStart / 3 : NumTriangles;
+		int32 NewSkirtIndexStart = INDEX_NONE;
+		for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+		{
+			if (!TriAlive[Tri])
+			{
+				continue;
+			}
+			if (Tri >= SkirtTri && NewSkirtIndexStart == INDEX_NONE)
+			{
+				NewSkirtIndexStart = WriteIndex;
+			}
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Old = Indices[Tri * 3 + Corner];
+				if (NewIndex[Old] == INDEX_NONE)
+				{
+					NewIndex[Old] = NumKept++;
+				}
+			}
+			// Write after all three corners are read (WriteIndex never passes Tri * 3)
+			const uint32 I0 = NewIndex[Indices[Tri * 3 + 0]];
+			const uint32 I1 = NewIndex[Indices[Tri * 3 + 1]];
+			const uint32 I2 = NewIndex[Indices[Tri * 3 + 2]];
+			Indices[WriteIndex++] = I0;
+			Indices[WriteIndex++] = I1;
+			Indices[WriteIndex++] = I2;
+		}
+		Indices.SetNum(WriteIndex, EAllowShrinking::No);
+		MeshData.SkirtIndexStart = NewSkirtIndexStart;
+
+		// NewIndex is assigned in first-use order, which can run ahead of the old index; move
+		// through a permutation-safe copy
+		TArray<int32> OldForNew;
+		OldForNew.SetNumUninitialized(NumKept);
+		for (int32 Old = 0; Old < NumVertices; ++Old)
+		{
+			if (NewIndex[Old] != INDEX_NONE)
+			{
+				OldForNew[NewIndex[Old]] = Old;
+			}
+		}
+		auto Gather = [&](auto& Array)
+		{
+			if (Array.Num() != NumVertices)
+			{
+				return;
+			}
+			TArray<typename TRemoveReference<decltype(Array)>::Type::ElementType> Compacted;
+			Compacted.SetNumUninitialized(NumKept);
+			for (int32 New = 0; New < NumKept; ++New)
+			{
+				Compacted[New] = Array[OldForNew[New]];
+			}
+			Array = MoveTemp(Compacted);
+		};
+		Gather(MeshData.Positions);
+		Gather(MeshData.Normals);
+		Gather(MeshData.UVs);
+		Gather(MeshData.UV1s);
+		Gather(MeshData.Colors);
+		MeshData.PackedVertices.Reset();
+
+		Stats.OutputVertices = NumKept;
+		Stats.OutputTriangles = WriteIndex / 3;
+	}
+
+	Stats.TimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return Stats;
+}
+
+bool FVoxelMeshSimplifier::SimplifyForRequest(const FVoxelMeshingRequest& Request, FChunkMeshData& MeshData)
+{
+	if (GVoxelMeshingSimplify == 0 || !Request.Simplify.IsEnabled() || !MeshData.IsValid())
+	{
+		return false;
+	}
+
+	const FVoxelMeshSimplifyStats Stats = Simplify(MeshData, Request.Simplify);
+
+	UE_LOG(LogVoxelMeshing, Verbose,
+		TEXT("Simplified chunk (%d,%d,%d) LOD %d: %d -> %d tris, %d -> %d verts (%d locked), %.2fms"),
+		Request.ChunkCoord.X, Request.ChunkCoord.Y, Request.ChunkCoord.Z, Request.LODLevel,
+		Stats.InputTriangles, Stats.OutputTriangles, Stats.InputVertices, Stats.OutputVertices,
+		Stats.LockedVertices, Stats.TimeMs);
+
+	return Stats.OutputTriangles != Stats.InputTriangles || Stats.OutputVertices != Stats.InputVertices;
+}
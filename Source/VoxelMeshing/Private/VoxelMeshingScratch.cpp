@@ -0,0 +1,92 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelMeshingScratch.h"
+#include "VoxelMeshing.h"
+#include "HAL/IConsoleManager.h"
+#include <atomic>
+
+namespace VoxelMeshingScratchCounters
+{
+	struct FAtomicRow
+	{
+		std::atomic<int64> HighWaterBytes{0};
+		std::atomic<int64> Uses{0};
+		std::atomic<int64> Arenas{0};
+		std::atomic<int64> Fallbacks{0};
+	};
+
+	static FAtomicRow Rows[static_cast<int32>(EVoxelScratchUser::Num)];
+
+	static const TCHAR* UserNames[static_cast<int32>(EVoxelScratchUser::Num)] = {
+		TEXT("DualContour"),
+		TEXT("Cubic"),
+		TEXT("MarchingCubes"),
+	};
+}
+
+FVoxelMeshingScratchStats FVoxelMeshingScratchStats::Get()
+{
+	using namespace VoxelMeshingScratchCounters;
+
+	FVoxelMeshingScratchStats Stats;
+	for (int32 i = 0; i < static_cast<int32>(EVoxelScratchUser::Num); ++i)
+	{
+		Stats.Rows[i].HighWaterBytes = Rows[i].HighWaterBytes.load(std::memory_order_relaxed);
+		Stats.Rows[i].Uses = Rows[i].Uses.load(std::memory_order_relaxed);
+		Stats.Rows[i].Arenas = Rows[i].Arenas.load(std::memory_order_relaxed);
+		Stats.Rows[i].Fallbacks = Rows[i].Fallbacks.load(std::memory_order_relaxed);
+	}
+	return Stats;
+}
+
+void FVoxelMeshingScratchStats::Reset()
+{
+	using namespace VoxelMeshingScratchCounters;
+
+	for (FAtomicRow& Row : Rows)
+	{
+		Row.HighWaterBytes.store(0, std::memory_order_relaxed);
+		Row.Uses.store(0, std::memory_order_relaxed);
+		Row.Arenas.store(0, std::memory_order_relaxed);
+		Row.Fallbacks.store(0, std::memory_order_relaxed);
+	}
+}
+
+void FVoxelMeshingScratchStats::RecordArenaCreated(EVoxelScratchUser User)
+{
+	VoxelMeshingScratchCounters::Rows[static_cast<int32>(User)].Arenas.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FVoxelMeshingScratchStats::RecordScope(EVoxelScratchUser User, SIZE_T ArenaBytes, bool bFallback)
+{
+	VoxelMeshingScratchCounters::FAtomicRow& Row = VoxelMeshingScratchCounters::Rows[static_cast<int32>(User)];
+	(bFallback ? Row.Fallbacks : Row.Uses).fetch_add(1, std::memory_order_relaxed);
+
+	const int64 Bytes = static_cast<int64>(ArenaBytes);
+	int64 Seen = Row.HighWaterBytes.load(std::memory_order_relaxed);
+	while (Bytes > Seen && !Row.HighWaterBytes.compare_exchange_weak(Seen, Bytes, std::memory_order_relaxed))
+	{
+	}
+}
+
+// Console: voxel.Meshing.ScratchStats [reset]
+// Per-mesher-type scratch arena high-water marks and reuse counts.
+static FAutoConsoleCommand GVoxelMeshingScratchStatsCmd(
+	TEXT("voxel.Meshing.ScratchStats"),
+	TEXT("Log CPU mesher per-thread scratch arena stats (high-water bytes, uses, arenas, re-entrant fallbacks). Arg 'reset' zeroes them."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FVoxelMeshingScratchStats Stats = FVoxelMeshingScratchStats::Get();
+		for (int32 i = 0; i < static_cast<int32>(EVoxelScratchUser::Num); ++i)
+		{
+			const FVoxelMeshingScratchStats::FRow& Row = Stats.Rows[i];
+			UE_LOG(LogVoxelMeshing, Warning,
+				TEXT("voxel.Meshing.ScratchStats: %s HighWater=%.2fMB Uses=%lld Arenas=%lld Fallbacks=%lld"),
+				VoxelMeshingScratchCounters::UserNames[i], Row.HighWaterBytes / (1024.0 * 1024.0),
+				Row.Uses, Row.Arenas, Row.Fallbacks);
+		}
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			FVoxelMeshingScratchStats::Reset();
+		}
+	}));
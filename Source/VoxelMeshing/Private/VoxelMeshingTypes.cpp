@@ -0,0 +1,175 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelMeshingTypes.h"
+#include "ChunkRenderData.h"
+
+namespace VoxelPaddedLayout
+{
+	struct FNeighborOffset
+	{
+		int32 DX, DY, DZ;
+		uint32 Flag;
+	};
+
+	/** Face neighbors in HasNeighbor order; Flag is the PaddedFaceMask bit */
+	static const FNeighborOffset Faces[6] = {
+		{  1,  0,  0, 1 << 0 }, { -1,  0,  0, 1 << 1 },
+		{  0,  1,  0, 1 << 2 }, {  0, -1,  0, 1 << 3 },
+		{  0,  0,  1, 1 << 4 }, {  0,  0, -1, 1 << 5 },
+	};
+
+	/** Edge and corner neighbors with their EdgeCornerFlags bit */
+	static const FNeighborOffset EdgesAndCorners[20] = {
+		{  1,  1,  0, FVoxelMeshingRequest::EDGE_XPOS_YPOS }, {  1, -1,  0, FVoxelMeshingRequest::EDGE_XPOS_YNEG },
+		{ -1,  1,  0, FVoxelMeshingRequest::EDGE_XNEG_YPOS }, { -1, -1,  0, FVoxelMeshingRequest::EDGE_XNEG_YNEG },
+		{  1,  0,  1, FVoxelMeshingRequest::EDGE_XPOS_ZPOS }, {  1,  0, -1, FVoxelMeshingRequest::EDGE_XPOS_ZNEG },
+		{ -1,  0,  1, FVoxelMeshingRequest::EDGE_XNEG_ZPOS }, { -1,  0, -1, FVoxelMeshingRequest::EDGE_XNEG_ZNEG },
+		{  0,  1,  1, FVoxelMeshingRequest::EDGE_YPOS_ZPOS }, {  0,  1, -1, FVoxelMeshingRequest::EDGE_YPOS_ZNEG },
+		{  0, -1,  1, FVoxelMeshingRequest::EDGE_YNEG_ZPOS }, {  0, -1, -1, FVoxelMeshingRequest::EDGE_YNEG_ZNEG },
+		{  1,  1,  1, FVoxelMeshingRequest::CORNER_XPOS_YPOS_ZPOS }, {  1,  1, -1, FVoxelMeshingRequest::CORNER_XPOS_YPOS_ZNEG },
+		{  1, -1,  1, FVoxelMeshingRequest::CORNER_XPOS_YNEG_ZPOS }, {  1, -1, -1, FVoxelMeshingRequest::CORNER_XPOS_YNEG_ZNEG },
+		{ -1,  1,  1, FVoxelMeshingRequest::CORNER_XNEG_YPOS_ZPOS }, { -1,  1, -1, FVoxelMeshingRequest::CORNER_XNEG_YPOS_ZNEG },
+		{ -1, -1,  1, FVoxelMeshingRequest::CORNER_XNEG_YNEG_ZPOS }, { -1, -1, -1, FVoxelMeshingRequest::CORNER_XNEG_YNEG_ZNEG },
+	};
+}
+
+void FVoxelMeshingRequest::UpdatePaddedPresence()
+{
+	using namespace VoxelPaddedLayout;
+
+	const int32 Expected = ChunkSize * ChunkSize * ChunkSize;
+	auto IsPresent = [this, Expected](const FNeighborOffset& N)
+	{
+		const TSharedPtr<const TArray<FVoxelData>>& Source = PaddedSources[GetPaddedSlot(N.DX, N.DY, N.DZ)];
+		return Source.IsValid() && Source->Num() == Expected;
+	};
+
+	PaddedFaceMask = 0;
+	for (const FNeighborOffset& N : Faces)
+	{
+		if (IsPresent(N))
+		{
+			PaddedFaceMask |= static_cast<uint8>(N.Flag);
+		}
+	}
+
+	EdgeCornerFlags = 0;
+	for (const FNeighborOffset& N : EdgesAndCorners)
+	{
+		if (IsPresent(N))
+		{
+			EdgeCornerFlags |= N.Flag;
+		}
+	}
+}
+
+void FVoxelMeshingRequest::AssemblePaddedVolume()
+{
+	const int32 CS = ChunkSize;
+	const TArray<FVoxelData>& Own = GetVoxelArray();
+	if (PaddedApron <= 0 || CS <= 0 || Own.Num() != CS * CS * CS)
+	{
+		return;
+	}
+
+	// The apron never reaches past the adjacent chunk.
+	const int32 A = FMath::Min(PaddedApron, CS);
+	PaddedApron = A;
+	const int32 Dim = CS + 2 * A;
+	PaddedVoxels.SetNumUninitialized(Dim * Dim * Dim);
+
+	const FVoxelData* Sources[27];
+	for (int32 Slot = 0; Slot < 27; ++Slot)
+	{
+		const TSharedPtr<const TArray<FVoxelData>>& Source = PaddedSources[Slot];
+		Sources[Slot] = (Source.IsValid() && Source->Num() == Own.Num()) ? Source->GetData() : nullptr;
+	}
+	const FVoxelData* OwnData = Own.GetData();
+	Sources[GetPaddedSlot(0, 0, 0)] = OwnData;
+
+	const bool bClampFill = PaddedFill == EVoxelApronFill::ClampToChunk;
+	const FVoxelData AirVoxel = FVoxelData::Air();
+
+	// An output row splits into (at most) three contiguous runs along X: -X apron, chunk, +X apron.
+	struct FRowSegment
+	{
+		int32 DX;          // chunk offset of the source
+		int32 Start;       // first padded X
+		int32 Num;         // run length
+		int32 SourceX;     // source-chunk X of the first voxel
+	};
+	const FRowSegment Segments[3] = {
+		{ -1, 0,      A,  CS - A },
+		{  0, A,      CS, 0 },
+		{  1, A + CS, A,  0 },
+	};
+
+	for (int32 PZ = 0; PZ < Dim; ++PZ)
+	{
+		const int32 Z = PZ - A;
+		const int32 DZ = Z < 0 ? -1 : (Z >= CS ? 1 : 0);
+		const int32 SZ = Z - DZ * CS;
+		const int32 CZ = FMath::Clamp(Z, 0, CS - 1);
+
+		for (int32 PY = 0; PY < Dim; ++PY)
+		{
+			const int32 Y = PY - A;
+			const int32 DY = Y < 0 ? -1 : (Y >= CS ? 1 : 0);
+			const int32 SY = Y - DY * CS;
+			const int32 CY = FMath::Clamp(Y, 0, CS - 1);
+
+			FVoxelData* Row = PaddedVoxels.GetData() + (PY + PZ * Dim) * Dim;
+			const FVoxelData* OwnRow = OwnData + (CY + CZ * CS) * CS;
+
+			for (const FRowSegment& Seg : Segments)
+			{
+				FVoxelData* Dst = Row + Seg.Start;
+				if (const FVoxelData* Src = Sources[GetPaddedSlot(Seg.DX, DY, DZ)])
+				{
+					FMemory::Memcpy(Dst, Src + Seg.SourceX + (SY + SZ * CS) * CS, Seg.Num * sizeof(FVoxelData));
+				}
+				else if (!bClampFill)
+				{
+					for (int32 i = 0; i < Seg.Num; ++i)
+					{
+						Dst[i] = AirVoxel;
+					}
+				}
+				else if (Seg.DX == 0)
+				{
+					FMemory::Memcpy(Dst, OwnRow, CS * sizeof(FVoxelData));
+				}
+				else
+				{
+					const FVoxelData Edge = OwnRow[Seg.DX < 0 ? 0 : CS - 1];
+					for (int32 i = 0; i < Seg.Num; ++i)
+					{
+						Dst[i] = Edge;
+					}
+				}
+			}
+		}
+	}
+
+	for (TSharedPtr<const TArray<FVoxelData>>& Source : PaddedSources)
+	{
+		Source.Reset();
+	}
+}
+
+void FVoxelMeshingConfig::PackOutputVertices(const FVoxelMeshingRequest& Request, FChunkMeshData& MeshData) const
+{
+	if (OutputFormat == EVoxelMeshOutputFormat::MeshData || !MeshData.IsValid())
+	{
+		MeshData.PackedVertices.Reset();
+		return;
+	}
+
+	// Chunk-local positions span one ChunkSize * VoxelSize chunk at every LOD (the stride only
+	// coarsens the sampling), which is the lattice the renderer expects.
+	FVoxelCompactVertexCodec::Pack(
+		MeshData,
+		Request.ChunkSize * Request.VoxelSize,
+		OutputFormat == EVoxelMeshOutputFormat::CompactVertices,
+		MeshData.PackedVertices);
+}
@@ -226,6 +226,24 @@ public:
 	 */
 	virtual FString GetMesherTypeName() const = 0;
 
+	// ============================================================================
+	// Capabilities
+	// ============================================================================
+
+	/**
+	 * True if GenerateMeshCPU reads out-of-chunk voxels from the request's padded apron volume
+	 * (FVoxelMeshingRequest::HasPaddedVolume) when one is assembled. Meshers that only read the
+	 * per-face / edge / corner slice arrays keep the default.
+	 */
+	virtual bool SupportsPaddedVolume() const { return false; }
+
+	/**
+	 * True if, with FVoxelMeshingRequest::bLatticeReads set, every voxel GenerateMeshCPU reads at
+	 * LOD > 0 lies on the mesh stride's lattice under the current config (no transition cells or
+	 * other between-lattice reads), so chunks generated on a strided lattice mesh exactly.
+	 */
+	virtual bool SupportsLatticeOnlyReads() const { return false; }
+
 	// ============================================================================
 	// Seam-Ownership Meshing (SEAM_OWNERSHIP_ARCHITECTURE.md §2.2)
 	// ============================================================================
@@ -141,6 +141,21 @@ private:
 		FChunkMeshData& OutMeshData,
 		uint32& OutGeneratedFaces);
 
+	/**
+	 * Binary greedy meshing of all six face directions (voxel.Meshing.CubicBinaryGreedy, chunks up
+	 * to 64 voxels). One pass packs per-column solid/opaque 64-bit masks, face visibility comes from
+	 * shifts and ANDs, and quads are merged with trailing-zero scans. Emits exactly the quads of
+	 * ProcessFaceDirectionGreedy, in the same order.
+	 * @param Request The meshing request
+	 * @param OutMeshData Output mesh data
+	 * @param OutGeneratedFaces Counter for generated faces
+	 * @return Number of solid voxels in the chunk
+	 */
+	uint32 GenerateFacesBinaryGreedy(
+		const FVoxelMeshingRequest& Request,
+		FChunkMeshData& OutMeshData,
+		uint32& OutGeneratedFaces);
+
 	/**
 	 * Build a 2D face mask for a slice perpendicular to a face direction.
 	 * @param Face Face direction
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "IVoxelMesher.h"
 
+struct FQEFBatchSolver;
+
 /**
  * CPU-based smooth mesher using Dual Contouring algorithm.
  *
@@ -144,6 +146,7 @@ public:
 		FVoxelMeshingStats& OutStats) const override;
 
 	virtual FString GetMesherTypeName() const override { return TEXT("CPU Dual Contouring"); }
+	virtual bool SupportsPaddedVolume() const override { return true; }
 
 private:
 	// ============================================================================
@@ -169,6 +172,12 @@ private:
 		bool bValid = false;         // Whether this cell has a QEF vertex
 	};
 
+	/**
+	 * Per-thread scratch (TVoxelScratchScope): edge / cell grids cleared sparsely between calls,
+	 * plus the duplicate-vertex cache. Defined in the .cpp.
+	 */
+	struct FDCScratch;
+
 	/**
 	 * Flat array indexing for cells. Grid dimension = GridSize + 3 to cover
 	 * cells from -1 to GridSize+1 (needed for edge lookups at cell+1 offsets).
@@ -220,16 +229,72 @@ private:
 		TArray<FDCEdgeCrossing>& OutEdgeCrossings,
 		TArray<int32>& OutValidEdgeIndices);
 
+	/**
+	 * Sparse early-out, run before any scratch grid is acquired: true when every lattice sample has
+	 * the same iso sign (no edge can cross). Samples the apron shell first, where a surface through
+	 * the chunk almost always shows, then the in-chunk points unless Request.bUniformVoxelData
+	 * vouches for them. OutSolidSamples is only set when it returns true.
+	 */
+	bool ProbeUniformSign(
+		const FVoxelMeshingRequest& Request,
+		int32 Stride,
+		int32 GridDim,
+		uint32& OutSolidSamples) const;
+
+	/**
+	 * Sparse pass 0 (voxel.Meshing.DCSparseCells): sample the GridDim^3 density lattice once and
+	 * pack its iso-level signs into 64-bit row words (bit set = solid), 4 lanes per compare.
+	 * Returns false when every sample has the same sign — no edge can cross anywhere.
+	 */
+	bool BuildSignMask(
+		const FVoxelMeshingRequest& Request,
+		int32 Stride,
+		int32 GridDim,
+		TArray<float>& OutDensities,
+		TArray<uint64>& OutSignBits) const;
+
+	/** Solid in-chunk samples of the lattice (FVoxelData::IsAir semantics), for the stats. */
+	static uint32 CountSolidSamples(int32 GridDim, const TArray<float>& Densities);
+
+	/**
+	 * Sparse pass 1: edge crossings from sign-word XORs, reading densities from the lattice.
+	 * Same crossings, same values and same order as DetectEdgeCrossings.
+	 */
+	void DetectEdgeCrossingsFromMask(
+		const FVoxelMeshingRequest& Request,
+		int32 Stride,
+		int32 GridDim,
+		const TArray<float>& Densities,
+		const TArray<uint64>& SignBits,
+		TArray<FDCEdgeCrossing>& OutEdgeCrossings,
+		TArray<int32>& OutValidEdgeIndices);
+
+	/**
+	 * Sparse pass 2a: cells of the solve domain whose 8 corners are not all one sign (exactly
+	 * the cells with at least one crossing), as CellIndex values in grid order.
+	 */
+	void CollectActiveCells(
+		const FVoxelMeshingRequest& Request,
+		int32 Stride,
+		int32 GridDim,
+		const TArray<uint64>& SignBits,
+		TArray<int32>& OutActiveCells) const;
+
 	/**
 	 * Pass 2: Solve QEF for each cell that has edge crossings.
 	 * Collects hermite data from up to 12 edges touching the cell.
+	 * When ActiveCells is given only those cells are visited instead of the whole domain.
+	 * Solves go through QEFBatch and are flushed before returning.
 	 */
 	void SolveCellVertices(
 		const FVoxelMeshingRequest& Request,
 		int32 Stride,
 		int32 GridDim,
 		const TArray<FDCEdgeCrossing>& EdgeCrossings,
-		TArray<FDCCellVertex>& OutCellVertices);
+		const TArray<int32>* ActiveCells,
+		FQEFBatchSolver& QEFBatch,
+		TArray<FDCCellVertex>& OutCellVertices,
+		TArray<int32>& OutSolvedCells);
 
 	/**
 	 * Pass 3: Generate quads for each edge crossing.
@@ -242,6 +307,7 @@ private:
 		const TArray<FDCEdgeCrossing>& EdgeCrossings,
 		const TArray<int32>& ValidEdgeIndices,
 		TArray<FDCCellVertex>& CellVertices,
+		TMap<uint64, int32>& DuplicateVertexCache,
 		FChunkMeshData& OutMeshData,
 		uint32& OutTriangleCount);
 
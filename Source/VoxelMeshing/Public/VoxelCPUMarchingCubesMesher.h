@@ -15,8 +15,8 @@
  * Algorithm:
  * - Process voxels in 2x2x2 cubes
  * - For each cube, determine which of 256 configurations applies
- * - Interpolate vertices along intersected edges
- * - Generate triangles based on lookup table
+ * - Interpolate vertices along intersected edges (each shared edge once, see MeshCellBox)
+ * - Generate indexed triangles based on lookup table
  *
  * Performance: ~30-80ms for 32^3 chunk on typical CPU
  *
@@ -79,6 +79,8 @@ public:
 		FVoxelMeshingStats& OutStats) const override;
 
 	virtual FString GetMesherTypeName() const override { return TEXT("CPU MarchingCubes"); }
+	virtual bool SupportsPaddedVolume() const override { return true; }
+	virtual bool SupportsLatticeOnlyReads() const override { return !Config.bUseTransvoxel; }
 
 	// ============================================================================
 	// Seam-Ownership Meshing (P3 — implemented in VoxelCPUMarchingCubesSeams.cpp)
@@ -225,6 +227,12 @@ private:
 	// LOD Support
 	// ============================================================================
 
+	/**
+	 * Per-thread scratch (TVoxelScratchScope): the MC edge-vertex slices and the ribbon vertex map.
+	 * Defined in the .cpp.
+	 */
+	struct FMCScratch;
+
 	/**
 	 * Process a single cube at position with LOD stride.
 	 * Generates triangles for the isosurface using strided sampling.
@@ -237,6 +245,9 @@ private:
 	 * @param DebugColorOverride When alpha != 0, overrides vertex color (for debug coloring)
 	 * @param TransitionMask Active transition faces (borders coarser neighbours). When non-zero,
 	 *                       boundary-slab vertices are geomorphed toward the coarse surface.
+	 * @param VertexCache Shared-edge cache of the enclosing MeshCellBox sweep. When set, each
+	 *                    crossed lattice edge is emitted once and indexed by every cell around it;
+	 *                    when null, every triangle gets three fresh vertices (legacy layout).
 	 */
 	void ProcessCubeLOD(
 		const FVoxelMeshingRequest& Request,
@@ -245,7 +256,35 @@ private:
 		FChunkMeshData& OutMeshData,
 		uint32& OutTriangleCount,
 		FColor DebugColorOverride = FColor(0, 0, 0, 0),
-		uint8 TransitionMask = 0);
+		uint8 TransitionMask = 0,
+		FMCScratch* VertexCache = nullptr);
+
+	/**
+	 * Mesh every cell in [CellMin, CellMaxEx) (voxel coordinates, stepping by the request's LOD
+	 * stride) in Z/Y/X order. With voxel.Meshing.MCVertexCache on, the sweep shares edge vertices
+	 * through a sliding two-slice cache in this thread's scratch arena. Used by whole-chunk meshing
+	 * and the seam band passes alike, so both produce the same vertices.
+	 */
+	void MeshCellBox(
+		const FVoxelMeshingRequest& Request,
+		const FIntVector& CellMin,
+		const FIntVector& CellMaxEx,
+		uint8 TransitionMask,
+		FChunkMeshData& OutMeshData,
+		uint32& OutTriangleCount);
+
+	/**
+	 * Emit the transvoxel ribbon across one whole chunk face: a transition cell at every
+	 * coarse-aligned position of the boundary layer at BoundaryPos. With voxel.Meshing.MCVertexCache
+	 * on, vertices on edges shared by neighbouring ribbon cells are emitted once.
+	 */
+	void MeshTransitionRibbon(
+		const FVoxelMeshingRequest& Request,
+		int32 FaceIndex,
+		int32 BoundaryPos,
+		int32 CoarserStride,
+		FChunkMeshData& OutMeshData,
+		uint32& OutTriangleCount);
 
 	/**
 	 * Geomorph (bake) the edge vertices of a boundary-slab cube toward the coarse-LOD surface.
@@ -376,6 +415,8 @@ private:
 	 * @param FaceIndex Which face this transition is on (0-5 for -X,+X,-Y,+Y,-Z,+Z)
 	 * @param OutMeshData Output mesh data
 	 * @param OutTriangleCount Counter for generated triangles
+	 * @param VertexCache When set, vertices already emitted by a neighbouring ribbon cell of the
+	 *                    same MeshTransitionRibbon sweep are reused instead of duplicated
 	 */
 	bool ProcessTransitionCell(
 		const FVoxelMeshingRequest& Request,
@@ -383,7 +424,8 @@ private:
 		int32 Stride,
 		int32 FaceIndex,
 		FChunkMeshData& OutMeshData,
-		uint32& OutTriangleCount);
+		uint32& OutTriangleCount,
+		FMCScratch* VertexCache = nullptr);
 
 	/**
 	 * Check if a transition cell has all required neighbor data available.
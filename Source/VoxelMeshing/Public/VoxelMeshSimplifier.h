@@ -0,0 +1,59 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelMeshingTypes.h"
+
+struct FChunkMeshData;
+
+/** Counters from one FVoxelMeshSimplifier::Simplify call. */
+struct FVoxelMeshSimplifyStats
+{
+	int32 InputVertices = 0;
+	int32 InputTriangles = 0;
+	int32 OutputVertices = 0;
+	int32 OutputTriangles = 0;
+
+	/** Vertices that could not move: open / non-manifold edges and material borders */
+	int32 LockedVertices = 0;
+
+	int32 Collapses = 0;
+
+	float TimeMs = 0.0f;
+};
+
+/**
+ * Post-meshing decimation for smooth (DC / MC) chunk meshes: quadric-error half-edge collapse.
+ *
+ * Every vertex accumulates the plane quadrics of its incident triangles; collapsing U onto a
+ * neighbour V costs the summed squared distance of V's position to those planes, so coplanar
+ * patches (plains, ocean floor) merge at zero cost while curved surfaces resist. V keeps its
+ * own position and attributes, so no attribute interpolation is needed and the packed vertex
+ * lattice is unaffected.
+ *
+ * Boundary preservation: a vertex on an open edge (used by one triangle) or a non-manifold edge
+ * never moves. Chunk rims, seam-ownership interior rims (recomputed bit-exactly by the seam
+ * jobs) and skirt strips are all open edges, so LOD seams and GenerateSkirts stay watertight.
+ * Material borders are locked too. Collapses that would flip a triangle or break the link
+ * condition are rejected.
+ *
+ * Stateless and allocation-local: safe to run on any meshing worker.
+ */
+class VOXELMESHING_API FVoxelMeshSimplifier
+{
+public:
+	/**
+	 * Decimate MeshData in place until its triangle count reaches TargetRatio of the input or the
+	 * cheapest collapse would exceed MaxError. Vertex arrays are compacted; PackedVertices is reset
+	 * (callers repack afterwards).
+	 */
+	static FVoxelMeshSimplifyStats Simplify(FChunkMeshData& MeshData, const FVoxelMeshSimplifySettings& Settings);
+
+	/**
+	 * Mesher hook: simplify per Request.Simplify when enabled (and voxel.Meshing.Simplify is on).
+	 * Call before the mesh stats are taken and before FVoxelMeshingConfig::PackOutputVertices.
+	 * @return true if the mesh was modified
+	 */
+	static bool SimplifyForRequest(const FVoxelMeshingRequest& Request, FChunkMeshData& MeshData);
+};
@@ -0,0 +1,168 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** CPU meshers that draw on the per-thread scratch arena (stats are kept per mesher type). */
+enum class EVoxelScratchUser : uint8
+{
+	DualContour,
+	Cubic,
+	MarchingCubes,
+
+	Num
+};
+
+/**
+ * Process-wide scratch arena counters, one row per EVoxelScratchUser. Updated lock-free as each
+ * TVoxelScratchScope closes; read with FVoxelMeshingScratchStats::Get or voxel.Meshing.ScratchStats.
+ */
+struct VOXELMESHING_API FVoxelMeshingScratchStats
+{
+	struct FRow
+	{
+		/** Largest footprint any single thread's arena reached, in bytes */
+		int64 HighWaterBytes = 0;
+		/** Scopes served from a thread's (reused) arena */
+		int64 Uses = 0;
+		/** Arenas created (~ worker threads that have meshed with this mesher type) */
+		int64 Arenas = 0;
+		/** Re-entrant scopes that fell back to a temporary arena */
+		int64 Fallbacks = 0;
+	};
+
+	FRow Rows[static_cast<int32>(EVoxelScratchUser::Num)];
+
+	/** Snapshot of the counters. */
+	static FVoxelMeshingScratchStats Get();
+
+	/** Zero the counters (arenas themselves are kept). */
+	static void Reset();
+
+	/** Called by TVoxelScratchScope; not meant for direct use. */
+	static void RecordArenaCreated(EVoxelScratchUser User);
+	static void RecordScope(EVoxelScratchUser User, SIZE_T ArenaBytes, bool bFallback);
+};
+
+/**
+ * Dense per-cell scratch buffer reused across meshing calls on one thread.
+ *
+ * Acquire(Num) returns a buffer whose first Num elements are zero, like SetNumZeroed on a fresh
+ * array, but without re-zeroing the whole thing: only the indices recorded through MarkWritten
+ * (or appended to GetWrittenIndices) since the previous Acquire are cleared. Meshers that touch
+ * a thin surface shell of a large grid pay for the shell, not the grid. The buffer never shrinks
+ * and may hold more than Num elements; index it, don't iterate it.
+ *
+ * T must be trivially zeroable (all-zero bytes == the state the caller expects).
+ */
+template<typename T>
+class TVoxelSparseScratch
+{
+public:
+	TArray<T>& Acquire(int32 Num)
+	{
+		for (const int32 Index : Written)
+		{
+			FMemory::Memzero(&Data[Index], sizeof(T));
+		}
+		Written.Reset();
+		if (Data.Num() < Num)
+		{
+			Data.SetNumZeroed(Num);
+		}
+		return Data;
+	}
+
+	/** Record that Index was written, so the next Acquire clears it. */
+	FORCEINLINE void MarkWritten(int32 Index)
+	{
+		Written.Add(Index);
+	}
+
+	/**
+	 * The written-index list itself, in write order, for callers that already keep such a list
+	 * (e.g. the list of valid cells) and can append to it directly instead of calling MarkWritten.
+	 */
+	FORCEINLINE TArray<int32>& GetWrittenIndices()
+	{
+		return Written;
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return Data.GetAllocatedSize() + Written.GetAllocatedSize();
+	}
+
+private:
+	TArray<T> Data;
+	TArray<int32> Written;
+};
+
+/**
+ * RAII lease on this thread's ScratchType arena.
+ *
+ * Each worker thread lazily creates one ScratchType per type and keeps it for the life of the
+ * thread, so steady-state meshing allocates nothing but its output. A scope opened while the
+ * thread's arena is already leased (re-entrant meshing on one thread) gets a temporary arena
+ * instead. ScratchType must provide SIZE_T GetAllocatedSize() const.
+ */
+template<typename ScratchType>
+class TVoxelScratchScope
+{
+public:
+	explicit TVoxelScratchScope(EVoxelScratchUser InUser)
+		: User(InUser)
+	{
+		FSlot& Slot = GetSlot();
+		if (!Slot.Scratch.IsValid())
+		{
+			Slot.Scratch = MakeUnique<ScratchType>();
+			FVoxelMeshingScratchStats::RecordArenaCreated(User);
+		}
+		if (!Slot.bLeased)
+		{
+			Slot.bLeased = true;
+			bOwnsSlot = true;
+			Scratch = Slot.Scratch.Get();
+		}
+		else
+		{
+			Fallback = MakeUnique<ScratchType>();
+			Scratch = Fallback.Get();
+		}
+	}
+
+	~TVoxelScratchScope()
+	{
+		FVoxelMeshingScratchStats::RecordScope(User, Scratch->GetAllocatedSize(), !bOwnsSlot);
+		if (bOwnsSlot)
+		{
+			GetSlot().bLeased = false;
+		}
+	}
+
+	TVoxelScratchScope(const TVoxelScratchScope&) = delete;
+	TVoxelScratchScope& operator=(const TVoxelScratchScope&) = delete;
+
+	FORCEINLINE ScratchType& operator*() const { return *Scratch; }
+	FORCEINLINE ScratchType* operator->() const { return Scratch; }
+
+private:
+	struct FSlot
+	{
+		TUniquePtr<ScratchType> Scratch;
+		bool bLeased = false;
+	};
+
+	static FSlot& GetSlot()
+	{
+		static thread_local FSlot Slot;
+		return Slot;
+	}
+
+	ScratchType* Scratch = nullptr;
+	TUniquePtr<ScratchType> Fallback;
+	EVoxelScratchUser User;
+	bool bOwnsSlot = false;
+};
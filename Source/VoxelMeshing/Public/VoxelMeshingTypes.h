@@ -25,6 +25,58 @@ enum class EVoxelMeshCellDomain : uint8
 	Interior = 1,
 };
 
+/**
+ * Fill rule for apron voxels of an absent neighbor in the padded request layout. Each CPU mesher's
+ * legacy out-of-bounds read has its own fallback; the padded volume bakes the matching one in so
+ * the hot loop never branches on neighbor presence.
+ */
+enum class EVoxelApronFill : uint8
+{
+	/** Absent neighbors read as Air (Dual Contouring: boundary reads as a solid -> air crossing) */
+	Air,
+	/** Absent neighbors replicate the chunk's own nearest boundary voxel (Marching Cubes clamp-to-edge) */
+	ClampToChunk,
+};
+
+/**
+ * Vertex format a CPU mesher emits alongside the structure-of-arrays FChunkMeshData
+ * (FVoxelMeshingConfig::OutputFormat).
+ */
+UENUM()
+enum class EVoxelMeshOutputFormat : uint8
+{
+	/** SoA arrays only; the renderer converts on submit */
+	MeshData = 0,
+	/** Also pack FChunkMeshData::PackedVertices as FVoxelVertex on the meshing thread */
+	Vertices = 1,
+	/** As Vertices, but FVoxelCompactVertex where the mesh's UVs allow it */
+	CompactVertices = 2,
+};
+
+struct FChunkMeshData;
+
+/**
+ * Post-meshing simplification for one request (FVoxelMeshSimplifier), filled by the chunk
+ * manager from the chunk's FLODBand. Disabled by default: collision, seam and editor requests
+ * never set it.
+ */
+struct FVoxelMeshSimplifySettings
+{
+	/** Stop once the triangle count reaches this fraction of the meshed count (1 = disabled) */
+	float TargetRatio = 1.0f;
+
+	/** Largest collapse error, in world units: bounds the summed squared distance of the kept vertex to the merged planes */
+	float MaxError = 0.0f;
+
+	/** Reject collapses that tilt any surviving incident triangle's normal by more than acos of this */
+	float MinNormalDot = 0.5f;
+
+	FORCEINLINE bool IsEnabled() const
+	{
+		return TargetRatio < 1.0f && MaxError > 0.0f;
+	}
+};
+
 /**
  * Request structure for mesh generation.
  *
@@ -58,10 +110,17 @@ struct VOXELMESHING_API FVoxelMeshingRequest
 	UPROPERTY()
 	FVector WorldOrigin = FVector::ZeroVector;
 
-	/** Input voxel data (ChunkSize^3 elements) */
+	/** Input voxel data (ChunkSize^3 elements). Ignored when SharedVoxelData is set. */
 	UPROPERTY()
 	TArray<FVoxelData> VoxelData;
 
+	/**
+	 * Shared immutable input voxel data (ChunkSize^3 elements): the chunk's published snapshot
+	 * (FChunkDescriptor::GetSharedVoxelData) or an edit-merged version of it, handed to the job
+	 * without a copy. Takes precedence over VoxelData; read through GetVoxelArray().
+	 */
+	TSharedPtr<const TArray<FVoxelData>> SharedVoxelData;
+
 	/**
 	 * Face neighbor chunk data for seamless boundaries.
 	 * Each array contains ChunkSize^2 voxels representing the face slice.
@@ -297,6 +356,55 @@ struct VOXELMESHING_API FVoxelMeshingRequest
 	 */
 	float MorphWidthOverride = -1.0f;
 
+	/**
+	 * Keep every voxel read of the CPU MC LOD path on the mesh stride's lattice: gradient normals
+	 * are taken at the nearest lattice point (+-Stride) and the surface material/biome scan steps
+	 * up the column by Stride. Set by the chunk manager while LOD-strided generation is active, so
+	 * a chunk generated on a coarser lattice (FVoxelStridedLattice) never reads a replicated voxel.
+	 * No effect at LOD 0.
+	 */
+	bool bLatticeReads = false;
+
+	/**
+	 * Every voxel of the chunk's own array holds the same value (a Uniform descriptor with no edits
+	 * merged). Set by the chunk manager; lets the DC sparse path prove a chunk surface-free from the
+	 * apron shell alone, before any volumetric sampling. False is always safe.
+	 */
+	bool bUniformVoxelData = false;
+
+	// ==================== Padded Apron Layout ====================
+
+	/**
+	 * Padded apron layout (voxel.Meshing.PaddedApron). When > 0 the request carries none of the
+	 * per-face / edge / corner neighbor arrays above: the chunk plus a PaddedApron-voxel apron from
+	 * all 26 neighbors is assembled once into a dense (ChunkSize + 2*PaddedApron)^3 volume that the
+	 * CPU meshers index branch-free (GetPaddedVoxel). Reads past the apron clamp to its outermost
+	 * layer, matching the legacy deep-plane clamp. 0 = legacy slice layout.
+	 */
+	int32 PaddedApron = 0;
+
+	/** Apron fill for absent neighbors; must match the consuming mesher's legacy fallback */
+	EVoxelApronFill PaddedFill = EVoxelApronFill::Air;
+
+	/** Padded layout face presence, HasNeighbor order: bit 0 +X, 1 -X, 2 +Y, 3 -Y, 4 +Z, 5 -Z */
+	uint8 PaddedFaceMask = 0;
+
+	/**
+	 * Neighbor snapshots the padded volume is assembled from, indexed by GetPaddedSlot(DX, DY, DZ).
+	 * The centre slot is unused (the chunk's own data is GetVoxelArray()); null = neighbor absent.
+	 * Grabbed on the game thread (no copy), released by AssemblePaddedVolume on the worker.
+	 */
+	TSharedPtr<const TArray<FVoxelData>> PaddedSources[27];
+
+	/** Dense padded volume, X fastest. Empty until AssemblePaddedVolume runs. */
+	TArray<FVoxelData> PaddedVoxels;
+
+	/**
+	 * Far-LOD decimation applied by the CPU smooth meshers after meshing (and skirts), before
+	 * vertex packing, on the worker that meshed the chunk. See FVoxelMeshSimplifier.
+	 */
+	FVoxelMeshSimplifySettings Simplify;
+
 	// Transition face flag bits
 	static constexpr uint8 TRANSITION_XNEG = 1 << 0;
 	static constexpr uint8 TRANSITION_XPOS = 1 << 1;
@@ -329,17 +437,23 @@ struct VOXELMESHING_API FVoxelMeshingRequest
 	static constexpr uint32 CORNER_XNEG_YNEG_ZPOS = 1 << 18;
 	static constexpr uint32 CORNER_XNEG_YNEG_ZNEG = 1 << 19;
 
+	/** Input voxel array: the shared snapshot if present, else the owned VoxelData */
+	FORCEINLINE const TArray<FVoxelData>& GetVoxelArray() const
+	{
+		return SharedVoxelData.IsValid() ? *SharedVoxelData : VoxelData;
+	}
+
 	/** Get voxel at local position */
 	FORCEINLINE const FVoxelData& GetVoxel(int32 X, int32 Y, int32 Z) const
 	{
 		const int32 Index = X + Y * ChunkSize + Z * ChunkSize * ChunkSize;
-		return VoxelData[Index];
+		return GetVoxelArray()[Index];
 	}
 
 	/** Check if request has valid voxel data */
 	FORCEINLINE bool IsValid() const
 	{
-		return VoxelData.Num() == ChunkSize * ChunkSize * ChunkSize;
+		return GetVoxelArray().Num() == ChunkSize * ChunkSize * ChunkSize;
 	}
 
 	/** Get the world-space position of this chunk's origin (includes WorldOrigin offset) */
@@ -359,6 +473,10 @@ struct VOXELMESHING_API FVoxelMeshingRequest
 	/** Check if a neighbor slice is present */
 	FORCEINLINE bool HasNeighbor(int32 Face) const
 	{
+		if (PaddedApron > 0)
+		{
+			return (PaddedFaceMask & (1 << Face)) != 0;
+		}
 		switch (Face)
 		{
 		case 0: return NeighborXPos.Num() == GetNeighborSliceSize();
@@ -457,6 +575,43 @@ struct VOXELMESHING_API FVoxelMeshingRequest
 	{
 		return ChunkSize;
 	}
+
+	/** PaddedSources index of the neighbor at chunk offset (DX, DY, DZ), each in [-1, 1] */
+	static FORCEINLINE int32 GetPaddedSlot(int32 DX, int32 DY, int32 DZ)
+	{
+		return (DX + 1) + (DY + 1) * 3 + (DZ + 1) * 9;
+	}
+
+	/** True once AssemblePaddedVolume has built the dense volume */
+	FORCEINLINE bool HasPaddedVolume() const
+	{
+		return PaddedApron > 0 && PaddedVoxels.Num() > 0;
+	}
+
+	/**
+	 * Voxel at chunk-local (X, Y, Z), in or out of bounds, from the padded volume. Coordinates
+	 * clamp to [-PaddedApron, ChunkSize + PaddedApron - 1] per axis (min/max, no branches).
+	 */
+	FORCEINLINE const FVoxelData& GetPaddedVoxel(int32 X, int32 Y, int32 Z) const
+	{
+		const int32 Dim = ChunkSize + 2 * PaddedApron;
+		const int32 PX = FMath::Clamp(X + PaddedApron, 0, Dim - 1);
+		const int32 PY = FMath::Clamp(Y + PaddedApron, 0, Dim - 1);
+		const int32 PZ = FMath::Clamp(Z + PaddedApron, 0, Dim - 1);
+		return PaddedVoxels[PX + (PY + PZ * Dim) * Dim];
+	}
+
+	/**
+	 * Derive PaddedFaceMask and EdgeCornerFlags from which PaddedSources are set, so presence
+	 * queries (HasNeighbor / HasEdge / HasCorner) answer before the volume is assembled.
+	 */
+	void UpdatePaddedPresence();
+
+	/**
+	 * Assemble PaddedVoxels from the chunk's voxels and PaddedSources with contiguous row copies
+	 * (up to three memcpy segments per output row), then release the sources. Worker-safe.
+	 */
+	void AssemblePaddedVolume();
 };
 
 /**
@@ -901,4 +1056,15 @@ struct VOXELMESHING_API FVoxelMeshingConfig
 	 */
 	UPROPERTY(EditAnywhere, Category = "Meshing|Dual Contouring", meta = (ClampMin = "0.0", ClampMax = "1.0"))
 	float QEFBiasStrength = 0.5f;
+
+	/**
+	 * Render vertex format packed at the end of GenerateMeshCPU (on the worker thread) into
+	 * FChunkMeshData::PackedVertices. Set by the chunk manager when its renderer can take packed
+	 * buffers; the SoA arrays are always produced for collision and scatter.
+	 */
+	UPROPERTY()
+	EVoxelMeshOutputFormat OutputFormat = EVoxelMeshOutputFormat::MeshData;
+
+	/** Pack MeshData.PackedVertices per OutputFormat (no-op for MeshData or an empty mesh) */
+	void PackOutputVertices(const FVoxelMeshingRequest& Request, FChunkMeshData& MeshData) const;
 };
@@ -8,6 +8,7 @@
 #include "VoxelData.h"
 #include "ChunkRenderData.h"
 #include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
 
 // ==================== Helper Functions ====================
 
@@ -151,6 +152,72 @@ namespace CubicMeshingTestHelpers
 
 		return Request;
 	}
+
+	/**
+	 * Create a meshing request with rolling multi-material terrain, a cave, leaf (non-occluding)
+	 * canopies, biome variation and mixed neighbor slices on all six faces.
+	 */
+	FVoxelMeshingRequest CreateMixedTerrainRequest(int32 ChunkSize)
+	{
+		FVoxelMeshingRequest Request;
+		Request.ChunkCoord = FIntVector(0, 0, 0);
+		Request.ChunkSize = ChunkSize;
+		Request.VoxelSize = 100.0f;
+		Request.LODLevel = 0;
+
+		auto VoxelAt = [ChunkSize](int32 X, int32 Y, int32 Z) -> FVoxelData
+		{
+			const float Height = ChunkSize * 0.45f + ChunkSize * 0.15f * FMath::Sin(X * 0.21f) * FMath::Cos(Y * 0.17f);
+			const float Cave = FVector3f(X - ChunkSize * 0.5f, Y - ChunkSize * 0.4f, Z - ChunkSize * 0.3f).Size();
+			const uint8 Biome = static_cast<uint8>((X + 2 * Y) / 11 % 2);
+			if (Z < Height && Cave > ChunkSize * 0.15f)
+			{
+				return FVoxelData::Solid(static_cast<uint8>(Z < Height - 3.0f ? 2 : 1 + (X / 5) % 2), Biome);
+			}
+			const float Canopy = FVector3f(X - ChunkSize * 0.7f, Y - ChunkSize * 0.7f, Z - Height - 4.0f).Size();
+			if (Canopy < 4.0f)
+			{
+				return FVoxelData::Solid(21, Biome);  // Leaves
+			}
+			return FVoxelData::Air();
+		};
+
+		Request.VoxelData.SetNum(ChunkSize * ChunkSize * ChunkSize);
+		for (int32 Z = 0; Z < ChunkSize; ++Z)
+		{
+			for (int32 Y = 0; Y < ChunkSize; ++Y)
+			{
+				for (int32 X = 0; X < ChunkSize; ++X)
+				{
+					Request.VoxelData[X + Y * ChunkSize + Z * ChunkSize * ChunkSize] = VoxelAt(X, Y, Z);
+				}
+			}
+		}
+
+		// Neighbor slices sampled from the same field just outside the chunk (indexed [A + B * ChunkSize])
+		const int32 SliceSize = ChunkSize * ChunkSize;
+		TArray<FVoxelData>* Slices[6] = {
+			&Request.NeighborXPos, &Request.NeighborXNeg, &Request.NeighborYPos,
+			&Request.NeighborYNeg, &Request.NeighborZPos, &Request.NeighborZNeg };
+		for (int32 Face = 0; Face < 6; ++Face)
+		{
+			TArray<FVoxelData>& Slice = *Slices[Face];
+			Slice.SetNum(SliceSize);
+			const int32 Outside = (Face % 2 == 0) ? ChunkSize : -1;
+			for (int32 B = 0; B < ChunkSize; ++B)
+			{
+				for (int32 A = 0; A < ChunkSize; ++A)
+				{
+					const int32 Axis = Face / 2;
+					Slice[A + B * ChunkSize] = (Axis == 0) ? VoxelAt(Outside, A, B)
+						: (Axis == 1) ? VoxelAt(A, Outside, B)
+						: VoxelAt(A, B, Outside);
+				}
+			}
+		}
+
+		return Request;
+	}
 } // namespace CubicMeshingTestHelpers
 using namespace CubicMeshingTestHelpers;
 
@@ -666,3 +733,69 @@ bool FCubicMeshingChunkBoundaryTest::RunTest(const FString& Parameters)
 	Mesher.Shutdown();
 	return true;
 }
+
+// ==================== Binary Greedy Tests ====================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCubicMeshingBinaryGreedyParityTest, "VoxelWorlds.Meshing.Cubic.BinaryGreedyParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCubicMeshingBinaryGreedyParityTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* BinaryVar = IConsoleManager::Get().FindConsoleVariable(TEXT("voxel.Meshing.CubicBinaryGreedy"));
+	TestNotNull(TEXT("voxel.Meshing.CubicBinaryGreedy cvar is registered"), BinaryVar);
+	if (!BinaryVar)
+	{
+		return false;
+	}
+	const int32 SavedBinary = BinaryVar->GetInt();
+
+	FVoxelCPUCubicMesher Mesher;
+	Mesher.Initialize();
+
+	struct FCase { const TCHAR* Name; FVoxelMeshingRequest Request; };
+	const FCase Cases[] = {
+		{ TEXT("Mixed32"), CreateMixedTerrainRequest(32) },
+		{ TEXT("Mixed64"), CreateMixedTerrainRequest(64) },
+		{ TEXT("Terrain32"), CreateTerrainLikeRequest(32) },
+		{ TEXT("Full16"), CreateFullChunkRequest(16) },
+		{ TEXT("Single16"), CreateSingleVoxelRequest(16) },
+		{ TEXT("Empty16"), CreateEmptyChunkRequest(16) },
+	};
+
+	const int32 NumIterations = 5;
+	for (const FCase& Case : Cases)
+	{
+		FChunkMeshData Legacy, Binary;
+		FVoxelMeshingStats LegacyStats, BinaryStats;
+		double LegacyMs = 0.0;
+		double BinaryMs = 0.0;
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			BinaryVar->Set(0, ECVF_SetByCode);
+			double StartTime = FPlatformTime::Seconds();
+			Mesher.GenerateMeshCPU(Case.Request, Legacy, LegacyStats);
+			LegacyMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			BinaryVar->Set(1, ECVF_SetByCode);
+			StartTime = FPlatformTime::Seconds();
+			Mesher.GenerateMeshCPU(Case.Request, Binary, BinaryStats);
+			BinaryMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		}
+
+		AddInfo(FString::Printf(TEXT("%s: %d faces, legacy %.3f ms, binary %.3f ms"),
+			Case.Name, BinaryStats.FaceCount, LegacyMs / NumIterations, BinaryMs / NumIterations));
+
+		const FString Label(Case.Name);
+		TestTrue(*(Label + TEXT(" positions identical")), Legacy.Positions == Binary.Positions);
+		TestTrue(*(Label + TEXT(" normals identical")), Legacy.Normals == Binary.Normals);
+		TestTrue(*(Label + TEXT(" UVs identical")), Legacy.UVs == Binary.UVs && Legacy.UV1s == Binary.UV1s);
+		TestTrue(*(Label + TEXT(" colors identical")), Legacy.Colors == Binary.Colors);
+		TestTrue(*(Label + TEXT(" indices identical")), Legacy.Indices == Binary.Indices);
+		TestEqual(*(Label + TEXT(" face count")), BinaryStats.FaceCount, LegacyStats.FaceCount);
+		TestEqual(*(Label + TEXT(" solid voxel count")), BinaryStats.SolidVoxelCount, LegacyStats.SolidVoxelCount);
+	}
+
+	BinaryVar->Set(SavedBinary, ECVF_SetByCode);
+	Mesher.Shutdown();
+	return true;
+}
@@ -0,0 +1,133 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "VoxelCPUDualContourMesher.h"
+#include "VoxelMeshingTypes.h"
+#include "ChunkRenderData.h"
+#include "VoxelData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Batched QEF solve (voxel.Meshing.DCBatchQEF).
+// The 4-lane solver replays FQEFSolver::Solve op-for-op, so chunk meshes and
+// same-LOD face seams must be bit-identical with the batch on and off. The
+// field mixes sharp features (box corners: rank-3 systems), flat and ridged
+// regions (rank-1/2, exercising the SVD threshold) and vertices that leave
+// their cell (mass-point blend).
+// ---------------------------------------------------------------------------
+
+namespace DCBatchQEFTestUtils
+{
+	constexpr int32 TestChunkSize = 32;
+	constexpr float TestVoxelSize = 100.0f;
+
+	/** Density at a global voxel: terraced ground, a box and a sphere. */
+	static uint8 Density(int32 X, int32 Y, int32 Z)
+	{
+		const float Ground = 9.0f + FMath::FloorToFloat(X / 7.0f) * 1.5f + 2.0f * FMath::Sin(Y * 0.37f) - Z;
+		const float Box = 5.0f - FMath::Max3(FMath::Abs(X - 20.0f), FMath::Abs(Y - 12.0f), FMath::Abs(Z - 18.0f));
+		const float Ball = 6.5f - FVector3f(X - 38.0f, Y - 20.0f, Z - 14.0f).Size();
+		const float D = FMath::Max3(Ground, Box, Ball);
+		return static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(0.5f + D * 0.3f, 0.0f, 1.0f) * 255.0f));
+	}
+
+	static TSharedPtr<const TArray<FVoxelData>> SharedVoxels(const FIntVector& Origin)
+	{
+		TSharedPtr<TArray<FVoxelData>> Voxels = MakeShared<TArray<FVoxelData>>();
+		Voxels->SetNumUninitialized(TestChunkSize * TestChunkSize * TestChunkSize);
+		for (int32 Z = 0; Z < TestChunkSize; ++Z)
+		{
+			for (int32 Y = 0; Y < TestChunkSize; ++Y)
+			{
+				for (int32 X = 0; X < TestChunkSize; ++X)
+				{
+					(*Voxels)[X + Y * TestChunkSize + Z * TestChunkSize * TestChunkSize] =
+						FVoxelData(1, Density(Origin.X + X, Origin.Y + Y, Origin.Z + Z));
+				}
+			}
+		}
+		return Voxels;
+	}
+
+	static FVoxelMeshingConfig MakeConfig()
+	{
+		FVoxelMeshingConfig Config;
+		Config.bUseSmoothMeshing = true;
+		Config.IsoLevel = 0.5f;
+		Config.bGenerateSkirts = false;
+		return Config;
+	}
+
+	static bool SameMesh(const FChunkMeshData& A, const FChunkMeshData& B)
+	{
+		return A.Positions == B.Positions && A.Normals == B.Normals && A.Indices == B.Indices;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDualContourBatchQEFParityTest,
+	"VoxelWorlds.Meshing.DualContour.BatchQEF.Parity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDualContourBatchQEFParityTest::RunTest(const FString& Parameters)
+{
+	using namespace DCBatchQEFTestUtils;
+
+	IConsoleVariable* BatchVar = IConsoleManager::Get().FindConsoleVariable(TEXT("voxel.Meshing.DCBatchQEF"));
+	TestNotNull(TEXT("voxel.Meshing.DCBatchQEF cvar is registered"), BatchVar);
+	if (!BatchVar)
+	{
+		return false;
+	}
+	const int32 SavedBatch = BatchVar->GetInt();
+
+	FVoxelCPUDualContourMesher Mesher;
+	Mesher.Initialize();
+
+	// A tight SVD threshold keeps rank-3 solves; a loose one drops to the mass point more often.
+	for (const float SVDThreshold : { 0.1f, 0.5f })
+	{
+		FVoxelMeshingConfig Config = MakeConfig();
+		Config.QEFSVDThreshold = SVDThreshold;
+		Mesher.SetConfig(Config);
+
+		for (const int32 LOD : { 0, 1 })
+		{
+			const FString Label = FString::Printf(TEXT("SVD=%.2f LOD=%d"), SVDThreshold, LOD);
+
+			FVoxelMeshingRequest Request;
+			Request.ChunkSize = TestChunkSize;
+			Request.VoxelSize = TestVoxelSize;
+			Request.LODLevel = LOD;
+			Request.SharedVoxelData = SharedVoxels(FIntVector::ZeroValue);
+
+			FVoxelFaceSeamRequest Seam;
+			Seam.OwnerChunkCoord = FIntVector::ZeroValue;
+			Seam.Axis = 0;
+			Seam.LODLevel = LOD;
+			Seam.ChunkSize = TestChunkSize;
+			Seam.VoxelSize = TestVoxelSize;
+			Seam.VoxelDataA = SharedVoxels(FIntVector::ZeroValue);
+			Seam.VoxelDataB = SharedVoxels(FIntVector(TestChunkSize, 0, 0));
+
+			FChunkMeshData ScalarChunk, BatchChunk, ScalarSeam, BatchSeam;
+			BatchVar->Set(0, ECVF_SetByCode);
+			TestTrue(*(Label + TEXT(" scalar chunk")), Mesher.GenerateMeshCPU(Request, ScalarChunk) && ScalarChunk.Positions.Num() > 0);
+			TestTrue(*(Label + TEXT(" scalar seam")), Mesher.GenerateFaceSeamMeshCPU(Seam, ScalarSeam) && ScalarSeam.Positions.Num() > 0);
+			BatchVar->Set(1, ECVF_SetByCode);
+			TestTrue(*(Label + TEXT(" batch chunk")), Mesher.GenerateMeshCPU(Request, BatchChunk));
+			TestTrue(*(Label + TEXT(" batch seam")), Mesher.GenerateFaceSeamMeshCPU(Seam, BatchSeam));
+
+			TestTrue(*(Label + TEXT(" chunk mesh bit-identical")), SameMesh(ScalarChunk, BatchChunk));
+			TestTrue(*(Label + TEXT(" face seam bit-identical")), SameMesh(ScalarSeam, BatchSeam));
+		}
+	}
+
+	BatchVar->Set(SavedBatch, ECVF_SetByCode);
+	Mesher.Shutdown();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,187 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "VoxelCPUDualContourMesher.h"
+#include "VoxelMeshingTypes.h"
+#include "ChunkRenderData.h"
+#include "VoxelData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Sparse active-cell DC path (voxel.Meshing.DCSparseCells).
+// The sign-mask pipeline must produce bit-identical meshes and stats to the
+// dense per-cell passes — across LODs, both cell domains, and a 64-voxel chunk
+// whose lattice rows span two 64-bit words — and uniform chunks must return an
+// empty mesh with the solid count still reported, whether or not the request
+// vouches for its uniform content, while a surface in the apron still meshes.
+// ---------------------------------------------------------------------------
+
+namespace DCSparseCellTestUtils
+{
+	/** Wavy ground plane with a floating blob, smooth density ramp. */
+	static FVoxelMeshingRequest MakeRequest(int32 CS, int32 LOD, EVoxelMeshCellDomain Domain)
+	{
+		FVoxelMeshingRequest R;
+		R.ChunkSize = CS;
+		R.LODLevel = LOD;
+		R.VoxelSize = 100.0f;
+		R.MeshCellDomain = Domain;
+		R.VoxelData.SetNumUninitialized(CS * CS * CS);
+		for (int32 Z = 0; Z < CS; ++Z)
+		{
+			for (int32 Y = 0; Y < CS; ++Y)
+			{
+				for (int32 X = 0; X < CS; ++X)
+				{
+					const float Ground = CS * 0.35f + 3.0f * FMath::Sin(X * 0.31f) * FMath::Cos(Y * 0.23f) - Z;
+					const float Blob = CS * 0.2f - FVector3f(X - CS * 0.6f, Y - CS * 0.5f, Z - CS * 0.7f).Size();
+					const float D = FMath::Clamp(0.5f + FMath::Max(Ground, Blob) * 0.25f, 0.0f, 1.0f);
+					R.VoxelData[X + Y * CS + Z * CS * CS] = FVoxelData(1 + (X / 8) % 3, static_cast<uint8>(FMath::RoundToInt(D * 255.0f)));
+				}
+			}
+		}
+		return R;
+	}
+
+	/**
+	 * Uniform chunk with no neighbors, padded with ClampToChunk so the apron repeats the chunk
+	 * (the slice fallback would read Air past the faces and put a surface on a solid chunk).
+	 */
+	static FVoxelMeshingRequest MakeUniformRequest(int32 CS, uint8 Density)
+	{
+		FVoxelMeshingRequest R;
+		R.ChunkSize = CS;
+		R.VoxelSize = 100.0f;
+		R.VoxelData.Init(FVoxelData(1, Density), CS * CS * CS);
+		R.PaddedApron = 2;
+		R.PaddedFill = EVoxelApronFill::ClampToChunk;
+		R.UpdatePaddedPresence();
+		R.AssemblePaddedVolume();
+		return R;
+	}
+
+	static bool SameMesh(const FChunkMeshData& A, const FChunkMeshData& B)
+	{
+		return A.Positions == B.Positions && A.Normals == B.Normals && A.UVs == B.UVs
+			&& A.UV1s == B.UV1s && A.Colors == B.Colors && A.Indices == B.Indices;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDualContourSparseCellParityTest,
+	"VoxelWorlds.Meshing.DualContour.SparseCells.Parity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDualContourSparseCellParityTest::RunTest(const FString& Parameters)
+{
+	using namespace DCSparseCellTestUtils;
+
+	IConsoleVariable* SparseVar = IConsoleManager::Get().FindConsoleVariable(TEXT("voxel.Meshing.DCSparseCells"));
+	TestNotNull(TEXT("voxel.Meshing.DCSparseCells cvar is registered"), SparseVar);
+	if (!SparseVar)
+	{
+		return false;
+	}
+	const int32 SavedSparse = SparseVar->GetInt();
+
+	FVoxelCPUDualContourMesher Mesher;
+	Mesher.Initialize();
+	FVoxelMeshingConfig Config;
+	Config.bUseSmoothMeshing = true;
+	Config.IsoLevel = 0.5f;
+	Config.bGenerateSkirts = false;
+	Mesher.SetConfig(Config);
+
+	struct FCase { int32 CS; int32 LOD; EVoxelMeshCellDomain Domain; };
+	const FCase Cases[] = {
+		{ 32, 0, EVoxelMeshCellDomain::Full },
+		{ 32, 1, EVoxelMeshCellDomain::Full },
+		{ 32, 2, EVoxelMeshCellDomain::Full },
+		{ 32, 0, EVoxelMeshCellDomain::Interior },
+		{ 64, 0, EVoxelMeshCellDomain::Full },
+	};
+
+	for (const FCase& Case : Cases)
+	{
+		const FVoxelMeshingRequest Request = MakeRequest(Case.CS, Case.LOD, Case.Domain);
+		const FString Label = FString::Printf(TEXT("CS=%d LOD=%d Domain=%d"), Case.CS, Case.LOD, static_cast<int32>(Case.Domain));
+
+		FChunkMeshData Dense, Sparse;
+		FVoxelMeshingStats DenseStats, SparseStats;
+		SparseVar->Set(0, ECVF_SetByCode);
+		TestTrue(*(Label + TEXT(" dense meshes")), Mesher.GenerateMeshCPU(Request, Dense, DenseStats) && Dense.Positions.Num() > 0);
+		SparseVar->Set(1, ECVF_SetByCode);
+		TestTrue(*(Label + TEXT(" sparse meshes")), Mesher.GenerateMeshCPU(Request, Sparse, SparseStats));
+
+		TestTrue(*(Label + TEXT(" bit-identical mesh")), SameMesh(Dense, Sparse));
+		TestEqual(*(Label + TEXT(" solid voxel count")), SparseStats.SolidVoxelCount, DenseStats.SolidVoxelCount);
+	}
+
+	SparseVar->Set(SavedSparse, ECVF_SetByCode);
+	Mesher.Shutdown();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDualContourSparseCellUniformTest,
+	"VoxelWorlds.Meshing.DualContour.SparseCells.UniformEarlyOut",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDualContourSparseCellUniformTest::RunTest(const FString& Parameters)
+{
+	using namespace DCSparseCellTestUtils;
+
+	IConsoleVariable* SparseVar = IConsoleManager::Get().FindConsoleVariable(TEXT("voxel.Meshing.DCSparseCells"));
+	if (!SparseVar)
+	{
+		AddError(TEXT("voxel.Meshing.DCSparseCells cvar is not registered"));
+		return false;
+	}
+	const int32 SavedSparse = SparseVar->GetInt();
+	SparseVar->Set(1, ECVF_SetByCode);
+
+	FVoxelCPUDualContourMesher Mesher;
+	Mesher.Initialize();
+	FVoxelMeshingConfig Config;
+	Config.bUseSmoothMeshing = true;
+	Config.IsoLevel = 0.5f;
+	Mesher.SetConfig(Config);
+
+	constexpr int32 CS = 32;
+	FChunkMeshData Mesh;
+	FVoxelMeshingStats Stats;
+
+	TestTrue(TEXT("solid chunk meshes"), Mesher.GenerateMeshCPU(MakeUniformRequest(CS, 255), Mesh, Stats));
+	TestEqual(TEXT("solid chunk: no vertices"), Mesh.Positions.Num(), 0);
+	TestEqual(TEXT("solid chunk: all voxels solid"), static_cast<int32>(Stats.SolidVoxelCount), CS * CS * CS);
+
+	TestTrue(TEXT("air chunk meshes"), Mesher.GenerateMeshCPU(MakeUniformRequest(CS, 0), Mesh, Stats));
+	TestEqual(TEXT("air chunk: no vertices"), Mesh.Positions.Num(), 0);
+	TestEqual(TEXT("air chunk: no solid voxels"), static_cast<int32>(Stats.SolidVoxelCount), 0);
+
+	// The uniform hint skips the in-chunk samples; the counts must not change
+	FVoxelMeshingRequest Hinted = MakeUniformRequest(CS, 255);
+	Hinted.bUniformVoxelData = true;
+	TestTrue(TEXT("hinted solid chunk meshes"), Mesher.GenerateMeshCPU(Hinted, Mesh, Stats));
+	TestEqual(TEXT("hinted solid chunk: no vertices"), Mesh.Positions.Num(), 0);
+	TestEqual(TEXT("hinted solid chunk: all voxels solid"), static_cast<int32>(Stats.SolidVoxelCount), CS * CS * CS);
+
+	// Without the clamped apron the faces read Air: the hint must not hide that surface
+	FVoxelMeshingRequest Exposed;
+	Exposed.ChunkSize = CS;
+	Exposed.VoxelSize = 100.0f;
+	Exposed.VoxelData.Init(FVoxelData(1, 255), CS * CS * CS);
+	FChunkMeshData Unhinted;
+	TestTrue(TEXT("exposed solid chunk meshes"), Mesher.GenerateMeshCPU(Exposed, Unhinted, Stats));
+	Exposed.bUniformVoxelData = true;
+	TestTrue(TEXT("hinted exposed solid chunk meshes"), Mesher.GenerateMeshCPU(Exposed, Mesh, Stats));
+	TestTrue(TEXT("exposed solid chunk has a surface"), Unhinted.Positions.Num() > 0);
+	TestTrue(TEXT("hint leaves the apron surface intact"), SameMesh(Unhinted, Mesh));
+
+	SparseVar->Set(SavedSparse, ECVF_SetByCode);
+	Mesher.Shutdown();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -8,6 +8,7 @@
 #include "VoxelData.h"
 #include "ChunkRenderData.h"
 #include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
 
 // ==================== Helper Functions ====================
 
@@ -209,6 +210,72 @@ namespace MarchingCubesMeshingTestHelpers
 		Config.bCalculateAO = false;  // MarchingCubes meshing doesn't use AO
 		return Config;
 	}
+
+	/**
+	 * Create a meshing request with rolling terrain and a floating blob, smooth density ramp,
+	 * and three material bands along X (so neighbouring cells disagree on material).
+	 */
+	FVoxelMeshingRequest CreateRollingTerrainRequest(int32 ChunkSize = 32, int32 LODLevel = 0)
+	{
+		FVoxelMeshingRequest Request;
+		Request.ChunkCoord = FIntVector(0, 0, 0);
+		Request.ChunkSize = ChunkSize;
+		Request.VoxelSize = 100.0f;
+		Request.LODLevel = LODLevel;
+		Request.VoxelData.SetNum(ChunkSize * ChunkSize * ChunkSize);
+
+		for (int32 Z = 0; Z < ChunkSize; ++Z)
+		{
+			for (int32 Y = 0; Y < ChunkSize; ++Y)
+			{
+				for (int32 X = 0; X < ChunkSize; ++X)
+				{
+					const float Ground = ChunkSize * 0.4f + 3.0f * FMath::Sin(X * 0.29f) * FMath::Cos(Y * 0.21f) - Z;
+					const float Blob = ChunkSize * 0.15f - FVector3f(X - ChunkSize * 0.5f, Y - ChunkSize * 0.6f, Z - ChunkSize * 0.75f).Size();
+					const float D = FMath::Clamp(0.5f + FMath::Max(Ground, Blob) * 0.25f, 0.0f, 1.0f);
+					Request.VoxelData[X + Y * ChunkSize + Z * ChunkSize * ChunkSize] =
+						FVoxelData(static_cast<uint8>(1 + (X / 8) % 3), static_cast<uint8>(FMath::RoundToInt(D * 255.0f)));
+				}
+			}
+		}
+
+		return Request;
+	}
+
+	/** Mesh Request with voxel.Meshing.MCVertexCache forced to bCache; returns average ms over NumIterations. */
+	double MeshWithVertexCache(FVoxelCPUMarchingCubesMesher& Mesher, IConsoleVariable* CacheVar, bool bCache,
+		const FVoxelMeshingRequest& Request, int32 NumIterations, FChunkMeshData& OutMeshData)
+	{
+		CacheVar->Set(bCache ? 1 : 0, ECVF_SetByCode);
+		double TotalSeconds = 0.0;
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Mesher.GenerateMeshCPU(Request, OutMeshData);
+			TotalSeconds += FPlatformTime::Seconds() - StartTime;
+		}
+		return TotalSeconds / NumIterations * 1000.0;
+	}
+
+	/** True if both meshes list the same triangle corners (position, normal, material) in the same order. */
+	bool SameTriangleCorners(const FChunkMeshData& A, const FChunkMeshData& B)
+	{
+		if (A.Indices.Num() != B.Indices.Num())
+		{
+			return false;
+		}
+		for (int32 k = 0; k < A.Indices.Num(); ++k)
+		{
+			const uint32 IA = A.Indices[k];
+			const uint32 IB = B.Indices[k];
+			if (A.Positions[IA] != B.Positions[IB] || A.Normals[IA] != B.Normals[IB]
+				|| A.Colors[IA] != B.Colors[IB] || A.UV1s[IA] != B.UV1s[IB])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
 } // namespace MarchingCubesMeshingTestHelpers
 using namespace MarchingCubesMeshingTestHelpers;
 
@@ -574,13 +641,15 @@ bool FMarchingCubesMeshingCPUvsGPUTest::RunTest(const FString& Parameters)
 		GPUMeshData.GetVertexCount(), GPUMeshData.Indices.Num()));
 
 	// Due to atomic counter ordering, GPU vertex order may differ, but counts should be similar
-	// Allow some tolerance since floating point calculations may differ slightly
-	const int32 VertexDiff = FMath::Abs(CPUMeshData.GetVertexCount() - GPUMeshData.GetVertexCount());
+	// Allow some tolerance since floating point calculations may differ slightly.
+	// The GPU mesher writes one vertex per triangle corner; the CPU mesher shares edge vertices
+	// (voxel.Meshing.MCVertexCache), so its corner count is its index count.
+	const int32 VertexDiff = FMath::Abs(CPUMeshData.Indices.Num() - GPUMeshData.GetVertexCount());
 	const int32 IndexDiff = FMath::Abs(CPUMeshData.Indices.Num() - GPUMeshData.Indices.Num());
 
 	// Counts should be identical or very close
 	TestTrue(TEXT("Vertex counts should be similar"),
-		VertexDiff < CPUMeshData.GetVertexCount() * 0.1f);
+		VertexDiff < CPUMeshData.Indices.Num() * 0.1f);
 	TestTrue(TEXT("Index counts should be similar"),
 		IndexDiff < CPUMeshData.Indices.Num() * 0.1f);
 
@@ -712,3 +781,86 @@ bool FMarchingCubesMeshingPerformanceTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ==================== Shared-Edge Vertex Cache ====================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMarchingCubesMeshingVertexCacheTest, "VoxelWorlds.Meshing.MarchingCubes.VertexCache",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMarchingCubesMeshingVertexCacheTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* CacheVar = IConsoleManager::Get().FindConsoleVariable(TEXT("voxel.Meshing.MCVertexCache"));
+	TestNotNull(TEXT("voxel.Meshing.MCVertexCache cvar is registered"), CacheVar);
+	if (!CacheVar)
+	{
+		return false;
+	}
+	const int32 SavedCache = CacheVar->GetInt();
+
+	FVoxelCPUMarchingCubesMesher Mesher;
+	Mesher.Initialize();
+	FVoxelMeshingConfig Config = CreateMCConfig();
+	Config.bGenerateSkirts = false;
+	Mesher.SetConfig(Config);
+
+	struct FCase { const TCHAR* Name; FVoxelMeshingRequest Request; };
+	const FCase Cases[] = {
+		{ TEXT("Sphere 32^3"), CreateSphereSdfRequest(32, 12.0f) },
+		{ TEXT("Terrain 32^3 LOD0"), CreateRollingTerrainRequest(32, 0) },
+		{ TEXT("Terrain 32^3 LOD1"), CreateRollingTerrainRequest(32, 1) },
+		{ TEXT("Terrain 64^3 LOD0"), CreateRollingTerrainRequest(64, 0) },
+	};
+	const int32 NumIterations = 5;
+
+	for (const FCase& Case : Cases)
+	{
+		FChunkMeshData Legacy, Cached;
+		const double LegacyMs = MeshWithVertexCache(Mesher, CacheVar, false, Case.Request, NumIterations, Legacy);
+		const double CachedMs = MeshWithVertexCache(Mesher, CacheVar, true, Case.Request, NumIterations, Cached);
+
+		AddInfo(FString::Printf(TEXT("%s: legacy %d verts %.2f ms, cached %d verts %.2f ms (%.1fx fewer vertices, %d tris)"),
+			Case.Name, Legacy.Positions.Num(), LegacyMs, Cached.Positions.Num(), CachedMs,
+			static_cast<float>(Legacy.Positions.Num()) / FMath::Max(Cached.Positions.Num(), 1), Cached.Indices.Num() / 3));
+
+		TestTrue(FString::Printf(TEXT("%s: produces geometry"), Case.Name), Legacy.Indices.Num() > 0);
+		TestEqual(FString::Printf(TEXT("%s: legacy layout is one vertex per corner"), Case.Name),
+			Legacy.Positions.Num(), Legacy.Indices.Num());
+		TestTrue(FString::Printf(TEXT("%s: same triangle corners with and without the cache"), Case.Name),
+			SameTriangleCorners(Legacy, Cached));
+		TestTrue(FString::Printf(TEXT("%s: cache shares vertices (< 1/3 of legacy)"), Case.Name),
+			Cached.Positions.Num() * 3 < Legacy.Positions.Num());
+		TestTrue(FString::Printf(TEXT("%s: attribute streams stay parallel"), Case.Name),
+			Cached.Normals.Num() == Cached.Positions.Num() && Cached.UVs.Num() == Cached.Positions.Num()
+			&& Cached.UV1s.Num() == Cached.Positions.Num() && Cached.Colors.Num() == Cached.Positions.Num());
+	}
+
+	// Transvoxel ribbon on +X toward a coarser neighbour: the morph and the ribbon share vertices
+	// too. The ribbon keeps the first cell's copy of a shared edge, so compare counts only.
+	{
+		FVoxelMeshingRequest Request = CreateRollingTerrainRequest(32, 0);
+		Request.NeighborLODLevels[1] = 1;
+		Request.TransitionFaces = FVoxelMeshingRequest::TRANSITION_XPOS;
+		FVoxelMeshingConfig TransvoxelConfig = Config;
+		TransvoxelConfig.bUseTransvoxel = true;
+		Mesher.SetConfig(TransvoxelConfig);
+
+		FChunkMeshData Legacy, Cached;
+		const double LegacyMs = MeshWithVertexCache(Mesher, CacheVar, false, Request, NumIterations, Legacy);
+		const double CachedMs = MeshWithVertexCache(Mesher, CacheVar, true, Request, NumIterations, Cached);
+		AddInfo(FString::Printf(TEXT("Terrain 32^3 +X transition: legacy %d verts %.2f ms, cached %d verts %.2f ms"),
+			Legacy.Positions.Num(), LegacyMs, Cached.Positions.Num(), CachedMs));
+
+		TestEqual(TEXT("transition: same triangle count"), Cached.Indices.Num(), Legacy.Indices.Num());
+		TestTrue(TEXT("transition: cache shares vertices"), Cached.Positions.Num() * 3 < Legacy.Positions.Num());
+		bool bIndicesInRange = true;
+		for (const uint32 Index : Cached.Indices)
+		{
+			bIndicesInRange &= Index < static_cast<uint32>(Cached.Positions.Num());
+		}
+		TestTrue(TEXT("transition: indices in range"), bIndicesInRange);
+	}
+
+	CacheVar->Set(SavedCache, ECVF_SetByCode);
+	Mesher.Shutdown();
+	return true;
+}
@@ -0,0 +1,144 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelCPUMarchingCubesMesher.h"
+#include "VoxelCPUCubicMesher.h"
+#include "VoxelMeshingTypes.h"
+#include "ChunkRenderData.h"
+#include "VoxelData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Worker-side vertex packing (FVoxelMeshingConfig::OutputFormat).
+// MeshData leaves FChunkMeshData::PackedVertices empty; Vertices must equal
+// what the renderer's own conversion produces; CompactVertices must decode
+// to the same vertices within the codec's tolerances, and fall back to full
+// vertices where the mesh's UVs can't be derived (cubic).
+// ---------------------------------------------------------------------------
+
+namespace MeshOutputFormatTestUtils
+{
+	/** A sphere of the given radius (voxels) centred in a CS^3 chunk. */
+	static FVoxelMeshingRequest MakeSphereRequest(int32 CS, float Radius)
+	{
+		FVoxelMeshingRequest R;
+		R.ChunkSize = CS;
+		R.VoxelSize = 100.0f;
+		R.LODLevel = 0;
+		R.VoxelData.SetNumUninitialized(CS * CS * CS);
+		const float C = CS * 0.5f;
+		for (int32 Z = 0; Z < CS; ++Z)
+		{
+			for (int32 Y = 0; Y < CS; ++Y)
+			{
+				for (int32 X = 0; X < CS; ++X)
+				{
+					const float Dist = FVector3f(X - C, Y - C, Z - C).Size();
+					const float D = FMath::Clamp(0.5f + (Radius - Dist) * 0.25f, 0.0f, 1.0f);
+					R.VoxelData[X + Y * CS + Z * CS * CS] = FVoxelData(1, static_cast<uint8>(FMath::RoundToInt(D * 255.0f)));
+				}
+			}
+		}
+		return R;
+	}
+
+	static bool MeshWithFormat(IVoxelMesher& Mesher, const FVoxelMeshingRequest& Request, EVoxelMeshOutputFormat Format, FChunkMeshData& OutMesh)
+	{
+		FVoxelMeshingConfig Config = Mesher.GetConfig();
+		Config.OutputFormat = Format;
+		Mesher.SetConfig(Config);
+		return Mesher.GenerateMeshCPU(Request, OutMesh);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMeshOutputFormatSmoothTest,
+	"VoxelWorlds.Meshing.OutputFormat.Smooth",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshOutputFormatSmoothTest::RunTest(const FString& Parameters)
+{
+	using namespace MeshOutputFormatTestUtils;
+
+	const FVoxelMeshingRequest Request = MakeSphereRequest(32, 10.0f);
+	FVoxelCPUMarchingCubesMesher Mesher;
+	Mesher.Initialize();
+
+	FChunkMeshData Plain;
+	TestTrue(TEXT("MeshData meshes"), MeshWithFormat(Mesher, Request, EVoxelMeshOutputFormat::MeshData, Plain));
+	if (!TestTrue(TEXT("sphere produces geometry"), Plain.IsValid()))
+	{
+		return false;
+	}
+	TestFalse(TEXT("MeshData leaves vertices unpacked"), Plain.PackedVertices.IsPacked());
+
+	TArray<FVoxelVertex> Reference;
+	FBox ReferenceBounds;
+	FVoxelCompactVertexCodec::ConvertToVertices(Plain, Reference, ReferenceBounds);
+
+	// Full vertices: byte-identical to the renderer-side conversion
+	FChunkMeshData Full;
+	MeshWithFormat(Mesher, Request, EVoxelMeshOutputFormat::Vertices, Full);
+	TestEqual(TEXT("Vertices packs one vertex per position"), Full.PackedVertices.Vertices.Num(), Reference.Num());
+	TestEqual(TEXT("Vertices packs no compact vertices"), Full.PackedVertices.CompactVertices.Num(), 0);
+	TestTrue(TEXT("Vertices matches ConvertToVertices"), Full.PackedVertices.Vertices.Num() == Reference.Num()
+		&& FMemory::Memcmp(Full.PackedVertices.Vertices.GetData(), Reference.GetData(), Reference.Num() * sizeof(FVoxelVertex)) == 0);
+	TestTrue(TEXT("Vertices bounds match"), Full.PackedVertices.LocalBounds.Equals(ReferenceBounds));
+
+	// Compact vertices: triplanar UVs, so the whole mesh encodes
+	FChunkMeshData Compact;
+	MeshWithFormat(Mesher, Request, EVoxelMeshOutputFormat::CompactVertices, Compact);
+	const FVoxelPackedChunkVertices& Packed = Compact.PackedVertices;
+	if (!TestEqual(TEXT("CompactVertices packs compact"), Packed.CompactVertices.Num(), Reference.Num()))
+	{
+		return false;
+	}
+	TestTrue(TEXT("lattice matches the chunk world size"),
+		Packed.CompactFrame.PositionStep == Request.ChunkSize * Request.VoxelSize / FVoxelCompactVertexFrame::StepsPerChunk);
+
+	int32 BadVertices = 0;
+	for (int32 i = 0; i < Reference.Num(); ++i)
+	{
+		const FVoxelVertex Decoded = Packed.CompactFrame.Decode(Packed.CompactVertices[i]);
+		BadVertices += (Decoded.Position - Reference[i].Position).GetAbsMax() > Packed.CompactFrame.PositionStep * 0.5f + KINDA_SMALL_NUMBER
+			|| (Decoded.UV - Reference[i].UV).GetAbsMax() > FVoxelCompactVertexFrame::UVTolerance
+			|| Decoded.PackedNormalAndAO != Reference[i].PackedNormalAndAO
+			|| Decoded.PackedMaterialData != Reference[i].PackedMaterialData;
+	}
+	TestEqual(TEXT("compact vertices decode to the reference"), BadVertices, 0);
+	TestTrue(TEXT("compact bounds match"), Packed.LocalBounds.Equals(ReferenceBounds));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMeshOutputFormatCubicFallbackTest,
+	"VoxelWorlds.Meshing.OutputFormat.CubicFallback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshOutputFormatCubicFallbackTest::RunTest(const FString& Parameters)
+{
+	using namespace MeshOutputFormatTestUtils;
+
+	const FVoxelMeshingRequest Request = MakeSphereRequest(32, 10.0f);
+	FVoxelCPUCubicMesher Mesher;
+	Mesher.Initialize();
+
+	FChunkMeshData Mesh;
+	TestTrue(TEXT("cubic meshes"), MeshWithFormat(Mesher, Request, EVoxelMeshOutputFormat::CompactVertices, Mesh));
+	if (!TestTrue(TEXT("sphere produces geometry"), Mesh.IsValid()))
+	{
+		return false;
+	}
+
+	// Per-quad UVs don't fit the compact encoding: the pack falls back to full vertices
+	TestEqual(TEXT("falls back to full vertices"), Mesh.PackedVertices.Vertices.Num(), Mesh.Positions.Num());
+	TestEqual(TEXT("no compact vertices"), Mesh.PackedVertices.CompactVertices.Num(), 0);
+
+	Mesh.Reset();
+	TestFalse(TEXT("Reset clears packed vertices"), Mesh.PackedVertices.IsPacked());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,331 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelMeshSimplifier.h"
+#include "VoxelCPUMarchingCubesMesher.h"
+#include "VoxelMeshingTypes.h"
+#include "ChunkRenderData.h"
+#include "VoxelData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Far-LOD mesh simplification (FVoxelMeshSimplifier).
+// A flat grid must collapse by well over 5x while every open-edge (rim)
+// vertex keeps its exact position and the rim stays closed; material
+// borders must not move (AO in Colors B is not a border); curved input must
+// respect the error bound. The mesher hook must only run when the request
+// enables it.
+// ---------------------------------------------------------------------------
+
+namespace MeshSimplifierTestUtils
+{
+	/** Flat N x N quad grid at Z = 0, Step apart; the +X half gets material 2 when bSplitMaterial */
+	static FChunkMeshData MakeGrid(int32 N, float Step, bool bSplitMaterial = false)
+	{
+		FChunkMeshData Mesh;
+		for (int32 Y = 0; Y <= N; ++Y)
+		{
+			for (int32 X = 0; X <= N; ++X)
+			{
+				const uint8 Material = (bSplitMaterial && X > N / 2) ? 2 : 1;
+				Mesh.Positions.Add(FVector3f(X * Step, Y * Step, 0.0f));
+				Mesh.Normals.Add(FVector3f(0, 0, 1));
+				Mesh.UVs.Add(FVector2f(X, Y));
+				Mesh.UV1s.Add(FVector2f(Material, 0.0f));
+				Mesh.Colors.Add(FColor(Material, 0, 0, 255));
+			}
+		}
+		for (int32 Y = 0; Y < N; ++Y)
+		{
+			for (int32 X = 0; X < N; ++X)
+			{
+				const uint32 V00 = Y * (N + 1) + X;
+				const uint32 V10 = V00 + 1;
+				const uint32 V01 = V00 + N + 1;
+				const uint32 V11 = V01 + 1;
+				Mesh.Indices.Append({ V00, V10, V11, V00, V11, V01 });
+			}
+		}
+		return Mesh;
+	}
+
+	/** Positions of vertices on open edges (edges used by exactly one triangle) */
+	static TSet<FVector3f> OpenEdgePositions(const FChunkMeshData& Mesh, int32* OutOpenEdges = nullptr)
+	{
+		TMap<TPair<uint32, uint32>, int32> EdgeUses;
+		for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+		{
+			for (int32 e = 0; e < 3; ++e)
+			{
+				const uint32 A = Mesh.Indices[i + e];
+				const uint32 B = Mesh.Indices[i + (e + 1) % 3];
+				EdgeUses.FindOrAdd(TPair<uint32, uint32>(FMath::Min(A, B), FMath::Max(A, B)))++;
+			}
+		}
+		TSet<FVector3f> Result;
+		int32 OpenEdges = 0;
+		for (const auto& Pair : EdgeUses)
+		{
+			if (Pair.Value == 1)
+			{
+				Result.Add(Mesh.Positions[Pair.Key.Key]);
+				Result.Add(Mesh.Positions[Pair.Key.Value]);
+				++OpenEdges;
+			}
+		}
+		if (OutOpenEdges)
+		{
+			*OutOpenEdges = OpenEdges;
+		}
+		return Result;
+	}
+
+	static double SurfaceArea(const FChunkMeshData& Mesh)
+	{
+		double Area = 0.0;
+		for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+		{
+			const FVector3d P0(Mesh.Positions[Mesh.Indices[i]]);
+			const FVector3d P1(Mesh.Positions[Mesh.Indices[i + 1]]);
+			const FVector3d P2(Mesh.Positions[Mesh.Indices[i + 2]]);
+			Area += ((P1 - P0) ^ (P2 - P0)).Size() * 0.5;
+		}
+		return Area;
+	}
+
+	/** Gently rolling terrain filling the lower part of a CS^3 chunk */
+	static FVoxelMeshingRequest MakeTerrainRequest(int32 CS, float Amplitude)
+	{
+		FVoxelMeshingRequest R;
+		R.ChunkSize = CS;
+		R.VoxelSize = 100.0f;
+		R.LODLevel = 0;
+		R.VoxelData.SetNumUninitialized(CS * CS * CS);
+		for (int32 Z = 0; Z < CS; ++Z)
+		{
+			for (int32 Y = 0; Y < CS; ++Y)
+			{
+				for (int32 X = 0; X < CS; ++X)
+				{
+					const float Height = CS * 0.5f + Amplitude * FMath::Sin(X * 0.3f) * FMath::Cos(Y * 0.25f);
+					const float D = FMath::Clamp(0.5f + (Height - Z) * 0.25f, 0.0f, 1.0f);
+					R.VoxelData[X + Y * CS + Z * CS * CS] = FVoxelData(1, static_cast<uint8>(FMath::RoundToInt(D * 255.0f)));
+				}
+			}
+		}
+		return R;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMeshSimplifierFlatGridTest,
+	"VoxelWorlds.Meshing.Simplifier.FlatGrid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshSimplifierFlatGridTest::RunTest(const FString& Parameters)
+{
+	using namespace MeshSimplifierTestUtils;
+
+	constexpr int32 N = 16;
+	constexpr float Step = 100.0f;
+	FChunkMeshData Mesh = MakeGrid(N, Step);
+	int32 RimEdgesBefore = 0;
+	const TSet<FVector3f> RimBefore = OpenEdgePositions(Mesh, &RimEdgesBefore);
+
+	FVoxelMeshSimplifySettings Settings;
+	Settings.TargetRatio = 0.01f;
+	Settings.MaxError = 10.0f;
+	const FVoxelMeshSimplifyStats Stats = FVoxelMeshSimplifier::Simplify(Mesh, Settings);
+
+	TestEqual(TEXT("input triangles counted"), Stats.InputTriangles, N * N * 2);
+	TestEqual(TEXT("stats match the output"), Stats.OutputTriangles, Mesh.GetTriangleCount());
+	TestEqual(TEXT("rim vertices are locked"), Stats.LockedVertices, 4 * N);
+	TestTrue(FString::Printf(TEXT("flat grid drops more than 5x (%d -> %d)"), Stats.InputTriangles, Stats.OutputTriangles),
+		Stats.OutputTriangles * 5 < Stats.InputTriangles);
+
+	// Every attribute array is compacted alongside the positions
+	TestEqual(TEXT("normals compacted"), Mesh.Normals.Num(), Mesh.Positions.Num());
+	TestEqual(TEXT("UVs compacted"), Mesh.UVs.Num(), Mesh.Positions.Num());
+	TestEqual(TEXT("UV1s compacted"), Mesh.UV1s.Num(), Mesh.Positions.Num());
+	TestEqual(TEXT("colors compacted"), Mesh.Colors.Num(), Mesh.Positions.Num());
+
+	// The rim is untouched: same vertices, same edges, still one closed loop around the plane
+	int32 RimEdgesAfter = 0;
+	const TSet<FVector3f> RimAfter = OpenEdgePositions(Mesh, &RimEdgesAfter);
+	TestEqual(TEXT("rim vertex count preserved"), RimAfter.Num(), RimBefore.Num());
+	TestTrue(TEXT("rim vertex positions preserved"), RimAfter.Difference(RimBefore).Num() == 0);
+	TestEqual(TEXT("rim edges preserved"), RimEdgesAfter, RimEdgesBefore);
+	TestTrue(TEXT("plane still fully covered"), FMath::IsNearlyEqual(SurfaceArea(Mesh), double(N * N) * Step * Step, 1.0));
+
+	int32 Flipped = 0;
+	for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+	{
+		const FVector3f P0 = Mesh.Positions[Mesh.Indices[i]];
+		const FVector3f N0 = (Mesh.Positions[Mesh.Indices[i + 1]] - P0) ^ (Mesh.Positions[Mesh.Indices[i + 2]] - P0);
+		Flipped += N0.Z <= 0.0f;
+	}
+	TestEqual(TEXT("no flipped or degenerate triangles"), Flipped, 0);
+
+	// Disabled settings are a no-op
+	FChunkMeshData Untouched = MakeGrid(4, Step);
+	const FVoxelMeshSimplifyStats NoOp = FVoxelMeshSimplifier::Simplify(Untouched, FVoxelMeshSimplifySettings());
+	TestEqual(TEXT("disabled settings collapse nothing"), NoOp.Collapses, 0);
+	TestEqual(TEXT("disabled settings keep the mesh"), Untouched.GetTriangleCount(), 4 * 4 * 2);
+
+	// Per-vertex AO (Colors B) varies smoothly across a surface and must not lock vertices
+	FChunkMeshData Shaded = MakeGrid(N, Step);
+	for (int32 i = 0; i < Shaded.Colors.Num(); ++i)
+	{
+		Shaded.Colors[i].B = static_cast<uint8>((i * 37) & 0xFF);
+	}
+	const FVoxelMeshSimplifyStats ShadedStats = FVoxelMeshSimplifier::Simplify(Shaded, Settings);
+	TestEqual(TEXT("AO does not lock interior vertices"), ShadedStats.LockedVertices, 4 * N);
+	TestTrue(TEXT("AO-shaded grid still drops more than 5x"), ShadedStats.OutputTriangles * 5 < ShadedStats.InputTriangles);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMeshSimplifierMaterialBorderTest,
+	"VoxelWorlds.Meshing.Simplifier.MaterialBorder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshSimplifierMaterialBorderTest::RunTest(const FString& Parameters)
+{
+	using namespace MeshSimplifierTestUtils;
+
+	constexpr int32 N = 16;
+	FChunkMeshData Mesh = MakeGrid(N, 100.0f, true);
+
+	// Vertices on either side of the material border column
+	TSet<FVector3f> Border;
+	for (int32 Y = 0; Y <= N; ++Y)
+	{
+		Border.Add(FVector3f((N / 2) * 100.0f, Y * 100.0f, 0.0f));
+		Border.Add(FVector3f((N / 2 + 1) * 100.0f, Y * 100.0f, 0.0f));
+	}
+
+	FVoxelMeshSimplifySettings Settings;
+	Settings.TargetRatio = 0.01f;
+	Settings.MaxError = 10.0f;
+	FVoxelMeshSimplifier::Simplify(Mesh, Settings);
+
+	TSet<FVector3f> Remaining(Mesh.Positions);
+	TestTrue(TEXT("material border vertices stay"), Border.Difference(Remaining).Num() == 0);
+	TestTrue(TEXT("both material regions still simplify"), Mesh.GetTriangleCount() * 2 < N * N * 2);
+
+	int32 MixedTriangles = 0;
+	for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+	{
+		const FColor C0 = Mesh.Colors[Mesh.Indices[i]];
+		MixedTriangles += Mesh.Colors[Mesh.Indices[i + 1]] != C0 || Mesh.Colors[Mesh.Indices[i + 2]] != C0;
+	}
+	TestEqual(TEXT("only the original border strip mixes materials"), MixedTriangles, N * 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMeshSimplifierMesherHookTest,
+	"VoxelWorlds.Meshing.Simplifier.MesherHook",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshSimplifierMesherHookTest::RunTest(const FString& Parameters)
+{
+	using namespace MeshSimplifierTestUtils;
+
+	FVoxelCPUMarchingCubesMesher Mesher;
+	Mesher.Initialize();
+
+	// Flat ground (zero amplitude): the request's settings drive a large reduction
+	FVoxelMeshingRequest Request = MakeTerrainRequest(32, 0.0f);
+	FChunkMeshData Full;
+	Mesher.GenerateMeshCPU(Request, Full);
+	if (!TestTrue(TEXT("terrain produces geometry"), Full.IsValid()))
+	{
+		return false;
+	}
+
+	Request.Simplify.TargetRatio = 0.1f;
+	Request.Simplify.MaxError = 0.25f * Request.VoxelSize;
+	FChunkMeshData Simplified;
+	Mesher.GenerateMeshCPU(Request, Simplified);
+	TestTrue(FString::Printf(TEXT("flat terrain drops more than 5x (%d -> %d)"), Full.GetTriangleCount(), Simplified.GetTriangleCount()),
+		Simplified.GetTriangleCount() * 5 < Full.GetTriangleCount());
+	TestTrue(TEXT("chunk rim preserved"), OpenEdgePositions(Simplified).Difference(OpenEdgePositions(Full)).Num() == 0
+		&& OpenEdgePositions(Full).Num() == OpenEdgePositions(Simplified).Num());
+
+	// Rolling terrain: the error bound limits the reduction, and every kept vertex is an input vertex
+	FVoxelMeshingRequest Rolling = MakeTerrainRequest(32, 3.0f);
+	FChunkMeshData RollingFull;
+	Mesher.GenerateMeshCPU(Rolling, RollingFull);
+	Rolling.Simplify.TargetRatio = 0.01f;
+	Rolling.Simplify.MaxError = 0.05f * Rolling.VoxelSize;
+	FChunkMeshData RollingSimplified;
+	Mesher.GenerateMeshCPU(Rolling, RollingSimplified);
+	TestTrue(TEXT("error bound stops before the ratio on curved terrain"),
+		RollingSimplified.GetTriangleCount() > FMath::CeilToInt(RollingFull.GetTriangleCount() * 0.01f));
+	const TSet<FVector3f> InputPositions(RollingFull.Positions);
+	int32 NewPositions = 0;
+	for (const FVector3f& P : RollingSimplified.Positions)
+	{
+		NewPositions += !InputPositions.Contains(P);
+	}
+	TestEqual(TEXT("half-edge collapse invents no positions"), NewPositions, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMeshSimplifierSkirtRangeTest,
+	"VoxelWorlds.Meshing.Simplifier.SkirtRange",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshSimplifierSkirtRangeTest::RunTest(const FString& Parameters)
+{
+	using namespace MeshSimplifierTestUtils;
+
+	// Flat grid with a skirt strip hanging below its Y = 0 rim, appended the way GenerateSkirts does
+	constexpr int32 N = 16;
+	constexpr float Step = 100.0f;
+	FChunkMeshData Mesh = MakeGrid(N, Step);
+	Mesh.SkirtIndexStart = Mesh.Indices.Num();
+	const uint32 FirstBottom = Mesh.Positions.Num();
+	for (int32 X = 0; X <= N; ++X)
+	{
+		Mesh.Positions.Add(FVector3f(X * Step, 0.0f, -2.0f * Step));
+		Mesh.Normals.Add(FVector3f(0, -1, 0));
+		Mesh.UVs.Add(FVector2f(X, 0));
+		Mesh.UV1s.Add(FVector2f(1, 0.0f));
+		Mesh.Colors.Add(FColor(1, 0, 0, 255));
+	}
+	for (int32 X = 0; X < N; ++X)
+	{
+		const uint32 T0 = X;
+		const uint32 T1 = X + 1;
+		const uint32 B0 = FirstBottom + X;
+		const uint32 B1 = B0 + 1;
+		Mesh.Indices.Append({ T0, B1, T1, T0, B0, B1 });
+	}
+
+	FVoxelMeshSimplifySettings Settings;
+	Settings.TargetRatio = 0.01f;
+	Settings.MaxError = 10.0f;
+	FVoxelMeshSimplifier::Simplify(Mesh, Settings);
+
+	TestTrue(TEXT("skirt range survives compaction"), Mesh.SkirtIndexStart != INDEX_NONE && Mesh.SkirtIndexStart % 3 == 0
+		&& Mesh.SkirtIndexStart < Mesh.Indices.Num());
+	int32 Misplaced = 0;
+	for (int32 i = 0; i < Mesh.Indices.Num(); i += 3)
+	{
+		bool bTouchesSkirt = false;
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			bTouchesSkirt |= Mesh.Positions[Mesh.Indices[i + Corner]].Z < 0.0f;
+		}
+		Misplaced += bTouchesSkirt != (i >= Mesh.SkirtIndexStart);
+	}
+	TestEqual(TEXT("SkirtIndexStart splits surface from skirt triangles"), Misplaced, 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
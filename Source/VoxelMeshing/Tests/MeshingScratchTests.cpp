@@ -0,0 +1,145 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelMeshingScratch.h"
+#include "VoxelCPUDualContourMesher.h"
+#include "VoxelMeshingTypes.h"
+#include "ChunkRenderData.h"
+#include "VoxelData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Per-thread meshing scratch arenas (VoxelMeshingScratch.h).
+// Sparse clearing must leave a reused buffer indistinguishable from a fresh
+// SetNumZeroed one, and a mesher drawing on a dirty arena must produce the
+// same mesh as on a cold one.
+// ---------------------------------------------------------------------------
+
+namespace MeshingScratchTestUtils
+{
+	struct FScratchItem
+	{
+		int32 A;
+		float B;
+	};
+
+	struct FTestScratch
+	{
+		TVoxelSparseScratch<FScratchItem> Items;
+		SIZE_T GetAllocatedSize() const { return Items.GetAllocatedSize(); }
+	};
+
+	/** A sphere of the given radius (voxels) centred in a CS^3 chunk. */
+	static FVoxelMeshingRequest MakeSphereRequest(int32 CS, float Radius, int32 LOD)
+	{
+		FVoxelMeshingRequest R;
+		R.ChunkSize = CS;
+		R.LODLevel = LOD;
+		R.VoxelData.SetNumUninitialized(CS * CS * CS);
+		const float C = CS * 0.5f;
+		for (int32 Z = 0; Z < CS; ++Z)
+		{
+			for (int32 Y = 0; Y < CS; ++Y)
+			{
+				for (int32 X = 0; X < CS; ++X)
+				{
+					const float Dist = FVector3f(X - C, Y - C, Z - C).Size();
+					const float D = FMath::Clamp(0.5f + (Radius - Dist) * 0.25f, 0.0f, 1.0f);
+					R.VoxelData[X + Y * CS + Z * CS * CS] = FVoxelData(1, static_cast<uint8>(FMath::RoundToInt(D * 255.0f)));
+				}
+			}
+		}
+		return R;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMeshingScratchSparseClearTest,
+	"VoxelWorlds.Meshing.Scratch.SparseClear",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshingScratchSparseClearTest::RunTest(const FString& Parameters)
+{
+	using namespace MeshingScratchTestUtils;
+
+	TVoxelSparseScratch<FScratchItem> Scratch;
+	TArray<FScratchItem>& First = Scratch.Acquire(100);
+	TestTrue(TEXT("first acquire sized"), First.Num() >= 100);
+	for (const int32 Index : { 3, 50, 99 })
+	{
+		First[Index] = { Index, 1.0f };
+		Scratch.MarkWritten(Index);
+	}
+	First[7] = { 7, 1.0f };
+	Scratch.GetWrittenIndices().Add(7);
+
+	TArray<FScratchItem>& Second = Scratch.Acquire(64);
+	TestTrue(TEXT("buffer reused, not shrunk"), &Second == &First && Second.Num() >= 100);
+	bool bAllZero = true;
+	for (const FScratchItem& Item : Second)
+	{
+		bAllZero &= Item.A == 0 && Item.B == 0.0f;
+	}
+	TestTrue(TEXT("written entries cleared"), bAllZero);
+	TestEqual(TEXT("written list reset"), Scratch.GetWrittenIndices().Num(), 0);
+
+	// Thread arena: reused across scopes; a nested scope falls back to a temporary arena.
+	FTestScratch* FirstLease = nullptr;
+	{
+		TVoxelScratchScope<FTestScratch> Outer(EVoxelScratchUser::DualContour);
+		FirstLease = &*Outer;
+		Outer->Items.Acquire(10);
+		{
+			TVoxelScratchScope<FTestScratch> Inner(EVoxelScratchUser::DualContour);
+			TestTrue(TEXT("re-entrant scope gets its own arena"), &*Inner != FirstLease);
+		}
+	}
+	{
+		TVoxelScratchScope<FTestScratch> Again(EVoxelScratchUser::DualContour);
+		TestTrue(TEXT("thread arena reused"), &*Again == FirstLease && Again->GetAllocatedSize() > 0);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMeshingScratchDualContourReuseTest,
+	"VoxelWorlds.Meshing.Scratch.DualContourReuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMeshingScratchDualContourReuseTest::RunTest(const FString& Parameters)
+{
+	using namespace MeshingScratchTestUtils;
+
+	FVoxelCPUDualContourMesher Mesher;
+	Mesher.Initialize();
+	FVoxelMeshingConfig Config;
+	Config.bUseSmoothMeshing = true;
+	Config.IsoLevel = 0.5f;
+	Config.bGenerateSkirts = false;
+	Mesher.SetConfig(Config);
+
+	const FVoxelMeshingRequest Small = MakeSphereRequest(32, 6.0f, 0);
+	const FVoxelMeshingRequest Large = MakeSphereRequest(32, 13.0f, 0);
+	const FVoxelMeshingRequest Coarse = MakeSphereRequest(32, 13.0f, 1);
+
+	FChunkMeshData Cold;
+	TestTrue(TEXT("cold mesh"), Mesher.GenerateMeshCPU(Small, Cold) && Cold.Positions.Num() > 0);
+
+	// Dirty the arena with a bigger surface and a different grid size, then mesh Small again.
+	FChunkMeshData Scratch1, Scratch2, Warm;
+	Mesher.GenerateMeshCPU(Large, Scratch1);
+	Mesher.GenerateMeshCPU(Coarse, Scratch2);
+	TestTrue(TEXT("warm mesh"), Mesher.GenerateMeshCPU(Small, Warm));
+
+	TestTrue(TEXT("warm arena reproduces the cold mesh"),
+		Cold.Positions == Warm.Positions && Cold.Normals == Warm.Normals && Cold.Indices == Warm.Indices);
+
+	const FVoxelMeshingScratchStats Stats = FVoxelMeshingScratchStats::Get();
+	const FVoxelMeshingScratchStats::FRow& Row = Stats.Rows[static_cast<int32>(EVoxelScratchUser::DualContour)];
+	TestTrue(TEXT("DC arena high-water recorded"), Row.HighWaterBytes > 0 && Row.Uses >= 4);
+
+	Mesher.Shutdown();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
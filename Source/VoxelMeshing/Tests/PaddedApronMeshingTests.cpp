@@ -0,0 +1,269 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelCPUDualContourMesher.h"
+#include "VoxelCPUMarchingCubesMesher.h"
+#include "VoxelMeshingTypes.h"
+#include "ChunkRenderData.h"
+#include "VoxelData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Padded apron request layout (voxel.Meshing.PaddedApron).
+// Checks AssemblePaddedVolume against the 3x3x3 neighborhood it was built from
+// (present neighbors, both absent-neighbor fills, clamping past the apron), and
+// that the CPU DC / MC meshers produce bit-identical meshes from the padded
+// volume and from the legacy per-face / edge / corner slice arrays at LOD 0.
+// ---------------------------------------------------------------------------
+
+namespace PaddedApronTestUtils
+{
+	using FSampler = TFunctionRef<FVoxelData(int32, int32, int32)>;
+
+	/** Chunk at offset (DX, DY, DZ) of the test neighborhood, sampled from a global-voxel function. */
+	static TSharedPtr<const TArray<FVoxelData>> MakeChunk(int32 CS, int32 DX, int32 DY, int32 DZ, FSampler World)
+	{
+		TSharedPtr<TArray<FVoxelData>> Voxels = MakeShared<TArray<FVoxelData>>();
+		Voxels->SetNumUninitialized(CS * CS * CS);
+		for (int32 Z = 0; Z < CS; ++Z)
+		{
+			for (int32 Y = 0; Y < CS; ++Y)
+			{
+				for (int32 X = 0; X < CS; ++X)
+				{
+					(*Voxels)[X + Y * CS + Z * CS * CS] = World(DX * CS + X, DY * CS + Y, DZ * CS + Z);
+				}
+			}
+		}
+		return Voxels;
+	}
+
+	/** Voxel unique enough per position that a misplaced row copy shows up. */
+	static FVoxelData Pattern(int32 X, int32 Y, int32 Z)
+	{
+		return FVoxelData(static_cast<uint8>(X + Y * 3 + Z * 5 + 64), static_cast<uint8>(X * 7 + Y * 13 + Z * 29 + 128), 1, 0);
+	}
+
+	/** Slanted height field with a smooth density ramp, crossing every chunk boundary. */
+	static FVoxelData Terrain(int32 X, int32 Y, int32 Z)
+	{
+		const float H = 14.0f + X * 0.3f + Y * 0.2f;
+		const float D = FMath::Clamp(0.5f + (H - Z) * 0.25f, 0.0f, 1.0f);
+		return FVoxelData(1, static_cast<uint8>(FMath::RoundToInt(D * 255.0f)));
+	}
+
+	/** Padded request for the centre chunk; neighbors for which Present() is false are left out. */
+	static FVoxelMeshingRequest MakePaddedRequest(int32 CS, int32 Apron, EVoxelApronFill Fill, FSampler World,
+		TFunctionRef<bool(int32, int32, int32)> Present)
+	{
+		FVoxelMeshingRequest R;
+		R.ChunkSize = CS;
+		R.SharedVoxelData = MakeChunk(CS, 0, 0, 0, World);
+		R.PaddedApron = Apron;
+		R.PaddedFill = Fill;
+		for (int32 DZ = -1; DZ <= 1; ++DZ)
+		for (int32 DY = -1; DY <= 1; ++DY)
+		for (int32 DX = -1; DX <= 1; ++DX)
+		{
+			if ((DX != 0 || DY != 0 || DZ != 0) && Present(DX, DY, DZ))
+			{
+				R.PaddedSources[FVoxelMeshingRequest::GetPaddedSlot(DX, DY, DZ)] = MakeChunk(CS, DX, DY, DZ, World);
+			}
+		}
+		R.UpdatePaddedPresence();
+		R.AssemblePaddedVolume();
+		return R;
+	}
+
+	/** Legacy LOD 0 request: single-plane face slices, edge strips and corners, as VoxelNeighborSlices::Extract fills them. */
+	static FVoxelMeshingRequest MakeLegacyRequest(int32 CS, FSampler World, TFunctionRef<bool(int32, int32, int32)> Present)
+	{
+		FVoxelMeshingRequest R;
+		R.ChunkSize = CS;
+		R.SharedVoxelData = MakeChunk(CS, 0, 0, 0, World);
+		const int32 N = CS;
+
+		auto Face = [&](TArray<FVoxelData>& Slice, int32 DX, int32 DY, int32 DZ)
+		{
+			if (!Present(DX, DY, DZ))
+			{
+				return;
+			}
+			Slice.SetNumUninitialized(N * N);
+			for (int32 B = 0; B < N; ++B)
+			{
+				for (int32 A = 0; A < N; ++A)
+				{
+					// In-plane index is (first free axis) + (second free axis) * N.
+					const int32 X = DX > 0 ? N : (DX < 0 ? -1 : A);
+					const int32 Y = DY > 0 ? N : (DY < 0 ? -1 : (DX != 0 ? A : B));
+					const int32 Z = DZ > 0 ? N : (DZ < 0 ? -1 : B);
+					Slice[A + B * N] = World(X, Y, Z);
+				}
+			}
+		};
+		Face(R.NeighborXPos, 1, 0, 0);  Face(R.NeighborXNeg, -1, 0, 0);
+		Face(R.NeighborYPos, 0, 1, 0);  Face(R.NeighborYNeg, 0, -1, 0);
+		Face(R.NeighborZPos, 0, 0, 1);  Face(R.NeighborZNeg, 0, 0, -1);
+
+		auto Edge = [&](TArray<FVoxelData>& Strip, uint32 Flag, int32 DX, int32 DY, int32 DZ)
+		{
+			if (!Present(DX, DY, DZ))
+			{
+				return;
+			}
+			Strip.SetNumUninitialized(N);
+			for (int32 F = 0; F < N; ++F)
+			{
+				const int32 X = DX > 0 ? N : (DX < 0 ? -1 : F);
+				const int32 Y = DY > 0 ? N : (DY < 0 ? -1 : F);
+				const int32 Z = DZ > 0 ? N : (DZ < 0 ? -1 : F);
+				Strip[F] = World(X, Y, Z);
+			}
+			R.EdgeCornerFlags |= Flag;
+		};
+		Edge(R.EdgeXPosYPos, FVoxelMeshingRequest::EDGE_XPOS_YPOS, 1, 1, 0);
+		Edge(R.EdgeXPosYNeg, FVoxelMeshingRequest::EDGE_XPOS_YNEG, 1, -1, 0);
+		Edge(R.EdgeXNegYPos, FVoxelMeshingRequest::EDGE_XNEG_YPOS, -1, 1, 0);
+		Edge(R.EdgeXNegYNeg, FVoxelMeshingRequest::EDGE_XNEG_YNEG, -1, -1, 0);
+		Edge(R.EdgeXPosZPos, FVoxelMeshingRequest::EDGE_XPOS_ZPOS, 1, 0, 1);
+		Edge(R.EdgeXPosZNeg, FVoxelMeshingRequest::EDGE_XPOS_ZNEG, 1, 0, -1);
+		Edge(R.EdgeXNegZPos, FVoxelMeshingRequest::EDGE_XNEG_ZPOS, -1, 0, 1);
+		Edge(R.EdgeXNegZNeg, FVoxelMeshingRequest::EDGE_XNEG_ZNEG, -1, 0, -1);
+		Edge(R.EdgeYPosZPos, FVoxelMeshingRequest::EDGE_YPOS_ZPOS, 0, 1, 1);
+		Edge(R.EdgeYPosZNeg, FVoxelMeshingRequest::EDGE_YPOS_ZNEG, 0, 1, -1);
+		Edge(R.EdgeYNegZPos, FVoxelMeshingRequest::EDGE_YNEG_ZPOS, 0, -1, 1);
+		Edge(R.EdgeYNegZNeg, FVoxelMeshingRequest::EDGE_YNEG_ZNEG, 0, -1, -1);
+
+		auto Corner = [&](FVoxelData& Voxel, uint32 Flag, int32 DX, int32 DY, int32 DZ)
+		{
+			if (Present(DX, DY, DZ))
+			{
+				Voxel = World(DX > 0 ? N : -1, DY > 0 ? N : -1, DZ > 0 ? N : -1);
+				R.EdgeCornerFlags |= Flag;
+			}
+		};
+		Corner(R.CornerXPosYPosZPos, FVoxelMeshingRequest::CORNER_XPOS_YPOS_ZPOS, 1, 1, 1);
+		Corner(R.CornerXPosYPosZNeg, FVoxelMeshingRequest::CORNER_XPOS_YPOS_ZNEG, 1, 1, -1);
+		Corner(R.CornerXPosYNegZPos, FVoxelMeshingRequest::CORNER_XPOS_YNEG_ZPOS, 1, -1, 1);
+		Corner(R.CornerXPosYNegZNeg, FVoxelMeshingRequest::CORNER_XPOS_YNEG_ZNEG, 1, -1, -1);
+		Corner(R.CornerXNegYPosZPos, FVoxelMeshingRequest::CORNER_XNEG_YPOS_ZPOS, -1, 1, 1);
+		Corner(R.CornerXNegYPosZNeg, FVoxelMeshingRequest::CORNER_XNEG_YPOS_ZNEG, -1, 1, -1);
+		Corner(R.CornerXNegYNegZPos, FVoxelMeshingRequest::CORNER_XNEG_YNEG_ZPOS, -1, -1, 1);
+		Corner(R.CornerXNegYNegZNeg, FVoxelMeshingRequest::CORNER_XNEG_YNEG_ZNEG, -1, -1, -1);
+		return R;
+	}
+
+	static FVoxelMeshingConfig MakeConfig()
+	{
+		FVoxelMeshingConfig Config;
+		Config.bUseSmoothMeshing = true;
+		Config.IsoLevel = 0.5f;
+		Config.bUseTransvoxel = true;
+		Config.bGenerateSkirts = false;
+		return Config;
+	}
+
+	static bool SameMesh(const FChunkMeshData& A, const FChunkMeshData& B)
+	{
+		return A.Positions == B.Positions && A.Normals == B.Normals && A.Indices == B.Indices;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPaddedApronVolumeTest,
+	"VoxelWorlds.Meshing.PaddedApron.VolumeMatchesNeighborhood",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPaddedApronVolumeTest::RunTest(const FString& Parameters)
+{
+	using namespace PaddedApronTestUtils;
+
+	constexpr int32 CS = 8;
+	constexpr int32 Apron = 3;
+	// Everything below the chunk (DZ == -1) is absent.
+	auto Present = [](int32 DX, int32 DY, int32 DZ) { return DZ >= 0; };
+
+	for (const EVoxelApronFill Fill : { EVoxelApronFill::Air, EVoxelApronFill::ClampToChunk })
+	{
+		const FVoxelMeshingRequest R = MakePaddedRequest(CS, Apron, Fill, Pattern, Present);
+
+		TestTrue(TEXT("volume assembled"), R.HasPaddedVolume() && R.PaddedVoxels.Num() == FMath::Cube(CS + 2 * Apron));
+		TestTrue(TEXT("sources released"), !R.PaddedSources[FVoxelMeshingRequest::GetPaddedSlot(1, 0, 0)].IsValid());
+		TestTrue(TEXT("present face"), R.HasNeighbor(4) && R.HasNeighbor(0) && R.HasNeighbor(1));
+		TestTrue(TEXT("absent face"), !R.HasNeighbor(5));
+		TestTrue(TEXT("present edge / corner"), R.HasEdge(FVoxelMeshingRequest::EDGE_XPOS_ZPOS)
+			&& R.HasCorner(FVoxelMeshingRequest::CORNER_XNEG_YNEG_ZPOS));
+		TestTrue(TEXT("absent edge / corner"), !R.HasEdge(FVoxelMeshingRequest::EDGE_YNEG_ZNEG)
+			&& !R.HasCorner(FVoxelMeshingRequest::CORNER_XPOS_YPOS_ZNEG));
+
+		int32 Mismatches = 0;
+		for (int32 Z = -Apron; Z < CS + Apron; ++Z)
+		{
+			for (int32 Y = -Apron; Y < CS + Apron; ++Y)
+			{
+				for (int32 X = -Apron; X < CS + Apron; ++X)
+				{
+					FVoxelData Expected = Pattern(X, Y, Z);
+					if (Z < 0)
+					{
+						Expected = (Fill == EVoxelApronFill::Air) ? FVoxelData::Air()
+							: Pattern(FMath::Clamp(X, 0, CS - 1), FMath::Clamp(Y, 0, CS - 1), 0);
+					}
+					Mismatches += (R.GetPaddedVoxel(X, Y, Z) == Expected) ? 0 : 1;
+				}
+			}
+		}
+		TestEqual(TEXT("padded voxels match the neighborhood"), Mismatches, 0);
+
+		TestTrue(TEXT("reads past the apron clamp to its outer layer"),
+			R.GetPaddedVoxel(CS + 10, 2, 3) == R.GetPaddedVoxel(CS + Apron - 1, 2, 3)
+			&& R.GetPaddedVoxel(1, -20, 2) == R.GetPaddedVoxel(1, -Apron, 2));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPaddedApronMesherParityTest,
+	"VoxelWorlds.Meshing.PaddedApron.MesherParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPaddedApronMesherParityTest::RunTest(const FString& Parameters)
+{
+	using namespace PaddedApronTestUtils;
+
+	constexpr int32 CS = 16;
+	const FVoxelMeshingConfig Config = MakeConfig();
+
+	FVoxelCPUDualContourMesher DC;
+	DC.Initialize();
+	DC.SetConfig(Config);
+	FVoxelCPUMarchingCubesMesher MC;
+	MC.Initialize();
+	MC.SetConfig(Config);
+
+	// Full neighborhood, and one with the whole +X side missing (exercises each mesher's fallback).
+	for (const bool bMissingXPos : { false, true })
+	{
+		auto Present = [bMissingXPos](int32 DX, int32 DY, int32 DZ) { return !(bMissingXPos && DX > 0); };
+		const FVoxelMeshingRequest Legacy = MakeLegacyRequest(CS, Terrain, Present);
+
+		FChunkMeshData LegacyDC, PaddedDC;
+		const FVoxelMeshingRequest PaddedForDC = MakePaddedRequest(CS, 1, EVoxelApronFill::Air, Terrain, Present);
+		TestTrue(TEXT("DC legacy meshes"), DC.GenerateMeshCPU(Legacy, LegacyDC) && LegacyDC.Positions.Num() > 0);
+		TestTrue(TEXT("DC padded meshes"), DC.GenerateMeshCPU(PaddedForDC, PaddedDC));
+		TestTrue(bMissingXPos ? TEXT("DC parity (missing +X)") : TEXT("DC parity"), SameMesh(LegacyDC, PaddedDC));
+
+		FChunkMeshData LegacyMC, PaddedMC;
+		const FVoxelMeshingRequest PaddedForMC = MakePaddedRequest(CS, 1, EVoxelApronFill::ClampToChunk, Terrain, Present);
+		TestTrue(TEXT("MC legacy meshes"), MC.GenerateMeshCPU(Legacy, LegacyMC) && LegacyMC.Positions.Num() > 0);
+		TestTrue(TEXT("MC padded meshes"), MC.GenerateMeshCPU(PaddedForMC, PaddedMC));
+		TestTrue(bMissingXPos ? TEXT("MC parity (missing +X)") : TEXT("MC parity"), SameMesh(LegacyMC, PaddedMC));
+	}
+
+	DC.Shutdown();
+	MC.Shutdown();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
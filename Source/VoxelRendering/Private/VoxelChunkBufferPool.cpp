@@ -0,0 +1,394 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelChunkBufferPool.h"
+#include "VoxelRendering.h"
+#include "RHICommandList.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarVoxelChunkBufferPool(
+	TEXT("voxel.Render.ChunkBufferPool"),
+	1,
+	TEXT("Suballocate batched terrain chunk meshes out of shared pooled GPU buffers.\n")
+	TEXT("Pooled indices are rebased into the page's index buffer. With voxel.Render.Index16 on, pages are\n")
+	TEXT("capped at 65536 vertices so the rebased indices stay 16-bit; chunk meshes larger than that use\n")
+	TEXT("dedicated 32-bit buffers. With Index16 off, pages use 32-bit indices at the full page size.\n")
+	TEXT("  0 = dedicated buffers and vertex factory per chunk\n")
+	TEXT("  1 = pooled pages (default)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarVoxelChunkPoolPageVertices(
+	TEXT("voxel.Render.ChunkPoolPageVertices"),
+	262144,
+	TEXT("Vertex capacity of each chunk buffer pool page (index capacity: voxel.Render.ChunkPoolIndicesPerVertex).\n")
+	TEXT("Capped at 65536 while voxel.Render.Index16 is on (16-bit page indices).\n")
+	TEXT("Read when a page is created. Meshes larger than a page use dedicated buffers."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarVoxelChunkPoolIndicesPerVertex(
+	TEXT("voxel.Render.ChunkPoolIndicesPerVertex"),
+	6,
+	TEXT("Index capacity of each chunk buffer pool page, per page vertex. Smooth (MC/DC) meshes index\n")
+	TEXT("~6 indices per vertex, cubic meshes 1.5; a page whose index range fills first strands its\n")
+	TEXT("vertex range. Read when a page is created."),
+	ECVF_Default);
+
+namespace VoxelChunkBufferPool
+{
+	/** Allocation granularities: whole cache-friendly vertex runs, whole triangles */
+	constexpr uint32 VertexGranularity = 32;
+	constexpr uint32 IndexGranularity = 96;
+
+	/** Interleaved TangentX + TangentZ, matching the per-chunk tangent SRV layout */
+	struct FPackedTangentPair
+	{
+		FPackedNormal TangentX;
+		FPackedNormal TangentZ;
+	};
+
+	constexpr uint32 BytesPerVertex = sizeof(FVoxelLocalVertex) + sizeof(FColor) + sizeof(FPackedTangentPair) + sizeof(FVector4f);
+
+	/** Largest page whose rebased indices still fit in 16 bits */
+	constexpr uint32 MaxIndex16PageVertices = 65536;
+
+	static uint32 GetPageVertices()
+	{
+		const uint32 Requested = static_cast<uint32>(FMath::Clamp(CVarVoxelChunkPoolPageVertices.GetValueOnAnyThread(), 4096, 4 * 1024 * 1024));
+		return GetVoxelIndexStride(MaxIndex16PageVertices) == sizeof(uint16) ? FMath::Min(Requested, MaxIndex16PageVertices) : Requested;
+	}
+
+	static uint32 GetPageIndices()
+	{
+		return GetPageVertices() * static_cast<uint32>(FMath::Clamp(CVarVoxelChunkPoolIndicesPerVertex.GetValueOnAnyThread(), 1, 12));
+	}
+}
+
+// ==================== FPage ====================
+
+SIZE_T FVoxelChunkBufferPool::FPage::GetReservedBytes() const
+{
+	using namespace VoxelChunkBufferPool;
+	return static_cast<SIZE_T>(VertexAllocator.GetCapacity()) * BytesPerVertex
+		+ static_cast<SIZE_T>(IndexAllocator.GetCapacity()) * IndexStride;
+}
+
+void FVoxelChunkBufferPool::FPage::ReleaseResources()
+{
+	if (VertexFactory.IsValid())
+	{
+		VertexFactory->ReleaseResource();
+		VertexFactory.Reset();
+	}
+	if (IndexBuffer.IsValid())
+	{
+		IndexBuffer->ReleaseResource();
+		IndexBuffer.Reset();
+	}
+	if (VertexBuffer.IsValid())
+	{
+		VertexBuffer->ReleaseResource();
+		VertexBuffer.Reset();
+	}
+	TexCoordSRV.SafeRelease();
+	TangentsSRV.SafeRelease();
+	ColorSRV.SafeRelease();
+	TexCoordBufferRHI.SafeRelease();
+	TangentBufferRHI.SafeRelease();
+	ColorBufferRHI.SafeRelease();
+	VertexBufferRHI.SafeRelease();
+	IndexBufferRHI.SafeRelease();
+}
+
+// ==================== FVoxelChunkBufferPool ====================
+
+FVoxelChunkBufferPool::FVoxelChunkBufferPool(ERHIFeatureLevel::Type InFeatureLevel)
+	: FeatureLevel(InFeatureLevel)
+{
+}
+
+FVoxelChunkBufferPool::~FVoxelChunkBufferPool()
+{
+	ReleaseAll();
+}
+
+bool FVoxelChunkBufferPool::IsEnabled()
+{
+	return CVarVoxelChunkBufferPool.GetValueOnAnyThread() != 0;
+}
+
+int32 FVoxelChunkBufferPool::CreatePage(FRHICommandListBase& RHICmdList)
+{
+	using namespace VoxelChunkBufferPool;
+
+	const uint32 PageVertices = GetPageVertices();
+	const uint32 PageIndices = GetPageIndices();
+
+	TUniquePtr<FPage> Page = MakeUnique<FPage>();
+	Page->VertexAllocator.Reset(PageVertices, VertexGranularity);
+	Page->IndexAllocator.Reset(PageIndices, IndexGranularity);
+
+	const uint32 VertexCapacity = Page->VertexAllocator.GetCapacity();
+	const uint32 IndexCapacity = Page->IndexAllocator.GetCapacity();
+	Page->IndexStride = GetVoxelIndexStride(VertexCapacity);
+
+	Page->VertexBufferRHI = RHICmdList.CreateBuffer(
+		FRHIBufferCreateDesc::Create(TEXT("VoxelChunkPool_Vertices"), VertexCapacity * sizeof(FVoxelLocalVertex), sizeof(FVoxelLocalVertex), BUF_Static | BUF_VertexBuffer)
+			.SetInitialState(ERHIAccess::VertexOrIndexBuffer));
+
+	Page->ColorBufferRHI = RHICmdList.CreateBuffer(
+		FRHIBufferCreateDesc::Create(TEXT("VoxelChunkPool_Colors"), VertexCapacity * sizeof(FColor), sizeof(FColor), BUF_Static | BUF_ShaderResource)
+			.SetInitialState(ERHIAccess::SRVMask));
+	Page->ColorSRV = RHICmdList.CreateShaderResourceView(Page->ColorBufferRHI, FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(PF_B8G8R8A8));
+
+	Page->TangentBufferRHI = RHICmdList.CreateBuffer(
+		FRHIBufferCreateDesc::Create(TEXT("VoxelChunkPool_Tangents"), VertexCapacity * sizeof(FPackedTangentPair), sizeof(FPackedTangentPair), BUF_Static | BUF_ShaderResource)
+			.SetInitialState(ERHIAccess::SRVMask));
+	Page->TangentsSRV = RHICmdList.CreateShaderResourceView(Page->TangentBufferRHI, FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(PF_R8G8B8A8_SNORM));
+
+	Page->TexCoordBufferRHI = RHICmdList.CreateBuffer(
+		FRHIBufferCreateDesc::Create(TEXT("VoxelChunkPool_TexCoords"), VertexCapacity * sizeof(FVector4f), sizeof(FVector4f), BUF_Static | BUF_ShaderResource)
+			.SetInitialState(ERHIAccess::SRVMask));
+	Page->TexCoordSRV = RHICmdList.CreateShaderResourceView(Page->TexCoordBufferRHI, FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(PF_G32R32F));
+
+	Page->IndexBufferRHI = RHICmdList.CreateBuffer(
+		FRHIBufferCreateDesc::Create(TEXT("VoxelChunkPool_Indices"), IndexCapacity * Page->IndexStride, Page->IndexStride, BUF_Static | BUF_IndexBuffer)
+			.SetInitialState(ERHIAccess::VertexOrIndexBuffer));
+
+	Page->VertexBuffer = MakeShared<FVoxelLocalVertexBuffer>();
+	Page->VertexBuffer->InitWithRHIBuffer(Page->VertexBufferRHI);
+	Page->VertexBuffer->InitResource(RHICmdList);
+
+	Page->IndexBuffer = MakeShared<FVoxelLocalIndexBuffer>();
+	Page->IndexBuffer->InitWithRHIBuffer(Page->IndexBufferRHI, IndexCapacity);
+	Page->IndexBuffer->InitResource(RHICmdList);
+
+	Page->VertexFactory = MakeShared<FLocalVertexFactory>(FeatureLevel, "FVoxelChunkVertexFactory_Pool");
+	InitVoxelLocalVertexFactory(
+		RHICmdList,
+		Page->VertexFactory.Get(),
+		Page->VertexBuffer.Get(),
+		Page->ColorSRV,
+		Page->TangentsSRV,
+		Page->TexCoordSRV);
+	Page->VertexFactory->InitResource(RHICmdList);
+
+	int32 PageIndex = Pages.IndexOfByPredicate([](const TUniquePtr<FPage>& Slot) { return !Slot.IsValid(); });
+	if (PageIndex == INDEX_NONE)
+	{
+		PageIndex = Pages.AddDefaulted();
+	}
+	Pages[PageIndex] = MoveTemp(Page);
+
+	UE_LOG(LogVoxelRendering, Log, TEXT("FVoxelChunkBufferPool: Created page %d (%u vertices, %u %u-bit indices, %.1f MB)"),
+		PageIndex, VertexCapacity, IndexCapacity, Pages[PageIndex]->IndexStride * 8, Pages[PageIndex]->GetReservedBytes() / (1024.0 * 1024.0));
+
+	return PageIndex;
+}
+
+bool FVoxelChunkBufferPool::AllocateAndUpload(
+	FRHICommandListBase& RHICmdList,
+	TConstArrayView<FVoxelLocalVertex> Vertices,
+	TConstArrayView<uint32> Indices,
+	FVoxelChunkRenderData& OutRenderData)
+{
+	using namespace VoxelChunkBufferPool;
+
+	const uint32 VertexCount = Vertices.Num();
+	const uint32 IndexCount = Indices.Num();
+	if (VertexCount == 0 || IndexCount == 0)
+	{
+		return false;
+	}
+
+	// First page with room for both ranges, else a fresh page
+	int32 PageIndex = INDEX_NONE;
+	uint32 BaseVertex = FVoxelRangeAllocator::InvalidOffset;
+	uint32 FirstIndex = FVoxelRangeAllocator::InvalidOffset;
+	for (int32 Index = 0; Index < Pages.Num() && PageIndex == INDEX_NONE; ++Index)
+	{
+		FPage* Page = Pages[Index].Get();
+		if (!Page)
+		{
+			continue;
+		}
+		BaseVertex = Page->VertexAllocator.Allocate(VertexCount);
+		if (BaseVertex == FVoxelRangeAllocator::InvalidOffset)
+		{
+			continue;
+		}
+		FirstIndex = Page->IndexAllocator.Allocate(IndexCount);
+		if (FirstIndex == FVoxelRangeAllocator::InvalidOffset)
+		{
+			Page->VertexAllocator.Free(BaseVertex);
+			continue;
+		}
+		PageIndex = Index;
+	}
+
+	if (PageIndex == INDEX_NONE)
+	{
+		// Larger than a whole page: leave it to dedicated buffers
+		if (Align(VertexCount, VertexGranularity) > GetPageVertices() || Align(IndexCount, IndexGranularity) > GetPageIndices())
+		{
+			return false;
+		}
+
+		const int32 NewPage = CreatePage(RHICmdList);
+		FPage& Page = *Pages[NewPage];
+		BaseVertex = Page.VertexAllocator.Allocate(VertexCount);
+		FirstIndex = Page.IndexAllocator.Allocate(IndexCount);
+		check(BaseVertex != FVoxelRangeAllocator::InvalidOffset && FirstIndex != FVoxelRangeAllocator::InvalidOffset);
+		PageIndex = NewPage;
+	}
+
+	FPage& Page = *Pages[PageIndex];
+
+	// Sub-range uploads, one pass per stream straight into the locked memory
+	FVoxelLocalVertex* VertexData = static_cast<FVoxelLocalVertex*>(RHICmdList.LockBuffer(
+		Page.VertexBufferRHI, BaseVertex * sizeof(FVoxelLocalVertex), VertexCount * sizeof(FVoxelLocalVertex), RLM_WriteOnly));
+	FMemory::Memcpy(VertexData, Vertices.GetData(), VertexCount * sizeof(FVoxelLocalVertex));
+	RHICmdList.UnlockBuffer(Page.VertexBufferRHI);
+
+	FColor* ColorData = static_cast<FColor*>(RHICmdList.LockBuffer(
+		Page.ColorBufferRHI, BaseVertex * sizeof(FColor), VertexCount * sizeof(FColor), RLM_WriteOnly));
+	for (uint32 i = 0; i < VertexCount; ++i)
+	{
+		ColorData[i] = Vertices[i].Color;
+	}
+	RHICmdList.UnlockBuffer(Page.ColorBufferRHI);
+
+	FPackedTangentPair* TangentData = static_cast<FPackedTangentPair*>(RHICmdList.LockBuffer(
+		Page.TangentBufferRHI, BaseVertex * sizeof(FPackedTangentPair), VertexCount * sizeof(FPackedTangentPair), RLM_WriteOnly));
+	for (uint32 i = 0; i < VertexCount; ++i)
+	{
+		TangentData[i].TangentX = Vertices[i].TangentX;
+		TangentData[i].TangentZ = Vertices[i].TangentZ;
+	}
+	RHICmdList.UnlockBuffer(Page.TangentBufferRHI);
+
+	FVector4f* TexCoordData = static_cast<FVector4f*>(RHICmdList.LockBuffer(
+		Page.TexCoordBufferRHI, BaseVertex * sizeof(FVector4f), VertexCount * sizeof(FVector4f), RLM_WriteOnly));
+	for (uint32 i = 0; i < VertexCount; ++i)
+	{
+		TexCoordData[i] = FVector4f(Vertices[i].TexCoord.X, Vertices[i].TexCoord.Y, Vertices[i].TexCoord1.X, Vertices[i].TexCoord1.Y);
+	}
+	RHICmdList.UnlockBuffer(Page.TexCoordBufferRHI);
+
+	// Rebased indices fit the page's stride: a 16-bit page holds at most 65536 vertices
+	void* IndexData = RHICmdList.LockBuffer(
+		Page.IndexBufferRHI, FirstIndex * Page.IndexStride, IndexCount * Page.IndexStride, RLM_WriteOnly);
+	if (Page.IndexStride == sizeof(uint16))
+	{
+		uint16* IndexData16 = static_cast<uint16*>(IndexData);
+		for (uint32 i = 0; i < IndexCount; ++i)
+		{
+			IndexData16[i] = static_cast<uint16>(Indices[i] + BaseVertex);
+		}
+	}
+	else
+	{
+		uint32* IndexData32 = static_cast<uint32*>(IndexData);
+		for (uint32 i = 0; i < IndexCount; ++i)
+		{
+			IndexData32[i] = Indices[i] + BaseVertex;
+		}
+	}
+	RHICmdList.UnlockBuffer(Page.IndexBufferRHI);
+
+	OutRenderData.PoolPageIndex = PageIndex;
+	OutRenderData.BaseVertexIndex = BaseVertex;
+	OutRenderData.FirstIndex = FirstIndex;
+	OutRenderData.IndexStride = Page.IndexStride;
+	OutRenderData.VertexBufferRHI = Page.VertexBufferRHI;
+	OutRenderData.IndexBufferRHI = Page.IndexBufferRHI;
+	OutRenderData.ColorBufferRHI = Page.ColorBufferRHI;
+	OutRenderData.ColorSRV = Page.ColorSRV;
+	OutRenderData.TangentBufferRHI = Page.TangentBufferRHI;
+	OutRenderData.TangentsSRV = Page.TangentsSRV;
+	OutRenderData.TexCoordBufferRHI = Page.TexCoordBufferRHI;
+	OutRenderData.TexCoordSRV = Page.TexCoordSRV;
+	bStatsDirty = true;
+	return true;
+}
+
+void FVoxelChunkBufferPool::Free(const FVoxelChunkRenderData& RenderData)
+{
+	if (!RenderData.IsPooled() || !Pages.IsValidIndex(RenderData.PoolPageIndex) || !Pages[RenderData.PoolPageIndex].IsValid())
+	{
+		return;
+	}
+
+	FPage& Page = *Pages[RenderData.PoolPageIndex];
+	Page.VertexAllocator.Free(RenderData.BaseVertexIndex);
+	Page.IndexAllocator.Free(RenderData.FirstIndex);
+	bStatsDirty = true;
+
+	// Release an emptied page unless it's the last one (keeps steady-state remeshing allocation-free)
+	if (Page.VertexAllocator.IsEmpty())
+	{
+		int32 NumLivePages = 0;
+		for (const TUniquePtr<FPage>& Slot : Pages)
+		{
+			NumLivePages += Slot.IsValid() ? 1 : 0;
+		}
+		if (NumLivePages > 1)
+		{
+			Page.ReleaseResources();
+			Pages[RenderData.PoolPageIndex].Reset();
+		}
+	}
+}
+
+const FLocalVertexFactory* FVoxelChunkBufferPool::GetVertexFactory(int32 PageIndex) const
+{
+	const FPage* Page = Pages.IsValidIndex(PageIndex) ? Pages[PageIndex].Get() : nullptr;
+	return Page ? Page->VertexFactory.Get() : nullptr;
+}
+
+const FVoxelLocalIndexBuffer* FVoxelChunkBufferPool::GetIndexBuffer(int32 PageIndex) const
+{
+	const FPage* Page = Pages.IsValidIndex(PageIndex) ? Pages[PageIndex].Get() : nullptr;
+	return Page ? Page->IndexBuffer.Get() : nullptr;
+}
+
+void FVoxelChunkBufferPool::ReleaseAll()
+{
+	for (TUniquePtr<FPage>& Page : Pages)
+	{
+		if (Page.IsValid())
+		{
+			Page->ReleaseResources();
+		}
+	}
+	Pages.Empty();
+	bStatsDirty = true;
+}
+
+FVoxelChunkBufferPoolStats FVoxelChunkBufferPool::GetStats() const
+{
+	using namespace VoxelChunkBufferPool;
+
+	if (!bStatsDirty)
+	{
+		return CachedStats;
+	}
+
+	FVoxelChunkBufferPoolStats Stats;
+	for (const TUniquePtr<FPage>& Page : Pages)
+	{
+		if (!Page.IsValid())
+		{
+			continue;
+		}
+		const FVoxelRangeAllocatorStats VertexStats = Page->VertexAllocator.GetStats();
+		const FVoxelRangeAllocatorStats IndexStats = Page->IndexAllocator.GetStats();
+		++Stats.NumPages;
+		Stats.NumChunks += VertexStats.NumAllocations;
+		Stats.ReservedBytes += Page->GetReservedBytes();
+		Stats.UsedBytes += static_cast<SIZE_T>(VertexStats.UsedSize) * BytesPerVertex + static_cast<SIZE_T>(IndexStats.UsedSize) * Page->IndexStride;
+		Stats.Vertices += VertexStats;
+		Stats.Indices += IndexStats;
+	}
+	CachedStats = Stats;
+	bStatsDirty = false;
+	return Stats;
+}
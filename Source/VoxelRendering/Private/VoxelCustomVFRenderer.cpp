@@ -6,12 +6,28 @@
 #include "VoxelWorldConfiguration.h"
 #include "VoxelMaterialAtlas.h"
 #include "VoxelVertex.h"
+#include "VoxelCompactVertex.h"
+#include "VoxelLocalVertexFactory.h"
+#include "VoxelChunkBufferPool.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Materials/MaterialInterface.h"
 #include "VT/RuntimeVirtualTexture.h"
 #include "RHICommandList.h"
 #include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarVoxelCompactVertices(
+	TEXT("voxel.Render.CompactVertices"),
+	0,
+	TEXT("Hand chunk meshes to the render thread as 16-byte quantized vertices (FVoxelCompactVertex).\n")
+	TEXT("CPU -> render thread hand-off format only: the proxy decodes to the 40-byte FVoxelLocalVertex on\n")
+	TEXT("upload (no vertex-factory decode), so GPU vertex memory does not shrink; it only trims the pending\n")
+	TEXT("batch / render command payload, at the cost of a quantize on the mesher and a decode on upload.\n")
+	TEXT("Read by the chunk manager when it creates the mesher.\n")
+	TEXT("  0 = 28-byte FVoxelVertex (default)\n")
+	TEXT("  1 = compact when every UV is the triplanar projection of its position (smooth meshers)"),
+	ECVF_Default);
 
 // ==================== FVoxelCustomVFRenderer ====================
 
@@ -161,6 +177,11 @@ void FVoxelCustomVFRenderer::Shutdown()
 	UE_LOG(LogVoxelRendering, Log, TEXT("FVoxelCustomVFRenderer shutdown"));
 }
 
+bool FVoxelCustomVFRenderer::AcceptsCompactVertices() const
+{
+	return CVarVoxelCompactVertices.GetValueOnGameThread() != 0;
+}
+
 bool FVoxelCustomVFRenderer::IsInitialized() const
 {
 	return bIsInitialized && WorldComponent != nullptr;
@@ -236,8 +257,9 @@ void FVoxelCustomVFRenderer::UpdateChunkMeshFromCPU(
 		RemoveChunk(ChunkCoord);
 		return;
 	}
-	// Caller keeps the mesh data — copy the index buffer
-	SubmitChunkMeshInternal(ChunkCoord, LODLevel, MeshData, TArray<uint32>(MeshData.Indices));
+	// Caller keeps the mesh data — copy the index buffer (and any pre-packed vertices)
+	SubmitChunkMeshInternal(ChunkCoord, LODLevel, MeshData,
+		FVoxelPackedChunkVertices(MeshData.PackedVertices), TArray<uint32>(MeshData.Indices));
 }
 
 void FVoxelCustomVFRenderer::UpdateChunkMeshFromCPU(
@@ -250,15 +272,17 @@ void FVoxelCustomVFRenderer::UpdateChunkMeshFromCPU(
 		RemoveChunk(ChunkCoord);
 		return;
 	}
-	// Caller is done with the mesh data — move the index buffer straight into the pending
-	// batch. (Vertices always need converting to FVoxelVertex, so only indices benefit.)
-	SubmitChunkMeshInternal(ChunkCoord, LODLevel, MeshData, MoveTemp(MeshData.Indices));
+	// Caller is done with the mesh data — move the index buffer, and the vertices when the
+	// mesher packed them, straight into the pending batch.
+	SubmitChunkMeshInternal(ChunkCoord, LODLevel, MeshData,
+		MoveTemp(MeshData.PackedVertices), MoveTemp(MeshData.Indices));
 }
 
 void FVoxelCustomVFRenderer::SubmitChunkMeshInternal(
 	const FIntVector& ChunkCoord,
 	int32 LODLevel,
 	const FChunkMeshData& MeshData,
+	FVoxelPackedChunkVertices&& Packed,
 	TArray<uint32>&& Indices)
 {
 	check(IsInGameThread());
@@ -269,11 +293,33 @@ void FVoxelCustomVFRenderer::SubmitChunkMeshInternal(
 		return;
 	}
 
-	// Convert CPU mesh data to FVoxelVertex array; local bounds are computed in the same pass
-	// (this used to be a second full sweep over the positions)
-	TArray<FVoxelVertex> Vertices;
-	FBox LocalBounds(ForceInit);
-	ConvertToVoxelVertices(MeshData, Vertices, LocalBounds);
+	// Vertices packed by the mesher's worker are taken as-is. Compact ones must sit on this
+	// renderer's lattice and still be wanted; otherwise expand them (rare: cvar flipped mid-run).
+	const bool bAllowCompact = CVarVoxelCompactVertices.GetValueOnGameThread() != 0;
+	if (Packed.GetVertexCount() != MeshData.Positions.Num())
+	{
+		Packed.Reset();
+	}
+	else if (Packed.CompactVertices.Num() > 0
+		&& (!bAllowCompact || Packed.CompactFrame.PositionStep != ChunkWorldSize / FVoxelCompactVertexFrame::StepsPerChunk))
+	{
+		Packed.Vertices.SetNumUninitialized(Packed.CompactVertices.Num());
+		for (int32 i = 0; i < Packed.CompactVertices.Num(); ++i)
+		{
+			Packed.Vertices[i] = Packed.CompactFrame.Decode(Packed.CompactVertices[i]);
+		}
+		Packed.CompactVertices.Empty();
+	}
+
+	// Not packed upstream: quantize to compact vertices when the UVs can be re-derived,
+	// otherwise convert to the FVoxelVertex array (local bounds in the same pass either way).
+	if (!Packed.IsPacked())
+	{
+		FVoxelCompactVertexCodec::Pack(MeshData, ChunkWorldSize, bAllowCompact, Packed);
+	}
+	const bool bCompact = Packed.CompactVertices.Num() > 0;
+	const int32 VertexCount = Packed.GetVertexCount();
+	const FBox LocalBounds = Packed.LocalBounds;
 
 	// Update statistics
 	FChunkStats* ExistingStats = ChunkStatsMap.Find(ChunkCoord);
@@ -285,10 +331,10 @@ void FVoxelCustomVFRenderer::SubmitChunkMeshInternal(
 	}
 
 	FChunkStats& Stats = ChunkStatsMap.FindOrAdd(ChunkCoord);
-	Stats.VertexCount = Vertices.Num();
+	Stats.VertexCount = VertexCount;
 	Stats.TriangleCount = Indices.Num() / 3;
 	Stats.LODLevel = LODLevel;
-	Stats.MemoryUsage = (Vertices.Num() * sizeof(FVoxelVertex)) + (Indices.Num() * sizeof(uint32));
+	Stats.MemoryUsage = (VertexCount * sizeof(FVoxelVertex)) + (Indices.Num() * GetVoxelIndexStride(VertexCount));
 	// Bounds are in local space here, will be offset in scene proxy
 	Stats.Bounds = LocalBounds;
 	Stats.bIsVisible = true;
@@ -302,13 +348,27 @@ void FVoxelCustomVFRenderer::SubmitChunkMeshInternal(
 	// 1. Creating intermediate GPU buffers
 	// 2. Bouncing back to game thread
 	// 3. GPU readback stalls in scene proxy
-	WorldComponent->UpdateChunkBuffersFromCPUData(
-		ChunkCoord,
-		MoveTemp(Vertices),
-		MoveTemp(Indices),
-		LODLevel,
-		LocalBounds
-	);
+	if (bCompact)
+	{
+		WorldComponent->UpdateChunkBuffersFromCPUData(
+			ChunkCoord,
+			MoveTemp(Packed.CompactVertices),
+			Packed.CompactFrame,
+			MoveTemp(Indices),
+			LODLevel,
+			LocalBounds
+		);
+	}
+	else
+	{
+		WorldComponent->UpdateChunkBuffersFromCPUData(
+			ChunkCoord,
+			MoveTemp(Packed.Vertices),
+			MoveTemp(Indices),
+			LODLevel,
+			LocalBounds
+		);
+	}
 
 	UE_LOG(LogVoxelRendering, Verbose, TEXT("FVoxelCustomVFRenderer: Updated chunk %s (DIRECT CPU path) - %d verts, %d tris"),
 		*ChunkCoord.ToString(), Stats.VertexCount, Stats.TriangleCount);
@@ -499,7 +559,7 @@ void FVoxelCustomVFRenderer::UpdateWaterTileMesh(
 	// Convert CPU mesh data to FVoxelVertex array (bounds unused for water tiles)
 	TArray<FVoxelVertex> Vertices;
 	FBox UnusedBounds(ForceInit);
-	ConvertToVoxelVertices(WaterMeshData, Vertices, UnusedBounds);
+	FVoxelCompactVertexCodec::ConvertToVertices(WaterMeshData, Vertices, UnusedBounds);
 
 	// Copy indices
 	TArray<uint32> Indices = WaterMeshData.Indices;
@@ -561,7 +621,7 @@ void FVoxelCustomVFRenderer::UpdateSeamMeshFromCPU(
 	// Convert CPU mesh data to FVoxelVertex array (bounds computed in the proxy for seams)
 	TArray<FVoxelVertex> Vertices;
 	FBox UnusedBounds(ForceInit);
-	ConvertToVoxelVertices(MeshData, Vertices, UnusedBounds);
+	FVoxelCompactVertexCodec::ConvertToVertices(MeshData, Vertices, UnusedBounds);
 
 	// Owner chunk world position — same layout the chunk path uses (WorldOrigin + coord * chunk size)
 	const FVector WorldOrigin = CachedConfig.IsValid() ? CachedConfig->WorldOrigin : FVector::ZeroVector;
@@ -633,8 +693,8 @@ void FVoxelCustomVFRenderer::FlushPendingOperations()
 		return;
 	}
 
-	// Delegate to the world component which batches all pending adds/removes
-	// into a single render command
+	// Delegate to the world component which batches all pending adds/removes and the
+	// frame's recorded seam/water/fade commands into a single command stream packet
 	WorldComponent->FlushPendingOperations();
 }
 
@@ -728,18 +788,39 @@ FBox FVoxelCustomVFRenderer::GetTotalBounds() const
 
 FString FVoxelCustomVFRenderer::GetDebugStats() const
 {
+	const FVoxelChunkBufferPoolStats PoolStats = WorldComponent ? WorldComponent->GetChunkBufferPoolStats() : FVoxelChunkBufferPoolStats();
+	const FVoxelRenderCommandStreamStats StreamStats = WorldComponent ? WorldComponent->GetRenderCommandStreamStats() : FVoxelRenderCommandStreamStats();
+
 	return FString::Printf(
 		TEXT("Custom VF Renderer Stats:\n")
 		TEXT("  Chunks: %d\n")
 		TEXT("  Vertices: %lld\n")
 		TEXT("  Triangles: %lld\n")
 		TEXT("  GPU Memory: %.2f MB\n")
+		TEXT("  Buffer Pool: %d pages, %d chunks, %.2f / %.2f MB used\n")
+		TEXT("  Buffer Pool Vertices: %.1f%% used, %.1f%% fragmented\n")
+		TEXT("  Buffer Pool Indices: %.1f%% used, %.1f%% fragmented\n")
+		TEXT("  Render Commands: %d last drain (%.1f KB), peak %d, %lld total (%.2f MB) over %d drains\n")
 		TEXT("  Voxel Size: %.1f\n")
 		TEXT("  Chunk Size: %.1f"),
 		ChunkStatsMap.Num(),
 		TotalVertexCount,
 		TotalTriangleCount,
 		TotalGPUMemory / (1024.0 * 1024.0),
+		PoolStats.NumPages,
+		PoolStats.NumChunks,
+		PoolStats.UsedBytes / (1024.0 * 1024.0),
+		PoolStats.ReservedBytes / (1024.0 * 1024.0),
+		PoolStats.Vertices.GetUtilization() * 100.0f,
+		PoolStats.Vertices.GetFragmentation() * 100.0f,
+		PoolStats.Indices.GetUtilization() * 100.0f,
+		PoolStats.Indices.GetFragmentation() * 100.0f,
+		StreamStats.LastDrainCommands,
+		StreamStats.LastDrainBytes / 1024.0,
+		StreamStats.PeakDrainCommands,
+		StreamStats.TotalCommands,
+		StreamStats.TotalBytes / (1024.0 * 1024.0),
+		StreamStats.NumDrains,
 		VoxelSize,
 		ChunkWorldSize
 	);
@@ -758,61 +839,6 @@ FString FVoxelCustomVFRenderer::GetRendererTypeName() const
 
 // ==================== Internal Helpers ====================
 
-void FVoxelCustomVFRenderer::ConvertToVoxelVertices(
-	const FChunkMeshData& MeshData,
-	TArray<FVoxelVertex>& OutVertices,
-	FBox& OutLocalBounds)
-{
-	const int32 VertexCount = MeshData.Positions.Num();
-	OutVertices.SetNumUninitialized(VertexCount);
-	OutLocalBounds.Init();
-
-	// Attribute arrays are either full-size or absent — decide once, not per vertex.
-	// (The per-vertex `i < Num()` checks this replaces also handled partially-filled arrays,
-	// which no mesher produces; short arrays now fall back to defaults wholesale.)
-	const bool bHasNormals = MeshData.Normals.Num() >= VertexCount;
-	const bool bHasUVs = MeshData.UVs.Num() >= VertexCount;
-	const bool bHasColors = MeshData.Colors.Num() >= VertexCount;
-
-	FVector3f BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
-	FVector3f BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-	for (int32 i = 0; i < VertexCount; ++i)
-	{
-		FVoxelVertex& Vertex = OutVertices[i];
-
-		// Position + bounds (fused — this loop runs per submitted chunk on the game thread)
-		const FVector3f& Pos = MeshData.Positions[i];
-		Vertex.Position = Pos;
-		BoundsMin = FVector3f::Min(BoundsMin, Pos);
-		BoundsMax = FVector3f::Max(BoundsMax, Pos);
-
-		Vertex.SetNormal(bHasNormals ? MeshData.Normals[i] : FVector3f::UpVector);
-		Vertex.UV = bHasUVs ? MeshData.UVs[i] : FVector2f::ZeroVector;
-
-		// Extract material data from vertex color
-		if (bHasColors)
-		{
-			const FColor& Color = MeshData.Colors[i];
-			Vertex.SetMaterialID(Color.R);
-			Vertex.SetBiomeID(Color.G);
-			Vertex.SetAO(Color.B >> 6); // Top 2 bits of blue channel
-		}
-		else
-		{
-			Vertex.SetMaterialID(0);
-			Vertex.SetBiomeID(0);
-			Vertex.SetAO(0);
-		}
-	}
-
-	if (VertexCount > 0)
-	{
-		OutLocalBounds += FVector(BoundsMin);
-		OutLocalBounds += FVector(BoundsMax);
-	}
-}
-
 FBox FVoxelCustomVFRenderer::CalculateChunkBounds(const FIntVector& ChunkCoord) const
 {
 	const FVector WorldOrigin = CachedConfig.IsValid() ? CachedConfig->WorldOrigin : FVector::ZeroVector;
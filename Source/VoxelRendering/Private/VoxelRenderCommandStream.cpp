@@ -0,0 +1,258 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelRenderCommandStream.h"
+#include "VoxelSceneProxy.h"
+#include "VoxelRendering.h"
+
+// ==================== FVoxelRenderCommandPacket ====================
+
+FVoxelRenderCommand& FVoxelRenderCommandPacket::AddCommand(EVoxelRenderCommand Type)
+{
+	FVoxelRenderCommand& Command = Commands.AddDefaulted_GetRef();
+	Command.Type = Type;
+	return Command;
+}
+
+int32 FVoxelRenderCommandPacket::AddMesh(TArray<FVoxelVertex>&& Vertices, TArray<uint32>&& Indices)
+{
+	PayloadBytes += Vertices.NumBytes() + Indices.NumBytes();
+
+	FMeshPayload& Mesh = Meshes.AddDefaulted_GetRef();
+	Mesh.Vertices = MoveTemp(Vertices);
+	Mesh.Indices = MoveTemp(Indices);
+	return Meshes.Num() - 1;
+}
+
+void FVoxelRenderCommandPacket::ApplyChunkBatch(TArray<FVoxelBatchChunkAdd>&& Adds, TArray<FIntVector>&& Removals)
+{
+	for (const FVoxelBatchChunkAdd& Add : Adds)
+	{
+		PayloadBytes += sizeof(Add) + Add.Vertices.NumBytes() + Add.CompactVertices.NumBytes() + Add.Indices.NumBytes();
+	}
+	PayloadBytes += Removals.NumBytes();
+
+	FChunkBatchPayload& Batch = ChunkBatches.AddDefaulted_GetRef();
+	Batch.Adds = MoveTemp(Adds);
+	Batch.Removals = MoveTemp(Removals);
+	AddCommand(EVoxelRenderCommand::ChunkBatch).PayloadIndex = ChunkBatches.Num() - 1;
+}
+
+void FVoxelRenderCommandPacket::ClearChunks()
+{
+	AddCommand(EVoxelRenderCommand::ClearChunks);
+}
+
+void FVoxelRenderCommandPacket::SetChunkVisible(const FIntVector& ChunkCoord, bool bVisible)
+{
+	FVoxelRenderCommand& Command = AddCommand(EVoxelRenderCommand::SetChunkVisible);
+	Command.ChunkCoord = ChunkCoord;
+	Command.bVisible = bVisible;
+}
+
+void FVoxelRenderCommandPacket::SetChunkMorphFactor(const FIntVector& ChunkCoord, float MorphFactor)
+{
+	FVoxelRenderCommand& Command = AddCommand(EVoxelRenderCommand::SetChunkMorphFactor);
+	Command.ChunkCoord = ChunkCoord;
+	Command.Value = MorphFactor;
+}
+
+void FVoxelRenderCommandPacket::AttachChunkFade(const FIntVector& ChunkCoord, const FMaterialRenderProxy* FadeInProxy, const FMaterialRenderProxy* FadeOutProxy)
+{
+	FVoxelRenderCommand& Command = AddCommand(EVoxelRenderCommand::AttachChunkFade);
+	Command.ChunkCoord = ChunkCoord;
+	Command.FadeInProxy = FadeInProxy;
+	Command.FadeOutProxy = FadeOutProxy;
+}
+
+void FVoxelRenderCommandPacket::SetChunkFadeAlphas(TArray<TPair<FIntVector, float>>&& Alphas)
+{
+	PayloadBytes += Alphas.NumBytes();
+	FadeAlphaBatches.Add(MoveTemp(Alphas));
+	AddCommand(EVoxelRenderCommand::SetChunkFadeAlphas).PayloadIndex = FadeAlphaBatches.Num() - 1;
+}
+
+void FVoxelRenderCommandPacket::ClearChunkFade(const FIntVector& ChunkCoord)
+{
+	AddCommand(EVoxelRenderCommand::ClearChunkFade).ChunkCoord = ChunkCoord;
+}
+
+void FVoxelRenderCommandPacket::ClearAllChunkFades()
+{
+	AddCommand(EVoxelRenderCommand::ClearAllChunkFades);
+}
+
+void FVoxelRenderCommandPacket::UpdateWaterTile(const FIntVector2& TileCoord, TArray<FVoxelVertex>&& Vertices, TArray<uint32>&& Indices, const FVector& TileWorldPosition)
+{
+	const int32 MeshIndex = AddMesh(MoveTemp(Vertices), MoveTemp(Indices));
+
+	FVoxelRenderCommand& Command = AddCommand(EVoxelRenderCommand::UpdateWaterTile);
+	Command.TileCoord = TileCoord;
+	Command.WorldPosition = TileWorldPosition;
+	Command.PayloadIndex = MeshIndex;
+}
+
+void FVoxelRenderCommandPacket::RemoveWaterTile(const FIntVector2& TileCoord)
+{
+	AddCommand(EVoxelRenderCommand::RemoveWaterTile).TileCoord = TileCoord;
+}
+
+void FVoxelRenderCommandPacket::ClearWaterTiles()
+{
+	AddCommand(EVoxelRenderCommand::ClearWaterTiles);
+}
+
+void FVoxelRenderCommandPacket::UpdateSeamMesh(const FIntVector& OwnerChunkCoord, uint8 Axis, int32 LODLevel, TArray<FVoxelVertex>&& Vertices, TArray<uint32>&& Indices, const FVector& OwnerWorldPosition)
+{
+	const int32 MeshIndex = AddMesh(MoveTemp(Vertices), MoveTemp(Indices));
+
+	FVoxelRenderCommand& Command = AddCommand(EVoxelRenderCommand::UpdateSeamMesh);
+	Command.ChunkCoord = OwnerChunkCoord;
+	Command.Axis = Axis;
+	Command.LODLevel = LODLevel;
+	Command.WorldPosition = OwnerWorldPosition;
+	Command.PayloadIndex = MeshIndex;
+}
+
+void FVoxelRenderCommandPacket::RemoveSeamMesh(const FIntVector& OwnerChunkCoord, uint8 Axis)
+{
+	FVoxelRenderCommand& Command = AddCommand(EVoxelRenderCommand::RemoveSeamMesh);
+	Command.ChunkCoord = OwnerChunkCoord;
+	Command.Axis = Axis;
+}
+
+void FVoxelRenderCommandPacket::ClearSeamMeshes()
+{
+	AddCommand(EVoxelRenderCommand::ClearSeamMeshes);
+}
+
+void FVoxelRenderCommandPacket::Reset()
+{
+	Commands.Reset();
+	Meshes.Reset();
+	FadeAlphaBatches.Reset();
+	ChunkBatches.Reset();
+	PayloadBytes = 0;
+}
+
+void FVoxelRenderCommandPacket::Execute(FRHICommandListBase& RHICmdList, FVoxelSceneProxy& Proxy)
+{
+	check(IsInRenderingThread());
+
+	for (const FVoxelRenderCommand& Command : Commands)
+	{
+		switch (Command.Type)
+		{
+		case EVoxelRenderCommand::ChunkBatch:
+		{
+			FChunkBatchPayload& Batch = ChunkBatches[Command.PayloadIndex];
+			Proxy.ProcessBatchUpdate_RenderThread(RHICmdList, MoveTemp(Batch.Adds), MoveTemp(Batch.Removals));
+			break;
+		}
+		case EVoxelRenderCommand::ClearChunks:
+			Proxy.ClearAllChunks_RenderThread();
+			break;
+		case EVoxelRenderCommand::SetChunkVisible:
+			Proxy.SetChunkVisible_RenderThread(Command.ChunkCoord, Command.bVisible);
+			break;
+		case EVoxelRenderCommand::SetChunkMorphFactor:
+			Proxy.UpdateChunkMorphFactor_RenderThread(Command.ChunkCoord, Command.Value);
+			break;
+		case EVoxelRenderCommand::AttachChunkFade:
+			Proxy.SetChunkFadeState_RenderThread(Command.ChunkCoord, Command.FadeInProxy, Command.FadeOutProxy);
+			break;
+		case EVoxelRenderCommand::SetChunkFadeAlphas:
+			Proxy.UpdateChunkFadeAlphasBatch_RenderThread(FadeAlphaBatches[Command.PayloadIndex]);
+			break;
+		case EVoxelRenderCommand::ClearChunkFade:
+			Proxy.ClearChunkFadeState_RenderThread(Command.ChunkCoord);
+			break;
+		case EVoxelRenderCommand::ClearAllChunkFades:
+			Proxy.ClearAllChunkFadeStates_RenderThread();
+			break;
+		case EVoxelRenderCommand::UpdateWaterTile:
+		{
+			FMeshPayload& Mesh = Meshes[Command.PayloadIndex];
+			Proxy.UpdateWaterTileFromCPUData_RenderThread(RHICmdList, Command.TileCoord, MoveTemp(Mesh.Vertices), MoveTemp(Mesh.Indices), Command.WorldPosition);
+			break;
+		}
+		case EVoxelRenderCommand::RemoveWaterTile:
+			Proxy.RemoveWaterTile_RenderThread(Command.TileCoord);
+			break;
+		case EVoxelRenderCommand::ClearWaterTiles:
+			Proxy.ClearAllWaterTiles_RenderThread();
+			break;
+		case EVoxelRenderCommand::UpdateSeamMesh:
+		{
+			FMeshPayload& Mesh = Meshes[Command.PayloadIndex];
+			Proxy.UpdateSeamMeshFromCPUData_RenderThread(RHICmdList, Command.ChunkCoord, Command.Axis, Command.LODLevel, MoveTemp(Mesh.Vertices), MoveTemp(Mesh.Indices), Command.WorldPosition);
+			break;
+		}
+		case EVoxelRenderCommand::RemoveSeamMesh:
+			Proxy.RemoveSeamMesh_RenderThread(Command.ChunkCoord, Command.Axis);
+			break;
+		case EVoxelRenderCommand::ClearSeamMeshes:
+			Proxy.ClearAllSeamMeshes_RenderThread();
+			break;
+		default:
+			checkNoEntry();
+			break;
+		}
+	}
+}
+
+// ==================== FVoxelRenderCommandStream ====================
+
+bool FVoxelRenderCommandStream::Submit(TUniquePtr<FVoxelRenderCommandPacket>&& Packet)
+{
+	check(IsInGameThread());
+
+	if (!Packet.IsValid() || Packet->IsEmpty())
+	{
+		return false;
+	}
+
+	Packets.Enqueue(MoveTemp(Packet));
+
+	// Enqueue happens-before this exchange; Drain clears the flag before dequeuing, so a
+	// pending drain that has not started yet is guaranteed to see the packet.
+	return !bDrainPending.exchange(true);
+}
+
+void FVoxelRenderCommandStream::Drain(FRHICommandListBase& RHICmdList, FVoxelSceneProxy& Proxy)
+{
+	check(IsInRenderingThread());
+
+	bDrainPending.store(false);
+
+	int32 NumCommands = 0;
+	int64 NumBytes = 0;
+	int32 NumPackets = 0;
+
+	TUniquePtr<FVoxelRenderCommandPacket> Packet;
+	while (Packets.Dequeue(Packet))
+	{
+		// Measure before Execute consumes the payloads
+		NumCommands += Packet->Num();
+		NumBytes += Packet->GetNumBytes();
+		++NumPackets;
+
+		Packet->Execute(RHICmdList, Proxy);
+		Packet.Reset();
+	}
+
+	if (NumPackets == 0)
+	{
+		return;
+	}
+
+	Stats.LastDrainCommands = NumCommands;
+	Stats.LastDrainBytes = NumBytes;
+	Stats.PeakDrainCommands = FMath::Max(Stats.PeakDrainCommands, NumCommands);
+	Stats.NumDrains++;
+	Stats.NumPackets += NumPackets;
+	Stats.TotalCommands += NumCommands;
+	Stats.TotalBytes += NumBytes;
+
+	UE_LOG(LogVoxelRendering, Verbose, TEXT("FVoxelRenderCommandStream: Applied %d commands (%lld bytes) from %d packet(s)"),
+		NumCommands, NumBytes, NumPackets);
+}
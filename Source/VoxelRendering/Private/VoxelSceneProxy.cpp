@@ -4,6 +4,7 @@
 #include "VoxelWorldComponent.h"
 #include "VoxelRendering.h"
 #include "VoxelLocalVertexFactory.h"
+#include "VoxelChunkBufferPool.h"
 #include "LocalVFTestComponent.h"  // For InitLocalVertexFactoryStreams
 #include "MaterialDomain.h"
 #include "Materials/Material.h"
@@ -37,8 +38,68 @@ static void SyncVertexColorDebugMode()
 	GVoxelVertexColorDebugMode = CVarVoxelVertexColorDebugMode.GetValueOnAnyThread();
 }
 
+static TAutoConsoleVariable<int32> CVarVoxelIndex16(
+	TEXT("voxel.Render.Index16"),
+	1,
+	TEXT("Upload chunk, seam and water index buffers as 16-bit when the mesh has at most 65536 vertices.\n")
+	TEXT("Also caps shared buffer pool pages (voxel.Render.ChunkBufferPool) at 65536 vertices so their\n")
+	TEXT("page-rebased indices stay 16-bit. Read by the pool when a page is created.\n")
+	TEXT("  0 = always 32-bit\n")
+	TEXT("  1 = 16-bit when every index fits (default)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarVoxelCullCellChunks(
+	TEXT("voxel.Render.CullCellChunks"),
+	8,
+	TEXT("Edge, in chunks, of the XY column cells used to reject off-screen terrain regions whole.\n")
+	TEXT("  0 = one flat set (every chunk bound tested per view)\n")
+	TEXT("Read when the scene proxy is created."),
+	ECVF_Default);
+
 // ==================== Helper Function Implementation ====================
 
+uint32 GetVoxelIndexStride(uint32 VertexCount)
+{
+	return (CVarVoxelIndex16.GetValueOnAnyThread() != 0 && VertexCount <= 65536) ? sizeof(uint16) : sizeof(uint32);
+}
+
+/**
+ * Create a static index buffer from CPU indices, narrowed to 16-bit while copying when
+ * GetVoxelIndexStride allows it. OutStride receives the element size used.
+ */
+static FBufferRHIRef CreateVoxelIndexBuffer(
+	FRHICommandListBase& RHICmdList,
+	const TCHAR* DebugName,
+	const TArray<uint32>& Indices,
+	uint32 VertexCount,
+	uint32& OutStride)
+{
+	const uint32 IndexCount = Indices.Num();
+	OutStride = GetVoxelIndexStride(VertexCount);
+	const uint32 IndexBufferSize = IndexCount * OutStride;
+
+	FBufferRHIRef IndexBufferRHI = RHICmdList.CreateBuffer(
+		FRHIBufferCreateDesc::Create(DebugName, IndexBufferSize, OutStride, BUF_Static | BUF_IndexBuffer)
+			.SetInitialState(ERHIAccess::VertexOrIndexBuffer));
+
+	void* IndexData = RHICmdList.LockBuffer(IndexBufferRHI, 0, IndexBufferSize, RLM_WriteOnly);
+	if (OutStride == sizeof(uint16))
+	{
+		uint16* Dest = static_cast<uint16*>(IndexData);
+		for (uint32 i = 0; i < IndexCount; i++)
+		{
+			Dest[i] = static_cast<uint16>(Indices[i]);
+		}
+	}
+	else
+	{
+		FMemory::Memcpy(IndexData, Indices.GetData(), IndexBufferSize);
+	}
+	RHICmdList.UnlockBuffer(IndexBufferRHI);
+
+	return IndexBufferRHI;
+}
+
 void InitVoxelLocalVertexFactory(
 	FRHICommandListBase& RHICmdList,
 	FLocalVertexFactory* VertexFactory,
@@ -131,6 +192,7 @@ FVoxelSceneProxy::FVoxelSceneProxy(UVoxelWorldComponent* InComponent, UMaterialI
 	, Material(InMaterial)
 	, FeatureLevel(InComponent->GetWorld()->GetFeatureLevel())
 	, VoxelSize(100.0f)
+	, ChunkBufferPool(FeatureLevel)
 {
 	// Get voxel size from component if available
 	if (InComponent)
@@ -147,6 +209,8 @@ FVoxelSceneProxy::FVoxelSceneProxy(UVoxelWorldComponent* InComponent, UMaterialI
 	// Cache material relevance
 	MaterialRelevance = Material->GetRelevance(GetFeatureLevelShaderPlatform(FeatureLevel));
 
+	ChunkCulling.Reset(CVarVoxelCullCellChunks.GetValueOnAnyThread());
+
 	// Note: Per-chunk vertex factories are created in UpdateChunkBuffers_RenderThread
 
 	// Set proxy properties
@@ -169,15 +233,14 @@ FVoxelSceneProxy::FVoxelSceneProxy(UVoxelWorldComponent* InComponent, UMaterialI
 FVoxelSceneProxy::~FVoxelSceneProxy()
 {
 	// Release all chunk resources
-	FScopeLock Lock(&ChunkDataLock);
-
-	ReleaseAllChunkFadeStates_AssumesLocked();
+	ReleaseAllChunkFadeStates();
 
 	for (auto& Pair : ChunkRenderData)
 	{
-		Pair.Value.ReleaseResources();
+		ReleaseChunkRenderData(Pair.Value);
 	}
 	ChunkRenderData.Empty();
+	ChunkCulling.Reset(ChunkCulling.GetCellSizeInChunks());
 
 	for (auto& Pair : ChunkVertexBuffers)
 	{
@@ -299,8 +362,6 @@ void FVoxelSceneProxy::GetDynamicMeshElements(
 		return;
 	}
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	if (ChunkRenderData.Num() == 0)
 	{
 		return;
@@ -354,8 +415,13 @@ void FVoxelSceneProxy::GetDynamicMeshElements(
 
 		const FSceneView* View = Views[ViewIndex];
 
-		// Iterate over all chunks
-		for (const auto& Pair : ChunkRenderData)
+		// Frustum culling over the flat SoA bounds set: off-screen column cells are rejected whole,
+		// surviving chunks are tested four at a time (same conservative box test as IntersectBox)
+		VisibleChunkScratch.Reset();
+		ChunkCulling.Cull(View->ViewFrustum.Planes, VisibleChunkScratch);
+		SkippedFrustum += ChunkCulling.Num() - VisibleChunkScratch.Num();
+
+		for (const FIntVector& ChunkCoord : VisibleChunkScratch)
 		{
 			// Check mesh batch limit to avoid job queue overflow
 			if (TotalMeshesAdded >= MaxMeshBatchesPerFrame)
@@ -364,60 +430,30 @@ void FVoxelSceneProxy::GetDynamicMeshElements(
 				continue;
 			}
 
-			const FIntVector& ChunkCoord = Pair.Key;
-			const FVoxelChunkRenderData& RenderData = Pair.Value;
-
-			// Skip invisible or empty chunks (IndexCount < 3 means zero triangles)
-			if (!RenderData.bIsVisible || !RenderData.HasValidBuffers() || RenderData.IndexCount < 3)
+			const FVoxelChunkRenderData* RenderDataPtr = ChunkRenderData.Find(ChunkCoord);
+			if (!RenderDataPtr)
 			{
 				SkippedInvisible++;
 				continue;
 			}
+			const FVoxelChunkRenderData& RenderData = *RenderDataPtr;
 
-			// Get vertex factory for this chunk
-			const TSharedPtr<FLocalVertexFactory>* VertexFactoryPtr = ChunkVertexFactories.Find(ChunkCoord);
-			if (!VertexFactoryPtr || !VertexFactoryPtr->IsValid())
+			// Skip invisible or empty chunks (IndexCount < 3 means zero triangles)
+			if (!RenderData.bIsVisible || !RenderData.HasValidBuffers() || RenderData.IndexCount < 3)
 			{
 				SkippedInvisible++;
 				continue;
 			}
 
-			// Get index buffer wrapper
-			const TSharedPtr<FVoxelLocalIndexBuffer>* IndexBufferPtr = ChunkIndexBuffers.Find(ChunkCoord);
-			if (!IndexBufferPtr || !IndexBufferPtr->IsValid())
+			// Get vertex factory and index buffer for this chunk (its pool page's when pooled)
+			const FVertexFactory* ChunkVertexFactory = nullptr;
+			const FIndexBuffer* ChunkIndexBuffer = nullptr;
+			if (!ResolveChunkDrawResources(RenderData, ChunkVertexFactories.Find(ChunkCoord), ChunkIndexBuffers.Find(ChunkCoord), ChunkVertexFactory, ChunkIndexBuffer))
 			{
 				SkippedInvisible++;
 				continue;
 			}
 
-			// Frustum culling - use proper box-frustum intersection test
-			// The old corner-only test failed for nearby chunks when looking down
-			{
-				FBox WorldBounds = RenderData.WorldBounds;
-
-				if (WorldBounds.IsValid)
-				{
-					// Expand bounds for safety margin (accounts for vertex displacement, LOD morphing)
-					WorldBounds = WorldBounds.ExpandBy(FVector(VoxelSize * 2.0f));
-
-					// Use UE's built-in frustum intersection test which handles all edge cases:
-					// - Corners outside but surface visible
-					// - Camera inside bounds
-					// - Bounds spanning frustum planes
-					const FConvexVolume& ViewFrustum = View->ViewFrustum;
-
-					// IntersectBox returns true if the box intersects or is inside the frustum
-					// This is the proper conservative test for frustum culling
-					bool bIntersects = ViewFrustum.IntersectBox(WorldBounds.GetCenter(), WorldBounds.GetExtent());
-
-					if (!bIntersects)
-					{
-						SkippedFrustum++;
-						continue;
-					}
-				}
-			}
-
 			// ==================== Mesh-Swap Crossfade ====================
 			// While a swap fade is active this chunk draws twice: the retained previous mesh
 			// dithering out and the current mesh dithering in. Both use pooled MIDs of the
@@ -436,12 +472,13 @@ void FVoxelSceneProxy::GetDynamicMeshElements(
 					PreviousMesh = ChunkPreviousMeshes.Find(ChunkCoord);
 				}
 			}
+			const FVertexFactory* PreviousVertexFactory = nullptr;
+			const FIndexBuffer* PreviousIndexBuffer = nullptr;
 			const bool bFading = FadeState && PreviousMesh
 				&& FadeState->FadeInProxy && FadeState->FadeOutProxy
 				&& PreviousMesh->RenderData.HasValidBuffers()
 				&& PreviousMesh->RenderData.IndexCount >= 3
-				&& PreviousMesh->VertexFactory.IsValid()
-				&& PreviousMesh->IndexBuffer.IsValid();
+				&& ResolveChunkDrawResources(PreviousMesh->RenderData, &PreviousMesh->VertexFactory, &PreviousMesh->IndexBuffer, PreviousVertexFactory, PreviousIndexBuffer);
 
 			if (bFading)
 			{
@@ -449,7 +486,7 @@ void FVoxelSceneProxy::GetDynamicMeshElements(
 				// mesh's bounds above (the two differ by at most one LOD's worth of surface
 				// motion, inside the ExpandBy margin).
 				FMeshBatch& PrevBatch = Collector.AllocateMesh();
-				PrevBatch.VertexFactory = PreviousMesh->VertexFactory.Get();
+				PrevBatch.VertexFactory = PreviousVertexFactory;
 				PrevBatch.MaterialRenderProxy = FadeState->FadeOutProxy;
 				PrevBatch.ReverseCulling = IsLocalToWorldDeterminantNegative();
 				PrevBatch.bDisableBackfaceCulling = false;
@@ -466,11 +503,11 @@ void FVoxelSceneProxy::GetDynamicMeshElements(
 				PrevBatch.SegmentIndex = 0;
 
 				FMeshBatchElement& PrevElement = PrevBatch.Elements[0];
-				PrevElement.IndexBuffer = PreviousMesh->IndexBuffer.Get();
-				PrevElement.FirstIndex = 0;
+				PrevElement.IndexBuffer = PreviousIndexBuffer;
+				PrevElement.FirstIndex = PreviousMesh->RenderData.FirstIndex;
 				PrevElement.NumPrimitives = PreviousMesh->RenderData.IndexCount / 3;
-				PrevElement.MinVertexIndex = 0;
-				PrevElement.MaxVertexIndex = PreviousMesh->RenderData.VertexCount - 1;
+				PrevElement.MinVertexIndex = PreviousMesh->RenderData.BaseVertexIndex;
+				PrevElement.MaxVertexIndex = PreviousMesh->RenderData.BaseVertexIndex + PreviousMesh->RenderData.VertexCount - 1;
 				PrevElement.PrimitiveUniformBuffer = GetUniformBuffer();
 
 				Collector.AddMesh(ViewIndex, PrevBatch);
@@ -479,7 +516,7 @@ void FVoxelSceneProxy::GetDynamicMeshElements(
 
 			// Allocate mesh batch
 			FMeshBatch& MeshBatch = Collector.AllocateMesh();
-			MeshBatch.VertexFactory = VertexFactoryPtr->Get();
+			MeshBatch.VertexFactory = ChunkVertexFactory;
 			MeshBatch.MaterialRenderProxy = bFading ? FadeState->FadeInProxy : MaterialProxy;
 			MeshBatch.ReverseCulling = IsLocalToWorldDeterminantNegative();
 			MeshBatch.bDisableBackfaceCulling = false;
@@ -497,11 +534,11 @@ void FVoxelSceneProxy::GetDynamicMeshElements(
 
 			// Setup mesh batch element
 			FMeshBatchElement& BatchElement = MeshBatch.Elements[0];
-			BatchElement.IndexBuffer = IndexBufferPtr->Get();
-			BatchElement.FirstIndex = 0;
+			BatchElement.IndexBuffer = ChunkIndexBuffer;
+			BatchElement.FirstIndex = RenderData.FirstIndex;
 			BatchElement.NumPrimitives = RenderData.IndexCount / 3;
-			BatchElement.MinVertexIndex = 0;
-			BatchElement.MaxVertexIndex = RenderData.VertexCount - 1;
+			BatchElement.MinVertexIndex = RenderData.BaseVertexIndex;
+			BatchElement.MaxVertexIndex = RenderData.BaseVertexIndex + RenderData.VertexCount - 1;
 			BatchElement.PrimitiveUniformBuffer = GetUniformBuffer();
 
 			// ==================== Runtime Virtual Texture Pass ====================
@@ -801,37 +838,103 @@ uint32 FVoxelSceneProxy::GetMemoryFootprint() const
 
 // ==================== Chunk Management ====================
 
-void FVoxelSceneProxy::ReleaseChunkFadeState_AssumesLocked(const FIntVector& ChunkCoord)
+void FVoxelSceneProxy::ReleaseChunkRenderData(FVoxelChunkRenderData& RenderData)
+{
+	ChunkBufferPool.Free(RenderData);
+	RenderData.ReleaseResources();
+}
+
+void FVoxelSceneProxy::ReleasePreviousMesh(FVoxelChunkPreviousMesh& Previous)
+{
+	ChunkBufferPool.Free(Previous.RenderData);
+	Previous.ReleaseResources();
+}
+
+void FVoxelSceneProxy::TrackChunkStats(const FVoxelChunkRenderData& RenderData, int32 Sign)
+{
+	LiveVertexCount += Sign * static_cast<int64>(RenderData.VertexCount);
+	LiveTriangleCount += Sign * static_cast<int64>(RenderData.IndexCount / 3);
+	if (!RenderData.IsPooled())
+	{
+		const SIZE_T Bytes = RenderData.GetGPUMemoryUsage();
+		LiveDedicatedBytes = Sign > 0 ? LiveDedicatedBytes + Bytes : LiveDedicatedBytes - Bytes;
+	}
+}
+
+void FVoxelSceneProxy::TrackPreviousMeshStats(const FVoxelChunkPreviousMesh& Previous, int32 Sign)
+{
+	if (!Previous.RenderData.IsPooled())
+	{
+		const SIZE_T Bytes = Previous.RenderData.GetGPUMemoryUsage();
+		PreviousDedicatedBytes = Sign > 0 ? PreviousDedicatedBytes + Bytes : PreviousDedicatedBytes - Bytes;
+	}
+}
+
+FBox FVoxelSceneProxy::GetChunkCullingBounds(const FVoxelChunkRenderData& RenderData) const
+{
+	// Expand bounds for safety margin (accounts for vertex displacement, LOD morphing)
+	return RenderData.WorldBounds.IsValid ? RenderData.WorldBounds.ExpandBy(FVector(VoxelSize * 2.0f)) : RenderData.WorldBounds;
+}
+
+bool FVoxelSceneProxy::ResolveChunkDrawResources(
+	const FVoxelChunkRenderData& RenderData,
+	const TSharedPtr<FLocalVertexFactory>* VertexFactory,
+	const TSharedPtr<FVoxelLocalIndexBuffer>* IndexBuffer,
+	const FVertexFactory*& OutVertexFactory,
+	const FIndexBuffer*& OutIndexBuffer) const
+{
+	if (RenderData.IsPooled())
+	{
+		OutVertexFactory = ChunkBufferPool.GetVertexFactory(RenderData.PoolPageIndex);
+		OutIndexBuffer = ChunkBufferPool.GetIndexBuffer(RenderData.PoolPageIndex);
+	}
+	else
+	{
+		OutVertexFactory = VertexFactory && VertexFactory->IsValid() ? VertexFactory->Get() : nullptr;
+		OutIndexBuffer = IndexBuffer && IndexBuffer->IsValid() ? IndexBuffer->Get() : nullptr;
+	}
+	return OutVertexFactory && OutIndexBuffer;
+}
+
+void FVoxelSceneProxy::ReleaseChunkFadeState(const FIntVector& ChunkCoord)
 {
 	if (FVoxelChunkPreviousMesh* Previous = ChunkPreviousMeshes.Find(ChunkCoord))
 	{
-		Previous->ReleaseResources();
+		TrackPreviousMeshStats(*Previous, -1);
+		ReleasePreviousMesh(*Previous);
 		ChunkPreviousMeshes.Remove(ChunkCoord);
 	}
 	ChunkFadeStates.Remove(ChunkCoord);
 }
 
-void FVoxelSceneProxy::ReleaseAllChunkFadeStates_AssumesLocked()
+void FVoxelSceneProxy::ReleaseAllChunkFadeStates()
 {
 	for (auto& Pair : ChunkPreviousMeshes)
 	{
-		Pair.Value.ReleaseResources();
+		ReleasePreviousMesh(Pair.Value);
 	}
 	ChunkPreviousMeshes.Empty();
+	PreviousDedicatedBytes = 0;
 	ChunkFadeStates.Empty();
 }
 
-void FVoxelSceneProxy::RetireOrReleaseChunk_AssumesLocked(const FIntVector& ChunkCoord, bool bMoveToPrevious)
+void FVoxelSceneProxy::RetireOrReleaseChunk(const FIntVector& ChunkCoord, bool bMoveToPrevious)
 {
 	// Cap at one retained generation: any older Previous goes now, whatever happens next.
 	if (FVoxelChunkPreviousMesh* OldPrevious = ChunkPreviousMeshes.Find(ChunkCoord))
 	{
-		OldPrevious->ReleaseResources();
+		TrackPreviousMeshStats(*OldPrevious, -1);
+		ReleasePreviousMesh(*OldPrevious);
 		ChunkPreviousMeshes.Remove(ChunkCoord);
 	}
 
 	FVoxelChunkRenderData ExistingData;
 	const bool bHadData = ChunkRenderData.RemoveAndCopyValue(ChunkCoord, ExistingData);
+	ChunkCulling.Remove(ChunkCoord);
+	if (bHadData)
+	{
+		TrackChunkStats(ExistingData, -1);
+	}
 
 	TSharedPtr<FVoxelLocalVertexBuffer> ExistingVB;
 	ChunkVertexBuffers.RemoveAndCopyValue(ChunkCoord, ExistingVB);
@@ -843,21 +946,22 @@ void FVoxelSceneProxy::RetireOrReleaseChunk_AssumesLocked(const FIntVector& Chun
 	ChunkVertexFactories.RemoveAndCopyValue(ChunkCoord, ExistingVF);
 
 	if (bMoveToPrevious && bHadData && ExistingData.HasValidBuffers()
-		&& ExistingVB.IsValid() && ExistingIB.IsValid() && ExistingVF.IsValid())
+		&& (ExistingData.IsPooled() || (ExistingVB.IsValid() && ExistingIB.IsValid() && ExistingVF.IsValid())))
 	{
-		// Retain the outgoing mesh alive (buffers stay initialized) for the crossfade.
+		// Retain the outgoing mesh alive (buffers stay initialized, pool ranges stay allocated) for the crossfade.
 		FVoxelChunkPreviousMesh Previous;
 		Previous.RenderData = MoveTemp(ExistingData);
 		Previous.VertexBuffer = ExistingVB;
 		Previous.IndexBuffer = ExistingIB;
 		Previous.VertexFactory = ExistingVF;
+		TrackPreviousMeshStats(Previous, 1);
 		ChunkPreviousMeshes.Add(ChunkCoord, MoveTemp(Previous));
 		return;
 	}
 
 	if (bHadData)
 	{
-		ExistingData.ReleaseResources();
+		ReleaseChunkRenderData(ExistingData);
 	}
 	if (ExistingVF.IsValid())
 	{
@@ -894,10 +998,8 @@ void FVoxelSceneProxy::UpdateChunkBuffers_RenderThread(FRHICommandListBase& RHIC
 		return;
 	}
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	// Retire (crossfade) or release any existing mesh for this chunk
-	RetireOrReleaseChunk_AssumesLocked(ChunkCoord, bCrossfade);
+	RetireOrReleaseChunk(ChunkCoord, bCrossfade);
 
 	// Read source vertices from the GPU buffer
 	const uint32 SourceVertexCount = GPUData.VertexCount;
@@ -1083,6 +1185,8 @@ void FVoxelSceneProxy::UpdateChunkBuffers_RenderThread(FRHICommandListBase& RHIC
 
 	// Store render data
 	ChunkRenderData.Add(ChunkCoord, NewRenderData);
+	TrackChunkStats(NewRenderData, 1);
+	ChunkCulling.Update(ChunkCoord, GetChunkCullingBounds(NewRenderData));
 
 	// Create and initialize vertex buffer wrapper
 	TSharedPtr<FVoxelLocalVertexBuffer> VertexBufferWrapper = MakeShared<FVoxelLocalVertexBuffer>();
@@ -1111,6 +1215,9 @@ void FVoxelSceneProxy::UpdateChunkBuffers_RenderThread(FRHICommandListBase& RHIC
 
 	UE_LOG(LogVoxelRendering, Verbose, TEXT("FVoxelSceneProxy: Updated chunk %s with %d vertices, %d indices (converted to FLocalVertexFactory format)"),
 		*ChunkCoord.ToString(), SourceVertexCount, GPUData.IndexCount);
+
+	// GPU-path updates arrive as their own render commands, outside the command stream
+	PublishStats_RenderThread();
 }
 
 void FVoxelSceneProxy::UpdateChunkFromCPUData_RenderThread(
@@ -1137,10 +1244,8 @@ void FVoxelSceneProxy::UpdateChunkFromCPUData_RenderThread(
 		return;
 	}
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	// Retire (crossfade) or release any existing mesh for this chunk
-	RetireOrReleaseChunk_AssumesLocked(ChunkCoord, bCrossfade);
+	RetireOrReleaseChunk(ChunkCoord, bCrossfade);
 
 	// Convert FVoxelVertex to FVoxelLocalVertex format directly from CPU data (NO GPU READBACK!)
 	const FVector3f ChunkOffset = FVector3f(ChunkWorldPosition);
@@ -1248,17 +1353,12 @@ void FVoxelSceneProxy::UpdateChunkFromCPUData_RenderThread(
 	NewRenderData.TexCoordSRV = RHICmdList.CreateShaderResourceView(NewRenderData.TexCoordBufferRHI, FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(PF_G32R32F));
 
 	// Create index buffer directly from CPU data
-	const uint32 IndexBufferSize = IndexCount * sizeof(uint32);
-	NewRenderData.IndexBufferRHI = RHICmdList.CreateBuffer(
-		FRHIBufferCreateDesc::Create(TEXT("VoxelIndexBuffer_CPU"), IndexBufferSize, sizeof(uint32), BUF_Static | BUF_IndexBuffer)
-			.SetInitialState(ERHIAccess::VertexOrIndexBuffer));
-
-	void* IndexData = RHICmdList.LockBuffer(NewRenderData.IndexBufferRHI, 0, IndexBufferSize, RLM_WriteOnly);
-	FMemory::Memcpy(IndexData, Indices.GetData(), IndexBufferSize);
-	RHICmdList.UnlockBuffer(NewRenderData.IndexBufferRHI);
+	NewRenderData.IndexBufferRHI = CreateVoxelIndexBuffer(RHICmdList, TEXT("VoxelIndexBuffer_CPU"), Indices, VertexCount, NewRenderData.IndexStride);
 
 	// Store render data
 	ChunkRenderData.Add(ChunkCoord, NewRenderData);
+	TrackChunkStats(NewRenderData, 1);
+	ChunkCulling.Update(ChunkCoord, GetChunkCullingBounds(NewRenderData));
 
 	// Create and initialize vertex buffer wrapper
 	TSharedPtr<FVoxelLocalVertexBuffer> VertexBufferWrapper = MakeShared<FVoxelLocalVertexBuffer>();
@@ -1293,15 +1393,15 @@ void FVoxelSceneProxy::RemoveChunk_RenderThread(const FIntVector& ChunkCoord)
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	// Drop any crossfade state along with the chunk
-	ReleaseChunkFadeState_AssumesLocked(ChunkCoord);
+	ReleaseChunkFadeState(ChunkCoord);
 
 	if (FVoxelChunkRenderData* RenderData = ChunkRenderData.Find(ChunkCoord))
 	{
-		RenderData->ReleaseResources();
+		TrackChunkStats(*RenderData, -1);
+		ReleaseChunkRenderData(*RenderData);
 		ChunkRenderData.Remove(ChunkCoord);
+		ChunkCulling.Remove(ChunkCoord);
 	}
 
 	if (TSharedPtr<FVoxelLocalVertexBuffer>* VB = ChunkVertexBuffers.Find(ChunkCoord))
@@ -1338,15 +1438,17 @@ void FVoxelSceneProxy::ClearAllChunks_RenderThread()
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
-	ReleaseAllChunkFadeStates_AssumesLocked();
+	ReleaseAllChunkFadeStates();
 
 	for (auto& Pair : ChunkRenderData)
 	{
-		Pair.Value.ReleaseResources();
+		ReleaseChunkRenderData(Pair.Value);
 	}
 	ChunkRenderData.Empty();
+	LiveVertexCount = 0;
+	LiveTriangleCount = 0;
+	LiveDedicatedBytes = 0;
+	ChunkCulling.Reset(ChunkCulling.GetCellSizeInChunks());
 
 	for (auto& Pair : ChunkVertexBuffers)
 	{
@@ -1382,8 +1484,6 @@ void FVoxelSceneProxy::SetChunkVisible_RenderThread(const FIntVector& ChunkCoord
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	if (FVoxelChunkRenderData* RenderData = ChunkRenderData.Find(ChunkCoord))
 	{
 		RenderData->bIsVisible = bVisible;
@@ -1394,8 +1494,6 @@ void FVoxelSceneProxy::UpdateChunkMorphFactor_RenderThread(const FIntVector& Chu
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	const float Clamped = FMath::Clamp(MorphFactor, 0.0f, 1.0f);
 
 	if (FVoxelChunkRenderData* RenderData = ChunkRenderData.Find(ChunkCoord))
@@ -1430,8 +1528,6 @@ void FVoxelSceneProxy::SetChunkFadeState_RenderThread(const FIntVector& ChunkCoo
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	FVoxelChunkFadeState& FadeState = ChunkFadeStates.FindOrAdd(ChunkCoord);
 	FadeState.FadeAlpha = 0.0f;
 	FadeState.FadeInProxy = InFadeInProxy;
@@ -1442,8 +1538,6 @@ void FVoxelSceneProxy::UpdateChunkFadeAlphasBatch_RenderThread(const TArray<TPai
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	for (const TPair<FIntVector, float>& Pair : Alphas)
 	{
 		const float Clamped = FMath::Clamp(Pair.Value, 0.0f, 1.0f);
@@ -1463,18 +1557,14 @@ void FVoxelSceneProxy::ClearChunkFadeState_RenderThread(const FIntVector& ChunkC
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
-	ReleaseChunkFadeState_AssumesLocked(ChunkCoord);
+	ReleaseChunkFadeState(ChunkCoord);
 }
 
 void FVoxelSceneProxy::ClearAllChunkFadeStates_RenderThread()
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
-	ReleaseAllChunkFadeStates_AssumesLocked();
+	ReleaseAllChunkFadeStates();
 }
 
 // ==================== Water Tile Management ====================
@@ -1503,8 +1593,6 @@ void FVoxelSceneProxy::UpdateWaterTileFromCPUData_RenderThread(
 		return;
 	}
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	// Remove existing data if any
 	if (FVoxelChunkRenderData* ExistingData = WaterTileRenderData.Find(TileCoord))
 	{
@@ -1631,14 +1719,7 @@ void FVoxelSceneProxy::UpdateWaterTileFromCPUData_RenderThread(
 	NewRenderData.TexCoordSRV = RHICmdList.CreateShaderResourceView(NewRenderData.TexCoordBufferRHI, FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(PF_G32R32F));
 
 	// Create index buffer
-	const uint32 IndexBufferSize = IndexCount * sizeof(uint32);
-	NewRenderData.IndexBufferRHI = RHICmdList.CreateBuffer(
-		FRHIBufferCreateDesc::Create(TEXT("VoxelWaterIndexBuffer"), IndexBufferSize, sizeof(uint32), BUF_Static | BUF_IndexBuffer)
-			.SetInitialState(ERHIAccess::VertexOrIndexBuffer));
-
-	void* IndexData = RHICmdList.LockBuffer(NewRenderData.IndexBufferRHI, 0, IndexBufferSize, RLM_WriteOnly);
-	FMemory::Memcpy(IndexData, Indices.GetData(), IndexBufferSize);
-	RHICmdList.UnlockBuffer(NewRenderData.IndexBufferRHI);
+	NewRenderData.IndexBufferRHI = CreateVoxelIndexBuffer(RHICmdList, TEXT("VoxelWaterIndexBuffer"), Indices, VertexCount, NewRenderData.IndexStride);
 
 	// Store render data
 	WaterTileRenderData.Add(TileCoord, NewRenderData);
@@ -1676,8 +1757,6 @@ void FVoxelSceneProxy::RemoveWaterTile_RenderThread(const FIntVector2& TileCoord
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	if (FVoxelChunkRenderData* RenderData = WaterTileRenderData.Find(TileCoord))
 	{
 		RenderData->ReleaseResources();
@@ -1718,8 +1797,6 @@ void FVoxelSceneProxy::ClearAllWaterTiles_RenderThread()
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	for (auto& Pair : WaterTileRenderData)
 	{
 		Pair.Value.ReleaseResources();
@@ -1780,8 +1857,6 @@ void FVoxelSceneProxy::UpdateSeamMeshFromCPUData_RenderThread(
 
 	const FVoxelSeamMeshKey Key{ OwnerChunkCoord, Axis };
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	// Remove existing data if any (a seam rebuild swaps only this bucket — §2.4)
 	if (FVoxelChunkRenderData* ExistingData = SeamRenderData.Find(Key))
 	{
@@ -1909,14 +1984,7 @@ void FVoxelSceneProxy::UpdateSeamMeshFromCPUData_RenderThread(
 	NewRenderData.TexCoordSRV = RHICmdList.CreateShaderResourceView(NewRenderData.TexCoordBufferRHI, FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(PF_G32R32F));
 
 	// Create index buffer
-	const uint32 IndexBufferSize = IndexCount * sizeof(uint32);
-	NewRenderData.IndexBufferRHI = RHICmdList.CreateBuffer(
-		FRHIBufferCreateDesc::Create(TEXT("VoxelSeamIndexBuffer"), IndexBufferSize, sizeof(uint32), BUF_Static | BUF_IndexBuffer)
-			.SetInitialState(ERHIAccess::VertexOrIndexBuffer));
-
-	void* IndexData = RHICmdList.LockBuffer(NewRenderData.IndexBufferRHI, 0, IndexBufferSize, RLM_WriteOnly);
-	FMemory::Memcpy(IndexData, Indices.GetData(), IndexBufferSize);
-	RHICmdList.UnlockBuffer(NewRenderData.IndexBufferRHI);
+	NewRenderData.IndexBufferRHI = CreateVoxelIndexBuffer(RHICmdList, TEXT("VoxelSeamIndexBuffer"), Indices, VertexCount, NewRenderData.IndexStride);
 
 	// Store render data
 	SeamRenderData.Add(Key, NewRenderData);
@@ -1956,8 +2024,6 @@ void FVoxelSceneProxy::RemoveSeamMesh_RenderThread(const FIntVector& OwnerChunkC
 
 	const FVoxelSeamMeshKey Key{ OwnerChunkCoord, Axis };
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	if (FVoxelChunkRenderData* RenderData = SeamRenderData.Find(Key))
 	{
 		RenderData->ReleaseResources();
@@ -1996,8 +2062,6 @@ void FVoxelSceneProxy::ClearAllSeamMeshes_RenderThread()
 {
 	check(IsInRenderingThread());
 
-	FScopeLock Lock(&ChunkDataLock);
-
 	for (auto& Pair : SeamRenderData)
 	{
 		Pair.Value.ReleaseResources();
@@ -2047,15 +2111,15 @@ void FVoxelSceneProxy::ProcessBatchUpdate_RenderThread(
 	// Process removals first to free up resources
 	for (const FIntVector& ChunkCoord : Removals)
 	{
-		FScopeLock Lock(&ChunkDataLock);
-
 		// Drop any crossfade state along with the chunk
-		ReleaseChunkFadeState_AssumesLocked(ChunkCoord);
+		ReleaseChunkFadeState(ChunkCoord);
 
 		if (FVoxelChunkRenderData* RenderData = ChunkRenderData.Find(ChunkCoord))
 		{
-			RenderData->ReleaseResources();
+			TrackChunkStats(*RenderData, -1);
+			ReleaseChunkRenderData(*RenderData);
 			ChunkRenderData.Remove(ChunkCoord);
+			ChunkCulling.Remove(ChunkCoord);
 		}
 
 		if (TSharedPtr<FVoxelLocalVertexBuffer>* VB = ChunkVertexBuffers.Find(ChunkCoord))
@@ -2090,7 +2154,9 @@ void FVoxelSceneProxy::ProcessBatchUpdate_RenderThread(
 	for (FBatchChunkAdd& Add : Adds)
 	{
 		const FIntVector& ChunkCoord = Add.ChunkCoord;
-		const uint32 VertexCount = Add.Vertices.Num();
+		// Compact adds carry quantized vertices (FVoxelCompactVertex) and leave Vertices empty
+		const bool bCompact = Add.CompactVertices.Num() > 0;
+		const uint32 VertexCount = bCompact ? Add.CompactVertices.Num() : Add.Vertices.Num();
 		const uint32 IndexCount = Add.Indices.Num();
 
 		if (VertexCount == 0 || IndexCount == 0)
@@ -2098,10 +2164,8 @@ void FVoxelSceneProxy::ProcessBatchUpdate_RenderThread(
 			continue;
 		}
 
-		FScopeLock Lock(&ChunkDataLock);
-
 		// Retire (crossfade) or release any existing mesh for this chunk
-		RetireOrReleaseChunk_AssumesLocked(ChunkCoord, Add.bCrossfade);
+		RetireOrReleaseChunk(ChunkCoord, Add.bCrossfade);
 
 		// Convert FVoxelVertex to FVoxelLocalVertex format directly from CPU data
 		const FVector3f ChunkOffset = FVector3f(Add.ChunkWorldPosition);
@@ -2109,23 +2173,6 @@ void FVoxelSceneProxy::ProcessBatchUpdate_RenderThread(
 		TArray<FVoxelLocalVertex> ConvertedVertices;
 		ConvertedVertices.SetNumUninitialized(VertexCount);
 
-		TArray<FColor> ColorData;
-		ColorData.SetNumUninitialized(VertexCount);
-
-		// Tangent data for SRV: interleaved TangentX + TangentZ (2 x FPackedNormal = 8 bytes per vertex)
-		struct FPackedTangentPair
-		{
-			FPackedNormal TangentX;
-			FPackedNormal TangentZ;
-		};
-		TArray<FPackedTangentPair> TangentData;
-		TangentData.SetNumUninitialized(VertexCount);
-
-		// TexCoord data for SRV
-		// With 2 UV channels, store as float4 per vertex: (UV0.x, UV0.y, UV1.x, UV1.y)
-		TArray<FVector4f> TexCoordData;
-		TexCoordData.SetNumUninitialized(VertexCount);
-
 		// Debug: Track normal statistics
 		int32 ZeroNormals = 0;
 		int32 UpNormals = 0;
@@ -2133,25 +2180,14 @@ void FVoxelSceneProxy::ProcessBatchUpdate_RenderThread(
 
 		for (uint32 i = 0; i < VertexCount; i++)
 		{
+			const FVoxelVertex SourceVertex = bCompact ? Add.CompactFrame.Decode(Add.CompactVertices[i]) : Add.Vertices[i];
+
 			// Debug: Check input normal before conversion
-			FVector3f InputNormal = Add.Vertices[i].GetNormal();
+			FVector3f InputNormal = SourceVertex.GetNormal();
 
-			ConvertedVertices[i] = FVoxelLocalVertex::FromVoxelVertex(Add.Vertices[i]);
+			ConvertedVertices[i] = FVoxelLocalVertex::FromVoxelVertex(SourceVertex);
 			// Offset vertex position from chunk-local to world space
 			ConvertedVertices[i].Position += ChunkOffset;
-			ColorData[i] = ConvertedVertices[i].Color;
-
-			// Extract tangent data for SRV
-			TangentData[i].TangentX = ConvertedVertices[i].TangentX;
-			TangentData[i].TangentZ = ConvertedVertices[i].TangentZ;
-
-			// Extract TexCoord data for SRV (both UV channels as float4)
-			TexCoordData[i] = FVector4f(
-				ConvertedVertices[i].TexCoord.X,
-				ConvertedVertices[i].TexCoord.Y,
-				ConvertedVertices[i].TexCoord1.X,
-				ConvertedVertices[i].TexCoord1.Y
-			);
 
 			// Debug: Categorize normals
 			if (InputNormal.IsNearlyZero(0.01f))
@@ -2189,6 +2225,47 @@ void FVoxelSceneProxy::ProcessBatchUpdate_RenderThread(
 		NewRenderData.MorphFactor = 0.0f;
 		NewRenderData.bIsVisible = true;
 
+		// Pooled path: suballocate into a shared page (no per-chunk buffers, wrappers or vertex factory)
+		if (FVoxelChunkBufferPool::IsEnabled()
+			&& ChunkBufferPool.AllocateAndUpload(RHICmdList, ConvertedVertices, Add.Indices, NewRenderData))
+		{
+			ChunkRenderData.Add(ChunkCoord, NewRenderData);
+			TrackChunkStats(NewRenderData, 1);
+			ChunkCulling.Update(ChunkCoord, GetChunkCullingBounds(NewRenderData));
+			continue;
+		}
+
+		// Dedicated path: split the SRV streams out of the interleaved vertices
+		TArray<FColor> ColorData;
+		ColorData.SetNumUninitialized(VertexCount);
+
+		// Tangent data for SRV: interleaved TangentX + TangentZ (2 x FPackedNormal = 8 bytes per vertex)
+		struct FPackedTangentPair
+		{
+			FPackedNormal TangentX;
+			FPackedNormal TangentZ;
+		};
+		TArray<FPackedTangentPair> TangentData;
+		TangentData.SetNumUninitialized(VertexCount);
+
+		// TexCoord data for SRV
+		// With 2 UV channels, store as float4 per vertex: (UV0.x, UV0.y, UV1.x, UV1.y)
+		TArray<FVector4f> TexCoordData;
+		TexCoordData.SetNumUninitialized(VertexCount);
+
+		for (uint32 i = 0; i < VertexCount; i++)
+		{
+			ColorData[i] = ConvertedVertices[i].Color;
+			TangentData[i].TangentX = ConvertedVertices[i].TangentX;
+			TangentData[i].TangentZ = ConvertedVertices[i].TangentZ;
+			TexCoordData[i] = FVector4f(
+				ConvertedVertices[i].TexCoord.X,
+				ConvertedVertices[i].TexCoord.Y,
+				ConvertedVertices[i].TexCoord1.X,
+				ConvertedVertices[i].TexCoord1.Y
+			);
+		}
+
 		// Create vertex buffer
 		const uint32 ConvertedVertexSize = VertexCount * sizeof(FVoxelLocalVertex);
 		NewRenderData.VertexBufferRHI = RHICmdList.CreateBuffer(
@@ -2241,17 +2318,12 @@ void FVoxelSceneProxy::ProcessBatchUpdate_RenderThread(
 		NewRenderData.TexCoordSRV = RHICmdList.CreateShaderResourceView(NewRenderData.TexCoordBufferRHI, FRHIViewDesc::CreateBufferSRV().SetType(FRHIViewDesc::EBufferType::Typed).SetFormat(PF_G32R32F));
 
 		// Create index buffer directly from CPU data
-		const uint32 IndexBufferSize = IndexCount * sizeof(uint32);
-		NewRenderData.IndexBufferRHI = RHICmdList.CreateBuffer(
-			FRHIBufferCreateDesc::Create(TEXT("VoxelIndexBuffer_Batch"), IndexBufferSize, sizeof(uint32), BUF_Static | BUF_IndexBuffer)
-				.SetInitialState(ERHIAccess::VertexOrIndexBuffer));
-
-		void* IndexData = RHICmdList.LockBuffer(NewRenderData.IndexBufferRHI, 0, IndexBufferSize, RLM_WriteOnly);
-		FMemory::Memcpy(IndexData, Add.Indices.GetData(), IndexBufferSize);
-		RHICmdList.UnlockBuffer(NewRenderData.IndexBufferRHI);
+		NewRenderData.IndexBufferRHI = CreateVoxelIndexBuffer(RHICmdList, TEXT("VoxelIndexBuffer_Batch"), Add.Indices, VertexCount, NewRenderData.IndexStride);
 
 		// Store render data
 		ChunkRenderData.Add(ChunkCoord, NewRenderData);
+		TrackChunkStats(NewRenderData, 1);
+		ChunkCulling.Update(ChunkCoord, GetChunkCullingBounds(NewRenderData));
 
 		// Create and initialize vertex buffer wrapper
 		TSharedPtr<FVoxelLocalVertexBuffer> VertexBufferWrapper = MakeShared<FVoxelLocalVertexBuffer>();
@@ -2283,45 +2355,71 @@ void FVoxelSceneProxy::ProcessBatchUpdate_RenderThread(
 		Adds.Num(), Removals.Num());
 }
 
+// ==================== Render Command Stream ====================
+
+void FVoxelSceneProxy::ApplyRenderCommands_RenderThread(FRHICommandListBase& RHICmdList)
+{
+	check(IsInRenderingThread());
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_VoxelSceneProxy_ApplyRenderCommands);
+
+	CommandStream.Drain(RHICmdList, *this);
+	PublishStats_RenderThread();
+}
+
 // ==================== Statistics ====================
 
-int64 FVoxelSceneProxy::GetTotalVertexCount() const
+void FVoxelSceneProxy::PublishStats_RenderThread()
 {
-	FScopeLock Lock(&ChunkDataLock);
+	check(IsInRenderingThread());
 
-	int64 Total = 0;
-	for (const auto& Pair : ChunkRenderData)
-	{
-		Total += Pair.Value.VertexCount;
-	}
-	return Total;
+	FVoxelSceneProxyStats Stats;
+	Stats.NumChunks = ChunkRenderData.Num();
+	Stats.VertexCount = LiveVertexCount;
+	Stats.TriangleCount = LiveTriangleCount;
+	// Includes meshes retained for active crossfades (transient, released when each fade ends)
+	Stats.GPUMemoryBytes = LiveDedicatedBytes + PreviousDedicatedBytes;
+	// Pooled meshes are covered by their pages' full reservation
+	Stats.BufferPool = ChunkBufferPool.GetStats();
+	Stats.GPUMemoryBytes += Stats.BufferPool.ReservedBytes;
+	Stats.CommandStream = CommandStream.GetStats();
+
+	FScopeLock Lock(&StatsLock);
+	PublishedStats = Stats;
 }
 
-int64 FVoxelSceneProxy::GetTotalTriangleCount() const
+int32 FVoxelSceneProxy::GetChunkCount() const
 {
-	FScopeLock Lock(&ChunkDataLock);
+	FScopeLock Lock(&StatsLock);
+	return PublishedStats.NumChunks;
+}
 
-	int64 Total = 0;
-	for (const auto& Pair : ChunkRenderData)
-	{
-		Total += Pair.Value.IndexCount / 3;
-	}
-	return Total;
+int64 FVoxelSceneProxy::GetTotalVertexCount() const
+{
+	FScopeLock Lock(&StatsLock);
+	return PublishedStats.VertexCount;
+}
+
+int64 FVoxelSceneProxy::GetTotalTriangleCount() const
+{
+	FScopeLock Lock(&StatsLock);
+	return PublishedStats.TriangleCount;
 }
 
 SIZE_T FVoxelSceneProxy::GetGPUMemoryUsage() const
 {
-	FScopeLock Lock(&ChunkDataLock);
+	FScopeLock Lock(&StatsLock);
+	return PublishedStats.GPUMemoryBytes;
+}
 
-	SIZE_T Total = 0;
-	for (const auto& Pair : ChunkRenderData)
-	{
-		Total += Pair.Value.GetGPUMemoryUsage();
-	}
-	// Meshes retained for active crossfades (transient, released when each fade ends)
-	for (const auto& Pair : ChunkPreviousMeshes)
-	{
-		Total += Pair.Value.RenderData.GetGPUMemoryUsage();
-	}
-	return Total;
+FVoxelChunkBufferPoolStats FVoxelSceneProxy::GetChunkBufferPoolStats() const
+{
+	FScopeLock Lock(&StatsLock);
+	return PublishedStats.BufferPool;
+}
+
+FVoxelRenderCommandStreamStats FVoxelSceneProxy::GetRenderCommandStreamStats() const
+{
+	FScopeLock Lock(&StatsLock);
+	return PublishedStats.CommandStream;
 }
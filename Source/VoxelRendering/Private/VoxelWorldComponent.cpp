@@ -134,6 +134,10 @@ void UVoxelWorldComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	AdvanceChunkCrossfades();
+
+	// Submit this tick's fade commands now: the component may tick after the chunk manager's
+	// flush, and MID recycling relies on fade clears reaching the render thread within a tick.
+	FlushPendingOperations();
 }
 
 FBoxSphereBounds UVoxelWorldComponent::CalcBounds(const FTransform& LocalToWorld) const
@@ -257,6 +261,13 @@ void UVoxelWorldComponent::UpdateChunkBuffersFromGPU(const FVoxelChunkGPUData& G
 	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
 	if (Proxy)
 	{
+		// GPU swaps bypass the command stream; submit what this frame recorded so far first
+		// (a clear or removal recorded earlier must not land after this swap)
+		if (HasPendingOperations())
+		{
+			FlushPendingOperations();
+		}
+
 		FVoxelChunkGPUData GPUDataCopy = GPUData;
 
 		ENQUEUE_RENDER_COMMAND(UpdateVoxelChunk)(
@@ -269,7 +280,7 @@ void UVoxelWorldComponent::UpdateChunkBuffersFromGPU(const FVoxelChunkGPUData& G
 
 	if (bCrossfade)
 	{
-		// Attach enqueued after the swap command — ordering is deterministic
+		// Attach recorded after the swap command — it lands with the next flush
 		StartChunkCrossfade(ChunkCoord);
 	}
 	else if (ActiveFades.Contains(ChunkCoord))
@@ -294,6 +305,42 @@ void UVoxelWorldComponent::UpdateChunkBuffersFromCPUData(
 	const uint32 VertexCount = Vertices.Num();
 	const uint32 IndexCount = Indices.Num();
 
+	FPendingChunkAdd PendingAdd;
+	PendingAdd.ChunkCoord = ChunkCoord;
+	PendingAdd.Vertices = MoveTemp(Vertices);
+	PendingAdd.Indices = MoveTemp(Indices);
+	PendingAdd.LODLevel = LODLevel;
+	PendingAdd.LocalBounds = LocalBounds;
+	QueueChunkAdd(MoveTemp(PendingAdd), VertexCount, IndexCount);
+}
+
+void UVoxelWorldComponent::UpdateChunkBuffersFromCPUData(
+	const FIntVector& ChunkCoord,
+	TArray<FVoxelCompactVertex>&& Vertices,
+	const FVoxelCompactVertexFrame& Frame,
+	TArray<uint32>&& Indices,
+	int32 LODLevel,
+	const FBox& LocalBounds)
+{
+	check(IsInGameThread());
+
+	const uint32 VertexCount = Vertices.Num();
+	const uint32 IndexCount = Indices.Num();
+
+	FPendingChunkAdd PendingAdd;
+	PendingAdd.ChunkCoord = ChunkCoord;
+	PendingAdd.CompactVertices = MoveTemp(Vertices);
+	PendingAdd.CompactFrame = Frame;
+	PendingAdd.Indices = MoveTemp(Indices);
+	PendingAdd.LODLevel = LODLevel;
+	PendingAdd.LocalBounds = LocalBounds;
+	QueueChunkAdd(MoveTemp(PendingAdd), VertexCount, IndexCount);
+}
+
+void UVoxelWorldComponent::QueueChunkAdd(FPendingChunkAdd&& PendingAdd, uint32 VertexCount, uint32 IndexCount)
+{
+	const FIntVector ChunkCoord = PendingAdd.ChunkCoord;
+
 	if (VertexCount == 0 || IndexCount == 0)
 	{
 		RemoveChunk(ChunkCoord);
@@ -307,8 +354,8 @@ void UVoxelWorldComponent::UpdateChunkBuffersFromCPUData(
 
 		bChunkExisted = ChunkInfoMap.Contains(ChunkCoord);
 		FChunkInfo& Info = ChunkInfoMap.FindOrAdd(ChunkCoord);
-		Info.Bounds = LocalBounds;
-		Info.LODLevel = LODLevel;
+		Info.Bounds = PendingAdd.LocalBounds;
+		Info.LODLevel = PendingAdd.LODLevel;
 		Info.bIsVisible = true;
 
 		bTotalBoundsDirty = true;
@@ -317,10 +364,10 @@ void UVoxelWorldComponent::UpdateChunkBuffersFromCPUData(
 	// Update statistics
 	CachedVertexCount += VertexCount;
 	CachedTriangleCount += IndexCount / 3;
-	CachedGPUMemory += (VertexCount * sizeof(FVoxelVertex)) + (IndexCount * sizeof(uint32));
+	CachedGPUMemory += (VertexCount * sizeof(FVoxelVertex)) + (IndexCount * GetVoxelIndexStride(VertexCount));
 
 	// Calculate chunk world position (includes WorldOrigin offset)
-	FVector ChunkWorldPos = WorldOrigin + FVector(ChunkCoord) * ChunkWorldSize;
+	PendingAdd.ChunkWorldPosition = WorldOrigin + FVector(ChunkCoord) * ChunkWorldSize;
 
 	// Mesh replacement -> crossfade. The flag rides the pending add into the batched swap;
 	// the fade-state attach below lands BEFORE the flush, which is fine — fading only renders
@@ -328,13 +375,6 @@ void UVoxelWorldComponent::UpdateChunkBuffersFromCPUData(
 	const bool bCrossfade = bChunkExisted && CanCrossfade();
 
 	// Queue for batched submission instead of immediate render command
-	FPendingChunkAdd PendingAdd;
-	PendingAdd.ChunkCoord = ChunkCoord;
-	PendingAdd.Vertices = MoveTemp(Vertices);
-	PendingAdd.Indices = MoveTemp(Indices);
-	PendingAdd.LODLevel = LODLevel;
-	PendingAdd.LocalBounds = LocalBounds;
-	PendingAdd.ChunkWorldPosition = ChunkWorldPos;
 	PendingAdd.bCrossfade = bCrossfade;
 	PendingAdds.Add(MoveTemp(PendingAdd));
 
@@ -401,22 +441,18 @@ void UVoxelWorldComponent::ClearAllChunks()
 	CachedTriangleCount = 0;
 	CachedGPUMemory = 0;
 
-	// Clear any pending batched operations - they're now obsolete
+	// Clear any pending batched operations - they're now obsolete (the clears supersede
+	// every recorded chunk, seam, water and fade command)
 	PendingAdds.Empty();
 	PendingRemovals.Empty();
+	PendingCommands.Reset();
 
-	// Enqueue render thread clear (chunks + water tiles + seam meshes)
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	// Record render thread clear (chunks + water tiles + seam meshes)
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(ClearVoxelChunksAndWater)(
-			[Proxy](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->ClearAllChunks_RenderThread();
-				Proxy->ClearAllWaterTiles_RenderThread();
-				Proxy->ClearAllSeamMeshes_RenderThread();
-			}
-		);
+		PendingCommands.ClearChunks();
+		PendingCommands.ClearWaterTiles();
+		PendingCommands.ClearSeamMeshes();
 	}
 
 	UpdateBounds();
@@ -473,15 +509,9 @@ void UVoxelWorldComponent::UpdateWaterTileFromCPUData(
 		return;
 	}
 
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(UpdateVoxelWaterTile)(
-			[Proxy, TileCoord, Verts = MoveTemp(Vertices), Idxs = MoveTemp(Indices), TileWorldPosition](FRHICommandListImmediate& RHICmdList) mutable
-			{
-				Proxy->UpdateWaterTileFromCPUData_RenderThread(RHICmdList, TileCoord, MoveTemp(Verts), MoveTemp(Idxs), TileWorldPosition);
-			}
-		);
+		PendingCommands.UpdateWaterTile(TileCoord, MoveTemp(Vertices), MoveTemp(Indices), TileWorldPosition);
 	}
 }
 
@@ -489,15 +519,9 @@ void UVoxelWorldComponent::RemoveWaterTile(const FIntVector2& TileCoord)
 {
 	check(IsInGameThread());
 
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(RemoveVoxelWaterTile)(
-			[Proxy, TileCoord](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->RemoveWaterTile_RenderThread(TileCoord);
-			}
-		);
+		PendingCommands.RemoveWaterTile(TileCoord);
 	}
 }
 
@@ -505,15 +529,9 @@ void UVoxelWorldComponent::ClearAllWaterTiles()
 {
 	check(IsInGameThread());
 
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(ClearVoxelWaterTiles)(
-			[Proxy](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->ClearAllWaterTiles_RenderThread();
-			}
-		);
+		PendingCommands.ClearWaterTiles();
 	}
 }
 
@@ -535,15 +553,9 @@ void UVoxelWorldComponent::UpdateSeamMeshFromCPUData(
 		return;
 	}
 
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(UpdateVoxelSeamMesh)(
-			[Proxy, OwnerChunkCoord, Axis, LODLevel, Verts = MoveTemp(Vertices), Idxs = MoveTemp(Indices), OwnerWorldPosition](FRHICommandListImmediate& RHICmdList) mutable
-			{
-				Proxy->UpdateSeamMeshFromCPUData_RenderThread(RHICmdList, OwnerChunkCoord, Axis, LODLevel, MoveTemp(Verts), MoveTemp(Idxs), OwnerWorldPosition);
-			}
-		);
+		PendingCommands.UpdateSeamMesh(OwnerChunkCoord, Axis, LODLevel, MoveTemp(Vertices), MoveTemp(Indices), OwnerWorldPosition);
 	}
 }
 
@@ -551,15 +563,9 @@ void UVoxelWorldComponent::RemoveSeamMesh(const FIntVector& OwnerChunkCoord, uin
 {
 	check(IsInGameThread());
 
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(RemoveVoxelSeamMesh)(
-			[Proxy, OwnerChunkCoord, Axis](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->RemoveSeamMesh_RenderThread(OwnerChunkCoord, Axis);
-			}
-		);
+		PendingCommands.RemoveSeamMesh(OwnerChunkCoord, Axis);
 	}
 }
 
@@ -567,15 +573,9 @@ void UVoxelWorldComponent::ClearAllSeamMeshes()
 {
 	check(IsInGameThread());
 
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(ClearVoxelSeamMeshes)(
-			[Proxy](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->ClearAllSeamMeshes_RenderThread();
-			}
-		);
+		PendingCommands.ClearSeamMeshes();
 	}
 }
 
@@ -595,16 +595,10 @@ void UVoxelWorldComponent::SetChunkVisible(const FIntVector& ChunkCoord, bool bN
 		}
 	}
 
-	// Enqueue render thread update
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	// Record render thread update
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(SetVoxelChunkVisible)(
-			[Proxy, ChunkCoord, bNewVisibility](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->SetChunkVisible_RenderThread(ChunkCoord, bNewVisibility);
-			}
-		);
+		PendingCommands.SetChunkVisible(ChunkCoord, bNewVisibility);
 	}
 }
 
@@ -612,15 +606,9 @@ void UVoxelWorldComponent::UpdateChunkMorphFactor(const FIntVector& ChunkCoord,
 {
 	check(IsInGameThread());
 
-	FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
-	if (Proxy)
+	if (GetVoxelSceneProxy())
 	{
-		ENQUEUE_RENDER_COMMAND(UpdateVoxelMorphFactor)(
-			[Proxy, ChunkCoord, MorphFactor](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->UpdateChunkMorphFactor_RenderThread(ChunkCoord, MorphFactor);
-			}
-		);
+		PendingCommands.SetChunkMorphFactor(ChunkCoord, MorphFactor);
 	}
 }
 
@@ -646,14 +634,12 @@ void UVoxelWorldComponent::SetFadeMaterial(UMaterialInterface* InFadeMaterial)
 		}
 		ActiveFades.Empty();
 
-		if (FVoxelSceneProxy* Proxy = GetVoxelSceneProxy())
+		// Recorded behind any pending attaches, and flushed now so the clear reaches the
+		// render thread before the old MIDs can be garbage collected
+		if (GetVoxelSceneProxy())
 		{
-			ENQUEUE_RENDER_COMMAND(ClearVoxelChunkFades)(
-				[Proxy](FRHICommandListImmediate& RHICmdList)
-				{
-					Proxy->ClearAllChunkFadeStates_RenderThread();
-				}
-			);
+			PendingCommands.ClearAllChunkFades();
+			FlushPendingOperations();
 		}
 	}
 
@@ -711,12 +697,7 @@ void UVoxelWorldComponent::StartChunkCrossfade(const FIntVector& ChunkCoord)
 		RetireFadeMIDs(Fade);
 		ActiveFades.Remove(ChunkCoord);
 
-		ENQUEUE_RENDER_COMMAND(AbortVoxelChunkFade)(
-			[Proxy, ChunkCoord](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->ClearChunkFadeState_RenderThread(ChunkCoord);
-			}
-		);
+		PendingCommands.ClearChunkFade(ChunkCoord);
 		return;
 	}
 
@@ -726,12 +707,7 @@ void UVoxelWorldComponent::StartChunkCrossfade(const FIntVector& ChunkCoord)
 	const FMaterialRenderProxy* FadeInProxy = Fade.InMID->GetRenderProxy();
 	const FMaterialRenderProxy* FadeOutProxy = Fade.OutMID->GetRenderProxy();
 
-	ENQUEUE_RENDER_COMMAND(AttachVoxelChunkFade)(
-		[Proxy, ChunkCoord, FadeInProxy, FadeOutProxy](FRHICommandListImmediate& RHICmdList)
-		{
-			Proxy->SetChunkFadeState_RenderThread(ChunkCoord, FadeInProxy, FadeOutProxy);
-		}
-	);
+	PendingCommands.AttachChunkFade(ChunkCoord, FadeInProxy, FadeOutProxy);
 
 	SetComponentTickEnabled(true);
 }
@@ -746,17 +722,9 @@ void UVoxelWorldComponent::CancelChunkCrossfade(const FIntVector& ChunkCoord, bo
 
 	RetireFadeMIDs(Fade);
 
-	if (bClearRenderState)
+	if (bClearRenderState && GetVoxelSceneProxy())
 	{
-		if (FVoxelSceneProxy* Proxy = GetVoxelSceneProxy())
-		{
-			ENQUEUE_RENDER_COMMAND(ClearVoxelChunkFade)(
-				[Proxy, ChunkCoord](FRHICommandListImmediate& RHICmdList)
-				{
-					Proxy->ClearChunkFadeState_RenderThread(ChunkCoord);
-				}
-			);
-		}
+		PendingCommands.ClearChunkFade(ChunkCoord);
 	}
 }
 
@@ -817,15 +785,10 @@ void UVoxelWorldComponent::AdvanceChunkCrossfades()
 		AlphaBatch.Emplace(FadePair.Key, Alpha);
 	}
 
-	// One batched render command per tick for the proxy-side bookkeeping copies
+	// One batched command per tick for the proxy-side bookkeeping copies
 	if (AlphaBatch.Num() > 0)
 	{
-		ENQUEUE_RENDER_COMMAND(UpdateVoxelFadeAlphas)(
-			[Proxy, Batch = MoveTemp(AlphaBatch)](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->UpdateChunkFadeAlphasBatch_RenderThread(Batch);
-			}
-		);
+		PendingCommands.SetChunkFadeAlphas(MoveTemp(AlphaBatch));
 	}
 
 	for (const FIntVector& ChunkCoord : Completed)
@@ -836,12 +799,7 @@ void UVoxelWorldComponent::AdvanceChunkCrossfades()
 			RetireFadeMIDs(Fade);
 		}
 
-		ENQUEUE_RENDER_COMMAND(CompleteVoxelChunkFade)(
-			[Proxy, ChunkCoord](FRHICommandListImmediate& RHICmdList)
-			{
-				Proxy->ClearChunkFadeState_RenderThread(ChunkCoord);
-			}
-		);
+		PendingCommands.ClearChunkFade(ChunkCoord);
 	}
 
 	if (ActiveFades.Num() == 0 && CoolingFadeInMIDs.Num() == 0 && CoolingFadeOutMIDs.Num() == 0)
@@ -1305,6 +1263,19 @@ int64 UVoxelWorldComponent::GetTotalTriangleCount() const
 	return CachedTriangleCount;
 }
 
+FVoxelChunkBufferPoolStats UVoxelWorldComponent::GetChunkBufferPoolStats() const
+{
+	// The proxy locks its chunk data, so this is safe to read from the game thread
+	const FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
+	return Proxy ? Proxy->GetChunkBufferPoolStats() : FVoxelChunkBufferPoolStats();
+}
+
+FVoxelRenderCommandStreamStats UVoxelWorldComponent::GetRenderCommandStreamStats() const
+{
+	const FVoxelSceneProxy* Proxy = GetVoxelSceneProxy();
+	return Proxy ? Proxy->GetRenderCommandStreamStats() : FVoxelRenderCommandStreamStats();
+}
+
 // ==================== Internal ====================
 
 void UVoxelWorldComponent::SendRenderDynamicData_Concurrent()
@@ -1341,18 +1312,21 @@ void UVoxelWorldComponent::FlushPendingOperations()
 		// No proxy - just clear the pending operations
 		PendingAdds.Empty();
 		PendingRemovals.Empty();
+		PendingCommands.Reset();
 		return;
 	}
 
 	// Convert pending adds to batch format
-	TArray<FVoxelSceneProxy::FBatchChunkAdd> BatchAdds;
+	TArray<FVoxelBatchChunkAdd> BatchAdds;
 	BatchAdds.Reserve(PendingAdds.Num());
 
 	for (FPendingChunkAdd& PendingAdd : PendingAdds)
 	{
-		FVoxelSceneProxy::FBatchChunkAdd BatchAdd;
+		FVoxelBatchChunkAdd BatchAdd;
 		BatchAdd.ChunkCoord = PendingAdd.ChunkCoord;
 		BatchAdd.Vertices = MoveTemp(PendingAdd.Vertices);
+		BatchAdd.CompactVertices = MoveTemp(PendingAdd.CompactVertices);
+		BatchAdd.CompactFrame = PendingAdd.CompactFrame;
 		BatchAdd.Indices = MoveTemp(PendingAdd.Indices);
 		BatchAdd.LODLevel = PendingAdd.LODLevel;
 		BatchAdd.LocalBounds = PendingAdd.LocalBounds;
@@ -1372,14 +1346,27 @@ void UVoxelWorldComponent::FlushPendingOperations()
 	PendingAdds.Empty();
 	PendingRemovals.Empty();
 
-	// Send single batched render command
-	ENQUEUE_RENDER_COMMAND(FlushVoxelBatchUpdate)(
-		[Proxy, BatchAdds = MoveTemp(BatchAdds), BatchRemovals = MoveTemp(BatchRemovals)](FRHICommandListImmediate& RHICmdList) mutable
-		{
-			Proxy->ProcessBatchUpdate_RenderThread(RHICmdList, MoveTemp(BatchAdds), MoveTemp(BatchRemovals));
-		}
-	);
+	// The chunk batch goes last, behind the seam / water / fade commands recorded this frame
+	if (NumAdds > 0 || NumRemovals > 0)
+	{
+		PendingCommands.ApplyChunkBatch(MoveTemp(BatchAdds), MoveTemp(BatchRemovals));
+	}
+
+	const int32 NumCommands = PendingCommands.Num();
+	TUniquePtr<FVoxelRenderCommandPacket> Packet = MakeUnique<FVoxelRenderCommandPacket>(MoveTemp(PendingCommands));
+	PendingCommands.Reset();
+
+	// One drain render command in flight at most; it applies every packet submitted before it runs
+	if (Proxy->GetCommandStream().Submit(MoveTemp(Packet)))
+	{
+		ENQUEUE_RENDER_COMMAND(ApplyVoxelRenderCommands)(
+			[Proxy](FRHICommandListImmediate& RHICmdList)
+			{
+				Proxy->ApplyRenderCommands_RenderThread(RHICmdList);
+			}
+		);
+	}
 
-	UE_LOG(LogVoxelRendering, Verbose, TEXT("UVoxelWorldComponent: Flushed %d adds, %d removals in single batch"),
-		NumAdds, NumRemovals);
+	UE_LOG(LogVoxelRendering, Verbose, TEXT("UVoxelWorldComponent: Flushed %d adds, %d removals in a %d-command packet"),
+		NumAdds, NumRemovals, NumCommands);
 }
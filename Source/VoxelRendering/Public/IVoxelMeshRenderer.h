@@ -111,6 +111,19 @@ public:
 		UpdateChunkMeshFromCPU(ChunkCoord, LODLevel, static_cast<const FChunkMeshData&>(MeshData));
 	}
 
+	/**
+	 * Whether this renderer consumes FChunkMeshData::PackedVertices. When true, the chunk manager
+	 * asks CPU meshers to pack render vertices on their worker threads so the submit above
+	 * skips the per-vertex conversion.
+	 */
+	virtual bool AcceptsPackedVertices() const { return false; }
+
+	/**
+	 * Whether packed vertices may use FVoxelCompactVertex (only meaningful with
+	 * AcceptsPackedVertices). When false, meshers pack plain FVoxelVertex.
+	 */
+	virtual bool AcceptsCompactVertices() const { return false; }
+
 	/**
 	 * Remove chunk mesh from rendering.
 	 *
@@ -0,0 +1,129 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LocalVertexFactory.h"
+#include "VoxelLocalVertexFactory.h"
+#include "VoxelRangeAllocator.h"
+
+/** Occupancy of the pooled chunk buffers (summed over pages) */
+struct FVoxelChunkBufferPoolStats
+{
+	/** Live pages */
+	int32 NumPages = 0;
+
+	/** Chunk meshes currently suballocated */
+	int32 NumChunks = 0;
+
+	/** GPU bytes held by all pages (vertex, color, tangent, texcoord and index buffers) */
+	SIZE_T ReservedBytes = 0;
+
+	/** Bytes covered by live suballocations */
+	SIZE_T UsedBytes = 0;
+
+	/** Vertex range occupancy (units: vertices) */
+	FVoxelRangeAllocatorStats Vertices;
+
+	/** Index range occupancy (units: indices) */
+	FVoxelRangeAllocatorStats Indices;
+};
+
+/**
+ * Shared, suballocated GPU buffers for terrain chunk meshes.
+ *
+ * Instead of five RHI buffers, three SRVs, two wrappers and a vertex factory per chunk, chunks
+ * take a vertex range and an index range out of large pages (FVoxelRangeAllocator bookkeeping)
+ * and upload into them with sub-range locks. Every chunk in a page shares the page's vertex
+ * factory and index buffer, so remeshing a chunk no longer creates or destroys RHI resources.
+ *
+ * Indices are stored rebased (chunk index + vertex range start) in the page index buffer: manual
+ * vertex fetch reads SV_VertexID, which does not honour a per-draw base vertex, so the offset has
+ * to live in the indices themselves. While voxel.Render.Index16 is on, pages are capped at 65536
+ * vertices so the rebased indices stay 16-bit; otherwise the page index buffer is 32-bit.
+ *
+ * A mesh that doesn't fit in an empty page is rejected and the caller falls back to dedicated
+ * buffers. Pages are created on demand and released once empty (the first page is kept).
+ *
+ * Thread Safety: render thread only (owned by FVoxelSceneProxy)
+ */
+class VOXELRENDERING_API FVoxelChunkBufferPool
+{
+public:
+	explicit FVoxelChunkBufferPool(ERHIFeatureLevel::Type InFeatureLevel);
+	~FVoxelChunkBufferPool();
+
+	FVoxelChunkBufferPool(const FVoxelChunkBufferPool&) = delete;
+	FVoxelChunkBufferPool& operator=(const FVoxelChunkBufferPool&) = delete;
+
+	/** voxel.Render.ChunkBufferPool */
+	static bool IsEnabled();
+
+	/**
+	 * Suballocate and upload one chunk mesh.
+	 * On success, fills OutRenderData's pool fields (PoolPageIndex, FirstIndex, BaseVertexIndex,
+	 * IndexStride) and its buffer/SRV refs with the page's, so HasValidBuffers() holds.
+	 *
+	 * @param Vertices World-space vertices
+	 * @param Indices Chunk-relative indices (rebased on upload)
+	 * @return false if the mesh can't be pooled (larger than a page)
+	 */
+	bool AllocateAndUpload(
+		FRHICommandListBase& RHICmdList,
+		TConstArrayView<FVoxelLocalVertex> Vertices,
+		TConstArrayView<uint32> Indices,
+		FVoxelChunkRenderData& OutRenderData);
+
+	/** Return a pooled mesh's ranges to its page. Does not touch RenderData's buffer refs. */
+	void Free(const FVoxelChunkRenderData& RenderData);
+
+	/** Vertex factory shared by every chunk in a page (null for a released page) */
+	const FLocalVertexFactory* GetVertexFactory(int32 PageIndex) const;
+
+	/** Index buffer of a page (null for a released page) */
+	const FVoxelLocalIndexBuffer* GetIndexBuffer(int32 PageIndex) const;
+
+	/** Release every page. Live suballocations become invalid. */
+	void ReleaseAll();
+
+	/** Cached between pool mutations; recomputed (one pass over the pages) only after a change */
+	FVoxelChunkBufferPoolStats GetStats() const;
+
+private:
+	struct FPage
+	{
+		FVoxelRangeAllocator VertexAllocator;
+		FVoxelRangeAllocator IndexAllocator;
+
+		FBufferRHIRef VertexBufferRHI;
+		FBufferRHIRef ColorBufferRHI;
+		FBufferRHIRef TangentBufferRHI;
+		FBufferRHIRef TexCoordBufferRHI;
+		FBufferRHIRef IndexBufferRHI;
+		FShaderResourceViewRHIRef ColorSRV;
+		FShaderResourceViewRHIRef TangentsSRV;
+		FShaderResourceViewRHIRef TexCoordSRV;
+
+		TSharedPtr<FVoxelLocalVertexBuffer> VertexBuffer;
+		TSharedPtr<FVoxelLocalIndexBuffer> IndexBuffer;
+		TSharedPtr<FLocalVertexFactory> VertexFactory;
+
+		/** Page index element size, fixed at creation (GetVoxelIndexStride of the page capacity) */
+		uint32 IndexStride = sizeof(uint32);
+
+		SIZE_T GetReservedBytes() const;
+		void ReleaseResources();
+	};
+
+	/** Create a page sized from the cvar; returns its slot */
+	int32 CreatePage(FRHICommandListBase& RHICmdList);
+
+	/** Pages by index; released pages leave a null slot so PoolPageIndex stays stable */
+	TArray<TUniquePtr<FPage>> Pages;
+
+	ERHIFeatureLevel::Type FeatureLevel;
+
+	/** GetStats snapshot, invalidated by every allocate / free / page change */
+	mutable FVoxelChunkBufferPoolStats CachedStats;
+	mutable bool bStatsDirty = true;
+};
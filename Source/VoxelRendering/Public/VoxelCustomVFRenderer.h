@@ -54,6 +54,8 @@ public:
 		const FIntVector& ChunkCoord,
 		int32 LODLevel,
 		FChunkMeshData&& MeshData) override;
+	virtual bool AcceptsPackedVertices() const override { return true; }
+	virtual bool AcceptsCompactVertices() const override;
 	virtual void RemoveChunk(const FIntVector& ChunkCoord) override;
 	virtual void ClearAllChunks() override;
 
@@ -131,17 +133,15 @@ private:
 		FBufferRHIRef& OutVertexBuffer,
 		FBufferRHIRef& OutIndexBuffer);
 
-	/** Convert FChunkMeshData to FVoxelVertex array, computing local bounds in the same pass */
-	void ConvertToVoxelVertices(
-		const FChunkMeshData& MeshData,
-		TArray<FVoxelVertex>& OutVertices,
-		FBox& OutLocalBounds);
-
-	/** Shared submit body for the copy/move UpdateChunkMeshFromCPU variants */
+	/**
+	 * Shared submit body for the copy/move UpdateChunkMeshFromCPU variants. Packed holds the
+	 * mesher's pre-packed vertices (possibly unpacked, in which case MeshData is converted here).
+	 */
 	void SubmitChunkMeshInternal(
 		const FIntVector& ChunkCoord,
 		int32 LODLevel,
 		const FChunkMeshData& MeshData,
+		FVoxelPackedChunkVertices&& Packed,
 		TArray<uint32>&& Indices);
 
 	/** Calculate chunk bounds from mesh data */
@@ -254,6 +254,9 @@ struct VOXELRENDERING_API FVoxelChunkRenderData
 	/** Number of indices */
 	uint32 IndexCount = 0;
 
+	/** Index element size in bytes: 2 when every index fits in 16 bits (GetVoxelIndexStride), else 4 */
+	uint32 IndexStride = sizeof(uint32);
+
 	/** Local-space bounding box (in absolute world space since positions are world space) */
 	FBox WorldBounds = FBox(ForceInit);
 
@@ -290,6 +293,20 @@ struct VOXELRENDERING_API FVoxelChunkRenderData
 	/** TexCoord SRV for FLocalVertexFactory (needed for GPUScene manual vertex fetch) */
 	FShaderResourceViewRHIRef TexCoordSRV;
 
+	/**
+	 * FVoxelChunkBufferPool page holding this mesh, INDEX_NONE for dedicated buffers. Pooled meshes
+	 * reference the page's shared buffers above and draw from FirstIndex / BaseVertexIndex.
+	 */
+	int32 PoolPageIndex = INDEX_NONE;
+
+	/** First index of this mesh within the (pooled) index buffer */
+	uint32 FirstIndex = 0;
+
+	/** First vertex of this mesh within the (pooled) vertex buffers; pooled indices already include it */
+	uint32 BaseVertexIndex = 0;
+
+	FORCEINLINE bool IsPooled() const { return PoolPageIndex != INDEX_NONE; }
+
 	/** Check if GPU buffers are valid */
 	FORCEINLINE bool HasValidBuffers() const
 	{
@@ -300,7 +317,7 @@ struct VOXELRENDERING_API FVoxelChunkRenderData
 	FORCEINLINE SIZE_T GetGPUMemoryUsage() const
 	{
 		SIZE_T VertexSize = VertexCount * sizeof(FVoxelLocalVertex);
-		SIZE_T IndexSize = IndexCount * sizeof(uint32);
+		SIZE_T IndexSize = IndexCount * IndexStride;
 		SIZE_T ColorSize = VertexCount * sizeof(FColor);
 		SIZE_T TangentSize = VertexCount * 8; // 2 x FPackedNormal (4 bytes each)
 		SIZE_T TexCoordSize = VertexCount * sizeof(FVector2f);
@@ -320,6 +337,9 @@ struct VOXELRENDERING_API FVoxelChunkRenderData
 		IndexBufferRHI.SafeRelease();
 		VertexCount = 0;
 		IndexCount = 0;
+		PoolPageIndex = INDEX_NONE;
+		FirstIndex = 0;
+		BaseVertexIndex = 0;
 	}
 };
 
@@ -405,3 +425,9 @@ void VOXELRENDERING_API InitVoxelLocalVertexFactory(
 	FRHIShaderResourceView* ColorSRV,
 	FRHIShaderResourceView* TangentsSRV = nullptr,
 	FRHIShaderResourceView* TexCoordSRV = nullptr);
+
+/**
+ * Index element size for a mesh with VertexCount vertices: 16-bit when every index fits and
+ * voxel.Render.Index16 is on, otherwise 32-bit. Chunk index buffers are narrowed on upload.
+ */
+uint32 VOXELRENDERING_API GetVoxelIndexStride(uint32 VertexCount);
@@ -0,0 +1,213 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "VoxelVertex.h"
+#include "VoxelCompactVertex.h"
+#include <atomic>
+
+class FMaterialRenderProxy;
+class FRHICommandListBase;
+class FVoxelSceneProxy;
+
+/** One CPU chunk mesh for FVoxelSceneProxy::ProcessBatchUpdate_RenderThread */
+struct FVoxelBatchChunkAdd
+{
+	FIntVector ChunkCoord;
+	TArray<FVoxelVertex> Vertices;
+	/** Quantized alternative to Vertices (used when non-empty; Vertices is then empty) */
+	TArray<FVoxelCompactVertex> CompactVertices;
+	FVoxelCompactVertexFrame CompactFrame;
+	TArray<uint32> Indices;
+	int32 LODLevel;
+	FBox LocalBounds;
+	FVector ChunkWorldPosition;
+	/** Retain the replaced mesh as the crossfade Previous set (decided on the game thread at submit time) */
+	bool bCrossfade = false;
+};
+
+/** Proxy mutation kinds carried by FVoxelRenderCommandPacket */
+enum class EVoxelRenderCommand : uint8
+{
+	ChunkBatch,
+	ClearChunks,
+	SetChunkVisible,
+	SetChunkMorphFactor,
+	AttachChunkFade,
+	SetChunkFadeAlphas,
+	ClearChunkFade,
+	ClearAllChunkFades,
+	UpdateWaterTile,
+	RemoveWaterTile,
+	ClearWaterTiles,
+	UpdateSeamMesh,
+	RemoveSeamMesh,
+	ClearSeamMeshes
+};
+
+/**
+ * One recorded proxy mutation. Fixed-size; bulk data (mesh arrays, alpha batches, chunk
+ * batches) lives in the owning packet's payload arrays and is referenced by PayloadIndex.
+ */
+struct FVoxelRenderCommand
+{
+	EVoxelRenderCommand Type = EVoxelRenderCommand::ClearChunks;
+
+	/** Seam face axis (UpdateSeamMesh / RemoveSeamMesh) */
+	uint8 Axis = 0;
+
+	/** SetChunkVisible */
+	bool bVisible = false;
+
+	/** UpdateSeamMesh */
+	int32 LODLevel = 0;
+
+	/** Index into the packet payload array matching Type, or INDEX_NONE */
+	int32 PayloadIndex = INDEX_NONE;
+
+	/** SetChunkMorphFactor */
+	float Value = 0.0f;
+
+	/** Chunk / seam owner coordinate */
+	FIntVector ChunkCoord = FIntVector::ZeroValue;
+
+	/** Water tile coordinate */
+	FIntVector2 TileCoord = FIntVector2::ZeroValue;
+
+	/** Water tile / seam owner world position */
+	FVector WorldPosition = FVector::ZeroVector;
+
+	/** AttachChunkFade material proxies (owned by the component's pooled MIDs) */
+	const FMaterialRenderProxy* FadeInProxy = nullptr;
+	const FMaterialRenderProxy* FadeOutProxy = nullptr;
+};
+
+/**
+ * One flush worth of proxy mutations, recorded on the game thread in submission order and
+ * replayed on the render thread by FVoxelRenderCommandStream.
+ *
+ * Replaces the per-call ENQUEUE_RENDER_COMMAND traffic for chunk batches, seams, water tiles,
+ * visibility, morph factors and crossfade state: UVoxelWorldComponent records into its pending
+ * packet and hands the whole packet over once per flush. Payloads are moved, never copied.
+ *
+ * Thread Safety: recorded on the game thread, executed on the render thread (never concurrently)
+ */
+class VOXELRENDERING_API FVoxelRenderCommandPacket
+{
+public:
+	// ==================== Recording (Game Thread) ====================
+
+	void ApplyChunkBatch(TArray<FVoxelBatchChunkAdd>&& Adds, TArray<FIntVector>&& Removals);
+	void ClearChunks();
+	void SetChunkVisible(const FIntVector& ChunkCoord, bool bVisible);
+	void SetChunkMorphFactor(const FIntVector& ChunkCoord, float MorphFactor);
+
+	void AttachChunkFade(const FIntVector& ChunkCoord, const FMaterialRenderProxy* FadeInProxy, const FMaterialRenderProxy* FadeOutProxy);
+	void SetChunkFadeAlphas(TArray<TPair<FIntVector, float>>&& Alphas);
+	void ClearChunkFade(const FIntVector& ChunkCoord);
+	void ClearAllChunkFades();
+
+	void UpdateWaterTile(const FIntVector2& TileCoord, TArray<FVoxelVertex>&& Vertices, TArray<uint32>&& Indices, const FVector& TileWorldPosition);
+	void RemoveWaterTile(const FIntVector2& TileCoord);
+	void ClearWaterTiles();
+
+	void UpdateSeamMesh(const FIntVector& OwnerChunkCoord, uint8 Axis, int32 LODLevel, TArray<FVoxelVertex>&& Vertices, TArray<uint32>&& Indices, const FVector& OwnerWorldPosition);
+	void RemoveSeamMesh(const FIntVector& OwnerChunkCoord, uint8 Axis);
+	void ClearSeamMeshes();
+
+	/** Drop every recorded command and payload */
+	void Reset();
+
+	/** Number of recorded commands */
+	int32 Num() const { return Commands.Num(); }
+
+	bool IsEmpty() const { return Commands.Num() == 0; }
+
+	/** Bytes handed to the render thread: command records plus moved payload arrays */
+	int64 GetNumBytes() const { return static_cast<int64>(Commands.Num()) * sizeof(FVoxelRenderCommand) + PayloadBytes; }
+
+	// ==================== Replay (Render Thread) ====================
+
+	/** Apply every command to the proxy in recording order. Consumes the payloads. */
+	void Execute(FRHICommandListBase& RHICmdList, FVoxelSceneProxy& Proxy);
+
+private:
+	struct FMeshPayload
+	{
+		TArray<FVoxelVertex> Vertices;
+		TArray<uint32> Indices;
+	};
+
+	struct FChunkBatchPayload
+	{
+		TArray<FVoxelBatchChunkAdd> Adds;
+		TArray<FIntVector> Removals;
+	};
+
+	FVoxelRenderCommand& AddCommand(EVoxelRenderCommand Type);
+	int32 AddMesh(TArray<FVoxelVertex>&& Vertices, TArray<uint32>&& Indices);
+
+	TArray<FVoxelRenderCommand> Commands;
+	TArray<FMeshPayload> Meshes;
+	TArray<TArray<TPair<FIntVector, float>>> FadeAlphaBatches;
+	TArray<FChunkBatchPayload> ChunkBatches;
+
+	/** Sum of payload array sizes, maintained while recording */
+	int64 PayloadBytes = 0;
+};
+
+/** Render command stream counters (render thread; published through FVoxelSceneProxy stats) */
+struct FVoxelRenderCommandStreamStats
+{
+	/** Commands applied by the most recent drain (one drain per render frame with work) */
+	int32 LastDrainCommands = 0;
+
+	/** Bytes applied by the most recent drain */
+	int64 LastDrainBytes = 0;
+
+	/** Largest single-drain command count */
+	int32 PeakDrainCommands = 0;
+
+	/** Drains that applied at least one packet */
+	int32 NumDrains = 0;
+
+	/** Packets applied (a render-thread stall lets several flushes coalesce into one drain) */
+	int32 NumPackets = 0;
+
+	int64 TotalCommands = 0;
+	int64 TotalBytes = 0;
+};
+
+/**
+ * Single-producer / single-consumer handoff of FVoxelRenderCommandPacket from the game thread
+ * (UVoxelWorldComponent::FlushPendingOperations) to the render thread (FVoxelSceneProxy).
+ *
+ * Packets travel through a lock-free TQueue<EQueueMode::Spsc>. Submit reports whether a drain
+ * render command is already in flight, so however far the render thread lags, at most one
+ * drain is queued and it applies every packet submitted before it runs, in order.
+ */
+class VOXELRENDERING_API FVoxelRenderCommandStream
+{
+public:
+	/**
+	 * Hand a packet to the render thread (game thread).
+	 * @return true if the caller must enqueue a drain (FVoxelSceneProxy::ApplyRenderCommands_RenderThread)
+	 */
+	bool Submit(TUniquePtr<FVoxelRenderCommandPacket>&& Packet);
+
+	/** Apply every submitted packet to the proxy in order (render thread) */
+	void Drain(FRHICommandListBase& RHICmdList, FVoxelSceneProxy& Proxy);
+
+	/** Counters (render thread) */
+	const FVoxelRenderCommandStreamStats& GetStats() const { return Stats; }
+
+private:
+	TQueue<TUniquePtr<FVoxelRenderCommandPacket>, EQueueMode::Spsc> Packets;
+
+	/** Set by Submit when it asks for a drain; cleared by Drain before it starts dequeuing */
+	std::atomic<bool> bDrainPending{ false };
+
+	FVoxelRenderCommandStreamStats Stats;
+};
@@ -8,6 +8,10 @@
 #include "LocalVertexFactory.h"
 #include "VoxelLocalVertexFactory.h"
 #include "VoxelChunkGPUData.h"  // FVoxelChunkGPUData (GPU chunk buffer container)
+#include "VoxelCompactVertex.h"
+#include "VoxelChunkBufferPool.h"
+#include "VoxelChunkCullingSet.h"
+#include "VoxelRenderCommandStream.h"
 
 class UVoxelWorldComponent;
 
@@ -18,8 +22,9 @@ class UVoxelWorldComponent;
  * the outgoing GPU resources are moved here instead of being released, so
  * GetDynamicMeshElements can keep drawing the old mesh (dithering out) alongside the new one
  * (dithering in). Capped to one generation: a second swap during a fade releases the older set.
+ * A pooled outgoing mesh keeps its pool ranges instead (wrappers null; RenderData.IsPooled()).
  *
- * Thread Safety: render thread only (guarded by FVoxelSceneProxy::ChunkDataLock)
+ * Thread Safety: render thread only (owned by FVoxelSceneProxy)
  */
 struct FVoxelChunkPreviousMesh
 {
@@ -63,7 +68,7 @@ struct FVoxelChunkPreviousMesh
  * material; the MIDs carry the animated FadeAlpha/FadeInvert parameters, so the proxies
  * stay valid pointers for the whole fade.
  *
- * Thread Safety: render thread only (guarded by FVoxelSceneProxy::ChunkDataLock)
+ * Thread Safety: render thread only (owned by FVoxelSceneProxy)
  */
 struct FVoxelChunkFadeState
 {
@@ -77,6 +82,23 @@ struct FVoxelChunkFadeState
 	const FMaterialRenderProxy* FadeOutProxy = nullptr;
 };
 
+/**
+ * Game-thread-readable snapshot of FVoxelSceneProxy statistics, republished by the render
+ * thread after each mutation pass so readers never touch the live chunk maps.
+ */
+struct FVoxelSceneProxyStats
+{
+	int32 NumChunks = 0;
+	int64 VertexCount = 0;
+	int64 TriangleCount = 0;
+
+	/** Dedicated chunk buffers, retained crossfade meshes and every reserved pool page */
+	SIZE_T GPUMemoryBytes = 0;
+
+	FVoxelChunkBufferPoolStats BufferPool;
+	FVoxelRenderCommandStreamStats CommandStream;
+};
+
 /**
  * Scene proxy for voxel world rendering.
  *
@@ -86,7 +108,9 @@ struct FVoxelChunkFadeState
  * Manages per-chunk GPU data and issues draw calls via GetDynamicMeshElements.
  * Performs frustum culling at the chunk level for efficient rendering.
  *
- * Thread Safety: All public methods are for render thread only
+ * Thread Safety: All public methods are for render thread only, except GetCommandStream()
+ * (game-thread producer side) and the statistics getters (published snapshot). Chunk state is
+ * owned by the render thread, so GetDynamicMeshElements reads it without locking.
  *
  * @see UVoxelWorldComponent
  * @see Documentation/RENDERING_SYSTEM.md
@@ -175,17 +199,7 @@ public:
 	 * This reduces render command overhead significantly.
 	 * Must be called on render thread.
 	 */
-	struct FBatchChunkAdd
-	{
-		FIntVector ChunkCoord;
-		TArray<FVoxelVertex> Vertices;
-		TArray<uint32> Indices;
-		int32 LODLevel;
-		FBox LocalBounds;
-		FVector ChunkWorldPosition;
-		/** Retain the replaced mesh as the crossfade Previous set (decided on the game thread at submit time) */
-		bool bCrossfade = false;
-	};
+	using FBatchChunkAdd = FVoxelBatchChunkAdd;
 	void ProcessBatchUpdate_RenderThread(
 		FRHICommandListBase& RHICmdList,
 		TArray<FBatchChunkAdd>&& Adds,
@@ -327,10 +341,23 @@ public:
 	/** Clear all face-seam buckets. Must be called on render thread. */
 	void ClearAllSeamMeshes_RenderThread();
 
+	// ==================== Render Command Stream ====================
+
+	/** Game-thread producer side of the per-flush command stream (see FVoxelRenderCommandStream) */
+	FVoxelRenderCommandStream& GetCommandStream() { return CommandStream; }
+
+	/**
+	 * Apply every packet submitted to the command stream, then republish statistics.
+	 * Enqueued by UVoxelWorldComponent::FlushPendingOperations when Submit asks for a drain.
+	 * Must be called on render thread.
+	 */
+	void ApplyRenderCommands_RenderThread(FRHICommandListBase& RHICmdList);
+
 	// ==================== Statistics ====================
+	// Safe from any thread: these read the snapshot published after each mutation pass.
 
 	/** Get number of loaded chunks */
-	int32 GetChunkCount() const { return ChunkRenderData.Num(); }
+	int32 GetChunkCount() const;
 
 	/** Get total vertex count */
 	int64 GetTotalVertexCount() const;
@@ -338,16 +365,22 @@ public:
 	/** Get total triangle count */
 	int64 GetTotalTriangleCount() const;
 
-	/** Get total GPU memory usage */
+	/** Get total GPU memory usage (dedicated chunk buffers plus every reserved pool page) */
 	SIZE_T GetGPUMemoryUsage() const;
 
+	/** Occupancy of the pooled chunk buffers (voxel.Render.ChunkBufferPool) */
+	FVoxelChunkBufferPoolStats GetChunkBufferPoolStats() const;
+
+	/** Command stream counters (commands and bytes per drain) */
+	FVoxelRenderCommandStreamStats GetRenderCommandStreamStats() const;
+
 private:
 	// ==================== Terrain Chunk Data ====================
 
 	/** Per-chunk render data (converted to FLocalVertexFactory format) */
 	TMap<FIntVector, FVoxelChunkRenderData> ChunkRenderData;
 
-	/** Per-chunk vertex buffer wrappers (needed for FLocalVertexFactory::FDataType) */
+	/** Per-chunk vertex buffer wrappers (needed for FLocalVertexFactory::FDataType). Pooled chunks have no wrapper entries. */
 	TMap<FIntVector, TSharedPtr<FVoxelLocalVertexBuffer>> ChunkVertexBuffers;
 
 	/** Per-chunk index buffer wrappers */
@@ -356,6 +389,15 @@ private:
 	/** Per-chunk vertex factories (each chunk needs its own since stream components reference specific buffers) */
 	TMap<FIntVector, TSharedPtr<FLocalVertexFactory>> ChunkVertexFactories;
 
+	/** Flat SoA frustum-culling bounds mirroring ChunkRenderData (kept in sync at every add / remove) */
+	FVoxelChunkCullingSet ChunkCulling;
+
+	/** Per-view culling output, reused across GetDynamicMeshElements calls */
+	mutable TArray<FIntVector> VisibleChunkScratch;
+
+	/** Culling bounds for a chunk: world bounds padded for vertex displacement / LOD morphing (invalid stays invalid) */
+	FBox GetChunkCullingBounds(const FVoxelChunkRenderData& RenderData) const;
+
 	// ==================== Crossfade Data ====================
 
 	/** Retained pre-swap mesh sets for chunks mid-crossfade (sparse — transitioning chunks only) */
@@ -368,15 +410,31 @@ private:
 	 * Remove a chunk's current mesh entry from all maps. With bMoveToPrevious the resources are
 	 * retained in ChunkPreviousMeshes for crossfading (releasing any older Previous first);
 	 * otherwise everything is released. Any stale Previous for the coord is always dropped.
-	 * Caller must hold ChunkDataLock.
 	 */
-	void RetireOrReleaseChunk_AssumesLocked(const FIntVector& ChunkCoord, bool bMoveToPrevious);
+	void RetireOrReleaseChunk(const FIntVector& ChunkCoord, bool bMoveToPrevious);
+
+	/** Release a chunk mesh's buffer refs, returning pooled ranges to ChunkBufferPool first */
+	void ReleaseChunkRenderData(FVoxelChunkRenderData& RenderData);
 
-	/** Release one chunk's retained Previous mesh (if any) and detach its fade state. Caller must hold ChunkDataLock. */
-	void ReleaseChunkFadeState_AssumesLocked(const FIntVector& ChunkCoord);
+	/** ReleaseChunkRenderData for a retained Previous mesh set */
+	void ReleasePreviousMesh(FVoxelChunkPreviousMesh& Previous);
 
-	/** Release every retained Previous mesh and all fade states. Caller must hold ChunkDataLock. */
-	void ReleaseAllChunkFadeStates_AssumesLocked();
+	/**
+	 * Vertex factory and index buffer a chunk mesh draws with: its pool page's when pooled,
+	 * otherwise the given dedicated wrappers. Returns false if either is missing.
+	 */
+	bool ResolveChunkDrawResources(
+		const FVoxelChunkRenderData& RenderData,
+		const TSharedPtr<FLocalVertexFactory>* VertexFactory,
+		const TSharedPtr<FVoxelLocalIndexBuffer>* IndexBuffer,
+		const FVertexFactory*& OutVertexFactory,
+		const FIndexBuffer*& OutIndexBuffer) const;
+
+	/** Release one chunk's retained Previous mesh (if any) and detach its fade state */
+	void ReleaseChunkFadeState(const FIntVector& ChunkCoord);
+
+	/** Release every retained Previous mesh and all fade states */
+	void ReleaseAllChunkFadeStates();
 
 	// ==================== Seam Mesh Data (seam-ownership P1) ====================
 
@@ -456,6 +514,35 @@ private:
 	/** Voxel size in world units */
 	float VoxelSize;
 
-	/** Critical section for thread-safe chunk access */
-	mutable FCriticalSection ChunkDataLock;
+	/** Shared suballocated buffers for batched terrain chunks */
+	FVoxelChunkBufferPool ChunkBufferPool;
+
+	// ==================== Command Stream & Statistics ====================
+
+	/** Game thread -> render thread mutation packets */
+	FVoxelRenderCommandStream CommandStream;
+
+	/** Copy the running totals below (plus pool and stream counters) into PublishedStats (render thread) */
+	void PublishStats_RenderThread();
+
+	/**
+	 * Running totals over ChunkRenderData and ChunkPreviousMeshes, adjusted at every add / remove so
+	 * publishing never walks the maps. Dedicated bytes exclude pooled meshes (their pages are counted whole).
+	 */
+	int64 LiveVertexCount = 0;
+	int64 LiveTriangleCount = 0;
+	SIZE_T LiveDedicatedBytes = 0;
+	SIZE_T PreviousDedicatedBytes = 0;
+
+	/** Add (Sign = 1) or subtract (Sign = -1) a ChunkRenderData entry's totals; call before ReleaseChunkRenderData */
+	void TrackChunkStats(const FVoxelChunkRenderData& RenderData, int32 Sign);
+
+	/** Same for a ChunkPreviousMeshes entry (GPU bytes only; retained meshes are not drawn geometry) */
+	void TrackPreviousMeshStats(const FVoxelChunkPreviousMesh& Previous, int32 Sign);
+
+	/** Last published statistics; the only proxy state game-thread readers touch */
+	FVoxelSceneProxyStats PublishedStats;
+
+	/** Guards PublishedStats only (never taken by the draw path) */
+	mutable FCriticalSection StatsLock;
 };
@@ -6,9 +6,12 @@
 #include "Components/PrimitiveComponent.h"
 #include "VoxelChunkGPUData.h"
 #include "ChunkRenderData.h"
+#include "VoxelCompactVertex.h"
+#include "VoxelRenderCommandStream.h"
 #include "VoxelWorldComponent.generated.h"
 
 class FVoxelSceneProxy;
+struct FVoxelChunkBufferPoolStats;
 class UMaterialInterface;
 class UMaterialInstanceDynamic;
 class UMaterialParameterCollection;
@@ -81,6 +84,26 @@ public:
 		int32 LODLevel,
 		const FBox& LocalBounds);
 
+	/**
+	 * Update chunk from quantized CPU vertices (FVoxelCompactVertex) - FAST PATH, 16 bytes per
+	 * vertex through the pending batch instead of 28. The proxy expands them to FVoxelLocalVertex
+	 * on upload, so the GPU vertex buffer is the same size as the FVoxelVertex path.
+	 *
+	 * @param ChunkCoord Chunk coordinate
+	 * @param Vertices Compact vertex array (will be moved)
+	 * @param Frame Decode parameters for Vertices
+	 * @param Indices CPU index array (will be moved)
+	 * @param LODLevel LOD level of the mesh
+	 * @param LocalBounds Local bounds of the mesh
+	 */
+	void UpdateChunkBuffersFromCPUData(
+		const FIntVector& ChunkCoord,
+		TArray<FVoxelCompactVertex>&& Vertices,
+		const FVoxelCompactVertexFrame& Frame,
+		TArray<uint32>&& Indices,
+		int32 LODLevel,
+		const FBox& LocalBounds);
+
 	/**
 	 * Remove a chunk.
 	 * Enqueues removal to render thread.
@@ -100,6 +123,8 @@ public:
 	/**
 	 * Flush all pending chunk operations as a single batched render command.
 	 * Called once per frame to consolidate multiple add/remove operations.
+	 * Also hands the frame's recorded seam, water, visibility, morph and fade mutations to the
+	 * proxy as one FVoxelRenderCommandPacket.
 	 */
 	void FlushPendingOperations();
 
@@ -371,6 +396,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Voxel|Stats")
 	int64 GetTotalTriangleCount() const;
 
+	/** Occupancy of the scene proxy's pooled chunk buffers (empty stats without a proxy) */
+	FVoxelChunkBufferPoolStats GetChunkBufferPoolStats() const;
+
+	/** Scene proxy command stream counters (empty stats without a proxy) */
+	FVoxelRenderCommandStreamStats GetRenderCommandStreamStats() const;
+
 protected:
 	/** Called when scene proxy is created */
 	virtual void SendRenderDynamicData_Concurrent() override;
@@ -453,6 +484,9 @@ private:
 	{
 		FIntVector ChunkCoord;
 		TArray<FVoxelVertex> Vertices;
+		/** Quantized alternative to Vertices (used when non-empty; Vertices is then empty) */
+		TArray<FVoxelCompactVertex> CompactVertices;
+		FVoxelCompactVertexFrame CompactFrame;
 		TArray<uint32> Indices;
 		int32 LODLevel;
 		FBox LocalBounds;
@@ -462,11 +496,17 @@ private:
 	};
 	TArray<FPendingChunkAdd> PendingAdds;
 
+	/** Shared tail of both UpdateChunkBuffersFromCPUData overloads: tracking, stats, crossfade, queueing */
+	void QueueChunkAdd(FPendingChunkAdd&& PendingAdd, uint32 VertexCount, uint32 IndexCount);
+
 	/** Pending chunk removals (batched) */
 	TArray<FIntVector> PendingRemovals;
 
+	/** Seam, water, visibility, morph and fade mutations recorded since the last flush (in order) */
+	FVoxelRenderCommandPacket PendingCommands;
+
 	/** Whether we have pending operations to flush */
-	bool HasPendingOperations() const { return PendingAdds.Num() > 0 || PendingRemovals.Num() > 0; }
+	bool HasPendingOperations() const { return PendingAdds.Num() > 0 || PendingRemovals.Num() > 0 || !PendingCommands.IsEmpty(); }
 
 	// ==================== Mesh-Swap Crossfade State ====================
 
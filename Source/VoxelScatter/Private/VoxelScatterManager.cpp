@@ -13,7 +13,6 @@
 #include "VoxelBiomeRegistry.h"
 #include "VoxelScatter.h"
 #include "DrawDebugHelpers.h"
-#include "Algo/BinarySearch.h"
 #include "Async/Async.h"
 #include "Engine/World.h"
 #include "Misc/CommandLine.h"
@@ -201,7 +200,6 @@ void UVoxelScatterManager::Shutdown()
 
 	// Clear pending queue and deferred upgrades
 	PendingGenerationQueue.Empty();
-	PendingQueueSet.Empty();
 	DeferredSupplementalPasses.Empty();
 
 	// Clear all cached data
@@ -356,6 +354,12 @@ bool UVoxelScatterManager::HasScatterData(const FIntVector& ChunkCoord) const
 
 void UVoxelScatterManager::OnChunkMeshDataReady(const FIntVector& ChunkCoord, int32 LODLevel, const FChunkMeshData& MeshData,
 	const TArray<FVoxelData>& VoxelData, int32 ChunkSize, float VoxelSize)
+{
+	OnChunkMeshDataReady(ChunkCoord, LODLevel, MeshData, MakeShared<TArray<FVoxelData>>(VoxelData), ChunkSize, VoxelSize);
+}
+
+void UVoxelScatterManager::OnChunkMeshDataReady(const FIntVector& ChunkCoord, int32 LODLevel, const FChunkMeshData& MeshData,
+	TSharedPtr<const TArray<FVoxelData>> VoxelData, int32 ChunkSize, float VoxelSize)
 {
 	if (!bIsInitialized || !Configuration)
 	{
@@ -363,11 +367,12 @@ void UVoxelScatterManager::OnChunkMeshDataReady(const FIntVector& ChunkCoord, in
 	}
 
 	// Voxel data is required for CPU extraction (always full resolution, LOD-independent)
-	const bool bHasVoxelData = VoxelData.Num() == ChunkSize * ChunkSize * ChunkSize;
+	const int32 NumVoxels = VoxelData.IsValid() ? VoxelData->Num() : 0;
+	const bool bHasVoxelData = NumVoxels == ChunkSize * ChunkSize * ChunkSize;
 	if (!bHasVoxelData && !bUseGPUExtraction)
 	{
 		UE_LOG(LogVoxelScatter, Warning, TEXT("Chunk (%d,%d,%d): No voxel data for scatter extraction (expected %d, got %d)"),
-			ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z, ChunkSize * ChunkSize * ChunkSize, VoxelData.Num());
+			ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z, ChunkSize * ChunkSize * ChunkSize, NumVoxels);
 		return;
 	}
 
@@ -455,7 +460,7 @@ void UVoxelScatterManager::OnChunkMeshDataReady(const FIntVector& ChunkCoord, in
 		Req.LODLevel = LODLevel;
 		Req.CapturedDefinitions = DefsToGenerate;
 
-		// Always store voxel data for CPU extraction path
+		// Always store voxel data for CPU extraction path (a reference to the shared snapshot)
 		if (bHasVoxelData)
 		{
 			Req.ChunkVoxelData = VoxelData;
@@ -475,30 +480,26 @@ void UVoxelScatterManager::OnChunkMeshDataReady(const FIntVector& ChunkCoord, in
 	};
 
 	// If already in pending queue: merge new definitions into pending entry
-	if (PendingQueueSet.Contains(ChunkCoord))
+	if (PendingGenerationQueue.Contains(ChunkCoord))
 	{
-		for (FPendingScatterGeneration& Pending : PendingGenerationQueue)
+		PendingGenerationQueue.Modify(ChunkCoord, [&DefsToGenerate](FPendingScatterGeneration& Pending)
 		{
-			if (Pending.ChunkCoord == ChunkCoord)
+			// Build set of already-pending type IDs
+			TSet<int32> PendingTypeIDs;
+			for (const FScatterDefinition& Def : Pending.CapturedDefinitions)
 			{
-				// Build set of already-pending type IDs
-				TSet<int32> PendingTypeIDs;
-				for (const FScatterDefinition& Def : Pending.CapturedDefinitions)
-				{
-					PendingTypeIDs.Add(Def.ScatterID);
-				}
+				PendingTypeIDs.Add(Def.ScatterID);
+			}
 
-				// Add any new definitions not already pending
-				for (const FScatterDefinition& Def : DefsToGenerate)
+			// Add any new definitions not already pending
+			for (const FScatterDefinition& Def : DefsToGenerate)
+			{
+				if (!PendingTypeIDs.Contains(Def.ScatterID))
 				{
-					if (!PendingTypeIDs.Contains(Def.ScatterID))
-					{
-						Pending.CapturedDefinitions.Add(Def);
-					}
+					Pending.CapturedDefinitions.Add(Def);
 				}
-				break;
 			}
-		}
+		});
 		return;
 	}
 
@@ -512,10 +513,7 @@ void UVoxelScatterManager::OnChunkMeshDataReady(const FIntVector& ChunkCoord, in
 	}
 
 	// Queue new scatter generation
-	FPendingScatterGeneration PendingRequest = MakePendingRequest();
-	int32 InsertIndex = Algo::LowerBound(PendingGenerationQueue, PendingRequest);
-	PendingGenerationQueue.Insert(MoveTemp(PendingRequest), InsertIndex);
-	PendingQueueSet.Add(ChunkCoord);
+	PendingGenerationQueue.Push(MakePendingRequest());
 
 	UE_LOG(LogVoxelScatter, Verbose, TEXT("Queued scatter for chunk (%d,%d,%d) %d defs, dist %.0f (queue: %d)"),
 		ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z, DefsToGenerate.Num(),
@@ -525,13 +523,7 @@ void UVoxelScatterManager::OnChunkMeshDataReady(const FIntVector& ChunkCoord, in
 void UVoxelScatterManager::OnChunkUnloaded(const FIntVector& ChunkCoord)
 {
 	// Remove from pending queue if present
-	if (PendingQueueSet.Remove(ChunkCoord) > 0)
-	{
-		PendingGenerationQueue.RemoveAll([&ChunkCoord](const FPendingScatterGeneration& Request)
-		{
-			return Request.ChunkCoord == ChunkCoord;
-		});
-	}
+	PendingGenerationQueue.Remove(ChunkCoord);
 
 	// Remove from async in-progress tracking (stale result will be discarded on arrival)
 	AsyncScatterInProgress.Remove(ChunkCoord);
@@ -562,13 +554,7 @@ void UVoxelScatterManager::RegenerateChunkScatter(const FIntVector& ChunkCoord)
 	}
 
 	// Remove from pending queue if present
-	if (PendingQueueSet.Remove(ChunkCoord) > 0)
-	{
-		PendingGenerationQueue.RemoveAll([&ChunkCoord](const FPendingScatterGeneration& Request)
-		{
-			return Request.ChunkCoord == ChunkCoord;
-		});
-	}
+	PendingGenerationQueue.Remove(ChunkCoord);
 
 	// Remove from async in-progress (stale result will be discarded on arrival)
 	AsyncScatterInProgress.Remove(ChunkCoord);
@@ -698,14 +684,7 @@ void UVoxelScatterManager::ClearScatterInRadius(const FVector& WorldPosition, fl
 				}
 
 				// Also remove from pending queue to prevent stale data
-				if (PendingQueueSet.Contains(ChunkCoord))
-				{
-					PendingQueueSet.Remove(ChunkCoord);
-					PendingGenerationQueue.RemoveAll([&ChunkCoord](const FPendingScatterGeneration& Request)
-					{
-						return Request.ChunkCoord == ChunkCoord;
-					});
-				}
+				PendingGenerationQueue.Remove(ChunkCoord);
 			}
 		}
 	}
@@ -944,7 +923,7 @@ void UVoxelScatterManager::ProcessPendingExclusionRegrow()
 		// interleave with an in-flight (or queued) extraction/stream for the same chunk.
 		if (AsyncScatterInProgress.Contains(ChunkCoord)
 			|| DistanceStreamInProgress.Contains(ChunkCoord)
-			|| PendingQueueSet.Contains(ChunkCoord))
+			|| PendingGenerationQueue.Contains(ChunkCoord))
 		{
 			continue;
 		}
@@ -1137,15 +1116,14 @@ int64 UVoxelScatterManager::GetTotalMemoryUsage() const
 
 	// Pending generation queue
 	Total += PendingGenerationQueue.GetAllocatedSize();
-	for (const auto& Pending : PendingGenerationQueue)
+	PendingGenerationQueue.ForEach([&Total](const FPendingScatterGeneration& Pending)
 	{
-		Total += Pending.ChunkVoxelData.GetAllocatedSize()
+		Total += (Pending.ChunkVoxelData.IsValid() ? Pending.ChunkVoxelData->GetAllocatedSize() : 0)
 			+ Pending.Positions.GetAllocatedSize()
 			+ Pending.Normals.GetAllocatedSize()
 			+ Pending.UV1s.GetAllocatedSize()
 			+ Pending.Colors.GetAllocatedSize();
-	}
-	Total += PendingQueueSet.GetAllocatedSize();
+	});
 
 	// Async in-progress sets
 	Total += AsyncScatterInProgress.GetAllocatedSize();
@@ -1429,7 +1407,7 @@ void UVoxelScatterManager::ProcessPendingGenerationQueue()
 
 	int32 LaunchedCount = 0;
 
-	// Launch from back of queue (closest chunks are at back, due to reversed sort)
+	// Launch closest chunks first
 	for (int32 i = 0; i < NumToLaunch; ++i)
 	{
 		if (PendingGenerationQueue.Num() == 0)
@@ -1437,10 +1415,8 @@ void UVoxelScatterManager::ProcessPendingGenerationQueue()
 			break;
 		}
 
-		// Take last item (closest chunk — O(1) pop from back)
-		FPendingScatterGeneration Request = MoveTemp(PendingGenerationQueue.Last());
-		PendingGenerationQueue.Pop(EAllowShrinking::No);
-		PendingQueueSet.Remove(Request.ChunkCoord);
+		// Take the closest chunk (O(log n) heap pop)
+		FPendingScatterGeneration Request = PendingGenerationQueue.Pop();
 
 		// Launch async scatter generation on thread pool
 		LaunchAsyncScatterGeneration(MoveTemp(Request));
@@ -1758,7 +1734,8 @@ void UVoxelScatterManager::GenerateChunkScatterFromPending(const FPendingScatter
 	}
 
 	// Validate voxel data
-	if (PendingData.ChunkVoxelData.Num() != PendingData.ChunkSize * PendingData.ChunkSize * PendingData.ChunkSize)
+	if (!PendingData.ChunkVoxelData.IsValid()
+		|| PendingData.ChunkVoxelData->Num() != PendingData.ChunkSize * PendingData.ChunkSize * PendingData.ChunkSize)
 	{
 		UE_LOG(LogVoxelScatter, Verbose, TEXT("Chunk (%d,%d,%d): Skipped scatter - invalid voxel data"),
 			ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z);
@@ -1778,7 +1755,7 @@ void UVoxelScatterManager::GenerateChunkScatterFromPending(const FPendingScatter
 	if (bUseCubicExtraction)
 	{
 		ExtractSurfacePointsCubic(
-			PendingData.ChunkVoxelData,
+			*PendingData.ChunkVoxelData,
 			ChunkCoord,
 			ChunkWorldOrigin,
 			PendingData.ChunkSize,
@@ -1791,7 +1768,7 @@ void UVoxelScatterManager::GenerateChunkScatterFromPending(const FPendingScatter
 	else
 	{
 		ExtractSurfacePointsFromVoxelData(
-			PendingData.ChunkVoxelData,
+			*PendingData.ChunkVoxelData,
 			ChunkCoord,
 			ChunkWorldOrigin,
 			PendingData.ChunkSize,
@@ -1911,7 +1888,7 @@ void UVoxelScatterManager::LaunchAsyncScatterGeneration(FPendingScatterGeneratio
 		GPUExtractionPendingLODLevel.Add(ChunkCoord, PendingData.LODLevel);
 
 		// Store voxel data for underground classification of GPU-extracted surface points
-		if (PendingData.ChunkVoxelData.Num() > 0)
+		if (PendingData.ChunkVoxelData.IsValid() && PendingData.ChunkVoxelData->Num() > 0)
 		{
 			FGPUExtractionVoxelInfo VoxelInfo;
 			VoxelInfo.VoxelData = MoveTemp(PendingData.ChunkVoxelData);
@@ -1960,7 +1937,7 @@ void UVoxelScatterManager::LaunchAsyncScatterGeneration(FPendingScatterGeneratio
 
 		// Validate voxel data
 		const int32 ExpectedVoxels = PendingData.ChunkSize * PendingData.ChunkSize * PendingData.ChunkSize;
-		if (PendingData.ChunkVoxelData.Num() != ExpectedVoxels)
+		if (!PendingData.ChunkVoxelData.IsValid() || PendingData.ChunkVoxelData->Num() != ExpectedVoxels)
 		{
 			if (UVoxelScatterManager* This = WeakThis.Get())
 			{
@@ -1974,7 +1951,7 @@ void UVoxelScatterManager::LaunchAsyncScatterGeneration(FPendingScatterGeneratio
 		if (bCubicExtraction)
 		{
 			ExtractSurfacePointsCubic(
-				PendingData.ChunkVoxelData,
+				*PendingData.ChunkVoxelData,
 				ChunkCoord,
 				ChunkWorldOrigin,
 				PendingData.ChunkSize,
@@ -1987,7 +1964,7 @@ void UVoxelScatterManager::LaunchAsyncScatterGeneration(FPendingScatterGeneratio
 		else
 		{
 			ExtractSurfacePointsFromVoxelData(
-				PendingData.ChunkVoxelData,
+				*PendingData.ChunkVoxelData,
 				ChunkCoord,
 				ChunkWorldOrigin,
 				PendingData.ChunkSize,
@@ -2155,9 +2132,7 @@ void UVoxelScatterManager::ProcessCompletedAsyncScatter()
 					Result.ChunkCoord.X, Result.ChunkCoord.Y, Result.ChunkCoord.Z,
 					DeferredPass.CapturedDefinitions.Num());
 
-				int32 InsertIndex = Algo::LowerBound(PendingGenerationQueue, DeferredPass);
-				PendingGenerationQueue.Insert(MoveTemp(DeferredPass), InsertIndex);
-				PendingQueueSet.Add(Result.ChunkCoord);
+				PendingGenerationQueue.Push(MoveTemp(DeferredPass));
 			}
 		}
 	}
@@ -2241,7 +2216,7 @@ void UVoxelScatterManager::ProcessCompletedGPUExtractions()
 		}
 
 		// Retrieve voxel data for underground classification (if available)
-		TArray<FVoxelData> CapturedVoxelData;
+		TSharedPtr<const TArray<FVoxelData>> CapturedVoxelData;
 		int32 CapturedChunkSize = 0;
 		float CapturedVoxelSize = 0.0f;
 		if (FGPUExtractionVoxelInfo* VoxelInfo = GPUExtractionPendingVoxelInfo.Find(ChunkCoord))
@@ -2268,11 +2243,12 @@ void UVoxelScatterManager::ProcessCompletedGPUExtractions()
 		{
 			// Classify GPU-extracted surface points as underground / underwater using voxel data plus
 			// the analytic terrain height and water level (the cross-chunk coverage + water-level fixes).
-			if (CapturedVoxelData.Num() == CapturedChunkSize * CapturedChunkSize * CapturedChunkSize && CapturedChunkSize > 0)
+			if (CapturedVoxelData.IsValid() && CapturedChunkSize > 0
+				&& CapturedVoxelData->Num() == CapturedChunkSize * CapturedChunkSize * CapturedChunkSize)
 			{
 				ClassifySurfacePointsUnderground(
 					SurfaceData.SurfacePoints,
-					CapturedVoxelData,
+					*CapturedVoxelData,
 					CapturedChunkWorldOrigin,
 					CapturedChunkSize,
 					CapturedVoxelSize,
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Containers/Queue.h"
 #include "VoxelData.h"
+#include "VoxelChunkPriorityQueue.h"
 #include "VoxelScatterTypes.h"
 #include "VoxelGPUSurfaceExtractor.h"
 #include "VoxelScatterManager.generated.h"
@@ -211,10 +212,15 @@ public:
 	 * @param ChunkCoord Chunk coordinate
 	 * @param LODLevel LOD level of the mesh (used for GPU extraction fallback)
 	 * @param MeshData The mesh data (used for GPU extraction path only)
-	 * @param VoxelData Full-resolution voxel data for LOD-independent surface extraction
+	 * @param VoxelData Full-resolution voxel data for LOD-independent surface extraction (shared
+	 *        immutable snapshot; held by the pending request / worker instead of copied)
 	 * @param ChunkSize Number of voxels per edge (typically 32)
 	 * @param VoxelSize World-space size of each voxel (typically 100)
 	 */
+	void OnChunkMeshDataReady(const FIntVector& ChunkCoord, int32 LODLevel, const FChunkMeshData& MeshData,
+		TSharedPtr<const TArray<FVoxelData>> VoxelData, int32 ChunkSize, float VoxelSize);
+
+	/** Convenience overload for callers holding a plain array (copies it into a shared snapshot). */
 	void OnChunkMeshDataReady(const FIntVector& ChunkCoord, int32 LODLevel, const FChunkMeshData& MeshData,
 		const TArray<FVoxelData>& VoxelData, int32 ChunkSize, float VoxelSize);
 
@@ -579,8 +585,8 @@ protected:
 		// Definitions to generate (captured at queue time based on distance rules)
 		TArray<FScatterDefinition> CapturedDefinitions;
 
-		// Voxel data for LOD-independent surface extraction (CPU path)
-		TArray<FVoxelData> ChunkVoxelData;
+		// Voxel data for LOD-independent surface extraction (CPU path; shared immutable snapshot)
+		TSharedPtr<const TArray<FVoxelData>> ChunkVoxelData;
 		int32 ChunkSize = VOXEL_DEFAULT_CHUNK_SIZE;
 		float VoxelSize = 100.0f;
 
@@ -589,18 +595,16 @@ protected:
 		TArray<FVector3f> Normals;
 		TArray<FVector2f> UV1s;
 		TArray<FColor> Colors;
-
-		bool operator<(const FPendingScatterGeneration& Other) const
-		{
-			return DistanceToViewer > Other.DistanceToViewer; // Farthest first, closest at back for O(1) pop
-		}
 	};
 
-	/** Queue of pending scatter generations, sorted by distance */
-	TArray<FPendingScatterGeneration> PendingGenerationQueue;
+	/** Pending-queue priority: closest chunk first */
+	struct FPendingScatterPriority
+	{
+		static float Get(const FPendingScatterGeneration& Pending) { return -Pending.DistanceToViewer; }
+	};
 
-	/** Set of chunks in the pending queue (O(1) duplicate check) */
-	TSet<FIntVector> PendingQueueSet;
+	/** Queue of pending scatter generations (indexed heap, closest first; O(1) membership) */
+	TVoxelChunkPriorityQueue<FPendingScatterGeneration, FPendingScatterPriority> PendingGenerationQueue;
 
 	/** Maximum scatter generations per frame (0 = unlimited) */
 	int32 MaxScatterGenerationsPerFrame = 2;
@@ -715,7 +719,7 @@ protected:
 	/** Voxel data stored during GPU extraction dispatch for underground classification */
 	struct FGPUExtractionVoxelInfo
 	{
-		TArray<FVoxelData> VoxelData;
+		TSharedPtr<const TArray<FVoxelData>> VoxelData;
 		int32 ChunkSize = 0;
 		float VoxelSize = 0.0f;
 	};
@@ -7,7 +7,6 @@
 #include "VoxelWorldConfiguration.h"
 #include "VoxelBiomeConfiguration.h"
 #include "VoxelCaveConfiguration.h"
-#include "Algo/BinarySearch.h"
 #include "Async/Async.h"
 #include "Misc/ScopeExit.h"
 #include "VoxelCoordinates.h"
@@ -26,6 +25,8 @@
 #include "VoxelGPUNoiseGenerator.h"
 #include "VoxelEditManager.h"
 #include "VoxelEditTypes.h"
+#include "VoxelChunkCodec.h"
+#include "Misc/Paths.h"
 #include "VoxelWaterPropagation.h"
 #include "VoxelWaterMesher.h"
 #include "VoxelCollisionManager.h"
@@ -298,6 +299,121 @@ static TAutoConsoleVariable<int32> CVarFarCompressionCodec(
 	     "Buffers written by any codec still decode (codec id is stored in the buffer header)."),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarFarCompressionAsync(
+	TEXT("voxel.FarCompression.Async"),
+	1,
+	TEXT("Run far-chunk uniform scans / encodes and pre-decompression on codec workers. 1 = on, 0 = off "
+	     "(game-thread TryCompress under MaxScansPerTick). A finished job is swapped in only if the chunk's "
+	     "content is unchanged since launch."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFarCompressionMaxAsyncJobs(
+	TEXT("voxel.FarCompression.MaxAsyncJobs"),
+	8,
+	TEXT("Max codec jobs in flight (async mode). Replaces MaxScansPerTick as the sweep budget: launching costs "
+	     "the game thread only a snapshot publish. Pre-decompression launches first."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFarCompressionPredecompressLookahead(
+	TEXT("voxel.FarCompression.PredecompressLookahead"),
+	1.0f,
+	TEXT("Seconds of viewer motion to extrapolate when predicting LOD refines (async mode). Compressed chunks "
+	     "that would refine at the extrapolated position, or already await a refine remesh, are decompressed "
+	     "on a worker ahead of the remesh. 0 = only chunks already awaiting a refine."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFarCompressionPreExpandHoldFrames(
+	TEXT("voxel.FarCompression.PreExpandHoldFrames"),
+	180,
+	TEXT("Frames a pre-decompressed chunk stays resident waiting for its refine remesh before the sweep may "
+	     "re-apply its cached compressed form. The hold ends early once the remesh starts. Covers refines "
+	     "deferred past the per-frame LOD remesh cap; ~180 = 3s @ 60fps."),
+	ECVF_Default);
+
+// ==================== LOD-strided generation ====================
+// A chunk generated for a far LOD band is meshed at stride 1<<LOD, so most of its voxels are never read.
+// Strided generation samples half that stride's lattice plus the neighbour-slice apron
+// (FVoxelStridedLattice) — enough for its own lattice reads and a 2:1 finer neighbour's — installs it
+// as a Strided buffer in the Compressed tier, and regenerates on an LOD upgrade past it.
+
+static TAutoConsoleVariable<int32> CVarGenerationLODStride(
+	TEXT("voxel.Generation.LODStride"),
+	0,
+	TEXT("Generate far-LOD chunks on half their mesh stride's lattice instead of every voxel. 1 = on, 0 = off. "
+	     "A chunk at mesh stride S samples ~(S/2)^3 fewer voxels (8x at LOD 2, 64x at LOD 3), not S^3: a 2:1-balanced "
+	     "finer neighbour reads it at S/2. Only takes effect for CPU generation of cave-free heightmap worlds meshed "
+	     "by a lattice-only mesher (CPU Marching Cubes without transition cells) with seam jobs off and "
+	     "voxel.LODBalance and voxel.LODBalanceDiagonal on; Dual Contouring, transvoxel and seam-job "
+	     "configurations generate every voxel. Chunks regenerate when they refine past the stride they were "
+	     "generated at or the gate turns off."),
+	ECVF_Default);
+
+// ==================== Padded apron meshing ====================
+// CPU smooth meshers read out-of-chunk voxels through per-face / edge / corner slice arrays filled
+// voxel-by-voxel on the game thread. The padded layout hands the 26 neighbor snapshots to the job
+// instead and assembles one dense (ChunkSize + 2*apron)^3 volume on the worker with row copies.
+
+static TAutoConsoleVariable<int32> CVarMeshingPaddedApron(
+	TEXT("voxel.Meshing.PaddedApron"),
+	0,
+	TEXT("Mesh CPU Marching Cubes / Dual Contouring chunks (and collision cooks) from a dense padded volume "
+	     "assembled on the worker instead of game-thread neighbor slices. 1 = on, 0 = off. "
+	     "Marching Cubes edge/corner reads then see the real deep apron rather than the depth-0 strip."),
+	ECVF_Default);
+
+// ==================== Chunk persistence I/O ====================
+// With bEnableChunkPersistence, edited chunks round-trip through region files on a worker: dirty
+// chunks go to a bounded write-behind queue, and records for chunks at the head of the generation
+// queue are read ahead so a returning chunk merges its edits (or skips generation) without a stall.
+
+static TAutoConsoleVariable<int32> CVarPersistPrefetchPerTick(
+	TEXT("voxel.Persist.PrefetchPerTick"),
+	16,
+	TEXT("Max record read-aheads queued per tick for the head of the generation queue. Only chunks the "
+	     "saved-chunk index lists are read; 0 disables read-ahead (requests then wait on their own read)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPersistWriteBehindSeconds(
+	TEXT("voxel.Persist.WriteBehindSeconds"),
+	2.0f,
+	TEXT("Interval between write-behind hand-offs of dirty chunks to the persistence worker. "
+	     "Unloading chunks and shutdown always write immediately."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPersistMaxQueuedWrites(
+	TEXT("voxel.Persist.MaxQueuedWrites"),
+	256,
+	TEXT("Bound on distinct chunks waiting in the write-behind queue (read at Initialize). A full queue "
+	     "keeps the chunk dirty (and its edits resident) until the next hand-off."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPersistMaxQueuedReads(
+	TEXT("voxel.Persist.MaxQueuedReads"),
+	128,
+	TEXT("Bound on record reads waiting for the persistence worker (read at Initialize)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPersistCompactDeadRatio(
+	TEXT("voxel.Persist.CompactDeadRatio"),
+	0.5f,
+	TEXT("Region files whose superseded (dead) bytes exceed this fraction of the file are rewritten by the "
+	     "persistence worker's compaction passes (read at Initialize)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPersistCompactEveryWrites(
+	TEXT("voxel.Persist.CompactEveryWrites"),
+	256,
+	TEXT("Chunk writes between compaction passes on the persistence worker (read at Initialize). "
+	     "0 = compact only when persistence flushes (shutdown)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPersistSaveVoxelData(
+	TEXT("voxel.Persist.SaveVoxelData"),
+	0,
+	TEXT("Also store the generated voxels (LZ4) of edited full-resolution chunks when they unload, so they "
+	     "reload without generating. 1 = on, 0 = off (edits only; chunks regenerate and re-merge)."),
+	ECVF_Default);
+
 UVoxelChunkManager::UVoxelChunkManager()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -392,6 +508,18 @@ void UVoxelChunkManager::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 		}
 	}
 
+	// LOD-strided generation is only exact where every voxel a mesher reads is a generated sample:
+	// a mesher with lattice-only reads (the CPU Marching Cubes LOD path without transition cells).
+	// The boundary morph and seam jobs interpolate between lattice points, -VoxelDeepFull widens the
+	// neighbour apron past it, and without the full 26-neighbour 2:1 balance a finer neighbour could
+	// read this chunk below half its stride. Chunks generated while this was on regenerate once it
+	// turns off.
+	bStridedGenerationActive = CVarGenerationLODStride.GetValueOnGameThread() != 0
+		&& !bUseGPUGenerationActive && !bSeamMeshingActive && !bDeepDepthFull
+		&& Configuration && Configuration->bEnableLOD
+		&& Mesher.IsValid() && Mesher->SupportsLatticeOnlyReads()
+		&& LODStrategy && LODStrategy->HasFullNeighborBalance();
+
 	// Drive an active streaming benchmark: advances the bench view position + samples this frame,
 	// before BuildQueryContext picks the position up below. Cleared when the run completes.
 	if (ActiveBenchmark.IsValid())
@@ -474,6 +602,7 @@ void UVoxelChunkManager::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 		const FVector ViewerDelta = CurrentViewerPosition - LastViewerPosForSpeed;
 		const float InstHorizSpeed = FVector2D(ViewerDelta.X, ViewerDelta.Y).Size() / DeltaTime;
 		ViewerHorizSpeed = FMath::FInterpTo(ViewerHorizSpeed, InstHorizSpeed, DeltaTime, 4.0f);
+		ViewerVelocity = FMath::VInterpTo(ViewerVelocity, ViewerDelta / DeltaTime, DeltaTime, 4.0f);
 	}
 	LastViewerPosForSpeed = CurrentViewerPosition;
 
@@ -527,6 +656,15 @@ void UVoxelChunkManager::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 	}
 	Timing.StreamingMs = static_cast<float>((FPlatformTime::Seconds() - SectionStart) * 1000.0);
 
+	// === Chunk persistence (finished reads, read-ahead, write-behind) ===
+	// Before the generation launch so records read last tick merge into this tick's requests.
+	if (Persistence.IsValid())
+	{
+		SectionStart = FPlatformTime::Seconds();
+		TickPersistence();
+		Timing.PersistMs = static_cast<float>((FPlatformTime::Seconds() - SectionStart) * 1000.0);
+	}
+
 	// === Generation queue (async launch + completed result processing) ===
 	// Sub-timed per function so the benchmark CSV can attribute generation-phase cost.
 	SectionStart = FPlatformTime::Seconds();
@@ -693,6 +831,8 @@ void UVoxelChunkManager::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 		CollisionManager->Update(Context.ViewerPosition, DeltaTime);
 		Timing.CollisionPrepMs = CollisionManager->LastPrepMs;
 		Timing.CollisionApplyMs = CollisionManager->LastApplyMs;
+		Timing.CollisionPostProcessMs = CollisionManager->LastPostProcessMs;
+		Timing.CollisionTrianglesRemoved = CollisionManager->LastTrianglesRemoved;
 	}
 	Timing.CollisionMs = static_cast<float>((FPlatformTime::Seconds() - SectionStart) * 1000.0);
 
@@ -799,10 +939,9 @@ void UVoxelChunkManager::Initialize(
 	// Clear any existing state
 	ChunkStates.Empty();
 	LoadedChunkCoords.Empty();
+	++LoadedChunksGeneration;
 	GenerationQueue.Empty();
-	GenerationQueueSet.Empty();
 	MeshingQueue.Empty();
-	MeshingQueueSet.Empty();
 	UnloadQueue.Empty();
 	UnloadQueueSet.Empty();
 
@@ -907,6 +1046,15 @@ void UVoxelChunkManager::Initialize(
 		UE_LOG(LogVoxelStreaming, Warning, TEXT("VoxelForceCPU: forcing CPU generation + CPU mesher (GPU disabled)"));
 	}
 
+	// Renderers that take pre-packed vertices get them built by the CPU meshers on their worker
+	// threads, so the game-thread submit is a move. Compact encoding is only worth attempting for
+	// the smooth meshers' triplanar UVs (cubic per-quad UVs never fit it), and only when the
+	// renderer wants it.
+	const bool bPackVertices = MeshRenderer && MeshRenderer->AcceptsPackedVertices();
+	const EVoxelMeshOutputFormat SmoothOutputFormat = !bPackVertices ? EVoxelMeshOutputFormat::MeshData
+		: MeshRenderer->AcceptsCompactVertices() ? EVoxelMeshOutputFormat::CompactVertices
+		: EVoxelMeshOutputFormat::Vertices;
+
 	// Create mesher based on configuration
 	if (Configuration->MeshingMode == EMeshingMode::MarchingCubes)
 	{
@@ -915,6 +1063,7 @@ void UVoxelChunkManager::Initialize(
 		MeshConfig.IsoLevel = 0.5f;
 		MeshConfig.bCalculateAO = Configuration->bCalculateAO;
 		MeshConfig.UVScale = Configuration->UVScale;
+		MeshConfig.OutputFormat = SmoothOutputFormat;
 
 		// Marching Cubes is triangle-soup (3 verts/tri, no vertex sharing) — a chunk needs far more
 		// vertices than Dual Contouring (~1 vert/cell). Scale the GPU output-buffer budget with chunk
@@ -961,6 +1110,7 @@ void UVoxelChunkManager::Initialize(
 		MeshConfig.IsoLevel = 0.5f;
 		MeshConfig.bCalculateAO = Configuration->bCalculateAO;
 		MeshConfig.UVScale = Configuration->UVScale;
+		MeshConfig.OutputFormat = SmoothOutputFormat;
 
 		// DC uses its own LOD boundary merging, not Transvoxel transition cells
 		MeshConfig.bUseTransvoxel = false;
@@ -997,6 +1147,7 @@ void UVoxelChunkManager::Initialize(
 		MeshConfig.bUseGreedyMeshing = Configuration->bUseGreedyMeshing;
 		MeshConfig.bCalculateAO = Configuration->bCalculateAO;
 		MeshConfig.UVScale = Configuration->UVScale;
+		MeshConfig.OutputFormat = bPackVertices ? EVoxelMeshOutputFormat::Vertices : EVoxelMeshOutputFormat::MeshData;
 		CubicMesher->SetConfig(MeshConfig);
 
 		Mesher = MoveTemp(CubicMesher);
@@ -1108,6 +1259,26 @@ void UVoxelChunkManager::Initialize(
 
 	UE_LOG(LogVoxelStreaming, Log, TEXT("VoxelEditManager created and initialized"));
 
+	// Chunk persistence: edits (and optionally voxels) round-trip through region files on a worker
+	Persistence.Reset();
+	if (Configuration->bEnableChunkPersistence)
+	{
+		FString Directory = Configuration->PersistenceDirectory;
+		if (FPaths::IsRelative(Directory))
+		{
+			Directory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("VoxelWorlds"), Directory);
+		}
+		Persistence = MakeUnique<FVoxelChunkPersistence>(Directory, Configuration->ChunkSize,
+			CVarPersistMaxQueuedWrites.GetValueOnGameThread(), CVarPersistMaxQueuedReads.GetValueOnGameThread(),
+			CVarPersistCompactDeadRatio.GetValueOnGameThread(), CVarPersistCompactEveryWrites.GetValueOnGameThread());
+		LastPersistWriteBehindTime = FPlatformTime::Seconds();
+		ChunksAwaitingPersistRelease.Reset();
+		PersistedPinCandidates.Reset();
+		PersistedPinViewerChunk = FIntVector(INT32_MAX, INT32_MAX, INT32_MAX);
+
+		UE_LOG(LogVoxelStreaming, Log, TEXT("Chunk persistence enabled: %s"), *Directory);
+	}
+
 	// Create collision manager if enabled
 	if (Configuration->bGenerateCollision)
 	{
@@ -1182,6 +1353,7 @@ void UVoxelChunkManager::Shutdown()
 	// Clear state
 	ChunkStates.Empty();
 	LoadedChunkCoords.Empty();
+	++LoadedChunksGeneration;
 	// Seam-ownership: drop all tracked seams/jobs alongside the chunk state they mirror, and
 	// discard the async seam pipeline's transient state (in-flight results will no-op via the
 	// weak manager pointer; late results drain harmlessly next session).
@@ -1197,9 +1369,7 @@ void UVoxelChunkManager::Shutdown()
 		while (CompletedSeamMeshQueue.Dequeue(DiscardedSeamResult)) {}
 	}
 	GenerationQueue.Empty();
-	GenerationQueueSet.Empty();
 	MeshingQueue.Empty();
-	MeshingQueueSet.Empty();
 	UnloadQueue.Empty();
 	UnloadQueueSet.Empty();
 
@@ -1214,6 +1384,8 @@ void UVoxelChunkManager::Shutdown()
 	// Clear async meshing state
 	AsyncMeshingInProgress.Empty();
 	PendingMeshQueue.Empty();
+	PendingCollisionMeshOffers.Empty();
+	CollisionMeshOffers.Empty();
 	{
 		FAsyncMeshResult DiscardedMeshResult;
 		while (CompletedMeshQueue.Dequeue(DiscardedMeshResult)) {}
@@ -1263,6 +1435,11 @@ void UVoxelChunkManager::Shutdown()
 	// Clear pending mesh queue
 	PendingMeshQueue.Empty();
 
+	// Drop far-chunk codec results (late workers still enqueue harmlessly; the next apply re-validates)
+	CompletedFarCodecJobs.Empty();
+	FarCodecJobsInFlight.Empty();
+	FarExpansionRequests.Empty();
+
 	// Shutdown collision manager
 	if (CollisionManager)
 	{
@@ -1280,6 +1457,34 @@ void UVoxelChunkManager::Shutdown()
 	// Shutdown water propagation (before edit manager since it depends on it)
 	WaterPropagation = nullptr;
 
+	// Flush chunk persistence before the edit manager goes: every dirty chunk is written, past the queue bound
+	if (Persistence.IsValid())
+	{
+		if (EditManager)
+		{
+			TArray<FIntVector> DirtyChunks;
+			EditManager->TakePersistDirtyChunks(DirtyChunks);
+			for (const FIntVector& ChunkCoord : DirtyChunks)
+			{
+				FVoxelChunkRecord Record;
+				EditManager->BuildChunkRecord(ChunkCoord, Record);
+				Persistence->QueueWrite(MoveTemp(Record), nullptr, true);
+			}
+		}
+		Persistence->Flush();
+		Persistence->Tick();
+		SettlePersistedWrites();
+
+		const FVoxelChunkPersistenceStats PersistStats = Persistence->GetStats();
+		UE_LOG(LogVoxelStreaming, Log, TEXT("Chunk persistence flushed: %lld chunks written (%.2f MB), %lld read (%.2f MB), %lld write failures, %lld compactions"),
+			PersistStats.ChunksWritten, PersistStats.BytesWritten / (1024.0 * 1024.0),
+			PersistStats.ChunksRead, PersistStats.BytesRead / (1024.0 * 1024.0), PersistStats.WriteFailures,
+			PersistStats.Compactions);
+		Persistence.Reset();
+		ChunksAwaitingPersistRelease.Reset();
+		PersistedPinCandidates.Reset();
+	}
+
 	// Shutdown edit manager
 	if (EditManager)
 	{
@@ -1509,7 +1714,7 @@ FVoxelData UVoxelChunkManager::GetEditMergedVoxelAtWorldPosition(const FVector&
 		if (EditLayer && !EditLayer->IsEmpty())
 		{
 			const int32 Index = State->Descriptor.GetVoxelIndex(LocalPos);
-			if (const FVoxelEdit* Edit = EditLayer->Edits.Find(Index))
+			if (const FVoxelEditDelta* Edit = EditLayer->FindEdit(Index))
 			{
 				Voxel = Edit->ApplyToProceduralData(Voxel);
 			}
@@ -1647,6 +1852,8 @@ FString UVoxelChunkManager::GetDebugStats() const
 		Stats += FString::Printf(TEXT("Empty: %d\n"), Mem.EmptyChunks);
 		Stats += FString::Printf(TEXT("Resident voxel data: %.1f MB\n"), Mem.VoxelDataBytes / (1024.0 * 1024.0));
 		Stats += FString::Printf(TEXT("Reclaimed by compression: %.1f MB\n"), Mem.CompressionSavedBytes / (1024.0 * 1024.0));
+		Stats += FString::Printf(TEXT("Async codec: %d in flight, %lld compacted, %lld pre-decompressed, %lld discarded, %.1f ms worker\n"),
+			Mem.CodecJobsInFlight, Mem.AsyncCompactions, Mem.AsyncExpansions, Mem.AsyncCodecDiscarded, Mem.AsyncCodecWorkerMs);
 	}
 
 	// Seam-ownership registry (P0 scaffolding; seam jobs produce no geometry yet).
@@ -1700,11 +1907,22 @@ UVoxelChunkManager::FVoxelMemoryStats UVoxelChunkManager::GetVoxelMemoryStats()
 			break;
 		}
 	}
+	Stats.CodecJobsInFlight = FarCodecJobsInFlight.Num();
+	Stats.AsyncCompactions = FarCodecCompactionsApplied;
+	Stats.AsyncExpansions = FarCodecExpansionsApplied;
+	Stats.AsyncCodecDiscarded = FarCodecResultsDiscarded;
+	Stats.AsyncCodecWorkerMs = FarCodecWorkerSeconds * 1000.0;
 
 	// Edit manager
 	if (EditManager)
 	{
 		Stats.EditDataBytes = static_cast<int64>(EditManager->GetMemoryUsage());
+		Stats.EditHistoryBytes = static_cast<int64>(EditManager->GetHistoryMemoryUsage());
+		Stats.DenseEditChunks = EditManager->GetDenseLayerCount();
+
+		const FVoxelEditMergeStats& Merge = EditManager->GetMergeStats();
+		Stats.EditMerges = Merge.NumMerges;
+		Stats.EditMergeMs = Merge.LastMs;
 	}
 
 	// Renderer
@@ -1717,7 +1935,7 @@ UVoxelChunkManager::FVoxelMemoryStats UVoxelChunkManager::GetVoxelMemoryStats()
 	// Collision
 	if (CollisionManager)
 	{
-		Stats.CollisionBytes = CollisionManager->GetTotalMemoryUsage();
+		Stats.CollisionBytes = CollisionManager->GetTotalMemoryUsage() + GetCollisionMeshOfferBytes();
 	}
 
 	// Scatter
@@ -1828,6 +2046,7 @@ FLODQueryContext UVoxelChunkManager::BuildQueryContext() const
 			Context.TimeSliceMS = Configuration->StreamingTimeSliceMS;
 		}
 		Context.FrameNumber = CurrentFrame;
+		Context.LoadedChunksGeneration = LoadedChunksGeneration;
 		return Context;
 	}
 
@@ -1926,6 +2145,7 @@ FLODQueryContext UVoxelChunkManager::BuildQueryContext() const
 	}
 
 	Context.FrameNumber = CurrentFrame;
+	Context.LoadedChunksGeneration = LoadedChunksGeneration;
 
 	return Context;
 }
@@ -1987,14 +2207,47 @@ void UVoxelChunkManager::UpdateLoadDecisions(const FLODQueryContext& Context)
 	// a player build above the surface band never qualifies on its own. Left unloaded, its edits
 	// never generate/mesh and its incident seams can't schedule (participant not resident): build
 	// tops get cut off flat at the chunk boundary. Pin every edited chunk within the unload radius.
+	// Chunks whose edits were persisted and released on unload pin the same way.
 	if (EditManager)
 	{
+		const float PinDistance = LODStrategy->GetUnloadDistance();
+		const float ChunkWorldSize = Configuration->GetChunkWorldSize();
+
 		TArray<FIntVector> EditedChunks;
 		EditManager->GetEditedChunkCoords(EditedChunks);
+		if (Persistence.IsValid())
+		{
+			// The persisted set covers every chunk ever edited: only rescan it when the viewer crosses a
+			// chunk (margin: a chunk diagonal, the most the viewer moves before that) or the set changes
+			const FIntVector ViewerChunk = WorldToChunkCoord(Context.ViewerPosition);
+			if (ViewerChunk != PersistedPinViewerChunk || Persistence->GetPersistedChunksGeneration() != PersistedPinGeneration)
+			{
+				PersistedPinViewerChunk = ViewerChunk;
+				PersistedPinGeneration = Persistence->GetPersistedChunksGeneration();
+				PersistedPinCandidates.Reset();
+
+				const float CandidateDistance = PinDistance + ChunkWorldSize * UE_SQRT_3;
+				for (const FIntVector& Coord : Persistence->GetPersistedChunks())
+				{
+					const FVector ChunkCenter = Configuration->WorldOrigin
+						+ FVector(Coord) * ChunkWorldSize + FVector(ChunkWorldSize * 0.5f);
+					if (FVector::DistSquared(ChunkCenter, Context.ViewerPosition) <= FMath::Square(CandidateDistance))
+					{
+						PersistedPinCandidates.Add(Coord);
+					}
+				}
+			}
+
+			for (const FIntVector& Coord : PersistedPinCandidates)
+			{
+				if (!EditManager->ChunkHasEdits(Coord))
+				{
+					EditedChunks.Add(Coord);
+				}
+			}
+		}
 		if (EditedChunks.Num() > 0)
 		{
-			const float PinDistance = LODStrategy->GetUnloadDistance();
-			const float ChunkWorldSize = Configuration->GetChunkWorldSize();
 			for (const FIntVector& Coord : EditedChunks)
 			{
 				if (GetChunkState(Coord) != EChunkState::Unloaded)
@@ -2099,21 +2352,23 @@ void UVoxelChunkManager::ProcessGenerationQueue(float TimeSliceMS)
 	const int32 MaxChunks = ResolveMaxLoadPerFrame();
 	int32 ProcessedCount = 0;
 
+	// Requests whose persisted record is still being read: set aside and re-queued after the loop,
+	// so the chunks behind them keep launching instead of stalling on disk.
+	TArray<FChunkLODRequest> DeferredRequests;
+	const int32 MaxDeferred = MaxChunks * 4;
+
 	while (GenerationQueue.Num() > 0 && ProcessedCount < MaxChunks &&
 	       AsyncGenerationInProgress.Num() < EffectiveMaxAsyncGenerationTasks)
 	{
 		// Skip chunks already being generated asynchronously
-		if (AsyncGenerationInProgress.Contains(GenerationQueue.Last().ChunkCoord))
+		if (AsyncGenerationInProgress.Contains(GenerationQueue.Top().ChunkCoord))
 		{
-			GenerationQueueSet.Remove(GenerationQueue.Last().ChunkCoord);
-			GenerationQueue.Pop(EAllowShrinking::No);
+			GenerationQueue.Pop();
 			continue;
 		}
 
-		// Get highest priority chunk (at back) and remove from queue and tracking set
-		FChunkLODRequest Request = GenerationQueue.Last();
-		GenerationQueue.Pop(EAllowShrinking::No);
-		GenerationQueueSet.Remove(Request.ChunkCoord);
+		// Get highest priority chunk and remove it from the queue
+		FChunkLODRequest Request = GenerationQueue.Pop();
 
 		// Skip if state changed
 		if (GetChunkState(Request.ChunkCoord) != EChunkState::PendingGeneration)
@@ -2121,6 +2376,36 @@ void UVoxelChunkManager::ProcessGenerationQueue(float TimeSliceMS)
 			continue;
 		}
 
+		// Persisted chunks: merge the saved edits first, and skip generation if voxels were saved too.
+		// Only chunks the saved-chunk index lists (or every chunk, until the index lands) wait on a read.
+		// Resident edits are newer than (or equal to) any saved copy.
+		if (Persistence.IsValid() && !(EditManager && EditManager->ChunkHasEdits(Request.ChunkCoord))
+			&& (!Persistence->IsIndexReady() || Persistence->GetPersistedChunks().Contains(Request.ChunkCoord)))
+		{
+			const EVoxelPersistedChunk Persisted = Persistence->Lookup(Request.ChunkCoord);
+			if (Persisted == EVoxelPersistedChunk::Pending || Persisted == EVoxelPersistedChunk::Unknown)
+			{
+				DeferredRequests.Add(Request);
+				if (DeferredRequests.Num() >= MaxDeferred)
+				{
+					break;
+				}
+				continue;
+			}
+			if (Persisted == EVoxelPersistedChunk::Found)
+			{
+				if (ApplyPersistedRecord(Request))
+				{
+					++ProcessedCount;
+					continue;
+				}
+			}
+			else
+			{
+				Persistence->Forget(Request.ChunkCoord);
+			}
+		}
+
 		// Mark as generating
 		SetChunkState(Request.ChunkCoord, EChunkState::Generating);
 
@@ -2179,11 +2464,21 @@ void UVoxelChunkManager::ProcessGenerationQueue(float TimeSliceMS)
 		// Terrain conditioning zones overlapping this chunk (Phase 6c: flatten under POIs/claims)
 		GatherConditioningZonesForChunk(Request.ChunkCoord, GenRequest.ConditioningZones);
 
+		// LOD-strided generation: far chunks only sample the lattice their own and their finer
+		// neighbours' meshers read. The generator falls back to full resolution for the modes it
+		// can't stride (GetEffectiveGenerationStride).
+		GenRequest.GenerationStride = GetGenerationStrideForLOD(GenRequest.LODLevel);
+
 		// Launch async generation on thread pool
 		LaunchAsyncGeneration(Request, MoveTemp(GenRequest));
 
 		++ProcessedCount;
 	}
+
+	for (const FChunkLODRequest& Request : DeferredRequests)
+	{
+		AddToGenerationQueue(Request);
+	}
 }
 
 void UVoxelChunkManager::AddConditioningZone(const FVoxelConditioningZone& Zone)
@@ -2344,9 +2639,10 @@ void UVoxelChunkManager::LaunchAsyncGeneration(const FChunkLODRequest& Request,
 		CapturedNoiseParams, WorldModePtr,
 		CapturedBiomeConfig, CapturedEnableWaterLevel, CapturedWaterLevel]() mutable
 	{
-		// Generate voxel data on background thread
+		// Generate voxel data on background thread (compact lattice layout for a strided request)
 		TArray<FVoxelData> VoxelData;
 		const bool bSuccess = GeneratorPtr->GenerateChunkCPU(GenRequest, VoxelData);
+		const int32 GenerationStride = FVoxelCPUNoiseGenerator::GetEffectiveGenerationStride(GenRequest);
 
 		// Inject voxel trees (runs on same thread pool worker, before enqueue)
 		if (bSuccess && bInjectTrees && WorldModePtr)
@@ -2376,6 +2672,7 @@ void UVoxelChunkManager::LaunchAsyncGeneration(const FChunkLODRequest& Request,
 			if (bSuccess)
 			{
 				Result.VoxelData = MoveTemp(VoxelData);
+				Result.GenerationStride = GenerationStride;
 			}
 			This->CompletedGenerationQueue.Enqueue(MoveTemp(Result));
 		}
@@ -2412,7 +2709,24 @@ void UVoxelChunkManager::ProcessCompletedAsyncGenerations(FVoxelTimingStats& Tim
 			if (State)
 			{
 				double T0 = FPlatformTime::Seconds();
-				State->Descriptor.SetResidentVoxelData(MoveTemp(Result.VoxelData));
+				if (Result.GenerationStride > 1)
+				{
+					// Stays compact until first read; a layout mismatch would be a generator bug — fall
+					// back to the full-resolution path rather than install a misread payload.
+					if (!State->Descriptor.SetStridedVoxelData(MoveTemp(Result.VoxelData), Result.GenerationStride))
+					{
+						UE_LOG(LogVoxelStreaming, Warning, TEXT("Chunk (%d,%d,%d) strided payload (stride %d) has the wrong size; regenerating"),
+							Result.ChunkCoord.X, Result.ChunkCoord.Y, Result.ChunkCoord.Z, Result.GenerationStride);
+						State->Descriptor.ClearVoxelData();
+						SetChunkState(Result.ChunkCoord, EChunkState::Unloaded);
+						++ProcessedCount;
+						continue;
+					}
+				}
+				else
+				{
+					State->Descriptor.SetResidentVoxelData(MoveTemp(Result.VoxelData));
+				}
 				double T1 = FPlatformTime::Seconds();
 				OnChunkGenerationComplete(Result.ChunkCoord);
 				NotifySeconds += FPlatformTime::Seconds() - T1;
@@ -2595,6 +2909,9 @@ void UVoxelChunkManager::ProcessMeshingQueue(float TimeSliceMS, FVoxelTimingStat
 		: FMath::Max(1, Configuration->MaxMeshDispatchPerFrame);
 	int32 ProcessedCount = 0;
 
+	// Padded apron layout applies to meshers that read it (the GPU meshers upload slice arrays).
+	const bool bPaddedApron = UsePaddedApronLayout() && Mesher.IsValid() && Mesher->SupportsPaddedVolume();
+
 	// P2-A: chunks deferred this frame because a face neighbor's voxel data is
 	// still generating. They stay PendingMeshing and are re-queued after the loop
 	// so they retry next frame (when the neighbor's data should be resident),
@@ -2613,17 +2930,14 @@ void UVoxelChunkManager::ProcessMeshingQueue(float TimeSliceMS, FVoxelTimingStat
 		++Examined;
 
 		// Skip chunks already being meshed asynchronously
-		if (AsyncMeshingInProgress.Contains(MeshingQueue.Last().ChunkCoord))
+		if (AsyncMeshingInProgress.Contains(MeshingQueue.Top().ChunkCoord))
 		{
-			MeshingQueueSet.Remove(MeshingQueue.Last().ChunkCoord);
-			MeshingQueue.Pop(EAllowShrinking::No);
+			MeshingQueue.Pop();
 			continue;
 		}
 
-		// Get highest priority chunk (at back) and remove from queue and tracking set
-		FChunkLODRequest Request = MeshingQueue.Last();
-		MeshingQueue.Pop(EAllowShrinking::No);
-		MeshingQueueSet.Remove(Request.ChunkCoord);
+		// Get highest priority chunk and remove it from the queue
+		FChunkLODRequest Request = MeshingQueue.Pop();
 
 		// Skip if state changed
 		if (GetChunkState(Request.ChunkCoord) != EChunkState::PendingMeshing)
@@ -2702,31 +3016,40 @@ void UVoxelChunkManager::ProcessMeshingQueue(float TimeSliceMS, FVoxelTimingStat
 		MeshRequest.ChunkSize = Configuration->ChunkSize;
 		MeshRequest.VoxelSize = Configuration->VoxelSize;
 		MeshRequest.WorldOrigin = Configuration->WorldOrigin;
-		MeshRequest.VoxelData = State->Descriptor.GetVoxelDataForRead();
+		// Far-LOD decimation, run by the CPU smooth meshers on the worker (render meshes only;
+		// collision requests are built separately and never simplify)
+		if (Configuration->bEnableLOD)
+		{
+			const FLODBand* Band = Configuration->GetLODBandForLevel(MeshRequest.LODLevel);
+			if (Band && Band->bSimplifyMesh)
+			{
+				const int32 Stride = 1 << FMath::Clamp(MeshRequest.LODLevel, 0, 7);
+				MeshRequest.Simplify.TargetRatio = FMath::Clamp(Band->SimplifyTargetRatio, 0.01f, 1.0f);
+				MeshRequest.Simplify.MaxError = Band->SimplifyMaxError * Configuration->VoxelSize * Stride;
+			}
+		}
+		// Strided payloads (and their full-resolution neighbours, for consistent shading) are read on the lattice only
+		MeshRequest.bLatticeReads = bStridedGenerationActive;
+		// Zero-copy voxel input: the chunk's published snapshot, or — only when the chunk has
+		// edits — the edit-merged version built once per content version (shared with the seam
+		// and collision paths).
+		MeshRequest.SharedVoxelData = GetSeamVoxelSnapshot(Request.ChunkCoord, *State);
 
-		// Merge edit layer if present
+		bool bMergedEdits = false;
 		if (EditManager && EditManager->ChunkHasEdits(Request.ChunkCoord))
 		{
 			const FChunkEditLayer* EditLayer = EditManager->GetEditLayer(Request.ChunkCoord);
 			if (EditLayer && !EditLayer->IsEmpty())
 			{
-				for (const auto& EditPair : EditLayer->Edits)
-				{
-					const int32 Index = EditPair.Key;
-					const FVoxelEdit& Edit = EditPair.Value;
-					if (MeshRequest.VoxelData.IsValidIndex(Index))
-					{
-						// Apply edit relative to procedural data using edit mode and delta
-						const FVoxelData& ProceduralData = MeshRequest.VoxelData[Index];
-						MeshRequest.VoxelData[Index] = Edit.ApplyToProceduralData(ProceduralData);
-					}
-				}
 				State->Descriptor.bHasEdits = true;
+				bMergedEdits = true;
 
 				UE_LOG(LogVoxelStreaming, Verbose, TEXT("Chunk (%d,%d,%d) merged %d edits from edit layer"),
 					Request.ChunkCoord.X, Request.ChunkCoord.Y, Request.ChunkCoord.Z, EditLayer->GetEditCount());
 			}
 		}
+		// An unedited single-value chunk: the DC mesher only has to check the apron for a surface
+		MeshRequest.bUniformVoxelData = State->Descriptor.bUniformValueValid && !bMergedEdits;
 		double SubT1 = FPlatformTime::Seconds();
 		SnapshotSeconds += SubT1 - SubT0;
 
@@ -2740,6 +3063,11 @@ void UVoxelChunkManager::ProcessMeshingQueue(float TimeSliceMS, FVoxelTimingStat
 		{
 			MeshRequest.MeshCellDomain = EVoxelMeshCellDomain::Interior;
 		}
+		else if (bPaddedApron)
+		{
+			// Snapshot hand-off only; the padded volume is assembled on the mesh worker.
+			GatherPaddedNeighborhood(Request.ChunkCoord, MeshRequest);
+		}
 		else
 		{
 			ExtractNeighborEdgeSlices(Request.ChunkCoord, MeshRequest);
@@ -2777,18 +3105,10 @@ void UVoxelChunkManager::ProcessMeshingQueue(float TimeSliceMS, FVoxelTimingStat
 		// Helper to check if neighbor data was successfully extracted
 		const int32 SliceSize = Configuration->ChunkSize * Configuration->ChunkSize;
 		const int32 ChunkSize = Configuration->ChunkSize;
-		auto HasNeighborData = [&MeshRequest, SliceSize](int32 FaceIndex) -> bool
+		// (FaceIndex is -X,+X,-Y,+Y,-Z,+Z; HasNeighbor uses +X,-X,... and covers the padded layout.)
+		auto HasNeighborData = [&MeshRequest](int32 FaceIndex) -> bool
 		{
-			switch (FaceIndex)
-			{
-				case 0: return MeshRequest.NeighborXNeg.Num() == SliceSize;
-				case 1: return MeshRequest.NeighborXPos.Num() == SliceSize;
-				case 2: return MeshRequest.NeighborYNeg.Num() == SliceSize;
-				case 3: return MeshRequest.NeighborYPos.Num() == SliceSize;
-				case 4: return MeshRequest.NeighborZNeg.Num() == SliceSize;
-				case 5: return MeshRequest.NeighborZPos.Num() == SliceSize;
-				default: return false;
-			}
+			return FaceIndex >= 0 && FaceIndex < 6 && MeshRequest.HasNeighbor(FaceIndex ^ 1);
 		};
 
 		// Helper to check if ALL edge data needed for a transition face is available
@@ -2931,8 +3251,10 @@ void UVoxelChunkManager::ProcessMeshingQueue(float TimeSliceMS, FVoxelTimingStat
 			int32 MissingTransitionFaces = 0;  // active boundary, coarser neighbor, but NO transition set
 			for (int32 i = 0; i < 6; ++i)
 			{
-				const bool bResident = FaceSlices[i]->Num() == SliceSize;
-				const int32 SliceSolid = bResident ? CountSolid(*FaceSlices[i]) : 0;
+				const bool bResident = HasNeighborData(i);
+				// Padded apron layout carries no face slices: slice solidity is unknown (-1).
+				const bool bHasSlice = FaceSlices[i]->Num() == SliceSize;
+				const int32 SliceSolid = bHasSlice ? CountSolid(*FaceSlices[i]) : (bResident ? -1 : 0);
 				const int32 OwnSolid = OwnPlaneSolid(i);
 				// A face can tear only if its own plane straddles the surface
 				// (mix of solid and air). Fully-solid or fully-air planes are safe.
@@ -3017,6 +3339,23 @@ IVoxelMesher* UVoxelChunkManager::EnsureSeamMesher()
 	return SeamMesher.Get();
 }
 
+/** Copy the collision-relevant part of a completed render mesh into an immutable offer (meshing worker / GPU callback). */
+static TSharedPtr<const FVoxelCollisionMeshGeometry> MakeCollisionMeshOffer(const FChunkMeshData& MeshData, int32 LODLevel, uint32 ContentVersion)
+{
+	if (!MeshData.IsValid())
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FVoxelCollisionMeshGeometry> Geometry = MakeShared<FVoxelCollisionMeshGeometry>();
+	Geometry->Positions = MeshData.Positions;
+	Geometry->Indices = MeshData.Indices;
+	Geometry->LODLevel = LODLevel;
+	Geometry->ContentVersion = ContentVersion;
+	Geometry->SkirtIndexStart = MeshData.SkirtIndexStart;
+	return Geometry;
+}
+
 void UVoxelChunkManager::LaunchAsyncMeshGeneration(const FChunkLODRequest& Request, FVoxelMeshingRequest MeshRequest)
 {
 	// Mark as in-progress
@@ -3040,6 +3379,27 @@ void UVoxelChunkManager::LaunchAsyncMeshGeneration(const FChunkLODRequest& Reque
 	const FIntVector ChunkCoord = Request.ChunkCoord;
 	const int32 LODLevel = Request.LODLevel;
 
+	// Collision mesh reuse: when the collision manager will want this chunk at this LOD, the worker
+	// copies positions + indices into a shared offer so the collision cook skips its own meshing
+	// pass. Only plain meshes are offered: seam-ownership interiors carry no boundary cells (the
+	// seam rings close them), Transvoxel transition faces are shaped to the neighbours' LODs rather
+	// than the collision request's, and simplified meshes have moved off the isosurface. Any
+	// untaken offer from an earlier mesh of this chunk is dropped now that it is being re-meshed.
+	bool bOfferCollision = false;
+	uint32 OfferContentVersion = 0;
+	PendingCollisionMeshOffers.Remove(ChunkCoord);
+	CollisionMeshOffers.Remove(ChunkCoord);
+	if (!bSeamMeshingActive && MeshRequest.TransitionFaces == 0 && !MeshRequest.Simplify.IsEnabled()
+		&& CollisionManager && CollisionManager->WantsRenderMeshOffer(ChunkCoord, LODLevel))
+	{
+		if (const FVoxelChunkState* State = ChunkStates.Find(ChunkCoord))
+		{
+			OfferContentVersion = State->Descriptor.ContentVersion;
+			PendingCollisionMeshOffers.Add(ChunkCoord, { LODLevel, OfferContentVersion });
+			bOfferCollision = true;
+		}
+	}
+
 	// Use a weak pointer to safely check if ChunkManager is still valid
 	TWeakObjectPtr<UVoxelChunkManager> WeakThis(this);
 
@@ -3050,7 +3410,7 @@ void UVoxelChunkManager::LaunchAsyncMeshGeneration(const FChunkLODRequest& Reque
 	{
 		// GPU path: async callback (fired from the mesher's game-thread Tick) enqueues the result
 		FOnVoxelMeshingComplete OnComplete;
-		OnComplete.BindLambda([WeakThis, MesherPtr, ChunkCoord, LODLevel](
+		OnComplete.BindLambda([WeakThis, MesherPtr, ChunkCoord, LODLevel, bOfferCollision, OfferContentVersion](
 			FVoxelMeshingHandle Handle, bool bSuccess)
 		{
 			UVoxelChunkManager* This = WeakThis.Get();
@@ -3070,6 +3430,10 @@ void UVoxelChunkManager::LaunchAsyncMeshGeneration(const FChunkLODRequest& Reque
 				if (MesherPtr->ReadbackToCPU(Handle, MeshData))
 				{
 					AsyncResult.bSuccess = true;
+					if (bOfferCollision)
+					{
+						AsyncResult.CollisionGeometry = MakeCollisionMeshOffer(MeshData, LODLevel, OfferContentVersion);
+					}
 					AsyncResult.MeshData = MoveTemp(MeshData);
 				}
 				MesherPtr->ReleaseHandle(Handle);
@@ -3104,8 +3468,14 @@ void UVoxelChunkManager::LaunchAsyncMeshGeneration(const FChunkLODRequest& Reque
 	else
 	{
 		// CPU path: existing thread pool dispatch (unchanged)
-		Async(EAsyncExecution::ThreadPool, [WeakThis, MesherPtr, MeshRequest = MoveTemp(MeshRequest), ChunkCoord, LODLevel]() mutable
+		Async(EAsyncExecution::ThreadPool, [WeakThis, MesherPtr, MeshRequest = MoveTemp(MeshRequest), ChunkCoord, LODLevel, bOfferCollision, OfferContentVersion]() mutable
 		{
+			// Padded apron layout: assemble the dense neighborhood volume off the game thread.
+			if (MeshRequest.PaddedApron > 0)
+			{
+				MeshRequest.AssemblePaddedVolume();
+			}
+
 			// Generate mesh on background thread
 			FChunkMeshData MeshData;
 			const bool bSuccess = MesherPtr->GenerateMeshCPU(MeshRequest, MeshData);
@@ -3119,6 +3489,10 @@ void UVoxelChunkManager::LaunchAsyncMeshGeneration(const FChunkLODRequest& Reque
 				Result.bSuccess = bSuccess;
 				if (bSuccess)
 				{
+					if (bOfferCollision)
+					{
+						Result.CollisionGeometry = MakeCollisionMeshOffer(MeshData, LODLevel, OfferContentVersion);
+					}
 					Result.MeshData = MoveTemp(MeshData);
 				}
 				This->CompletedMeshQueue.Enqueue(MoveTemp(Result));
@@ -3140,6 +3514,16 @@ void UVoxelChunkManager::ProcessCompletedAsyncMeshes()
 
 		// Check if chunk is still in a valid state (might have been unloaded while meshing)
 		const EChunkState CurrentState = GetChunkState(Result.ChunkCoord);
+
+		// Publish the launch's collision offer; TakeCollisionMeshOffer rejects it if the chunk was
+		// edited while meshing. A newer offer replaces an untaken older one.
+		PendingCollisionMeshOffers.Remove(Result.ChunkCoord);
+		if (Result.CollisionGeometry.IsValid() && CurrentState != EChunkState::PendingUnload &&
+			CurrentState != EChunkState::Unloaded)
+		{
+			CollisionMeshOffers.Add(Result.ChunkCoord, MoveTemp(Result.CollisionGeometry));
+		}
+		Result.CollisionGeometry.Reset();
 		if (CurrentState != EChunkState::Meshing)
 		{
 			// State changed while we were meshing. Route through PendingMeshQueue instead of
@@ -3286,9 +3670,14 @@ void UVoxelChunkManager::ProcessUnloadQueue(int32 MaxChunks)
 		// (workers holding snapshot refs stay safe).
 		SeamSnapshotCache.Remove(ChunkCoord);
 		SeamOwnerSlots.Remove(ChunkCoord);
+		PendingCollisionMeshOffers.Remove(ChunkCoord);
+		CollisionMeshOffers.Remove(ChunkCoord);
 
 		// Remove from loaded set
-		LoadedChunkCoords.Remove(ChunkCoord);
+		if (LoadedChunkCoords.Remove(ChunkCoord) > 0)
+		{
+			++LoadedChunksGeneration;
+		}
 
 		// Remove water tile contribution before state is cleared
 		if (Configuration && Configuration->bEnableWaterLevel && Configuration->WaterMeshMaterial)
@@ -3302,6 +3691,9 @@ void UVoxelChunkManager::ProcessUnloadQueue(int32 MaxChunks)
 			ScatterManager->OnChunkUnloaded(ChunkCoord);
 		}
 
+		// Hand the chunk's edits to the write-behind queue and release them (while its descriptor still exists)
+		PersistChunkOnUnload(ChunkCoord);
+
 		// Remove state tracking
 		RemoveChunkState(ChunkCoord);
 
@@ -3342,13 +3734,33 @@ void UVoxelChunkManager::EvaluateLODLevelChanges(const FLODQueryContext& Context
 	};
 	TArray<FLODRemeshCandidate> RemeshCandidates;
 
+	// Far-chunk pre-decompression: a compressed chunk that refines (now, or at the view extrapolated
+	// along the viewer's motion) is expanded on a codec worker before its remesh reads it.
+	const bool bPredictRefines = CVarFarCompressionAsync.GetValueOnGameThread() != 0;
+	const float Lookahead = FMath::Max(0.0f, CVarFarCompressionPredecompressLookahead.GetValueOnGameThread());
+	const bool bLookahead = bPredictRefines && Lookahead > 0.0f && ViewerVelocity.SizeSquared() > 1.0f;
+	FLODQueryContext LookaheadContext = Context;
+	LookaheadContext.ViewerPosition += ViewerVelocity * Lookahead;
+
 	for (const FIntVector& ChunkCoord : LoadedChunkCoords)
 	{
 		const int32 NewLODLevel = LODStrategy->GetLODForChunk(ChunkCoord, Context);
 
 		if (FVoxelChunkState* State = ChunkStates.Find(ChunkCoord))
 		{
-			if (State->LODLevel != NewLODLevel)
+			if (bPredictRefines && State->Descriptor.Residency == EVoxelDataResidency::Compressed)
+			{
+				const int32 RefineLOD = (NewLODLevel < State->LODLevel || !bLookahead)
+					? NewLODLevel : LODStrategy->GetLODForChunk(ChunkCoord, LookaheadContext);
+				// A payload coarser than the refined stride regenerates instead; nothing to expand
+				if (RefineLOD < State->LODLevel && !NeedsRegenerationForLOD(State->Descriptor, RefineLOD))
+				{
+					FarExpansionRequests.Add(ChunkCoord);
+				}
+			}
+
+			// A chunk generated on a coarser lattice than its new stride must also be refreshed
+			if (State->LODLevel != NewLODLevel || NeedsRegenerationForLOD(State->Descriptor, NewLODLevel))
 			{
 				const float ChunkWorldSize = Configuration ? Configuration->GetChunkWorldSize() : 3200.0f;
 				const FVector WorldOrigin = Configuration ? Configuration->WorldOrigin : FVector::ZeroVector;
@@ -3359,7 +3771,8 @@ void UVoxelChunkManager::EvaluateLODLevelChanges(const FLODQueryContext& Context
 				Candidate.ChunkCoord = ChunkCoord;
 				Candidate.NewLODLevel = NewLODLevel;
 				Candidate.Distance = Distance;
-				Candidate.bIsUpgrade = NewLODLevel < State->LODLevel;
+				Candidate.bIsUpgrade = NewLODLevel < State->LODLevel
+					|| NeedsRegenerationForLOD(State->Descriptor, NewLODLevel);
 
 				RemeshCandidates.Add(Candidate);
 			}
@@ -3397,6 +3810,18 @@ void UVoxelChunkManager::EvaluateLODLevelChanges(const FLODQueryContext& Context
 				Request.LODLevel = Candidate.NewLODLevel;
 				Request.Priority = (Candidate.bIsUpgrade ? 100.0f : 50.0f) + (10000.0f / FMath::Max(Candidate.Distance, 1.0f));
 
+				// Strided payload coarser than the new stride: regenerate (the old mesh stays up until the
+				// regenerated chunk re-meshes through the normal generation -> meshing path).
+				if (NeedsRegenerationForLOD(State->Descriptor, Candidate.NewLODLevel))
+				{
+					if (AddToGenerationQueue(Request))
+					{
+						SetChunkState(Candidate.ChunkCoord, EChunkState::PendingGeneration);
+						++QueuedThisFrame;
+					}
+					continue;
+				}
+
 				if (AddToMeshingQueue(Request, EVoxelRemeshReason::LODTransition))
 				{
 					SetChunkState(Candidate.ChunkCoord, EChunkState::PendingMeshing);
@@ -3485,6 +3910,11 @@ void UVoxelChunkManager::SetChunkState(const FIntVector& ChunkCoord, EChunkState
 void UVoxelChunkManager::RemoveChunkState(const FIntVector& ChunkCoord)
 {
 	ChunkStates.Remove(ChunkCoord);
+	FarExpansionRequests.Remove(ChunkCoord);
+	if (Persistence.IsValid())
+	{
+		Persistence->Forget(ChunkCoord);
+	}
 	// Drop any in-flight mesh-dependency snapshot so an unloaded-while-meshing chunk can't leak it.
 	InFlightMeshDeps.Remove(ChunkCoord);
 	// Seam-ownership P0: this chunk's voxel data is gone — restale/prune its incident seams.
@@ -3775,6 +4205,18 @@ void UVoxelChunkManager::ProcessCompletedSeamMeshes()
 
 TSharedPtr<const TArray<FVoxelData>> UVoxelChunkManager::GetSeamVoxelSnapshot(const FIntVector& Coord, FVoxelChunkState& State)
 {
+	// No edits: the descriptor's own published buffer IS the snapshot — shared, never copied. It is
+	// not cached here, so the cache never pins an array the compression sweep has dropped.
+	if (!EditManager || !EditManager->ChunkHasEdits(Coord))
+	{
+		TSharedPtr<const TArray<FVoxelData>> Shared = State.Descriptor.GetSharedVoxelData();
+		if (!Shared.IsValid())
+		{
+			Shared = MakeShared<TArray<FVoxelData>>();
+		}
+		return Shared;
+	}
+
 	const uint32 Version = State.Descriptor.ContentVersion;
 	if (FSeamVoxelSnapshot* Cached = SeamSnapshotCache.Find(Coord))
 	{
@@ -3785,14 +4227,12 @@ TSharedPtr<const TArray<FVoxelData>> UVoxelChunkManager::GetSeamVoxelSnapshot(co
 		}
 	}
 
-	// Build once per (chunk, content version) — the only remaining game-thread voxel copy in the
-	// seam pipeline. ContentVersion covers edits (bumped on explicit voxel edits), so the merged
-	// snapshot stays valid exactly as long as the seams that would read it.
+	// Build once per (chunk, content version) — the only game-thread voxel copy left on the
+	// meshing/seam/collision paths, and only for edited chunks. ContentVersion covers edits
+	// (bumped on explicit voxel edits), so the merged snapshot stays valid exactly as long as
+	// the meshes that would read it.
 	TSharedPtr<TArray<FVoxelData>> Built = MakeShared<TArray<FVoxelData>>(State.Descriptor.GetVoxelDataForRead());
-	if (EditManager && EditManager->ChunkHasEdits(Coord))
-	{
-		EditManager->ApplyEditsToVoxelData(Coord, *Built);
-	}
+	EditManager->ApplyEditsToVoxelData(Coord, *Built);
 
 	FSeamVoxelSnapshot& Entry = SeamSnapshotCache.FindOrAdd(Coord);
 	Entry.ContentVersion = Version;
@@ -3803,6 +4243,33 @@ TSharedPtr<const TArray<FVoxelData>> UVoxelChunkManager::GetSeamVoxelSnapshot(co
 
 void UVoxelChunkManager::ProcessFarCompressionSweep()
 {
+	const bool bAsync = CVarFarCompressionAsync.GetValueOnGameThread() != 0;
+	const int32 MaxAsyncJobs = FMath::Max(1, CVarFarCompressionMaxAsyncJobs.GetValueOnGameThread());
+
+	// Finished codec jobs first: frees worker slots for this tick's launches
+	ProcessCompletedFarCodecJobs();
+
+	// Pre-decompression of predicted refines. Independent of the compress master switch: strided and
+	// persisted payloads arrive Compressed without the sweep.
+	if (bAsync)
+	{
+		for (auto It = FarExpansionRequests.CreateIterator(); It && FarCodecJobsInFlight.Num() < MaxAsyncJobs; ++It)
+		{
+			const FIntVector ChunkCoord = *It;
+			It.RemoveCurrent();
+			const FVoxelChunkState* State = ChunkStates.Find(ChunkCoord);
+			if (State && !FarCodecJobsInFlight.Contains(ChunkCoord)
+				&& State->Descriptor.Residency == EVoxelDataResidency::Compressed)
+			{
+				LaunchAsyncFarExpansion(ChunkCoord, State->Descriptor);
+			}
+		}
+	}
+	else
+	{
+		FarExpansionRequests.Reset();
+	}
+
 	if (CVarFarCompression.GetValueOnGameThread() == 0)
 	{
 		return;
@@ -3812,6 +4279,7 @@ void UVoxelChunkManager::ProcessFarCompressionSweep()
 	const int64 IdleFrames = FMath::Max(0, CVarFarCompressionIdleFrames.GetValueOnGameThread());
 	const int32 MaxScans = FMath::Max(1, CVarFarCompressionMaxScansPerTick.GetValueOnGameThread());
 	const EVoxelChunkCodec Codec = static_cast<EVoxelChunkCodec>(FMath::Clamp(CVarFarCompressionCodec.GetValueOnGameThread(), 0, 5));
+	const int64 HoldFrames = FMath::Max(0, CVarFarCompressionPreExpandHoldFrames.GetValueOnGameThread());
 
 	int32 Budget = 0;
 	for (auto& Pair : ChunkStates)
@@ -3827,6 +4295,10 @@ void UVoxelChunkManager::ProcessFarCompressionSweep()
 		// Idle: LastStateChangeFrame is the frame the chunk entered Loaded; it stays fixed while
 		// settled and resets on any remesh (Loaded -> PendingMeshing -> ... -> Loaded).
 		if ((CurrentFrame - S.LastStateChangeFrame) < IdleFrames) continue;
+		// Pre-decompressed for a predicted refine: leave it resident until the remesh starts or the hold
+		// lapses, or the free re-apply below would undo the expansion before the remesh reads it.
+		if (D.IsPreExpansionHeld(CurrentFrame, S.LastStateChangeFrame, HoldFrames)) continue;
+		D.PreExpandedFrame = INDEX_NONE;
 
 		if (D.bUniformValueValid || D.CompressedVoxelData.Num() > 0)
 		{
@@ -3840,6 +4312,15 @@ void UVoxelChunkManager::ProcessFarCompressionSweep()
 			// Already attempted; neither uniform nor the codec beat raw. Skip until content changes.
 			continue;
 		}
+		if (bAsync)
+		{
+			// Budget is worker concurrency, not game-thread time: a launch only publishes a snapshot.
+			if (FarCodecJobsInFlight.Num() < MaxAsyncJobs && !FarCodecJobsInFlight.Contains(Pair.Key))
+			{
+				LaunchAsyncFarCompaction(Pair.Key, D, Codec);
+			}
+			continue;
+		}
 		if (Budget >= MaxScans)
 		{
 			// Out of budget this tick; retry next tick (bCompressionEvaluated stays false).
@@ -3850,6 +4331,98 @@ void UVoxelChunkManager::ProcessFarCompressionSweep()
 	}
 }
 
+void UVoxelChunkManager::LaunchAsyncFarCompaction(const FIntVector& ChunkCoord, FChunkDescriptor& Descriptor, EVoxelChunkCodec Codec)
+{
+	FFarCodecResult Job;
+	Job.ChunkCoord = ChunkCoord;
+	if (!Descriptor.BeginAsyncCompaction(Job.Compaction))
+	{
+		return;
+	}
+	FarCodecJobsInFlight.Add(ChunkCoord);
+
+	TWeakObjectPtr<UVoxelChunkManager> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Job = MoveTemp(Job), Codec]() mutable
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		FChunkDescriptor::EncodeAsyncCompaction(Job.Compaction, Codec);
+		Job.WorkerSeconds = FPlatformTime::Seconds() - StartTime;
+
+		if (UVoxelChunkManager* This = WeakThis.Get())
+		{
+			This->CompletedFarCodecJobs.Enqueue(MoveTemp(Job));
+		}
+	});
+}
+
+void UVoxelChunkManager::LaunchAsyncFarExpansion(const FIntVector& ChunkCoord, const FChunkDescriptor& Descriptor)
+{
+	FFarCodecResult Job;
+	Job.ChunkCoord = ChunkCoord;
+	Job.bExpansion = true;
+	if (!Descriptor.BeginAsyncExpansion(Job.Expansion))
+	{
+		return;
+	}
+	FarCodecJobsInFlight.Add(ChunkCoord);
+
+	TWeakObjectPtr<UVoxelChunkManager> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Job = MoveTemp(Job)]() mutable
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		FChunkDescriptor::DecodeAsyncExpansion(Job.Expansion);
+		Job.WorkerSeconds = FPlatformTime::Seconds() - StartTime;
+
+		if (UVoxelChunkManager* This = WeakThis.Get())
+		{
+			This->CompletedFarCodecJobs.Enqueue(MoveTemp(Job));
+		}
+	});
+}
+
+void UVoxelChunkManager::ProcessCompletedFarCodecJobs()
+{
+	FFarCodecResult Result;
+	while (CompletedFarCodecJobs.Dequeue(Result))
+	{
+		FarCodecJobsInFlight.Remove(Result.ChunkCoord);
+		FarCodecWorkerSeconds += Result.WorkerSeconds;
+
+		FVoxelChunkState* State = ChunkStates.Find(Result.ChunkCoord);
+		if (!State)
+		{
+			++FarCodecResultsDiscarded;
+			continue;
+		}
+		FChunkDescriptor& D = State->Descriptor;
+
+		if (Result.bExpansion)
+		{
+			if (D.ApplyAsyncExpansion(MoveTemp(Result.Expansion), CurrentFrame))
+			{
+				++FarCodecExpansionsApplied;
+			}
+			else
+			{
+				++FarCodecResultsDiscarded;
+			}
+			continue;
+		}
+
+		// Content changed, or the chunk left the settled state (a remesh would decompress it straight
+		// back on the game thread): keep it resident and let the sweep re-qualify it.
+		if (!D.IsAsyncCompactionCurrent(Result.Compaction) || State->State != EChunkState::Loaded || D.bIsDirty)
+		{
+			++FarCodecResultsDiscarded;
+			continue;
+		}
+		if (D.ApplyAsyncCompaction(MoveTemp(Result.Compaction)))
+		{
+			++FarCodecCompactionsApplied;
+		}
+	}
+}
+
 // ==================== Generation/Meshing Callbacks ====================
 
 void UVoxelChunkManager::OnChunkGenerationComplete(const FIntVector& ChunkCoord)
@@ -3985,6 +4558,7 @@ void UVoxelChunkManager::OnChunkMeshingComplete(const FIntVector& ChunkCoord)
 				TEXT("Chunk (%d,%d,%d) mesh submitted but chunk in unexpected state %d — forcing to Loaded"),
 				ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z, static_cast<int32>(State->State));
 			LoadedChunkCoords.Add(ChunkCoord);
+			++LoadedChunksGeneration;
 			State->Descriptor.bIsDirty = false;
 			SetChunkState(ChunkCoord, EChunkState::Loaded);
 			OnChunkLoaded.Broadcast(ChunkCoord);
@@ -4023,21 +4597,12 @@ void UVoxelChunkManager::OnChunkMeshingComplete(const FIntVector& ChunkCoord)
 			const double ScatT0 = FPlatformTime::Seconds();
 
 			// Scatter must classify against the terrain the player actually sees. When the
-			// chunk has edits (player dig/build, POI, editor), merge them into a scratch copy
-			// so scatter extracts from edit-merged voxels — otherwise grass can cover a dug
-			// cave opening or mushrooms can appear on a carved-flat surface.
-			if (EditManager && EditManager->ChunkHasEdits(ChunkCoord))
-			{
-				TArray<FVoxelData> EditMergedVoxels = State->Descriptor.GetVoxelDataForRead();
-				EditManager->ApplyEditsToVoxelData(ChunkCoord, EditMergedVoxels);
-				ScatterManager->OnChunkMeshDataReady(ChunkCoord, PendingMesh.LODLevel, PendingMesh.MeshData,
-					EditMergedVoxels, State->Descriptor.ChunkSize, Configuration->VoxelSize);
-			}
-			else
-			{
-				ScatterManager->OnChunkMeshDataReady(ChunkCoord, PendingMesh.LODLevel, PendingMesh.MeshData,
-					State->Descriptor.GetVoxelDataForRead(), State->Descriptor.ChunkSize, Configuration->VoxelSize);
-			}
+			// chunk has edits (player dig/build, POI, editor), the shared snapshot is the
+			// edit-merged version — otherwise grass can cover a dug cave opening or mushrooms
+			// can appear on a carved-flat surface. Either way it is the buffer the mesh job
+			// just read, handed over without a copy.
+			ScatterManager->OnChunkMeshDataReady(ChunkCoord, PendingMesh.LODLevel, PendingMesh.MeshData,
+				GetSeamVoxelSnapshot(ChunkCoord, *State), State->Descriptor.ChunkSize, Configuration->VoxelSize);
 			SubmitScatterSecondsThisTick += FPlatformTime::Seconds() - ScatT0;
 		}
 
@@ -4132,6 +4697,7 @@ void UVoxelChunkManager::OnChunkMeshingComplete(const FIntVector& ChunkCoord)
 
 	// Mark as loaded
 	LoadedChunkCoords.Add(ChunkCoord);
+	++LoadedChunksGeneration;
 	State->Descriptor.bIsDirty = false;
 	SetChunkState(ChunkCoord, EChunkState::Loaded);
 
@@ -4858,9 +5424,9 @@ void UVoxelChunkManager::ExtractNeighborEdgeSlices(const FIntVector& ChunkCoord,
 		}
 
 		const int32 Index = X + Y * ChunkSize + Z * ChunkSize * ChunkSize;
-		// Residency was forced once at cache fill (bHasData ⇒ resident), so read the raw array
-		// directly here — the memoized per-voxel hot path must not route through an accessor.
-		const TArray<FVoxelData>& Voxels = Cache.State->Descriptor.VoxelData;
+		// Residency was forced once at cache fill (bHasData ⇒ resident), so read the resident array
+		// directly here — the memoized per-voxel hot path must not route through EnsureResident.
+		const TArray<FVoxelData>& Voxels = Cache.State->Descriptor.GetResidentArray();
 		if (!Voxels.IsValidIndex(Index))
 		{
 			return FVoxelData::Air();
@@ -4871,7 +5437,7 @@ void UVoxelChunkManager::ExtractNeighborEdgeSlices(const FIntVector& ChunkCoord,
 		// Apply edit if present (using cached edit layer)
 		if (Cache.EditLayer)
 		{
-			if (const FVoxelEdit* Edit = Cache.EditLayer->GetEdit(FIntVector(X, Y, Z)))
+			if (const FVoxelEditDelta* Edit = Cache.EditLayer->FindEdit(Index))
 			{
 				Result = Edit->ApplyToProceduralData(Result);
 			}
@@ -4892,30 +5458,230 @@ void UVoxelChunkManager::ExtractNeighborEdgeSlices(const FIntVector& ChunkCoord,
 		HasNeighborData, GetNeighborVoxel, OutRequest);
 }
 
-// ==================== Queue Management ====================
+bool UVoxelChunkManager::UsePaddedApronLayout() const
+{
+	return CVarMeshingPaddedApron.GetValueOnGameThread() != 0
+		&& Configuration && Configuration->MeshingMode != EMeshingMode::Cubic;
+}
 
-bool UVoxelChunkManager::AddToGenerationQueue(const FChunkLODRequest& Request)
+int32 UVoxelChunkManager::GetGenerationStrideForLOD(int32 LODLevel) const
 {
-	// O(1) duplicate check
-	if (GenerationQueueSet.Contains(Request.ChunkCoord))
+	// Half the mesh stride: a 2:1-balanced finer neighbour reads this chunk's face planes and
+	// deep apron at that stride, so LOD 1 (and below) always generates every voxel.
+	const int32 ClampedLOD = FMath::Clamp(LODLevel, 0, 7);
+	return (bStridedGenerationActive && ClampedLOD >= 2) ? 1 << (ClampedLOD - 1) : 1;
+}
+
+bool UVoxelChunkManager::NeedsRegenerationForLOD(const FChunkDescriptor& Descriptor, int32 LODLevel) const
+{
+	if (Descriptor.GenerationStride <= 1)
+	{
+		return false;
+	}
+	// Without the strided-read gate nothing keeps the meshers on the lattice: any strided payload regenerates
+	return !bStridedGenerationActive
+		|| Descriptor.NeedsRegenerationForStride(1 << FMath::Clamp(LODLevel, 0, 7));
+}
+
+EVoxelApronFill UVoxelChunkManager::GetPaddedApronFill() const
+{
+	// Matches each CPU mesher's legacy absent-neighbor read: MC clamps to its own edge, DC reads Air.
+	return (Configuration && Configuration->MeshingMode == EMeshingMode::MarchingCubes)
+		? EVoxelApronFill::ClampToChunk : EVoxelApronFill::Air;
+}
+
+void UVoxelChunkManager::GatherPaddedNeighborhood(const FIntVector& ChunkCoord, FVoxelMeshingRequest& OutRequest)
+{
+	VoxelNeighborSlices::InitPadded(bDeepDepthOff, bDeepDepthFull, GetPaddedApronFill(),
+		[this, &ChunkCoord](const FIntVector& Offset) -> TSharedPtr<const TArray<FVoxelData>>
+		{
+			const FIntVector NCoord = ChunkCoord + Offset;
+			FVoxelChunkState* NState = ChunkStates.Find(NCoord);
+			if (!NState || !NState->Descriptor.HasVoxelDataAvailable())
+			{
+				return nullptr;
+			}
+			return GetSeamVoxelSnapshot(NCoord, *NState);
+		},
+		OutRequest);
+}
+
+// ==================== Chunk Persistence ====================
+
+void UVoxelChunkManager::TickPersistence()
+{
+	Persistence->Tick();
+	SettlePersistedWrites();
+
+	// Read-ahead: walk the head of the generation queue in pop order (a few budgets deep, since most
+	// chunks there have no record) and read ahead the ones the saved-chunk index lists, so
+	// ProcessGenerationQueue finds their record Found instead of deferring.
+	const int32 PrefetchBudget = CVarPersistPrefetchPerTick.GetValueOnGameThread();
+	if (PrefetchBudget > 0 && Persistence->IsIndexReady() && GenerationQueue.Num() > 0)
+	{
+		int32 NumPrefetched = 0;
+		GenerationQueue.ForEachTop(PrefetchBudget * 4, [this, PrefetchBudget, &NumPrefetched](const FChunkLODRequest& Request)
+		{
+			const FIntVector& ChunkCoord = Request.ChunkCoord;
+			if (!Persistence->GetPersistedChunks().Contains(ChunkCoord)
+				|| (EditManager && EditManager->ChunkHasEdits(ChunkCoord))
+				|| Persistence->Lookup(ChunkCoord, false) != EVoxelPersistedChunk::Unknown)
+			{
+				return true;
+			}
+			return Persistence->Prefetch(ChunkCoord) && ++NumPrefetched < PrefetchBudget;
+		});
+	}
+
+	// Write-behind: hand dirty chunks to the worker every WriteBehindSeconds. Coalescing in the queue
+	// keeps a chunk under constant editing at one pending write.
+	const double Now = FPlatformTime::Seconds();
+	if (EditManager && EditManager->GetPersistDirtyChunks().Num() > 0
+		&& Now - LastPersistWriteBehindTime >= CVarPersistWriteBehindSeconds.GetValueOnGameThread())
+	{
+		LastPersistWriteBehindTime = Now;
+
+		const TArray<FIntVector> DirtyChunks = EditManager->GetPersistDirtyChunks().Array();
+		for (const FIntVector& ChunkCoord : DirtyChunks)
+		{
+			FVoxelChunkRecord Record;
+			EditManager->BuildChunkRecord(ChunkCoord, Record);
+			if (!Persistence->QueueWrite(MoveTemp(Record)))
+			{
+				break; // Queue full: the rest stay dirty for the next hand-off
+			}
+			EditManager->MarkChunkPersistPending(ChunkCoord);
+		}
+	}
+}
+
+void UVoxelChunkManager::SettlePersistedWrites()
+{
+	TArray<FVoxelChunkWriteResult> Results;
+	Persistence->TakeFinishedWrites(Results);
+	if (!EditManager)
+	{
+		return;
+	}
+
+	for (const FVoxelChunkWriteResult& Result : Results)
+	{
+		// A failed write re-dirties the chunk; write-behind retries it and the release waits for that
+		EditManager->ConfirmChunkPersisted(Result.ChunkCoord, Result.bSucceeded);
+		if (!Result.bSucceeded || !ChunksAwaitingPersistRelease.Contains(Result.ChunkCoord))
+		{
+			continue;
+		}
+
+		// Release only if the chunk is still unloaded and nothing newer than the record is in memory
+		ChunksAwaitingPersistRelease.Remove(Result.ChunkCoord);
+		if (GetChunkState(Result.ChunkCoord) == EChunkState::Unloaded
+			&& !EditManager->GetPersistDirtyChunks().Contains(Result.ChunkCoord)
+			&& !EditManager->IsChunkPersistPending(Result.ChunkCoord))
+		{
+			EditManager->ReleaseChunkEdits(Result.ChunkCoord);
+		}
+	}
+}
+
+bool UVoxelChunkManager::ApplyPersistedRecord(const FChunkLODRequest& Request)
+{
+	FVoxelChunkRecord Record;
+	if (!Persistence->TakeRecord(Request.ChunkCoord, Record))
 	{
 		return false;
 	}
 
-	// Add to tracking set
-	GenerationQueueSet.Add(Request.ChunkCoord);
+	// Nothing is meshed from the chunk yet, so the edits go in without an OnChunkEdited round
+	if (EditManager && Record.HasEdits())
+	{
+		EditManager->ApplyChunkRecord(Record, false);
+	}
 
-	// Binary search for sorted insertion (ascending — highest priority at back for O(1) pop)
-	int32 InsertIndex = Algo::LowerBound(GenerationQueue, Request);
-	GenerationQueue.Insert(Request, InsertIndex);
+	if (!Record.HasVoxels())
+	{
+		return false;
+	}
 
+	FVoxelChunkState* State = ChunkStates.Find(Request.ChunkCoord);
+	if (!State || !State->Descriptor.SetCompressedVoxelData(MoveTemp(Record.VoxelBuffer)))
+	{
+		UE_LOG(LogVoxelStreaming, Verbose, TEXT("Chunk (%d,%d,%d) persisted voxels unusable; generating"),
+			Request.ChunkCoord.X, Request.ChunkCoord.Y, Request.ChunkCoord.Z);
+		return false;
+	}
+
+	// Same completion path as an async generation result
+	SetChunkState(Request.ChunkCoord, EChunkState::Generating);
+	OnChunkGenerationComplete(Request.ChunkCoord);
 	return true;
 }
 
+void UVoxelChunkManager::PersistChunkOnUnload(const FIntVector& ChunkCoord)
+{
+	// Undo history references the layer, so chunks in it keep their edits resident (write-behind still saves them)
+	if (!Persistence.IsValid() || !EditManager || !EditManager->ChunkHasEdits(ChunkCoord)
+		|| EditManager->IsChunkInHistory(ChunkCoord))
+	{
+		return;
+	}
+
+	FVoxelChunkRecord Record;
+	EditManager->BuildChunkRecord(ChunkCoord, Record);
+
+	// Voxel payload: full-resolution data only (a strided chunk regenerates at the stride it returns at).
+	// A compressed chunk hands over its codec buffer as is; a resident one shares its array and the
+	// worker compresses it.
+	TSharedPtr<const TArray<FVoxelData>> VoxelData;
+	FVoxelChunkState* State = ChunkStates.Find(ChunkCoord);
+	if (CVarPersistSaveVoxelData.GetValueOnGameThread() != 0 && State && State->Descriptor.GenerationStride == 1)
+	{
+		FChunkDescriptor& Descriptor = State->Descriptor;
+		FVoxelChunkBufferHeader Header;
+		if (Descriptor.Residency == EVoxelDataResidency::Compressed
+			&& FVoxelChunkCodec::PeekHeader(Descriptor.CompressedVoxelData, Header)
+			&& Header.CodecId != static_cast<uint8>(EVoxelChunkCodec::Uniform))
+		{
+			Record.VoxelBuffer = Descriptor.CompressedVoxelData;
+		}
+		else if (Descriptor.Residency == EVoxelDataResidency::Resident)
+		{
+			VoxelData = Descriptor.GetSharedVoxelData();
+		}
+	}
+
+	if (EditManager->GetPersistDirtyChunks().Contains(ChunkCoord) || Record.HasVoxels() || VoxelData.IsValid())
+	{
+		if (!Persistence->QueueWrite(MoveTemp(Record), MoveTemp(VoxelData)))
+		{
+			return; // Queue full: edits stay resident and dirty; write-behind retries
+		}
+		EditManager->MarkChunkPersistPending(ChunkCoord);
+	}
+
+	// Only drop edits a record on disk covers: a queued write releases them once confirmed
+	if (Persistence->IsWritePending(ChunkCoord))
+	{
+		ChunksAwaitingPersistRelease.Add(ChunkCoord);
+	}
+	else if (Persistence->GetPersistedChunks().Contains(ChunkCoord))
+	{
+		EditManager->ReleaseChunkEdits(ChunkCoord);
+	}
+}
+
+// ==================== Queue Management ====================
+
+bool UVoxelChunkManager::AddToGenerationQueue(const FChunkLODRequest& Request)
+{
+	// O(1) duplicate check (coord index), O(log n) heap insertion
+	return GenerationQueue.Push(Request);
+}
+
 bool UVoxelChunkManager::AddToMeshingQueue(const FChunkLODRequest& Request, EVoxelRemeshReason Reason)
 {
 	// O(1) duplicate check
-	if (MeshingQueueSet.Contains(Request.ChunkCoord))
+	if (MeshingQueue.Contains(Request.ChunkCoord))
 	{
 		return false;
 	}
@@ -4928,12 +5694,8 @@ bool UVoxelChunkManager::AddToMeshingQueue(const FChunkLODRequest& Request, EVox
 		++BenchRemeshByReason[static_cast<int32>(Reason)];
 	}
 
-	// Add to tracking set
-	MeshingQueueSet.Add(Request.ChunkCoord);
-
-	// Binary search for sorted insertion (ascending — highest priority at back for O(1) pop)
-	int32 InsertIndex = Algo::LowerBound(MeshingQueue, Request);
-	MeshingQueue.Insert(Request, InsertIndex);
+	// O(log n) heap insertion
+	MeshingQueue.Push(Request);
 
 	return true;
 }
@@ -4961,34 +5723,18 @@ bool UVoxelChunkManager::AddToUnloadQueue(const FIntVector& ChunkCoord)
 
 void UVoxelChunkManager::RemoveFromGenerationQueue(const FIntVector& ChunkCoord)
 {
-	// Remove from tracking set
-	GenerationQueueSet.Remove(ChunkCoord);
-
-	// Remove from queue (linear search, but only called when processing)
-	for (int32 i = 0; i < GenerationQueue.Num(); ++i)
+	// O(log n) via the queue's coord index
+	GenerationQueue.Remove(ChunkCoord);
+	if (Persistence.IsValid())
 	{
-		if (GenerationQueue[i].ChunkCoord == ChunkCoord)
-		{
-			GenerationQueue.RemoveAt(i);
-			return;
-		}
+		Persistence->Forget(ChunkCoord);
 	}
 }
 
 void UVoxelChunkManager::RemoveFromMeshingQueue(const FIntVector& ChunkCoord)
 {
-	// Remove from tracking set
-	MeshingQueueSet.Remove(ChunkCoord);
-
-	// Remove from queue (linear search, but only called when processing)
-	for (int32 i = 0; i < MeshingQueue.Num(); ++i)
-	{
-		if (MeshingQueue[i].ChunkCoord == ChunkCoord)
-		{
-			MeshingQueue.RemoveAt(i);
-			return;
-		}
-	}
+	// O(log n) via the queue's coord index
+	MeshingQueue.Remove(ChunkCoord);
 }
 
 void UVoxelChunkManager::RemoveFromUnloadQueue(const FIntVector& ChunkCoord)
@@ -5199,9 +5945,10 @@ static FAutoConsoleCommandWithWorldAndArgs GVoxelFarCompressionStatsCmd(
 			++Managers;
 			const UVoxelChunkManager::FVoxelMemoryStats M = CM->GetVoxelMemoryStats();
 			UE_LOG(LogVoxelStreaming, Warning,
-				TEXT("voxel.FarCompression.Stats: Resident=%d Uniform=%d Compressed=%d Empty=%d | ResidentVoxelData=%.1fMB Reclaimed=%.1fMB"),
+				TEXT("voxel.FarCompression.Stats: Resident=%d Uniform=%d Compressed=%d Empty=%d | ResidentVoxelData=%.1fMB Reclaimed=%.1fMB | Async InFlight=%d Compacted=%lld PreDecompressed=%lld Discarded=%lld WorkerMs=%.1f"),
 				M.ResidentChunks, M.UniformChunks, M.CompressedChunks, M.EmptyChunks,
-				M.VoxelDataBytes / (1024.0 * 1024.0), M.CompressionSavedBytes / (1024.0 * 1024.0));
+				M.VoxelDataBytes / (1024.0 * 1024.0), M.CompressionSavedBytes / (1024.0 * 1024.0),
+				M.CodecJobsInFlight, M.AsyncCompactions, M.AsyncExpansions, M.AsyncCodecDiscarded, M.AsyncCodecWorkerMs);
 		}
 		if (Managers == 0)
 		{
@@ -5228,79 +5975,75 @@ void UVoxelChunkManager::ReprioritizeQueues(const FLODQueryContext& Context)
 	int32 EvictedCount = 0;
 	int32 LODUpdatedCount = 0;
 
+	// Lazy re-keying: a queued item keeps its priority (1 / distance) until the viewer has moved it
+	// into a different chunk-distance band, so only those items are re-sifted in the heap instead of
+	// re-sorting the whole queue. Ordering within a band may lag by up to one chunk of distance.
+	// Distance keys lie in (0, 1]. Anything else — LOD transition (100 + 10000/dist), edit pin,
+	// seam correction, or unset — maps to INDEX_NONE, which no distance band equals, so it is
+	// normalized on the first pass, as before (it would otherwise read as band 0 and go stale).
+	const float BandInvSize = 1.0f / FMath::Max(ChunkWorldSize, 1.0f);
+	auto GetPriorityBand = [BandInvSize](float Priority) -> int32
+	{
+		return (Priority > 0.0f && Priority <= 1.0f) ? FMath::FloorToInt32(BandInvSize / Priority) : INDEX_NONE;
+	};
+	auto RekeyIfBandChanged = [BandInvSize, &GetPriorityBand](FChunkLODRequest& Request, float Dist)
+	{
+		if (GetPriorityBand(Request.Priority) != FMath::FloorToInt32(Dist * BandInvSize))
+		{
+			Request.Priority = 1.0f / FMath::Max(Dist, 1.0f);
+		}
+	};
+
+	// Update LOD level based on current viewer position
+	// This prevents chunks from being generated/meshed at a stale LOD level
+	auto RefreshLOD = [this, &Context, &LODUpdatedCount](FChunkLODRequest& Request)
+	{
+		if (!LODStrategy)
+		{
+			return;
+		}
+		const int32 NewLOD = LODStrategy->GetLODForChunk(Request.ChunkCoord, Context);
+		if (Request.LODLevel != NewLOD)
+		{
+			Request.LODLevel = NewLOD;
+			// Also update the chunk state's LOD level
+			if (FVoxelChunkState* State = ChunkStates.Find(Request.ChunkCoord))
+			{
+				State->LODLevel = NewLOD;
+			}
+			++LODUpdatedCount;
+		}
+	};
+
 	// Re-prioritize, update LOD levels, and evict stale items from generation queue
-	for (int32 i = GenerationQueue.Num() - 1; i >= 0; --i)
+	GenerationQueue.Reprioritize([&](FChunkLODRequest& Request)
 	{
-		FChunkLODRequest& Request = GenerationQueue[i];
 		const FVector ChunkCenter = WorldOrigin + FVector(Request.ChunkCoord) * ChunkWorldSize + FVector(ChunkWorldSize * 0.5f);
 		const float DistSq = FVector::DistSquared(ChunkCenter, ViewerPosition);
 
 		if (DistSq > EvictDistanceSq)
 		{
 			// Beyond view distance — evict from queue and reset chunk state
-			GenerationQueueSet.Remove(Request.ChunkCoord);
 			SetChunkState(Request.ChunkCoord, EChunkState::Unloaded);
 			RemoveChunkState(Request.ChunkCoord);
-			GenerationQueue.RemoveAtSwap(i);
 			++EvictedCount;
+			return EVoxelQueueReprioritize::Remove;
 		}
-		else
-		{
-			// Update priority: closer = higher priority
-			Request.Priority = 1.0f / FMath::Max(FMath::Sqrt(DistSq), 1.0f);
 
-			// Update LOD level based on current viewer position
-			// This prevents chunks from being generated at a stale LOD level
-			if (LODStrategy)
-			{
-				const int32 NewLOD = LODStrategy->GetLODForChunk(Request.ChunkCoord, Context);
-				if (Request.LODLevel != NewLOD)
-				{
-					Request.LODLevel = NewLOD;
-					// Also update the chunk state's LOD level
-					if (FVoxelChunkState* State = ChunkStates.Find(Request.ChunkCoord))
-					{
-						State->LODLevel = NewLOD;
-					}
-					++LODUpdatedCount;
-				}
-			}
-		}
-	}
-
-	// Re-sort generation queue (ascending — highest priority at back)
-	if (GenerationQueue.Num() > 1)
-	{
-		GenerationQueue.Sort();
-	}
+		// Update priority: closer = higher priority
+		RekeyIfBandChanged(Request, FMath::Sqrt(DistSq));
+		RefreshLOD(Request);
+		return EVoxelQueueReprioritize::Keep;
+	});
 
 	// Re-prioritize and update LOD levels in meshing queue (don't evict — generation data already computed)
-	for (FChunkLODRequest& Request : MeshingQueue)
+	MeshingQueue.Reprioritize([&](FChunkLODRequest& Request)
 	{
 		const FVector ChunkCenter = WorldOrigin + FVector(Request.ChunkCoord) * ChunkWorldSize + FVector(ChunkWorldSize * 0.5f);
-		const float Dist = FVector::Dist(ChunkCenter, ViewerPosition);
-		Request.Priority = 1.0f / FMath::Max(Dist, 1.0f);
-
-		// Update LOD level for meshing queue items too
-		if (LODStrategy)
-		{
-			const int32 NewLOD = LODStrategy->GetLODForChunk(Request.ChunkCoord, Context);
-			if (Request.LODLevel != NewLOD)
-			{
-				Request.LODLevel = NewLOD;
-				if (FVoxelChunkState* State = ChunkStates.Find(Request.ChunkCoord))
-				{
-					State->LODLevel = NewLOD;
-				}
-				++LODUpdatedCount;
-			}
-		}
-	}
-
-	if (MeshingQueue.Num() > 1)
-	{
-		MeshingQueue.Sort();
-	}
+		RekeyIfBandChanged(Request, FVector::Dist(ChunkCenter, ViewerPosition));
+		RefreshLOD(Request);
+		return EVoxelQueueReprioritize::Keep;
+	});
 
 	if (EvictedCount > 0 || LODUpdatedCount > 0)
 	{
@@ -5337,19 +6080,39 @@ bool UVoxelChunkManager::PrepareCollisionMeshRequest(
 		return false;
 	}
 
+	// A strided payload (own or a face neighbour's) too coarse for the collision stride would cook
+	// replicated voxels; wait for the LOD refine to regenerate it.
+	if (NeedsRegenerationForLOD(State->Descriptor, LODLevel))
+	{
+		return false;
+	}
+	static const FIntVector FaceOffsets[6] = {
+		FIntVector(1, 0, 0),  FIntVector(-1, 0, 0),
+		FIntVector(0, 1, 0),  FIntVector(0, -1, 0),
+		FIntVector(0, 0, 1),  FIntVector(0, 0, -1),
+	};
+	for (const FIntVector& Offset : FaceOffsets)
+	{
+		const FVoxelChunkState* NeighborState = ChunkStates.Find(ChunkCoord + Offset);
+		if (NeighborState && NeedsRegenerationForLOD(NeighborState->Descriptor, LODLevel))
+		{
+			return false;
+		}
+	}
+
 	// Build meshing request for collision LOD
 	OutMeshRequest.ChunkCoord = ChunkCoord;
 	OutMeshRequest.LODLevel = LODLevel;
 	OutMeshRequest.ChunkSize = ChunkSize;
 	OutMeshRequest.VoxelSize = Configuration->VoxelSize;
 	OutMeshRequest.WorldOrigin = Configuration->WorldOrigin;
+	OutMeshRequest.bLatticeReads = bStridedGenerationActive;
 
 	if (OutSharedVoxels)
 	{
-		// Async path: hand out the shared edit-merged snapshot (built at most once per chunk
-		// content version, usually already cached by the seam pipeline). The worker copies it
-		// into the request off the game thread — skipping the full-volume copy + edit merge
-		// that dominated per-cook game-thread cost here.
+		// Async path: hand out the shared edit-merged snapshot (the chunk's own published buffer,
+		// or for edited chunks a merge built at most once per content version). The worker
+		// attaches it to the request without copying.
 		*OutSharedVoxels = GetSeamVoxelSnapshot(ChunkCoord, *State);
 		if (!OutSharedVoxels->IsValid() || (*OutSharedVoxels)->Num() == 0)
 		{
@@ -5358,25 +6121,8 @@ bool UVoxelChunkManager::PrepareCollisionMeshRequest(
 	}
 	else
 	{
-		// Synchronous path: materialize inline (copy + edit merge), original behavior.
-		OutMeshRequest.VoxelData = State->Descriptor.GetVoxelDataForRead();
-		if (EditManager && EditManager->ChunkHasEdits(ChunkCoord))
-		{
-			const FChunkEditLayer* EditLayer = EditManager->GetEditLayer(ChunkCoord);
-			if (EditLayer && !EditLayer->IsEmpty())
-			{
-				for (const auto& EditPair : EditLayer->Edits)
-				{
-					const int32 Index = EditPair.Key;
-					const FVoxelEdit& Edit = EditPair.Value;
-					if (OutMeshRequest.VoxelData.IsValidIndex(Index))
-					{
-						const FVoxelData& ProceduralData = OutMeshRequest.VoxelData[Index];
-						OutMeshRequest.VoxelData[Index] = Edit.ApplyToProceduralData(ProceduralData);
-					}
-				}
-			}
-		}
+		// Synchronous path: attach the same shared snapshot directly to the request.
+		OutMeshRequest.SharedVoxelData = GetSeamVoxelSnapshot(ChunkCoord, *State);
 	}
 
 	if (OutNeighborSnapshots)
@@ -5424,6 +6170,47 @@ bool UVoxelChunkManager::PrepareCollisionMeshRequest(
 	return true;
 }
 
+TSharedPtr<const FVoxelCollisionMeshGeometry> UVoxelChunkManager::TakeCollisionMeshOffer(const FIntVector& ChunkCoord, int32 LODLevel)
+{
+	TSharedPtr<const FVoxelCollisionMeshGeometry> Offer;
+	if (!CollisionMeshOffers.RemoveAndCopyValue(ChunkCoord, Offer) || !Offer.IsValid())
+	{
+		return nullptr;
+	}
+
+	const FVoxelChunkState* State = ChunkStates.Find(ChunkCoord);
+	if (!State || Offer->LODLevel != LODLevel || Offer->ContentVersion != State->Descriptor.ContentVersion)
+	{
+		return nullptr;
+	}
+	return Offer;
+}
+
+bool UVoxelChunkManager::IsCollisionMeshOfferPending(const FIntVector& ChunkCoord, int32 LODLevel) const
+{
+	const FPendingCollisionMeshOffer* Pending = PendingCollisionMeshOffers.Find(ChunkCoord);
+	if (!Pending || Pending->LODLevel != LODLevel || !AsyncMeshingInProgress.Contains(ChunkCoord))
+	{
+		return false;
+	}
+
+	const FVoxelChunkState* State = ChunkStates.Find(ChunkCoord);
+	return State && State->Descriptor.ContentVersion == Pending->ContentVersion;
+}
+
+int64 UVoxelChunkManager::GetCollisionMeshOfferBytes() const
+{
+	int64 Total = CollisionMeshOffers.GetAllocatedSize() + PendingCollisionMeshOffers.GetAllocatedSize();
+	for (const auto& Pair : CollisionMeshOffers)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Total += sizeof(FVoxelCollisionMeshGeometry) + Pair.Value->GetAllocatedSize();
+		}
+	}
+	return Total;
+}
+
 bool UVoxelChunkManager::GetChunkCollisionMesh(
 	const FIntVector& ChunkCoord,
 	int32 LODLevel,
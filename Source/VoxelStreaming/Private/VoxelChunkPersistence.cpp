@@ -0,0 +1,388 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "VoxelChunkPersistence.h"
+#include "VoxelStreaming.h"
+#include "VoxelWorldSave.h"
+#include "VoxelChunkCodec.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+FVoxelChunkPersistence::FVoxelChunkPersistence(const FString& InDirectory, int32 InChunkSize, int32 InMaxQueuedWrites, int32 InMaxQueuedReads,
+	float InCompactDeadRatio, int32 InCompactEveryWrites)
+	: Directory(InDirectory)
+	, ChunkSize(InChunkSize)
+	, MaxQueuedWrites(FMath::Max(1, InMaxQueuedWrites))
+	, MaxQueuedReads(FMath::Max(1, InMaxQueuedReads))
+	, CompactDeadRatio(FMath::Max(0.0f, InCompactDeadRatio))
+	, CompactEveryWrites(InCompactEveryWrites)
+	, Save(MakeUnique<FVoxelWorldSave>(InDirectory, InChunkSize))
+{
+	// Start the index scan right away
+	FScopeLock Lock(&InboxLock);
+	KickWorker_Locked();
+}
+
+FVoxelChunkPersistence::~FVoxelChunkPersistence()
+{
+	Flush();
+	Save->CloseAll();
+}
+
+// ==================== Writes ====================
+
+bool FVoxelChunkPersistence::QueueWrite(FVoxelChunkRecord&& Record, TSharedPtr<const TArray<FVoxelData>> VoxelData, bool bForce)
+{
+	const FIntVector ChunkCoord = Record.ChunkCoord;
+	const bool bRemoves = Record.IsEmpty() && !VoxelData.IsValid();
+	const uint32 Serial = NextWriteSerial++;
+	{
+		FScopeLock Lock(&InboxLock);
+
+		FWriteJob* Job = PendingWrites.Find(ChunkCoord);
+		if (!Job)
+		{
+			if (!bForce && WriteQueueDepth.load() >= MaxQueuedWrites)
+			{
+				++WritesRejected;
+				return false;
+			}
+			WriteQueueDepth.fetch_add(1);
+			Job = &PendingWrites.Add(ChunkCoord);
+		}
+
+		// Coalesce: a queued, not yet started write for the same chunk is superseded
+		Job->Record = MoveTemp(Record);
+		Job->VoxelData = MoveTemp(VoxelData);
+		Job->Serial = Serial;
+		KickWorker_Locked();
+	}
+	InFlightWrites.Add(ChunkCoord, Serial);
+
+	// Whatever was tracked (including an in-flight read) predates this write
+	Tracked.Remove(ChunkCoord);
+
+	bool bWasPersisted = false;
+	if (bRemoves)
+	{
+		bWasPersisted = PersistedChunks.Remove(ChunkCoord) > 0;
+	}
+	else
+	{
+		PersistedChunks.Add(ChunkCoord, &bWasPersisted);
+	}
+	if (bWasPersisted == bRemoves)
+	{
+		++PersistedChunksGeneration;
+	}
+	if (!bIndexMerged)
+	{
+		WrittenBeforeIndex.Add(ChunkCoord);
+	}
+	return true;
+}
+
+void FVoxelChunkPersistence::Flush()
+{
+	// Any enqueue kicks a worker, and a worker only retires once both inbox queues are empty
+	for (;;)
+	{
+		{
+			FScopeLock Lock(&InboxLock);
+			if (!bWorkerActive)
+			{
+				break;
+			}
+		}
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	// Worker retired: the save is ours until the next kick
+	Compactions.fetch_add(Save->CompactRegions(CompactDeadRatio));
+	WritesSinceCompact = 0;
+	Save->Flush();
+}
+
+void FVoxelChunkPersistence::TakeFinishedWrites(TArray<FVoxelChunkWriteResult>& OutResults)
+{
+	OutResults = MoveTemp(FinishedWrites);
+	FinishedWrites.Reset();
+}
+
+// ==================== Reads ====================
+
+bool FVoxelChunkPersistence::Prefetch(const FIntVector& ChunkCoord)
+{
+	if (Tracked.Contains(ChunkCoord))
+	{
+		return true;
+	}
+	if (NumPendingReads >= MaxQueuedReads || Tracked.Num() >= MaxQueuedReads * 4)
+	{
+		++ReadsRejected;
+		return false;
+	}
+
+	RequestRead(ChunkCoord);
+	return true;
+}
+
+EVoxelPersistedChunk FVoxelChunkPersistence::Lookup(const FIntVector& ChunkCoord, bool bRequestIfUnknown)
+{
+	if (const FTrackedChunk* Entry = Tracked.Find(ChunkCoord))
+	{
+		return Entry->State;
+	}
+	if (!bRequestIfUnknown)
+	{
+		return EVoxelPersistedChunk::Unknown;
+	}
+	if (NumPendingReads >= MaxQueuedReads)
+	{
+		++ReadsRejected;
+		return EVoxelPersistedChunk::Unknown;
+	}
+
+	RequestRead(ChunkCoord);
+	return EVoxelPersistedChunk::Pending;
+}
+
+bool FVoxelChunkPersistence::TakeRecord(const FIntVector& ChunkCoord, FVoxelChunkRecord& OutRecord)
+{
+	FTrackedChunk* Entry = Tracked.Find(ChunkCoord);
+	if (!Entry || Entry->State != EVoxelPersistedChunk::Found)
+	{
+		return false;
+	}
+
+	OutRecord = MoveTemp(Entry->Record);
+	Tracked.Remove(ChunkCoord);
+	return true;
+}
+
+void FVoxelChunkPersistence::Forget(const FIntVector& ChunkCoord)
+{
+	Tracked.Remove(ChunkCoord);
+}
+
+void FVoxelChunkPersistence::Tick()
+{
+	if (!bIndexMerged)
+	{
+		TArray<FIntVector> Index;
+		{
+			FScopeLock Lock(&InboxLock);
+			if (bIndexReady)
+			{
+				Index = MoveTemp(IndexResult);
+				bIndexMerged = true;
+			}
+		}
+
+		if (bIndexMerged)
+		{
+			for (const FIntVector& ChunkCoord : Index)
+			{
+				if (!WrittenBeforeIndex.Contains(ChunkCoord))
+				{
+					PersistedChunks.Add(ChunkCoord);
+				}
+			}
+			WrittenBeforeIndex.Empty();
+			++PersistedChunksGeneration;
+		}
+	}
+
+	FWriteCompletion Completion;
+	while (CompletedWrites.Dequeue(Completion))
+	{
+		// A later QueueWrite for the chunk reports instead
+		const uint32* Latest = InFlightWrites.Find(Completion.ChunkCoord);
+		if (!Latest || *Latest != Completion.Serial)
+		{
+			continue;
+		}
+
+		InFlightWrites.Remove(Completion.ChunkCoord);
+		FinishedWrites.Add({ Completion.ChunkCoord, Completion.bSucceeded });
+	}
+
+	FReadResult Result;
+	while (CompletedReads.Dequeue(Result))
+	{
+		--NumPendingReads;
+
+		// Overtaken by a QueueWrite / Forget (entry gone) or by a newer read (ticket moved on)
+		FTrackedChunk* Entry = Tracked.Find(Result.ChunkCoord);
+		if (!Entry || Entry->Ticket != Result.Ticket)
+		{
+			continue;
+		}
+
+		Entry->State = Result.bFound ? EVoxelPersistedChunk::Found : EVoxelPersistedChunk::Missing;
+		Entry->Record = MoveTemp(Result.Record);
+	}
+}
+
+void FVoxelChunkPersistence::RequestRead(const FIntVector& ChunkCoord)
+{
+	FTrackedChunk& Entry = Tracked.FindOrAdd(ChunkCoord);
+	Entry.State = EVoxelPersistedChunk::Pending;
+	Entry.Ticket = NextTicket++;
+	Entry.Record = FVoxelChunkRecord();
+	++NumPendingReads;
+
+	FScopeLock Lock(&InboxLock);
+	PendingReads.Add({ ChunkCoord, Entry.Ticket });
+	KickWorker_Locked();
+}
+
+FVoxelChunkPersistenceStats FVoxelChunkPersistence::GetStats() const
+{
+	FVoxelChunkPersistenceStats Stats;
+	Stats.WriteQueueDepth = WriteQueueDepth.load();
+	Stats.ReadQueueDepth = NumPendingReads;
+	Stats.TrackedChunks = Tracked.Num();
+	Stats.ChunksRead = ChunksRead.load();
+	Stats.ChunksWritten = ChunksWritten.load();
+	Stats.BytesRead = BytesRead.load();
+	Stats.BytesWritten = BytesWritten.load();
+	Stats.ReadSeconds = ReadMicros.load() * 1e-6;
+	Stats.WriteSeconds = WriteMicros.load() * 1e-6;
+	Stats.WritesRejected = WritesRejected;
+	Stats.ReadsRejected = ReadsRejected;
+	Stats.WriteFailures = WriteFailures.load();
+	Stats.Compactions = Compactions.load();
+	return Stats;
+}
+
+// ==================== Worker ====================
+
+void FVoxelChunkPersistence::KickWorker_Locked()
+{
+	if (bWorkerActive)
+	{
+		return;
+	}
+
+	// The object outlives the worker: the destructor's Flush waits for it to retire
+	bWorkerActive = true;
+	Async(EAsyncExecution::ThreadPool, [this]()
+	{
+		WorkerLoop();
+	});
+}
+
+void FVoxelChunkPersistence::WorkerLoop()
+{
+	TArray<FWriteJob> Writes;
+	TArray<FReadJob> Reads;
+
+	// Index scan runs before any write, so it can only be stale for chunks written before it lands
+	bool bScanIndex = false;
+	{
+		FScopeLock Lock(&InboxLock);
+		bScanIndex = bIndexPending;
+		bIndexPending = false;
+	}
+	if (bScanIndex)
+	{
+		TArray<FIntVector> Index;
+		Save->GetSavedChunkCoords(Index);
+
+		FScopeLock Lock(&InboxLock);
+		IndexResult = MoveTemp(Index);
+		bIndexReady = true;
+	}
+
+	for (;;)
+	{
+		{
+			FScopeLock Lock(&InboxLock);
+			if (PendingWrites.Num() == 0 && PendingReads.Num() == 0)
+			{
+				bWorkerActive = false;
+				return;
+			}
+
+			Writes.Reset();
+			for (TPair<FIntVector, FWriteJob>& Pair : PendingWrites)
+			{
+				Writes.Add(MoveTemp(Pair.Value));
+			}
+			PendingWrites.Reset();
+			Reads = MoveTemp(PendingReads);
+			PendingReads.Reset();
+		}
+
+		// Writes first, so every read taken in this batch (or later) sees them
+		if (Writes.Num() > 0)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const int64 StartBytes = Save->GetStats().BytesWritten;
+
+			TArray<FWriteCompletion, TInlineAllocator<64>> Completions;
+			for (FWriteJob& Job : Writes)
+			{
+				if (Job.VoxelData.IsValid() && !Job.Record.HasVoxels())
+				{
+					FVoxelChunkCodec::Compress(*Job.VoxelData, EVoxelChunkCodec::LZ4, ChunkSize, Job.Record.VoxelBuffer);
+					Job.VoxelData.Reset();
+				}
+
+				const bool bSucceeded = Save->SaveChunk(Job.Record);
+				Completions.Add({ Job.Record.ChunkCoord, Job.Serial, bSucceeded });
+				if (bSucceeded)
+				{
+					ChunksWritten.fetch_add(1);
+				}
+				else
+				{
+					WriteFailures.fetch_add(1);
+					UE_LOG(LogVoxelStreaming, Warning, TEXT("Chunk persistence: failed to write chunk (%d,%d,%d)"),
+						Job.Record.ChunkCoord.X, Job.Record.ChunkCoord.Y, Job.Record.ChunkCoord.Z);
+				}
+				WriteQueueDepth.fetch_sub(1);
+			}
+			Save->Flush();
+
+			// Confirmed only once flushed, so the game thread can drop its copy of the edits
+			for (const FWriteCompletion& Completion : Completions)
+			{
+				CompletedWrites.Enqueue(Completion);
+			}
+
+			WritesSinceCompact += Writes.Num();
+			if (CompactEveryWrites > 0 && WritesSinceCompact >= CompactEveryWrites)
+			{
+				Compactions.fetch_add(Save->CompactRegions(CompactDeadRatio));
+				WritesSinceCompact = 0;
+			}
+
+			BytesWritten.fetch_add(Save->GetStats().BytesWritten - StartBytes);
+			WriteMicros.fetch_add(static_cast<int64>((FPlatformTime::Seconds() - StartTime) * 1e6));
+		}
+
+		if (Reads.Num() > 0)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const int64 StartBytes = Save->GetStats().BytesRead;
+
+			for (const FReadJob& Job : Reads)
+			{
+				FReadResult Result;
+				Result.ChunkCoord = Job.ChunkCoord;
+				Result.Ticket = Job.Ticket;
+				Result.bFound = Save->LoadChunk(Job.ChunkCoord, Result.Record);
+				if (Result.bFound)
+				{
+					ChunksRead.fetch_add(1);
+				}
+				CompletedReads.Enqueue(MoveTemp(Result));
+			}
+
+			BytesRead.fetch_add(Save->GetStats().BytesRead - StartBytes);
+			ReadMicros.fetch_add(static_cast<int64>((FPlatformTime::Seconds() - StartTime) * 1e6));
+		}
+	}
+}
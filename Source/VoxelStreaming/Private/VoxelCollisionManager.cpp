@@ -7,6 +7,7 @@
 #include "ChunkRenderData.h"
 #include "IVoxelMesher.h"
 #include "VoxelMeshingTypes.h"
+#include "VoxelMeshSimplifier.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "Misc/ScopeExit.h"
@@ -14,7 +15,6 @@
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Engine/CollisionProfile.h"
 #include "DrawDebugHelpers.h"
-#include "Algo/BinarySearch.h"
 #include "Serialization/ArchiveCountMem.h"
 #include "Async/Async.h"
 #include "Engine/World.h"
@@ -79,6 +79,109 @@ static TAutoConsoleVariable<int32> CVarCollisionLookAheadChunks(
 	     "cooked before entry. 0 disables path coverage."),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarCollisionReuseRenderMesh(
+	TEXT("voxel.Collision.ReuseRenderMesh"),
+	1,
+	TEXT("Build collision trimeshes from the render mesh when it was meshed at the collision LOD, instead of "
+	     "meshing the chunk a second time. Cooks wait for an in-flight render mesh that will be offered. "
+	     "1 = on, 0 = always mesh collision separately."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCollisionPostProcess(
+	TEXT("voxel.Collision.PostProcess"),
+	1,
+	TEXT("Reduce collision meshes before the Chaos trimesh build: drop skirts, weld coincident positions and "
+	     "simplify coplanar regions (voxel.Collision.WeldTolerance / SimplifyMaxError). 1 = on, 0 = cook the mesher output as-is."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCollisionWeldTolerance(
+	TEXT("voxel.Collision.WeldTolerance"),
+	0.01f,
+	TEXT("Collision vertex weld distance, in voxels. 0 welds bit-identical positions only."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCollisionSimplifyMaxError(
+	TEXT("voxel.Collision.SimplifyMaxError"),
+	0.1f,
+	TEXT("Collision simplification cost bound, in voxels at the collision LOD's stride: the summed quadric (plane distance) "
+	     "error of a collapse must stay within its square. 0 disables simplification (skirt drop and welding still run)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCollisionSimplifyTargetRatio(
+	TEXT("voxel.Collision.SimplifyTargetRatio"),
+	0.1f,
+	TEXT("Collision simplification stops at this fraction of the welded triangle count even if cheaper collapses remain."),
+	ECVF_Default);
+
+/** Resolve the collision mesh post-process for a cook at LODLevel (game thread: reads cvars). False when disabled. */
+static bool ResolveCollisionMeshSettings(const UVoxelWorldConfiguration& Config, int32 LODLevel, FVoxelCollisionMeshSettings& OutSettings)
+{
+	if (CVarCollisionPostProcess.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+
+	const float StrideWorld = Config.VoxelSize * static_cast<float>(1 << FMath::Clamp(LODLevel, 0, 16));
+	OutSettings.WeldTolerance = FMath::Max(CVarCollisionWeldTolerance.GetValueOnGameThread(), 0.0f) * Config.VoxelSize;
+	OutSettings.SimplifyMaxError = FMath::Max(CVarCollisionSimplifyMaxError.GetValueOnGameThread(), 0.0f) * StrideWorld;
+	OutSettings.SimplifyTargetRatio = FMath::Clamp(CVarCollisionSimplifyTargetRatio.GetValueOnGameThread(), 0.0f, 1.0f);
+	return true;
+}
+
+/** Build the Chaos trimesh for a collision cook from chunk-local positions + indices (worker thread). */
+static void BuildCollisionTriMesh(const TArray<FVector3f>& Vertices, const TArray<uint32>& Indices, FAsyncCollisionResult& Result)
+{
+	Result.NumVertices = Vertices.Num();
+	Result.NumTriangles = Indices.Num() / 3;
+
+	TArray<Chaos::TVec3<Chaos::FRealSingle>> ChaosVertices;
+	TArray<Chaos::TVector<int32, 3>> ChaosTriangles;
+
+	ChaosVertices.Reserve(Vertices.Num());
+	for (const FVector3f& V : Vertices)
+	{
+		ChaosVertices.Add(Chaos::TVec3<Chaos::FRealSingle>(V.X, V.Y, V.Z));
+	}
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	ChaosTriangles.Reserve(NumTriangles);
+	for (int32 i = 0; i < NumTriangles; ++i)
+	{
+		ChaosTriangles.Add(Chaos::TVector<int32, 3>(
+			static_cast<int32>(Indices[i * 3 + 0]),
+			static_cast<int32>(Indices[i * 3 + 1]),
+			static_cast<int32>(Indices[i * 3 + 2])
+		));
+	}
+
+	// Create the Chaos trimesh implicit object (thread-safe — pure data construction)
+	TRefCountPtr<Chaos::FTriangleMeshImplicitObject> TriMesh = new Chaos::FTriangleMeshImplicitObject(
+		MoveTemp(ChaosVertices),
+		MoveTemp(ChaosTriangles),
+		TArray<uint16>() // Empty materials array
+	);
+
+	if (TriMesh.IsValid())
+	{
+		Result.TriMesh = MoveTemp(TriMesh);
+		Result.bSuccess = true;
+	}
+}
+
+/** Post-process (when enabled) and build the Chaos trimesh for a collision cook (worker thread). */
+static void BuildCollisionResult(TArray<FVector3f>& Positions, TArray<uint32>& Indices, int32 SkirtIndexStart,
+	bool bPostProcess, const FVoxelCollisionMeshSettings& Settings, FAsyncCollisionResult& Result)
+{
+	if (bPostProcess)
+	{
+		Result.MeshStats = UVoxelCollisionManager::PostProcessCollisionMesh(Positions, Indices, SkirtIndexStart, Settings);
+	}
+	if (Positions.Num() > 0 && Indices.Num() > 0)
+	{
+		BuildCollisionTriMesh(Positions, Indices, Result);
+	}
+}
+
 // ==================== UVoxelCollisionComponent ====================
 
 UVoxelCollisionComponent::UVoxelCollisionComponent(const FObjectInitializer& ObjectInitializer)
@@ -183,7 +286,6 @@ void UVoxelCollisionManager::Initialize(UVoxelWorldConfiguration* Config, UVoxel
 	// Clear any existing state
 	CollisionData.Empty();
 	CookingQueue.Empty();
-	CookingQueueSet.Empty();
 	AsyncCollisionInProgress.Empty();
 
 	// Drain any stale results from the MPSC queue
@@ -215,7 +317,6 @@ void UVoxelCollisionManager::Shutdown()
 
 	// Cancel all pending cooking
 	CookingQueue.Empty();
-	CookingQueueSet.Empty();
 	AsyncCollisionInProgress.Empty();
 
 	// Drain completed queue (results may still be arriving)
@@ -268,6 +369,8 @@ void UVoxelCollisionManager::Update(const FVector& ViewerPosition, float DeltaTi
 	// Reset per-tick sub-phase attribution (accumulated by cook launches + result applies below).
 	LastPrepMs = 0.0f;
 	LastApplyMs = 0.0f;
+	LastPostProcessMs = 0.0f;
+	LastTrianglesRemoved = 0;
 
 	// 1. Always drain completed async results first (lightweight game-thread work)
 	ProcessCompletedCollisionCooks();
@@ -534,6 +637,8 @@ FString UVoxelCollisionManager::GetDebugStats() const
 	Stats += FString::Printf(TEXT("Async In-Progress: %d\n"), AsyncCollisionInProgress.Num());
 	Stats += FString::Printf(TEXT("Total Generated: %lld\n"), TotalCollisionsGenerated);
 	Stats += FString::Printf(TEXT("Total Removed: %lld\n"), TotalCollisionsRemoved);
+	Stats += FString::Printf(TEXT("Cooks from Render Mesh: %lld (own meshing pass: %lld)\n"), TotalRenderMeshReuses, TotalMeshedCooks);
+	Stats += FString::Printf(TEXT("Post-Process Triangles: %lld -> %lld\n"), TotalPostProcessInputTriangles, TotalPostProcessOutputTriangles);
 
 	return Stats;
 }
@@ -545,7 +650,8 @@ int64 UVoxelCollisionManager::GetTotalMemoryUsage() const
 	// Collision data map overhead
 	Total += CollisionData.GetAllocatedSize();
 
-	// Per-chunk: cooked-trimesh estimate captured at apply time. Do NOT call
+	// Per-chunk: cooked-trimesh estimate captured at apply time, from the post-processed
+	// (welded / simplified) counts that actually reached Chaos. Do NOT call
 	// BodySetup->GetResourceSizeEx here — it walks the Chaos triangle-mesh geometry
 	// (~1ms per body), and this getter is called per frame by the debug HUD; with a
 	// settled collision shell that walk alone was 80-100ms/frame (6 fps in standalone).
@@ -556,7 +662,6 @@ int64 UVoxelCollisionManager::GetTotalMemoryUsage() const
 
 	// Cooking queue (lightweight — no mesh data stored in requests)
 	Total += CookingQueue.GetAllocatedSize();
-	Total += CookingQueueSet.GetAllocatedSize();
 	Total += AsyncCollisionInProgress.GetAllocatedSize();
 
 	return Total;
@@ -700,17 +805,162 @@ void UVoxelCollisionManager::ProcessCookingQueue()
 	// Launch async tasks from the queue up to the concurrency limit (cvar override for Tier 1 headroom).
 	const int32 AsyncOverride = CVarCollisionMaxAsyncTasks.GetValueOnGameThread();
 	const int32 MaxAsync = AsyncOverride > 0 ? FMath::Clamp(AsyncOverride, 1, 8) : MaxAsyncCollisionTasks;
+	const bool bReuseRenderMesh = ChunkManager && CVarCollisionReuseRenderMesh.GetValueOnGameThread() != 0;
+	TArray<FCollisionCookRequest, TInlineAllocator<8>> AwaitingRenderMesh;
 	while (CookingQueue.Num() > 0 &&
 		AsyncCollisionInProgress.Num() < MaxAsync)
 	{
-		// Pop highest priority from the back (O(1) — queue sorted ascending, highest at back)
-		FCollisionCookRequest Request = MoveTemp(CookingQueue.Last());
-		CookingQueue.Pop();
-		CookingQueueSet.Remove(Request.ChunkCoord);
+		// Pop highest priority (O(log n) heap pop)
+		FCollisionCookRequest Request = CookingQueue.Pop();
+
+		// The chunk's render mesh at the collision LOD is in flight and will be offered: wait for
+		// it rather than meshing the same chunk a second time.
+		if (bReuseRenderMesh && ChunkManager->IsCollisionMeshOfferPending(Request.ChunkCoord, CollisionLODLevel))
+		{
+			AwaitingRenderMesh.Add(Request);
+			continue;
+		}
 
 		// Launch async mesh generation + trimesh construction
 		LaunchAsyncCollisionCook(Request);
 	}
+
+	for (const FCollisionCookRequest& Request : AwaitingRenderMesh)
+	{
+		CookingQueue.Push(Request);
+	}
+}
+
+bool UVoxelCollisionManager::WantsRenderMeshOffer(const FIntVector& ChunkCoord, int32 LODLevel) const
+{
+	if (!bIsInitialized || !Configuration || LODLevel != CollisionLODLevel ||
+		CVarCollisionReuseRenderMesh.GetValueOnGameThread() == 0 || LastFocusPosition.X == FLT_MAX)
+	{
+		return false;
+	}
+
+	if (const FChunkCollisionData* Data = CollisionData.Find(ChunkCoord))
+	{
+		if (!Data->bNeedsUpdate)
+		{
+			return false;
+		}
+	}
+
+	// One chunk of slack so a chunk entering the radius while its mesh is in flight still benefits
+	const float ChunkWorldSize = Configuration->GetChunkWorldSize();
+	const FVector ChunkCenter = Configuration->WorldOrigin
+		+ FVector(ChunkCoord) * ChunkWorldSize
+		+ FVector(ChunkWorldSize * 0.5f);
+	const float Radius = FMath::Max(CurrentEffectiveRadius, CollisionRadius) + ChunkWorldSize;
+	return FVector::DistSquared(ChunkCenter, LastFocusPosition) <= FMath::Square(Radius);
+}
+
+FVoxelCollisionMeshStats UVoxelCollisionManager::PostProcessCollisionMesh(
+	TArray<FVector3f>& Positions,
+	TArray<uint32>& Indices,
+	int32 SkirtIndexStart,
+	const FVoxelCollisionMeshSettings& Settings)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FVoxelCollisionMeshStats Stats;
+	Stats.InputVertices = Positions.Num();
+	Stats.InputTriangles = Indices.Num() / 3;
+
+	// Skirts are appended after the surface by the CPU meshers; they only hide LOD cracks
+	if (SkirtIndexStart != INDEX_NONE && SkirtIndexStart < Indices.Num())
+	{
+		const int32 SurfaceIndices = SkirtIndexStart - SkirtIndexStart % 3;
+		Stats.SkirtTriangles = (Indices.Num() - SurfaceIndices) / 3;
+		Indices.SetNum(SurfaceIndices, EAllowShrinking::No);
+	}
+	Indices.SetNum(Indices.Num() - Indices.Num() % 3, EAllowShrinking::No);
+
+	// Weld on a WeldTolerance grid (bit-identical positions when the tolerance is 0). Walking the
+	// indices also drops vertices only the skirts referenced.
+	const float InvTolerance = Settings.WeldTolerance > 0.0f ? 1.0f / Settings.WeldTolerance : 0.0f;
+	auto WeldKey = [InvTolerance](const FVector3f& P) -> FIntVector
+	{
+		if (InvTolerance > 0.0f)
+		{
+			return FIntVector(FMath::RoundToInt(P.X * InvTolerance), FMath::RoundToInt(P.Y * InvTolerance), FMath::RoundToInt(P.Z * InvTolerance));
+		}
+		return FIntVector(static_cast<int32>(FPlatformMath::AsUInt(P.X)), static_cast<int32>(FPlatformMath::AsUInt(P.Y)), static_cast<int32>(FPlatformMath::AsUInt(P.Z)));
+	};
+
+	TArray<int32> Remap;
+	Remap.Init(INDEX_NONE, Positions.Num());
+	TMap<FIntVector, int32> WeldMap;
+	WeldMap.Reserve(Positions.Num());
+	TArray<FVector3f> Welded;
+	Welded.Reserve(Positions.Num());
+	int32 ReferencedVertices = 0;
+
+	int32 WriteIndex = 0;
+	for (int32 Base = 0; Base < Indices.Num(); Base += 3)
+	{
+		uint32 Corners[3];
+		bool bValid = true;
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32 Old = Indices[Base + Corner];
+			if (!Positions.IsValidIndex(static_cast<int32>(Old)))
+			{
+				bValid = false;
+				break;
+			}
+			if (Remap[Old] == INDEX_NONE)
+			{
+				++ReferencedVertices;
+				const FIntVector Key = WeldKey(Positions[Old]);
+				if (const int32* Existing = WeldMap.Find(Key))
+				{
+					Remap[Old] = *Existing;
+				}
+				else
+				{
+					Remap[Old] = Welded.Add(Positions[Old]);
+					WeldMap.Add(Key, Remap[Old]);
+				}
+			}
+			Corners[Corner] = static_cast<uint32>(Remap[Old]);
+		}
+
+		if (!bValid || Corners[0] == Corners[1] || Corners[1] == Corners[2] || Corners[0] == Corners[2])
+		{
+			++Stats.DegenerateTriangles;
+			continue;
+		}
+
+		// WriteIndex never passes Base, so the in-place rewrite is safe
+		Indices[WriteIndex++] = Corners[0];
+		Indices[WriteIndex++] = Corners[1];
+		Indices[WriteIndex++] = Corners[2];
+	}
+	Indices.SetNum(WriteIndex, EAllowShrinking::No);
+	Stats.WeldedVertices = ReferencedVertices - Welded.Num();
+	Positions = MoveTemp(Welded);
+
+	// Error-bounded simplification of the positions-only mesh. No attributes means no material
+	// locks: welding already made material borders manifold, so coplanar regions merge across them.
+	FVoxelMeshSimplifySettings SimplifySettings;
+	SimplifySettings.TargetRatio = Settings.SimplifyTargetRatio;
+	SimplifySettings.MaxError = Settings.SimplifyMaxError;
+	if (SimplifySettings.IsEnabled() && Indices.Num() > 0)
+	{
+		FChunkMeshData Mesh;
+		Mesh.Positions = MoveTemp(Positions);
+		Mesh.Indices = MoveTemp(Indices);
+		FVoxelMeshSimplifier::Simplify(Mesh, SimplifySettings);
+		Positions = MoveTemp(Mesh.Positions);
+		Indices = MoveTemp(Mesh.Indices);
+	}
+
+	Stats.OutputVertices = Positions.Num();
+	Stats.OutputTriangles = Indices.Num() / 3;
+	Stats.TimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return Stats;
 }
 
 void UVoxelCollisionManager::LaunchAsyncCollisionCook(const FCollisionCookRequest& Request)
@@ -729,6 +979,36 @@ void UVoxelCollisionManager::LaunchAsyncCollisionCook(const FCollisionCookReques
 
 	AsyncCollisionInProgress.Add(Request.ChunkCoord);
 
+	// Render mesh reuse: the chunk's render mesh was meshed at the collision LOD from its current
+	// content, so only the Chaos trimesh build is left — no voxel snapshots, no second meshing pass.
+	if (CVarCollisionReuseRenderMesh.GetValueOnGameThread() != 0)
+	{
+		if (TSharedPtr<const FVoxelCollisionMeshGeometry> Offer = ChunkManager->TakeCollisionMeshOffer(Request.ChunkCoord, CollisionLODLevel))
+		{
+			++TotalRenderMeshReuses;
+			FVoxelCollisionMeshSettings MeshSettings;
+			const bool bPostProcess = ResolveCollisionMeshSettings(*Configuration, Request.LODLevel, MeshSettings);
+			TWeakObjectPtr<UVoxelCollisionManager> WeakThis(this);
+			Async(EAsyncExecution::ThreadPool, [WeakThis, Offer = MoveTemp(Offer), ChunkCoord = Request.ChunkCoord, LODLevel = Request.LODLevel, bPostProcess, MeshSettings]()
+			{
+				FAsyncCollisionResult Result;
+				Result.ChunkCoord = ChunkCoord;
+				Result.LODLevel = LODLevel;
+
+				// The offer is shared and immutable: post-process a private copy
+				TArray<FVector3f> Positions = Offer->Positions;
+				TArray<uint32> Indices = Offer->Indices;
+				BuildCollisionResult(Positions, Indices, Offer->SkirtIndexStart, bPostProcess, MeshSettings, Result);
+
+				if (UVoxelCollisionManager* This = WeakThis.Get())
+				{
+					This->CompletedCollisionQueue.Enqueue(MoveTemp(Result));
+				}
+			});
+			return;
+		}
+	}
+
 	// Prepare meshing request on the game thread (reads ChunkStates, EditManager — game thread
 	// only). Voxel data comes back as SHARED snapshots (edit-merged, cached per content version
 	// by the seam pipeline): the chunk's own volume AND the 26-neighborhood. The worker below
@@ -765,28 +1045,46 @@ void UVoxelCollisionManager::LaunchAsyncCollisionCook(const FCollisionCookReques
 	TWeakObjectPtr<UVoxelCollisionManager> WeakThis(this);
 	const bool bDeepOff = ChunkManager->IsDeepSliceOff();
 	const bool bDeepFull = ChunkManager->IsDeepSliceFull();
+	const bool bPaddedApron = ChunkManager->UsePaddedApronLayout() && MesherPtr->SupportsPaddedVolume();
+	const EVoxelApronFill ApronFill = ChunkManager->GetPaddedApronFill();
 	const int32 ChunkSizeCapture = Configuration->ChunkSize;
+	FVoxelCollisionMeshSettings MeshSettings;
+	const bool bPostProcess = ResolveCollisionMeshSettings(*Configuration, Request.LODLevel, MeshSettings);
 
 	LastPrepMs += static_cast<float>((FPlatformTime::Seconds() - PrepT0) * 1000.0);
+	++TotalMeshedCooks;
 
 	// Launch async task: mesh generation + Chaos trimesh construction on thread pool
-	Async(EAsyncExecution::ThreadPool, [WeakThis, MesherPtr, MeshRequest = MoveTemp(MeshRequest), SharedVoxels = MoveTemp(SharedVoxels), NeighborSnapshots = MoveTemp(NeighborSnapshots), ChunkCoord, LODLevel, bDeepOff, bDeepFull, ChunkSizeCapture]() mutable
+	Async(EAsyncExecution::ThreadPool, [WeakThis, MesherPtr, MeshRequest = MoveTemp(MeshRequest), SharedVoxels = MoveTemp(SharedVoxels), NeighborSnapshots = MoveTemp(NeighborSnapshots), ChunkCoord, LODLevel, bDeepOff, bDeepFull, bPaddedApron, ApronFill, ChunkSizeCapture, bPostProcess, MeshSettings]() mutable
 	{
 		FAsyncCollisionResult Result;
 		Result.ChunkCoord = ChunkCoord;
 		Result.LODLevel = LODLevel;
 
-		// Materialize the shared voxel snapshot into the request off the game thread (the
-		// snapshot outlives cache eviction via this ref; see PrepareCollisionMeshRequest).
+		// Attach the shared voxel snapshot to the request — no copy (the snapshot outlives cache
+		// eviction and later chunk writes via this ref; see PrepareCollisionMeshRequest).
 		if (SharedVoxels.IsValid())
 		{
-			MeshRequest.VoxelData = *SharedVoxels;
-			SharedVoxels.Reset();
+			MeshRequest.SharedVoxelData = MoveTemp(SharedVoxels);
 		}
 
+		// Padded apron layout: the snapshots become the apron of one dense volume (row copies).
+		if (bPaddedApron)
+		{
+			VoxelNeighborSlices::InitPadded(bDeepOff, bDeepFull, ApronFill,
+				[&NeighborSnapshots, &ChunkCoord](const FIntVector& Offset) -> TSharedPtr<const TArray<FVoxelData>>
+				{
+					const TSharedPtr<const TArray<FVoxelData>>* Found = NeighborSnapshots.Find(ChunkCoord + Offset);
+					return Found ? *Found : nullptr;
+				},
+				MeshRequest);
+			NeighborSnapshots.Empty();
+			MeshRequest.AssemblePaddedVolume();
+		}
 		// Extract the 26-neighborhood slices from the shared snapshots off the game thread.
 		// Snapshots are already edit-merged; a missing map entry means that neighbor had no
 		// data at launch time (same semantics as the game-thread extraction path).
+		else
 		{
 			const int32 CS = ChunkSizeCapture;
 			auto HasNeighborData = [&NeighborSnapshots](const FIntVector& NCoord) -> bool
@@ -823,45 +1121,8 @@ void UVoxelCollisionManager::LaunchAsyncCollisionCook(const FCollisionCookReques
 
 		if (bMeshSuccess && MeshData.IsValid())
 		{
-			const TArray<FVector3f>& Vertices = MeshData.Positions;
-			const TArray<uint32>& Indices = MeshData.Indices;
-
-			Result.NumVertices = Vertices.Num();
-			Result.NumTriangles = Indices.Num() / 3;
-
-			// Step 2: Build Chaos trimesh (~1-2ms)
-			TArray<Chaos::TVec3<Chaos::FRealSingle>> ChaosVertices;
-			TArray<Chaos::TVector<int32, 3>> ChaosTriangles;
-
-			ChaosVertices.Reserve(Vertices.Num());
-			for (const FVector3f& V : Vertices)
-			{
-				ChaosVertices.Add(Chaos::TVec3<Chaos::FRealSingle>(V.X, V.Y, V.Z));
-			}
-
-			const int32 NumTriangles = Indices.Num() / 3;
-			ChaosTriangles.Reserve(NumTriangles);
-			for (int32 i = 0; i < NumTriangles; ++i)
-			{
-				ChaosTriangles.Add(Chaos::TVector<int32, 3>(
-					static_cast<int32>(Indices[i * 3 + 0]),
-					static_cast<int32>(Indices[i * 3 + 1]),
-					static_cast<int32>(Indices[i * 3 + 2])
-				));
-			}
-
-			// Create the Chaos trimesh implicit object (thread-safe — pure data construction)
-			TRefCountPtr<Chaos::FTriangleMeshImplicitObject> TriMesh = new Chaos::FTriangleMeshImplicitObject(
-				MoveTemp(ChaosVertices),
-				MoveTemp(ChaosTriangles),
-				TArray<uint16>() // Empty materials array
-			);
-
-			if (TriMesh.IsValid())
-			{
-				Result.TriMesh = MoveTemp(TriMesh);
-				Result.bSuccess = true;
-			}
+			// Step 2: Weld / simplify, then build the Chaos trimesh (~1-2ms)
+			BuildCollisionResult(MeshData.Positions, MeshData.Indices, MeshData.SkirtIndexStart, bPostProcess, MeshSettings, Result);
 		}
 
 		// Enqueue result for game thread (thread-safe MPSC queue)
@@ -897,6 +1158,13 @@ void UVoxelCollisionManager::ProcessCompletedCollisionCooks()
 
 		if (Result.bSuccess)
 		{
+			if (Result.MeshStats.InputTriangles > 0)
+			{
+				LastPostProcessMs += Result.MeshStats.TimeMs;
+				LastTrianglesRemoved += Result.MeshStats.InputTriangles - Result.MeshStats.OutputTriangles;
+				TotalPostProcessInputTriangles += Result.MeshStats.InputTriangles;
+				TotalPostProcessOutputTriangles += Result.MeshStats.OutputTriangles;
+			}
 			ApplyCollisionResult(Result);
 			++AppliedCount;
 		}
@@ -995,26 +1263,17 @@ void UVoxelCollisionManager::RequestCollision(const FIntVector& ChunkCoord, floa
 		return;
 	}
 
-	// Already queued — bump its priority if this request is higher, then re-sort. Lets ForcePathCoverage
-	// promote a chunk that UpdateCollisionDecisions queued at a low center-distance priority.
-	if (CookingQueueSet.Contains(ChunkCoord))
+	// Already queued — bump its priority if this request is higher (O(log n) increase-key). Lets
+	// ForcePathCoverage promote a chunk that UpdateCollisionDecisions queued at a low center-distance priority.
+	if (const FCollisionCookRequest* Queued = CookingQueue.Find(ChunkCoord))
 	{
-		for (int32 i = 0; i < CookingQueue.Num(); ++i)
+		if (Priority > Queued->Priority)
 		{
-			if (CookingQueue[i].ChunkCoord == ChunkCoord)
+			CookingQueue.Modify(ChunkCoord, [this, Priority](FCollisionCookRequest& Bumped)
 			{
-				if (Priority > CookingQueue[i].Priority)
-				{
-					CookingQueue.RemoveAt(i);
-					FCollisionCookRequest Bumped;
-					Bumped.ChunkCoord = ChunkCoord;
-					Bumped.LODLevel = CollisionLODLevel;
-					Bumped.Priority = Priority;
-					const int32 BumpIdx = Algo::LowerBound(CookingQueue, Bumped);
-					CookingQueue.Insert(Bumped, BumpIdx);
-				}
-				return;
-			}
+				Bumped.LODLevel = CollisionLODLevel;
+				Bumped.Priority = Priority;
+			});
 		}
 		return;
 	}
@@ -1025,12 +1284,8 @@ void UVoxelCollisionManager::RequestCollision(const FIntVector& ChunkCoord, floa
 	Request.LODLevel = CollisionLODLevel;
 	Request.Priority = Priority;
 
-	// Add to tracking set
-	CookingQueueSet.Add(ChunkCoord);
-
-	// Sorted insertion (lowest priority first, highest at back for O(1) Pop)
-	int32 InsertIndex = Algo::LowerBound(CookingQueue, Request);
-	CookingQueue.Insert(Request, InsertIndex);
+	// O(log n) heap insertion
+	CookingQueue.Push(Request);
 
 	UE_LOG(LogVoxelCollision, Verbose, TEXT("Chunk (%d,%d,%d) collision requested (priority=%.1f, queue=%d)"),
 		ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z, Priority, CookingQueue.Num());
@@ -1039,17 +1294,7 @@ void UVoxelCollisionManager::RequestCollision(const FIntVector& ChunkCoord, floa
 void UVoxelCollisionManager::RemoveCollision(const FIntVector& ChunkCoord)
 {
 	// Remove from queue if pending
-	if (CookingQueueSet.Remove(ChunkCoord))
-	{
-		for (int32 i = 0; i < CookingQueue.Num(); ++i)
-		{
-			if (CookingQueue[i].ChunkCoord == ChunkCoord)
-			{
-				CookingQueue.RemoveAt(i);
-				break;
-			}
-		}
-	}
+	CookingQueue.Remove(ChunkCoord);
 
 	// Note: if async is in-progress, the result will be discarded when it completes
 	// (ProcessCompletedCollisionCooks checks if chunk is still in CollisionData)
@@ -6,6 +6,47 @@
 namespace VoxelNeighborSlices
 {
 
+int32 GetNeighborPlaneDepth(int32 ChunkSize, int32 LODLevel, bool bDeepOff, bool bDeepFull)
+{
+	// A strided boundary cell reaches `stride` voxels into the neighbor and its
+	// gradient normals reach ~2*stride; one face plane only suffices at stride 1.
+	const int32 MeshStride = 1 << FMath::Clamp(LODLevel, 0, 7);
+	// Total deep planes incl. plane 0. Default stride+1 = geometry-only: the outward DC boundary
+	// cell reaches `stride` voxels deep (watertight), plus one plane for one-sided boundary normals.
+	// -VoxelDeepFull restores 2*stride (adds central-difference normal reach at higher per-job cost,
+	// ~14% slower catch-up at v6000); -VoxelDeepOff drops to 1 plane (no deep data, loses the seam fix).
+	int32 DeepDepth;
+	if (MeshStride <= 1 || bDeepOff) { DeepDepth = 1; }
+	else if (bDeepFull)             { DeepDepth = 2 * MeshStride; }
+	else                                 { DeepDepth = MeshStride + 1; }
+	// Capped so the source index stays in range.
+	return FMath::Clamp(DeepDepth - 1, 0, ChunkSize - 1) + 1;
+}
+
+void InitPadded(
+	bool bDeepOff,
+	bool bDeepFull,
+	EVoxelApronFill Fill,
+	TFunctionRef<TSharedPtr<const TArray<FVoxelData>>(const FIntVector&)> GetNeighborSnapshot,
+	FVoxelMeshingRequest& OutRequest)
+{
+	OutRequest.NeighborPlaneDepth = GetNeighborPlaneDepth(OutRequest.ChunkSize, OutRequest.LODLevel, bDeepOff, bDeepFull);
+	OutRequest.PaddedApron = OutRequest.NeighborPlaneDepth;
+	OutRequest.PaddedFill = Fill;
+
+	for (int32 DZ = -1; DZ <= 1; ++DZ)
+	for (int32 DY = -1; DY <= 1; ++DY)
+	for (int32 DX = -1; DX <= 1; ++DX)
+	{
+		if (DX == 0 && DY == 0 && DZ == 0)
+		{
+			continue;
+		}
+		OutRequest.PaddedSources[FVoxelMeshingRequest::GetPaddedSlot(DX, DY, DZ)] = GetNeighborSnapshot(FIntVector(DX, DY, DZ));
+	}
+	OutRequest.UpdatePaddedPresence();
+}
+
 void Extract(
 	int32 ChunkSize,
 	const FIntVector& ChunkCoord,
@@ -21,23 +62,12 @@ void Extract(
 	OutRequest.EdgeCornerFlags = 0;
 
 	// ---- Deep neighbor planes (smooth meshers at LOD > 0) ----
-	// A strided boundary cell reaches `stride` voxels into the neighbor and its
-	// gradient normals reach ~2*stride; one face plane only suffices at stride 1.
-	// For LOD > 0 we additionally supply (2*stride - 1) deeper planes per face so
+	// For LOD > 0 we additionally supply deeper planes per face (GetNeighborPlaneDepth) so
 	// Dual Contouring's outward boundary cell computes identically to the inward
 	// neighbor (watertight), and Marching Cubes gets correct boundary normals. LOD 0
-	// keeps a single plane (no extra cost). Capped so the source index stays in range.
-	const int32 MeshStride = 1 << FMath::Clamp(OutRequest.LODLevel, 0, 7);
-	// Total deep planes incl. plane 0. Default stride+1 = geometry-only: the outward DC boundary
-	// cell reaches `stride` voxels deep (watertight), plus one plane for one-sided boundary normals.
-	// -VoxelDeepFull restores 2*stride (adds central-difference normal reach at higher per-job cost,
-	// ~14% slower catch-up at v6000); -VoxelDeepOff drops to 1 plane (no deep data, loses the seam fix).
-	int32 DeepDepth;
-	if (MeshStride <= 1 || bDeepOff) { DeepDepth = 1; }
-	else if (bDeepFull)             { DeepDepth = 2 * MeshStride; }
-	else                                 { DeepDepth = MeshStride + 1; }
-	const int32 ExtraPlanes = FMath::Clamp(DeepDepth - 1, 0, ChunkSize - 1);
-	OutRequest.NeighborPlaneDepth = ExtraPlanes + 1;
+	// keeps a single plane (no extra cost).
+	OutRequest.NeighborPlaneDepth = GetNeighborPlaneDepth(ChunkSize, OutRequest.LODLevel, bDeepOff, bDeepFull);
+	const int32 ExtraPlanes = OutRequest.NeighborPlaneDepth - 1;
 
 	// Fill a Deep array with planes one voxel deeper than the face slice (plane 0).
 	// Axis: 0=X face, 1=Y face, 2=Z face; bNeg selects the -axis neighbor. Only fills
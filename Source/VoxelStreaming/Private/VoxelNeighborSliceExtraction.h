@@ -10,6 +10,10 @@
 //   - the collision cook worker path reads pre-grabbed shared voxel snapshots (edit-merged),
 //     moving the ~6 ms/cook of cache-missing strided reads off the game thread (P4a).
 // One body, two wrappers — behavior stays bit-identical between the paths.
+//
+// The padded apron layout (voxel.Meshing.PaddedApron) replaces the per-voxel extraction with
+// snapshot hand-off: InitPadded attaches the 26 neighbor snapshots to the request, and the worker
+// assembles one dense padded volume with row copies (FVoxelMeshingRequest::AssemblePaddedVolume).
 
 #pragma once
 
@@ -18,9 +22,31 @@
 
 struct FVoxelMeshingRequest;
 struct FVoxelData;
+enum class EVoxelApronFill : uint8;
 
 namespace VoxelNeighborSlices
 {
+	/**
+	 * Neighbor planes (incl. plane 0) a mesh at LODLevel reads past each chunk face: 1 at stride 1
+	 * or with bDeepOff, 2*stride with bDeepFull, else stride+1; capped at ChunkSize.
+	 */
+	int32 GetNeighborPlaneDepth(int32 ChunkSize, int32 LODLevel, bool bDeepOff, bool bDeepFull);
+
+	/**
+	 * Switch OutRequest to the padded apron layout: apron depth per GetNeighborPlaneDepth, the given
+	 * absent-neighbor fill, one snapshot per present neighbor and the matching presence flags.
+	 * Call once per request (26 lookups, no voxel reads); the volume itself is assembled later.
+	 *
+	 * @param GetNeighborSnapshot Edit-merged snapshot of the neighbor at a chunk offset in [-1,1]^3, or null.
+	 * @param OutRequest          Request to fill (ChunkSize and LODLevel must already be set).
+	 */
+	void InitPadded(
+		bool bDeepOff,
+		bool bDeepFull,
+		EVoxelApronFill Fill,
+		TFunctionRef<TSharedPtr<const TArray<FVoxelData>>(const FIntVector&)> GetNeighborSnapshot,
+		FVoxelMeshingRequest& OutRequest);
+
 	/**
 	 * Fill OutRequest's neighbor slice/edge/corner arrays + flags from an arbitrary voxel source.
 	 *
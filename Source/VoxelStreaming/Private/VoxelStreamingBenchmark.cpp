@@ -144,7 +144,28 @@ void FVoxelStreamingBenchmark::TakeSample(float DeltaTime)
 	S.RemeshCount = ChunkManager->GetBenchRemeshCount();
 	S.SeamMs = T.SeamMs;
 	S.CollPrepMs = T.CollisionPrepMs;
+	S.CollPostMs = T.CollisionPostProcessMs;
+	S.CollTrisCut = T.CollisionTrianglesRemoved;
 	S.CollApplyMs = T.CollisionApplyMs;
+	S.PersistMs = T.PersistMs;
+	S.PersistReadMBps = S.PersistWriteMBps = 0.0f;
+	S.PersistWriteQ = S.PersistReadQ = 0;
+	if (const FVoxelChunkPersistence* Persistence = ChunkManager->GetPersistence())
+	{
+		const FVoxelChunkPersistenceStats P = Persistence->GetStats();
+		if (FirstPersistBytesRead < 0)
+		{
+			FirstPersistBytesRead = LastPersistBytesRead = P.BytesRead;
+			FirstPersistBytesWritten = LastPersistBytesWritten = P.BytesWritten;
+		}
+		const double BytesToMBps = 1.0 / (1024.0 * 1024.0 * FMath::Max(DeltaTime, SMALL_NUMBER));
+		S.PersistReadMBps = static_cast<float>((P.BytesRead - LastPersistBytesRead) * BytesToMBps);
+		S.PersistWriteMBps = static_cast<float>((P.BytesWritten - LastPersistBytesWritten) * BytesToMBps);
+		S.PersistWriteQ = P.WriteQueueDepth;
+		S.PersistReadQ = P.ReadQueueDepth;
+		LastPersistBytesRead = P.BytesRead;
+		LastPersistBytesWritten = P.BytesWritten;
+	}
 	Samples.Add(S);
 }
 
@@ -242,10 +263,10 @@ void FVoxelStreamingBenchmark::WriteReport()
 	ReportCsvPath = Base + TEXT(".csv");
 
 	// ---- CSV time-series ----
-	FString Csv = TEXT("SimTime,Phase,PosX,PosY,PosZ,GenQ,MeshQ,UnloadQ,UploadQ,GenInFlight,Loaded,Total,FrameMs,GenMs,MeshMs,LODMs,StreamMs,TotalMs,RenderMs,CollMs,ScatMs,GenLaunchMs,GenPollMs,GenApplyMs,GenStoreMs,GenNotifyMs,GenNeighborMs,GenApplyN,MeshTickMs,MeshLaunchMs,MeshApplyMs,MeshSnapMs,MeshSliceMs,MeshDispMs,MeshLaunchN,RendMeshMs,RendSubRendMs,RendSubScatMs,RendSubWatMs,RendUnloadMs,RendWTileMs,RendFlushMs,RendSubmitN,Remesh,SeamMs,CollPrepMs,CollApplyMs\n");
+	FString Csv = TEXT("SimTime,Phase,PosX,PosY,PosZ,GenQ,MeshQ,UnloadQ,UploadQ,GenInFlight,Loaded,Total,FrameMs,GenMs,MeshMs,LODMs,StreamMs,TotalMs,RenderMs,CollMs,ScatMs,GenLaunchMs,GenPollMs,GenApplyMs,GenStoreMs,GenNotifyMs,GenNeighborMs,GenApplyN,MeshTickMs,MeshLaunchMs,MeshApplyMs,MeshSnapMs,MeshSliceMs,MeshDispMs,MeshLaunchN,RendMeshMs,RendSubRendMs,RendSubScatMs,RendSubWatMs,RendUnloadMs,RendWTileMs,RendFlushMs,RendSubmitN,Remesh,SeamMs,CollPrepMs,CollPostMs,CollTrisCut,CollApplyMs,PersistMs,PersistReadMBps,PersistWriteMBps,PersistWriteQ,PersistReadQ\n");
 	for (const FSample& S : Samples)
 	{
-		Csv += FString::Printf(TEXT("%.3f,%d,%.0f,%.0f,%.0f,%d,%d,%d,%d,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%lld,%.3f,%.3f,%.3f\n"),
+		Csv += FString::Printf(TEXT("%.3f,%d,%.0f,%.0f,%.0f,%d,%d,%d,%d,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%lld,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f,%.3f,%d,%d\n"),
 			S.SimTime, S.Phase, S.PosX, S.PosY, S.PosZ, S.GenQueue, S.MeshQueue, S.UnloadQueue, S.PendingUpload,
 			S.GenInFlight, S.LoadedChunks, S.TotalChunks, S.FrameMs, S.GenMs, S.MeshMs, S.LODMs, S.StreamMs, S.TotalMs,
 			S.RenderMs, S.CollMs, S.ScatMs,
@@ -254,12 +275,13 @@ void FVoxelStreamingBenchmark::WriteReport()
 			S.MeshSnapMs, S.MeshSliceMs, S.MeshDispMs, S.MeshLaunchCount,
 			S.RendMeshMs, S.RendSubRendMs, S.RendSubScatMs, S.RendSubWatMs,
 			S.RendUnloadMs, S.RendWTileMs, S.RendFlushMs, S.RendSubmitCount,
-			S.RemeshCount, S.SeamMs, S.CollPrepMs, S.CollApplyMs);
+			S.RemeshCount, S.SeamMs, S.CollPrepMs, S.CollPostMs, S.CollTrisCut, S.CollApplyMs,
+			S.PersistMs, S.PersistReadMBps, S.PersistWriteMBps, S.PersistWriteQ, S.PersistReadQ);
 	}
 	FFileHelper::SaveStringToFile(Csv, *ReportCsvPath);
 
 	// ---- summary over the traverse phase (the loaded window) ----
-	int32 PeakGen = 0, PeakMesh = 0, PeakUnload = 0, MaxLoaded = 0;
+	int32 PeakGen = 0, PeakMesh = 0, PeakUnload = 0, MaxLoaded = 0, PeakPersistWriteQ = 0;
 	TArray<float> FrameMsArr, TotalMsArr;
 	for (const FSample& S : Samples)
 	{
@@ -268,6 +290,7 @@ void FVoxelStreamingBenchmark::WriteReport()
 		PeakGen = FMath::Max(PeakGen, S.GenQueue);
 		PeakMesh = FMath::Max(PeakMesh, S.MeshQueue);
 		PeakUnload = FMath::Max(PeakUnload, S.UnloadQueue);
+		PeakPersistWriteQ = FMath::Max(PeakPersistWriteQ, S.PersistWriteQ);
 		FrameMsArr.Add(S.FrameMs);
 		TotalMsArr.Add(S.TotalMs);
 	}
@@ -282,6 +305,8 @@ void FVoxelStreamingBenchmark::WriteReport()
 	const int64 ThrashDirty = ChunkManager->GetBenchRemeshByReason(EVoxelRemeshReason::Dirty);
 	const int64 ThrashOther = ChunkManager->GetBenchRemeshByReason(EVoxelRemeshReason::Other);
 	const double TraverseDur = CatchUpStartSimTime - TraverseStartSimTime;
+	const double PersistReadMB = FirstPersistBytesRead >= 0 ? (LastPersistBytesRead - FirstPersistBytesRead) / (1024.0 * 1024.0) : 0.0;
+	const double PersistWriteMB = FirstPersistBytesWritten >= 0 ? (LastPersistBytesWritten - FirstPersistBytesWritten) / (1024.0 * 1024.0) : 0.0;
 
 	FString Json;
 	Json += TEXT("{\n");
@@ -312,6 +337,9 @@ void FVoxelStreamingBenchmark::WriteReport()
 	Json += FString::Printf(TEXT("  \"unloadCount\": %lld,\n"), UnloadLagCount);
 	Json += FString::Printf(TEXT("  \"unloadDistMeanUU\": %.0f,\n"), UnloadDistMean);
 	Json += FString::Printf(TEXT("  \"unloadDistMaxUU\": %.0f,\n"), UnloadDistMax);
+	Json += FString::Printf(TEXT("  \"persistReadMB\": %.2f,\n"), PersistReadMB);
+	Json += FString::Printf(TEXT("  \"persistWriteMB\": %.2f,\n"), PersistWriteMB);
+	Json += FString::Printf(TEXT("  \"peakPersistWriteQueue\": %d,\n"), PeakPersistWriteQ);
 	Json += FString::Printf(TEXT("  \"effMaxAsyncGen\": %d,\n"), ChunkManager->GetEffectiveMaxAsyncGenerationTasks());
 	Json += FString::Printf(TEXT("  \"effMaxAsyncMesh\": %d,\n"), ChunkManager->GetEffectiveMaxAsyncMeshTasks());
 	Json += FString::Printf(TEXT("  \"effMaxLODRemeshPerFrame\": %d,\n"), ChunkManager->GetEffectiveMaxLODRemeshPerFrame());
@@ -1832,8 +1832,9 @@ void AVoxelWorldTestActor::DrawPerformanceHUD() const
 			Timing.GenerationMs, Timing.MeshingMs, Timing.SeamMs, Timing.RenderSubmitMs,
 			Timing.LODMs, Timing.ScatterMs));
 	GEngine->AddOnScreenDebugMessage(LineKey--, 0.0f, FColor::White,
-		FString::Printf(TEXT("  Coll=%.1fms (prep=%.1f apply=%.1f)  Total=%.1fms"),
-			Timing.CollisionMs, Timing.CollisionPrepMs, Timing.CollisionApplyMs, Timing.TotalMs));
+		FString::Printf(TEXT("  Coll=%.1fms (prep=%.1f apply=%.1f, worker post=%.1f -%d tris)  Total=%.1fms"),
+			Timing.CollisionMs, Timing.CollisionPrepMs, Timing.CollisionApplyMs,
+			Timing.CollisionPostProcessMs, Timing.CollisionTrianglesRemoved, Timing.TotalMs));
 
 	// Chunks
 	GEngine->AddOnScreenDebugMessage(LineKey--, 0.0f, ChunkColor,
@@ -1911,6 +1912,15 @@ void AVoxelWorldTestActor::DrawPerformanceHUD() const
 			MemStats.RendererGPUBytes / (1024.0f * 1024.0f),
 			MemStats.CollisionBytes / (1024.0f * 1024.0f),
 			MemStats.ScatterBytes / (1024.0f * 1024.0f)));
+	if (MemStats.EditDataBytes > 0)
+	{
+		GEngine->AddOnScreenDebugMessage(LineKey--, 0.0f, FColor::White,
+			FString::Printf(TEXT("  Edits: History=%.1fMB DenseChunks=%d Merges=%d LastMerge=%.3fms"),
+				MemStats.EditHistoryBytes / (1024.0f * 1024.0f),
+				MemStats.DenseEditChunks,
+				MemStats.EditMerges,
+				MemStats.EditMergeMs));
+	}
 	GEngine->AddOnScreenDebugMessage(LineKey--, 0.0f, FColor(128, 128, 128),
 		FString::Printf(TEXT("  Process Total: %.0f MB (includes UE Editor)"), ProcessMB));
 
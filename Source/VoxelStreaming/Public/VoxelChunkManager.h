@@ -9,6 +9,7 @@
 #include "ChunkDescriptor.h"
 #include "ChunkRenderData.h"
 #include "LODTypes.h"
+#include "VoxelChunkPriorityQueue.h"
 #include "IVoxelNoiseGenerator.h"
 #include "VoxelCPUNoiseGenerator.h"
 #include "VoxelTerrainConditioning.h"
@@ -18,6 +19,7 @@
 #include "VoxelMeshingTypes.h"
 #include "VoxelStreamingBenchmark.h"
 #include "VoxelSeamRegistry.h"
+#include "VoxelChunkPersistence.h"
 #include "VoxelChunkManager.generated.h"
 
 // Forward declarations
@@ -100,6 +102,28 @@ struct FMeshBoundaryDep
 	bool bHadData = false;
 };
 
+/**
+ * Collision-relevant geometry of a completed render mesh (positions + indices only), shared
+ * immutably with the collision manager so a collision cook at the same LOD skips its own meshing
+ * pass. Tagged with the LOD and chunk content version it was meshed from; stale handles are
+ * rejected by UVoxelChunkManager::TakeCollisionMeshOffer.
+ */
+struct FVoxelCollisionMeshGeometry
+{
+	TArray<FVector3f> Positions;
+	TArray<uint32> Indices;
+	int32 LODLevel = 0;
+	uint32 ContentVersion = 0;
+
+	/** FChunkMeshData::SkirtIndexStart of the source mesh (collision drops the skirts) */
+	int32 SkirtIndexStart = INDEX_NONE;
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return Positions.GetAllocatedSize() + Indices.GetAllocatedSize();
+	}
+};
+
 /**
  * Delegate fired when a chunk completes generation.
  */
@@ -382,6 +406,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel|ChunkManager")
 	UVoxelEditManager* GetEditManager() const { return EditManager; }
 
+	/**
+	 * Get the async chunk persistence stage (null unless bEnableChunkPersistence).
+	 */
+	const FVoxelChunkPersistence* GetPersistence() const { return Persistence.Get(); }
+
 	/**
 	 * Get the collision manager.
 	 */
@@ -449,13 +478,12 @@ public:
 	 *
 	 * Voxel data handling depends on the optional out params (P4a: the full-volume copy and the
 	 * strided 26-neighbor slice extraction were the dominant per-cook game-thread costs):
-	 * - OutSharedVoxels non-null: the (edit-merged, content-version-keyed) shared snapshot from
-	 *   the seam cache is returned there; OutMeshRequest.VoxelData is left EMPTY for the async
-	 *   worker to materialize off the game thread.
+	 * - OutSharedVoxels non-null: the (edit-merged, content-version-keyed) shared snapshot is
+	 *   returned there; OutMeshRequest carries no voxel data until the async worker attaches it.
 	 * - OutNeighborSnapshots non-null: neighbor snapshots for the 26-neighborhood are returned
 	 *   there (map lookups, build-on-miss) and NO slice extraction happens on the game thread —
 	 *   the worker runs VoxelNeighborSlices::Extract over the snapshots instead.
-	 * - Both null: fully materialized inline (synchronous callers), original behavior.
+	 * - Both null: the shared snapshot is attached and slices are extracted inline (synchronous callers).
 	 *
 	 * @param ChunkCoord Chunk coordinate
 	 * @param LODLevel LOD level for collision mesh
@@ -475,19 +503,53 @@ public:
 	bool IsDeepSliceOff() const { return bDeepDepthOff; }
 	bool IsDeepSliceFull() const { return bDeepDepthFull; }
 
+	/** Whether CPU smooth meshing / collision cooks use the padded apron layout (voxel.Meshing.PaddedApron). */
+	bool UsePaddedApronLayout() const;
+
+	/** Absent-neighbor apron fill matching the configured mesher's legacy out-of-bounds read. */
+	EVoxelApronFill GetPaddedApronFill() const;
+
+	/** Whether far chunks are generated on a strided lattice this tick (voxel.Generation.LODStride + mesher gate). */
+	bool IsStridedGenerationActive() const { return bStridedGenerationActive; }
+
+	/** Lattice stride a chunk meshed at LODLevel is generated at: half its mesh stride while strided generation is active, else 1. */
+	int32 GetGenerationStrideForLOD(int32 LODLevel) const;
+
+	/** The chunk's payload can't serve a mesher at LODLevel: strided too coarsely, or strided generation is off. */
+	bool NeedsRegenerationForLOD(const FChunkDescriptor& Descriptor, int32 LODLevel) const;
+
 	/**
 	 * Get raw pointer to the mesher (for async dispatch).
 	 * The mesher's GenerateMeshCPU is stateless and thread-safe.
 	 */
 	IVoxelMesher* GetMesherPtr() const { return Mesher.Get(); }
 
+	// ==================== Collision Mesh Reuse ====================
+
+	/**
+	 * Take the render mesh geometry offered for ChunkCoord's collision cook (game thread only).
+	 * The offer is consumed either way; it is returned only if it was meshed at LODLevel from the
+	 * chunk's current content version.
+	 */
+	TSharedPtr<const FVoxelCollisionMeshGeometry> TakeCollisionMeshOffer(const FIntVector& ChunkCoord, int32 LODLevel);
+
+	/**
+	 * Whether an in-flight render mesh of ChunkCoord at LODLevel, launched from the chunk's current
+	 * content version, will offer its geometry on completion. The collision manager defers the
+	 * chunk's cook while this holds instead of meshing it a second time.
+	 */
+	bool IsCollisionMeshOfferPending(const FIntVector& ChunkCoord, int32 LODLevel) const;
+
+	/** Bytes held by completed, not yet taken collision mesh offers */
+	int64 GetCollisionMeshOfferBytes() const;
+
 	// ==================== Performance Stats ====================
 
 	/** Voxel-specific memory breakdown */
 	struct FVoxelMemoryStats
 	{
 		int64 VoxelDataBytes = 0;      // ChunkStates voxel data
-		int64 EditDataBytes = 0;       // Edit manager memory
+		int64 EditDataBytes = 0;       // Edit manager memory (layers + undo/redo history)
 		int64 RendererCPUBytes = 0;    // Renderer CPU-side memory
 		int64 RendererGPUBytes = 0;    // Renderer GPU memory
 		int64 CollisionBytes = 0;      // Collision manager memory
@@ -500,6 +562,17 @@ public:
 		int32 CompressedChunks = 0;    // held in a compressed side buffer (PR C)
 		int32 EmptyChunks = 0;         // no voxel payload
 		int64 CompressionSavedBytes = 0; // raw bytes NOT resident thanks to uniform/compressed tiers
+		int32 CodecJobsInFlight = 0;   // async compaction / expansion jobs on workers
+		int64 AsyncCompactions = 0;    // lifetime async compactions swapped in
+		int64 AsyncExpansions = 0;     // lifetime pre-decompressions swapped in
+		int64 AsyncCodecDiscarded = 0; // lifetime results dropped (chunk changed / gone / no longer idle)
+		double AsyncCodecWorkerMs = 0.0; // lifetime worker codec time (off the game thread)
+
+		// Edit storage breakdown (EditDataBytes = layer bytes + EditHistoryBytes).
+		int64 EditHistoryBytes = 0;    // undo/redo stacks, held out of line from the layers
+		int32 DenseEditChunks = 0;     // edit layers switched to 8^3 brick storage
+		int32 EditMerges = 0;          // edit-layer merges into voxel snapshots so far
+		float EditMergeMs = 0.0f;      // duration of the most recent merge
 	};
 
 	/** Per-system timing breakdown (milliseconds) */
@@ -513,9 +586,14 @@ public:
 		// neighbor slices) vs completed-cook application (BodySetup + component recreation).
 		float CollisionPrepMs = 0.0f;
 		float CollisionApplyMs = 0.0f;
+		// Collision mesh post-process (weld / skirt drop / simplify) of the cooks applied this tick:
+		// worker time, not game-thread time, and the triangles it removed.
+		float CollisionPostProcessMs = 0.0f;
+		int32 CollisionTrianglesRemoved = 0;
 		float ScatterMs = 0.0f;
 		float LODMs = 0.0f;
 		float StreamingMs = 0.0f;
+		float PersistMs = 0.0f;     // TickPersistence: drain reads, prefetch, write-behind hand-off
 		float TotalMs = 0.0f;
 
 		// Generation sub-phases (GenerationMs = launch + poll + apply). Added to attribute the
@@ -708,6 +786,30 @@ protected:
 	 */
 	void ProcessUnloadQueue(int32 MaxChunks);
 
+	// ==================== Chunk Persistence ====================
+
+	/**
+	 * Game-thread side of the persistence stage: drain finished reads, settle confirmed writes,
+	 * prefetch records for the head of the generation queue and hand dirty chunks to the write-behind queue.
+	 */
+	void TickPersistence();
+
+	/** Report finished writes to the edit manager and release the edits of unloaded chunks they cover */
+	void SettlePersistedWrites();
+
+	/**
+	 * Merge a Found record into a chunk about to generate. Returns true if the record carried
+	 * voxels and the chunk was completed from them (generation skipped).
+	 */
+	bool ApplyPersistedRecord(const FChunkLODRequest& Request);
+
+	/**
+	 * Hand an unloading chunk's edits (and voxels, if voxel.Persist.SaveVoxelData) to the write-behind
+	 * queue and release its edit layer once the write is confirmed. Edits stay resident if the queue is
+	 * full or they are in undo history.
+	 */
+	void PersistChunkOnUnload(const FIntVector& ChunkCoord);
+
 	/**
 	 * Evaluate LOD level changes for loaded chunks and queue remeshes.
 	 * Separated from morph updates so it can run when queues drain,
@@ -741,10 +843,45 @@ protected:
 	/**
 	 * Budgeted per-tick far-chunk voxel-data compression sweep. Compacts idle, settled far chunks
 	 * (see voxel.FarCompression.* cvars); access transparently re-materializes via EnsureResident().
-	 * PR B: uniform-chunk collapse only.
+	 * With voxel.FarCompression.Async the encode runs on codec workers and the sweep only launches
+	 * jobs, swaps in finished ones and pre-decompresses chunks about to refine.
 	 */
 	void ProcessFarCompressionSweep();
 
+	/** Hand a chunk's published voxel snapshot to a codec worker for compaction. */
+	void LaunchAsyncFarCompaction(const FIntVector& ChunkCoord, FChunkDescriptor& Descriptor, EVoxelChunkCodec Codec);
+
+	/** Hand a compressed chunk's buffer to a codec worker for expansion ahead of its LOD-refine remesh. */
+	void LaunchAsyncFarExpansion(const FIntVector& ChunkCoord, const FChunkDescriptor& Descriptor);
+
+	/** Swap in finished codec jobs whose chunk is unchanged since launch; discard the rest. */
+	void ProcessCompletedFarCodecJobs();
+
+	/** Result of an off-thread far-chunk codec job (exactly one of Compaction / Expansion is used) */
+	struct FFarCodecResult
+	{
+		FIntVector ChunkCoord;
+		bool bExpansion = false;
+		FVoxelAsyncCompaction Compaction;
+		FVoxelAsyncExpansion Expansion;
+		double WorkerSeconds = 0.0;
+	};
+
+	/** Finished codec jobs, drained by ProcessCompletedFarCodecJobs */
+	TQueue<FFarCodecResult, EQueueMode::Mpsc> CompletedFarCodecJobs;
+
+	/** Chunks with a codec job in flight (bounded by voxel.FarCompression.MaxAsyncJobs) */
+	TSet<FIntVector> FarCodecJobsInFlight;
+
+	/** Compressed chunks predicted to refine soon (EvaluateLODLevelChanges); expanded by the sweep */
+	TSet<FIntVector> FarExpansionRequests;
+
+	/** Lifetime async codec counters (voxel.FarCompression.Stats) */
+	int64 FarCodecCompactionsApplied = 0;
+	int64 FarCodecExpansionsApplied = 0;
+	int64 FarCodecResultsDiscarded = 0;
+	double FarCodecWorkerSeconds = 0.0;
+
 	// ==================== Generation/Meshing Callbacks ====================
 
 	/**
@@ -846,11 +983,17 @@ protected:
 	 */
 	void ExtractNeighborEdgeSlices(const FIntVector& ChunkCoord, FVoxelMeshingRequest& OutRequest);
 
+	/**
+	 * Padded apron alternative to ExtractNeighborEdgeSlices: attaches the 26 neighbors' edit-merged
+	 * snapshots (no voxel reads) and presence flags. The mesh worker assembles the padded volume.
+	 */
+	void GatherPaddedNeighborhood(const FIntVector& ChunkCoord, FVoxelMeshingRequest& OutRequest);
+
 	// ==================== Queue Management ====================
 
 	/**
-	 * Add a chunk to the generation queue with sorted insertion.
-	 * Uses O(1) set lookup for duplicate detection, O(log n) binary search for insertion.
+	 * Add a chunk to the generation queue.
+	 * O(1) duplicate detection via the queue's coord index, O(log n) heap insertion.
 	 *
 	 * @param Request The chunk request to add
 	 * @return True if added, false if already in queue
@@ -858,8 +1001,8 @@ protected:
 	bool AddToGenerationQueue(const FChunkLODRequest& Request);
 
 	/**
-	 * Add a chunk to the meshing queue with sorted insertion.
-	 * Uses O(1) set lookup for duplicate detection, O(log n) binary search for insertion.
+	 * Add a chunk to the meshing queue.
+	 * O(1) duplicate detection via the queue's coord index, O(log n) heap insertion.
 	 *
 	 * @param Request The chunk request to add
 	 * @return True if added, false if already in queue
@@ -922,6 +1065,7 @@ protected:
 	 * Called on viewer chunk change to ensure closest chunks are processed first.
 	 * Also updates LOD levels for queued items so they mesh at the correct LOD
 	 * without needing a post-load LOD transition. Evicts generation work beyond ViewDistance.
+	 * Lazy: an item is only re-keyed in its queue when its chunk-distance band changed.
 	 *
 	 * @param Context Current LOD query context (viewer position, forward, etc.)
 	 */
@@ -1046,7 +1190,11 @@ private:
 	};
 	TMap<FIntVector, FSeamOwnerSlots> SeamOwnerSlots;
 
-	/** Get (building at most once per content version) the shared edit-merged snapshot of a chunk. */
+	/**
+	 * Get the shared edit-merged snapshot of a chunk: its own published buffer when it has no edits
+	 * (zero-copy), else a merge built at most once per content version. Used by the chunk-mesh,
+	 * seam, collision and scatter paths.
+	 */
 	TSharedPtr<const TArray<FVoxelData>> GetSeamVoxelSnapshot(const FIntVector& Coord, FVoxelChunkState& State);
 
 	/** This-tick resolved state of the seam-meshing pipeline (cvar + registry + CPU-DC mesher). */
@@ -1055,6 +1203,12 @@ private:
 	/** Previous-tick value, to detect on/off transitions (deactivation clears seam buckets). */
 	bool bSeamMeshingWasActive = false;
 
+	/**
+	 * This-tick resolved state of LOD-strided generation: the cvar is on and every voxel the
+	 * configured meshers read lands on a generated lattice sample (see Tick).
+	 */
+	bool bStridedGenerationActive = false;
+
 	/**
 	 * Validate + dispatch one drained seam job: P1 executes same-LOD FACE seams only (edge/corner
 	 * and mixed-LOD jobs are dropped — P2). Builds the FVoxelFaceSeamRequest from both resident
@@ -1069,19 +1223,16 @@ private:
 	/** Set of loaded chunk coordinates (for fast lookup) */
 	TSet<FIntVector> LoadedChunkCoords;
 
-	// ==================== Processing Queues ====================
-
-	/** Chunks waiting to be generated (sorted ascending — highest priority at back for O(1) pop) */
-	TArray<FChunkLODRequest> GenerationQueue;
+	/** Bumped on every change to LoadedChunkCoords; handed to the LOD strategy as FLODQueryContext::LoadedChunksGeneration */
+	uint32 LoadedChunksGeneration = 0;
 
-	/** Set of chunk coords in GenerationQueue for O(1) duplicate detection */
-	TSet<FIntVector> GenerationQueueSet;
+	// ==================== Processing Queues ====================
 
-	/** Chunks waiting to be meshed (sorted ascending — highest priority at back for O(1) pop) */
-	TArray<FChunkLODRequest> MeshingQueue;
+	/** Chunks waiting to be generated (indexed max-heap on Priority; O(1) membership, O(log n) push/pop/re-key) */
+	TVoxelChunkPriorityQueue<FChunkLODRequest> GenerationQueue;
 
-	/** Set of chunk coords in MeshingQueue for O(1) duplicate detection */
-	TSet<FIntVector> MeshingQueueSet;
+	/** Chunks waiting to be meshed (indexed max-heap on Priority; O(1) membership, O(log n) push/pop/re-key) */
+	TVoxelChunkPriorityQueue<FChunkLODRequest> MeshingQueue;
 
 	/** Chunks waiting to be unloaded */
 	TArray<FIntVector> UnloadQueue;
@@ -1204,6 +1355,8 @@ private:
 	{
 		FIntVector ChunkCoord;
 		TArray<FVoxelData> VoxelData;
+		/** Lattice stride of VoxelData (> 1 = FVoxelStridedLattice compact layout) */
+		int32 GenerationStride = 1;
 		bool bSuccess = false;
 	};
 
@@ -1261,6 +1414,9 @@ private:
 		int32 LODLevel;
 		FChunkMeshData MeshData;
 		bool bSuccess = false;
+
+		/** Positions + indices copied on the worker when the launch was recorded in PendingCollisionMeshOffers */
+		TSharedPtr<const FVoxelCollisionMeshGeometry> CollisionGeometry;
 	};
 
 	/** Thread-safe queue for completed async mesh results */
@@ -1269,6 +1425,17 @@ private:
 	/** Set of chunks currently being meshed asynchronously */
 	TSet<FIntVector> AsyncMeshingInProgress;
 
+	/** Launch-time record of a render mesh whose geometry will be offered to the collision manager */
+	struct FPendingCollisionMeshOffer
+	{
+		int32 LODLevel = 0;
+		uint32 ContentVersion = 0;
+	};
+	TMap<FIntVector, FPendingCollisionMeshOffer> PendingCollisionMeshOffers;
+
+	/** Completed render mesh geometry awaiting the chunk's collision cook (dropped on unload) */
+	TMap<FIntVector, TSharedPtr<const FVoxelCollisionMeshGeometry>> CollisionMeshOffers;
+
 	/** Note: MaxAsyncMeshTasks is now in VoxelWorldConfiguration; runtime value in EffectiveMaxAsyncMeshTasks */
 
 	/** Process completed async mesh tasks (called from game thread) */
@@ -1283,6 +1450,23 @@ private:
 	UPROPERTY()
 	TObjectPtr<UVoxelEditManager> EditManager;
 
+	/** Async region-file persistence (edits, optionally voxels); null when disabled */
+	TUniquePtr<FVoxelChunkPersistence> Persistence;
+
+	/** Last time dirty chunks were handed to the write-behind queue */
+	double LastPersistWriteBehindTime = 0.0;
+
+	/** Unloaded chunks whose edit layer is released once their pending write is confirmed */
+	TSet<FIntVector> ChunksAwaitingPersistRelease;
+
+	/**
+	 * Persisted chunks near the viewer that edit pinning considers, rebuilt when the viewer chunk
+	 * or the persisted set changes rather than scanning the whole set per load update.
+	 */
+	TArray<FIntVector> PersistedPinCandidates;
+	FIntVector PersistedPinViewerChunk = FIntVector(INT32_MAX, INT32_MAX, INT32_MAX);
+	uint32 PersistedPinGeneration = 0;
+
 	/** Collision manager for physics */
 	UPROPERTY()
 	TObjectPtr<UVoxelCollisionManager> CollisionManager;
@@ -1362,6 +1546,9 @@ private:
 	/** Smoothed viewer horizontal speed (uu/s); drives the speed-adaptive load budget. */
 	float ViewerHorizSpeed = 0.0f;
 
+	/** Smoothed viewer velocity (uu/s); extrapolates the view for far-chunk pre-decompression. */
+	FVector ViewerVelocity = FVector::ZeroVector;
+
 	/** Smoothed frame time for stable throttle decisions (EMA) */
 	float SmoothedFrameTimeMs = 16.67f;
 
@@ -0,0 +1,257 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "VoxelRegionFile.h"
+#include <atomic>
+
+class FVoxelWorldSave;
+
+/** What the persistence stage knows about a chunk's saved record (see FVoxelChunkPersistence::Lookup). */
+enum class EVoxelPersistedChunk : uint8
+{
+	/** Never requested */
+	Unknown,
+	/** A read is queued or in flight */
+	Pending,
+	/** Nothing usable on disk (never saved, removed, or rejected by the CRC check) */
+	Missing,
+	/** A record is cached and ready for TakeRecord */
+	Found
+};
+
+/** Counters for an FVoxelChunkPersistence (bytes / seconds are lifetime totals; queues are current). */
+struct FVoxelChunkPersistenceStats
+{
+	/** Distinct chunks waiting for or being written by the worker */
+	int32 WriteQueueDepth = 0;
+	/** Reads waiting for or being served by the worker */
+	int32 ReadQueueDepth = 0;
+	/** Lookup entries held on the game thread (pending, missing and found) */
+	int32 TrackedChunks = 0;
+
+	int64 ChunksRead = 0;
+	int64 ChunksWritten = 0;
+	int64 BytesRead = 0;
+	int64 BytesWritten = 0;
+
+	/** Worker time spent reading / writing (encode, compress and file I/O) */
+	double ReadSeconds = 0.0;
+	double WriteSeconds = 0.0;
+
+	/** QueueWrite / Prefetch calls refused because their queue was full */
+	int64 WritesRejected = 0;
+	int64 ReadsRejected = 0;
+
+	/** Writes the worker could not complete */
+	int64 WriteFailures = 0;
+
+	/** Region files rewritten by the worker's compaction passes */
+	int64 Compactions = 0;
+};
+
+/** Outcome of a queued write, reported by FVoxelChunkPersistence::TakeFinishedWrites. */
+struct FVoxelChunkWriteResult
+{
+	FIntVector ChunkCoord = FIntVector::ZeroValue;
+	/** The record is on disk (blob and slot flushed); false leaves the previous record in place */
+	bool bSucceeded = false;
+};
+
+/**
+ * Off-thread chunk persistence: a bounded write-behind queue and a read-ahead cache in front of an
+ * FVoxelWorldSave, so the game thread never touches disk, LZ4 or a CRC.
+ *
+ * Writes: QueueWrite hands over a record (and optionally the chunk's generated voxels, which the
+ * worker compresses into the record's voxel payload). Queued writes coalesce per chunk (latest wins)
+ * and the queue is bounded by MaxQueuedWrites distinct chunks; a refused write stays the caller's
+ * responsibility (keep the chunk dirty and retry). Flush blocks until every queued write is on disk.
+ * A write is only durable once TakeFinishedWrites reports it: callers must not drop the in-memory
+ * copy of a chunk's edits before then, and must re-dirty the chunk if the write failed.
+ *
+ * Compaction: every CompactEveryWrites writes, and on Flush, the worker rewrites open region files
+ * whose dead bytes exceed CompactDeadRatio of the file (see FVoxelWorldSave::CompactRegions).
+ *
+ * Reads: Prefetch / Lookup queue a read (bounded by MaxQueuedReads); Tick moves finished reads into
+ * a lookup table that Lookup / TakeRecord consult. Each worker batch runs its writes before its
+ * reads, so a read requested after a write always sees it. A read that was overtaken by a later
+ * QueueWrite or Forget for the same chunk is discarded when it completes.
+ *
+ * Index: the first worker run scans the directory for saved chunks (GetPersistedChunks), so callers
+ * can tell which unloaded chunks hold persisted edits without a read per chunk.
+ *
+ * One worker at a time drains the queues on the thread pool and is the only thread touching the
+ * FVoxelWorldSave while active. Every public method is game-thread only; the destructor flushes.
+ */
+class VOXELSTREAMING_API FVoxelChunkPersistence
+{
+public:
+	FVoxelChunkPersistence(const FString& InDirectory, int32 InChunkSize, int32 InMaxQueuedWrites = 256, int32 InMaxQueuedReads = 128,
+		float InCompactDeadRatio = 0.5f, int32 InCompactEveryWrites = 256);
+	~FVoxelChunkPersistence();
+
+	const FString& GetDirectory() const { return Directory; }
+
+	// ==================== Writes ====================
+
+	/**
+	 * Queue a record for write-behind. An edit-less record removes the chunk from disk. If VoxelData
+	 * is set (a full-resolution ChunkSize^3 array), the worker stores it LZ4-compressed as the record's
+	 * voxel payload so the chunk can load without generating.
+	 * @param bForce Ignore the queue bound (shutdown flush)
+	 * @return False if the write queue is full
+	 */
+	bool QueueWrite(FVoxelChunkRecord&& Record, TSharedPtr<const TArray<FVoxelData>> VoxelData = nullptr, bool bForce = false);
+
+	/** Block until every queued write is on disk, the region files are compacted and flushed. */
+	void Flush();
+
+	/**
+	 * Move out the outcomes Tick collected since the last call, one per chunk whose latest queued
+	 * write finished (a write superseded by a later QueueWrite for the same chunk is not reported).
+	 */
+	void TakeFinishedWrites(TArray<FVoxelChunkWriteResult>& OutResults);
+
+	/** True while a write for the chunk is queued or in flight (or finished but not yet ticked). */
+	bool IsWritePending(const FIntVector& ChunkCoord) const { return InFlightWrites.Contains(ChunkCoord); }
+
+	// ==================== Reads ====================
+
+	/**
+	 * Queue a read-ahead for a chunk about to be requested (no-op if already tracked). False if the
+	 * read queue is full or MaxQueuedReads * 4 chunks are already tracked.
+	 */
+	bool Prefetch(const FIntVector& ChunkCoord);
+
+	/** Current knowledge of a chunk's record. Unknown chunks get a read queued if bRequestIfUnknown (and room). */
+	EVoxelPersistedChunk Lookup(const FIntVector& ChunkCoord, bool bRequestIfUnknown = true);
+
+	/** Move a Found record out; the chunk becomes Unknown again. */
+	bool TakeRecord(const FIntVector& ChunkCoord, FVoxelChunkRecord& OutRecord);
+
+	/** Drop whatever is tracked for a chunk (it left the generation queue); a late read is discarded. */
+	void Forget(const FIntVector& ChunkCoord);
+
+	/** Game-thread pump: move finished reads into the lookup table and collect finished writes. */
+	void Tick();
+
+	int32 GetWriteQueueDepth() const { return WriteQueueDepth.load(std::memory_order_relaxed); }
+	int32 GetReadQueueDepth() const { return NumPendingReads; }
+	int32 GetTrackedChunkCount() const { return Tracked.Num(); }
+
+	/**
+	 * Chunks with a record on disk or queued for one: the worker's startup scan of the directory
+	 * (merged on the first Tick after it finishes) plus this session's writes.
+	 */
+	const TSet<FIntVector>& GetPersistedChunks() const { return PersistedChunks; }
+	bool IsIndexReady() const { return bIndexMerged; }
+
+	/** Bumped whenever GetPersistedChunks changes, so callers can cache views of it. */
+	uint32 GetPersistedChunksGeneration() const { return PersistedChunksGeneration; }
+
+	FVoxelChunkPersistenceStats GetStats() const;
+
+private:
+	struct FWriteJob
+	{
+		FVoxelChunkRecord Record;
+		TSharedPtr<const TArray<FVoxelData>> VoxelData;
+		uint32 Serial = 0;
+	};
+
+	struct FWriteCompletion
+	{
+		FIntVector ChunkCoord;
+		uint32 Serial = 0;
+		bool bSucceeded = false;
+	};
+
+	struct FReadJob
+	{
+		FIntVector ChunkCoord;
+		uint32 Ticket = 0;
+	};
+
+	struct FReadResult
+	{
+		FIntVector ChunkCoord;
+		uint32 Ticket = 0;
+		bool bFound = false;
+		FVoxelChunkRecord Record;
+	};
+
+	struct FTrackedChunk
+	{
+		EVoxelPersistedChunk State = EVoxelPersistedChunk::Unknown;
+		uint32 Ticket = 0;
+		FVoxelChunkRecord Record;
+	};
+
+	/** Queue a read and mark the chunk Pending. Caller checked the bound. */
+	void RequestRead(const FIntVector& ChunkCoord);
+
+	/** Start a worker if none is active. Caller holds InboxLock. */
+	void KickWorker_Locked();
+
+	/** Worker body: drain batches until both inbox queues are empty. */
+	void WorkerLoop();
+
+	FString Directory;
+	int32 ChunkSize = VOXEL_DEFAULT_CHUNK_SIZE;
+	int32 MaxQueuedWrites = 256;
+	int32 MaxQueuedReads = 128;
+	float CompactDeadRatio = 0.5f;
+	int32 CompactEveryWrites = 256;
+
+	/** Owned by whichever thread is draining (the worker while bWorkerActive, else the game thread) */
+	TUniquePtr<FVoxelWorldSave> Save;
+
+	/** Guards PendingWrites / PendingReads / bWorkerActive / the index hand-off */
+	mutable FCriticalSection InboxLock;
+	TMap<FIntVector, FWriteJob> PendingWrites;
+	TArray<FReadJob> PendingReads;
+	bool bWorkerActive = false;
+	bool bIndexPending = true;
+	bool bIndexReady = false;
+	TArray<FIntVector> IndexResult;
+
+	TQueue<FReadResult, EQueueMode::Mpsc> CompletedReads;
+	TQueue<FWriteCompletion, EQueueMode::Mpsc> CompletedWrites;
+
+	/** Game-thread: serial of each chunk's latest queued write until its completion is ticked */
+	TMap<FIntVector, uint32> InFlightWrites;
+	TArray<FVoxelChunkWriteResult> FinishedWrites;
+	uint32 NextWriteSerial = 1;
+
+	/** Worker-only: writes since the last compaction pass */
+	int32 WritesSinceCompact = 0;
+
+	/** Game-thread lookup table */
+	TMap<FIntVector, FTrackedChunk> Tracked;
+	uint32 NextTicket = 1;
+
+	/** Reads queued whose result Tick has not consumed yet (bounded by MaxQueuedReads) */
+	int32 NumPendingReads = 0;
+
+	/** See GetPersistedChunks. Chunks written before the index lands override its stale view. */
+	TSet<FIntVector> PersistedChunks;
+	TSet<FIntVector> WrittenBeforeIndex;
+	bool bIndexMerged = false;
+	uint32 PersistedChunksGeneration = 0;
+
+	/** Published by the worker, read by the game thread */
+	std::atomic<int32> WriteQueueDepth{ 0 };
+	std::atomic<int64> ChunksRead{ 0 };
+	std::atomic<int64> ChunksWritten{ 0 };
+	std::atomic<int64> BytesRead{ 0 };
+	std::atomic<int64> BytesWritten{ 0 };
+	std::atomic<int64> ReadMicros{ 0 };
+	std::atomic<int64> WriteMicros{ 0 };
+	std::atomic<int64> WriteFailures{ 0 };
+	std::atomic<int64> Compactions{ 0 };
+
+	int64 WritesRejected = 0;
+	int64 ReadsRejected = 0;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "VoxelCoreTypes.h"
+#include "VoxelChunkPriorityQueue.h"
 #include "Containers/Queue.h"
 #include "Components/PrimitiveComponent.h"
 #include "Chaos/TriangleMeshImplicitObject.h"
@@ -112,13 +113,47 @@ struct FCollisionCookRequest
 	/** Priority for processing (higher = sooner) */
 	float Priority = 0.0f;
 
-	/** Comparison for priority queue (lower priority value = earlier in array, highest at back) */
+	/** Comparison by priority (lower priority value sorts first) */
 	bool operator<(const FCollisionCookRequest& Other) const
 	{
 		return Priority < Other.Priority;
 	}
 };
 
+/**
+ * Settings for the collision-only mesh post-process (UVoxelCollisionManager::PostProcessCollisionMesh).
+ */
+struct FVoxelCollisionMeshSettings
+{
+	/** Positions closer than this (world units) weld into one vertex; <= 0 welds bit-identical positions only */
+	float WeldTolerance = 0.0f;
+
+	/** Simplification stops at this fraction of the welded triangle count (1 = no simplification) */
+	float SimplifyTargetRatio = 1.0f;
+
+	/** Simplification cost bound in world units, compared against the summed collapse quadric (0 = no simplification) */
+	float SimplifyMaxError = 0.0f;
+};
+
+/** Counters from one collision mesh post-process. */
+struct FVoxelCollisionMeshStats
+{
+	int32 InputVertices = 0;
+	int32 InputTriangles = 0;
+
+	/** Skirt triangles dropped (render-only LOD crack hiding) */
+	int32 SkirtTriangles = 0;
+
+	/** Vertices removed by welding, and triangles that collapsed to degenerate as a result */
+	int32 WeldedVertices = 0;
+	int32 DegenerateTriangles = 0;
+
+	int32 OutputVertices = 0;
+	int32 OutputTriangles = 0;
+
+	float TimeMs = 0.0f;
+};
+
 /**
  * Result of an async collision cooking task (mesh gen + trimesh construction on thread pool).
  */
@@ -130,6 +165,9 @@ struct FAsyncCollisionResult
 	int32 NumVertices = 0;
 	int32 NumTriangles = 0;
 	bool bSuccess = false;
+
+	/** Collision post-process counters (weld / skirt drop / simplification) on the worker */
+	FVoxelCollisionMeshStats MeshStats;
 };
 
 /**
@@ -167,6 +205,13 @@ public:
 	float LastPrepMs = 0.0f;
 	float LastApplyMs = 0.0f;
 
+	/**
+	 * Worker-side collision mesh post-process attribution for the cooks applied this Update: summed
+	 * post-process time and the triangles it removed. Not game-thread time; reported beside CollPrepMs.
+	 */
+	float LastPostProcessMs = 0.0f;
+	int32 LastTrianglesRemoved = 0;
+
 	// ==================== Lifecycle ====================
 
 	/**
@@ -318,6 +363,31 @@ public:
 	 */
 	void RequestCollision(const FIntVector& ChunkCoord, float Priority);
 
+	/**
+	 * Whether a render mesh of ChunkCoord at LODLevel, about to be launched, should offer its
+	 * geometry to this chunk's next collision cook (voxel.Collision.ReuseRenderMesh). True when the
+	 * LOD matches CollisionLODLevel, the chunk is within the effective collision radius (plus one
+	 * chunk of slack), and its collision is missing or dirty. Game thread only.
+	 */
+	bool WantsRenderMeshOffer(const FIntVector& ChunkCoord, int32 LODLevel) const;
+
+	// ==================== Collision Mesh Post-Process ====================
+
+	/**
+	 * Reduce a chunk mesh to what Chaos needs before the trimesh build (thread-safe, any thread).
+	 *
+	 * Drops skirt strips (indices from SkirtIndexStart on), welds coincident positions (the
+	 * meshers duplicate vertices across material / UV seams and per cell), removes triangles
+	 * that degenerate, then runs FVoxelMeshSimplifier on the positions-only mesh so coplanar
+	 * regions merge within SimplifyMaxError. Open edges stay locked, so chunk rims keep matching
+	 * their neighbours' collision. Render attributes never reach this point.
+	 */
+	static FVoxelCollisionMeshStats PostProcessCollisionMesh(
+		TArray<FVector3f>& Positions,
+		TArray<uint32>& Indices,
+		int32 SkirtIndexStart,
+		const FVoxelCollisionMeshSettings& Settings);
+
 	// ==================== Events ====================
 
 	/** Called when a chunk's collision becomes ready */
@@ -469,11 +539,8 @@ protected:
 
 	// ==================== Async Cooking Pipeline ====================
 
-	/** Queue of chunks waiting to be launched as async tasks */
-	TArray<FCollisionCookRequest> CookingQueue;
-
-	/** Set of chunk coords in CookingQueue for O(1) duplicate detection */
-	TSet<FIntVector> CookingQueueSet;
+	/** Chunks waiting to be launched as async tasks (indexed max-heap on Priority; O(1) membership) */
+	TVoxelChunkPriorityQueue<FCollisionCookRequest> CookingQueue;
 
 	/** Set of chunks currently being cooked asynchronously on thread pool */
 	TSet<FIntVector> AsyncCollisionInProgress;
@@ -516,4 +583,12 @@ protected:
 
 	/** Total collision meshes removed */
 	int64 TotalCollisionsRemoved = 0;
+
+	/** Cooks built from an offered render mesh vs. cooks that ran their own meshing pass */
+	int64 TotalRenderMeshReuses = 0;
+	int64 TotalMeshedCooks = 0;
+
+	/** Triangles entering / leaving the collision mesh post-process over all applied cooks */
+	int64 TotalPostProcessInputTriangles = 0;
+	int64 TotalPostProcessOutputTriangles = 0;
 };
@@ -80,8 +80,16 @@ private:
 		int64 RemeshCount;
 		// Seam-ownership pipeline (TickSeamScheduler total: scheduling + dispatch + submits)
 		float SeamMs;
-		// Collision sub-phases (P4a): cook-launch prep vs completed-cook apply (both GT)
-		float CollPrepMs, CollApplyMs;
+		// Collision sub-phases (P4a): cook-launch prep vs completed-cook apply (both GT), plus the
+		// worker-side collision mesh post-process of the applied cooks (time + triangles removed)
+		float CollPrepMs, CollPostMs;
+		int32 CollTrisCut;
+		float CollApplyMs;
+		// Chunk persistence (0 when disabled): GT tick cost, worker throughput since the previous
+		// sample, and the bounded queue depths
+		float PersistMs;
+		float PersistReadMBps, PersistWriteMBps;
+		int32 PersistWriteQ, PersistReadQ;
 	};
 
 	void TakeSample(float DeltaTime);
@@ -112,6 +120,12 @@ private:
 	TArray<FSample> Samples;
 	FString ReportCsvPath;
 
+	// Persistence byte totals at the previous sample (throughput columns are per-sample deltas)
+	int64 LastPersistBytesRead = 0;
+	int64 LastPersistBytesWritten = 0;
+	int64 FirstPersistBytesRead = -1;
+	int64 FirstPersistBytesWritten = -1;
+
 	// Fly-pawn state (so the viewer flies the path instead of a character running + falling through).
 	TWeakObjectPtr<APawn> FlyPawn;
 	FVector OriginalPawnLocation = FVector::ZeroVector;
@@ -0,0 +1,149 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VoxelCollisionManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Collision mesh post-process (UVoxelCollisionManager::PostProcessCollisionMesh).
+// Pure-logic tests (no world / no physics scene). A per-triangle vertex soup
+// of a flat grid (the duplication the meshers emit across cells and material
+// seams) must weld back to the shared lattice, appended skirts must vanish,
+// and simplification must collapse the plane while the rim keeps its shape.
+// ---------------------------------------------------------------------------
+
+namespace CollisionMeshTestUtils
+{
+	/** Flat N x N grid at Z = 0 with three unshared vertices per triangle, plus a skirt strip under the Y = 0 rim */
+	static void MakeSoupGrid(int32 N, float Step, TArray<FVector3f>& OutPositions, TArray<uint32>& OutIndices, int32& OutSkirtIndexStart)
+	{
+		auto AddTriangle = [&OutPositions, &OutIndices](const FVector3f& A, const FVector3f& B, const FVector3f& C)
+		{
+			const uint32 Base = OutPositions.Num();
+			OutPositions.Append({ A, B, C });
+			OutIndices.Append({ Base, Base + 1, Base + 2 });
+		};
+
+		for (int32 Y = 0; Y < N; ++Y)
+		{
+			for (int32 X = 0; X < N; ++X)
+			{
+				const FVector3f P00(X * Step, Y * Step, 0.0f);
+				const FVector3f P10((X + 1) * Step, Y * Step, 0.0f);
+				const FVector3f P01(X * Step, (Y + 1) * Step, 0.0f);
+				const FVector3f P11((X + 1) * Step, (Y + 1) * Step, 0.0f);
+				AddTriangle(P00, P10, P11);
+				AddTriangle(P00, P11, P01);
+			}
+		}
+
+		OutSkirtIndexStart = OutIndices.Num();
+		for (int32 X = 0; X < N; ++X)
+		{
+			const FVector3f T0(X * Step, 0.0f, 0.0f);
+			const FVector3f T1((X + 1) * Step, 0.0f, 0.0f);
+			const FVector3f B0 = T0 - FVector3f(0, 0, 2.0f * Step);
+			const FVector3f B1 = T1 - FVector3f(0, 0, 2.0f * Step);
+			AddTriangle(T0, B1, T1);
+			AddTriangle(T0, B0, B1);
+		}
+	}
+
+	/** Number of edges used by exactly one triangle */
+	static int32 CountOpenEdges(const TArray<uint32>& Indices)
+	{
+		TMap<TPair<uint32, uint32>, int32> EdgeUses;
+		for (int32 i = 0; i < Indices.Num(); i += 3)
+		{
+			for (int32 e = 0; e < 3; ++e)
+			{
+				const uint32 A = Indices[i + e];
+				const uint32 B = Indices[i + (e + 1) % 3];
+				EdgeUses.FindOrAdd(TPair<uint32, uint32>(FMath::Min(A, B), FMath::Max(A, B)))++;
+			}
+		}
+		int32 Open = 0;
+		for (const auto& Pair : EdgeUses)
+		{
+			Open += Pair.Value == 1;
+		}
+		return Open;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionMeshWeldTest,
+	"VoxelWorlds.Collision.PostProcess.WeldAndSkirts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCollisionMeshWeldTest::RunTest(const FString& Parameters)
+{
+	using namespace CollisionMeshTestUtils;
+
+	constexpr int32 N = 8;
+	TArray<FVector3f> Positions;
+	TArray<uint32> Indices;
+	int32 SkirtIndexStart = INDEX_NONE;
+	MakeSoupGrid(N, 100.0f, Positions, Indices, SkirtIndexStart);
+
+	// Weld + skirt drop only
+	FVoxelCollisionMeshSettings Settings;
+	Settings.WeldTolerance = 1.0f;
+	const FVoxelCollisionMeshStats Stats = UVoxelCollisionManager::PostProcessCollisionMesh(Positions, Indices, SkirtIndexStart, Settings);
+
+	TestEqual(TEXT("skirt triangles dropped"), Stats.SkirtTriangles, N * 2);
+	TestEqual(TEXT("surface triangles kept"), Indices.Num() / 3, N * N * 2);
+	TestEqual(TEXT("soup welds to the shared lattice"), Positions.Num(), (N + 1) * (N + 1));
+	TestEqual(TEXT("no skirt vertex survives"), Positions.FilterByPredicate([](const FVector3f& P) { return P.Z < 0.0f; }).Num(), 0);
+	TestEqual(TEXT("welded grid is closed except for its rim"), CountOpenEdges(Indices), N * 4);
+	TestEqual(TEXT("stats match output"), Stats.OutputTriangles, Indices.Num() / 3);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionMeshSimplifyTest,
+	"VoxelWorlds.Collision.PostProcess.Simplify",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCollisionMeshSimplifyTest::RunTest(const FString& Parameters)
+{
+	using namespace CollisionMeshTestUtils;
+
+	constexpr int32 N = 16;
+	constexpr float Step = 100.0f;
+	TArray<FVector3f> Positions;
+	TArray<uint32> Indices;
+	int32 SkirtIndexStart = INDEX_NONE;
+	MakeSoupGrid(N, Step, Positions, Indices, SkirtIndexStart);
+
+	FVoxelCollisionMeshSettings Settings;
+	Settings.WeldTolerance = 1.0f;
+	Settings.SimplifyTargetRatio = 0.01f;
+	Settings.SimplifyMaxError = 10.0f;
+	const FVoxelCollisionMeshStats Stats = UVoxelCollisionManager::PostProcessCollisionMesh(Positions, Indices, SkirtIndexStart, Settings);
+
+	TestTrue(FString::Printf(TEXT("coplanar grid collapses more than 5x (%d -> %d)"), N * N * 2, Stats.OutputTriangles),
+		Stats.OutputTriangles * 5 < N * N * 2);
+
+	double Area = 0.0;
+	float MaxAbsZ = 0.0f;
+	for (int32 i = 0; i < Indices.Num(); i += 3)
+	{
+		const FVector3d P0(Positions[Indices[i]]);
+		const FVector3d P1(Positions[Indices[i + 1]]);
+		const FVector3d P2(Positions[Indices[i + 2]]);
+		Area += ((P1 - P0) ^ (P2 - P0)).Size() * 0.5;
+	}
+	for (const FVector3f& P : Positions)
+	{
+		MaxAbsZ = FMath::Max(MaxAbsZ, FMath::Abs(P.Z));
+	}
+	TestEqual(TEXT("surface stays in its plane"), MaxAbsZ, 0.0f);
+	TestTrue(TEXT("surface area preserved"), FMath::IsNearlyEqual(Area, FMath::Square(N * Step), 1.0));
+	TestEqual(TEXT("rim keeps every lattice point"), CountOpenEdges(Indices), N * 4);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
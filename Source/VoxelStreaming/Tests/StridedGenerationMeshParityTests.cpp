@@ -0,0 +1,242 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "InfinitePlaneWorldMode.h"
+#include "VoxelCPUNoiseGenerator.h"
+#include "VoxelCPUMarchingCubesMesher.h"
+#include "VoxelMeshingTypes.h"
+#include "VoxelNeighborSliceExtraction.h"
+#include "VoxelStridedLattice.h"
+#include "ChunkRenderData.h"
+#include "VoxelData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// LOD-strided generation (voxel.Generation.LODStride) at mesh level.
+// A 3x3x3 block of real CPU-generated heightmap chunks (water level on) is
+// meshed by the CPU Marching Cubes LOD path the way the chunk manager runs it
+// while strided generation is active: lattice reads, no transition cells,
+// padded apron at the default deep-plane depth. The centre chunk is generated
+// at half its mesh stride; its neighbours at the strides a 2:1-balanced
+// finer, same-LOD or coarser neighbour would carry. Every mesh must be
+// bit-identical to meshing full-resolution generation at the same stride.
+// ---------------------------------------------------------------------------
+
+namespace StridedMeshParityTestUtils
+{
+	constexpr int32 kChunkSize = 32;
+	constexpr float kVoxelSize = 100.0f;
+
+	static FVoxelNoiseGenerationRequest MakeRequest(const FIntVector& ChunkCoord, float WaterLevel)
+	{
+		FVoxelNoiseGenerationRequest Request;
+		Request.ChunkCoord = ChunkCoord;
+		Request.ChunkSize = kChunkSize;
+		Request.VoxelSize = kVoxelSize;
+		Request.WorldMode = EWorldMode::InfinitePlane;
+		Request.SeaLevel = 0.0f;
+		Request.HeightScale = 3000.0f;
+		Request.BaseHeight = 0.0f;
+		Request.bEnableBiomes = false;
+		Request.bEnableCaves = false;
+		Request.bEnableWaterLevel = true;
+		Request.WaterLevel = WaterLevel;
+		Request.NoiseParams.NoiseType = EVoxelNoiseType::Simplex;
+		Request.NoiseParams.Seed = 1337;
+		Request.NoiseParams.Frequency = 0.0004f;
+		Request.NoiseParams.Amplitude = 1.0f;
+		Request.NoiseParams.Octaves = 4;
+		Request.NoiseParams.Lacunarity = 2.0f;
+		Request.NoiseParams.Persistence = 0.5f;
+		return Request;
+	}
+
+	/** Generate a chunk at Stride and expand it to the full array the manager's snapshot would hold. */
+	static TSharedPtr<const TArray<FVoxelData>> Generate(FVoxelCPUNoiseGenerator& Generator,
+		const FIntVector& ChunkCoord, float WaterLevel, int32 Stride)
+	{
+		FVoxelNoiseGenerationRequest Request = MakeRequest(ChunkCoord, WaterLevel);
+		Request.GenerationStride = Stride;
+		TArray<FVoxelData> Data;
+		if (!Generator.GenerateChunkCPU(Request, Data))
+		{
+			return nullptr;
+		}
+		if (Stride > 1)
+		{
+			TArray<FVoxelData> Expanded;
+			FVoxelStridedLattice::Expand(Data.GetData(), kChunkSize, Stride, Expanded);
+			return MakeShared<const TArray<FVoxelData>>(MoveTemp(Expanded));
+		}
+		return MakeShared<const TArray<FVoxelData>>(MoveTemp(Data));
+	}
+
+	/** Padded lattice-read request for the centre chunk of a [-1,1]^3 block, meshed at LODLevel. */
+	static FVoxelMeshingRequest MakeMeshRequest(int32 LODLevel, TFunctionRef<TSharedPtr<const TArray<FVoxelData>>(const FIntVector&)> GetChunk)
+	{
+		FVoxelMeshingRequest R;
+		R.ChunkSize = kChunkSize;
+		R.VoxelSize = kVoxelSize;
+		R.LODLevel = LODLevel;
+		R.bLatticeReads = true;
+		R.SharedVoxelData = GetChunk(FIntVector::ZeroValue);
+		VoxelNeighborSlices::InitPadded(false, false, EVoxelApronFill::ClampToChunk, GetChunk, R);
+		R.AssemblePaddedVolume();
+		return R;
+	}
+
+	static bool MeshesIdentical(const FChunkMeshData& A, const FChunkMeshData& B)
+	{
+		return A.Positions == B.Positions && A.Normals == B.Normals && A.UVs == B.UVs
+			&& A.UV1s == B.UV1s && A.Colors == B.Colors && A.Indices == B.Indices;
+	}
+}
+
+// ===========================================================================
+// 1. Sampled voxels (incl. water flags) match full-resolution generation.
+// ===========================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelStridedGenerationSampleParityTest,
+	"VoxelWorlds.Streaming.StridedGeneration.SampleParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelStridedGenerationSampleParityTest::RunTest(const FString& Parameters)
+{
+	using namespace StridedMeshParityTestUtils;
+
+	FVoxelCPUNoiseGenerator Generator;
+	Generator.Initialize();
+
+	const FVoxelNoiseGenerationRequest Probe = MakeRequest(FIntVector::ZeroValue, 0.0f);
+	FInfinitePlaneWorldMode WorldMode(FWorldModeTerrainParams(Probe.SeaLevel, Probe.HeightScale, Probe.BaseHeight));
+	const float ChunkWorldSize = kChunkSize * kVoxelSize;
+	const float SurfaceZ = WorldMode.GetTerrainHeightAt(0.5f * ChunkWorldSize, 0.5f * ChunkWorldSize, Probe.NoiseParams);
+	const FIntVector Coord(0, 0, FMath::FloorToInt(SurfaceZ / ChunkWorldSize));
+
+	const TSharedPtr<const TArray<FVoxelData>> Full = Generate(Generator, Coord, SurfaceZ, 1);
+	if (!TestTrue(TEXT("full-resolution chunk generated"), Full.IsValid()))
+	{
+		return false;
+	}
+
+	int32 WaterVoxels = 0;
+	for (const FVoxelData& Voxel : *Full)
+	{
+		WaterVoxels += Voxel.HasWaterFlag() ? 1 : 0;
+	}
+	TestTrue(TEXT("water level floods part of the chunk"), WaterVoxels > 0);
+
+	for (const int32 Stride : { 2, 4, 8 })
+	{
+		const TSharedPtr<const TArray<FVoxelData>> Strided = Generate(Generator, Coord, SurfaceZ, Stride);
+		if (!TestTrue(FString::Printf(TEXT("stride %d chunk generated"), Stride), Strided.IsValid()))
+		{
+			continue;
+		}
+
+		TArray<int32> Coords;
+		FVoxelStridedLattice::BuildAxisCoords(kChunkSize, Stride, Coords);
+		int32 Mismatches = 0;
+		for (const int32 Z : Coords)
+		{
+			for (const int32 Y : Coords)
+			{
+				for (const int32 X : Coords)
+				{
+					const int32 Index = X + Y * kChunkSize + Z * kChunkSize * kChunkSize;
+					Mismatches += ((*Strided)[Index] == (*Full)[Index]) ? 0 : 1;
+				}
+			}
+		}
+		TestEqual(FString::Printf(TEXT("stride %d samples match full resolution"), Stride), Mismatches, 0);
+	}
+
+	return true;
+}
+
+// ===========================================================================
+// 2. Meshes of strided generation match full-resolution generation.
+// ===========================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelStridedGenerationMeshParityTest,
+	"VoxelWorlds.Streaming.StridedGeneration.MeshParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelStridedGenerationMeshParityTest::RunTest(const FString& Parameters)
+{
+	using namespace StridedMeshParityTestUtils;
+
+	FVoxelCPUNoiseGenerator Generator;
+	Generator.Initialize();
+
+	FVoxelCPUMarchingCubesMesher Mesher;
+	Mesher.Initialize();
+	FVoxelMeshingConfig MeshConfig;
+	MeshConfig.bUseSmoothMeshing = true;
+	MeshConfig.IsoLevel = 0.5f;
+	MeshConfig.bUseTransvoxel = false;
+	Mesher.SetConfig(MeshConfig);
+
+	const FVoxelNoiseGenerationRequest Probe = MakeRequest(FIntVector::ZeroValue, 0.0f);
+	FInfinitePlaneWorldMode WorldMode(FWorldModeTerrainParams(Probe.SeaLevel, Probe.HeightScale, Probe.BaseHeight));
+	const float ChunkWorldSize = kChunkSize * kVoxelSize;
+	const float SurfaceZ = WorldMode.GetTerrainHeightAt(0.5f * ChunkWorldSize, 0.5f * ChunkWorldSize, Probe.NoiseParams);
+	const FIntVector Centre(0, 0, FMath::FloorToInt(SurfaceZ / ChunkWorldSize));
+
+	// Full-resolution block, plus strided blocks generated on demand per stride.
+	TMap<TPair<FIntVector, int32>, TSharedPtr<const TArray<FVoxelData>>> Chunks;
+	auto GetChunk = [&](const FIntVector& Offset, int32 Stride) -> TSharedPtr<const TArray<FVoxelData>>
+	{
+		const TPair<FIntVector, int32> Key(Offset, Stride);
+		if (const TSharedPtr<const TArray<FVoxelData>>* Found = Chunks.Find(Key))
+		{
+			return *Found;
+		}
+		return Chunks.Add(Key, Generate(Generator, Centre + Offset, SurfaceZ, Stride));
+	};
+
+	for (const int32 LODLevel : { 2, 3 })
+	{
+		const int32 MeshStride = 1 << LODLevel;
+		const int32 CentreStride = MeshStride / 2;
+
+		FChunkMeshData Reference;
+		const FVoxelMeshingRequest FullRequest = MakeMeshRequest(LODLevel,
+			[&](const FIntVector& Offset) { return GetChunk(Offset, 1); });
+		TestTrue(TEXT("full-resolution block meshes"), Mesher.GenerateMeshCPU(FullRequest, Reference));
+		TestTrue(FString::Printf(TEXT("LOD %d reference mesh is not empty"), LODLevel), Reference.Positions.Num() > 0);
+
+		// Neighbour generation strides: a finer (LOD - 1), same-LOD and coarser (LOD + 1) neighbour
+		for (const int32 NeighborStride : { FMath::Max(MeshStride / 4, 1), MeshStride / 2, MeshStride })
+		{
+			FChunkMeshData Strided;
+			const FVoxelMeshingRequest StridedRequest = MakeMeshRequest(LODLevel,
+				[&](const FIntVector& Offset) { return GetChunk(Offset, Offset == FIntVector::ZeroValue ? CentreStride : NeighborStride); });
+			TestTrue(TEXT("strided block meshes"), Mesher.GenerateMeshCPU(StridedRequest, Strided));
+
+			AddInfo(FString::Printf(TEXT("LOD %d, centre stride %d, neighbour stride %d: %d vs %d vertices"),
+				LODLevel, CentreStride, NeighborStride, Strided.Positions.Num(), Reference.Positions.Num()));
+			TestTrue(FString::Printf(TEXT("LOD %d mesh with neighbour stride %d matches full resolution"), LODLevel, NeighborStride),
+				MeshesIdentical(Strided, Reference));
+		}
+
+		// The finer neighbour's view: meshed at the centre's generation stride, reading this chunk's faces
+		if (CentreStride >= 2)
+		{
+			const int32 FinerLOD = LODLevel - 1;
+			FChunkMeshData FinerReference, FinerStrided;
+			const FVoxelMeshingRequest FinerFull = MakeMeshRequest(FinerLOD,
+				[&](const FIntVector& Offset) { return GetChunk(Offset, 1); });
+			const FVoxelMeshingRequest FinerRequest = MakeMeshRequest(FinerLOD,
+				[&](const FIntVector& Offset) { return GetChunk(Offset, Offset == FIntVector::ZeroValue ? 1 : CentreStride); });
+			TestTrue(TEXT("finer full-resolution block meshes"), Mesher.GenerateMeshCPU(FinerFull, FinerReference));
+			TestTrue(TEXT("finer strided block meshes"), Mesher.GenerateMeshCPU(FinerRequest, FinerStrided));
+			TestTrue(FString::Printf(TEXT("LOD %d chunk next to LOD %d strided neighbours matches full resolution"), FinerLOD, LODLevel),
+				MeshesIdentical(FinerStrided, FinerReference));
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
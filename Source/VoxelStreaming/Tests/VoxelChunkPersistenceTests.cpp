@@ -0,0 +1,252 @@
+// Copyright Daniel Raquel. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "VoxelChunkPersistence.h"
+#include "VoxelChunkCodec.h"
+#include "VoxelWorldSave.h"
+#include "VoxelEditTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Async chunk persistence (FVoxelChunkPersistence): a queued write becomes
+// readable through Lookup / TakeRecord once the worker has run, unsaved chunks
+// report Missing, the saved-chunk index lists what a previous session wrote,
+// destroying the stage flushes queued writes to disk, a voxel payload
+// handed over raw comes back as a decodable codec buffer, finished writes are
+// reported once per chunk, and rewrites get compacted on the worker.
+// ---------------------------------------------------------------------------
+
+namespace VoxelChunkPersistenceTestUtils
+{
+	constexpr int32 ChunkSize = VOXEL_DEFAULT_CHUNK_SIZE;
+
+	FString MakeTempDir()
+	{
+		return FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("VoxelChunkPersistence"), FGuid::NewGuid().ToString());
+	}
+
+	void DeleteTempDir(const FString& Dir)
+	{
+		IFileManager::Get().DeleteDirectory(*Dir, false, true);
+	}
+
+	FVoxelChunkRecord MakeRecord(const FIntVector& ChunkCoord, int32 NumEdits)
+	{
+		FChunkEditLayer Layer(ChunkCoord, ChunkSize);
+		for (int32 i = 0; i < NumEdits; ++i)
+		{
+			Layer.ApplyEdit(FVoxelEdit(Layer.GetLocalPosition(i * 7), EEditMode::Add, 20 + (i % 40), static_cast<uint8>(i % 5)));
+		}
+		FVoxelChunkRecord Record;
+		Record.SetEdits(Layer);
+		return Record;
+	}
+
+	bool SameEdits(const FVoxelChunkRecord& A, const FVoxelChunkRecord& B)
+	{
+		return A.EditIndices == B.EditIndices && A.Edits.Num() == B.Edits.Num()
+			&& FMemory::Memcmp(A.Edits.GetData(), B.Edits.GetData(), A.Edits.Num() * sizeof(FVoxelEditDelta)) == 0;
+	}
+
+	/** Pump Tick until the chunk leaves Pending (or ~5s pass); requests the read if Unknown */
+	EVoxelPersistedChunk WaitForLookup(FVoxelChunkPersistence& Persistence, const FIntVector& ChunkCoord)
+	{
+		EVoxelPersistedChunk State = Persistence.Lookup(ChunkCoord);
+		for (int32 Attempt = 0; Attempt < 5000 && (State == EVoxelPersistedChunk::Pending || State == EVoxelPersistedChunk::Unknown); ++Attempt)
+		{
+			FPlatformProcess::Sleep(0.001f);
+			Persistence.Tick();
+			State = Persistence.Lookup(ChunkCoord);
+		}
+		return State;
+	}
+
+	/** Pump Tick until the startup index scan has merged (or ~5s pass) */
+	bool WaitForIndex(FVoxelChunkPersistence& Persistence)
+	{
+		for (int32 Attempt = 0; Attempt < 5000 && !Persistence.IsIndexReady(); ++Attempt)
+		{
+			FPlatformProcess::Sleep(0.001f);
+			Persistence.Tick();
+		}
+		return Persistence.IsIndexReady();
+	}
+
+	/** Pump Tick until no write is pending for the chunk (or ~5s pass), collecting finished writes */
+	void WaitForWrite(FVoxelChunkPersistence& Persistence, const FIntVector& ChunkCoord, TArray<FVoxelChunkWriteResult>& OutResults)
+	{
+		for (int32 Attempt = 0; Attempt < 5000 && Persistence.IsWritePending(ChunkCoord); ++Attempt)
+		{
+			FPlatformProcess::Sleep(0.001f);
+			Persistence.Tick();
+		}
+		TArray<FVoxelChunkWriteResult> Results;
+		Persistence.TakeFinishedWrites(Results);
+		OutResults.Append(Results);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkPersistenceRoundTripTest,
+	"VoxelWorlds.Persistence.Async.WriteThenRead",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkPersistenceRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkPersistenceTestUtils;
+
+	const FString Dir = MakeTempDir();
+	{
+		FVoxelChunkPersistence Persistence(Dir, ChunkSize);
+
+		const FIntVector Coord(3, -2, 1);
+		const FVoxelChunkRecord Expected = MakeRecord(Coord, 200);
+		TestTrue(TEXT("Write queued"), Persistence.QueueWrite(FVoxelChunkRecord(Expected)));
+		TestTrue(TEXT("Queued chunk is indexed immediately"), Persistence.GetPersistedChunks().Contains(Coord));
+
+		TestEqual(TEXT("Written chunk is found"), WaitForLookup(Persistence, Coord), EVoxelPersistedChunk::Found);
+		FVoxelChunkRecord Loaded;
+		TestTrue(TEXT("Record taken"), Persistence.TakeRecord(Coord, Loaded));
+		TestTrue(TEXT("Edits round-trip"), SameEdits(Expected, Loaded));
+		TestEqual(TEXT("Taken chunk is no longer tracked"), Persistence.Lookup(Coord, false), EVoxelPersistedChunk::Unknown);
+
+		TestEqual(TEXT("Never-written chunk is missing"), WaitForLookup(Persistence, FIntVector(40, 40, 40)), EVoxelPersistedChunk::Missing);
+
+		// An edit-less record removes the chunk
+		TestTrue(TEXT("Removal queued"), Persistence.QueueWrite(MakeRecord(Coord, 0)));
+		TestFalse(TEXT("Removed chunk leaves the index"), Persistence.GetPersistedChunks().Contains(Coord));
+		TestEqual(TEXT("Removed chunk is missing"), WaitForLookup(Persistence, Coord), EVoxelPersistedChunk::Missing);
+
+		const FVoxelChunkPersistenceStats Stats = Persistence.GetStats();
+		TestEqual(TEXT("No write failures"), Stats.WriteFailures, (int64)0);
+		TestTrue(TEXT("Bytes written counted"), Stats.BytesWritten > 0);
+	}
+	DeleteTempDir(Dir);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkPersistenceFlushTest,
+	"VoxelWorlds.Persistence.Async.FlushOnDestroyAndIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkPersistenceFlushTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkPersistenceTestUtils;
+
+	const FString Dir = MakeTempDir();
+	const FIntVector CoordA(0, 0, 0);
+	const FIntVector CoordB(-17, 5, 33); // different region
+	const FVoxelChunkRecord ExpectedA = MakeRecord(CoordA, 64);
+	{
+		// Destroyed straight after queueing: the destructor must flush
+		FVoxelChunkPersistence Persistence(Dir, ChunkSize);
+		Persistence.QueueWrite(FVoxelChunkRecord(ExpectedA));
+		Persistence.QueueWrite(MakeRecord(CoordB, 10));
+	}
+	{
+		FVoxelWorldSave Save(Dir, ChunkSize);
+		FVoxelChunkRecord Loaded;
+		TestTrue(TEXT("Queued write is on disk after destroy"), Save.LoadChunk(CoordA, Loaded));
+		TestTrue(TEXT("Flushed edits intact"), SameEdits(ExpectedA, Loaded));
+	}
+	{
+		// A new session's index lists both chunks without a read per chunk
+		FVoxelChunkPersistence Persistence(Dir, ChunkSize);
+		TestTrue(TEXT("Index scan completes"), WaitForIndex(Persistence));
+		TestEqual(TEXT("Index size"), Persistence.GetPersistedChunks().Num(), 2);
+		TestTrue(TEXT("Index has A"), Persistence.GetPersistedChunks().Contains(CoordA));
+		TestTrue(TEXT("Index has B"), Persistence.GetPersistedChunks().Contains(CoordB));
+	}
+	DeleteTempDir(Dir);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkPersistenceVoxelPayloadTest,
+	"VoxelWorlds.Persistence.Async.VoxelPayload",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkPersistenceVoxelPayloadTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkPersistenceTestUtils;
+
+	const int32 NumVoxels = ChunkSize * ChunkSize * ChunkSize;
+	TSharedPtr<TArray<FVoxelData>> Voxels = MakeShared<TArray<FVoxelData>>();
+	Voxels->SetNumZeroed(NumVoxels);
+	for (int32 i = 0; i < NumVoxels; ++i)
+	{
+		const int32 Z = i / (ChunkSize * ChunkSize);
+		(*Voxels)[i] = FVoxelData(static_cast<uint8>(Z % 3), Z < ChunkSize / 2 ? 255 : 0, 0);
+	}
+
+	const FString Dir = MakeTempDir();
+	{
+		FVoxelChunkPersistence Persistence(Dir, ChunkSize);
+		const FIntVector Coord(1, 2, 3);
+		TestTrue(TEXT("Write queued"), Persistence.QueueWrite(MakeRecord(Coord, 16), Voxels));
+
+		TestEqual(TEXT("Chunk is found"), WaitForLookup(Persistence, Coord), EVoxelPersistedChunk::Found);
+		FVoxelChunkRecord Loaded;
+		Persistence.TakeRecord(Coord, Loaded);
+		TestTrue(TEXT("Record carries voxels"), Loaded.HasVoxels());
+
+		TArray<FVoxelData> Decoded;
+		TestTrue(TEXT("Payload decodes"), FVoxelChunkCodec::Decompress(Loaded.VoxelBuffer, Decoded));
+		TestTrue(TEXT("Payload matches"), Decoded.Num() == NumVoxels
+			&& FMemory::Memcmp(Decoded.GetData(), Voxels->GetData(), NumVoxels * sizeof(FVoxelData)) == 0);
+		TestTrue(TEXT("Payload compressed"), Loaded.VoxelBuffer.Num() < NumVoxels * static_cast<int32>(sizeof(FVoxelData)));
+	}
+	DeleteTempDir(Dir);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelChunkPersistenceConfirmTest,
+	"VoxelWorlds.Persistence.Async.ConfirmAndCompact",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelChunkPersistenceConfirmTest::RunTest(const FString& Parameters)
+{
+	using namespace VoxelChunkPersistenceTestUtils;
+
+	const FString Dir = MakeTempDir();
+	{
+		// Compact after every write batch, whatever the dead share
+		FVoxelChunkPersistence Persistence(Dir, ChunkSize, 256, 128, 0.0f, 1);
+
+		const FIntVector Coord(2, 2, 2);
+		TestTrue(TEXT("Write queued"), Persistence.QueueWrite(MakeRecord(Coord, 100)));
+		TestTrue(TEXT("Write pending until ticked"), Persistence.IsWritePending(Coord));
+
+		TArray<FVoxelChunkWriteResult> Results;
+		WaitForWrite(Persistence, Coord, Results);
+		TestFalse(TEXT("Write settled"), Persistence.IsWritePending(Coord));
+		TestEqual(TEXT("One result"), Results.Num(), 1);
+		TestTrue(TEXT("Write confirmed"), Results.Num() == 1 && Results[0].ChunkCoord == Coord && Results[0].bSucceeded);
+
+		// Back-to-back rewrites report once, for the latest
+		Results.Reset();
+		for (int32 i = 1; i <= 4; ++i)
+		{
+			TestTrue(TEXT("Rewrite queued"), Persistence.QueueWrite(MakeRecord(Coord, 100 + i * 10)));
+		}
+		const FVoxelChunkRecord Expected = MakeRecord(Coord, 140);
+		WaitForWrite(Persistence, Coord, Results);
+		TestEqual(TEXT("Superseded writes not reported"), Results.Num(), 1);
+
+		Persistence.Flush();
+		TestTrue(TEXT("Rewritten region compacted"), Persistence.GetStats().Compactions > 0);
+
+		TestEqual(TEXT("Compacted chunk is found"), WaitForLookup(Persistence, Coord), EVoxelPersistedChunk::Found);
+		FVoxelChunkRecord Loaded;
+		Persistence.TakeRecord(Coord, Loaded);
+		TestTrue(TEXT("Latest edits survive compaction"), SameEdits(Expected, Loaded));
+	}
+	DeleteTempDir(Dir);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS